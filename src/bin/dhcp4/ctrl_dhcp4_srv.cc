@@ -15,6 +15,7 @@
 #include <dhcp4/json_config_parser.h>
 #include <dhcpsrv/cfgmgr.h>
 #include <dhcpsrv/cfg_db_access.h>
+#include <dhcpsrv/host_mgr.h>
 #include <hooks/hooks_manager.h>
 #include <stats/stats_mgr.h>
 #include <cfgrpt/config_report.h>
@@ -182,9 +183,12 @@ ConstElementPtr
 ControlledDhcpv4Srv::commandLibReloadHandler(const string&, ConstElementPtr) {
 
     /// @todo delete any stored CalloutHandles referring to the old libraries
-    /// Get list of currently loaded libraries and reload them.
+    /// Get list of currently loaded libraries and reload them. The packet
+    /// processing threads must not execute callouts in the meantime.
+    stopPacketThreads();
     HookLibsCollection loaded = HooksManager::getLibraryInfo();
     bool status = HooksManager::loadLibraries(loaded);
+    startPacketThreads();
     if (!status) {
         LOG_ERROR(dhcp4_logger, DHCP4_HOOKS_LIBS_RELOAD_FAIL);
         ConstElementPtr answer = isc::config::createAnswer(1,
@@ -318,6 +322,10 @@ ControlledDhcpv4Srv::commandConfigSetHandler(const string&,
     Daemon::configureLogger(args->get("Logging"),
                             CfgMgr::instance().getStagingCfg());
 
+    // The packet processing threads use the current configuration, so
+    // they are stopped until the new configuration is in place.
+    stopPacketThreads();
+
     // Now we configure the server proper.
     ConstElementPtr result = processConfig(dhcp4);
 
@@ -333,6 +341,10 @@ ControlledDhcpv4Srv::commandConfigSetHandler(const string&,
         CfgMgr::instance().commit();
     }
 
+    // The new configuration may have changed the lease database type,
+    // so it must be checked again whether the threads can be used.
+    startPacketThreads();
+
     return (result);
 }
 
@@ -419,6 +431,35 @@ ControlledDhcpv4Srv::commandLeasesReclaimHandler(const string&,
     return (answer);
 }
 
+ConstElementPtr
+ControlledDhcpv4Srv::commandHostCacheFlushHandler(const string&,
+                                                 ConstElementPtr) {
+    HostMgr& host_mgr = HostMgr::instance();
+    if (!host_mgr.getHostCache()) {
+        return (isc::config::createAnswer(CONTROL_RESULT_ERROR,
+                                          "Host cache is not enabled."));
+    }
+    const size_t count = host_mgr.flushCache();
+    std::ostringstream msg;
+    msg << "Host cache flushed: " << count << " entries removed.";
+    return (isc::config::createAnswer(CONTROL_RESULT_SUCCESS, msg.str()));
+}
+
+ConstElementPtr
+ControlledDhcpv4Srv::commandLatencyGetHandler(const string&,
+                                              ConstElementPtr) {
+    return (isc::config::createAnswer(CONTROL_RESULT_SUCCESS,
+                                      getLatency().toElement()));
+}
+
+ConstElementPtr
+ControlledDhcpv4Srv::commandLatencyResetHandler(const string&,
+                                                ConstElementPtr) {
+    getLatency().reset();
+    return (isc::config::createAnswer(CONTROL_RESULT_SUCCESS,
+                                      "Latency histograms reset."));
+}
+
 ConstElementPtr
 ControlledDhcpv4Srv::processCommand(const string& command,
                                     ConstElementPtr args) {
@@ -467,6 +508,15 @@ ControlledDhcpv4Srv::processCommand(const string& command,
         } else if (command == "config-write") {
             return (srv->commandConfigWriteHandler(command, args));
 
+        } else if (command == "host-cache-flush") {
+            return (srv->commandHostCacheFlushHandler(command, args));
+
+        } else if (command == "latency-get") {
+            return (srv->commandLatencyGetHandler(command, args));
+
+        } else if (command == "latency-reset") {
+            return (srv->commandLatencyResetHandler(command, args));
+
         }
         ConstElementPtr answer = isc::config::createAnswer(1,
                                  "Unrecognized command:" + command);
@@ -622,6 +672,15 @@ ControlledDhcpv4Srv::ControlledDhcpv4Srv(uint16_t port /*= DHCP4_SERVER_PORT*/)
     CommandMgr::instance().registerCommand("libreload",
         boost::bind(&ControlledDhcpv4Srv::commandLibReloadHandler, this, _1, _2));
 
+    CommandMgr::instance().registerCommand("host-cache-flush",
+        boost::bind(&ControlledDhcpv4Srv::commandHostCacheFlushHandler, this, _1, _2));
+
+    CommandMgr::instance().registerCommand("latency-get",
+        boost::bind(&ControlledDhcpv4Srv::commandLatencyGetHandler, this, _1, _2));
+
+    CommandMgr::instance().registerCommand("latency-reset",
+        boost::bind(&ControlledDhcpv4Srv::commandLatencyResetHandler, this, _1, _2));
+
     CommandMgr::instance().registerCommand("leases-reclaim",
         boost::bind(&ControlledDhcpv4Srv::commandLeasesReclaimHandler, this, _1, _2));
 
@@ -650,6 +709,15 @@ ControlledDhcpv4Srv::ControlledDhcpv4Srv(uint16_t port /*= DHCP4_SERVER_PORT*/)
     CommandMgr::instance().registerCommand("statistic-remove-all",
         boost::bind(&StatsMgr::statisticRemoveAllHandler, _1, _2));
 
+    CommandMgr::instance().registerCommand("statistic-sample-age-set",
+        boost::bind(&StatsMgr::statisticSetMaxSampleAgeHandler, _1, _2));
+
+    CommandMgr::instance().registerCommand("statistic-sample-count-set",
+        boost::bind(&StatsMgr::statisticSetMaxSampleCountHandler, _1, _2));
+
+    CommandMgr::instance().registerCommand("statistic-rates-get",
+        boost::bind(&StatsMgr::statisticGetRatesHandler, _1, _2));
+
 }
 
 void ControlledDhcpv4Srv::shutdown() {
@@ -672,16 +740,22 @@ ControlledDhcpv4Srv::~ControlledDhcpv4Srv() {
         CommandMgr::instance().deregisterCommand("config-reload");
         CommandMgr::instance().deregisterCommand("config-test");
         CommandMgr::instance().deregisterCommand("config-write");
+        CommandMgr::instance().deregisterCommand("host-cache-flush");
+        CommandMgr::instance().deregisterCommand("latency-get");
+        CommandMgr::instance().deregisterCommand("latency-reset");
         CommandMgr::instance().deregisterCommand("leases-reclaim");
         CommandMgr::instance().deregisterCommand("libreload");
         CommandMgr::instance().deregisterCommand("config-set");
         CommandMgr::instance().deregisterCommand("shutdown");
         CommandMgr::instance().deregisterCommand("statistic-get");
         CommandMgr::instance().deregisterCommand("statistic-get-all");
+        CommandMgr::instance().deregisterCommand("statistic-rates-get");
         CommandMgr::instance().deregisterCommand("statistic-remove");
         CommandMgr::instance().deregisterCommand("statistic-remove-all");
         CommandMgr::instance().deregisterCommand("statistic-reset");
         CommandMgr::instance().deregisterCommand("statistic-reset-all");
+        CommandMgr::instance().deregisterCommand("statistic-sample-age-set");
+        CommandMgr::instance().deregisterCommand("statistic-sample-count-set");
         CommandMgr::instance().deregisterCommand("version-get");
 
     } catch (...) {
@@ -691,8 +691,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 /* %% [3.0] code to copy yytext_ptr to yytext[] goes here, if %array \ */\
 	(yy_c_buf_p) = yy_cp;
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 158
-#define YY_END_OF_BUFFER 159
+#define YY_NUM_RULES 173
+#define YY_END_OF_BUFFER 174
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -700,149 +700,166 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[1286] =
+static const flex_int16_t yy_accept[1436] =
     {   0,
-      151,  151,    0,    0,    0,    0,    0,    0,    0,    0,
-      159,  157,   10,   11,  157,    1,  151,  148,  151,  151,
-      157,  150,  149,  157,  157,  157,  157,  157,  144,  145,
-      157,  157,  157,  146,  147,    5,    5,    5,  157,  157,
-      157,   10,   11,    0,    0,  140,    0,    0,    0,    0,
+      166,  166,    0,    0,    0,    0,    0,    0,    0,    0,
+      174,  172,   10,   11,  172,    1,  166,  163,  166,  166,
+      172,  165,  164,  172,  172,  172,  172,  172,  159,  160,
+      172,  172,  172,  161,  162,    5,    5,    5,  172,  172,
+      172,   10,   11,    0,    0,  155,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    1,
-      151,  151,    0,  150,  151,    3,    2,    6,    0,  151,
-        0,    0,    0,    0,    0,    0,    4,    0,    0,    9,
+      166,  166,    0,  165,    3,    2,    6,    0,  166,    0,
+        0,    0,    0,    0,    0,    4,    0,    0,    9,  156,
 
-        0,  141,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  143,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  158,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    2,    0,    0,    0,    0,    0,
-        0,    0,    8,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  142,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    8,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  157,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   56,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   71,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  156,  154,    0,
-      153,  152,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  121,    0,  120,    0,    0,   62,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  171,
+      169,    0,  168,  167,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  136,    0,  135,    0,    0,   77,
 
-        0,    0,    0,    0,    0,    0,   29,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   29,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   60,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   15,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   75,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   16,    0,    0,    0,    0,
-      155,  152,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  122,    0,    0,  124,    0,    0,    0,    0,
+        0,   15,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   16,    0,    0,    0,    0,  170,  167,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  137,    0,
 
-        0,    0,    0,   63,    0,    0,    0,    0,   48,    0,
-        0,    0,    0,    0,   78,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   32,    0,    0,    0,    0,    0,
+        0,  139,    0,    0,    0,    0,    0,    0,    0,    0,
+       78,    0,    0,    0,    0,   63,    0,    0,    0,    0,
+        0,   93,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   32,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   62,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   66,    0,   33,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   47,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   51,    0,   33,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   76,   25,
-        0,    0,   30,    0,    0,    0,    0,    0,    0,    0,
-        0,   12,  129,    0,  126,    0,  125,    0,    0,    0,
+        0,   91,   25,    0,    0,   30,    0,    0,    0,    0,
 
-       88,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   70,
+        0,    0,    0,    0,   12,  144,    0,  141,    0,  140,
+        0,    0,    0,  103,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   85,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   27,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   50,    0,    0,    0,    0,    0,    0,
-        0,    0,   89,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   84,    0,    0,    0,    0,    0,    7,    0,
-        0,  127,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   27,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   65,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  104,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   99,    0,    0,    0,    0,    0,    7,    0,
 
+        0,  142,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   72,    0,    0,    0,    0,
-        0,    0,    0,   68,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   53,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   65,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   82,
+        0,    0,    0,   87,    0,    0,    0,    0,    0,    0,
+        0,   83,    0,    0,   39,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   68,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   80,    0,    0,    0,
 
-        0,    0,    0,   93,   66,    0,    0,    0,   71,   26,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       34,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   43,    0,    0,    0,    0,    0,    0,    0,
-      130,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   59,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   83,    0,
-        0,    0,    0,   37,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   31,
-
-        0,    0,    0,    0,   24,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   73,    0,    0,
+        0,    0,    0,   97,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  108,    0,   81,    0,    0,    0,   86,   26,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   34,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   58,    0,    0,    0,    0,    0,    0,    0,
+      145,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   74,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   98,    0,    0,    0,    0,   37,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   80,    0,    0,    0,    0,
-        0,    0,  105,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   54,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   31,    0,
+        0,    0,    0,   24,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   88,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   21,
-        0,    0,    0,    0,    0,    0,    0,  110,    0,    0,
-      108,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-      134,    0,    0,    0,    0,    0,    0,   81,    0,    0,
-        0,    0,   85,   69,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   79,    0,   20,
-        0,   90,    0,    0,    0,    0,    0,  114,    0,    0,
-        0,   45,    0,    0,    0,    0,    0,   92,   28,    0,
+        0,    0,    0,    0,    0,   50,    0,    0,   95,    0,
+        0,    0,    0,    0,    0,    0,  120,    0,    0,    0,
+
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   69,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   49,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   87,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   21,    0,
+        0,    0,    0,    0,    0,    0,    0,  125,    0,    0,
+      123,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      149,    0,    0,    0,    0,    0,    0,    0,   49,   96,
+        0,    0,    0,    0,    0,  100,   84,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   94,    0,   20,    0,  105,    0,    0,    0,    0,
 
-      137,   46,   61,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   40,    0,    0,    0,    0,  111,    0,  109,
-        0,  104,  103,    0,   19,    0,    0,    0,    0,    0,
-      123,    0,    0,   75,    0,    0,    0,    0,    0,    0,
-      101,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       55,    0,    0,   35,    0,    0,    0,    0,  113,    0,
-        0,    0,    0,    0,   57,   41,    0,   86,    0,    0,
-       77,    0,    0,    0,    0,   52,    0,  132,    0,  131,
+        0,    0,    0,    0,    0,    0,  129,    0,    0,    0,
+       60,    0,    0,    0,    0,    0,  107,   28,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   64,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  102,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  152,   61,
+       76,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   55,    0,    0,    0,    0,  126,    0,  124,    0,
+
+      119,  118,    0,   19,    0,    0,    0,    0,    0,  138,
+        0,    0,    0,   90,    0,    0,    0,    0,    0,    0,
+        0,  116,    0,    0,    0,    0,    0,   40,    0,    0,
+        0,    0,    0,   70,    0,    0,    0,    0,    0,   35,
+        0,   44,    0,    0,    0,    0,  128,    0,    0,    0,
+        0,    0,   72,   56,    0,    0,  101,    0,    0,   92,
+        0,    0,    0,    0,   67,    0,  147,    0,  146,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  154,    0,
+       89,    0,    0,   38,  117,    0,    0,  150,  121,    0,
+        0,    0,    0,    0,    0,    0,    0,   23,    0,   22,
+        0,   46,   45,    0,    0,  127,    0,    0,    0,   82,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      139,   74,    0,   38,  102,    0,    0,  135,  106,    0,
-        0,    0,    0,    0,    0,   23,    0,   22,    0,  112,
-        0,    0,    0,   67,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   39,    0,    0,    0,   36,    0,
-        0,    0,    0,    0,    0,   91,    0,    0,  136,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   18,  138,
-       44,    0,  133,  128,    0,    0,   14,    0,    0,  119,
-        0,    0,    0,    0,   99,    0,    0,    0,    0,    0,
-
-        0,   58,    0,    0,    0,    0,    0,    0,    0,   13,
-        0,    0,    0,    0,  107,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   98,   17,    0,  116,    0,    0,
-        0,  115,    0,    0,    0,   97,    0,    0,    0,  118,
+        0,   54,    0,    0,    0,    0,   36,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  106,    0,    0,    0,
+        0,  151,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   18,  153,   59,    0,  148,  143,    0,    0,
+
+        0,    0,   14,    0,    0,  134,    0,    0,    0,    0,
+        0,    0,    0,    0,  114,    0,    0,    0,    0,    0,
+        0,    0,   73,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   41,    0,    0,   13,    0,    0,    0,    0,
+        0,    0,  122,    0,    0,    0,    0,    0,   51,    0,
+        0,    0,    0,    0,    0,    0,    0,   47,    0,  113,
+       17,    0,  131,    0,    0,    0,    0,  130,    0,    0,
+        0,    0,    0,    0,  112,    0,   48,    0,    0,   53,
+      133,    0,   52,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  117,
-        0,    0,    0,    0,    0,    0,   95,  100,   42,    0,
-        0,    0,   94,    0,    0,    0,    0,    0,    0,    0,
-       64,    0,    0,   96,    0
+
+        0,    0,    0,    0,   42,    0,    0,  132,    0,    0,
+        0,    0,    0,    0,    0,  110,  115,   57,    0,    0,
+       43,    0,  109,    0,    0,    0,    0,    0,    0,    0,
+       79,    0,    0,  111,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -858,9 +875,9 @@ static const YY_CHAR yy_ec[256] =
         5,   33,   34,   35,   36,   37,   38,    5,   39,    5,
        40,   41,   42,    5,   43,    5,   44,   45,   46,   47,
 
-       48,   49,   50,   51,   52,   53,   54,   55,   56,   57,
-       58,   59,   60,   61,   62,   63,   64,   65,   66,   67,
-       68,   69,   70,    5,   71,    5,    5,    5,    5,    5,
+       48,   49,   50,   51,   52,   28,   53,   54,   55,   56,
+       57,   58,   59,   60,   61,   62,   63,   64,   65,   66,
+       67,   68,   69,    5,   70,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
@@ -877,696 +894,849 @@ static const YY_CHAR yy_ec[256] =
         5,    5,    5,    5,    5
     } ;
 
-static const YY_CHAR yy_meta[72] =
+static const YY_CHAR yy_meta[71] =
     {   0,
-        1,    1,    2,    3,    3,    4,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    3,    3,    3,    3,
-        5,    5,    5,    5,    5,    5,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    5,    5,    5,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1
     } ;
 
-static const flex_int16_t yy_base[1298] =
+static const flex_int16_t yy_base[1436] =
     {   0,
-        0,   70,   19,   29,   41,   49,   52,   58,   87,   95,
-     1647, 1648,   32, 1643,  141,    0,  201, 1648,  206,   88,
-       11,  213, 1648, 1625,  114,   25,    2,    6, 1648, 1648,
-       73,   11,   17, 1648, 1648, 1648,  104, 1631, 1586,    0,
-     1623,  107, 1638,  217,  247, 1648, 1582,  185, 1581, 1587,
-       93,   58, 1579,   91,  211,  195,   14,  273,  195, 1578,
-      181,  275,  202,  209, 1587,   66,  188, 1586,  232,  219,
-      296,  282,  207, 1569,   78,  301,  302,  296, 1588,    0,
-      341,  357,  365,  371,  376, 1648,    0, 1648,  301,  379,
-      223,  299,  196,  309,  322,  210, 1648, 1585, 1624, 1648,
-
-      283, 1648,  391, 1613,  295, 1571, 1581,  333,  344, 1576,
-      341,  352,  362,  368,  374, 1619,    0,  442,  365, 1563,
-     1565, 1561, 1569,   74, 1565, 1554, 1555,   89, 1571, 1554,
-     1563, 1563,  363, 1554,  364, 1555,  355, 1600, 1604, 1546,
-     1597, 1539, 1562, 1559, 1559, 1553,  351, 1546, 1539, 1544,
-     1538,  378, 1549, 1534, 1533, 1547,  306, 1533,  372, 1549,
-      357,  438, 1536,  364, 1547, 1544, 1545, 1543, 1525, 1527,
-      376, 1519, 1536, 1528,    0,  407,  415,  412,  412,  418,
-      413, 1527, 1648,    0, 1570,  418, 1517, 1520,  416,  423,
-     1528,  446, 1571,  450, 1570,  442, 1569, 1648,  487, 1568,
-
-      460, 1529, 1509, 1525, 1522, 1521,  422, 1562, 1556, 1522,
-     1501, 1509, 1504, 1518, 1514, 1502, 1514, 1514, 1505, 1489,
-     1493, 1506, 1506, 1498, 1488, 1506, 1648, 1501, 1504, 1485,
-     1484, 1534, 1483, 1493, 1496,  465, 1492, 1480, 1491, 1527,
-     1474, 1530, 1483,  481, 1473, 1489, 1470, 1469, 1475, 1466,
-     1465, 1472, 1474, 1519, 1477, 1476, 1470,  274, 1477, 1472,
-     1464, 1470, 1469, 1469, 1450, 1466, 1452, 1458, 1465, 1453,
-     1446, 1460, 1501, 1462,  485, 1453,  480, 1648, 1648,  481,
-     1648, 1648, 1440,    0,  455,  198, 1442,  499,  491, 1496,
-     1449,  486, 1648, 1494, 1648, 1488,  534, 1648,  483, 1430,
-
-     1486, 1432, 1438, 1488, 1445,  398, 1648, 1443, 1485, 1440,
-     1437,  509, 1443, 1481, 1475, 1430, 1425, 1422, 1471, 1430,
-     1419, 1468, 1416,  531, 1430, 1415, 1428, 1415, 1425, 1420,
-     1427, 1422, 1418,  483, 1416, 1419, 1414, 1410, 1458,  503,
-     1452, 1648, 1404, 1403, 1402, 1395, 1397, 1401, 1390, 1403,
-      512, 1448, 1403, 1400, 1404, 1648, 1402, 1391, 1391, 1403,
-     1385, 1377, 1378, 1399, 1381, 1430, 1392, 1391, 1377, 1389,
-     1388, 1387, 1386, 1427, 1426, 1648, 1370, 1369,  555, 1382,
-     1648, 1648, 1381,    0, 1370, 1362,  491, 1367, 1418, 1417,
-     1375, 1415, 1648, 1363, 1413, 1648,  533,  580,  507, 1412,
-
-     1368, 1364, 1352, 1648, 1368, 1367, 1354, 1353, 1648, 1355,
-     1352,  523, 1350, 1352, 1648, 1360, 1357, 1342, 1355, 1350,
-      561, 1357, 1339, 1388, 1648, 1337, 1353, 1385, 1348, 1345,
-     1346, 1348, 1380, 1333, 1328, 1327, 1376, 1322, 1337, 1315,
-     1322, 1327, 1375, 1648, 1322, 1318, 1316, 1320, 1327, 1311,
-     1311, 1321, 1324, 1313, 1308, 1648, 1363, 1648, 1307, 1318,
-     1355, 1302, 1307, 1316, 1310, 1314, 1354, 1348, 1312, 1292,
-     1312, 1294, 1293, 1301, 1305, 1288, 1344, 1286, 1648, 1648,
-     1291, 1289, 1648, 1300, 1334, 1296,    0, 1280, 1297, 1335,
-     1285, 1648, 1648, 1282, 1648, 1288, 1648,  533,  512,  565,
-
-     1648, 1285, 1273, 1324, 1271, 1270, 1277, 1270, 1282, 1281,
-     1281, 1269, 1310, 1277, 1269, 1312, 1258, 1274, 1273, 1648,
-     1258, 1255, 1269, 1261, 1267, 1258, 1266, 1251, 1267, 1249,
-     1263, 1261, 1244, 1238, 1243, 1258, 1255, 1256, 1253, 1294,
-     1251, 1648, 1237, 1239, 1248, 1284, 1283, 1236,  532, 1245,
-     1228, 1229, 1226, 1648, 1240, 1219, 1240, 1237, 1229, 1272,
-     1226, 1270, 1648, 1217, 1231, 1234, 1215, 1265, 1264, 1211,
-     1262, 1261, 1648,   14, 1223, 1206, 1211, 1213, 1648, 1219,
-     1209, 1648, 1254, 1202, 1257,  549,  529,  535, 1207, 1250,
-      561, 1249, 1248, 1247, 1201, 1191, 1244, 1197, 1207, 1241,
-
-     1204, 1198, 1185, 1193, 1236, 1240, 1197, 1196, 1197, 1190,
-     1179, 1192, 1195, 1190, 1191, 1188, 1187, 1190, 1185, 1226,
-     1225, 1175, 1165, 1173, 1221, 1648, 1220, 1169, 1161, 1162,
-     1175, 1162, 1173, 1648, 1161, 1170, 1169, 1169, 1209, 1152,
-     1161, 1154, 1165, 1142, 1146, 1197, 1144, 1154, 1194, 1141,
-     1192,  556,  558, 1134, 1144,  557, 1648, 1194, 1152, 1135,
-     1140, 1144, 1134, 1146, 1149, 1186, 1648, 1180,  577, 1133,
-     1141, 1140, 1135, 1131, 1138, 1121, 1124, 1120, 1137, 1132,
-     1120, 1116, 1123, 1117, 1169, 1126, 1114, 1128, 1116, 1648,
-     1124, 1122, 1113, 1122, 1118, 1159, 1101, 1101, 1114, 1099,
-
-     1154, 1096, 1097, 1648, 1648, 1105, 1108, 1111, 1648, 1648,
-     1110, 1095, 1087,  574, 1093, 1139, 1090,   17,    7,  132,
-     1648,  228,  394,  421,  458,  562,  534,  526,  530,  543,
-      554,  564,  567,  562,  565,  572,  572,  574,  627,  586,
-      591,  568, 1648,  626,  586,  577,  592,  593,  580,  594,
-     1648,  613,  621,  601,  591,  638,  603,  607,  646,  601,
-      596,  597,  593,  602,  597,  653,  612,  603, 1648,  605,
-      616,  601,  617,  611,  656,  624,  609,  610, 1648,  629,
-      612,  669,  614, 1648,  633,  613,  631,  670,  630,  620,
-      638,  637,  623,  638,  630,  637,  627,  645,  630, 1648,
-
-      638,  644,  639,  690, 1648,  641,  646,  640,  652,  646,
-      645,  647,  699,  645,  645,  702,  648, 1648,  647,  655,
-      653,  652,  657,  667,  668,  673,  712,  671,  687,  692,
-      666,  676,  667,  719,  664, 1648,  671,  676,  683,  724,
-      726,  675, 1648,  671,  674,  673,  693,  690,  695,  696,
-      682,  690,  699,  679,  700,  740, 1648,  695,  744,  745,
-      707,  709,  697,  694,  701,  752,  701,  699,  717,  756,
-      708,  707,  713,  711,  709,  762,  763,  759,  719, 1648,
-      724,  717,  726,  714,  724,  720,  733, 1648,  716,  717,
-     1648,  718,  716,  735,  736,  737,  736,  720,  725,  743,
-
-     1648,  733,  766,  757,  729,  788,  751, 1648,  734,  749,
-      741,  745, 1648, 1648,  755,  790,  739,  792,  741,  799,
-      744,  755,  747,  753,  749,  767,  768, 1648,  766, 1648,
-      769, 1648,  772,  762,  755,  767,  810, 1648,  767,  817,
-      818, 1648,  819,  763,  769,  776,  818, 1648, 1648,  768,
-      768,  771,  785,  772,  829,  788,  826,  780,  833,  783,
-      835,  784,  837,  838,  799,  840,  784,  796,  801,  787,
-      817,  846,  806, 1648,  798,  849,  798,  794,  810,  815,
-      797,  855,  810,  815, 1648,  816,  809,  818,  819,  816,
-      806,  808,  865,  814,  811,  868,  864,  807,  822,  872,
-
-     1648, 1648, 1648,  832,  824,  834,  819,  820,  880,  881,
-      828,  884, 1648,  834,  836,  887,  830, 1648,  851, 1648,
-      835, 1648, 1648,  843, 1648,  893,  844,  895,  896,  878,
-     1648,  856,  857, 1648,  845,  844,  847,  847,  848,  844,
-     1648,  866,  852,  853,  868,  868,  871,  871,  868,  873,
-     1648,  865,  875, 1648,  872,  877,  879,  876, 1648,  868,
-      868,  874,  873,  884, 1648, 1648,  923, 1648,  872,  878,
-     1648,  880,  882,  885,  896, 1648,  893, 1648,  890, 1648,
-      913,  933,  939,  940,  884,  942,  943,  898,  892,  946,
-      947,  943,  908,  904,  946,  896,  901,  954,  912,  956,
-
-      916,  958,  921,  910,  918,  962,  906,  924,  923,  907,
-      963,  928,  929,  929,  916,  927,  974,  934,  947,  934,
-     1648, 1648,  978, 1648, 1648,  927,  938, 1648, 1648,  928,
-      977,  922,  927,  985,  935, 1648,  941, 1648,  988, 1648,
-      933,  948,  953, 1648,  987,  955,  948,  957,  945,  955,
-      998,  999, 1000,  951, 1648, 1002, 1003,  951, 1648,  955,
-     1007,  953,  952, 1010,  965, 1648, 1007,  969, 1648,  972,
-     1015,  976,  959,  961,  958,  974,  983, 1022, 1648, 1648,
-     1648, 1018, 1648, 1648,  983, 1020, 1648,  974,  981, 1648,
-      978,  983, 1030,  975, 1648,  990,  980,  992, 1035,  979,
-
-      987, 1648,  998,  988,  987, 1001,  992, 1001, 1003, 1648,
-     1045, 1046, 1006, 1048, 1648, 1044, 1008,  989, 1052, 1011,
-     1012, 1013, 1056, 1015, 1648, 1648, 1020, 1648, 1002, 1060,
-     1021, 1648, 1007, 1007, 1009, 1648, 1014, 1009, 1021, 1648,
-     1019, 1023, 1014, 1066, 1015, 1031, 1024, 1033, 1024, 1031,
-     1018, 1033, 1080, 1039, 1026, 1042, 1033, 1047, 1043, 1648,
-     1087, 1088, 1089, 1046, 1045, 1046, 1648, 1648, 1648, 1093,
-     1037, 1053, 1648, 1091, 1042, 1041, 1043, 1054, 1101, 1052,
-     1648, 1061, 1104, 1648, 1648, 1110, 1115, 1120, 1125, 1130,
-     1135, 1140, 1143, 1117, 1122, 1124, 1137
-
+        0,    0,   70,    0,  135,    0,  137,  148,  136,  138,
+       73,    0,  153,  156,  205,  275,  334,    0,  148,  157,
+      166,  152,    0,  156,  187,  326,  315,  319,    0,    0,
+      332,  318,  323,    0,    0,    0,  176,  168,  126,  383,
+      166,  190,  183,  450,  506,    0,  136,  326,  138,  148,
+      342,  328,  221,  497,  549,  499,  497,  596,  520,  300,
+      314,  533,  527,  624,  312,  304,  481,  316,  622,  608,
+      642,  631,  531,  302,  499,  648,  654,  657,  323,    0,
+      575,    0,    0,  668,    0,  718,    0,  522,  529,  643,
+      644,  622,  647,  662,  753,    0,  328,  371,    0,    0,
+
+      784,  509,  753,  470,  530,  763,  762,  528,  757,  764,
+      763,  766,  775,  800,    0,  851,  766,  526,  535,  548,
+      581,  617,  656,  639,  643,  646,  664,  669,  656,  743,
+      754,  763,  750,  764,  754,  754,  778,  803,  809,  766,
+      819,  767,  792,  791,  793,  798,  789,  788,  789,  803,
+      799,  824,  815,  806,  807,  822,  825,  818,  822,  836,
+      826,  870,  832,  845,  845,  846,  849,  849,  841,  845,
+      872,  841,  859,  854,  876,  882,  887,  879,  888,  893,
+      865,    0,  929,  909,  902,  859,  864,  895,  902,  875,
+      909,  921,  913,  927,  909,    0,  965,  941,  927,  905,
+
+      897,  909,  916,  915,  916,  910,  961,  957,  925,  907,
+      928,  925,  940,  938,  935,  948,  950,  943,  930,  936,
+      950,  936,  953,  948,  940,  959,    0,  956,  961,  945,
+      946,  997,  955,  969,  967,  972, 1008,  971,  962,  974,
+     1012,  962, 1019,  974, 1016,  968,  976,  986,  970,  971,
+      979,  972,  973,  982,  985, 1032,  992,  993,  989,  988,
+      999,  996,  992,  999, 1000, 1002,  986, 1003,  992, 1000,
+     1008,  999,  994, 1009, 1052, 1015, 1049, 1010, 1038,    0,
+        0, 1039,    0,    0, 1002, 1067, 1014, 1028, 1008, 1055,
+     1048, 1070, 1025, 1045,    0, 1074,    0, 1073, 1103,    0,
+
+     1055, 1018, 1086, 1050, 1036, 1044, 1095, 1054, 1060,    0,
+     1054, 1100, 1057, 1056, 1119, 1065, 1115, 1112, 1077, 1074,
+     1073, 1124, 1085, 1077, 1080, 1128, 1079, 1135, 1095, 1083,
+     1097, 1087, 1105, 1109, 1111, 1145, 1109, 1107, 1100, 1110,
+     1115, 1112, 1111, 1160, 1118, 1157,    0, 1112, 1114, 1115,
+     1110, 1114, 1127, 1122, 1113, 1127, 1174, 1175, 1132, 1131,
+     1137,    0, 1137, 1129, 1131, 1144, 1133, 1123, 1127, 1150,
+     1135, 1186, 1150, 1151, 1140, 1153, 1154, 1155, 1156, 1199,
+     1200,    0, 1147, 1148, 1203, 1163,    0,    0, 1164, 1201,
+     1156, 1150, 1194, 1161, 1213, 1214, 1174, 1223,    0, 1174,
+
+     1225,    0, 1202, 1247, 1203, 1227, 1187, 1227, 1187, 1178,
+        0, 1195, 1196, 1186, 1187,    0, 1197, 1196, 1206, 1197,
+     1202,    0, 1211, 1211, 1204, 1218, 1222, 1269, 1232, 1266,
+     1218, 1268,    0, 1221, 1238, 1272, 1237, 1236, 1239, 1243,
+     1277, 1245, 1234, 1241, 1238, 1237, 1240, 1290, 1239, 1255,
+     1236, 1245, 1252, 1301,    0, 1251, 1249, 1249, 1255, 1263,
+     1250, 1252, 1263, 1269, 1269, 1261, 1258,    0, 1314,    0,
+     1261, 1273, 1312, 1262, 1269, 1279, 1275, 1272, 1282, 1324,
+     1320, 1286, 1269, 1290, 1275, 1276, 1285, 1291, 1277, 1334,
+     1279,    0,    0, 1286, 1286,    0, 1298, 1334, 1298, 1333,
+
+     1288, 1306, 1346, 1299,    0,    0, 1304,    0, 1311,    0,
+     1331, 1330, 1358,    0, 1313, 1310, 1305, 1357, 1308, 1311,
+     1320, 1315, 1328, 1335, 1337, 1328, 1370, 1339, 1335, 1380,
+     1329, 1346, 1347,    0, 1335, 1334, 1351, 1350, 1345, 1352,
+     1346, 1355, 1343, 1360, 1345, 1360, 1360, 1346, 1398, 1366,
+     1344, 1361, 1352, 1368, 1367, 1370, 1369, 1412, 1371,    0,
+     1360, 1364, 1374, 1412, 1413, 1369, 1420, 1380, 1422, 1367,
+     1370, 1369,    0, 1384, 1366, 1388, 1387, 1382, 1426, 1383,
+     1391, 1429,    0, 1379, 1394, 1399, 1383, 1434, 1435, 1385,
+     1437, 1438,    0, 1444, 1403, 1389, 1396, 1400,    0, 1407,
+
+     1400,    0, 1446, 1397, 1455, 1427, 1439, 1413, 1412, 1419,
+     1416, 1407, 1459, 1425, 1461, 1462, 1464, 1421, 1414, 1468,
+     1424, 1435, 1471, 1436, 1432, 1422, 1432, 1477, 1484, 1443,
+     1444, 1436, 1448, 1443, 1435, 1449, 1454, 1451, 1454, 1453,
+     1454, 1459, 1458, 1447, 1458, 1449, 1502, 1449, 1504, 1457,
+     1449, 1460, 1509,    0, 1510, 1462, 1456, 1459, 1473, 1463,
+     1475,    0, 1466, 1476,    0, 1477, 1479, 1521, 1467, 1477,
+     1473, 1485, 1465, 1471, 1523, 1489, 1474, 1485, 1527, 1477,
+     1529, 1489, 1491, 1477, 1489, 1490,    0, 1542, 1503, 1489,
+     1497, 1502, 1495, 1508, 1513, 1552,    0, 1548, 1526, 1505,
+
+     1514, 1515, 1514, 1497, 1512, 1515, 1514, 1522, 1508, 1514,
+     1514, 1512, 1530, 1527, 1518, 1516, 1525, 1521, 1574, 1533,
+     1524, 1539, 1530,    0, 1539, 1539, 1533, 1535, 1545, 1543,
+     1586, 1531, 1533, 1547, 1535, 1591, 1536, 1548, 1540, 1541,
+     1541,    0, 1555,    0, 1552, 1557, 1562,    0,    0, 1563,
+     1551, 1545, 1566, 1554, 1601, 1555, 1604, 1556, 1611,    0,
+     1559, 1563, 1565, 1559, 1616, 1571, 1562, 1563, 1559, 1572,
+     1582, 1577, 1578, 1573, 1575, 1576, 1576, 1578, 1630, 1589,
+     1594, 1572,    0, 1629, 1589, 1580, 1594, 1595, 1583, 1596,
+        0, 1615, 1623, 1603, 1594, 1640, 1608, 1605, 1648, 1608,
+
+     1612, 1651, 1606, 1603, 1603, 1604, 1600, 1609, 1604, 1659,
+     1618, 1610,    0, 1612, 1622, 1608, 1624, 1620, 1664, 1621,
+     1633, 1618, 1619,    0, 1636, 1620, 1676, 1622,    0, 1640,
+     1674, 1629, 1624, 1638, 1646, 1643, 1681, 1641, 1632, 1649,
+     1648, 1635, 1649, 1642, 1648, 1639, 1656, 1642,    0, 1650,
+     1655, 1651, 1701,    0, 1653, 1657, 1699, 1653, 1665, 1660,
+     1658, 1660, 1711, 1658, 1658, 1714, 1661,    0, 1660, 1668,
+     1666, 1665, 1670, 1679, 1680, 1685, 1724, 1683, 1699, 1704,
+     1679, 1688, 1680, 1676, 1733,    0, 1734, 1680,    0, 1687,
+     1732, 1692, 1699, 1740, 1741, 1691,    0, 1687, 1690, 1689,
+
+     1708, 1705, 1710, 1711, 1698, 1705, 1706, 1717, 1698, 1718,
+     1758,    0, 1713, 1760, 1761, 1723, 1717, 1724, 1728, 1716,
+     1727, 1719, 1715, 1722, 1773, 1723, 1721, 1738, 1777, 1730,
+     1729, 1734, 1733, 1731, 1783, 1784, 1780, 1740,    0, 1745,
+     1739, 1730, 1748, 1737, 1746, 1743, 1755,    0, 1739, 1740,
+        0, 1741, 1739, 1757, 1758, 1759, 1758, 1743, 1748, 1765,
+        0, 1756, 1788, 1779, 1752, 1810, 1773, 1766,    0,    0,
+     1758, 1772, 1763, 1766, 1770,    0,    0, 1779, 1814, 1764,
+     1816, 1766, 1823, 1769, 1779, 1772, 1771, 1779, 1775, 1793,
+     1794,    0, 1792,    0, 1794,    0, 1798, 1787, 1792, 1797,
+
+     1792, 1785, 1787, 1787, 1798, 1840,    0, 1798, 1847, 1848,
+        0, 1849, 1794, 1800, 1806, 1848,    0,    0, 1799, 1799,
+     1802, 1815, 1820, 1804, 1860, 1819, 1857, 1812, 1864, 1815,
+     1866, 1816, 1868, 1869, 1830, 1871, 1816, 1827, 1832, 1819,
+     1848, 1877, 1837,    0, 1830, 1822, 1881, 1831, 1832, 1828,
+     1843, 1848, 1831, 1888, 1843, 1848,    0, 1849, 1843, 1851,
+     1894, 1853, 1850, 1841, 1843, 1900, 1850, 1847, 1848, 1843,
+     1851, 1907, 1903, 1909, 1905, 1849, 1865, 1914,    0,    0,
+        0, 1873, 1866, 1875, 1861, 1862, 1920, 1922, 1870, 1879,
+     1926,    0, 1877, 1879, 1929, 1873,    0, 1893,    0, 1878,
+
+        0,    0, 1885,    0, 1934, 1886, 1936, 1937, 1919,    0,
+     1897, 1898, 1900,    0, 1888, 1887, 1894, 1891, 1891, 1892,
+     1888,    0, 1909, 1896, 1897, 1911, 1911,    0, 1907, 1914,
+     1915, 1912, 1917,    0, 1910, 1921, 1922, 1923, 1911,    0,
+     1924,    0, 1922, 1927, 1928, 1925,    0, 1918, 1918, 1924,
+     1923, 1933,    0,    0, 1972, 1922,    0, 1923, 1929,    0,
+     1931, 1933, 1936, 1946,    0, 1943,    0, 1940,    0, 1963,
+     1983, 1989, 1985, 1991, 1936, 1945, 1994, 1995, 1950, 1945,
+     1998, 1999, 1995, 1960, 1956, 1965, 1943, 2000, 1951, 1956,
+     2008, 1966, 2010, 1957, 2012, 2014, 1964, 1975, 2017, 1980,
+
+     1970, 1977, 2021, 1966, 1982, 1981, 1966, 2021, 2022, 1987,
+     1988, 1988, 1976, 1986, 2033, 1993, 2006, 1993,    0, 1981,
+        0, 2038, 2034,    0,    0, 1989, 1999,    0,    0, 1990,
+     2038, 1984, 1985, 1996, 1991, 2048, 1999,    0, 2004,    0,
+     1993,    0,    0, 1998, 2053,    0, 1999, 2013, 2018,    0,
+     2052, 2020, 2013, 2022, 2005, 2013, 2022, 2065, 2066, 2067,
+     2019,    0, 2069, 2070, 2018, 2016,    0, 2018, 2024, 2075,
+     2022, 2021, 2078, 2074, 2040, 2035,    0, 2077, 2039, 2046,
+     2036,    0, 2044, 2087, 2048, 2032, 2034, 2031, 2046, 2047,
+     2056, 2095,    0,    0,    0, 2091,    0,    0, 2056, 2050,
+
+     2053, 2095,    0, 2050, 2056,    0, 2064, 2104, 2056, 2060,
+     2107, 2060, 2071, 2055,    0, 2069, 2061, 2072, 2115, 2060,
+     2068, 2069,    0, 2079, 2070, 2121, 2060, 2071, 2084, 2076,
+     2088, 2089,    0, 2086, 2088,    0, 2130, 2075, 2132, 2133,
+     2093, 2135,    0, 2131, 2095, 2096, 2078, 2140,    0, 2099,
+     2100, 2101, 2102, 2089, 2090, 2147, 2106,    0, 2149,    0,
+        0, 2112,    0, 2095, 2152, 2153, 2114,    0, 2155, 2102,
+     2102, 2104, 2119, 2118,    0, 2111,    0, 2106, 2117,    0,
+        0, 2116,    0, 2119, 2111, 2162, 2123, 2119, 2114, 2129,
+     2123, 2131, 2123, 2129, 2117, 2177, 2138, 2133, 2180, 2139,
+
+     2127, 2142, 2134, 2147,    0, 2125, 2144,    0, 2188, 2189,
+     2190, 2147, 2146, 2193, 2148,    0,    0,    0, 2195, 2140,
+        0, 2155,    0, 2193, 2145, 2144, 2146, 2156, 2203, 2155,
+        0, 2163, 2206,    0, 2213
     } ;
 
-static const flex_int16_t yy_def[1298] =
+static const flex_int16_t yy_def[1436] =
     {   0,
-     1286, 1286, 1287, 1287, 1286, 1286, 1286, 1286, 1286, 1286,
-     1285, 1285, 1285, 1285, 1285, 1288, 1285, 1285, 1285, 1285,
-     1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
-     1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1289,
-     1285, 1285, 1285, 1290,   15, 1285,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1291,   45,   45,
+     1435,    1,    1,    3,    1,    5,    5,    5,    5,    5,
+     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,   17,   17,
+     1435,   17, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
+     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
+     1435, 1435, 1435,   15,   15, 1435,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1288,
-     1285, 1285, 1285, 1285, 1285, 1285, 1292, 1285, 1285, 1285,
-     1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1289, 1285,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   16,
+       17,   17,   25,   17, 1435, 1435, 1435,   25,   25, 1435,
+     1435, 1435, 1435, 1435, 1435, 1435, 1435,   40, 1435, 1435,
 
-     1290, 1285, 1285,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1293,   45, 1291,   45,   45,
+     1435,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   58,   45,  114,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1292, 1285, 1285, 1285, 1285, 1285,
-     1285, 1285, 1285, 1294,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1293, 1285, 1291,   45,
+       45,   45,   45,   45, 1435, 1435, 1435, 1435, 1435, 1435,
+     1435, 1435, 1435,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 1435,  116,   45,   45,   45,
 
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1285,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1435,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1285, 1285, 1285, 1285,
-     1285, 1285, 1285, 1295,   45,   45,   45,   45,   45,   45,
-       45,   45, 1285,   45, 1285,   45, 1291, 1285,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1435, 1435,
+     1435, 1435, 1435, 1435, 1435, 1435,   45,   45,   45,   45,
+       45,   45,   45,   45, 1435,   45, 1435,   45,  197, 1435,
 
-       45,   45,   45,   45,   45,   45, 1285,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1435,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1435,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1285,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1285,   45,   45,   45,   45,
+       45, 1435,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1285,   45,   45,   45,   45,
-     1285, 1285, 1285, 1296,   45,   45,   45,   45,   45,   45,
-       45,   45, 1285,   45,   45, 1285,   45, 1291,   45,   45,
+       45, 1435,   45,   45,   45,   45, 1435, 1435, 1435, 1435,
+       45,   45,   45,   45,   45,   45,   45,   45, 1435,   45,
 
-       45,   45,   45, 1285,   45,   45,   45,   45, 1285,   45,
-       45,   45,   45,   45, 1285,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1285,   45,   45,   45,   45,   45,
+       45, 1435,   45,  299,   45,   45,   45,   45,   45,   45,
+     1435,   45,   45,   45,   45, 1435,   45,   45,   45,   45,
+       45, 1435,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1435,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 1435,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1435,   45, 1435,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1285,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1285,   45, 1285,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1285, 1285,
-       45,   45, 1285,   45,   45, 1285, 1297,   45,   45,   45,
-       45, 1285, 1285,   45, 1285,   45, 1285,   45,   45,   45,
+       45, 1435, 1435,   45,   45, 1435,   45,   45, 1435, 1435,
 
-     1285,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1285,
+       45,   45,   45,   45, 1435, 1435,   45, 1435,   45, 1435,
+       45,   45,   45, 1435,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 1435,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1285,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1285,   45,   45,   45,   45,   45,   45,
-       45,   45, 1285,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1285,   45,   45,   45,   45,   45, 1285,   45,
-       45, 1285,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1435,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1435,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1435,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1435,   45,   45,   45,   45,   45, 1435,   45,
 
+       45, 1435,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1285,   45,   45,   45,   45,
-       45,   45,   45, 1285,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1285,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1285,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1285,
+       45,   45,   45, 1435,   45,   45,   45,   45,   45,   45,
+       45, 1435,   45,   45, 1435,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1435,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1435,   45,   45,   45,
 
-       45,   45,   45, 1285, 1285,   45,   45,   45, 1285, 1285,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1285,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1285,   45,   45,   45,   45,   45,   45,   45,
-     1285,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1285,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1285,   45,
-       45,   45,   45, 1285,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1285,
-
-       45,   45,   45,   45, 1285,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1285,   45,   45,
+       45,   45,   45, 1435,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1285,   45,   45,   45,   45,
-       45,   45, 1285,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1285,   45,   45,   45,
+       45, 1435,   45, 1435,   45,   45,   45, 1435, 1435,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1435,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1285,
-       45,   45,   45,   45,   45,   45,   45, 1285,   45,   45,
-     1285,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-     1285,   45,   45,   45,   45,   45,   45, 1285,   45,   45,
-       45,   45, 1285, 1285,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1285,   45, 1285,
-       45, 1285,   45,   45,   45,   45,   45, 1285,   45,   45,
-       45, 1285,   45,   45,   45,   45,   45, 1285, 1285,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1435,   45,   45,   45,   45,   45,   45,   45,
+     1435,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1435,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 1435,   45,   45,   45,   45, 1435,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1285,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1285,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1435,   45,
+       45,   45,   45, 1435,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1435,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 1435,   45,   45, 1435,   45,
+       45,   45,   45,   45,   45,   45, 1435,   45,   45,   45,
 
-     1285, 1285, 1285,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1285,   45,   45,   45,   45, 1285,   45, 1285,
-       45, 1285, 1285,   45, 1285,   45,   45,   45,   45,   45,
-     1285,   45,   45, 1285,   45,   45,   45,   45,   45,   45,
-     1285,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1285,   45,   45, 1285,   45,   45,   45,   45, 1285,   45,
-       45,   45,   45,   45, 1285, 1285,   45, 1285,   45,   45,
-     1285,   45,   45,   45,   45, 1285,   45, 1285,   45, 1285,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 1435,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1435,   45,
+       45,   45,   45,   45,   45,   45,   45, 1435,   45,   45,
+     1435,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1435,   45,   45,   45,   45,   45,   45,   45, 1435, 1435,
+       45,   45,   45,   45,   45, 1435, 1435,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 1435,   45, 1435,   45, 1435,   45,   45,   45,   45,
+
+       45,   45,   45,   45,   45,   45, 1435,   45,   45,   45,
+     1435,   45,   45,   45,   45,   45, 1435, 1435,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 1435,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1435,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1435, 1435,
+     1435,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 1435,   45,   45,   45,   45, 1435,   45, 1435,   45,
+
+     1435, 1435,   45, 1435,   45,   45,   45,   45,   45, 1435,
+       45,   45,   45, 1435,   45,   45,   45,   45,   45,   45,
+       45, 1435,   45,   45,   45,   45,   45, 1435,   45,   45,
+       45,   45,   45, 1435,   45,   45,   45,   45,   45, 1435,
+       45, 1435,   45,   45,   45,   45, 1435,   45,   45,   45,
+       45,   45, 1435, 1435,   45,   45, 1435,   45,   45, 1435,
+       45,   45,   45,   45, 1435,   45, 1435,   45, 1435,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1435,   45,
+     1435,   45,   45, 1435, 1435,   45,   45, 1435, 1435,   45,
+       45,   45,   45,   45,   45,   45,   45, 1435,   45, 1435,
+       45, 1435, 1435,   45,   45, 1435,   45,   45,   45, 1435,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1285, 1285,   45, 1285, 1285,   45,   45, 1285, 1285,   45,
-       45,   45,   45,   45,   45, 1285,   45, 1285,   45, 1285,
-       45,   45,   45, 1285,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1285,   45,   45,   45, 1285,   45,
-       45,   45,   45,   45,   45, 1285,   45,   45, 1285,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1285, 1285,
-     1285,   45, 1285, 1285,   45,   45, 1285,   45,   45, 1285,
-       45,   45,   45,   45, 1285,   45,   45,   45,   45,   45,
-
-       45, 1285,   45,   45,   45,   45,   45,   45,   45, 1285,
-       45,   45,   45,   45, 1285,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1285, 1285,   45, 1285,   45,   45,
-       45, 1285,   45,   45,   45, 1285,   45,   45,   45, 1285,
+       45, 1435,   45,   45,   45,   45, 1435,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1435,   45,   45,   45,
+       45, 1435,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1435, 1435, 1435,   45, 1435, 1435,   45,   45,
+
+       45,   45, 1435,   45,   45, 1435,   45,   45,   45,   45,
+       45,   45,   45,   45, 1435,   45,   45,   45,   45,   45,
+       45,   45, 1435,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1435,   45,   45, 1435,   45,   45,   45,   45,
+       45,   45, 1435,   45,   45,   45,   45,   45, 1435,   45,
+       45,   45,   45,   45,   45,   45,   45, 1435,   45, 1435,
+     1435,   45, 1435,   45,   45,   45,   45, 1435,   45,   45,
+       45,   45,   45,   45, 1435,   45, 1435,   45,   45, 1435,
+     1435,   45, 1435,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1285,
-       45,   45,   45,   45,   45,   45, 1285, 1285, 1285,   45,
-       45,   45, 1285,   45,   45,   45,   45,   45,   45,   45,
-     1285,   45,   45, 1285,    0, 1285, 1285, 1285, 1285, 1285,
-     1285, 1285, 1285, 1285, 1285, 1285, 1285
 
+       45,   45,   45,   45, 1435,   45,   45, 1435,   45,   45,
+       45,   45,   45,   45,   45, 1435, 1435, 1435,   45,   45,
+     1435,   45, 1435,   45,   45,   45,   45,   45,   45,   45,
+     1435,   45,   45, 1435,    0
     } ;
 
-static const flex_int16_t yy_nxt[1720] =
+static const flex_int16_t yy_nxt[2284] =
     {   0,
-     1285,   13,   14,   13, 1285,   15,   16, 1285,   17,   18,
-       19,   20,   21,   22,   22,   22,   23,   24,   86,  657,
-       37,   14,   37,   87,   25,   26,   38,  798,  658,   27,
-       37,   14,   37,   42,   28,   42,   38,   92,   93,   29,
-      115,   30,   13,   14,   13,   91,   92,   25,   31,   93,
-       13,   14,   13,   13,   14,   13,   32,   40, 1285,   13,
-       14,   13,   33,   40,  115,   92,   93,  799,   91,   34,
-       35,   13,   14,   13,   95,   15,   16,   96,   17,   18,
-       19,   20,   21,   22,   22,   22,   23,   24,   13,   14,
-       13,  109,   39,   91,   25,   26,   13,   14,   13,   27,
-
-       39,   85,   85,   85,   28,   42,   41,   42,   42,   29,
-       42,   30,   83,  108,   41,  111,   94,   25,   31,  109,
-      206,  161,   89,  137,   89,  162,   32,   90,   90,   90,
-      207,  138,   33,  211,  212,   83,  108,  800,  111,   34,
-       35,   44,   44,   44,   45,   45,   46,   45,   45,   45,
-       45,   45,   45,   45,   45,   47,   45,   45,   45,   45,
-       45,   48,   45,   49,   50,   45,   51,   45,   52,   53,
-       54,   45,   45,   45,   45,   55,   56,   45,   57,   45,
-       45,   58,   45,   45,   59,   60,   61,   62,   63,   64,
-       65,   66,   67,   52,   68,   69,   70,   71,   72,   73,
-
-       74,   75,   76,   77,   78,   79,   57,   45,   45,   45,
-       45,   45,   81,  105,   82,   82,   82,   81,  114,   84,
-       84,   84,  102,  105,   81,   83,   84,   84,   84,  108,
-       83,  178,  122,  112,  139,  123,  387,   83,  124,  105,
-      125,  114,  126,  113,  140,  178,  141,  132,   83,  119,
-      157,  176,  108,   83,  158,  120,  112,  103,  133,  178,
-       83,   45,  147,  135,  159,  387,  148,   45,  134,   45,
-       45,  113,   45,  181,   45,   45,   45,  176,  117,  143,
-      144,   45,   45,  145,   45,   45,  149,  801,  102,  146,
+       12,   13,   14,   13,   12,   15,   16,   12,   17,   18,
+       19,   20,   21,   22,   22,   22,   23,   24,   12,   12,
+       12,   12,   12,   12,   25,   26,   12,   12,   12,   27,
+       12,   12,   12,   12,   28,   12,   12,   12,   12,   29,
+       12,   30,   12,   12,   12,   12,   12,   25,   31,   12,
+       12,   12,   12,   12,   12,   32,   12,   12,   12,   12,
+       12,   33,   12,   12,   12,   12,   12,   12,   34,   35,
+       36,   37, 1435,   37,   36,   36,   36,   38,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       12,   12,   40,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   40,   42,   41,   42,   41,   43,   12,
+       12,   84,   84,   84,   12,   84,   84,   84, 1435,   12,
+       81,   81,   81,   85,   12,   87,   12,   42,   86,   42,
+       96,   97,   12,   12,   99,   43,   39,   12,   12,   12,
+       12,   42,  102,   42,  104,   88,   12,   88,  105,   12,
+
+       89,   89,   89,   12,   12,   44,   44,   44,   45,   45,
+       46,   45,   45,   45,   45,   45,   45,   45,   45,   47,
+       45,   45,   45,   45,   45,   48,   45,   49,   50,   45,
+       51,   45,   52,   53,   54,   45,   45,   45,   45,   55,
+       56,   45,   57,   45,   45,   58,   45,   45,   59,   60,
+       61,   62,   63,   64,   65,   66,   67,   68,   69,   70,
+       71,   72,   73,   74,   75,   76,   77,   78,   79,   57,
+       45,   45,   45,   45,   45,   80,   80,  108,   80,   80,
+       80,   80,   80,   80,   80,   80,   80,   80,   80,   80,
+       80,   80,   80,   80,   80,   80,   80,   80,   80,   80,
+
+       80,   80,   80,   80,   80,   80,   80,   80,   80,   80,
+       80,   80,   80,   80,   80,   80,   80,   80,   80,   80,
+       80,   80,   80,   80,   80,   80,   80,   80,   80,   80,
+       80,   80,   80,   80,   80,   80,   80,   80,   80,   80,
+       80,   80,   80,   80,   80,   81,   90,   82,   82,   82,
+       91,   92,   90,   91,  103,   92,  119,  120,   83,  135,
+      137,  107,  106,  142,  160,  121,  174,  122,  138,   90,
+      123,  136,  124,  181,  125,   93,  182,   91,   92,  103,
+       94,   83,   95,   98,   98,  106,   98,   98,  107,   98,
+       98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
+
+       98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
+       98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
+       98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
+       98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
+       98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
+       98,   98,   98,   44,   44,  100,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+      101,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       45,  109,  112,  113,  184,  186,   45,  139,   45,   45,
+     1435,   45, 1435,   45,   45,   45,  140, 1435,  141, 1435,
+       45,   45,  161,   45,  109,  112,  162,  113,  103,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   90,   90,   90,   45,  127,  114,
-      111,   45,  128,  103,  112,  129,  130,  177,  360,   45,
-      153,  361,  186,   45,  113,   45,  118,  176,  131,  150,
-      154,  151,  171,  152,  163,  155,  156,  112,  164,  169,
-      177,  165,  172,  177,   85,   85,   85,  173,  166,  167,
-      186,  189,  113,  179,  168,   83,  246,  247,   81,  170,
-       82,   82,   82,   89,  190,   89,  180,  192,   90,   90,
-       90,   83,   81,  193,   84,   84,   84,  189,   83,   85,
-       85,   85,   90,   90,   90,   83,  101,  194,  196,  195,
-
-       83,  190,  186,  101,   83,  192,  217,  195,  218,  223,
-      193,  220,  224,  235,  192,  253,  225,  236,   83,  200,
-      264,  196,  254,   83,  265,  194,  195,  221,  266,  249,
-      201,  101,  250,  251,  273,  101,  279,  279,  286,  101,
-      277,  406,  192,  278,  241,  277,  278,  101,  255,  289,
-      802,  101,  290,  101,  184,  199,  199,  199,  407,  279,
-      282,  286,  199,  199,  199,  199,  199,  199,  277,  278,
-      292,  296,  281,  280,  294,  334,  803,  289,  305,  290,
-      286,  256,  257,  258,  306,  199,  199,  199,  199,  199,
-      199,  344,  259,  292,  260,  378,  261,  294,  296,  262,
-
-      297,  297,  297,  299,  381,  381,  385,  297,  297,  297,
-      297,  297,  297,  389,  390,  392,  386,  456,  395,  412,
-      804,  387,  391,  413,  490,  345,  335,  381,  382,  336,
-      297,  297,  297,  297,  297,  297,  425,  634,  392,  346,
-      490,  426,  438,  439,  587,  379,  395,  398,  398,  398,
-      399,  445,  490,  669,  398,  398,  398,  398,  398,  398,
-      483,  446,  498,  586,  499,  484,  520,  805,  500,  511,
-      582,  521,  587,  457,  635,  588,  669,  398,  398,  398,
-      398,  398,  398,  668,  512,  806,  670,  427,  807,  498,
-      586,  499,  428,   45,   45,   45,  671,  808,  809,  810,
-
-       45,   45,   45,   45,   45,   45,  674,  734,  736,  737,
-      753,  668,  675,  741,  735,  811,  738,  793,  812,  742,
-      813,  794,  814,   45,   45,   45,   45,   45,   45,  815,
-      816,  817,  818,  819,  820,  821,  822,  823,  753,  824,
-      825,  826,  827,  828,  829,  830,  831,  832,  833,  834,
-      835,  836,  837,  838,  839,  840,  841,  842,  843,  844,
-      845,  846,  847,  848,  849,  850,  851,  852,  830,  853,
-      854,  829,  855,  856,  857,  860,  861,  862,  863,  858,
-      864,  865,  866,  867,  868,  869,  870,  871,  872,  873,
-      874,  876,  877,  878,  879,  880,  881,  882,  883,  884,
-
-      885,  875,  886,  887,  888,  889,  890,  891,  892,  893,
-      894,  895,  896,  897,  898,  899,  900,  901,  902,  903,
-      905,  904,  906,  907,  908,  909,  910,  911,  912,  913,
-      859,  914,  915,  916,  917,  918,  919,  920,  921,  922,
-      923,  924,  925,  926,  927,  928,  929,  903,  904,  930,
-      932,  933,  934,  935,  931,  936,  937,  938,  939,  940,
-      941,  942,  943,  944,  945,  946,  947,  948,  949,  950,
-      951,  952,  953,  954,  955,  956,  957,  958,  959,  960,
-      961,  962,  963,  964,  965,  966,  967,  968,  969,  970,
+       45,  110,  131,  117,  157,  187,  126,  190,  158,  118,
+      127,  111,  132,  128,  129,  200, 1435,  159,   81,   81,
+       81,  201,  133,  202,  110,  130,  114,  114,  114,  114,
+
+      114,  115,  114,  114,  114,  114,  114,  114,  111,  114,
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+      114,  114,  114,  114,  114,  114,   45,  114,  114,  114,
+      203,  114,  114,  114,  106,  114,  114,  114,  114,  114,
+      114,  147,  114,  114,  114,  148,  114,  177,  116,  114,
+      114,  114,  114,  114,  114,  114,  109,  106,  204,  143,
+      144,  175,  176,  145,  149,  175,  110,  134,  146,  153,
+      112,   84,   84,   84,  177,  150,  111,  151,  154,  152,
+      176,  163,  207,  155,  156,  164,  175,  176,  165,  110,
+
+      178,  169,  205,  171,  166,  167,  208,  209,  210,  211,
+      168,  206,  172,  111,  212,  179,  213,  173,   86,   86,
+      170,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,  177,   44,
+      185,  188,  189,  191,  214,  192,   44,  194,  193,  195,
+
+     1435, 1435, 1435,  185,  215,  196,  216,  218,  217,  221,
+      222,  219,  114,  226,  227,  180,  188,  185,  189,  198,
+      191,  192,  195,  194,   44,  193,  220,  228,   44,  229,
+      199,  223,   44,  230,  224,  231,  232,  233,  225,   44,
+      114,  234,  238,   44,  114,   44,  183,  235,  114,  239,
+      236,  114,  114,  114,  237,  114,  114,  240,  241,  114,
+      191,  114,  114,  243,  197,  197,  197,  244,  245,  246,
+      247,  197,  197,  197,  197,  197,  197,  250,  251,  254,
+      257,  252,  253,  255,  248,  249,  265,  191,  269,  242,
+      256,  270,  271,  272,  197,  197,  197,  197,  197,  197,
+
+      266,  273,  274,  194,  267,  276,  277,  278,  268,  279,
+      280,  281,  279,  258,  259,  260,  280,  281,  285,  287,
+      289,  290,  288,  261,  293,  262,  295,  263,  291,  275,
+      264,  292,  297,  294,  281,  280,  279,  296,  298,  282,
+      284,  283,  286,  286,  286,  288,  300,  288,  302,  286,
+      286,  286,  286,  286,  286,  291,  294,  292,  303,  304,
+      296,  305,  306,  307,  298,  308,  310,  311,  312,  313,
+      301,  309,  286,  286,  286,  286,  286,  286,  299,  299,
+      299,  314,  315,  316,  317,  299,  299,  299,  299,  299,
+      299,  318,  319,  320,  321,  322,  323,  324,  325,  326,
+
+      327,  328,  329,  330,  331,  332,  333,  334,  299,  299,
+      299,  299,  299,  299,  335,  336,  337,  338,  339,  342,
+      343,  344,  345,  346,  347,  348,  349,  352,  353,  354,
+      355,  356,  357,  358,  359,  360,  361,  362,  363,  364,
+      365,  366,  368,  369,  367,  370,  371,  372,  373,  374,
+      375,  376,  377,  378,  379,  380,  381,  382,  383,  384,
+      350,  386,  387,  387,  389,  391,  393,  394,  340,  395,
+      396,  341,  398,  351,  392,  399,  400,  401,  397,  402,
+      390,  390,  390,  403,  406,  387,  388,  390,  390,  390,
+      390,  390,  390,  393,  393,  398,  407,  408,  409,  410,
+
+      411,  412,  415,  413,  401,  416,  417,  418,  385,  421,
+      390,  390,  390,  390,  390,  390,  404,  404,  404,  414,
+      422,  405,  423,  404,  404,  404,  404,  404,  404,  419,
+      424,  425,  426,  420,  427,  428,  429,  430,  431,  432,
+      433,  437,  438,  439,  440,  434,  404,  404,  404,  404,
+      404,  404,  441,  442,  445,  446,  447,  448,  449,  450,
+      443,  451,  452,  453,  454,  455,  456,  458,  459,  444,
+      460,  461,  462,  463,  464,  457,  465,  466,  467,  468,
+      470,  471,  472,  473,  474,  475,  476,  477,  478,  480,
+      435,  481,  479,  482,  483,  436,  484,  485,  486,  487,
+
+      488,  489,  490,  491,  492,  493,  494,  495,  496,  498,
+      499,  501,  502,  497,  500,  500,  500,  504,  505,  506,
+      507,  500,  500,  500,  500,  500,  500,  503,  508,  509,
+      510,  511,  514,  512,  469,  515,  503,  516,  517,  518,
+      519,  520,  521,  522,  500,  500,  500,  500,  500,  500,
+      523,  524,  525,  527,  503,  528,  529,  511,  530,  512,
+       45,   45,   45,  513,  531,  532,  526,   45,   45,   45,
+       45,   45,   45,  533,  534,  536,  537,  538,  539,  535,
+      540,  541,  542,  543,  544,  545,  546,  547,  548,  549,
+       45,   45,   45,   45,   45,   45,  550,  551,  552,  553,
+
+      554,  555,  556,  557,  558,  559,  560,  561,  562,  563,
+      564,  565,  566,  567,  568,  569,  570,  571,  572,  573,
+      574,  575,  576,  577,  578,  579,  580,  581,  582,  583,
+      584,  585,  586,  587,  588,  589,  590,  591,  592,  593,
+      594,  595,  596,  597,  598,  599,   44,   44,   44,  600,
+      601,  602,  603,   44,   44,   44,   44,   44,   44,  604,
+      605,  606,  607,  602,  609,  610,  613,  614,  608,  615,
+      611,  612,  616,  617,  618,  619,   44,   44,   44,   44,
+       44,   44,  620,  621,  622,  623,  624,  606,  625,  607,
+      626,  627,  628,  629,  630,  631,  632,  633,  634,  635,
+
+      636,  637,  638,  639,  640,  641,  642,  643,  644,  646,
+      647,  648,  649,  650,  651,  652,  653,  654,  655,  656,
+      657,  658,  659,  660,  661,  662,  664,  665,  666,  667,
+      668,  669,  670,  671,  672,  673,  674,  675,  676,  677,
+      678,  679,  680,  681,  682,  683,  684,  685,  686,  687,
+      689,  690,  691,  692,  693,  694,  695,  696,  688,  645,
+      697,  698,  663,  699,  700,  702,  703,  704,  705,  706,
+      707,  709,  711,  701,  712,  713,  708,  714,  715,  716,
+      717,  718,  719,  720,  721,  722,  699,  723,  698,  724,
+      725,  726,  727,  728,  729,  730,  731,  732,  733,  734,
+
+      735,  736,  737,  738,  739,  740,  741,  742,  743,  744,
+      745,  746,  710,  747,  748,  749,  750,  751,  752,  753,
+      754,  755,  756,  757,  758,  759,  760,  761,  762,  763,
+      764,  765,  766,  767,  768,  769,  770,  771,  772,  773,
+      774,  776,  777,  779,  780,  781,  775,  783,  778,  784,
+      785,  782,  786,  787,  788,  789,  790,  791,  792,  793,
+      794,  795,  796,  797,  798,  799,  800,  801,  802,  803,
+      804,  805,  806,  807,  808,  809,  810,  811,  812,  813,
+      814,  815,  816,  817,  818,  819,  793,  820,  821,  822,
+      823,  824,  825,  826,  827,  828,  829,  830,  831,  832,
+
+      833,  834,  835,  836,  837,  838,  839,  840,  841,  842,
+      844,  845,  846,  843,  847,  848,  849,  850,  851,  852,
+      853,  854,  855,  856,  857,  858,  859,  860,  861,  862,
+      863,  864,  865,  866,  867,  868,  869,  870,  871,  872,
+      873,  874,  875,  876,  877,  878,  879,  880,  881,  882,
+      883,  884,  885,  886,  887,  888,  889,  890,  891,  892,
+      893,  894,  895,  896,  897,  898,  899,  900,  901,  902,
+      880,  903,  879,  904,  905,  906,  907,  908,  909,  910,
+      911,  912,  915,  916,  917,  918,  913,  919,  920,  921,
+      922,  923,  924,  925,  926,  927,  928,  929,  930,  931,
+
+      932,  933,  935,  936,  937,  938,  939,  940,  941,  942,
+      943,  934,  944,  945,  946,  947,  948,  949,  950,  951,
+      952,  953,  954,  955,  956,  957,  958,  959,  960,  961,
+      962,  963,  965,  964,  966,  967,  914,  968,  969,  970,
       971,  972,  973,  974,  975,  976,  977,  978,  979,  980,
-
-      981,  982,  983,  984,  985,  986,  987,  988,  989,  990,
-      991,  992,  993,  971,  994,  995,  996,  997,  998,  972,
-      999, 1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008,
-     1009, 1010, 1011, 1012, 1013, 1014, 1015, 1017, 1018, 1019,
-     1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029,
-     1030, 1031, 1032, 1033, 1034, 1036, 1037, 1038, 1039, 1040,
-     1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050,
-     1051, 1052, 1053, 1054, 1055, 1056, 1057, 1059, 1030, 1060,
-     1061, 1062, 1063, 1064, 1058, 1065, 1066, 1016, 1067, 1068,
-     1069, 1070, 1071, 1072, 1073, 1074, 1035, 1075, 1076, 1077,
-
-     1078, 1080, 1081, 1082, 1083, 1079, 1084, 1085, 1086, 1087,
-     1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097,
-     1098, 1099, 1100, 1101, 1102, 1081, 1103, 1104, 1105, 1106,
-     1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116,
-     1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126,
-     1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1135, 1136,
-     1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145, 1119,
-     1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153, 1154, 1155,
+      981,  982,  983,  984,  985,  986,  987,  988,  963,  964,
+      989,  990,  991,  992,  993,  994,  996,  997,  998, 1000,
+      995, 1001, 1002, 1003, 1004, 1005, 1006,  999, 1007, 1008,
+     1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018,
+     1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028,
+
+     1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038,
+     1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048,
+     1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058,
+     1059, 1060, 1061, 1062, 1063, 1041, 1064, 1065, 1066, 1067,
+     1042, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076,
+     1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086,
+     1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1096, 1097,
+     1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107,
+     1108, 1109, 1110, 1111, 1112, 1113, 1114, 1116, 1117, 1118,
+     1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128,
+
+     1130, 1131, 1132, 1133, 1129, 1134, 1135, 1136, 1109, 1137,
+     1138, 1139, 1140, 1141, 1142, 1143, 1144, 1095, 1145, 1147,
+     1148, 1149, 1150, 1151, 1152, 1153, 1146, 1154, 1115, 1155,
      1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165,
-     1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175,
-
-     1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184, 1157,
-     1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194,
+     1166, 1167, 1169, 1170, 1171, 1172, 1168, 1173, 1174, 1175,
+     1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185,
+     1188, 1186, 1189, 1190, 1191, 1192, 1170, 1187, 1193, 1194,
      1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204,
      1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214,
      1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224,
+
      1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234,
-     1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244,
-     1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254,
-     1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263, 1264,
-     1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274,
-
-     1275, 1276, 1277, 1278, 1279, 1280, 1281, 1282, 1283, 1284,
-       12,   12,   12,   12,   12,   36,   36,   36,   36,   36,
-       80,  284,   80,   80,   80,   99,  384,   99,  487,   99,
-      101,  101,  101,  101,  101,  116,  116,  116,  116,  116,
-      175,  101,  175,  175,  175,  197,  197,  197,  797,  796,
-      795,  792,  791,  790,  789,  788,  787,  786,  785,  784,
-      783,  782,  781,  780,  779,  778,  777,  776,  775,  774,
-      773,  772,  771,  770,  769,  768,  767,  766,  765,  764,
-      763,  762,  761,  760,  759,  758,  757,  756,  755,  754,
-      752,  751,  750,  749,  748,  747,  746,  745,  744,  743,
-
-      740,  739,  733,  732,  731,  730,  729,  728,  727,  726,
-      725,  724,  723,  722,  721,  720,  719,  718,  717,  716,
-      715,  714,  713,  712,  711,  710,  709,  708,  707,  706,
-      705,  704,  703,  702,  701,  700,  699,  698,  697,  696,
-      695,  694,  693,  692,  691,  690,  689,  688,  687,  686,
-      685,  684,  683,  682,  681,  680,  679,  678,  677,  676,
-      673,  672,  667,  666,  665,  664,  663,  662,  661,  660,
-      659,  656,  655,  654,  653,  652,  651,  650,  649,  648,
-      647,  646,  645,  644,  643,  642,  641,  640,  639,  638,
-      637,  636,  633,  632,  631,  630,  629,  628,  627,  626,
-
-      625,  624,  623,  622,  621,  620,  619,  618,  617,  616,
-      615,  614,  613,  612,  611,  610,  609,  608,  607,  606,
-      605,  604,  603,  602,  601,  600,  599,  598,  597,  596,
-      595,  594,  593,  592,  591,  590,  589,  585,  584,  583,
-      582,  581,  580,  579,  578,  577,  576,  575,  574,  573,
-      572,  571,  570,  569,  568,  567,  566,  565,  564,  563,
-      562,  561,  560,  559,  558,  557,  556,  555,  554,  553,
-      552,  551,  550,  549,  548,  547,  546,  545,  544,  543,
-      542,  541,  540,  539,  538,  537,  536,  535,  534,  533,
-      532,  531,  530,  529,  528,  527,  526,  525,  524,  523,
-
-      522,  519,  518,  517,  516,  515,  514,  513,  510,  509,
-      508,  507,  506,  505,  504,  503,  502,  501,  497,  496,
-      495,  494,  493,  492,  491,  489,  488,  486,  485,  482,
-      481,  480,  479,  478,  477,  476,  475,  474,  473,  472,
-      471,  470,  469,  468,  467,  466,  465,  464,  463,  462,
-      461,  460,  459,  458,  455,  454,  453,  452,  451,  450,
-      449,  448,  447,  444,  443,  442,  441,  440,  437,  436,
-      435,  434,  433,  432,  431,  430,  429,  424,  423,  422,
-      421,  420,  419,  418,  417,  416,  415,  414,  411,  410,
-      409,  408,  405,  404,  403,  402,  401,  400,  397,  396,
-
-      394,  393,  388,  383,  380,  377,  376,  375,  374,  373,
-      372,  371,  370,  369,  368,  367,  366,  365,  364,  363,
-      362,  359,  358,  357,  356,  355,  354,  353,  352,  351,
-      350,  349,  348,  347,  343,  342,  341,  340,  339,  338,
-      337,  333,  332,  331,  330,  329,  328,  327,  326,  325,
-      324,  323,  322,  321,  320,  319,  318,  317,  316,  315,
-      314,  313,  312,  311,  310,  309,  308,  307,  304,  303,
-      302,  301,  300,  298,  198,  295,  293,  291,  288,  287,
-      285,  283,  276,  275,  274,  272,  271,  270,  269,  268,
-      267,  263,  252,  248,  245,  244,  243,  242,  240,  239,
-
-      238,  237,  234,  233,  232,  231,  230,  229,  228,  227,
-      226,  222,  219,  216,  215,  214,  213,  210,  209,  208,
-      205,  204,  203,  202,  198,  191,  188,  187,  185,  183,
-      182,  174,  160,  142,  136,  121,  110,  107,  106,  104,
-       43,  100,   98,   97,   88,   43, 1285,   11, 1285, 1285,
-     1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
-     1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
-     1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
-     1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
-     1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
-
-     1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
-     1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285
+     1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1217, 1243,
+     1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253,
+     1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263,
+     1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273,
+     1274, 1275, 1276, 1277, 1278, 1279, 1280, 1281, 1282, 1283,
+     1284, 1285, 1286, 1287, 1288, 1289, 1290, 1264, 1291, 1292,
+     1293, 1294, 1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302,
+     1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311, 1312,
+     1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322,
+
+     1323, 1324, 1325, 1326, 1327, 1328, 1329, 1330, 1331, 1333,
+     1334, 1335, 1336, 1337, 1338, 1339, 1340, 1332, 1341, 1342,
+     1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352,
+     1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362,
+     1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372,
+     1373, 1374, 1375, 1376, 1377, 1378, 1379, 1380, 1381, 1382,
+     1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392,
+     1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402,
+     1403, 1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412,
+     1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422,
+
+     1423, 1424, 1425, 1426, 1427, 1428, 1429, 1430, 1431, 1432,
+     1433, 1434,   11, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
+     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
+     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
+     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
+     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
+     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
+     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
+     1435, 1435, 1435
     } ;
 
-static const flex_int16_t yy_chk[1720] =
+static const flex_int16_t yy_chk[2284] =
     {   0,
-        0,    1,    1,    1,    0,    1,    1,    0,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,   21,  574,
-        3,    3,    3,   21,    1,    1,    3,  718,  574,    1,
-        4,    4,    4,   13,    1,   13,    4,   27,   28,    1,
-       57,    1,    5,    5,    5,   26,   32,    1,    1,   33,
-        6,    6,    6,    7,    7,    7,    1,    7,    0,    8,
-        8,    8,    1,    8,   57,   27,   28,  719,   26,    1,
-        1,    2,    2,    2,   32,    2,    2,   33,    2,    2,
-        2,    2,    2,    2,    2,    2,    2,    2,    9,    9,
-        9,   52,    5,   31,    2,    2,   10,   10,   10,    2,
-
-        6,   20,   20,   20,    2,   37,    9,   37,   42,    2,
-       42,    2,   20,   51,   10,   54,   31,    2,    2,   52,
-      124,   75,   25,   66,   25,   75,    2,   25,   25,   25,
-      124,   66,    2,  128,  128,   20,   51,  720,   54,    2,
-        2,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        3,    3,   11,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        5,    5,    7,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    8,   13,    9,   13,   10,   14,    5,
+        5,   19,   19,   19,    5,   22,   22,   22,   20,    5,
+       20,   20,   20,   21,    5,   24,    5,   37,   21,   37,
+       38,   39,    5,    5,   41,   43,    5,    9,    7,   10,
+        5,   42,   47,   42,   49,   25,    5,   25,   50,    8,
+
+       25,   25,   25,    5,    5,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   17,   48,   17,   17,   17,   19,   56,   19,
-       19,   19,   44,   59,   22,   17,   22,   22,   22,   64,
-       19,   93,   61,   55,   67,   61,  286,   22,   61,   48,
-       61,   56,   61,   55,   67,   96,   67,   63,   17,   59,
-       73,   91,   64,   19,   73,   59,   55,   44,   63,   93,
-       22,   45,   70,   64,   73,  286,   70,   45,   63,   45,
-       45,   55,   45,   96,   45,   45,   45,   91,   58,   69,
-       69,   45,   45,   69,   45,   58,   70,  722,  101,   69,
+       15,   15,   15,   15,   15,   16,   16,   53,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   17,   26,   17,   17,   17,
+       27,   28,   31,   32,   48,   33,   60,   61,   17,   65,
+       66,   52,   51,   68,   74,   61,   79,   61,   66,   26,
+       61,   65,   61,   97,   61,   31,   98,   27,   28,   48,
+       32,   17,   33,   40,   40,   51,   40,   40,   52,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       45,   54,   56,   57,  102,  104,   45,   67,   45,   45,
+       88,   45,   88,   45,   45,   45,   67,   89,   67,   89,
+       45,   45,   75,   45,   54,   56,   75,   57,   59,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   58,   89,   89,   89,   58,   62,   78,
-       71,   58,   62,  101,   77,   62,   62,   92,  258,   58,
-       72,  258,  105,   58,   77,   58,   58,   94,   62,   71,
-       72,   71,   78,   71,   76,   72,   72,   77,   76,   77,
-       95,   76,   78,   92,   81,   81,   81,   78,   76,   76,
-      105,  108,   77,   94,   76,   81,  157,  157,   82,   77,
-       82,   82,   82,   83,  109,   83,   95,  111,   83,   83,
-       83,   82,   84,  112,   84,   84,   84,  108,   81,   85,
-       85,   85,   90,   90,   90,   84,  103,  113,  115,  114,
-
-       85,  109,  119,  103,   82,  111,  133,  171,  133,  137,
-      112,  135,  137,  147,  152,  161,  137,  147,   84,  119,
-      164,  115,  161,   85,  164,  113,  114,  135,  164,  159,
-      119,  103,  159,  159,  171,  103,  178,  181,  186,  103,
-      176,  306,  152,  177,  152,  179,  180,  103,  162,  189,
-      723,  103,  190,  103,  103,  118,  118,  118,  306,  178,
-      181,  186,  118,  118,  118,  118,  118,  118,  176,  177,
-      192,  196,  180,  179,  194,  236,  724,  189,  207,  190,
-      201,  162,  162,  162,  207,  118,  118,  118,  118,  118,
-      118,  244,  162,  192,  162,  275,  162,  194,  196,  162,
-
-      199,  199,  199,  201,  277,  280,  285,  199,  199,  199,
-      199,  199,  199,  288,  288,  289,  285,  351,  292,  312,
-      725,  299,  288,  312,  387,  244,  236,  277,  280,  236,
-      199,  199,  199,  199,  199,  199,  324,  549,  289,  244,
-      399,  324,  334,  334,  499,  275,  292,  297,  297,  297,
-      299,  340,  387,  587,  297,  297,  297,  297,  297,  297,
-      379,  340,  397,  498,  397,  379,  421,  726,  399,  412,
-      500,  421,  499,  351,  549,  500,  587,  297,  297,  297,
-      297,  297,  297,  586,  412,  727,  588,  324,  728,  397,
-      498,  397,  324,  398,  398,  398,  588,  729,  730,  731,
-
-      398,  398,  398,  398,  398,  398,  591,  652,  653,  653,
-      669,  586,  591,  656,  652,  732,  653,  714,  733,  656,
-      734,  714,  735,  398,  398,  398,  398,  398,  398,  736,
-      737,  738,  739,  740,  741,  742,  744,  745,  669,  746,
-      747,  748,  749,  750,  752,  753,  754,  755,  756,  757,
-      758,  759,  760,  761,  762,  763,  764,  765,  766,  767,
-      768,  770,  771,  772,  773,  774,  775,  776,  753,  777,
-      778,  752,  780,  781,  782,  783,  785,  786,  787,  782,
-      788,  789,  790,  791,  792,  793,  794,  795,  796,  797,
-      798,  799,  801,  802,  803,  804,  806,  807,  808,  809,
-
-      810,  798,  811,  812,  813,  814,  815,  816,  817,  819,
-      820,  821,  822,  823,  824,  825,  826,  827,  828,  829,
-      831,  830,  832,  833,  834,  835,  837,  838,  839,  840,
-      782,  841,  842,  844,  845,  846,  847,  848,  849,  850,
-      851,  852,  853,  854,  855,  856,  858,  829,  830,  859,
-      860,  861,  862,  863,  859,  864,  865,  866,  867,  868,
-      869,  870,  871,  872,  873,  874,  875,  876,  877,  878,
-      879,  881,  882,  883,  884,  885,  886,  887,  889,  890,
-      892,  893,  894,  895,  896,  897,  898,  899,  900,  902,
-      903,  904,  905,  906,  907,  909,  910,  911,  912,  915,
-
-      916,  917,  918,  919,  920,  921,  922,  923,  924,  925,
-      926,  927,  929,  903,  931,  933,  934,  935,  936,  904,
-      937,  939,  940,  941,  943,  944,  945,  946,  947,  950,
-      951,  952,  953,  954,  955,  956,  957,  958,  959,  960,
-      961,  962,  963,  964,  965,  966,  967,  968,  969,  970,
-      971,  972,  973,  975,  976,  977,  978,  979,  980,  981,
-      982,  983,  984,  986,  987,  988,  989,  990,  991,  992,
-      993,  994,  995,  996,  997,  998,  999, 1000,  971, 1004,
-     1005, 1006, 1007, 1008,  999, 1009, 1010,  957, 1011, 1012,
-     1014, 1015, 1016, 1017, 1019, 1021,  976, 1024, 1026, 1027,
-
-     1028, 1029, 1030, 1032, 1033, 1028, 1035, 1036, 1037, 1038,
-     1039, 1040, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049,
-     1050, 1052, 1053, 1055, 1056, 1030, 1057, 1058, 1060, 1061,
-     1062, 1063, 1064, 1067, 1069, 1070, 1072, 1073, 1074, 1075,
-     1077, 1079, 1081, 1082, 1083, 1084, 1085, 1086, 1087, 1088,
-     1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098,
-     1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107, 1081,
-     1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117,
-     1118, 1119, 1120, 1123, 1126, 1127, 1130, 1131, 1132, 1133,
-     1134, 1135, 1137, 1139, 1141, 1142, 1143, 1145, 1146, 1147,
-
-     1148, 1149, 1150, 1151, 1152, 1153, 1154, 1156, 1157, 1119,
-     1158, 1160, 1161, 1162, 1163, 1164, 1165, 1167, 1168, 1170,
-     1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1182, 1185,
-     1186, 1188, 1189, 1191, 1192, 1193, 1194, 1196, 1197, 1198,
-     1199, 1200, 1201, 1203, 1204, 1205, 1206, 1207, 1208, 1209,
-     1211, 1212, 1213, 1214, 1216, 1217, 1218, 1219, 1220, 1221,
-     1222, 1223, 1224, 1227, 1229, 1230, 1231, 1233, 1234, 1235,
-     1237, 1238, 1239, 1241, 1242, 1243, 1244, 1245, 1246, 1247,
-     1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257,
-     1258, 1259, 1261, 1262, 1263, 1264, 1265, 1266, 1270, 1271,
-
-     1272, 1274, 1275, 1276, 1277, 1278, 1279, 1280, 1282, 1283,
-     1286, 1286, 1286, 1286, 1286, 1287, 1287, 1287, 1287, 1287,
-     1288, 1294, 1288, 1288, 1288, 1289, 1295, 1289, 1296, 1289,
-     1290, 1290, 1290, 1290, 1290, 1291, 1291, 1291, 1291, 1291,
-     1292, 1297, 1292, 1292, 1292, 1293, 1293, 1293,  717,  716,
-      715,  713,  712,  711,  708,  707,  706,  703,  702,  701,
-      700,  699,  698,  697,  696,  695,  694,  693,  692,  691,
-      689,  688,  687,  686,  685,  684,  683,  682,  681,  680,
-      679,  678,  677,  676,  675,  674,  673,  672,  671,  670,
-      668,  666,  665,  664,  663,  662,  661,  660,  659,  658,
-
-      655,  654,  651,  650,  649,  648,  647,  646,  645,  644,
-      643,  642,  641,  640,  639,  638,  637,  636,  635,  633,
-      632,  631,  630,  629,  628,  627,  625,  624,  623,  622,
-      621,  620,  619,  618,  617,  616,  615,  614,  613,  612,
-      611,  610,  609,  608,  607,  606,  605,  604,  603,  602,
-      601,  600,  599,  598,  597,  596,  595,  594,  593,  592,
-      590,  589,  585,  584,  583,  581,  580,  578,  577,  576,
-      575,  572,  571,  570,  569,  568,  567,  566,  565,  564,
-      562,  561,  560,  559,  558,  557,  556,  555,  553,  552,
-      551,  550,  548,  547,  546,  545,  544,  543,  541,  540,
-
-      539,  538,  537,  536,  535,  534,  533,  532,  531,  530,
-      529,  528,  527,  526,  525,  524,  523,  522,  521,  519,
-      518,  517,  516,  515,  514,  513,  512,  511,  510,  509,
-      508,  507,  506,  505,  504,  503,  502,  496,  494,  491,
-      490,  489,  488,  486,  485,  484,  482,  481,  478,  477,
-      476,  475,  474,  473,  472,  471,  470,  469,  468,  467,
-      466,  465,  464,  463,  462,  461,  460,  459,  457,  455,
-      454,  453,  452,  451,  450,  449,  448,  447,  446,  445,
-      443,  442,  441,  440,  439,  438,  437,  436,  435,  434,
-      433,  432,  431,  430,  429,  428,  427,  426,  424,  423,
-
-      422,  420,  419,  418,  417,  416,  414,  413,  411,  410,
-      408,  407,  406,  405,  403,  402,  401,  400,  395,  394,
-      392,  391,  390,  389,  388,  386,  385,  383,  380,  378,
-      377,  375,  374,  373,  372,  371,  370,  369,  368,  367,
-      366,  365,  364,  363,  362,  361,  360,  359,  358,  357,
-      355,  354,  353,  352,  350,  349,  348,  347,  346,  345,
-      344,  343,  341,  339,  338,  337,  336,  335,  333,  332,
-      331,  330,  329,  328,  327,  326,  325,  323,  322,  321,
-      320,  319,  318,  317,  316,  315,  314,  313,  311,  310,
-      309,  308,  305,  304,  303,  302,  301,  300,  296,  294,
-
-      291,  290,  287,  283,  276,  274,  273,  272,  271,  270,
-      269,  268,  267,  266,  265,  264,  263,  262,  261,  260,
-      259,  257,  256,  255,  254,  253,  252,  251,  250,  249,
-      248,  247,  246,  245,  243,  242,  241,  240,  239,  238,
-      237,  235,  234,  233,  232,  231,  230,  229,  228,  226,
-      225,  224,  223,  222,  221,  220,  219,  218,  217,  216,
-      215,  214,  213,  212,  211,  210,  209,  208,  206,  205,
-      204,  203,  202,  200,  197,  195,  193,  191,  188,  187,
-      185,  182,  174,  173,  172,  170,  169,  168,  167,  166,
-      165,  163,  160,  158,  156,  155,  154,  153,  151,  150,
-
-      149,  148,  146,  145,  144,  143,  142,  141,  140,  139,
-      138,  136,  134,  132,  131,  130,  129,  127,  126,  125,
-      123,  122,  121,  120,  116,  110,  107,  106,  104,   99,
-       98,   79,   74,   68,   65,   60,   53,   50,   49,   47,
-       43,   41,   39,   38,   24,   14,   11, 1285, 1285, 1285,
-     1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
-     1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
-     1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
-     1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
-     1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
-
-     1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
-     1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285
+       45,   55,   63,   59,   73,  105,   62,  108,   73,   59,
+       62,   55,   63,   62,   62,  118,   81,   73,   81,   81,
+       81,  119,   63,  120,   55,   62,   58,   58,   58,   58,
+
+       58,   58,   58,   58,   58,   58,   58,   58,   55,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+      121,   58,   58,   58,   64,   58,   58,   58,   58,   58,
+       58,   70,   58,   58,   58,   70,   58,   92,   58,   58,
+       58,   58,   58,   58,   58,   58,   71,   64,  122,   69,
+       69,   90,   91,   69,   70,   93,   77,   64,   69,   72,
+       78,   84,   84,   84,   92,   71,   77,   71,   72,   71,
+       94,   76,  124,   72,   72,   76,   90,   91,   76,   77,
+
+       93,   77,  123,   78,   76,   76,  125,  126,  127,  127,
+       76,  123,   78,   77,  128,   94,  129,   78,   86,   86,
+       77,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   95,  101,
+      103,  106,  107,  109,  130,  110,  101,  112,  111,  113,
+
+      114,  114,  114,  117,  131,  114,  132,  133,  132,  135,
+      136,  134,  114,  138,  139,   95,  106,  103,  107,  117,
+      109,  110,  113,  112,  101,  111,  134,  140,  101,  141,
+      117,  137,  101,  142,  137,  143,  144,  145,  137,  101,
+      114,  146,  148,  101,  114,  101,  101,  146,  114,  149,
+      147,  116,  116,  116,  147,  114,  116,  150,  151,  114,
+      152,  114,  114,  153,  116,  116,  116,  154,  155,  156,
+      157,  116,  116,  116,  116,  116,  116,  158,  159,  160,
+      162,  159,  159,  161,  157,  157,  163,  152,  165,  152,
+      161,  166,  167,  168,  116,  116,  116,  116,  116,  116,
+
+      164,  169,  170,  171,  164,  172,  173,  174,  164,  175,
+      176,  177,  178,  162,  162,  162,  179,  180,  181,  184,
+      186,  187,  185,  162,  190,  162,  192,  162,  188,  171,
+      162,  189,  194,  191,  177,  176,  175,  193,  195,  178,
+      180,  179,  183,  183,  183,  185,  198,  199,  200,  183,
+      183,  183,  183,  183,  183,  188,  191,  189,  201,  202,
+      193,  203,  204,  205,  195,  206,  207,  208,  209,  210,
+      199,  206,  183,  183,  183,  183,  183,  183,  197,  197,
+      197,  211,  212,  213,  214,  197,  197,  197,  197,  197,
+      197,  215,  216,  217,  218,  219,  220,  221,  222,  223,
+
+      224,  225,  226,  228,  229,  230,  231,  232,  197,  197,
+      197,  197,  197,  197,  233,  234,  235,  236,  237,  238,
+      239,  240,  241,  242,  243,  244,  245,  246,  247,  248,
+      249,  250,  251,  252,  253,  254,  255,  256,  257,  258,
+      259,  260,  261,  262,  260,  263,  264,  265,  266,  267,
+      268,  269,  270,  271,  272,  273,  274,  275,  276,  277,
+      245,  278,  279,  282,  285,  287,  288,  289,  237,  290,
+      290,  237,  291,  245,  287,  292,  293,  294,  290,  296,
+      286,  286,  286,  298,  302,  279,  282,  286,  286,  286,
+      286,  286,  286,  301,  288,  291,  303,  304,  305,  306,
+
+      307,  308,  311,  309,  294,  312,  313,  314,  277,  316,
+      286,  286,  286,  286,  286,  286,  299,  299,  299,  309,
+      317,  301,  318,  299,  299,  299,  299,  299,  299,  315,
+      319,  320,  321,  315,  322,  323,  324,  325,  326,  327,
+      328,  329,  330,  331,  332,  328,  299,  299,  299,  299,
+      299,  299,  333,  334,  335,  336,  337,  338,  339,  339,
+      334,  340,  341,  342,  343,  344,  345,  346,  348,  334,
+      349,  350,  351,  352,  353,  345,  354,  355,  356,  357,
+      358,  359,  360,  361,  363,  364,  365,  366,  367,  368,
+      328,  369,  367,  370,  371,  328,  372,  373,  374,  375,
+
+      376,  377,  378,  379,  380,  381,  383,  384,  385,  386,
+      389,  391,  392,  385,  390,  390,  390,  394,  395,  396,
+      397,  390,  390,  390,  390,  390,  390,  393,  398,  400,
+      401,  403,  406,  403,  357,  407,  405,  408,  409,  410,
+      412,  413,  414,  415,  390,  390,  390,  390,  390,  390,
+      417,  418,  419,  420,  393,  421,  423,  403,  424,  403,
+      404,  404,  404,  405,  425,  426,  419,  404,  404,  404,
+      404,  404,  404,  427,  428,  429,  430,  431,  432,  428,
+      434,  435,  436,  437,  438,  439,  440,  441,  442,  443,
+      404,  404,  404,  404,  404,  404,  444,  445,  446,  447,
+
+      448,  449,  450,  451,  452,  453,  454,  456,  457,  458,
+      459,  460,  461,  462,  463,  464,  465,  466,  467,  469,
+      471,  472,  473,  474,  475,  476,  477,  478,  479,  480,
+      481,  482,  483,  484,  485,  486,  487,  488,  489,  490,
+      491,  494,  495,  497,  498,  499,  500,  500,  500,  501,
+      502,  503,  504,  500,  500,  500,  500,  500,  500,  507,
+      509,  511,  512,  513,  515,  516,  517,  518,  513,  519,
+      516,  516,  520,  521,  522,  523,  500,  500,  500,  500,
+      500,  500,  524,  525,  526,  527,  528,  511,  529,  512,
+      530,  531,  532,  533,  535,  536,  537,  538,  539,  540,
+
+      541,  542,  543,  544,  545,  546,  547,  548,  549,  550,
+      551,  552,  553,  554,  555,  556,  557,  558,  559,  561,
+      562,  563,  564,  565,  566,  567,  568,  569,  570,  571,
+      572,  574,  575,  576,  577,  578,  579,  580,  581,  582,
+      584,  585,  586,  587,  588,  589,  590,  591,  592,  594,
+      595,  596,  597,  598,  600,  601,  603,  604,  594,  549,
+      605,  606,  567,  607,  608,  609,  610,  611,  612,  613,
+      614,  615,  616,  608,  617,  618,  614,  619,  620,  621,
+      622,  623,  624,  625,  626,  627,  607,  628,  606,  629,
+      630,  631,  632,  633,  634,  635,  636,  637,  638,  639,
+
+      640,  641,  642,  643,  644,  645,  646,  647,  648,  649,
+      650,  651,  615,  652,  653,  655,  656,  657,  658,  659,
+      660,  661,  663,  664,  666,  667,  668,  669,  670,  671,
+      672,  673,  674,  675,  676,  677,  678,  679,  680,  681,
+      682,  683,  683,  684,  685,  686,  682,  688,  683,  689,
+      690,  686,  691,  692,  693,  694,  695,  696,  698,  699,
+      700,  701,  702,  703,  704,  705,  706,  707,  708,  709,
+      710,  711,  712,  713,  714,  715,  716,  717,  718,  719,
+      720,  721,  722,  723,  725,  726,  699,  727,  728,  729,
+      730,  731,  732,  733,  734,  735,  736,  737,  738,  739,
+
+      740,  741,  743,  745,  746,  747,  750,  751,  752,  753,
+      754,  755,  756,  753,  757,  758,  759,  761,  762,  763,
+      764,  765,  766,  767,  768,  769,  770,  771,  772,  773,
+      774,  775,  776,  777,  778,  779,  780,  781,  782,  784,
+      785,  786,  787,  788,  789,  790,  792,  793,  794,  795,
+      796,  797,  798,  799,  800,  801,  802,  803,  804,  805,
+      806,  807,  808,  809,  810,  811,  812,  814,  815,  816,
+      793,  817,  792,  818,  819,  820,  821,  822,  823,  825,
+      826,  827,  828,  830,  831,  832,  827,  833,  834,  835,
+      836,  837,  838,  839,  840,  841,  842,  843,  844,  845,
+
+      846,  847,  848,  850,  851,  852,  853,  855,  856,  857,
+      858,  847,  859,  860,  861,  862,  863,  864,  865,  866,
+      867,  869,  870,  871,  872,  873,  874,  875,  876,  877,
+      878,  879,  881,  880,  882,  883,  827,  884,  885,  887,
+      888,  890,  891,  892,  893,  894,  895,  896,  898,  899,
+      900,  901,  902,  903,  904,  905,  906,  907,  879,  880,
+      908,  909,  910,  911,  913,  914,  915,  916,  917,  918,
+      914,  919,  920,  921,  922,  923,  924,  917,  925,  926,
+      927,  928,  929,  930,  931,  932,  933,  934,  935,  936,
+      937,  938,  940,  941,  942,  943,  944,  945,  946,  947,
+
+      949,  950,  952,  953,  954,  955,  956,  957,  958,  959,
+      960,  962,  963,  964,  965,  966,  967,  968,  971,  972,
+      973,  974,  975,  978,  979,  980,  981,  982,  983,  984,
+      985,  986,  987,  988,  989,  963,  990,  991,  993,  995,
+      964,  997,  998,  999, 1000, 1001, 1002, 1003, 1004, 1005,
+     1006, 1008, 1009, 1010, 1012, 1013, 1014, 1015, 1016, 1019,
+     1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029,
+     1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039,
+     1040, 1041, 1042, 1043, 1045, 1046, 1047, 1048, 1049, 1050,
+     1051, 1052, 1053, 1054, 1055, 1056, 1058, 1059, 1060, 1061,
+
+     1062, 1063, 1064, 1065, 1061, 1066, 1067, 1068, 1041, 1069,
+     1070, 1071, 1072, 1073, 1074, 1075, 1076, 1027, 1077, 1078,
+     1082, 1083, 1084, 1085, 1086, 1087, 1077, 1088, 1047, 1089,
+     1090, 1091, 1093, 1094, 1095, 1096, 1098, 1100, 1103, 1105,
+     1106, 1107, 1108, 1109, 1111, 1112, 1107, 1113, 1115, 1116,
+     1117, 1118, 1119, 1120, 1121, 1123, 1124, 1125, 1126, 1127,
+     1130, 1129, 1131, 1132, 1133, 1135, 1109, 1129, 1136, 1137,
+     1138, 1139, 1141, 1143, 1144, 1145, 1146, 1148, 1149, 1150,
+     1151, 1152, 1155, 1156, 1158, 1159, 1161, 1162, 1163, 1164,
+     1166, 1168, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177,
+
+     1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185, 1186, 1187,
+     1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1170, 1196,
+     1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206,
+     1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215, 1216,
+     1217, 1218, 1220, 1222, 1223, 1226, 1227, 1230, 1231, 1232,
+     1233, 1234, 1235, 1236, 1237, 1239, 1241, 1244, 1245, 1247,
+     1248, 1249, 1251, 1252, 1253, 1254, 1255, 1217, 1256, 1257,
+     1258, 1259, 1260, 1261, 1263, 1264, 1265, 1266, 1268, 1269,
+     1270, 1271, 1272, 1273, 1274, 1275, 1276, 1278, 1279, 1280,
+     1281, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291,
+
+     1292, 1296, 1299, 1300, 1301, 1302, 1304, 1305, 1307, 1308,
+     1309, 1310, 1311, 1312, 1313, 1314, 1316, 1307, 1317, 1318,
+     1319, 1320, 1321, 1322, 1324, 1325, 1326, 1327, 1328, 1329,
+     1330, 1331, 1332, 1334, 1335, 1337, 1338, 1339, 1340, 1341,
+     1342, 1344, 1345, 1346, 1347, 1348, 1350, 1351, 1352, 1353,
+     1354, 1355, 1356, 1357, 1359, 1362, 1364, 1365, 1366, 1367,
+     1369, 1370, 1371, 1372, 1373, 1374, 1376, 1378, 1379, 1382,
+     1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393,
+     1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403,
+     1404, 1406, 1407, 1409, 1410, 1411, 1412, 1413, 1414, 1415,
+
+     1419, 1420, 1422, 1424, 1425, 1426, 1427, 1428, 1429, 1430,
+     1432, 1433, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
+     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
+     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
+     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
+     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
+     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
+     1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
+     1435, 1435, 1435
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1575,25 +1745,27 @@ static char *yy_last_accepting_cpos;
 extern int yy_flex_debug;
 int yy_flex_debug = 1;
 
-static const flex_int16_t yy_rule_linenum[158] =
+static const flex_int16_t yy_rule_linenum[173] =
     {   0,
       143,  145,  147,  152,  153,  158,  159,  160,  172,  175,
       180,  187,  196,  205,  214,  223,  233,  242,  251,  260,
       269,  278,  287,  296,  305,  316,  325,  334,  343,  352,
-      362,  372,  382,  392,  402,  412,  422,  432,  442,  453,
-      464,  475,  484,  494,  503,  513,  528,  544,  553,  562,
-      571,  580,  590,  599,  609,  618,  627,  636,  646,  655,
-      664,  673,  682,  692,  701,  710,  719,  728,  737,  746,
-      755,  764,  773,  782,  792,  803,  813,  822,  832,  842,
-      852,  862,  872,  881,  891,  900,  909,  918,  927,  937,
-      947,  957,  966,  975,  984,  993, 1002, 1011, 1020, 1029,
-
-     1038, 1047, 1056, 1065, 1074, 1083, 1092, 1101, 1110, 1119,
-     1128, 1137, 1146, 1155, 1164, 1173, 1182, 1191, 1200, 1209,
-     1219, 1229, 1239, 1249, 1259, 1269, 1279, 1289, 1299, 1308,
-     1317, 1326, 1335, 1344, 1353, 1362, 1373, 1386, 1399, 1414,
-     1512, 1517, 1522, 1527, 1528, 1529, 1530, 1531, 1532, 1534,
-     1552, 1565, 1570, 1574, 1576, 1578, 1580
+      362,  372,  382,  392,  402,  412,  422,  432,  442,  451,
+      460,  469,  478,  487,  496,  505,  514,  523,  532,  541,
+      550,  559,  569,  579,  590,  601,  612,  621,  631,  640,
+      650,  665,  681,  690,  699,  708,  717,  727,  736,  746,
+      755,  764,  773,  783,  792,  801,  810,  819,  829,  838,
+      847,  856,  865,  874,  883,  892,  901,  910,  919,  929,
+      940,  950,  959,  969,  979,  989,  999, 1009, 1018, 1028,
+
+     1037, 1046, 1055, 1064, 1074, 1084, 1094, 1103, 1112, 1121,
+     1130, 1139, 1148, 1157, 1166, 1175, 1184, 1193, 1202, 1211,
+     1220, 1229, 1238, 1247, 1256, 1265, 1274, 1283, 1292, 1301,
+     1310, 1319, 1328, 1337, 1346, 1356, 1366, 1376, 1386, 1396,
+     1406, 1416, 1426, 1436, 1445, 1454, 1463, 1472, 1481, 1490,
+     1499, 1510, 1523, 1536, 1551, 1649, 1654, 1659, 1664, 1665,
+     1666, 1667, 1668, 1669, 1671, 1689, 1702, 1707, 1711, 1713,
+     1715, 1717
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1646,7 +1818,7 @@ using namespace isc::dhcp;
 
 /* To avoid the call to exit... oops! */
 #define YY_FATAL_ERROR(msg) isc::dhcp::Parser4Context::fatal(msg)
-#line 1649 "dhcp4_lexer.cc"
+#line 1821 "dhcp4_lexer.cc"
 /* noyywrap disables automatic rewinding for the next file to parse. Since we
    always parse only a single string, there's no need to do any wraps. And
    using yywrap requires linking with -lfl, which provides the default yywrap
@@ -1672,8 +1844,8 @@ using namespace isc::dhcp;
    by moving it ahead by yyleng bytes. yyleng specifies the length of the
    currently matched token. */
 #define YY_USER_ACTION  driver.loc_.columns(yyleng);
-#line 1675 "dhcp4_lexer.cc"
-#line 1676 "dhcp4_lexer.cc"
+#line 1847 "dhcp4_lexer.cc"
+#line 1848 "dhcp4_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -1999,7 +2171,7 @@ YY_DECL
     }
 
 
-#line 2002 "dhcp4_lexer.cc"
+#line 2174 "dhcp4_lexer.cc"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -2028,13 +2200,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 1286 )
+				if ( yy_current_state >= 1436 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 1285 );
+		while ( yy_current_state != 1435 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -2053,13 +2225,13 @@ do_action:	/* This label is used only to access EOF actions. */
 			{
 			if ( yy_act == 0 )
 				fprintf( stderr, "--scanner backing up\n" );
-			else if ( yy_act < 158 )
+			else if ( yy_act < 173 )
 				fprintf( stderr, "--accepting rule at line %ld (\"%s\")\n",
 				         (long)yy_rule_linenum[yy_act], yytext );
-			else if ( yy_act == 158 )
+			else if ( yy_act == 173 )
 				fprintf( stderr, "--accepting default rule (\"%s\")\n",
 				         yytext );
-			else if ( yy_act == 159 )
+			else if ( yy_act == 174 )
 				fprintf( stderr, "--(end of buffer or a NUL)\n" );
 			else
 				fprintf( stderr, "--EOF (start condition %d)\n", YY_START );
@@ -2502,6 +2674,188 @@ YY_RULE_SETUP
 case 39:
 YY_RULE_SETUP
 #line 442 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_PACKED(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("packed", driver.loc_);
+    }
+}
+	YY_BREAK
+case 40:
+YY_RULE_SETUP
+#line 451 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_GROUP_COMMIT(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("group-commit", driver.loc_);
+    }
+}
+	YY_BREAK
+case 41:
+YY_RULE_SETUP
+#line 460 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_GROUP_COMMIT_SYNC(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("group-commit-sync", driver.loc_);
+    }
+}
+	YY_BREAK
+case 42:
+YY_RULE_SETUP
+#line 469 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_GROUP_COMMIT_MAX_BATCH(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("group-commit-max-batch", driver.loc_);
+    }
+}
+	YY_BREAK
+case 43:
+YY_RULE_SETUP
+#line 478 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_GROUP_COMMIT_MAX_LATENCY(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("group-commit-max-latency", driver.loc_);
+    }
+}
+	YY_BREAK
+case 44:
+YY_RULE_SETUP
+#line 487 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_LOAD_THREADS(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("load-threads", driver.loc_);
+    }
+}
+	YY_BREAK
+case 45:
+YY_RULE_SETUP
+#line 496 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_LFC_IN_PROCESS(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("lfc-in-process", driver.loc_);
+    }
+}
+	YY_BREAK
+case 46:
+YY_RULE_SETUP
+#line 505 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_LFC_BATCH_SIZE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("lfc-batch-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 47:
+YY_RULE_SETUP
+#line 514 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_LFC_BATCH_INTERVAL(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("lfc-batch-interval", driver.loc_);
+    }
+}
+	YY_BREAK
+case 48:
+YY_RULE_SETUP
+#line 523 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_LFC_SNAPSHOT_FORMAT(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("lfc-snapshot-format", driver.loc_);
+    }
+}
+	YY_BREAK
+case 49:
+YY_RULE_SETUP
+#line 532 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::HOSTS_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_CACHE_SIZE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("cache-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 50:
+YY_RULE_SETUP
+#line 541 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::HOSTS_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_CACHE_TTL(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("cache-ttl", driver.loc_);
+    }
+}
+	YY_BREAK
+case 51:
+YY_RULE_SETUP
+#line 550 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::HOSTS_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_CACHE_NEGATIVE_TTL(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("cache-negative-ttl", driver.loc_);
+    }
+}
+	YY_BREAK
+case 52:
+YY_RULE_SETUP
+#line 559 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+    case isc::dhcp::Parser4Context::HOSTS_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_CONNECTION_POOL_SIZE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("connection-pool-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 53:
+YY_RULE_SETUP
+#line 569 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+    case isc::dhcp::Parser4Context::HOSTS_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_RECONNECT_WAIT_TIME(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("reconnect-wait-time", driver.loc_);
+    }
+}
+	YY_BREAK
+case 54:
+YY_RULE_SETUP
+#line 579 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2513,9 +2867,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 40:
+case 55:
 YY_RULE_SETUP
-#line 453 "dhcp4_lexer.ll"
+#line 590 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2527,9 +2881,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 41:
+case 56:
 YY_RULE_SETUP
-#line 464 "dhcp4_lexer.ll"
+#line 601 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2541,9 +2895,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 42:
+case 57:
 YY_RULE_SETUP
-#line 475 "dhcp4_lexer.ll"
+#line 612 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2553,9 +2907,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 43:
+case 58:
 YY_RULE_SETUP
-#line 484 "dhcp4_lexer.ll"
+#line 621 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2566,9 +2920,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 44:
+case 59:
 YY_RULE_SETUP
-#line 494 "dhcp4_lexer.ll"
+#line 631 "dhcp4_lexer.ll"
 {
     switch (driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2578,9 +2932,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 45:
+case 60:
 YY_RULE_SETUP
-#line 503 "dhcp4_lexer.ll"
+#line 640 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2591,9 +2945,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 46:
+case 61:
 YY_RULE_SETUP
-#line 513 "dhcp4_lexer.ll"
+#line 650 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2609,9 +2963,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 47:
+case 62:
 YY_RULE_SETUP
-#line 528 "dhcp4_lexer.ll"
+#line 665 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2628,9 +2982,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 48:
+case 63:
 YY_RULE_SETUP
-#line 544 "dhcp4_lexer.ll"
+#line 681 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DATA:
@@ -2640,9 +2994,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 49:
+case 64:
 YY_RULE_SETUP
-#line 553 "dhcp4_lexer.ll"
+#line 690 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DATA:
@@ -2652,9 +3006,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 50:
+case 65:
 YY_RULE_SETUP
-#line 562 "dhcp4_lexer.ll"
+#line 699 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2664,9 +3018,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 51:
+case 66:
 YY_RULE_SETUP
-#line 571 "dhcp4_lexer.ll"
+#line 708 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::POOLS:
@@ -2676,9 +3030,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 52:
+case 67:
 YY_RULE_SETUP
-#line 580 "dhcp4_lexer.ll"
+#line 717 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2689,9 +3043,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 53:
+case 68:
 YY_RULE_SETUP
-#line 590 "dhcp4_lexer.ll"
+#line 727 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2701,9 +3055,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 54:
+case 69:
 YY_RULE_SETUP
-#line 599 "dhcp4_lexer.ll"
+#line 736 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2714,9 +3068,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 55:
+case 70:
 YY_RULE_SETUP
-#line 609 "dhcp4_lexer.ll"
+#line 746 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2726,9 +3080,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 56:
+case 71:
 YY_RULE_SETUP
-#line 618 "dhcp4_lexer.ll"
+#line 755 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2738,9 +3092,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 57:
+case 72:
 YY_RULE_SETUP
-#line 627 "dhcp4_lexer.ll"
+#line 764 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2750,9 +3104,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 58:
+case 73:
 YY_RULE_SETUP
-#line 636 "dhcp4_lexer.ll"
+#line 773 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2763,9 +3117,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 59:
+case 74:
 YY_RULE_SETUP
-#line 646 "dhcp4_lexer.ll"
+#line 783 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -2775,9 +3129,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 60:
+case 75:
 YY_RULE_SETUP
-#line 655 "dhcp4_lexer.ll"
+#line 792 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -2787,9 +3141,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 61:
+case 76:
 YY_RULE_SETUP
-#line 664 "dhcp4_lexer.ll"
+#line 801 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -2799,9 +3153,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 62:
+case 77:
 YY_RULE_SETUP
-#line 673 "dhcp4_lexer.ll"
+#line 810 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -2811,9 +3165,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 63:
+case 78:
 YY_RULE_SETUP
-#line 682 "dhcp4_lexer.ll"
+#line 819 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -2824,9 +3178,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 64:
+case 79:
 YY_RULE_SETUP
-#line 692 "dhcp4_lexer.ll"
+#line 829 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2836,9 +3190,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 65:
+case 80:
 YY_RULE_SETUP
-#line 701 "dhcp4_lexer.ll"
+#line 838 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -2848,9 +3202,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 66:
+case 81:
 YY_RULE_SETUP
-#line 710 "dhcp4_lexer.ll"
+#line 847 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LOGGING:
@@ -2860,9 +3214,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 67:
+case 82:
 YY_RULE_SETUP
-#line 719 "dhcp4_lexer.ll"
+#line 856 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LOGGERS:
@@ -2872,9 +3226,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 68:
+case 83:
 YY_RULE_SETUP
-#line 728 "dhcp4_lexer.ll"
+#line 865 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
@@ -2884,9 +3238,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 69:
+case 84:
 YY_RULE_SETUP
-#line 737 "dhcp4_lexer.ll"
+#line 874 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LOGGERS:
@@ -2896,9 +3250,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 70:
+case 85:
 YY_RULE_SETUP
-#line 746 "dhcp4_lexer.ll"
+#line 883 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
@@ -2908,9 +3262,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 71:
+case 86:
 YY_RULE_SETUP
-#line 755 "dhcp4_lexer.ll"
+#line 892 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
@@ -2920,9 +3274,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 72:
+case 87:
 YY_RULE_SETUP
-#line 764 "dhcp4_lexer.ll"
+#line 901 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
@@ -2932,9 +3286,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 73:
+case 88:
 YY_RULE_SETUP
-#line 773 "dhcp4_lexer.ll"
+#line 910 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LOGGERS:
@@ -2944,9 +3298,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 74:
+case 89:
 YY_RULE_SETUP
-#line 782 "dhcp4_lexer.ll"
+#line 919 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2957,9 +3311,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 75:
+case 90:
 YY_RULE_SETUP
-#line 792 "dhcp4_lexer.ll"
+#line 929 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2971,9 +3325,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 76:
+case 91:
 YY_RULE_SETUP
-#line 803 "dhcp4_lexer.ll"
+#line 940 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CLIENT_CLASSES:
@@ -2984,9 +3338,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 77:
+case 92:
 YY_RULE_SETUP
-#line 813 "dhcp4_lexer.ll"
+#line 950 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2996,9 +3350,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 78:
+case 93:
 YY_RULE_SETUP
-#line 822 "dhcp4_lexer.ll"
+#line 959 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3009,9 +3363,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 79:
+case 94:
 YY_RULE_SETUP
-#line 832 "dhcp4_lexer.ll"
+#line 969 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3022,9 +3376,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 80:
+case 95:
 YY_RULE_SETUP
-#line 842 "dhcp4_lexer.ll"
+#line 979 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3035,9 +3389,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 81:
+case 96:
 YY_RULE_SETUP
-#line 852 "dhcp4_lexer.ll"
+#line 989 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3048,9 +3402,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 82:
+case 97:
 YY_RULE_SETUP
-#line 862 "dhcp4_lexer.ll"
+#line 999 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3061,9 +3415,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 83:
+case 98:
 YY_RULE_SETUP
-#line 872 "dhcp4_lexer.ll"
+#line 1009 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATIONS:
@@ -3073,9 +3427,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 84:
+case 99:
 YY_RULE_SETUP
-#line 881 "dhcp4_lexer.ll"
+#line 1018 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3086,9 +3440,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 85:
+case 100:
 YY_RULE_SETUP
-#line 891 "dhcp4_lexer.ll"
+#line 1028 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DATA:
@@ -3098,9 +3452,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 86:
+case 101:
 YY_RULE_SETUP
-#line 900 "dhcp4_lexer.ll"
+#line 1037 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3110,9 +3464,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 87:
+case 102:
 YY_RULE_SETUP
-#line 909 "dhcp4_lexer.ll"
+#line 1046 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3122,9 +3476,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 88:
+case 103:
 YY_RULE_SETUP
-#line 918 "dhcp4_lexer.ll"
+#line 1055 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3134,9 +3488,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 89:
+case 104:
 YY_RULE_SETUP
-#line 927 "dhcp4_lexer.ll"
+#line 1064 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3147,9 +3501,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 90:
+case 105:
 YY_RULE_SETUP
-#line 937 "dhcp4_lexer.ll"
+#line 1074 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RELAY:
@@ -3160,9 +3514,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 91:
+case 106:
 YY_RULE_SETUP
-#line 947 "dhcp4_lexer.ll"
+#line 1084 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3172,9 +3526,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 92:
+case 107:
 YY_RULE_SETUP
-#line 957 "dhcp4_lexer.ll"
+#line 1094 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOOKS_LIBRARIES:
@@ -3184,9 +3538,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 93:
+case 108:
 YY_RULE_SETUP
-#line 966 "dhcp4_lexer.ll"
+#line 1103 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOOKS_LIBRARIES:
@@ -3196,9 +3550,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 94:
+case 109:
 YY_RULE_SETUP
-#line 975 "dhcp4_lexer.ll"
+#line 1112 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3208,9 +3562,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 95:
+case 110:
 YY_RULE_SETUP
-#line 984 "dhcp4_lexer.ll"
+#line 1121 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3220,9 +3574,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 96:
+case 111:
 YY_RULE_SETUP
-#line 993 "dhcp4_lexer.ll"
+#line 1130 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3232,9 +3586,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 97:
+case 112:
 YY_RULE_SETUP
-#line 1002 "dhcp4_lexer.ll"
+#line 1139 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3244,9 +3598,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 98:
+case 113:
 YY_RULE_SETUP
-#line 1011 "dhcp4_lexer.ll"
+#line 1148 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3256,9 +3610,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 99:
+case 114:
 YY_RULE_SETUP
-#line 1020 "dhcp4_lexer.ll"
+#line 1157 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3268,9 +3622,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 100:
+case 115:
 YY_RULE_SETUP
-#line 1029 "dhcp4_lexer.ll"
+#line 1166 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3280,9 +3634,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 101:
+case 116:
 YY_RULE_SETUP
-#line 1038 "dhcp4_lexer.ll"
+#line 1175 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3292,9 +3646,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 102:
+case 117:
 YY_RULE_SETUP
-#line 1047 "dhcp4_lexer.ll"
+#line 1184 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3304,9 +3658,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 103:
+case 118:
 YY_RULE_SETUP
-#line 1056 "dhcp4_lexer.ll"
+#line 1193 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONTROL_SOCKET:
@@ -3316,9 +3670,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 104:
+case 119:
 YY_RULE_SETUP
-#line 1065 "dhcp4_lexer.ll"
+#line 1202 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONTROL_SOCKET:
@@ -3328,9 +3682,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 105:
+case 120:
 YY_RULE_SETUP
-#line 1074 "dhcp4_lexer.ll"
+#line 1211 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3340,9 +3694,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 106:
+case 121:
 YY_RULE_SETUP
-#line 1083 "dhcp4_lexer.ll"
+#line 1220 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3352,9 +3706,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 107:
+case 122:
 YY_RULE_SETUP
-#line 1092 "dhcp4_lexer.ll"
+#line 1229 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3364,9 +3718,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 108:
+case 123:
 YY_RULE_SETUP
-#line 1101 "dhcp4_lexer.ll"
+#line 1238 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3376,9 +3730,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 109:
+case 124:
 YY_RULE_SETUP
-#line 1110 "dhcp4_lexer.ll"
+#line 1247 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3388,9 +3742,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 110:
+case 125:
 YY_RULE_SETUP
-#line 1119 "dhcp4_lexer.ll"
+#line 1256 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3400,9 +3754,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 111:
+case 126:
 YY_RULE_SETUP
-#line 1128 "dhcp4_lexer.ll"
+#line 1265 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3412,9 +3766,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 112:
+case 127:
 YY_RULE_SETUP
-#line 1137 "dhcp4_lexer.ll"
+#line 1274 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3424,9 +3778,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 113:
+case 128:
 YY_RULE_SETUP
-#line 1146 "dhcp4_lexer.ll"
+#line 1283 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3436,9 +3790,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 114:
+case 129:
 YY_RULE_SETUP
-#line 1155 "dhcp4_lexer.ll"
+#line 1292 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3448,9 +3802,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 115:
+case 130:
 YY_RULE_SETUP
-#line 1164 "dhcp4_lexer.ll"
+#line 1301 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3460,9 +3814,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 116:
+case 131:
 YY_RULE_SETUP
-#line 1173 "dhcp4_lexer.ll"
+#line 1310 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3472,9 +3826,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 117:
+case 132:
 YY_RULE_SETUP
-#line 1182 "dhcp4_lexer.ll"
+#line 1319 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3484,9 +3838,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 118:
+case 133:
 YY_RULE_SETUP
-#line 1191 "dhcp4_lexer.ll"
+#line 1328 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3496,9 +3850,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 119:
+case 134:
 YY_RULE_SETUP
-#line 1200 "dhcp4_lexer.ll"
+#line 1337 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3508,9 +3862,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 120:
+case 135:
 YY_RULE_SETUP
-#line 1209 "dhcp4_lexer.ll"
+#line 1346 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_PROTOCOL) {
@@ -3521,9 +3875,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 121:
+case 136:
 YY_RULE_SETUP
-#line 1219 "dhcp4_lexer.ll"
+#line 1356 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_PROTOCOL) {
@@ -3534,9 +3888,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 122:
+case 137:
 YY_RULE_SETUP
-#line 1229 "dhcp4_lexer.ll"
+#line 1366 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_FORMAT) {
@@ -3547,9 +3901,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 123:
+case 138:
 YY_RULE_SETUP
-#line 1239 "dhcp4_lexer.ll"
+#line 1376 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3560,9 +3914,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 124:
+case 139:
 YY_RULE_SETUP
-#line 1249 "dhcp4_lexer.ll"
+#line 1386 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3573,9 +3927,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 125:
+case 140:
 YY_RULE_SETUP
-#line 1259 "dhcp4_lexer.ll"
+#line 1396 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3586,9 +3940,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 126:
+case 141:
 YY_RULE_SETUP
-#line 1269 "dhcp4_lexer.ll"
+#line 1406 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3599,9 +3953,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 127:
+case 142:
 YY_RULE_SETUP
-#line 1279 "dhcp4_lexer.ll"
+#line 1416 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3612,9 +3966,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 128:
+case 143:
 YY_RULE_SETUP
-#line 1289 "dhcp4_lexer.ll"
+#line 1426 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3625,9 +3979,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 129:
+case 144:
 YY_RULE_SETUP
-#line 1299 "dhcp4_lexer.ll"
+#line 1436 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -3637,9 +3991,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 130:
+case 145:
 YY_RULE_SETUP
-#line 1308 "dhcp4_lexer.ll"
+#line 1445 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -3649,9 +4003,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 131:
+case 146:
 YY_RULE_SETUP
-#line 1317 "dhcp4_lexer.ll"
+#line 1454 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -3661,9 +4015,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 132:
+case 147:
 YY_RULE_SETUP
-#line 1326 "dhcp4_lexer.ll"
+#line 1463 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3673,9 +4027,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 133:
+case 148:
 YY_RULE_SETUP
-#line 1335 "dhcp4_lexer.ll"
+#line 1472 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3685,9 +4039,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 134:
+case 149:
 YY_RULE_SETUP
-#line 1344 "dhcp4_lexer.ll"
+#line 1481 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3697,9 +4051,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 135:
+case 150:
 YY_RULE_SETUP
-#line 1353 "dhcp4_lexer.ll"
+#line 1490 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3709,9 +4063,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 136:
+case 151:
 YY_RULE_SETUP
-#line 1362 "dhcp4_lexer.ll"
+#line 1499 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3723,9 +4077,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 137:
+case 152:
 YY_RULE_SETUP
-#line 1373 "dhcp4_lexer.ll"
+#line 1510 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3739,9 +4093,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 138:
+case 153:
 YY_RULE_SETUP
-#line 1386 "dhcp4_lexer.ll"
+#line 1523 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3755,9 +4109,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 139:
+case 154:
 YY_RULE_SETUP
-#line 1399 "dhcp4_lexer.ll"
+#line 1536 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3771,9 +4125,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 140:
+case 155:
 YY_RULE_SETUP
-#line 1414 "dhcp4_lexer.ll"
+#line 1551 "dhcp4_lexer.ll"
 {
     /* A string has been matched. It contains the actual string and single quotes.
        We need to get those quotes out of the way and just use its content, e.g.
@@ -3872,65 +4226,65 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 141:
-/* rule 141 can match eol */
+case 156:
+/* rule 156 can match eol */
 YY_RULE_SETUP
-#line 1512 "dhcp4_lexer.ll"
+#line 1649 "dhcp4_lexer.ll"
 {
     /* Bad string with a forbidden control character inside */
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
 }
 	YY_BREAK
-case 142:
-/* rule 142 can match eol */
+case 157:
+/* rule 157 can match eol */
 YY_RULE_SETUP
-#line 1517 "dhcp4_lexer.ll"
+#line 1654 "dhcp4_lexer.ll"
 {
     /* Bad string with a bad escape inside */
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 143:
+case 158:
 YY_RULE_SETUP
-#line 1522 "dhcp4_lexer.ll"
+#line 1659 "dhcp4_lexer.ll"
 {
     /* Bad string with an open escape at the end */
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 144:
+case 159:
 YY_RULE_SETUP
-#line 1527 "dhcp4_lexer.ll"
+#line 1664 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 145:
+case 160:
 YY_RULE_SETUP
-#line 1528 "dhcp4_lexer.ll"
+#line 1665 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 146:
+case 161:
 YY_RULE_SETUP
-#line 1529 "dhcp4_lexer.ll"
+#line 1666 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 147:
+case 162:
 YY_RULE_SETUP
-#line 1530 "dhcp4_lexer.ll"
+#line 1667 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 148:
+case 163:
 YY_RULE_SETUP
-#line 1531 "dhcp4_lexer.ll"
+#line 1668 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 149:
+case 164:
 YY_RULE_SETUP
-#line 1532 "dhcp4_lexer.ll"
+#line 1669 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 150:
+case 165:
 YY_RULE_SETUP
-#line 1534 "dhcp4_lexer.ll"
+#line 1671 "dhcp4_lexer.ll"
 {
     /* An integer was found. */
     std::string tmp(yytext);
@@ -3949,9 +4303,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 151:
+case 166:
 YY_RULE_SETUP
-#line 1552 "dhcp4_lexer.ll"
+#line 1689 "dhcp4_lexer.ll"
 {
     /* A floating point was found. */
     std::string tmp(yytext);
@@ -3965,43 +4319,43 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 152:
+case 167:
 YY_RULE_SETUP
-#line 1565 "dhcp4_lexer.ll"
+#line 1702 "dhcp4_lexer.ll"
 {
     string tmp(yytext);
     return isc::dhcp::Dhcp4Parser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 153:
+case 168:
 YY_RULE_SETUP
-#line 1570 "dhcp4_lexer.ll"
+#line 1707 "dhcp4_lexer.ll"
 {
    return isc::dhcp::Dhcp4Parser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 154:
+case 169:
 YY_RULE_SETUP
-#line 1574 "dhcp4_lexer.ll"
+#line 1711 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 155:
+case 170:
 YY_RULE_SETUP
-#line 1576 "dhcp4_lexer.ll"
+#line 1713 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 156:
+case 171:
 YY_RULE_SETUP
-#line 1578 "dhcp4_lexer.ll"
+#line 1715 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 157:
+case 172:
 YY_RULE_SETUP
-#line 1580 "dhcp4_lexer.ll"
+#line 1717 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 1582 "dhcp4_lexer.ll"
+#line 1719 "dhcp4_lexer.ll"
 {
     if (driver.states_.empty()) {
         return isc::dhcp::Dhcp4Parser::make_END(driver.loc_);
@@ -4025,12 +4379,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 158:
+case 173:
 YY_RULE_SETUP
-#line 1605 "dhcp4_lexer.ll"
+#line 1742 "dhcp4_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 4033 "dhcp4_lexer.cc"
+#line 4387 "dhcp4_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -4349,7 +4703,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 1286 )
+			if ( yy_current_state >= 1436 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -4382,11 +4736,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 1286 )
+		if ( yy_current_state >= 1436 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 1285);
+	yy_is_jam = (yy_current_state == 1435);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -5135,8 +5489,7 @@ void yyfree (void * ptr )
 
 /* %ok-for-header */
 
-#line 1605 "dhcp4_lexer.ll"
-
+#line 1742 "dhcp4_lexer.ll"
 
 using namespace isc::dhcp;
 
@@ -5238,4 +5591,3 @@ class Dummy {
 };
 }
 #endif /* !__clang_analyzer__ */
-
@@ -438,6 +438,143 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
     }
 }
 
+\"packed\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_PACKED(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("packed", driver.loc_);
+    }
+}
+
+\"group-commit\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_GROUP_COMMIT(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("group-commit", driver.loc_);
+    }
+}
+
+\"group-commit-sync\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_GROUP_COMMIT_SYNC(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("group-commit-sync", driver.loc_);
+    }
+}
+
+\"group-commit-max-batch\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_GROUP_COMMIT_MAX_BATCH(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("group-commit-max-batch", driver.loc_);
+    }
+}
+
+\"group-commit-max-latency\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_GROUP_COMMIT_MAX_LATENCY(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("group-commit-max-latency", driver.loc_);
+    }
+}
+
+\"load-threads\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_LOAD_THREADS(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("load-threads", driver.loc_);
+    }
+}
+
+\"lfc-in-process\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_LFC_IN_PROCESS(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("lfc-in-process", driver.loc_);
+    }
+}
+
+\"lfc-batch-size\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_LFC_BATCH_SIZE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("lfc-batch-size", driver.loc_);
+    }
+}
+
+\"lfc-batch-interval\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_LFC_BATCH_INTERVAL(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("lfc-batch-interval", driver.loc_);
+    }
+}
+
+\"lfc-snapshot-format\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_LFC_SNAPSHOT_FORMAT(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("lfc-snapshot-format", driver.loc_);
+    }
+}
+
+\"cache-size\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::HOSTS_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_CACHE_SIZE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("cache-size", driver.loc_);
+    }
+}
+
+\"cache-ttl\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::HOSTS_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_CACHE_TTL(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("cache-ttl", driver.loc_);
+    }
+}
+
+\"cache-negative-ttl\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::HOSTS_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_CACHE_NEGATIVE_TTL(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("cache-negative-ttl", driver.loc_);
+    }
+}
+
+\"connection-pool-size\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+    case isc::dhcp::Parser4Context::HOSTS_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_CONNECTION_POOL_SIZE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("connection-pool-size", driver.loc_);
+    }
+}
+
+\"reconnect-wait-time\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+    case isc::dhcp::Parser4Context::HOSTS_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_RECONNECT_WAIT_TIME(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("reconnect-wait-time", driver.loc_);
+    }
+}
+
 \"valid-lifetime\" {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -253,30 +253,30 @@ namespace isc { namespace dhcp {
   {
       switch (that.type_get ())
     {
-      case 164: // value
-      case 168: // map_value
-      case 206: // socket_type
-      case 209: // outbound_interface_value
-      case 219: // db_type
-      case 296: // hr_mode
-      case 439: // ncr_protocol_value
-      case 447: // replace_client_name_value
+      case 179: // value
+      case 183: // map_value
+      case 221: // socket_type
+      case 224: // outbound_interface_value
+      case 234: // db_type
+      case 327: // hr_mode
+      case 470: // ncr_protocol_value
+      case 478: // replace_client_name_value
         value.move< ElementPtr > (that.value);
         break;
 
-      case 149: // "boolean"
+      case 164: // "boolean"
         value.move< bool > (that.value);
         break;
 
-      case 148: // "floating point"
+      case 163: // "floating point"
         value.move< double > (that.value);
         break;
 
-      case 147: // "integer"
+      case 162: // "integer"
         value.move< int64_t > (that.value);
         break;
 
-      case 146: // "constant string"
+      case 161: // "constant string"
         value.move< std::string > (that.value);
         break;
 
@@ -295,30 +295,30 @@ namespace isc { namespace dhcp {
     state = that.state;
       switch (that.type_get ())
     {
-      case 164: // value
-      case 168: // map_value
-      case 206: // socket_type
-      case 209: // outbound_interface_value
-      case 219: // db_type
-      case 296: // hr_mode
-      case 439: // ncr_protocol_value
-      case 447: // replace_client_name_value
+      case 179: // value
+      case 183: // map_value
+      case 221: // socket_type
+      case 224: // outbound_interface_value
+      case 234: // db_type
+      case 327: // hr_mode
+      case 470: // ncr_protocol_value
+      case 478: // replace_client_name_value
         value.copy< ElementPtr > (that.value);
         break;
 
-      case 149: // "boolean"
+      case 164: // "boolean"
         value.copy< bool > (that.value);
         break;
 
-      case 148: // "floating point"
+      case 163: // "floating point"
         value.copy< double > (that.value);
         break;
 
-      case 147: // "integer"
+      case 162: // "integer"
         value.copy< int64_t > (that.value);
         break;
 
-      case 146: // "constant string"
+      case 161: // "constant string"
         value.copy< std::string > (that.value);
         break;
 
@@ -358,86 +358,86 @@ namespace isc { namespace dhcp {
         << yysym.location << ": ";
     switch (yytype)
     {
-            case 146: // "constant string"
+            case 161: // "constant string"
 
-#line 224 "dhcp4_parser.yy" // lalr1.cc:636
+#line 239 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< std::string > (); }
 #line 366 "dhcp4_parser.cc" // lalr1.cc:636
         break;
 
-      case 147: // "integer"
+      case 162: // "integer"
 
-#line 224 "dhcp4_parser.yy" // lalr1.cc:636
+#line 239 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< int64_t > (); }
 #line 373 "dhcp4_parser.cc" // lalr1.cc:636
         break;
 
-      case 148: // "floating point"
+      case 163: // "floating point"
 
-#line 224 "dhcp4_parser.yy" // lalr1.cc:636
+#line 239 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< double > (); }
 #line 380 "dhcp4_parser.cc" // lalr1.cc:636
         break;
 
-      case 149: // "boolean"
+      case 164: // "boolean"
 
-#line 224 "dhcp4_parser.yy" // lalr1.cc:636
+#line 239 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< bool > (); }
 #line 387 "dhcp4_parser.cc" // lalr1.cc:636
         break;
 
-      case 164: // value
+      case 179: // value
 
-#line 224 "dhcp4_parser.yy" // lalr1.cc:636
+#line 239 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 394 "dhcp4_parser.cc" // lalr1.cc:636
         break;
 
-      case 168: // map_value
+      case 183: // map_value
 
-#line 224 "dhcp4_parser.yy" // lalr1.cc:636
+#line 239 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 401 "dhcp4_parser.cc" // lalr1.cc:636
         break;
 
-      case 206: // socket_type
+      case 221: // socket_type
 
-#line 224 "dhcp4_parser.yy" // lalr1.cc:636
+#line 239 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 408 "dhcp4_parser.cc" // lalr1.cc:636
         break;
 
-      case 209: // outbound_interface_value
+      case 224: // outbound_interface_value
 
-#line 224 "dhcp4_parser.yy" // lalr1.cc:636
+#line 239 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 415 "dhcp4_parser.cc" // lalr1.cc:636
         break;
 
-      case 219: // db_type
+      case 234: // db_type
 
-#line 224 "dhcp4_parser.yy" // lalr1.cc:636
+#line 239 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 422 "dhcp4_parser.cc" // lalr1.cc:636
         break;
 
-      case 296: // hr_mode
+      case 327: // hr_mode
 
-#line 224 "dhcp4_parser.yy" // lalr1.cc:636
+#line 239 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 429 "dhcp4_parser.cc" // lalr1.cc:636
         break;
 
-      case 439: // ncr_protocol_value
+      case 470: // ncr_protocol_value
 
-#line 224 "dhcp4_parser.yy" // lalr1.cc:636
+#line 239 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 436 "dhcp4_parser.cc" // lalr1.cc:636
         break;
 
-      case 447: // replace_client_name_value
+      case 478: // replace_client_name_value
 
-#line 224 "dhcp4_parser.yy" // lalr1.cc:636
+#line 239 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 443 "dhcp4_parser.cc" // lalr1.cc:636
         break;
@@ -639,30 +639,30 @@ namespace isc { namespace dhcp {
          when using variants.  */
         switch (yyr1_[yyn])
     {
-      case 164: // value
-      case 168: // map_value
-      case 206: // socket_type
-      case 209: // outbound_interface_value
-      case 219: // db_type
-      case 296: // hr_mode
-      case 439: // ncr_protocol_value
-      case 447: // replace_client_name_value
+      case 179: // value
+      case 183: // map_value
+      case 221: // socket_type
+      case 224: // outbound_interface_value
+      case 234: // db_type
+      case 327: // hr_mode
+      case 470: // ncr_protocol_value
+      case 478: // replace_client_name_value
         yylhs.value.build< ElementPtr > ();
         break;
 
-      case 149: // "boolean"
+      case 164: // "boolean"
         yylhs.value.build< bool > ();
         break;
 
-      case 148: // "floating point"
+      case 163: // "floating point"
         yylhs.value.build< double > ();
         break;
 
-      case 147: // "integer"
+      case 162: // "integer"
         yylhs.value.build< int64_t > ();
         break;
 
-      case 146: // "constant string"
+      case 161: // "constant string"
         yylhs.value.build< std::string > ();
         break;
 
@@ -684,121 +684,121 @@ namespace isc { namespace dhcp {
           switch (yyn)
             {
   case 2:
-#line 233 "dhcp4_parser.yy" // lalr1.cc:859
+#line 248 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.NO_KEYWORD; }
 #line 690 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 4:
-#line 234 "dhcp4_parser.yy" // lalr1.cc:859
+#line 249 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.CONFIG; }
 #line 696 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 6:
-#line 235 "dhcp4_parser.yy" // lalr1.cc:859
+#line 250 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.DHCP4; }
 #line 702 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 8:
-#line 236 "dhcp4_parser.yy" // lalr1.cc:859
+#line 251 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.INTERFACES_CONFIG; }
 #line 708 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 10:
-#line 237 "dhcp4_parser.yy" // lalr1.cc:859
+#line 252 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.SUBNET4; }
 #line 714 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 12:
-#line 238 "dhcp4_parser.yy" // lalr1.cc:859
+#line 253 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.POOLS; }
 #line 720 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 14:
-#line 239 "dhcp4_parser.yy" // lalr1.cc:859
+#line 254 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.RESERVATIONS; }
 #line 726 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 16:
-#line 240 "dhcp4_parser.yy" // lalr1.cc:859
+#line 255 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.DHCP4; }
 #line 732 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 18:
-#line 241 "dhcp4_parser.yy" // lalr1.cc:859
+#line 256 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.OPTION_DEF; }
 #line 738 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 20:
-#line 242 "dhcp4_parser.yy" // lalr1.cc:859
+#line 257 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.OPTION_DATA; }
 #line 744 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 22:
-#line 243 "dhcp4_parser.yy" // lalr1.cc:859
+#line 258 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.HOOKS_LIBRARIES; }
 #line 750 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 24:
-#line 244 "dhcp4_parser.yy" // lalr1.cc:859
+#line 259 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.DHCP_DDNS; }
 #line 756 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 26:
-#line 252 "dhcp4_parser.yy" // lalr1.cc:859
+#line 267 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location))); }
 #line 762 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 27:
-#line 253 "dhcp4_parser.yy" // lalr1.cc:859
+#line 268 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as< double > (), ctx.loc2pos(yystack_[0].location))); }
 #line 768 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 28:
-#line 254 "dhcp4_parser.yy" // lalr1.cc:859
+#line 269 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location))); }
 #line 774 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 29:
-#line 255 "dhcp4_parser.yy" // lalr1.cc:859
+#line 270 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location))); }
 #line 780 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 30:
-#line 256 "dhcp4_parser.yy" // lalr1.cc:859
+#line 271 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
 #line 786 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 31:
-#line 257 "dhcp4_parser.yy" // lalr1.cc:859
+#line 272 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 792 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 32:
-#line 258 "dhcp4_parser.yy" // lalr1.cc:859
+#line 273 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 798 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 33:
-#line 261 "dhcp4_parser.yy" // lalr1.cc:859
+#line 276 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Push back the JSON value on the stack
     ctx.stack_.push_back(yystack_[0].value.as< ElementPtr > ());
@@ -807,7 +807,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 34:
-#line 266 "dhcp4_parser.yy" // lalr1.cc:859
+#line 281 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -818,7 +818,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 35:
-#line 271 "dhcp4_parser.yy" // lalr1.cc:859
+#line 286 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
@@ -828,13 +828,13 @@ namespace isc { namespace dhcp {
     break;
 
   case 36:
-#line 277 "dhcp4_parser.yy" // lalr1.cc:859
+#line 292 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 834 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 39:
-#line 284 "dhcp4_parser.yy" // lalr1.cc:859
+#line 299 "dhcp4_parser.yy" // lalr1.cc:859
     {
                   // map containing a single entry
                   ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
@@ -843,7 +843,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 40:
-#line 288 "dhcp4_parser.yy" // lalr1.cc:859
+#line 303 "dhcp4_parser.yy" // lalr1.cc:859
     {
                   // map consisting of a shorter map followed by
                   // comma and string:value
@@ -853,7 +853,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 41:
-#line 295 "dhcp4_parser.yy" // lalr1.cc:859
+#line 310 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
@@ -862,7 +862,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 42:
-#line 298 "dhcp4_parser.yy" // lalr1.cc:859
+#line 313 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // list parsing complete. Put any sanity checking here
 }
@@ -870,7 +870,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 45:
-#line 306 "dhcp4_parser.yy" // lalr1.cc:859
+#line 321 "dhcp4_parser.yy" // lalr1.cc:859
     {
                   // List consisting of a single element.
                   ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
@@ -879,7 +879,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 46:
-#line 310 "dhcp4_parser.yy" // lalr1.cc:859
+#line 325 "dhcp4_parser.yy" // lalr1.cc:859
     {
                   // List ending with , and a value.
                   ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
@@ -888,7 +888,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 47:
-#line 317 "dhcp4_parser.yy" // lalr1.cc:859
+#line 332 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // List parsing about to start
 }
@@ -896,7 +896,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 48:
-#line 319 "dhcp4_parser.yy" // lalr1.cc:859
+#line 334 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // list parsing complete. Put any sanity checking here
     //ctx.stack_.pop_back();
@@ -905,7 +905,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 51:
-#line 328 "dhcp4_parser.yy" // lalr1.cc:859
+#line 343 "dhcp4_parser.yy" // lalr1.cc:859
     {
                           ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
@@ -914,7 +914,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 52:
-#line 332 "dhcp4_parser.yy" // lalr1.cc:859
+#line 347 "dhcp4_parser.yy" // lalr1.cc:859
     {
                           ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
@@ -923,7 +923,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 53:
-#line 343 "dhcp4_parser.yy" // lalr1.cc:859
+#line 358 "dhcp4_parser.yy" // lalr1.cc:859
     {
     const std::string& where = ctx.contextName();
     const std::string& keyword = yystack_[1].value.as< std::string > ();
@@ -934,7 +934,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 54:
-#line 353 "dhcp4_parser.yy" // lalr1.cc:859
+#line 368 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -945,7 +945,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 55:
-#line 358 "dhcp4_parser.yy" // lalr1.cc:859
+#line 373 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
@@ -958,7 +958,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 64:
-#line 382 "dhcp4_parser.yy" // lalr1.cc:859
+#line 397 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -971,7 +971,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 65:
-#line 389 "dhcp4_parser.yy" // lalr1.cc:859
+#line 404 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // No global parameter is required
     ctx.stack_.pop_back();
@@ -981,7 +981,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 66:
-#line 397 "dhcp4_parser.yy" // lalr1.cc:859
+#line 412 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Parse the Dhcp4 map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -991,7 +991,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 67:
-#line 401 "dhcp4_parser.yy" // lalr1.cc:859
+#line 416 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // No global parameter is required
     // parsing completed
@@ -1000,7 +1000,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 94:
-#line 438 "dhcp4_parser.yy" // lalr1.cc:859
+#line 453 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("valid-lifetime", prf);
@@ -1009,7 +1009,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 95:
-#line 443 "dhcp4_parser.yy" // lalr1.cc:859
+#line 458 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("renew-timer", prf);
@@ -1018,7 +1018,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 96:
-#line 448 "dhcp4_parser.yy" // lalr1.cc:859
+#line 463 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rebind-timer", prf);
@@ -1027,7 +1027,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 97:
-#line 453 "dhcp4_parser.yy" // lalr1.cc:859
+#line 468 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr dpp(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("decline-probation-period", dpp);
@@ -1036,7 +1036,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 98:
-#line 458 "dhcp4_parser.yy" // lalr1.cc:859
+#line 473 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr echo(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("echo-client-id", echo);
@@ -1045,7 +1045,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 99:
-#line 463 "dhcp4_parser.yy" // lalr1.cc:859
+#line 478 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr match(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("match-client-id", match);
@@ -1054,7 +1054,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 100:
-#line 469 "dhcp4_parser.yy" // lalr1.cc:859
+#line 484 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces-config", i);
@@ -1065,7 +1065,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 101:
-#line 474 "dhcp4_parser.yy" // lalr1.cc:859
+#line 489 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // No interfaces config param is required
     ctx.stack_.pop_back();
@@ -1075,7 +1075,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 108:
-#line 490 "dhcp4_parser.yy" // lalr1.cc:859
+#line 505 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Parse the interfaces-config map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -1085,7 +1085,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 109:
-#line 494 "dhcp4_parser.yy" // lalr1.cc:859
+#line 509 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // No interfaces config param is required
     // parsing completed
@@ -1094,7 +1094,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 110:
-#line 499 "dhcp4_parser.yy" // lalr1.cc:859
+#line 514 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces", l);
@@ -1105,7 +1105,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 111:
-#line 504 "dhcp4_parser.yy" // lalr1.cc:859
+#line 519 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1114,7 +1114,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 112:
-#line 509 "dhcp4_parser.yy" // lalr1.cc:859
+#line 524 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.DHCP_SOCKET_TYPE);
 }
@@ -1122,7 +1122,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 113:
-#line 511 "dhcp4_parser.yy" // lalr1.cc:859
+#line 526 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("dhcp-socket-type", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
@@ -1131,19 +1131,19 @@ namespace isc { namespace dhcp {
     break;
 
   case 114:
-#line 516 "dhcp4_parser.yy" // lalr1.cc:859
+#line 531 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("raw", ctx.loc2pos(yystack_[0].location))); }
 #line 1137 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 115:
-#line 517 "dhcp4_parser.yy" // lalr1.cc:859
+#line 532 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("udp", ctx.loc2pos(yystack_[0].location))); }
 #line 1143 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 116:
-#line 520 "dhcp4_parser.yy" // lalr1.cc:859
+#line 535 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.OUTBOUND_INTERFACE);
 }
@@ -1151,7 +1151,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 117:
-#line 522 "dhcp4_parser.yy" // lalr1.cc:859
+#line 537 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("outbound-interface", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
@@ -1160,7 +1160,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 118:
-#line 527 "dhcp4_parser.yy" // lalr1.cc:859
+#line 542 "dhcp4_parser.yy" // lalr1.cc:859
     {
     yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("same-as-inbound", ctx.loc2pos(yystack_[0].location)));
 }
@@ -1168,7 +1168,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 119:
-#line 529 "dhcp4_parser.yy" // lalr1.cc:859
+#line 544 "dhcp4_parser.yy" // lalr1.cc:859
     {
     yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("use-routing", ctx.loc2pos(yystack_[0].location)));
     }
@@ -1176,7 +1176,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 120:
-#line 533 "dhcp4_parser.yy" // lalr1.cc:859
+#line 548 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("re-detect", b);
@@ -1185,7 +1185,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 121:
-#line 539 "dhcp4_parser.yy" // lalr1.cc:859
+#line 554 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lease-database", i);
@@ -1196,7 +1196,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 122:
-#line 544 "dhcp4_parser.yy" // lalr1.cc:859
+#line 559 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
@@ -1207,7 +1207,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 123:
-#line 551 "dhcp4_parser.yy" // lalr1.cc:859
+#line 566 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hosts-database", i);
@@ -1218,7 +1218,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 124:
-#line 556 "dhcp4_parser.yy" // lalr1.cc:859
+#line 571 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
@@ -1228,16 +1228,16 @@ namespace isc { namespace dhcp {
 #line 1229 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 140:
-#line 582 "dhcp4_parser.yy" // lalr1.cc:859
+  case 155:
+#line 612 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.DATABASE_TYPE);
 }
 #line 1237 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 141:
-#line 584 "dhcp4_parser.yy" // lalr1.cc:859
+  case 156:
+#line 614 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("type", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
@@ -1245,40 +1245,40 @@ namespace isc { namespace dhcp {
 #line 1246 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 142:
-#line 589 "dhcp4_parser.yy" // lalr1.cc:859
+  case 157:
+#line 619 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("memfile", ctx.loc2pos(yystack_[0].location))); }
 #line 1252 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 143:
-#line 590 "dhcp4_parser.yy" // lalr1.cc:859
+  case 158:
+#line 620 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("mysql", ctx.loc2pos(yystack_[0].location))); }
 #line 1258 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 144:
-#line 591 "dhcp4_parser.yy" // lalr1.cc:859
+  case 159:
+#line 621 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("postgresql", ctx.loc2pos(yystack_[0].location))); }
 #line 1264 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 145:
-#line 592 "dhcp4_parser.yy" // lalr1.cc:859
+  case 160:
+#line 622 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("cql", ctx.loc2pos(yystack_[0].location))); }
 #line 1270 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 146:
-#line 595 "dhcp4_parser.yy" // lalr1.cc:859
+  case 161:
+#line 625 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1278 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 147:
-#line 597 "dhcp4_parser.yy" // lalr1.cc:859
+  case 162:
+#line 627 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr user(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("user", user);
@@ -1287,16 +1287,16 @@ namespace isc { namespace dhcp {
 #line 1288 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 148:
-#line 603 "dhcp4_parser.yy" // lalr1.cc:859
+  case 163:
+#line 633 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1296 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 149:
-#line 605 "dhcp4_parser.yy" // lalr1.cc:859
+  case 164:
+#line 635 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr pwd(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("password", pwd);
@@ -1305,16 +1305,16 @@ namespace isc { namespace dhcp {
 #line 1306 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 150:
-#line 611 "dhcp4_parser.yy" // lalr1.cc:859
+  case 165:
+#line 641 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1314 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 151:
-#line 613 "dhcp4_parser.yy" // lalr1.cc:859
+  case 166:
+#line 643 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr h(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host", h);
@@ -1323,8 +1323,8 @@ namespace isc { namespace dhcp {
 #line 1324 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 152:
-#line 619 "dhcp4_parser.yy" // lalr1.cc:859
+  case 167:
+#line 649 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr p(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("port", p);
@@ -1332,16 +1332,16 @@ namespace isc { namespace dhcp {
 #line 1333 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 153:
-#line 624 "dhcp4_parser.yy" // lalr1.cc:859
+  case 168:
+#line 654 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1341 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 154:
-#line 626 "dhcp4_parser.yy" // lalr1.cc:859
+  case 169:
+#line 656 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
@@ -1350,8 +1350,8 @@ namespace isc { namespace dhcp {
 #line 1351 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 155:
-#line 632 "dhcp4_parser.yy" // lalr1.cc:859
+  case 170:
+#line 662 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("persist", n);
@@ -1359,8 +1359,8 @@ namespace isc { namespace dhcp {
 #line 1360 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 156:
-#line 637 "dhcp4_parser.yy" // lalr1.cc:859
+  case 171:
+#line 667 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lfc-interval", n);
@@ -1368,8 +1368,8 @@ namespace isc { namespace dhcp {
 #line 1369 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 157:
-#line 642 "dhcp4_parser.yy" // lalr1.cc:859
+  case 172:
+#line 672 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("readonly", n);
@@ -1377,8 +1377,8 @@ namespace isc { namespace dhcp {
 #line 1378 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 158:
-#line 647 "dhcp4_parser.yy" // lalr1.cc:859
+  case 173:
+#line 677 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("connect-timeout", n);
@@ -1386,16 +1386,16 @@ namespace isc { namespace dhcp {
 #line 1387 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 159:
-#line 652 "dhcp4_parser.yy" // lalr1.cc:859
+  case 174:
+#line 682 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1395 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 160:
-#line 654 "dhcp4_parser.yy" // lalr1.cc:859
+  case 175:
+#line 684 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr cp(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("contact-points", cp);
@@ -1404,16 +1404,16 @@ namespace isc { namespace dhcp {
 #line 1405 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 161:
-#line 660 "dhcp4_parser.yy" // lalr1.cc:859
+  case 176:
+#line 690 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1413 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 162:
-#line 662 "dhcp4_parser.yy" // lalr1.cc:859
+  case 177:
+#line 692 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr ks(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("keyspace", ks);
@@ -1422,273 +1422,417 @@ namespace isc { namespace dhcp {
 #line 1423 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 163:
-#line 669 "dhcp4_parser.yy" // lalr1.cc:859
+  case 178:
+#line 698 "dhcp4_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("packed", n);
+}
+#line 1432 "dhcp4_parser.cc" // lalr1.cc:859
+    break;
+
+  case 179:
+#line 703 "dhcp4_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("group-commit", n);
+}
+#line 1441 "dhcp4_parser.cc" // lalr1.cc:859
+    break;
+
+  case 180:
+#line 708 "dhcp4_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("group-commit-sync", n);
+}
+#line 1450 "dhcp4_parser.cc" // lalr1.cc:859
+    break;
+
+  case 181:
+#line 713 "dhcp4_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("group-commit-max-batch", n);
+}
+#line 1459 "dhcp4_parser.cc" // lalr1.cc:859
+    break;
+
+  case 182:
+#line 718 "dhcp4_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("group-commit-max-latency", n);
+}
+#line 1468 "dhcp4_parser.cc" // lalr1.cc:859
+    break;
+
+  case 183:
+#line 723 "dhcp4_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("load-threads", n);
+}
+#line 1477 "dhcp4_parser.cc" // lalr1.cc:859
+    break;
+
+  case 184:
+#line 728 "dhcp4_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("lfc-in-process", n);
+}
+#line 1486 "dhcp4_parser.cc" // lalr1.cc:859
+    break;
+
+  case 185:
+#line 733 "dhcp4_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("lfc-batch-size", n);
+}
+#line 1495 "dhcp4_parser.cc" // lalr1.cc:859
+    break;
+
+  case 186:
+#line 738 "dhcp4_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("lfc-batch-interval", n);
+}
+#line 1504 "dhcp4_parser.cc" // lalr1.cc:859
+    break;
+
+  case 187:
+#line 743 "dhcp4_parser.yy" // lalr1.cc:859
+    {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 1512 "dhcp4_parser.cc" // lalr1.cc:859
+    break;
+
+  case 188:
+#line 745 "dhcp4_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("lfc-snapshot-format", s);
+    ctx.leave();
+}
+#line 1522 "dhcp4_parser.cc" // lalr1.cc:859
+    break;
+
+  case 189:
+#line 751 "dhcp4_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("cache-size", n);
+}
+#line 1531 "dhcp4_parser.cc" // lalr1.cc:859
+    break;
+
+  case 190:
+#line 756 "dhcp4_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("cache-ttl", n);
+}
+#line 1540 "dhcp4_parser.cc" // lalr1.cc:859
+    break;
+
+  case 191:
+#line 761 "dhcp4_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("cache-negative-ttl", n);
+}
+#line 1549 "dhcp4_parser.cc" // lalr1.cc:859
+    break;
+
+  case 192:
+#line 766 "dhcp4_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("connection-pool-size", n);
+}
+#line 1558 "dhcp4_parser.cc" // lalr1.cc:859
+    break;
+
+  case 193:
+#line 771 "dhcp4_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("reconnect-wait-time", n);
+}
+#line 1567 "dhcp4_parser.cc" // lalr1.cc:859
+    break;
+
+  case 194:
+#line 777 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host-reservation-identifiers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOST_RESERVATION_IDENTIFIERS);
 }
-#line 1434 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1578 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 164:
-#line 674 "dhcp4_parser.yy" // lalr1.cc:859
+  case 195:
+#line 782 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1443 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1587 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 172:
-#line 690 "dhcp4_parser.yy" // lalr1.cc:859
+  case 203:
+#line 798 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr duid(new StringElement("duid", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(duid);
 }
-#line 1452 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1596 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 173:
-#line 695 "dhcp4_parser.yy" // lalr1.cc:859
+  case 204:
+#line 803 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr hwaddr(new StringElement("hw-address", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(hwaddr);
 }
-#line 1461 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1605 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 174:
-#line 700 "dhcp4_parser.yy" // lalr1.cc:859
+  case 205:
+#line 808 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr circuit(new StringElement("circuit-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(circuit);
 }
-#line 1470 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1614 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 175:
-#line 705 "dhcp4_parser.yy" // lalr1.cc:859
+  case 206:
+#line 813 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr client(new StringElement("client-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(client);
 }
-#line 1479 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1623 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 176:
-#line 710 "dhcp4_parser.yy" // lalr1.cc:859
+  case 207:
+#line 818 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr flex_id(new StringElement("flex-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(flex_id);
 }
-#line 1488 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1632 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 177:
-#line 715 "dhcp4_parser.yy" // lalr1.cc:859
+  case 208:
+#line 823 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hooks-libraries", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOOKS_LIBRARIES);
 }
-#line 1499 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1643 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 178:
-#line 720 "dhcp4_parser.yy" // lalr1.cc:859
+  case 209:
+#line 828 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1508 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1652 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 183:
-#line 733 "dhcp4_parser.yy" // lalr1.cc:859
+  case 214:
+#line 841 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1518 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1662 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 184:
-#line 737 "dhcp4_parser.yy" // lalr1.cc:859
+  case 215:
+#line 845 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The library hooks parameter is required
     ctx.require("library", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 1528 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1672 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 185:
-#line 743 "dhcp4_parser.yy" // lalr1.cc:859
+  case 216:
+#line 851 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Parse the hooks-libraries list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1538 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1682 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 186:
-#line 747 "dhcp4_parser.yy" // lalr1.cc:859
+  case 217:
+#line 855 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The library hooks parameter is required
     ctx.require("library", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 1548 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1692 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 192:
-#line 762 "dhcp4_parser.yy" // lalr1.cc:859
+  case 223:
+#line 870 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1556 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1700 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 193:
-#line 764 "dhcp4_parser.yy" // lalr1.cc:859
+  case 224:
+#line 872 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr lib(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("library", lib);
     ctx.leave();
 }
-#line 1566 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1710 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 194:
-#line 770 "dhcp4_parser.yy" // lalr1.cc:859
+  case 225:
+#line 878 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1574 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1718 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 195:
-#line 772 "dhcp4_parser.yy" // lalr1.cc:859
+  case 226:
+#line 880 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("parameters", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 1583 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1727 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 196:
-#line 778 "dhcp4_parser.yy" // lalr1.cc:859
+  case 227:
+#line 886 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("expired-leases-processing", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.EXPIRED_LEASES_PROCESSING);
 }
-#line 1594 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1738 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 197:
-#line 783 "dhcp4_parser.yy" // lalr1.cc:859
+  case 228:
+#line 891 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // No expired lease parameter is required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1604 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1748 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 206:
-#line 801 "dhcp4_parser.yy" // lalr1.cc:859
+  case 237:
+#line 909 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reclaim-timer-wait-time", value);
 }
-#line 1613 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1757 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 207:
-#line 806 "dhcp4_parser.yy" // lalr1.cc:859
+  case 238:
+#line 914 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush-reclaimed-timer-wait-time", value);
 }
-#line 1622 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1766 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 208:
-#line 811 "dhcp4_parser.yy" // lalr1.cc:859
+  case 239:
+#line 919 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hold-reclaimed-time", value);
 }
-#line 1631 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1775 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 209:
-#line 816 "dhcp4_parser.yy" // lalr1.cc:859
+  case 240:
+#line 924 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-leases", value);
 }
-#line 1640 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1784 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 210:
-#line 821 "dhcp4_parser.yy" // lalr1.cc:859
+  case 241:
+#line 929 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-time", value);
 }
-#line 1649 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1793 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 211:
-#line 826 "dhcp4_parser.yy" // lalr1.cc:859
+  case 242:
+#line 934 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("unwarned-reclaim-cycles", value);
 }
-#line 1658 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1802 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 212:
-#line 834 "dhcp4_parser.yy" // lalr1.cc:859
+  case 243:
+#line 942 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet4", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.SUBNET4);
 }
-#line 1669 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1813 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 213:
-#line 839 "dhcp4_parser.yy" // lalr1.cc:859
+  case 244:
+#line 947 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1678 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1822 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 218:
-#line 859 "dhcp4_parser.yy" // lalr1.cc:859
+  case 249:
+#line 967 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1688 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1832 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 219:
-#line 863 "dhcp4_parser.yy" // lalr1.cc:859
+  case 250:
+#line 971 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Once we reached this place, the subnet parsing is now complete.
     // If we want to, we can implement default values here.
@@ -1710,295 +1854,295 @@ namespace isc { namespace dhcp {
     ctx.require("subnet", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 1714 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1858 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 220:
-#line 885 "dhcp4_parser.yy" // lalr1.cc:859
+  case 251:
+#line 993 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Parse the subnet4 list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1724 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1868 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 221:
-#line 889 "dhcp4_parser.yy" // lalr1.cc:859
+  case 252:
+#line 997 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The subnet subnet4 parameter is required
     ctx.require("subnet", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 1734 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1878 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 247:
-#line 926 "dhcp4_parser.yy" // lalr1.cc:859
+  case 278:
+#line 1034 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1742 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1886 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 248:
-#line 928 "dhcp4_parser.yy" // lalr1.cc:859
+  case 279:
+#line 1036 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr subnet(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet", subnet);
     ctx.leave();
 }
-#line 1752 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1896 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 249:
-#line 934 "dhcp4_parser.yy" // lalr1.cc:859
+  case 280:
+#line 1042 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1760 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1904 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 250:
-#line 936 "dhcp4_parser.yy" // lalr1.cc:859
+  case 281:
+#line 1044 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("4o6-interface", iface);
     ctx.leave();
 }
-#line 1770 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1914 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 251:
-#line 942 "dhcp4_parser.yy" // lalr1.cc:859
+  case 282:
+#line 1050 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1778 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1922 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 252:
-#line 944 "dhcp4_parser.yy" // lalr1.cc:859
+  case 283:
+#line 1052 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("4o6-interface-id", iface);
     ctx.leave();
 }
-#line 1788 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1932 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 253:
-#line 950 "dhcp4_parser.yy" // lalr1.cc:859
+  case 284:
+#line 1058 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1796 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1940 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 254:
-#line 952 "dhcp4_parser.yy" // lalr1.cc:859
+  case 285:
+#line 1060 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("4o6-subnet", iface);
     ctx.leave();
 }
-#line 1806 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1950 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 255:
-#line 958 "dhcp4_parser.yy" // lalr1.cc:859
+  case 286:
+#line 1066 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1814 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1958 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 256:
-#line 960 "dhcp4_parser.yy" // lalr1.cc:859
+  case 287:
+#line 1068 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface", iface);
     ctx.leave();
 }
-#line 1824 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1968 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 257:
-#line 966 "dhcp4_parser.yy" // lalr1.cc:859
+  case 288:
+#line 1074 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1832 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1976 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 258:
-#line 968 "dhcp4_parser.yy" // lalr1.cc:859
+  case 289:
+#line 1076 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface-id", iface);
     ctx.leave();
 }
-#line 1842 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1986 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 259:
-#line 974 "dhcp4_parser.yy" // lalr1.cc:859
+  case 290:
+#line 1082 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.CLIENT_CLASS);
 }
-#line 1850 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1994 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 260:
-#line 976 "dhcp4_parser.yy" // lalr1.cc:859
+  case 291:
+#line 1084 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr cls(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-class", cls);
     ctx.leave();
 }
-#line 1860 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2004 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 261:
-#line 982 "dhcp4_parser.yy" // lalr1.cc:859
+  case 292:
+#line 1090 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.RESERVATION_MODE);
 }
-#line 1868 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2012 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 262:
-#line 984 "dhcp4_parser.yy" // lalr1.cc:859
+  case 293:
+#line 1092 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("reservation-mode", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 1877 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2021 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 263:
-#line 989 "dhcp4_parser.yy" // lalr1.cc:859
+  case 294:
+#line 1097 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("disabled", ctx.loc2pos(yystack_[0].location))); }
-#line 1883 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2027 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 264:
-#line 990 "dhcp4_parser.yy" // lalr1.cc:859
+  case 295:
+#line 1098 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("out-of-pool", ctx.loc2pos(yystack_[0].location))); }
-#line 1889 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2033 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 265:
-#line 991 "dhcp4_parser.yy" // lalr1.cc:859
+  case 296:
+#line 1099 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("all", ctx.loc2pos(yystack_[0].location))); }
-#line 1895 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2039 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 266:
-#line 994 "dhcp4_parser.yy" // lalr1.cc:859
+  case 297:
+#line 1102 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr id(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("id", id);
 }
-#line 1904 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2048 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 267:
-#line 999 "dhcp4_parser.yy" // lalr1.cc:859
+  case 298:
+#line 1107 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr rc(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rapid-commit", rc);
 }
-#line 1913 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2057 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 268:
-#line 1006 "dhcp4_parser.yy" // lalr1.cc:859
+  case 299:
+#line 1114 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("shared-networks", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.SHARED_NETWORK);
 }
-#line 1924 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2068 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 269:
-#line 1011 "dhcp4_parser.yy" // lalr1.cc:859
+  case 300:
+#line 1119 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1933 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2077 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 274:
-#line 1026 "dhcp4_parser.yy" // lalr1.cc:859
+  case 305:
+#line 1134 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1943 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2087 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 275:
-#line 1030 "dhcp4_parser.yy" // lalr1.cc:859
+  case 306:
+#line 1138 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
 }
-#line 1951 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2095 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 293:
-#line 1059 "dhcp4_parser.yy" // lalr1.cc:859
+  case 324:
+#line 1167 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-def", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DEF);
 }
-#line 1962 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2106 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 294:
-#line 1064 "dhcp4_parser.yy" // lalr1.cc:859
+  case 325:
+#line 1172 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1971 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2115 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 295:
-#line 1072 "dhcp4_parser.yy" // lalr1.cc:859
+  case 326:
+#line 1180 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1980 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2124 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 296:
-#line 1075 "dhcp4_parser.yy" // lalr1.cc:859
+  case 327:
+#line 1183 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // parsing completed
 }
-#line 1988 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2132 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 301:
-#line 1091 "dhcp4_parser.yy" // lalr1.cc:859
+  case 332:
+#line 1199 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1998 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2142 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 302:
-#line 1095 "dhcp4_parser.yy" // lalr1.cc:859
+  case 333:
+#line 1203 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The name, code and type option def parameters are required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -2006,21 +2150,21 @@ namespace isc { namespace dhcp {
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2010 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2154 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 303:
-#line 1106 "dhcp4_parser.yy" // lalr1.cc:859
+  case 334:
+#line 1214 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Parse the option-def list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2020 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2164 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 304:
-#line 1110 "dhcp4_parser.yy" // lalr1.cc:859
+  case 335:
+#line 1218 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The name, code and type option def parameters are required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -2028,1210 +2172,1210 @@ namespace isc { namespace dhcp {
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2032 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2176 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 318:
-#line 1140 "dhcp4_parser.yy" // lalr1.cc:859
+  case 349:
+#line 1248 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr code(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("code", code);
 }
-#line 2041 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2185 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 320:
-#line 1147 "dhcp4_parser.yy" // lalr1.cc:859
+  case 351:
+#line 1255 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2049 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2193 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 321:
-#line 1149 "dhcp4_parser.yy" // lalr1.cc:859
+  case 352:
+#line 1257 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("type", prf);
     ctx.leave();
 }
-#line 2059 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2203 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 322:
-#line 1155 "dhcp4_parser.yy" // lalr1.cc:859
+  case 353:
+#line 1263 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2067 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2211 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 323:
-#line 1157 "dhcp4_parser.yy" // lalr1.cc:859
+  case 354:
+#line 1265 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr rtypes(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("record-types", rtypes);
     ctx.leave();
 }
-#line 2077 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2221 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 324:
-#line 1163 "dhcp4_parser.yy" // lalr1.cc:859
+  case 355:
+#line 1271 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2085 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2229 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 325:
-#line 1165 "dhcp4_parser.yy" // lalr1.cc:859
+  case 356:
+#line 1273 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr space(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("space", space);
     ctx.leave();
 }
-#line 2095 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2239 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 327:
-#line 1173 "dhcp4_parser.yy" // lalr1.cc:859
+  case 358:
+#line 1281 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2103 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2247 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 328:
-#line 1175 "dhcp4_parser.yy" // lalr1.cc:859
+  case 359:
+#line 1283 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr encap(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("encapsulate", encap);
     ctx.leave();
 }
-#line 2113 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2257 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 329:
-#line 1181 "dhcp4_parser.yy" // lalr1.cc:859
+  case 360:
+#line 1289 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr array(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("array", array);
 }
-#line 2122 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2266 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 330:
-#line 1190 "dhcp4_parser.yy" // lalr1.cc:859
+  case 361:
+#line 1298 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-data", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DATA);
 }
-#line 2133 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2277 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 331:
-#line 1195 "dhcp4_parser.yy" // lalr1.cc:859
+  case 362:
+#line 1303 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2142 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2286 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 336:
-#line 1214 "dhcp4_parser.yy" // lalr1.cc:859
+  case 367:
+#line 1322 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2152 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2296 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 337:
-#line 1218 "dhcp4_parser.yy" // lalr1.cc:859
+  case 368:
+#line 1326 "dhcp4_parser.yy" // lalr1.cc:859
     {
     /// @todo: the code or name parameters are required.
     ctx.stack_.pop_back();
 }
-#line 2161 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2305 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 338:
-#line 1226 "dhcp4_parser.yy" // lalr1.cc:859
+  case 369:
+#line 1334 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Parse the option-data list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2171 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2315 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 339:
-#line 1230 "dhcp4_parser.yy" // lalr1.cc:859
+  case 370:
+#line 1338 "dhcp4_parser.yy" // lalr1.cc:859
     {
     /// @todo: the code or name parameters are required.
     // parsing completed
 }
-#line 2180 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2324 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 352:
-#line 1261 "dhcp4_parser.yy" // lalr1.cc:859
+  case 383:
+#line 1369 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2188 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2332 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 353:
-#line 1263 "dhcp4_parser.yy" // lalr1.cc:859
+  case 384:
+#line 1371 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr data(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("data", data);
     ctx.leave();
 }
-#line 2198 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2342 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 356:
-#line 1273 "dhcp4_parser.yy" // lalr1.cc:859
+  case 387:
+#line 1381 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr space(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("csv-format", space);
 }
-#line 2207 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2351 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 357:
-#line 1278 "dhcp4_parser.yy" // lalr1.cc:859
+  case 388:
+#line 1386 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr persist(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("always-send", persist);
 }
-#line 2216 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2360 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 358:
-#line 1286 "dhcp4_parser.yy" // lalr1.cc:859
+  case 389:
+#line 1394 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pools", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.POOLS);
 }
-#line 2227 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2371 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 359:
-#line 1291 "dhcp4_parser.yy" // lalr1.cc:859
+  case 390:
+#line 1399 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2236 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2380 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 364:
-#line 1306 "dhcp4_parser.yy" // lalr1.cc:859
+  case 395:
+#line 1414 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2246 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2390 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 365:
-#line 1310 "dhcp4_parser.yy" // lalr1.cc:859
+  case 396:
+#line 1418 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The pool parameter is required.
     ctx.require("pool", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2256 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2400 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 366:
-#line 1316 "dhcp4_parser.yy" // lalr1.cc:859
+  case 397:
+#line 1424 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Parse the pool list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2266 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2410 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 367:
-#line 1320 "dhcp4_parser.yy" // lalr1.cc:859
+  case 398:
+#line 1428 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The pool parameter is required.
     ctx.require("pool", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2276 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2420 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 374:
-#line 1336 "dhcp4_parser.yy" // lalr1.cc:859
+  case 405:
+#line 1444 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2284 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2428 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 375:
-#line 1338 "dhcp4_parser.yy" // lalr1.cc:859
+  case 406:
+#line 1446 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr pool(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pool", pool);
     ctx.leave();
 }
-#line 2294 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2438 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 376:
-#line 1344 "dhcp4_parser.yy" // lalr1.cc:859
+  case 407:
+#line 1452 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2302 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2446 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 377:
-#line 1346 "dhcp4_parser.yy" // lalr1.cc:859
+  case 408:
+#line 1454 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("user-context", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 2311 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2455 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 378:
-#line 1354 "dhcp4_parser.yy" // lalr1.cc:859
+  case 409:
+#line 1462 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reservations", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.RESERVATIONS);
 }
-#line 2322 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2466 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 379:
-#line 1359 "dhcp4_parser.yy" // lalr1.cc:859
+  case 410:
+#line 1467 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2331 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2475 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 384:
-#line 1372 "dhcp4_parser.yy" // lalr1.cc:859
+  case 415:
+#line 1480 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2341 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2485 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 385:
-#line 1376 "dhcp4_parser.yy" // lalr1.cc:859
+  case 416:
+#line 1484 "dhcp4_parser.yy" // lalr1.cc:859
     {
     /// @todo: an identifier parameter is required.
     ctx.stack_.pop_back();
 }
-#line 2350 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2494 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 386:
-#line 1381 "dhcp4_parser.yy" // lalr1.cc:859
+  case 417:
+#line 1489 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Parse the reservations list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2360 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2504 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 387:
-#line 1385 "dhcp4_parser.yy" // lalr1.cc:859
+  case 418:
+#line 1493 "dhcp4_parser.yy" // lalr1.cc:859
     {
     /// @todo: an identifier parameter is required.
     // parsing completed
 }
-#line 2369 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2513 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 405:
-#line 1414 "dhcp4_parser.yy" // lalr1.cc:859
+  case 436:
+#line 1522 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2377 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2521 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 406:
-#line 1416 "dhcp4_parser.yy" // lalr1.cc:859
+  case 437:
+#line 1524 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr next_server(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("next-server", next_server);
     ctx.leave();
 }
-#line 2387 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2531 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 407:
-#line 1422 "dhcp4_parser.yy" // lalr1.cc:859
+  case 438:
+#line 1530 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2395 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2539 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 408:
-#line 1424 "dhcp4_parser.yy" // lalr1.cc:859
+  case 439:
+#line 1532 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr srv(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-hostname", srv);
     ctx.leave();
 }
-#line 2405 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2549 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 409:
-#line 1430 "dhcp4_parser.yy" // lalr1.cc:859
+  case 440:
+#line 1538 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2413 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2557 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 410:
-#line 1432 "dhcp4_parser.yy" // lalr1.cc:859
+  case 441:
+#line 1540 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr bootfile(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("boot-file-name", bootfile);
     ctx.leave();
 }
-#line 2423 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2567 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 411:
-#line 1438 "dhcp4_parser.yy" // lalr1.cc:859
+  case 442:
+#line 1546 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2431 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2575 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 412:
-#line 1440 "dhcp4_parser.yy" // lalr1.cc:859
+  case 443:
+#line 1548 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr addr(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", addr);
     ctx.leave();
 }
-#line 2441 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2585 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 413:
-#line 1446 "dhcp4_parser.yy" // lalr1.cc:859
+  case 444:
+#line 1554 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2449 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2593 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 414:
-#line 1448 "dhcp4_parser.yy" // lalr1.cc:859
+  case 445:
+#line 1556 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr d(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("duid", d);
     ctx.leave();
 }
-#line 2459 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2603 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 415:
-#line 1454 "dhcp4_parser.yy" // lalr1.cc:859
+  case 446:
+#line 1562 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2467 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2611 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 416:
-#line 1456 "dhcp4_parser.yy" // lalr1.cc:859
+  case 447:
+#line 1564 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hw-address", hw);
     ctx.leave();
 }
-#line 2477 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2621 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 417:
-#line 1462 "dhcp4_parser.yy" // lalr1.cc:859
+  case 448:
+#line 1570 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2485 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2629 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 418:
-#line 1464 "dhcp4_parser.yy" // lalr1.cc:859
+  case 449:
+#line 1572 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-id", hw);
     ctx.leave();
 }
-#line 2495 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2639 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 419:
-#line 1470 "dhcp4_parser.yy" // lalr1.cc:859
+  case 450:
+#line 1578 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2503 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2647 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 420:
-#line 1472 "dhcp4_parser.yy" // lalr1.cc:859
+  case 451:
+#line 1580 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("circuit-id", hw);
     ctx.leave();
 }
-#line 2513 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2657 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 421:
-#line 1478 "dhcp4_parser.yy" // lalr1.cc:859
+  case 452:
+#line 1586 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2521 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2665 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 422:
-#line 1480 "dhcp4_parser.yy" // lalr1.cc:859
+  case 453:
+#line 1588 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flex-id", hw);
     ctx.leave();
 }
-#line 2531 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2675 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 423:
-#line 1486 "dhcp4_parser.yy" // lalr1.cc:859
+  case 454:
+#line 1594 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2539 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2683 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 424:
-#line 1488 "dhcp4_parser.yy" // lalr1.cc:859
+  case 455:
+#line 1596 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr host(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname", host);
     ctx.leave();
 }
-#line 2549 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2693 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 425:
-#line 1494 "dhcp4_parser.yy" // lalr1.cc:859
+  case 456:
+#line 1602 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr c(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", c);
     ctx.stack_.push_back(c);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2560 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2704 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 426:
-#line 1499 "dhcp4_parser.yy" // lalr1.cc:859
+  case 457:
+#line 1607 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2569 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2713 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 427:
-#line 1507 "dhcp4_parser.yy" // lalr1.cc:859
+  case 458:
+#line 1615 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("relay", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.RELAY);
 }
-#line 2580 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2724 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 428:
-#line 1512 "dhcp4_parser.yy" // lalr1.cc:859
+  case 459:
+#line 1620 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2589 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2733 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 429:
-#line 1517 "dhcp4_parser.yy" // lalr1.cc:859
+  case 460:
+#line 1625 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2597 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2741 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 430:
-#line 1519 "dhcp4_parser.yy" // lalr1.cc:859
+  case 461:
+#line 1627 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr ip(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", ip);
     ctx.leave();
 }
-#line 2607 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2751 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 431:
-#line 1528 "dhcp4_parser.yy" // lalr1.cc:859
+  case 462:
+#line 1636 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.CLIENT_CLASSES);
 }
-#line 2618 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2762 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 432:
-#line 1533 "dhcp4_parser.yy" // lalr1.cc:859
+  case 463:
+#line 1641 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2627 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2771 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 435:
-#line 1542 "dhcp4_parser.yy" // lalr1.cc:859
+  case 466:
+#line 1650 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2637 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2781 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 436:
-#line 1546 "dhcp4_parser.yy" // lalr1.cc:859
+  case 467:
+#line 1654 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The name client class parameter is required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2647 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2791 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 450:
-#line 1572 "dhcp4_parser.yy" // lalr1.cc:859
+  case 481:
+#line 1680 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2655 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2799 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 451:
-#line 1574 "dhcp4_parser.yy" // lalr1.cc:859
+  case 482:
+#line 1682 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr test(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("test", test);
     ctx.leave();
 }
-#line 2665 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2809 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 452:
-#line 1584 "dhcp4_parser.yy" // lalr1.cc:859
+  case 483:
+#line 1692 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr time(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp4o6-port", time);
 }
-#line 2674 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2818 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 453:
-#line 1591 "dhcp4_parser.yy" // lalr1.cc:859
+  case 484:
+#line 1699 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("control-socket", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.CONTROL_SOCKET);
 }
-#line 2685 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2829 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 454:
-#line 1596 "dhcp4_parser.yy" // lalr1.cc:859
+  case 485:
+#line 1704 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2694 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2838 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 459:
-#line 1609 "dhcp4_parser.yy" // lalr1.cc:859
+  case 490:
+#line 1717 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2702 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2846 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 460:
-#line 1611 "dhcp4_parser.yy" // lalr1.cc:859
+  case 491:
+#line 1719 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr stype(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-type", stype);
     ctx.leave();
 }
-#line 2712 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2856 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 461:
-#line 1617 "dhcp4_parser.yy" // lalr1.cc:859
+  case 492:
+#line 1725 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2720 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2864 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 462:
-#line 1619 "dhcp4_parser.yy" // lalr1.cc:859
+  case 493:
+#line 1727 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-name", name);
     ctx.leave();
 }
-#line 2730 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2874 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 463:
-#line 1627 "dhcp4_parser.yy" // lalr1.cc:859
+  case 494:
+#line 1735 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp-ddns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCP_DDNS);
 }
-#line 2741 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2885 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 464:
-#line 1632 "dhcp4_parser.yy" // lalr1.cc:859
+  case 495:
+#line 1740 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The enable updates DHCP DDNS parameter is required.
     ctx.require("enable-updates", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2752 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2896 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 465:
-#line 1639 "dhcp4_parser.yy" // lalr1.cc:859
+  case 496:
+#line 1747 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Parse the dhcp-ddns map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2762 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2906 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 466:
-#line 1643 "dhcp4_parser.yy" // lalr1.cc:859
+  case 497:
+#line 1751 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The enable updates DHCP DDNS parameter is required.
     ctx.require("enable-updates", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2772 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2916 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 484:
-#line 1670 "dhcp4_parser.yy" // lalr1.cc:859
+  case 515:
+#line 1778 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enable-updates", b);
 }
-#line 2781 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2925 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 485:
-#line 1675 "dhcp4_parser.yy" // lalr1.cc:859
+  case 516:
+#line 1783 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2789 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2933 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 486:
-#line 1677 "dhcp4_parser.yy" // lalr1.cc:859
+  case 517:
+#line 1785 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("qualifying-suffix", s);
     ctx.leave();
 }
-#line 2799 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2943 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 487:
-#line 1683 "dhcp4_parser.yy" // lalr1.cc:859
+  case 518:
+#line 1791 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2807 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2951 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 488:
-#line 1685 "dhcp4_parser.yy" // lalr1.cc:859
+  case 519:
+#line 1793 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-ip", s);
     ctx.leave();
 }
-#line 2817 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2961 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 489:
-#line 1691 "dhcp4_parser.yy" // lalr1.cc:859
+  case 520:
+#line 1799 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-port", i);
 }
-#line 2826 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2970 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 490:
-#line 1696 "dhcp4_parser.yy" // lalr1.cc:859
+  case 521:
+#line 1804 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2834 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2978 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 491:
-#line 1698 "dhcp4_parser.yy" // lalr1.cc:859
+  case 522:
+#line 1806 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-ip", s);
     ctx.leave();
 }
-#line 2844 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2988 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 492:
-#line 1704 "dhcp4_parser.yy" // lalr1.cc:859
+  case 523:
+#line 1812 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-port", i);
 }
-#line 2853 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2997 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 493:
-#line 1709 "dhcp4_parser.yy" // lalr1.cc:859
+  case 524:
+#line 1817 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-queue-size", i);
 }
-#line 2862 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3006 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 494:
-#line 1714 "dhcp4_parser.yy" // lalr1.cc:859
+  case 525:
+#line 1822 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NCR_PROTOCOL);
 }
-#line 2870 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3014 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 495:
-#line 1716 "dhcp4_parser.yy" // lalr1.cc:859
+  case 526:
+#line 1824 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 2879 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3023 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 496:
-#line 1722 "dhcp4_parser.yy" // lalr1.cc:859
+  case 527:
+#line 1830 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
-#line 2885 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3029 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 497:
-#line 1723 "dhcp4_parser.yy" // lalr1.cc:859
+  case 528:
+#line 1831 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
-#line 2891 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3035 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 498:
-#line 1726 "dhcp4_parser.yy" // lalr1.cc:859
+  case 529:
+#line 1834 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NCR_FORMAT);
 }
-#line 2899 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3043 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 499:
-#line 1728 "dhcp4_parser.yy" // lalr1.cc:859
+  case 530:
+#line 1836 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr json(new StringElement("JSON", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ncr-format", json);
     ctx.leave();
 }
-#line 2909 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3053 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 500:
-#line 1734 "dhcp4_parser.yy" // lalr1.cc:859
+  case 531:
+#line 1842 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("always-include-fqdn", b);
 }
-#line 2918 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3062 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 501:
-#line 1739 "dhcp4_parser.yy" // lalr1.cc:859
+  case 532:
+#line 1847 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-no-update", b);
 }
-#line 2927 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3071 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 502:
-#line 1744 "dhcp4_parser.yy" // lalr1.cc:859
+  case 533:
+#line 1852 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-client-update", b);
 }
-#line 2936 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3080 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 503:
-#line 1749 "dhcp4_parser.yy" // lalr1.cc:859
+  case 534:
+#line 1857 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.REPLACE_CLIENT_NAME);
 }
-#line 2944 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3088 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 504:
-#line 1751 "dhcp4_parser.yy" // lalr1.cc:859
+  case 535:
+#line 1859 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("replace-client-name", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 2953 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3097 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 505:
-#line 1757 "dhcp4_parser.yy" // lalr1.cc:859
+  case 536:
+#line 1865 "dhcp4_parser.yy" // lalr1.cc:859
     {
       yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("when-present", ctx.loc2pos(yystack_[0].location))); 
       }
-#line 2961 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3105 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 506:
-#line 1760 "dhcp4_parser.yy" // lalr1.cc:859
+  case 537:
+#line 1868 "dhcp4_parser.yy" // lalr1.cc:859
     {
       yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("never", ctx.loc2pos(yystack_[0].location)));
       }
-#line 2969 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3113 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 507:
-#line 1763 "dhcp4_parser.yy" // lalr1.cc:859
+  case 538:
+#line 1871 "dhcp4_parser.yy" // lalr1.cc:859
     {
       yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("always", ctx.loc2pos(yystack_[0].location)));
       }
-#line 2977 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3121 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 508:
-#line 1766 "dhcp4_parser.yy" // lalr1.cc:859
+  case 539:
+#line 1874 "dhcp4_parser.yy" // lalr1.cc:859
     {
       yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("when-not-present", ctx.loc2pos(yystack_[0].location)));
       }
-#line 2985 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3129 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 509:
-#line 1769 "dhcp4_parser.yy" // lalr1.cc:859
+  case 540:
+#line 1877 "dhcp4_parser.yy" // lalr1.cc:859
     {
       error(yystack_[0].location, "boolean values for the replace-client-name are "
                 "no longer supported");
       }
-#line 2994 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3138 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 510:
-#line 1775 "dhcp4_parser.yy" // lalr1.cc:859
+  case 541:
+#line 1883 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3002 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3146 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 511:
-#line 1777 "dhcp4_parser.yy" // lalr1.cc:859
+  case 542:
+#line 1885 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("generated-prefix", s);
     ctx.leave();
 }
-#line 3012 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3156 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 512:
-#line 1785 "dhcp4_parser.yy" // lalr1.cc:859
+  case 543:
+#line 1893 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3020 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3164 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 513:
-#line 1787 "dhcp4_parser.yy" // lalr1.cc:859
+  case 544:
+#line 1895 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("Dhcp6", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 3029 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3173 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 514:
-#line 1792 "dhcp4_parser.yy" // lalr1.cc:859
+  case 545:
+#line 1900 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3037 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3181 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 515:
-#line 1794 "dhcp4_parser.yy" // lalr1.cc:859
+  case 546:
+#line 1902 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("DhcpDdns", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 3046 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3190 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 516:
-#line 1799 "dhcp4_parser.yy" // lalr1.cc:859
+  case 547:
+#line 1907 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3054 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3198 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 517:
-#line 1801 "dhcp4_parser.yy" // lalr1.cc:859
+  case 548:
+#line 1909 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("Control-agent", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 3063 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3207 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 518:
-#line 1811 "dhcp4_parser.yy" // lalr1.cc:859
+  case 549:
+#line 1919 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.LOGGING);
 }
-#line 3074 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3218 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 519:
-#line 1816 "dhcp4_parser.yy" // lalr1.cc:859
+  case 550:
+#line 1924 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3083 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3227 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 523:
-#line 1833 "dhcp4_parser.yy" // lalr1.cc:859
+  case 554:
+#line 1941 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.LOGGERS);
 }
-#line 3094 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3238 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 524:
-#line 1838 "dhcp4_parser.yy" // lalr1.cc:859
+  case 555:
+#line 1946 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3103 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3247 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 527:
-#line 1850 "dhcp4_parser.yy" // lalr1.cc:859
+  case 558:
+#line 1958 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
     ctx.stack_.push_back(l);
 }
-#line 3113 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3257 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 528:
-#line 1854 "dhcp4_parser.yy" // lalr1.cc:859
+  case 559:
+#line 1962 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
 }
-#line 3121 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3265 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 536:
-#line 1869 "dhcp4_parser.yy" // lalr1.cc:859
+  case 567:
+#line 1977 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr dl(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
 }
-#line 3130 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3274 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 537:
-#line 1874 "dhcp4_parser.yy" // lalr1.cc:859
+  case 568:
+#line 1982 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3138 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3282 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 538:
-#line 1876 "dhcp4_parser.yy" // lalr1.cc:859
+  case 569:
+#line 1984 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
     ctx.leave();
 }
-#line 3148 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3292 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 539:
-#line 1882 "dhcp4_parser.yy" // lalr1.cc:859
+  case 570:
+#line 1990 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 3159 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3303 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 540:
-#line 1887 "dhcp4_parser.yy" // lalr1.cc:859
+  case 571:
+#line 1995 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3168 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3312 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 543:
-#line 1896 "dhcp4_parser.yy" // lalr1.cc:859
+  case 574:
+#line 2004 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 3178 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3322 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 544:
-#line 1900 "dhcp4_parser.yy" // lalr1.cc:859
+  case 575:
+#line 2008 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
 }
-#line 3186 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3330 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 551:
-#line 1914 "dhcp4_parser.yy" // lalr1.cc:859
+  case 582:
+#line 2022 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3194 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3338 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 552:
-#line 1916 "dhcp4_parser.yy" // lalr1.cc:859
+  case 583:
+#line 2024 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 3204 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3348 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 553:
-#line 1922 "dhcp4_parser.yy" // lalr1.cc:859
+  case 584:
+#line 2030 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr flush(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush", flush);
 }
-#line 3213 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3357 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 554:
-#line 1927 "dhcp4_parser.yy" // lalr1.cc:859
+  case 585:
+#line 2035 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr maxsize(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxsize", maxsize);
 }
-#line 3222 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3366 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 555:
-#line 1932 "dhcp4_parser.yy" // lalr1.cc:859
+  case 586:
+#line 2040 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr maxver(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxver", maxver);
 }
-#line 3231 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3375 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
 
-#line 3235 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3379 "dhcp4_parser.cc" // lalr1.cc:859
             default:
               break;
             }
@@ -3486,103 +3630,110 @@ namespace isc { namespace dhcp {
   }
 
 
-  const short int Dhcp4Parser::yypact_ninf_ = -713;
+  const short int Dhcp4Parser::yypact_ninf_ = -758;
 
   const signed char Dhcp4Parser::yytable_ninf_ = -1;
 
   const short int
   Dhcp4Parser::yypact_[] =
   {
-     248,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,
-    -713,  -713,  -713,    40,    32,    35,    43,    45,    49,    65,
-      67,    71,    78,    97,   106,   115,  -713,  -713,  -713,  -713,
-    -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,
-    -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,
-    -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,
-      32,   -48,     8,   140,   113,    22,     4,   180,    70,    -1,
-     141,   -27,   266,  -713,   161,   196,   202,   224,   230,  -713,
-    -713,  -713,  -713,  -713,   252,  -713,    94,  -713,  -713,  -713,
-    -713,  -713,  -713,  -713,   253,   271,  -713,  -713,  -713,  -713,
-    -713,   284,   285,   286,   287,  -713,  -713,  -713,  -713,  -713,
-    -713,  -713,  -713,   288,  -713,  -713,  -713,   102,  -713,  -713,
-    -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,
-    -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,
-    -713,  -713,  -713,  -713,  -713,   290,   109,  -713,  -713,  -713,
-    -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,
-    -713,   291,   293,  -713,  -713,  -713,  -713,  -713,  -713,  -713,
-    -713,  -713,   128,  -713,  -713,  -713,  -713,  -713,  -713,  -713,
-    -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,
-    -713,  -713,  -713,  -713,  -713,   144,  -713,  -713,  -713,  -713,
-    -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,   228,
-     240,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,
-    -713,  -713,  -713,   238,  -713,  -713,   296,  -713,  -713,  -713,
-     298,  -713,  -713,   246,   300,  -713,  -713,  -713,  -713,  -713,
-    -713,  -713,  -713,  -713,  -713,  -713,   301,   305,  -713,  -713,
-    -713,  -713,   261,   309,  -713,  -713,  -713,  -713,  -713,  -713,
-    -713,  -713,  -713,  -713,   145,  -713,  -713,  -713,   313,  -713,
-    -713,   327,  -713,   328,   329,  -713,  -713,   330,   332,   333,
-    -713,  -713,  -713,   184,  -713,  -713,  -713,  -713,  -713,  -713,
-    -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,
-      32,    32,  -713,   158,   334,   335,   336,   339,   341,  -713,
-       8,  -713,   342,   170,   208,   354,   355,   356,   357,   358,
-     216,   247,   249,   251,   391,   393,   395,   396,   397,   398,
-     399,   400,   258,   402,   403,   140,  -713,   404,   405,   406,
-     267,   113,  -713,    25,   407,   409,   410,   411,   413,   414,
-     415,   416,   274,   273,   419,   420,   421,   422,    22,  -713,
-     423,     4,  -713,   424,   425,   426,   427,   428,   429,   430,
-     431,  -713,   180,  -713,   432,   433,   292,   434,   436,   437,
-     294,  -713,    -1,   438,   295,   297,  -713,   141,   441,   443,
-      55,  -713,   299,   446,   447,   306,   448,   307,   308,   454,
-     455,   311,   316,   318,   458,   464,   266,  -713,  -713,  -713,
-     465,   463,   466,    32,    32,    32,  -713,   468,  -713,  -713,
-     325,   326,   331,   469,   472,  -713,  -713,  -713,  -713,   475,
-     477,   478,   479,   481,   482,   483,   484,  -713,   485,   486,
-    -713,   489,   155,   171,  -713,  -713,  -713,  -713,  -713,  -713,
-    -713,  -713,  -713,  -713,   487,   493,  -713,  -713,  -713,   343,
-     344,   352,   494,   496,   360,   361,   362,  -713,  -713,   207,
-     363,   495,   497,  -713,   365,  -713,   489,   366,   367,   368,
-     369,   370,   371,   372,  -713,   373,   374,  -713,   375,   376,
-     377,  -713,  -713,   378,  -713,  -713,  -713,   379,    32,  -713,
-    -713,   380,   381,  -713,   382,  -713,  -713,    17,   384,  -713,
-    -713,  -713,   -38,   383,  -713,    32,   140,   408,  -713,  -713,
-    -713,   113,  -713,  -713,  -713,   315,   315,   523,   525,   526,
-     527,   129,    26,   528,    81,   126,   266,  -713,  -713,  -713,
-    -713,  -713,  -713,  -713,  -713,   532,  -713,    25,  -713,  -713,
-    -713,   530,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,
-    -713,  -713,   531,   453,  -713,  -713,  -713,  -713,  -713,  -713,
-    -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,
-    -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,
-    -713,  -713,  -713,  -713,  -713,  -713,   197,  -713,   214,  -713,
-    -713,   220,  -713,  -713,  -713,  -713,   536,   537,   538,   539,
-     540,  -713,  -713,  -713,   221,  -713,  -713,  -713,  -713,  -713,
-    -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,   231,  -713,
-     541,   542,  -713,  -713,   543,   545,  -713,  -713,   544,   548,
-    -713,  -713,   546,   550,  -713,  -713,  -713,  -713,  -713,  -713,
-      57,  -713,  -713,  -713,  -713,  -713,  -713,  -713,   131,  -713,
-     549,   551,  -713,   552,   553,   554,   555,   556,   557,   232,
-    -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,   239,
-    -713,  -713,  -713,   241,   417,   418,  -713,  -713,   559,   563,
-    -713,  -713,   561,   565,  -713,  -713,   562,  -713,   558,   408,
-    -713,  -713,   567,   568,   569,   570,   435,   439,   440,   442,
-     445,   571,   572,   315,  -713,  -713,    22,  -713,   523,    -1,
-    -713,   525,   141,  -713,   526,    72,  -713,   527,   129,  -713,
-      26,  -713,   -27,  -713,   528,   449,   450,   451,   452,   456,
-     457,    81,  -713,   573,   574,   126,  -713,  -713,  -713,   575,
-     566,  -713,     4,  -713,   530,   180,  -713,   531,   576,  -713,
-     578,  -713,   254,   444,   459,   460,  -713,  -713,  -713,  -713,
-    -713,   461,   462,  -713,   242,  -713,   577,  -713,   581,  -713,
-    -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,
-     250,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,
-     262,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,   467,
-     470,  -713,  -713,   471,   264,  -713,   585,  -713,   473,   579,
-    -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,
-    -713,  -713,  -713,    72,  -713,  -713,  -713,  -713,  -713,  -713,
-    -713,  -713,  -713,   152,  -713,  -713,   -18,   579,  -713,  -713,
-     580,  -713,  -713,  -713,   265,  -713,  -713,  -713,  -713,  -713,
-     590,   474,   591,   -18,  -713,   595,  -713,   476,  -713,   594,
-    -713,  -713,   153,  -713,    91,   594,  -713,  -713,   598,   605,
-     606,   268,  -713,  -713,  -713,  -713,  -713,  -713,   607,   480,
-     488,   490,    91,  -713,   492,  -713,  -713,  -713,  -713,  -713
+      69,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,    38,    32,    33,    35,    56,    58,    93,
+     104,   106,   122,   128,   140,   162,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+      32,    14,     9,   141,   126,    22,    -2,    29,   150,   -13,
+      -1,    -7,   301,  -758,   185,   229,   243,   195,   246,  -758,
+    -758,  -758,  -758,  -758,   290,  -758,    24,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,   291,   293,  -758,  -758,  -758,  -758,
+    -758,   296,   299,   300,   305,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,   308,  -758,  -758,  -758,    75,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,   311,    79,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,   313,   315,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,    86,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,    90,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,   270,
+     302,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,   318,  -758,  -758,   327,  -758,  -758,  -758,
+     328,  -758,  -758,   325,   331,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,  -758,   332,   333,  -758,  -758,
+    -758,  -758,   330,   336,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,   173,  -758,  -758,  -758,   338,  -758,
+    -758,   339,  -758,   341,   342,  -758,  -758,   343,   344,   345,
+    -758,  -758,  -758,   179,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+      32,    32,  -758,   190,   346,   348,   349,   351,   352,  -758,
+       9,  -758,   353,   176,   194,   355,   356,   357,   358,   359,
+     192,   205,   206,   207,   366,   367,   368,   369,   370,   371,
+     372,   374,   217,   377,   403,   141,  -758,   404,   405,   406,
+     247,   126,  -758,    25,   408,   409,   410,   411,   412,   428,
+     429,   430,   275,   271,   432,   434,   435,   436,    22,  -758,
+     437,    -2,  -758,   438,   439,   440,   441,   442,   443,   444,
+     446,  -758,    29,  -758,   447,   448,   292,   449,   451,   454,
+     295,  -758,   -13,   456,   297,   303,  -758,    -1,   461,   464,
+      17,  -758,   306,   465,   467,   310,   469,   314,   317,   471,
+     473,   316,   319,   320,   478,   482,   301,  -758,  -758,  -758,
+     483,   481,   484,    32,    32,    32,  -758,   485,  -758,  -758,
+     329,   334,   335,   486,   487,  -758,  -758,  -758,  -758,   493,
+     494,   495,   496,   498,   499,   501,   500,  -758,   502,   505,
+    -758,   503,   199,   274,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,   506,   510,  -758,  -758,  -758,   354,
+     360,   361,   511,   512,   362,   363,   364,  -758,  -758,   200,
+     365,   513,   520,  -758,   373,  -758,   503,   375,   376,   378,
+     379,   380,   381,   382,  -758,   383,   384,  -758,   385,   386,
+     387,  -758,  -758,   388,  -758,  -758,  -758,   389,    32,  -758,
+    -758,   390,   391,  -758,   392,  -758,  -758,    18,   396,  -758,
+    -758,  -758,    44,   393,  -758,    32,   141,   394,  -758,  -758,
+    -758,   126,  -758,  -758,  -758,   350,   350,   522,   523,   524,
+     526,   145,    48,   528,   127,   175,   301,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,   516,  -758,    25,  -758,  -758,
+    -758,   531,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,   548,   416,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,  -758,   181,  -758,   189,  -758,
+    -758,   201,  -758,  -758,  -758,  -758,   552,   553,   554,   555,
+     556,  -758,  -758,   557,   558,   559,   560,   561,   562,   563,
+     564,   565,  -758,   566,   567,   568,   569,   570,  -758,   202,
+    -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,   208,  -758,
+     571,   572,  -758,  -758,   573,   575,  -758,  -758,   574,   578,
+    -758,  -758,   576,   580,  -758,  -758,  -758,  -758,  -758,  -758,
+     138,  -758,  -758,  -758,  -758,  -758,  -758,  -758,   182,  -758,
+     579,   581,  -758,   582,   583,   584,   585,   586,   587,   242,
+    -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,   252,
+    -758,  -758,  -758,   255,   415,   431,  -758,  -758,   588,   590,
+    -758,  -758,   589,   593,  -758,  -758,   591,  -758,   594,   394,
+    -758,  -758,   596,   597,   598,   599,   445,   433,   450,   452,
+     453,   600,   601,   455,   457,   458,   462,   463,   466,   459,
+     468,   470,   602,   472,   474,   475,   476,   477,   350,  -758,
+    -758,    22,  -758,   522,   -13,  -758,   523,    -1,  -758,   524,
+      51,  -758,   526,   145,  -758,    48,  -758,    -7,  -758,   528,
+     479,   480,   488,   489,   490,   491,   127,  -758,   604,   605,
+     175,  -758,  -758,  -758,   607,   608,  -758,    -2,  -758,   531,
+      29,  -758,   548,   606,  -758,   609,  -758,   254,   497,   504,
+     507,  -758,  -758,  -758,  -758,  -758,   508,   509,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,  -758,  -758,   514,  -758,  -758,
+    -758,  -758,  -758,  -758,   256,  -758,   610,  -758,   612,  -758,
+    -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+     259,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+     262,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,   515,
+     517,  -758,  -758,   518,   263,  -758,   618,  -758,   519,   620,
+    -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,    51,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,   266,  -758,  -758,    -8,   620,  -758,
+    -758,   613,  -758,  -758,  -758,   265,  -758,  -758,  -758,  -758,
+    -758,   625,   492,   627,    -8,  -758,   628,  -758,   521,  -758,
+     633,  -758,  -758,   273,  -758,    28,   633,  -758,  -758,   631,
+     639,   640,   272,  -758,  -758,  -758,  -758,  -758,  -758,   641,
+     527,   525,   530,    28,  -758,   529,  -758,  -758,  -758,  -758,
+    -758
   };
 
   const unsigned short int
@@ -3592,131 +3743,139 @@ namespace isc { namespace dhcp {
       20,    22,    24,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     1,    41,    34,    30,
       29,    26,    27,    28,    33,     3,    31,    32,    54,     5,
-      66,     7,   108,     9,   220,    11,   366,    13,   386,    15,
-     295,    17,   303,    19,   338,    21,   185,    23,   465,    25,
-      43,    37,     0,     0,     0,     0,     0,   388,     0,   305,
-     340,     0,     0,    45,     0,    44,     0,     0,    38,    64,
-     518,   512,   514,   516,     0,    63,     0,    56,    58,    60,
-      61,    62,    59,   100,     0,     0,   405,   407,   409,   121,
-     123,     0,     0,     0,     0,   212,   293,   330,   268,   163,
-     431,   177,   196,     0,   453,   463,    93,     0,    68,    70,
+      66,     7,   108,     9,   251,    11,   397,    13,   417,    15,
+     326,    17,   334,    19,   369,    21,   216,    23,   496,    25,
+      43,    37,     0,     0,     0,     0,     0,   419,     0,   336,
+     371,     0,     0,    45,     0,    44,     0,     0,    38,    64,
+     549,   543,   545,   547,     0,    63,     0,    56,    58,    60,
+      61,    62,    59,   100,     0,     0,   436,   438,   440,   121,
+     123,     0,     0,     0,     0,   243,   324,   361,   299,   194,
+     462,   208,   227,     0,   484,   494,    93,     0,    68,    70,
       71,    72,    73,    88,    89,    76,    77,    78,    79,    83,
       84,    74,    75,    81,    82,    90,    91,    92,    80,    85,
       86,    87,   110,   112,   116,     0,     0,   102,   104,   105,
-     106,   107,   435,   249,   251,   253,   358,   376,   247,   255,
-     257,     0,     0,   261,   259,   378,   427,   246,   224,   225,
-     226,   238,     0,   222,   229,   242,   243,   244,   230,   231,
-     234,   236,   232,   233,   227,   228,   245,   235,   239,   240,
-     241,   237,   374,   373,   371,     0,   368,   370,   372,   425,
-     413,   415,   419,   417,   423,   421,   411,   404,   400,     0,
-     389,   390,   401,   402,   403,   397,   392,   398,   394,   395,
-     396,   399,   393,     0,   320,   153,     0,   324,   322,   327,
-       0,   316,   317,     0,   306,   307,   309,   319,   310,   311,
-     312,   326,   313,   314,   315,   352,     0,     0,   350,   351,
-     354,   355,     0,   341,   342,   344,   345,   346,   347,   348,
-     349,   192,   194,   189,     0,   187,   190,   191,     0,   485,
-     487,     0,   490,     0,     0,   494,   498,     0,     0,     0,
-     503,   510,   483,     0,   467,   469,   470,   471,   472,   473,
-     474,   475,   476,   477,   478,   479,   480,   481,   482,    42,
+     106,   107,   466,   280,   282,   284,   389,   407,   278,   286,
+     288,     0,     0,   292,   290,   409,   458,   277,   255,   256,
+     257,   269,     0,   253,   260,   273,   274,   275,   261,   262,
+     265,   267,   263,   264,   258,   259,   276,   266,   270,   271,
+     272,   268,   405,   404,   402,     0,   399,   401,   403,   456,
+     444,   446,   450,   448,   454,   452,   442,   435,   431,     0,
+     420,   421,   432,   433,   434,   428,   423,   429,   425,   426,
+     427,   430,   424,     0,   351,   168,     0,   355,   353,   358,
+       0,   347,   348,     0,   337,   338,   340,   350,   341,   342,
+     343,   357,   344,   345,   346,   383,     0,     0,   381,   382,
+     385,   386,     0,   372,   373,   375,   376,   377,   378,   379,
+     380,   223,   225,   220,     0,   218,   221,   222,     0,   516,
+     518,     0,   521,     0,     0,   525,   529,     0,     0,     0,
+     534,   541,   514,     0,   498,   500,   501,   502,   503,   504,
+     505,   506,   507,   508,   509,   510,   511,   512,   513,    42,
        0,     0,    35,     0,     0,     0,     0,     0,     0,    53,
        0,    55,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,    67,     0,     0,     0,
-       0,     0,   109,   437,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   221,
-       0,     0,   367,     0,     0,     0,     0,     0,     0,     0,
-       0,   387,     0,   296,     0,     0,     0,     0,     0,     0,
-       0,   304,     0,     0,     0,     0,   339,     0,     0,     0,
-       0,   186,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   466,    46,    39,
+       0,     0,   109,   468,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   252,
+       0,     0,   398,     0,     0,     0,     0,     0,     0,     0,
+       0,   418,     0,   327,     0,     0,     0,     0,     0,     0,
+       0,   335,     0,     0,     0,     0,   370,     0,     0,     0,
+       0,   217,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   497,    46,    39,
        0,     0,     0,     0,     0,     0,    57,     0,    98,    99,
        0,     0,     0,     0,     0,    94,    95,    96,    97,     0,
-       0,     0,     0,     0,     0,     0,     0,   452,     0,     0,
-      69,     0,     0,     0,   120,   103,   450,   448,   449,   443,
-     444,   445,   446,   447,     0,   438,   439,   441,   442,     0,
-       0,     0,     0,     0,     0,     0,     0,   266,   267,     0,
-       0,     0,     0,   223,     0,   369,     0,     0,     0,     0,
-       0,     0,     0,     0,   391,     0,     0,   318,     0,     0,
-       0,   329,   308,     0,   356,   357,   343,     0,     0,   188,
-     484,     0,     0,   489,     0,   492,   493,     0,     0,   500,
-     501,   502,     0,     0,   468,     0,     0,     0,   513,   515,
-     517,     0,   406,   408,   410,     0,     0,   214,   297,   332,
-     270,     0,     0,   179,     0,     0,     0,    47,   111,   114,
-     115,   113,   118,   119,   117,     0,   436,     0,   250,   252,
-     254,   360,    36,   377,   248,   256,   258,   263,   264,   265,
-     262,   260,   380,     0,   375,   426,   414,   416,   420,   418,
-     424,   422,   412,   321,   154,   325,   323,   328,   353,   193,
-     195,   486,   488,   491,   496,   497,   495,   499,   505,   506,
-     507,   508,   509,   504,   511,    40,     0,   523,     0,   520,
-     522,     0,   140,   146,   148,   150,     0,     0,     0,     0,
-       0,   159,   161,   139,     0,   125,   127,   128,   129,   130,
-     131,   132,   133,   134,   135,   136,   137,   138,     0,   218,
-       0,   215,   216,   301,     0,   298,   299,   336,     0,   333,
-     334,   274,     0,   271,   272,   172,   173,   174,   175,   176,
-       0,   165,   167,   168,   169,   170,   171,   433,     0,   183,
-       0,   180,   181,     0,     0,     0,     0,     0,     0,     0,
-     198,   200,   201,   202,   203,   204,   205,   459,   461,     0,
-     455,   457,   458,     0,    49,     0,   440,   364,     0,   361,
-     362,   384,     0,   381,   382,   429,     0,    65,     0,     0,
-     519,   101,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   122,   124,     0,   213,     0,   305,
-     294,     0,   340,   331,     0,     0,   269,     0,     0,   164,
-       0,   432,     0,   178,     0,     0,     0,     0,     0,     0,
-       0,     0,   197,     0,     0,     0,   454,   464,    51,     0,
-      50,   451,     0,   359,     0,   388,   379,     0,     0,   428,
-       0,   521,     0,     0,     0,     0,   152,   155,   156,   157,
-     158,     0,     0,   126,     0,   217,     0,   300,     0,   335,
-     292,   291,   281,   282,   284,   278,   279,   280,   290,   289,
-       0,   276,   283,   285,   286,   287,   288,   273,   166,   434,
-       0,   182,   206,   207,   208,   209,   210,   211,   199,     0,
-       0,   456,    48,     0,     0,   363,     0,   383,     0,     0,
-     142,   143,   144,   145,   141,   147,   149,   151,   160,   162,
-     219,   302,   337,     0,   275,   184,   460,   462,    52,   365,
-     385,   430,   527,     0,   525,   277,     0,     0,   524,   539,
-       0,   537,   535,   531,     0,   529,   533,   534,   532,   526,
-       0,     0,     0,     0,   528,     0,   536,     0,   530,     0,
-     538,   543,     0,   541,     0,     0,   540,   551,     0,     0,
-       0,     0,   545,   547,   548,   549,   550,   542,     0,     0,
-       0,     0,     0,   544,     0,   553,   554,   555,   546,   552
+       0,     0,     0,     0,     0,     0,     0,   483,     0,     0,
+      69,     0,     0,     0,   120,   103,   481,   479,   480,   474,
+     475,   476,   477,   478,     0,   469,   470,   472,   473,     0,
+       0,     0,     0,     0,     0,     0,     0,   297,   298,     0,
+       0,     0,     0,   254,     0,   400,     0,     0,     0,     0,
+       0,     0,     0,     0,   422,     0,     0,   349,     0,     0,
+       0,   360,   339,     0,   387,   388,   374,     0,     0,   219,
+     515,     0,     0,   520,     0,   523,   524,     0,     0,   531,
+     532,   533,     0,     0,   499,     0,     0,     0,   544,   546,
+     548,     0,   437,   439,   441,     0,     0,   245,   328,   363,
+     301,     0,     0,   210,     0,     0,     0,    47,   111,   114,
+     115,   113,   118,   119,   117,     0,   467,     0,   281,   283,
+     285,   391,    36,   408,   279,   287,   289,   294,   295,   296,
+     293,   291,   411,     0,   406,   457,   445,   447,   451,   449,
+     455,   453,   443,   352,   169,   356,   354,   359,   384,   224,
+     226,   517,   519,   522,   527,   528,   526,   530,   536,   537,
+     538,   539,   540,   535,   542,    40,     0,   554,     0,   551,
+     553,     0,   155,   161,   163,   165,     0,     0,     0,     0,
+       0,   174,   176,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   187,     0,     0,     0,     0,     0,   154,     0,
+     125,   127,   128,   129,   130,   131,   132,   133,   134,   135,
+     136,   137,   138,   139,   140,   141,   142,   143,   144,   145,
+     146,   147,   148,   149,   150,   151,   152,   153,     0,   249,
+       0,   246,   247,   332,     0,   329,   330,   367,     0,   364,
+     365,   305,     0,   302,   303,   203,   204,   205,   206,   207,
+       0,   196,   198,   199,   200,   201,   202,   464,     0,   214,
+       0,   211,   212,     0,     0,     0,     0,     0,     0,     0,
+     229,   231,   232,   233,   234,   235,   236,   490,   492,     0,
+     486,   488,   489,     0,    49,     0,   471,   395,     0,   392,
+     393,   415,     0,   412,   413,   460,     0,    65,     0,     0,
+     550,   101,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   122,
+     124,     0,   244,     0,   336,   325,     0,   371,   362,     0,
+       0,   300,     0,     0,   195,     0,   463,     0,   209,     0,
+       0,     0,     0,     0,     0,     0,     0,   228,     0,     0,
+       0,   485,   495,    51,     0,    50,   482,     0,   390,     0,
+     419,   410,     0,     0,   459,     0,   552,     0,     0,     0,
+       0,   167,   170,   171,   172,   173,     0,     0,   178,   179,
+     180,   181,   182,   183,   184,   185,   186,     0,   189,   190,
+     191,   192,   193,   126,     0,   248,     0,   331,     0,   366,
+     323,   322,   312,   313,   315,   309,   310,   311,   321,   320,
+       0,   307,   314,   316,   317,   318,   319,   304,   197,   465,
+       0,   213,   237,   238,   239,   240,   241,   242,   230,     0,
+       0,   487,    48,     0,     0,   394,     0,   414,     0,     0,
+     157,   158,   159,   160,   156,   162,   164,   166,   175,   177,
+     188,   250,   333,   368,     0,   306,   215,   491,   493,    52,
+     396,   416,   461,   558,     0,   556,   308,     0,     0,   555,
+     570,     0,   568,   566,   562,     0,   560,   564,   565,   563,
+     557,     0,     0,     0,     0,   559,     0,   567,     0,   561,
+       0,   569,   574,     0,   572,     0,     0,   571,   582,     0,
+       0,     0,     0,   576,   578,   579,   580,   581,   573,     0,
+       0,     0,     0,     0,   575,     0,   584,   585,   586,   577,
+     583
   };
 
   const short int
   Dhcp4Parser::yypgoto_[] =
   {
-    -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,
-    -713,  -713,  -713,  -713,   -49,  -713,    83,  -713,  -713,  -713,
-    -713,  -713,  -713,  -713,  -713,   103,  -713,  -713,  -713,   -62,
-    -713,  -713,  -713,   302,  -713,  -713,  -713,  -713,    98,   280,
-     -44,   -34,   -30,  -713,  -713,   -29,  -713,  -713,    99,   277,
-    -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,
-    -713,  -713,  -713,  -713,  -713,   100,   -90,  -713,  -713,  -713,
-    -713,  -713,  -713,  -713,  -713,  -713,  -713,   -69,  -713,  -713,
-    -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,
-    -104,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,
-    -109,  -713,  -713,  -713,  -105,   243,  -713,  -713,  -713,  -713,
-    -713,  -713,  -713,  -113,  -713,  -713,  -713,  -713,  -713,  -713,
-    -712,  -713,  -713,  -713,   -88,  -713,  -713,  -713,   -85,   276,
-    -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -706,  -713,
-    -713,  -713,  -518,  -713,  -698,  -713,  -713,  -713,  -713,  -713,
-    -713,  -713,  -713,   -95,  -713,  -713,  -197,   -66,  -713,  -713,
-    -713,  -713,  -713,   -82,  -713,  -713,  -713,   -79,  -713,   259,
-    -713,   -64,  -713,  -713,  -713,  -713,  -713,   -46,  -713,  -713,
-    -713,  -713,  -713,   -50,  -713,  -713,  -713,   -81,  -713,  -713,
-    -713,   -80,  -713,   260,  -713,  -713,  -713,  -713,  -713,  -713,
-    -713,  -713,  -713,  -713,  -713,  -108,  -713,  -713,  -713,  -107,
-     289,  -713,  -713,   -54,  -713,  -713,  -713,  -713,  -713,  -102,
-    -713,  -713,  -713,  -106,  -713,   312,   -45,  -713,   -42,  -713,
-     -37,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,
-    -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -687,  -713,
-    -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,   101,  -713,
-    -713,  -713,  -713,  -713,  -713,  -713,   -93,  -713,  -713,  -713,
-    -713,  -713,  -713,  -713,  -713,   123,   255,  -713,  -713,  -713,
-    -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,
-    -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,
-    -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,  -713,   -35,
-    -713,  -713,  -713,  -185,  -713,  -713,  -198,  -713,  -713,  -713,
-    -713,  -713,  -713,  -208,  -713,  -713,  -224,  -713,  -713,  -713,
-    -713,  -713
+    -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,   -49,  -758,    26,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,   170,  -758,  -758,  -758,   -62,
+    -758,  -758,  -758,   337,  -758,  -758,  -758,  -758,   132,   321,
+     -44,   -34,   -30,  -758,  -758,   -29,  -758,  -758,   134,   322,
+    -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,   123,  -101,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,  -758,  -758,   -69,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,  -758,  -114,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,  -758,  -119,  -758,  -758,  -758,
+    -116,   276,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -124,
+    -758,  -758,  -758,  -758,  -758,  -758,  -757,  -758,  -758,  -758,
+     -99,  -758,  -758,  -758,   -94,   323,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,  -744,  -758,  -758,  -758,  -514,  -758,
+    -736,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -100,
+    -758,  -758,  -223,   -66,  -758,  -758,  -758,  -758,  -758,   -93,
+    -758,  -758,  -758,   -90,  -758,   304,  -758,   -64,  -758,  -758,
+    -758,  -758,  -758,   -46,  -758,  -758,  -758,  -758,  -758,   -50,
+    -758,  -758,  -758,   -92,  -758,  -758,  -758,   -84,  -758,   298,
+    -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,  -115,  -758,  -758,  -758,  -109,   395,  -758,  -758,   -54,
+    -758,  -758,  -758,  -758,  -758,  -108,  -758,  -758,  -758,  -107,
+    -758,   340,   -45,  -758,   -42,  -758,   -37,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,  -720,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,   148,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,   -86,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,   161,   294,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,  -758,
+    -758,  -758,  -758,  -758,  -758,   -23,  -758,  -758,  -758,  -201,
+    -758,  -758,  -215,  -758,  -758,  -758,  -758,  -758,  -758,  -226,
+    -758,  -758,  -240,  -758,  -758,  -758,  -758,  -758
   };
 
   const short int
@@ -3724,366 +3883,389 @@ namespace isc { namespace dhcp {
   {
       -1,    13,    14,    15,    16,    17,    18,    19,    20,    21,
       22,    23,    24,    25,    34,    35,    36,    61,   553,    77,
-      78,    37,    60,    74,    75,   538,   684,   749,   750,   116,
+      78,    37,    60,    74,    75,   538,   714,   794,   795,   116,
       39,    62,    86,    87,    88,   304,    41,    63,   117,   118,
      119,   120,   121,   122,   123,   124,   125,   312,   146,   147,
       43,    64,   148,   337,   149,   338,   541,   150,   339,   544,
-     151,   126,   318,   127,   319,   614,   615,   616,   702,   824,
-     617,   703,   618,   704,   619,   705,   620,   232,   375,   622,
-     623,   624,   625,   626,   711,   627,   712,   128,   328,   650,
-     651,   652,   653,   654,   655,   656,   129,   330,   660,   661,
-     662,   732,    57,    71,   264,   265,   266,   388,   267,   389,
-     130,   331,   669,   670,   671,   672,   673,   674,   675,   676,
-     131,   324,   630,   631,   632,   716,    45,    65,   172,   173,
-     174,   349,   175,   344,   176,   345,   177,   346,   178,   350,
-     179,   351,   180,   355,   181,   354,   560,   182,   183,   132,
-     327,   642,   643,   644,   725,   790,   791,   133,   325,    51,
-      68,   634,   635,   636,   719,    53,    69,   233,   234,   235,
-     236,   237,   238,   239,   374,   240,   378,   241,   377,   242,
-     243,   379,   244,   134,   326,   638,   639,   640,   722,    55,
-      70,   252,   253,   254,   255,   256,   383,   257,   258,   259,
-     260,   185,   347,   688,   689,   690,   752,    47,    66,   195,
-     196,   197,   360,   186,   348,   187,   356,   692,   693,   694,
-     755,    49,    67,   209,   210,   211,   135,   315,   136,   316,
-     137,   317,   215,   370,   216,   364,   217,   365,   218,   367,
-     219,   366,   220,   369,   221,   368,   222,   363,   191,   357,
-     696,   758,   138,   329,   658,   343,   454,   455,   456,   457,
-     458,   545,   139,   140,   333,   679,   680,   681,   743,   682,
-     744,   141,   334,    59,    72,   283,   284,   285,   286,   393,
-     287,   394,   288,   289,   396,   290,   291,   292,   399,   586,
-     293,   400,   294,   295,   296,   297,   404,   593,   298,   405,
-      89,   306,    90,   307,    91,   308,    92,   305,   598,   599,
-     600,   698,   843,   844,   846,   854,   855,   856,   857,   862,
-     858,   860,   872,   873,   874,   881,   882,   883,   888,   884,
-     885,   886
+     151,   126,   318,   127,   319,   629,   630,   631,   732,   884,
+     632,   733,   633,   734,   634,   735,   635,   232,   375,   637,
+     638,   639,   640,   641,   741,   642,   742,   643,   644,   645,
+     646,   647,   648,   649,   650,   651,   652,   752,   653,   654,
+     655,   656,   657,   128,   328,   680,   681,   682,   683,   684,
+     685,   686,   129,   330,   690,   691,   692,   777,    57,    71,
+     264,   265,   266,   388,   267,   389,   130,   331,   699,   700,
+     701,   702,   703,   704,   705,   706,   131,   324,   660,   661,
+     662,   761,    45,    65,   172,   173,   174,   349,   175,   344,
+     176,   345,   177,   346,   178,   350,   179,   351,   180,   355,
+     181,   354,   560,   182,   183,   132,   327,   672,   673,   674,
+     770,   850,   851,   133,   325,    51,    68,   664,   665,   666,
+     764,    53,    69,   233,   234,   235,   236,   237,   238,   239,
+     374,   240,   378,   241,   377,   242,   243,   379,   244,   134,
+     326,   668,   669,   670,   767,    55,    70,   252,   253,   254,
+     255,   256,   383,   257,   258,   259,   260,   185,   347,   718,
+     719,   720,   797,    47,    66,   195,   196,   197,   360,   186,
+     348,   187,   356,   722,   723,   724,   800,    49,    67,   209,
+     210,   211,   135,   315,   136,   316,   137,   317,   215,   370,
+     216,   364,   217,   365,   218,   367,   219,   366,   220,   369,
+     221,   368,   222,   363,   191,   357,   726,   803,   138,   329,
+     688,   343,   454,   455,   456,   457,   458,   545,   139,   140,
+     333,   709,   710,   711,   788,   712,   789,   141,   334,    59,
+      72,   283,   284,   285,   286,   393,   287,   394,   288,   289,
+     396,   290,   291,   292,   399,   586,   293,   400,   294,   295,
+     296,   297,   404,   593,   298,   405,    89,   306,    90,   307,
+      91,   308,    92,   305,   598,   599,   600,   728,   904,   905,
+     907,   915,   916,   917,   918,   923,   919,   921,   933,   934,
+     935,   942,   943,   944,   949,   945,   946,   947
   };
 
   const unsigned short int
   Dhcp4Parser::yytable_[] =
   {
       85,   249,   223,   167,   193,   207,   250,   231,   248,   263,
-     282,    73,   198,   786,   657,   184,   194,   208,    79,   787,
-     188,   168,   212,   189,   251,   213,   224,   789,   190,   152,
-     214,   169,   584,   152,   225,   170,   171,    27,   796,    28,
-      26,    29,    38,    95,    96,    97,    98,    96,    97,    98,
-      40,   225,    42,   226,   227,   107,    44,   228,   229,   230,
-     728,   261,   262,   729,   101,   102,   103,   192,   157,   153,
-     154,   155,    46,   107,    48,   106,   107,   225,    50,   152,
-     588,   589,   590,   591,   156,    52,   157,   158,   159,   160,
-     161,   162,   163,    95,    96,    97,    98,   310,    76,   164,
-     165,   446,   311,   164,    54,   335,   849,   166,   850,   851,
-     336,   592,   341,    56,   101,   102,   103,   342,   105,    84,
-     106,   786,    58,   107,   225,   142,   143,   787,    84,   144,
-      80,   358,   145,   585,   730,   789,   359,   731,   159,    81,
-      82,    83,   163,   261,   262,    84,   796,   361,   390,   164,
-      84,    93,   362,   391,    84,   847,   875,   166,   848,   876,
-      94,    95,    96,    97,    98,    99,   100,   299,    84,   539,
-     540,    84,   663,   664,   665,   666,   667,   668,    30,    31,
-      32,    33,   101,   102,   103,   104,   105,   406,   542,   543,
-     106,   107,   407,   225,   245,   226,   227,   246,   247,   300,
-     335,   108,    96,    97,    98,   697,   301,   788,   645,   646,
-     647,   648,   799,   649,   109,   110,   877,   699,    84,   878,
-     879,   880,   700,   341,   713,   677,   678,   111,   701,   714,
-     112,   107,   302,   303,   713,   741,   371,   113,   114,   715,
-     742,   115,   745,   372,   406,   358,   373,   746,    85,   747,
-     830,   408,   409,   833,   381,   199,   309,   313,   834,   200,
-     201,   202,   203,   204,   205,   390,   206,   361,   863,   386,
-     835,   892,   839,   864,   448,   314,   893,   449,   557,   558,
-     559,   447,   820,   821,   822,   823,    84,    84,   320,   321,
-     322,   323,   332,   450,   340,   352,   167,   353,   451,   193,
-     376,   452,   380,   382,   410,   384,   453,   198,   184,   385,
-     207,   194,   387,   188,   168,   788,   189,   392,   249,   418,
-     231,   190,   208,   250,   169,   248,    84,   212,   170,   171,
-     213,   395,   397,   398,   401,   214,   402,   403,   411,   412,
-     413,   251,   602,   414,   282,   415,   417,   603,   604,   605,
-     606,   607,   608,   609,   610,   611,   612,   419,   420,   421,
-     422,   423,   424,   425,   518,   519,   520,   225,   268,   269,
+     282,    73,   198,   846,   224,   184,   194,   208,   687,    79,
+     188,   168,   212,   189,   251,   213,   847,   310,   190,   152,
+     214,   169,   311,   584,   849,   170,   171,    27,    26,    28,
+      38,    29,    40,    95,    96,    97,    98,    96,    97,    98,
+     856,    96,    97,    98,   225,   152,   226,   227,   152,   225,
+     228,   229,   230,    42,   107,    44,   225,   245,   226,   227,
+     246,   247,    95,    96,    97,    98,   192,   157,   335,   101,
+     102,   103,   341,   336,   153,   154,   155,   342,   107,   358,
+     106,   107,   225,   361,   359,   107,   261,   262,   362,   156,
+      46,   157,   158,   159,   160,   161,   162,   163,   101,   102,
+     103,    48,   105,    50,   164,   165,   446,   107,   225,   199,
+     261,   262,   166,   200,   201,   202,   203,   204,   205,    52,
+     206,   910,   159,   911,   912,    54,   163,   846,   142,   143,
+     164,   773,   144,   164,   774,   145,    80,    56,    84,   585,
+     847,   166,    93,    84,    84,    81,    82,    83,   849,    84,
+      84,    94,    95,    96,    97,    98,    99,   100,   938,    58,
+      84,   939,   940,   941,   856,    76,   390,   588,   589,   590,
+     591,   391,   406,    84,   335,   775,    84,   407,   776,   727,
+      84,   299,   729,    30,    31,    32,    33,   730,   101,   102,
+     103,   104,   105,   302,   341,   758,   106,   107,   592,   731,
+     759,   758,    84,   539,   540,   106,   760,   108,     1,     2,
+       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
+     109,   110,   300,   693,   694,   695,   696,   697,   698,   675,
+     676,   677,   678,   111,   679,   786,   112,   301,    85,   303,
+     787,   408,   409,   113,   114,   790,   848,   115,   406,   358,
+     791,   859,   894,   792,   891,   390,   361,   895,   924,   908,
+     896,   900,   909,   925,   448,   953,   936,   449,   371,   937,
+     954,   447,   880,   881,   882,   883,   557,   558,   559,   707,
+     708,   542,   543,   450,   309,   313,   167,   314,   451,   193,
+     320,   452,    84,   321,   322,   372,   453,   198,   184,   323,
+     207,   194,   332,   188,   168,   340,   189,   352,   249,   353,
+     231,   190,   208,   250,   169,   248,   373,   212,   170,   171,
+     213,   376,   380,   381,   382,   214,   384,   385,   386,   387,
+     418,   251,   392,   395,   282,   397,   398,   401,   402,   403,
+     411,   410,   412,   413,   425,   414,   415,   417,   419,   420,
+     421,   422,   423,   424,   518,   519,   520,   426,   427,   428,
+     429,   430,   431,   432,   433,   434,   435,   602,   436,   437,
+     848,   438,   603,   604,   605,   606,   607,   608,   609,   610,
+     611,   612,   613,   614,   615,   616,   617,   618,   619,   620,
+     621,   622,   623,   624,   625,   626,   627,   439,   441,   442,
+     443,   444,   459,   460,   461,   462,   463,   225,   268,   269,
      270,   271,   272,   273,   274,   275,   276,   277,   278,   279,
-     280,   281,     1,     2,     3,     4,     5,     6,     7,     8,
-       9,    10,    11,    12,   426,   429,   427,   430,   428,   431,
-     432,   433,   434,   435,   436,   437,   438,   439,   441,   442,
-     443,   459,    84,   460,   461,   462,   444,   463,   464,   465,
-     466,   467,   468,   469,   470,   471,   472,   474,   476,   477,
-     478,   479,   480,   481,   482,   483,   485,   486,   488,   487,
-     489,   490,   493,   491,   494,   497,   495,   498,   500,   580,
-     501,   502,   504,   503,   505,   506,   621,   621,   507,   508,
-     509,    84,   512,   613,   613,   510,   595,   511,   513,   515,
-     516,   522,   523,   517,   282,   521,   525,   524,   448,   526,
-     527,   449,   528,   529,   530,   447,   531,   532,   533,   548,
-     549,   534,   535,   536,   537,   546,   547,   450,   550,   551,
-     562,   587,   451,    28,   563,   452,   554,   555,   556,   561,
-     453,   564,   566,   567,   568,   569,   570,   571,   572,   573,
-     574,   575,   576,   577,   578,   579,   581,   582,   583,   594,
-     629,   597,   633,   637,   641,   659,   685,   687,   691,   695,
-     706,   707,   708,   709,   710,   718,   552,   717,   721,   720,
-     723,   724,   726,   727,   734,   733,   735,   736,   737,   738,
-     739,   740,   760,   748,   751,   753,   754,   756,   757,   813,
-     759,   762,   763,   764,   765,   771,   772,   809,   810,   565,
-     818,   812,   766,   819,   861,   831,   842,   768,   767,   832,
-     825,   769,   770,   840,   865,   867,   802,   803,   804,   805,
-     869,   871,   889,   806,   807,   826,   827,   828,   829,   890,
-     891,   894,   416,   836,   596,   440,   837,   838,   445,   841,
-     601,   866,   870,   773,   798,   801,   628,   800,   808,   895,
-     775,   774,   797,   499,   473,   896,   845,   897,   899,   777,
-     776,   492,   778,   779,   621,   814,   815,   496,   686,   816,
-     475,   613,   811,   249,   167,   817,   785,   231,   250,   683,
-     248,   514,   859,   780,   761,   868,   184,   887,   898,     0,
-     263,   188,   168,     0,   189,   792,   251,     0,     0,   190,
-     793,   781,   169,   794,   484,     0,   170,   171,   795,     0,
-     193,   782,     0,   207,     0,   783,   784,     0,   198,     0,
-       0,     0,   194,     0,     0,   208,     0,     0,     0,     0,
-     212,     0,     0,   213,     0,     0,     0,     0,   214,     0,
+     280,   281,   464,   465,   466,   468,   469,   467,   470,   471,
+     472,   474,   476,   477,   478,   479,   480,   481,   482,   580,
+     483,   485,   486,   488,   487,   489,   636,   636,   490,   491,
+     493,   494,    84,   628,   628,   497,   595,   495,   498,   501,
+     500,   502,   503,   504,   282,   507,   505,   508,   448,   506,
+     509,   449,   512,   510,   511,   447,   513,   515,   516,   552,
+     522,   517,   521,   525,   526,   523,   524,   450,   527,   528,
+     529,   530,   451,   531,   532,   452,   533,   534,   537,   535,
+     453,    84,   536,   547,   546,   548,   551,   725,   562,    28,
+     715,   549,   550,   554,   555,   556,   561,   563,   587,   659,
+     663,   667,   597,   671,   564,   689,   566,   567,   717,   568,
+     569,   570,   571,   572,   573,   574,   575,   576,   577,   578,
+     579,   581,   582,   583,   594,   721,   736,   737,   738,   739,
+     740,   743,   744,   745,   746,   747,   748,   749,   750,   751,
+     753,   754,   755,   756,   757,   763,   793,   762,   766,   765,
+     768,   769,   771,   772,   779,   778,   780,   781,   782,   783,
+     784,   785,   796,   799,   798,   801,   802,   812,   805,   804,
+     807,   808,   809,   810,   816,   817,   827,   811,   869,   870,
+     878,   873,   813,   872,   879,   815,   814,   922,   892,   818,
+     893,   819,   820,   824,   821,   822,   901,   903,   823,   926,
+     825,   928,   826,   930,   828,   950,   829,   830,   831,   832,
+     932,   862,   863,   951,   952,   955,   565,   416,   596,   658,
+     864,   865,   866,   867,   927,   601,   440,   833,   885,   858,
+     861,   860,   868,   445,   835,   886,   499,   834,   887,   888,
+     889,   906,   857,   837,   836,   890,   897,   839,   898,   899,
+     902,   473,   931,   838,   875,   496,   492,   957,   874,   636,
+     960,   956,   958,   876,   877,   716,   628,   713,   249,   167,
+     514,   845,   231,   250,   871,   248,   806,   920,   840,   929,
+     948,   184,   484,   959,     0,   263,   188,   168,     0,   189,
+     852,   251,     0,     0,   190,   853,   841,   169,   854,     0,
+       0,   170,   171,   855,     0,   193,   842,     0,   207,     0,
+     843,   844,     0,   198,     0,     0,     0,   194,     0,     0,
+     208,     0,     0,     0,     0,   212,   475,     0,   213,     0,
+       0,     0,     0,   214,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   785,     0,     0,     0,     0,     0,
-       0,   780,     0,     0,     0,     0,     0,   853,     0,     0,
-       0,     0,     0,   792,   852,     0,     0,     0,   793,   781,
-       0,   794,     0,     0,   853,     0,   795,     0,     0,   782,
-       0,   852,     0,   783,   784
+       0,     0,     0,     0,     0,   845,     0,     0,     0,     0,
+       0,     0,   840,     0,     0,     0,     0,     0,   914,     0,
+       0,     0,     0,     0,   852,   913,     0,     0,     0,   853,
+     841,     0,   854,     0,     0,   914,     0,   855,     0,     0,
+     842,     0,   913,     0,   843,   844
   };
 
   const short int
   Dhcp4Parser::yycheck_[] =
   {
       62,    70,    68,    65,    66,    67,    70,    69,    70,    71,
-      72,    60,    66,   725,   532,    65,    66,    67,    10,   725,
-      65,    65,    67,    65,    70,    67,    27,   725,    65,     7,
-      67,    65,    15,     7,    52,    65,    65,     5,   725,     7,
-       0,     9,     7,    21,    22,    23,    24,    22,    23,    24,
-       7,    52,     7,    54,    55,    51,     7,    58,    59,    60,
-       3,    88,    89,     6,    42,    43,    44,    63,    64,    47,
-      48,    49,     7,    51,     7,    50,    51,    52,     7,     7,
-     118,   119,   120,   121,    62,     7,    64,    65,    66,    67,
-      68,    69,    70,    21,    22,    23,    24,     3,   146,    77,
-      78,    76,     8,    77,     7,     3,   124,    85,   126,   127,
-       8,   149,     3,     7,    42,    43,    44,     8,    46,   146,
-      50,   833,     7,    51,    52,    12,    13,   833,   146,    16,
-     122,     3,    19,   116,     3,   833,     8,     6,    66,   131,
-     132,   133,    70,    88,    89,   146,   833,     3,     3,    77,
-     146,    11,     8,     8,   146,     3,     3,    85,     6,     6,
-      20,    21,    22,    23,    24,    25,    26,     6,   146,    14,
-      15,   146,    91,    92,    93,    94,    95,    96,   146,   147,
-     148,   149,    42,    43,    44,    45,    46,     3,    17,    18,
-      50,    51,     8,    52,    53,    54,    55,    56,    57,     3,
-       3,    61,    22,    23,    24,     8,     4,   725,    79,    80,
-      81,    82,   730,    84,    74,    75,   125,     3,   146,   128,
-     129,   130,     8,     3,     3,    99,   100,    87,     8,     8,
-      90,    51,     8,     3,     3,     3,     8,    97,    98,     8,
-       8,   101,     3,     3,     3,     3,     8,     8,   310,     8,
-       8,   300,   301,     3,     8,    75,     4,     4,     8,    79,
-      80,    81,    82,    83,    84,     3,    86,     3,     3,     8,
-       8,     3,     8,     8,   343,     4,     8,   343,    71,    72,
-      73,   343,    28,    29,    30,    31,   146,   146,     4,     4,
-       4,     4,     4,   343,     4,     4,   358,     4,   343,   361,
-       4,   343,     4,     3,   146,     4,   343,   361,   358,     4,
-     372,   361,     3,   358,   358,   833,   358,     4,   387,   149,
-     382,   358,   372,   387,   358,   387,   146,   372,   358,   358,
-     372,     4,     4,     4,     4,   372,     4,     4,     4,     4,
-       4,   387,    27,     4,   406,     4,     4,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,   149,     4,     4,
-       4,     4,     4,   147,   413,   414,   415,    52,   102,   103,
-     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
-     114,   115,   134,   135,   136,   137,   138,   139,   140,   141,
-     142,   143,   144,   145,   147,     4,   147,     4,   147,     4,
-       4,     4,     4,     4,     4,   147,     4,     4,     4,     4,
-       4,     4,   146,     4,     4,     4,   149,     4,     4,     4,
-       4,   147,   149,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,     4,     4,     4,     4,   147,
-       4,     4,     4,   149,   149,     4,   149,     4,   149,   498,
-       4,     4,     4,   147,   147,   147,   525,   526,     4,     4,
-     149,   146,     4,   525,   526,   149,   515,   149,     4,     4,
-       7,   146,   146,     7,   536,     7,     7,   146,   547,     7,
-       5,   547,     5,     5,     5,   547,     5,     5,     5,   146,
-     146,     7,     7,     7,     5,     8,     3,   547,   146,     5,
-       5,   117,   547,     7,     7,   547,   146,   146,   146,   146,
-     547,   146,   146,   146,   146,   146,   146,   146,   146,   146,
-     146,   146,   146,   146,   146,   146,   146,   146,   146,   146,
-       7,   123,     7,     7,     7,     7,     4,     7,     7,    86,
-       4,     4,     4,     4,     4,     3,   463,     6,     3,     6,
+      72,    60,    66,   770,    27,    65,    66,    67,   532,    10,
+      65,    65,    67,    65,    70,    67,   770,     3,    65,     7,
+      67,    65,     8,    15,   770,    65,    65,     5,     0,     7,
+       7,     9,     7,    21,    22,    23,    24,    22,    23,    24,
+     770,    22,    23,    24,    67,     7,    69,    70,     7,    67,
+      73,    74,    75,     7,    66,     7,    67,    68,    69,    70,
+      71,    72,    21,    22,    23,    24,    78,    79,     3,    57,
+      58,    59,     3,     8,    62,    63,    64,     8,    66,     3,
+      65,    66,    67,     3,     8,    66,   103,   104,     8,    77,
+       7,    79,    80,    81,    82,    83,    84,    85,    57,    58,
+      59,     7,    61,     7,    92,    93,    91,    66,    67,    90,
+     103,   104,   100,    94,    95,    96,    97,    98,    99,     7,
+     101,   139,    81,   141,   142,     7,    85,   894,    12,    13,
+      92,     3,    16,    92,     6,    19,   137,     7,   161,   131,
+     894,   100,    11,   161,   161,   146,   147,   148,   894,   161,
+     161,    20,    21,    22,    23,    24,    25,    26,   140,     7,
+     161,   143,   144,   145,   894,   161,     3,   133,   134,   135,
+     136,     8,     3,   161,     3,     3,   161,     8,     6,     8,
+     161,     6,     3,   161,   162,   163,   164,     8,    57,    58,
+      59,    60,    61,     8,     3,     3,    65,    66,   164,     8,
+       8,     3,   161,    14,    15,    65,     8,    76,   149,   150,
+     151,   152,   153,   154,   155,   156,   157,   158,   159,   160,
+      89,    90,     3,   106,   107,   108,   109,   110,   111,    94,
+      95,    96,    97,   102,    99,     3,   105,     4,   310,     3,
+       8,   300,   301,   112,   113,     3,   770,   116,     3,     3,
+       8,   775,     3,     8,     8,     3,     3,     8,     3,     3,
+       8,     8,     6,     8,   343,     3,     3,   343,     8,     6,
+       8,   343,    28,    29,    30,    31,    86,    87,    88,   114,
+     115,    17,    18,   343,     4,     4,   358,     4,   343,   361,
+       4,   343,   161,     4,     4,     3,   343,   361,   358,     4,
+     372,   361,     4,   358,   358,     4,   358,     4,   387,     4,
+     382,   358,   372,   387,   358,   387,     8,   372,   358,   358,
+     372,     4,     4,     8,     3,   372,     4,     4,     8,     3,
+     164,   387,     4,     4,   406,     4,     4,     4,     4,     4,
+       4,   161,     4,     4,   162,     4,     4,     4,   164,     4,
+       4,     4,     4,     4,   413,   414,   415,   162,   162,   162,
+       4,     4,     4,     4,     4,     4,     4,    27,     4,   162,
+     894,     4,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
+      50,    51,    52,    53,    54,    55,    56,     4,     4,     4,
+       4,   164,     4,     4,     4,     4,     4,    67,   117,   118,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,     4,     4,     4,   164,     4,   162,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,     4,   498,
+       4,     4,     4,     4,   162,     4,   525,   526,     4,   164,
+       4,   164,   161,   525,   526,     4,   515,   164,     4,     4,
+     164,     4,   162,     4,   536,     4,   162,     4,   547,   162,
+     164,   547,     4,   164,   164,   547,     4,     4,     7,   463,
+     161,     7,     7,     7,     7,   161,   161,   547,     5,     5,
+       5,     5,   547,     5,     5,   547,     5,     7,     5,     7,
+     547,   161,     7,     3,     8,   161,     5,   101,     5,     7,
+       4,   161,   161,   161,   161,   161,   161,     7,   132,     7,
+       7,     7,   138,     7,   161,     7,   161,   161,     7,   161,
+     161,   161,   161,   161,   161,   161,   161,   161,   161,   161,
+     161,   161,   161,   161,   161,     7,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,     3,   161,     6,     3,     6,
        6,     3,     6,     3,     3,     6,     4,     4,     4,     4,
-       4,     4,     4,   146,   146,     6,     3,     6,     3,     3,
-       8,     4,     4,     4,     4,     4,     4,     4,     4,   476,
-       4,     6,   147,     5,     4,     8,     7,   147,   149,     8,
-     146,   149,   147,     8,     4,     4,   147,   147,   147,   147,
-       5,     7,     4,   147,   147,   146,   146,   146,   146,     4,
-       4,     4,   310,   146,   516,   335,   146,   146,   341,   146,
-     521,   147,   146,   713,   728,   734,   526,   732,   741,   149,
-     718,   716,   727,   390,   358,   147,   833,   147,   146,   721,
-     719,   382,   722,   724,   713,   752,   754,   387,   547,   755,
-     361,   713,   745,   722,   716,   757,   725,   719,   722,   536,
-     722,   406,   847,   725,   699,   863,   716,   875,   892,    -1,
-     732,   716,   716,    -1,   716,   725,   722,    -1,    -1,   716,
-     725,   725,   716,   725,   372,    -1,   716,   716,   725,    -1,
-     752,   725,    -1,   755,    -1,   725,   725,    -1,   752,    -1,
-      -1,    -1,   752,    -1,    -1,   755,    -1,    -1,    -1,    -1,
-     755,    -1,    -1,   755,    -1,    -1,    -1,    -1,   755,    -1,
+       4,     4,   161,     3,     6,     6,     3,   164,     4,     8,
+       4,     4,     4,     4,     4,     4,     4,   162,     4,     4,
+       4,     3,   162,     6,     5,   162,   164,     4,     8,   164,
+       8,   164,   164,   164,   162,   162,     8,     7,   162,     4,
+     162,     4,   162,     5,   162,     4,   162,   162,   162,   162,
+       7,   162,   162,     4,     4,     4,   476,   310,   516,   526,
+     162,   162,   162,   162,   162,   521,   335,   758,   161,   773,
+     779,   777,   786,   341,   763,   161,   390,   761,   161,   161,
+     161,   894,   772,   766,   764,   161,   161,   769,   161,   161,
+     161,   358,   161,   767,   799,   387,   382,   162,   797,   758,
+     161,   164,   162,   800,   802,   547,   758,   536,   767,   761,
+     406,   770,   764,   767,   790,   767,   729,   908,   770,   924,
+     936,   761,   372,   953,    -1,   777,   761,   761,    -1,   761,
+     770,   767,    -1,    -1,   761,   770,   770,   761,   770,    -1,
+      -1,   761,   761,   770,    -1,   797,   770,    -1,   800,    -1,
+     770,   770,    -1,   797,    -1,    -1,    -1,   797,    -1,    -1,
+     800,    -1,    -1,    -1,    -1,   800,   361,    -1,   800,    -1,
+      -1,    -1,    -1,   800,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   833,    -1,    -1,    -1,    -1,    -1,
-      -1,   833,    -1,    -1,    -1,    -1,    -1,   846,    -1,    -1,
-      -1,    -1,    -1,   833,   846,    -1,    -1,    -1,   833,   833,
-      -1,   833,    -1,    -1,   863,    -1,   833,    -1,    -1,   833,
-      -1,   863,    -1,   833,   833
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   894,    -1,    -1,    -1,    -1,
+      -1,    -1,   894,    -1,    -1,    -1,    -1,    -1,   907,    -1,
+      -1,    -1,    -1,    -1,   894,   907,    -1,    -1,    -1,   894,
+     894,    -1,   894,    -1,    -1,   924,    -1,   894,    -1,    -1,
+     894,    -1,   924,    -1,   894,   894
   };
 
   const unsigned short int
   Dhcp4Parser::yystos_[] =
   {
-       0,   134,   135,   136,   137,   138,   139,   140,   141,   142,
-     143,   144,   145,   151,   152,   153,   154,   155,   156,   157,
-     158,   159,   160,   161,   162,   163,     0,     5,     7,     9,
-     146,   147,   148,   149,   164,   165,   166,   171,     7,   180,
-       7,   186,     7,   200,     7,   276,     7,   357,     7,   371,
-       7,   309,     7,   315,     7,   339,     7,   252,     7,   423,
-     172,   167,   181,   187,   201,   277,   358,   372,   310,   316,
-     340,   253,   424,   164,   173,   174,   146,   169,   170,    10,
-     122,   131,   132,   133,   146,   179,   182,   183,   184,   450,
-     452,   454,   456,    11,    20,    21,    22,    23,    24,    25,
-      26,    42,    43,    44,    45,    46,    50,    51,    61,    74,
-      75,    87,    90,    97,    98,   101,   179,   188,   189,   190,
-     191,   192,   193,   194,   195,   196,   211,   213,   237,   246,
-     260,   270,   299,   307,   333,   376,   378,   380,   402,   412,
-     413,   421,    12,    13,    16,    19,   198,   199,   202,   204,
-     207,   210,     7,    47,    48,    49,    62,    64,    65,    66,
-      67,    68,    69,    70,    77,    78,    85,   179,   190,   191,
-     192,   195,   278,   279,   280,   282,   284,   286,   288,   290,
-     292,   294,   297,   298,   333,   351,   363,   365,   376,   378,
-     380,   398,    63,   179,   333,   359,   360,   361,   363,    75,
-      79,    80,    81,    82,    83,    84,    86,   179,   333,   373,
-     374,   375,   376,   378,   380,   382,   384,   386,   388,   390,
-     392,   394,   396,   307,    27,    52,    54,    55,    58,    59,
-      60,   179,   227,   317,   318,   319,   320,   321,   322,   323,
-     325,   327,   329,   330,   332,    53,    56,    57,   179,   227,
-     321,   327,   341,   342,   343,   344,   345,   347,   348,   349,
-     350,    88,    89,   179,   254,   255,   256,   258,   102,   103,
-     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
-     114,   115,   179,   425,   426,   427,   428,   430,   432,   433,
-     435,   436,   437,   440,   442,   443,   444,   445,   448,     6,
-       3,     4,     8,     3,   185,   457,   451,   453,   455,     4,
-       3,     8,   197,     4,     4,   377,   379,   381,   212,   214,
-       4,     4,     4,     4,   271,   308,   334,   300,   238,   403,
-     247,   261,     4,   414,   422,     3,     8,   203,   205,   208,
-       4,     3,     8,   405,   283,   285,   287,   352,   364,   281,
-     289,   291,     4,     4,   295,   293,   366,   399,     3,     8,
-     362,     3,     8,   397,   385,   387,   391,   389,   395,   393,
-     383,     8,     3,     8,   324,   228,     4,   328,   326,   331,
-       4,     8,     3,   346,     4,     4,     8,     3,   257,   259,
-       3,     8,     4,   429,   431,     4,   434,     4,     4,   438,
-     441,     4,     4,     4,   446,   449,     3,     8,   164,   164,
-     146,     4,     4,     4,     4,     4,   183,     4,   149,   149,
-       4,     4,     4,     4,     4,   147,   147,   147,   147,     4,
-       4,     4,     4,     4,     4,     4,     4,   147,     4,     4,
-     189,     4,     4,     4,   149,   199,    76,   179,   227,   307,
-     333,   376,   378,   380,   406,   407,   408,   409,   410,     4,
-       4,     4,     4,     4,     4,     4,     4,   147,   149,     4,
-       4,     4,     4,   279,     4,   360,     4,     4,     4,     4,
-       4,     4,     4,     4,   375,     4,     4,   147,     4,     4,
-       4,   149,   319,     4,   149,   149,   343,     4,     4,   255,
-     149,     4,     4,   147,     4,   147,   147,     4,     4,   149,
-     149,   149,     4,     4,   426,     4,     7,     7,   164,   164,
-     164,     7,   146,   146,   146,     7,     7,     5,     5,     5,
-       5,     5,     5,     5,     7,     7,     7,     5,   175,    14,
-      15,   206,    17,    18,   209,   411,     8,     3,   146,   146,
-     146,     5,   166,   168,   146,   146,   146,    71,    72,    73,
-     296,   146,     5,     7,   146,   175,   146,   146,   146,   146,
-     146,   146,   146,   146,   146,   146,   146,   146,   146,   146,
-     164,   146,   146,   146,    15,   116,   439,   117,   118,   119,
-     120,   121,   149,   447,   146,   164,   188,   123,   458,   459,
-     460,   198,    27,    32,    33,    34,    35,    36,    37,    38,
-      39,    40,    41,   179,   215,   216,   217,   220,   222,   224,
-     226,   227,   229,   230,   231,   232,   233,   235,   215,     7,
-     272,   273,   274,     7,   311,   312,   313,     7,   335,   336,
-     337,     7,   301,   302,   303,    79,    80,    81,    82,    84,
-     239,   240,   241,   242,   243,   244,   245,   292,   404,     7,
-     248,   249,   250,    91,    92,    93,    94,    95,    96,   262,
-     263,   264,   265,   266,   267,   268,   269,    99,   100,   415,
-     416,   417,   419,   425,   176,     4,   408,     7,   353,   354,
-     355,     7,   367,   368,   369,    86,   400,     8,   461,     3,
-       8,     8,   218,   221,   223,   225,     4,     4,     4,     4,
-       4,   234,   236,     3,     8,     8,   275,     6,     3,   314,
-       6,     3,   338,     6,     3,   304,     6,     3,     3,     6,
-       3,     6,   251,     6,     3,     4,     4,     4,     4,     4,
-       4,     3,     8,   418,   420,     3,     8,     8,   146,   177,
-     178,   146,   356,     6,     3,   370,     6,     3,   401,     8,
-       4,   459,     4,     4,     4,     4,   147,   149,   147,   149,
-     147,     4,     4,   216,   278,   274,   317,   313,   341,   337,
-     179,   190,   191,   192,   195,   227,   270,   288,   292,   294,
-     305,   306,   333,   376,   378,   380,   398,   303,   240,   292,
-     254,   250,   147,   147,   147,   147,   147,   147,   263,     4,
-       4,   416,     6,     3,   359,   355,   373,   369,     4,     5,
-      28,    29,    30,    31,   219,   146,   146,   146,   146,   146,
-       8,     8,     8,     3,     8,     8,   146,   146,   146,     8,
-       8,   146,     7,   462,   463,   306,   464,     3,     6,   124,
-     126,   127,   179,   227,   465,   466,   467,   468,   470,   463,
-     471,     4,   469,     3,     8,     4,   147,     4,   466,     5,
-     146,     7,   472,   473,   474,     3,     6,   125,   128,   129,
-     130,   475,   476,   477,   479,   480,   481,   473,   478,     4,
-       4,     4,     3,     8,     4,   149,   147,   147,   476,   146
+       0,   149,   150,   151,   152,   153,   154,   155,   156,   157,
+     158,   159,   160,   166,   167,   168,   169,   170,   171,   172,
+     173,   174,   175,   176,   177,   178,     0,     5,     7,     9,
+     161,   162,   163,   164,   179,   180,   181,   186,     7,   195,
+       7,   201,     7,   215,     7,   307,     7,   388,     7,   402,
+       7,   340,     7,   346,     7,   370,     7,   283,     7,   454,
+     187,   182,   196,   202,   216,   308,   389,   403,   341,   347,
+     371,   284,   455,   179,   188,   189,   161,   184,   185,    10,
+     137,   146,   147,   148,   161,   194,   197,   198,   199,   481,
+     483,   485,   487,    11,    20,    21,    22,    23,    24,    25,
+      26,    57,    58,    59,    60,    61,    65,    66,    76,    89,
+      90,   102,   105,   112,   113,   116,   194,   203,   204,   205,
+     206,   207,   208,   209,   210,   211,   226,   228,   268,   277,
+     291,   301,   330,   338,   364,   407,   409,   411,   433,   443,
+     444,   452,    12,    13,    16,    19,   213,   214,   217,   219,
+     222,   225,     7,    62,    63,    64,    77,    79,    80,    81,
+      82,    83,    84,    85,    92,    93,   100,   194,   205,   206,
+     207,   210,   309,   310,   311,   313,   315,   317,   319,   321,
+     323,   325,   328,   329,   364,   382,   394,   396,   407,   409,
+     411,   429,    78,   194,   364,   390,   391,   392,   394,    90,
+      94,    95,    96,    97,    98,    99,   101,   194,   364,   404,
+     405,   406,   407,   409,   411,   413,   415,   417,   419,   421,
+     423,   425,   427,   338,    27,    67,    69,    70,    73,    74,
+      75,   194,   242,   348,   349,   350,   351,   352,   353,   354,
+     356,   358,   360,   361,   363,    68,    71,    72,   194,   242,
+     352,   358,   372,   373,   374,   375,   376,   378,   379,   380,
+     381,   103,   104,   194,   285,   286,   287,   289,   117,   118,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,   194,   456,   457,   458,   459,   461,   463,   464,
+     466,   467,   468,   471,   473,   474,   475,   476,   479,     6,
+       3,     4,     8,     3,   200,   488,   482,   484,   486,     4,
+       3,     8,   212,     4,     4,   408,   410,   412,   227,   229,
+       4,     4,     4,     4,   302,   339,   365,   331,   269,   434,
+     278,   292,     4,   445,   453,     3,     8,   218,   220,   223,
+       4,     3,     8,   436,   314,   316,   318,   383,   395,   312,
+     320,   322,     4,     4,   326,   324,   397,   430,     3,     8,
+     393,     3,     8,   428,   416,   418,   422,   420,   426,   424,
+     414,     8,     3,     8,   355,   243,     4,   359,   357,   362,
+       4,     8,     3,   377,     4,     4,     8,     3,   288,   290,
+       3,     8,     4,   460,   462,     4,   465,     4,     4,   469,
+     472,     4,     4,     4,   477,   480,     3,     8,   179,   179,
+     161,     4,     4,     4,     4,     4,   198,     4,   164,   164,
+       4,     4,     4,     4,     4,   162,   162,   162,   162,     4,
+       4,     4,     4,     4,     4,     4,     4,   162,     4,     4,
+     204,     4,     4,     4,   164,   214,    91,   194,   242,   338,
+     364,   407,   409,   411,   437,   438,   439,   440,   441,     4,
+       4,     4,     4,     4,     4,     4,     4,   162,   164,     4,
+       4,     4,     4,   310,     4,   391,     4,     4,     4,     4,
+       4,     4,     4,     4,   406,     4,     4,   162,     4,     4,
+       4,   164,   350,     4,   164,   164,   374,     4,     4,   286,
+     164,     4,     4,   162,     4,   162,   162,     4,     4,   164,
+     164,   164,     4,     4,   457,     4,     7,     7,   179,   179,
+     179,     7,   161,   161,   161,     7,     7,     5,     5,     5,
+       5,     5,     5,     5,     7,     7,     7,     5,   190,    14,
+      15,   221,    17,    18,   224,   442,     8,     3,   161,   161,
+     161,     5,   181,   183,   161,   161,   161,    86,    87,    88,
+     327,   161,     5,     7,   161,   190,   161,   161,   161,   161,
+     161,   161,   161,   161,   161,   161,   161,   161,   161,   161,
+     179,   161,   161,   161,    15,   131,   470,   132,   133,   134,
+     135,   136,   164,   478,   161,   179,   203,   138,   489,   490,
+     491,   213,    27,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,    41,    42,    43,    44,    45,    46,    47,    48,
+      49,    50,    51,    52,    53,    54,    55,    56,   194,   230,
+     231,   232,   235,   237,   239,   241,   242,   244,   245,   246,
+     247,   248,   250,   252,   253,   254,   255,   256,   257,   258,
+     259,   260,   261,   263,   264,   265,   266,   267,   230,     7,
+     303,   304,   305,     7,   342,   343,   344,     7,   366,   367,
+     368,     7,   332,   333,   334,    94,    95,    96,    97,    99,
+     270,   271,   272,   273,   274,   275,   276,   323,   435,     7,
+     279,   280,   281,   106,   107,   108,   109,   110,   111,   293,
+     294,   295,   296,   297,   298,   299,   300,   114,   115,   446,
+     447,   448,   450,   456,   191,     4,   439,     7,   384,   385,
+     386,     7,   398,   399,   400,   101,   431,     8,   492,     3,
+       8,     8,   233,   236,   238,   240,     4,     4,     4,     4,
+       4,   249,   251,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,   262,     4,     4,     4,     4,     4,     3,     8,
+       8,   306,     6,     3,   345,     6,     3,   369,     6,     3,
+     335,     6,     3,     3,     6,     3,     6,   282,     6,     3,
+       4,     4,     4,     4,     4,     4,     3,     8,   449,   451,
+       3,     8,     8,   161,   192,   193,   161,   387,     6,     3,
+     401,     6,     3,   432,     8,     4,   490,     4,     4,     4,
+       4,   162,   164,   162,   164,   162,     4,     4,   164,   164,
+     164,   162,   162,   162,   164,   162,   162,     4,   162,   162,
+     162,   162,   162,   231,   309,   305,   348,   344,   372,   368,
+     194,   205,   206,   207,   210,   242,   301,   319,   323,   325,
+     336,   337,   364,   407,   409,   411,   429,   334,   271,   323,
+     285,   281,   162,   162,   162,   162,   162,   162,   294,     4,
+       4,   447,     6,     3,   390,   386,   404,   400,     4,     5,
+      28,    29,    30,    31,   234,   161,   161,   161,   161,   161,
+     161,     8,     8,     8,     3,     8,     8,   161,   161,   161,
+       8,     8,   161,     7,   493,   494,   337,   495,     3,     6,
+     139,   141,   142,   194,   242,   496,   497,   498,   499,   501,
+     494,   502,     4,   500,     3,     8,     4,   162,     4,   497,
+       5,   161,     7,   503,   504,   505,     3,     6,   140,   143,
+     144,   145,   506,   507,   508,   510,   511,   512,   504,   509,
+       4,     4,     4,     3,     8,     4,   164,   162,   162,   507,
+     161
   };
 
   const unsigned short int
   Dhcp4Parser::yyr1_[] =
   {
-       0,   150,   152,   151,   153,   151,   154,   151,   155,   151,
-     156,   151,   157,   151,   158,   151,   159,   151,   160,   151,
-     161,   151,   162,   151,   163,   151,   164,   164,   164,   164,
-     164,   164,   164,   165,   167,   166,   168,   169,   169,   170,
-     170,   172,   171,   173,   173,   174,   174,   176,   175,   177,
-     177,   178,   178,   179,   181,   180,   182,   182,   183,   183,
-     183,   183,   183,   183,   185,   184,   187,   186,   188,   188,
-     189,   189,   189,   189,   189,   189,   189,   189,   189,   189,
-     189,   189,   189,   189,   189,   189,   189,   189,   189,   189,
-     189,   189,   189,   189,   190,   191,   192,   193,   194,   195,
-     197,   196,   198,   198,   199,   199,   199,   199,   201,   200,
-     203,   202,   205,   204,   206,   206,   208,   207,   209,   209,
-     210,   212,   211,   214,   213,   215,   215,   216,   216,   216,
-     216,   216,   216,   216,   216,   216,   216,   216,   216,   216,
-     218,   217,   219,   219,   219,   219,   221,   220,   223,   222,
-     225,   224,   226,   228,   227,   229,   230,   231,   232,   234,
-     233,   236,   235,   238,   237,   239,   239,   240,   240,   240,
-     240,   240,   241,   242,   243,   244,   245,   247,   246,   248,
-     248,   249,   249,   251,   250,   253,   252,   254,   254,   254,
-     255,   255,   257,   256,   259,   258,   261,   260,   262,   262,
-     263,   263,   263,   263,   263,   263,   264,   265,   266,   267,
-     268,   269,   271,   270,   272,   272,   273,   273,   275,   274,
-     277,   276,   278,   278,   279,   279,   279,   279,   279,   279,
-     279,   279,   279,   279,   279,   279,   279,   279,   279,   279,
-     279,   279,   279,   279,   279,   279,   279,   281,   280,   283,
-     282,   285,   284,   287,   286,   289,   288,   291,   290,   293,
-     292,   295,   294,   296,   296,   296,   297,   298,   300,   299,
-     301,   301,   302,   302,   304,   303,   305,   305,   306,   306,
-     306,   306,   306,   306,   306,   306,   306,   306,   306,   306,
-     306,   306,   306,   308,   307,   310,   309,   311,   311,   312,
-     312,   314,   313,   316,   315,   317,   317,   318,   318,   319,
-     319,   319,   319,   319,   319,   319,   319,   320,   321,   322,
-     324,   323,   326,   325,   328,   327,   329,   331,   330,   332,
-     334,   333,   335,   335,   336,   336,   338,   337,   340,   339,
-     341,   341,   342,   342,   343,   343,   343,   343,   343,   343,
-     343,   344,   346,   345,   347,   348,   349,   350,   352,   351,
-     353,   353,   354,   354,   356,   355,   358,   357,   359,   359,
-     360,   360,   360,   360,   362,   361,   364,   363,   366,   365,
-     367,   367,   368,   368,   370,   369,   372,   371,   373,   373,
-     374,   374,   375,   375,   375,   375,   375,   375,   375,   375,
-     375,   375,   375,   375,   375,   377,   376,   379,   378,   381,
-     380,   383,   382,   385,   384,   387,   386,   389,   388,   391,
-     390,   393,   392,   395,   394,   397,   396,   399,   398,   401,
-     400,   403,   402,   404,   404,   405,   292,   406,   406,   407,
-     407,   408,   408,   408,   408,   408,   408,   408,   408,   409,
-     411,   410,   412,   414,   413,   415,   415,   416,   416,   418,
-     417,   420,   419,   422,   421,   424,   423,   425,   425,   426,
-     426,   426,   426,   426,   426,   426,   426,   426,   426,   426,
-     426,   426,   426,   426,   427,   429,   428,   431,   430,   432,
-     434,   433,   435,   436,   438,   437,   439,   439,   441,   440,
-     442,   443,   444,   446,   445,   447,   447,   447,   447,   447,
-     449,   448,   451,   450,   453,   452,   455,   454,   457,   456,
-     458,   458,   459,   461,   460,   462,   462,   464,   463,   465,
-     465,   466,   466,   466,   466,   466,   467,   469,   468,   471,
-     470,   472,   472,   474,   473,   475,   475,   476,   476,   476,
-     476,   478,   477,   479,   480,   481
+       0,   165,   167,   166,   168,   166,   169,   166,   170,   166,
+     171,   166,   172,   166,   173,   166,   174,   166,   175,   166,
+     176,   166,   177,   166,   178,   166,   179,   179,   179,   179,
+     179,   179,   179,   180,   182,   181,   183,   184,   184,   185,
+     185,   187,   186,   188,   188,   189,   189,   191,   190,   192,
+     192,   193,   193,   194,   196,   195,   197,   197,   198,   198,
+     198,   198,   198,   198,   200,   199,   202,   201,   203,   203,
+     204,   204,   204,   204,   204,   204,   204,   204,   204,   204,
+     204,   204,   204,   204,   204,   204,   204,   204,   204,   204,
+     204,   204,   204,   204,   205,   206,   207,   208,   209,   210,
+     212,   211,   213,   213,   214,   214,   214,   214,   216,   215,
+     218,   217,   220,   219,   221,   221,   223,   222,   224,   224,
+     225,   227,   226,   229,   228,   230,   230,   231,   231,   231,
+     231,   231,   231,   231,   231,   231,   231,   231,   231,   231,
+     231,   231,   231,   231,   231,   231,   231,   231,   231,   231,
+     231,   231,   231,   231,   231,   233,   232,   234,   234,   234,
+     234,   236,   235,   238,   237,   240,   239,   241,   243,   242,
+     244,   245,   246,   247,   249,   248,   251,   250,   252,   253,
+     254,   255,   256,   257,   258,   259,   260,   262,   261,   263,
+     264,   265,   266,   267,   269,   268,   270,   270,   271,   271,
+     271,   271,   271,   272,   273,   274,   275,   276,   278,   277,
+     279,   279,   280,   280,   282,   281,   284,   283,   285,   285,
+     285,   286,   286,   288,   287,   290,   289,   292,   291,   293,
+     293,   294,   294,   294,   294,   294,   294,   295,   296,   297,
+     298,   299,   300,   302,   301,   303,   303,   304,   304,   306,
+     305,   308,   307,   309,   309,   310,   310,   310,   310,   310,
+     310,   310,   310,   310,   310,   310,   310,   310,   310,   310,
+     310,   310,   310,   310,   310,   310,   310,   310,   312,   311,
+     314,   313,   316,   315,   318,   317,   320,   319,   322,   321,
+     324,   323,   326,   325,   327,   327,   327,   328,   329,   331,
+     330,   332,   332,   333,   333,   335,   334,   336,   336,   337,
+     337,   337,   337,   337,   337,   337,   337,   337,   337,   337,
+     337,   337,   337,   337,   339,   338,   341,   340,   342,   342,
+     343,   343,   345,   344,   347,   346,   348,   348,   349,   349,
+     350,   350,   350,   350,   350,   350,   350,   350,   351,   352,
+     353,   355,   354,   357,   356,   359,   358,   360,   362,   361,
+     363,   365,   364,   366,   366,   367,   367,   369,   368,   371,
+     370,   372,   372,   373,   373,   374,   374,   374,   374,   374,
+     374,   374,   375,   377,   376,   378,   379,   380,   381,   383,
+     382,   384,   384,   385,   385,   387,   386,   389,   388,   390,
+     390,   391,   391,   391,   391,   393,   392,   395,   394,   397,
+     396,   398,   398,   399,   399,   401,   400,   403,   402,   404,
+     404,   405,   405,   406,   406,   406,   406,   406,   406,   406,
+     406,   406,   406,   406,   406,   406,   408,   407,   410,   409,
+     412,   411,   414,   413,   416,   415,   418,   417,   420,   419,
+     422,   421,   424,   423,   426,   425,   428,   427,   430,   429,
+     432,   431,   434,   433,   435,   435,   436,   323,   437,   437,
+     438,   438,   439,   439,   439,   439,   439,   439,   439,   439,
+     440,   442,   441,   443,   445,   444,   446,   446,   447,   447,
+     449,   448,   451,   450,   453,   452,   455,   454,   456,   456,
+     457,   457,   457,   457,   457,   457,   457,   457,   457,   457,
+     457,   457,   457,   457,   457,   458,   460,   459,   462,   461,
+     463,   465,   464,   466,   467,   469,   468,   470,   470,   472,
+     471,   473,   474,   475,   477,   476,   478,   478,   478,   478,
+     478,   480,   479,   482,   481,   484,   483,   486,   485,   488,
+     487,   489,   489,   490,   492,   491,   493,   493,   495,   494,
+     496,   496,   497,   497,   497,   497,   497,   498,   500,   499,
+     502,   501,   503,   503,   505,   504,   506,   506,   507,   507,
+     507,   507,   509,   508,   510,   511,   512
   };
 
   const unsigned char
@@ -4103,48 +4285,51 @@ namespace isc { namespace dhcp {
        0,     4,     0,     4,     1,     1,     0,     4,     1,     1,
        3,     0,     6,     0,     6,     1,     3,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       0,     4,     1,     1,     1,     1,     0,     4,     0,     4,
-       0,     4,     3,     0,     4,     3,     3,     3,     3,     0,
-       4,     0,     4,     0,     6,     1,     3,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     0,     6,     0,
-       1,     1,     3,     0,     4,     0,     4,     1,     3,     1,
-       1,     1,     0,     4,     0,     4,     0,     6,     1,     3,
-       1,     1,     1,     1,     1,     1,     3,     3,     3,     3,
-       3,     3,     0,     6,     0,     1,     1,     3,     0,     4,
-       0,     4,     1,     3,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     0,     4,     0,
-       4,     0,     4,     0,     4,     0,     4,     0,     4,     0,
-       4,     0,     4,     1,     1,     1,     3,     3,     0,     6,
-       0,     1,     1,     3,     0,     4,     1,     3,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     0,     6,     0,     4,     0,     1,     1,
-       3,     0,     4,     0,     4,     0,     1,     1,     3,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     3,     1,
-       0,     4,     0,     4,     0,     4,     1,     0,     4,     3,
-       0,     6,     0,     1,     1,     3,     0,     4,     0,     4,
-       0,     1,     1,     3,     1,     1,     1,     1,     1,     1,
-       1,     1,     0,     4,     1,     1,     3,     3,     0,     6,
+       1,     1,     1,     1,     1,     0,     4,     1,     1,     1,
+       1,     0,     4,     0,     4,     0,     4,     3,     0,     4,
+       3,     3,     3,     3,     0,     4,     0,     4,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     0,     4,     3,
+       3,     3,     3,     3,     0,     6,     1,     3,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     0,     6,
        0,     1,     1,     3,     0,     4,     0,     4,     1,     3,
-       1,     1,     1,     1,     0,     4,     0,     4,     0,     6,
-       0,     1,     1,     3,     0,     4,     0,     4,     0,     1,
-       1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     0,     4,     0,     4,     0,
-       4,     0,     4,     0,     4,     0,     4,     0,     4,     0,
-       4,     0,     4,     0,     4,     0,     4,     0,     6,     0,
-       4,     0,     6,     1,     3,     0,     4,     0,     1,     1,
-       3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       0,     4,     3,     0,     6,     1,     3,     1,     1,     0,
-       4,     0,     4,     0,     6,     0,     4,     1,     3,     1,
+       1,     1,     1,     0,     4,     0,     4,     0,     6,     1,
+       3,     1,     1,     1,     1,     1,     1,     3,     3,     3,
+       3,     3,     3,     0,     6,     0,     1,     1,     3,     0,
+       4,     0,     4,     1,     3,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     3,     0,     4,     0,     4,     3,
-       0,     4,     3,     3,     0,     4,     1,     1,     0,     4,
-       3,     3,     3,     0,     4,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     0,     4,
+       0,     4,     0,     4,     0,     4,     0,     4,     0,     4,
+       0,     4,     0,     4,     1,     1,     1,     3,     3,     0,
+       6,     0,     1,     1,     3,     0,     4,     1,     3,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     0,     6,     0,     4,     0,     1,
+       1,     3,     0,     4,     0,     4,     0,     1,     1,     3,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     3,
+       1,     0,     4,     0,     4,     0,     4,     1,     0,     4,
+       3,     0,     6,     0,     1,     1,     3,     0,     4,     0,
+       4,     0,     1,     1,     3,     1,     1,     1,     1,     1,
+       1,     1,     1,     0,     4,     1,     1,     3,     3,     0,
+       6,     0,     1,     1,     3,     0,     4,     0,     4,     1,
+       3,     1,     1,     1,     1,     0,     4,     0,     4,     0,
+       6,     0,     1,     1,     3,     0,     4,     0,     4,     0,
+       1,     1,     3,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     0,     4,     0,     4,
+       0,     4,     0,     4,     0,     4,     0,     4,     0,     4,
        0,     4,     0,     4,     0,     4,     0,     4,     0,     6,
-       1,     3,     1,     0,     6,     1,     3,     0,     4,     1,
-       3,     1,     1,     1,     1,     1,     3,     0,     4,     0,
-       6,     1,     3,     0,     4,     1,     3,     1,     1,     1,
-       1,     0,     4,     3,     3,     3
+       0,     4,     0,     6,     1,     3,     0,     4,     0,     1,
+       1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     0,     4,     3,     0,     6,     1,     3,     1,     1,
+       0,     4,     0,     4,     0,     6,     0,     4,     1,     3,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     3,     0,     4,     0,     4,
+       3,     0,     4,     3,     3,     0,     4,     1,     1,     0,
+       4,     3,     3,     3,     0,     4,     1,     1,     1,     1,
+       1,     0,     4,     0,     4,     0,     4,     0,     4,     0,
+       6,     1,     3,     1,     0,     6,     1,     3,     0,     4,
+       1,     3,     1,     1,     1,     1,     1,     3,     0,     4,
+       0,     6,     1,     3,     0,     4,     1,     3,     1,     1,
+       1,     1,     0,     4,     3,     3,     3
   };
 
 
@@ -4164,47 +4349,52 @@ namespace isc { namespace dhcp {
   "\"type\"", "\"memfile\"", "\"mysql\"", "\"postgresql\"", "\"cql\"",
   "\"user\"", "\"password\"", "\"host\"", "\"port\"", "\"persist\"",
   "\"lfc-interval\"", "\"readonly\"", "\"connect-timeout\"",
-  "\"contact-points\"", "\"keyspace\"", "\"valid-lifetime\"",
-  "\"renew-timer\"", "\"rebind-timer\"", "\"decline-probation-period\"",
-  "\"subnet4\"", "\"4o6-interface\"", "\"4o6-interface-id\"",
-  "\"4o6-subnet\"", "\"option-def\"", "\"option-data\"", "\"name\"",
-  "\"data\"", "\"code\"", "\"space\"", "\"csv-format\"", "\"always-send\"",
-  "\"record-types\"", "\"encapsulate\"", "\"array\"",
-  "\"shared-networks\"", "\"pools\"", "\"pool\"", "\"user-context\"",
-  "\"subnet\"", "\"interface\"", "\"interface-id\"", "\"id\"",
-  "\"rapid-commit\"", "\"reservation-mode\"", "\"disabled\"",
-  "\"out-of-pool\"", "\"all\"", "\"host-reservation-identifiers\"",
-  "\"client-classes\"", "\"test\"", "\"client-class\"", "\"reservations\"",
-  "\"duid\"", "\"hw-address\"", "\"circuit-id\"", "\"client-id\"",
-  "\"hostname\"", "\"flex-id\"", "\"relay\"", "\"ip-address\"",
-  "\"hooks-libraries\"", "\"library\"", "\"parameters\"",
-  "\"expired-leases-processing\"", "\"reclaim-timer-wait-time\"",
-  "\"flush-reclaimed-timer-wait-time\"", "\"hold-reclaimed-time\"",
-  "\"max-reclaim-leases\"", "\"max-reclaim-time\"",
-  "\"unwarned-reclaim-cycles\"", "\"dhcp4o6-port\"", "\"control-socket\"",
-  "\"socket-type\"", "\"socket-name\"", "\"dhcp-ddns\"",
-  "\"enable-updates\"", "\"qualifying-suffix\"", "\"server-ip\"",
-  "\"server-port\"", "\"sender-ip\"", "\"sender-port\"",
-  "\"max-queue-size\"", "\"ncr-protocol\"", "\"ncr-format\"",
-  "\"always-include-fqdn\"", "\"override-no-update\"",
-  "\"override-client-update\"", "\"replace-client-name\"",
-  "\"generated-prefix\"", "\"tcp\"", "\"JSON\"", "\"when-present\"",
-  "\"never\"", "\"always\"", "\"when-not-present\"", "\"Logging\"",
-  "\"loggers\"", "\"output_options\"", "\"output\"", "\"debuglevel\"",
-  "\"severity\"", "\"flush\"", "\"maxsize\"", "\"maxver\"", "\"Dhcp6\"",
-  "\"DhcpDdns\"", "\"Control-agent\"", "TOPLEVEL_JSON", "TOPLEVEL_DHCP4",
-  "SUB_DHCP4", "SUB_INTERFACES4", "SUB_SUBNET4", "SUB_POOL4",
-  "SUB_RESERVATION", "SUB_OPTION_DEFS", "SUB_OPTION_DEF",
-  "SUB_OPTION_DATA", "SUB_HOOKS_LIBRARY", "SUB_DHCP_DDNS",
-  "\"constant string\"", "\"integer\"", "\"floating point\"",
-  "\"boolean\"", "$accept", "start", "$@1", "$@2", "$@3", "$@4", "$@5",
-  "$@6", "$@7", "$@8", "$@9", "$@10", "$@11", "$@12", "value", "sub_json",
-  "map2", "$@13", "map_value", "map_content", "not_empty_map",
-  "list_generic", "$@14", "list_content", "not_empty_list", "list_strings",
-  "$@15", "list_strings_content", "not_empty_list_strings",
-  "unknown_map_entry", "syntax_map", "$@16", "global_objects",
-  "global_object", "dhcp4_object", "$@17", "sub_dhcp4", "$@18",
-  "global_params", "global_param", "valid_lifetime", "renew_timer",
+  "\"contact-points\"", "\"keyspace\"", "\"packed\"", "\"group-commit\"",
+  "\"group-commit-sync\"", "\"group-commit-max-batch\"",
+  "\"group-commit-max-latency\"", "\"load-threads\"", "\"lfc-in-process\"",
+  "\"lfc-batch-size\"", "\"lfc-batch-interval\"",
+  "\"lfc-snapshot-format\"", "\"cache-size\"", "\"cache-ttl\"",
+  "\"cache-negative-ttl\"", "\"connection-pool-size\"",
+  "\"reconnect-wait-time\"", "\"valid-lifetime\"", "\"renew-timer\"",
+  "\"rebind-timer\"", "\"decline-probation-period\"", "\"subnet4\"",
+  "\"4o6-interface\"", "\"4o6-interface-id\"", "\"4o6-subnet\"",
+  "\"option-def\"", "\"option-data\"", "\"name\"", "\"data\"", "\"code\"",
+  "\"space\"", "\"csv-format\"", "\"always-send\"", "\"record-types\"",
+  "\"encapsulate\"", "\"array\"", "\"shared-networks\"", "\"pools\"",
+  "\"pool\"", "\"user-context\"", "\"subnet\"", "\"interface\"",
+  "\"interface-id\"", "\"id\"", "\"rapid-commit\"", "\"reservation-mode\"",
+  "\"disabled\"", "\"out-of-pool\"", "\"all\"",
+  "\"host-reservation-identifiers\"", "\"client-classes\"", "\"test\"",
+  "\"client-class\"", "\"reservations\"", "\"duid\"", "\"hw-address\"",
+  "\"circuit-id\"", "\"client-id\"", "\"hostname\"", "\"flex-id\"",
+  "\"relay\"", "\"ip-address\"", "\"hooks-libraries\"", "\"library\"",
+  "\"parameters\"", "\"expired-leases-processing\"",
+  "\"reclaim-timer-wait-time\"", "\"flush-reclaimed-timer-wait-time\"",
+  "\"hold-reclaimed-time\"", "\"max-reclaim-leases\"",
+  "\"max-reclaim-time\"", "\"unwarned-reclaim-cycles\"",
+  "\"dhcp4o6-port\"", "\"control-socket\"", "\"socket-type\"",
+  "\"socket-name\"", "\"dhcp-ddns\"", "\"enable-updates\"",
+  "\"qualifying-suffix\"", "\"server-ip\"", "\"server-port\"",
+  "\"sender-ip\"", "\"sender-port\"", "\"max-queue-size\"",
+  "\"ncr-protocol\"", "\"ncr-format\"", "\"always-include-fqdn\"",
+  "\"override-no-update\"", "\"override-client-update\"",
+  "\"replace-client-name\"", "\"generated-prefix\"", "\"tcp\"", "\"JSON\"",
+  "\"when-present\"", "\"never\"", "\"always\"", "\"when-not-present\"",
+  "\"Logging\"", "\"loggers\"", "\"output_options\"", "\"output\"",
+  "\"debuglevel\"", "\"severity\"", "\"flush\"", "\"maxsize\"",
+  "\"maxver\"", "\"Dhcp6\"", "\"DhcpDdns\"", "\"Control-agent\"",
+  "TOPLEVEL_JSON", "TOPLEVEL_DHCP4", "SUB_DHCP4", "SUB_INTERFACES4",
+  "SUB_SUBNET4", "SUB_POOL4", "SUB_RESERVATION", "SUB_OPTION_DEFS",
+  "SUB_OPTION_DEF", "SUB_OPTION_DATA", "SUB_HOOKS_LIBRARY",
+  "SUB_DHCP_DDNS", "\"constant string\"", "\"integer\"",
+  "\"floating point\"", "\"boolean\"", "$accept", "start", "$@1", "$@2",
+  "$@3", "$@4", "$@5", "$@6", "$@7", "$@8", "$@9", "$@10", "$@11", "$@12",
+  "value", "sub_json", "map2", "$@13", "map_value", "map_content",
+  "not_empty_map", "list_generic", "$@14", "list_content",
+  "not_empty_list", "list_strings", "$@15", "list_strings_content",
+  "not_empty_list_strings", "unknown_map_entry", "syntax_map", "$@16",
+  "global_objects", "global_object", "dhcp4_object", "$@17", "sub_dhcp4",
+  "$@18", "global_params", "global_param", "valid_lifetime", "renew_timer",
   "rebind_timer", "decline_probation_period", "echo_client_id",
   "match_client_id", "interfaces_config", "$@19",
   "interfaces_config_params", "interfaces_config_param", "sub_interfaces4",
@@ -4214,68 +4404,72 @@ namespace isc { namespace dhcp {
   "database_map_params", "database_map_param", "database_type", "$@26",
   "db_type", "user", "$@27", "password", "$@28", "host", "$@29", "port",
   "name", "$@30", "persist", "lfc_interval", "readonly", "connect_timeout",
-  "contact_points", "$@31", "keyspace", "$@32",
-  "host_reservation_identifiers", "$@33",
+  "contact_points", "$@31", "keyspace", "$@32", "packed", "group_commit",
+  "group_commit_sync", "group_commit_max_batch",
+  "group_commit_max_latency", "load_threads", "lfc_in_process",
+  "lfc_batch_size", "lfc_batch_interval", "lfc_snapshot_format", "$@33",
+  "cache_size", "cache_ttl", "cache_negative_ttl", "connection_pool_size",
+  "reconnect_wait_time", "host_reservation_identifiers", "$@34",
   "host_reservation_identifiers_list", "host_reservation_identifier",
   "duid_id", "hw_address_id", "circuit_id", "client_id", "flex_id",
-  "hooks_libraries", "$@34", "hooks_libraries_list",
-  "not_empty_hooks_libraries_list", "hooks_library", "$@35",
-  "sub_hooks_library", "$@36", "hooks_params", "hooks_param", "library",
-  "$@37", "parameters", "$@38", "expired_leases_processing", "$@39",
+  "hooks_libraries", "$@35", "hooks_libraries_list",
+  "not_empty_hooks_libraries_list", "hooks_library", "$@36",
+  "sub_hooks_library", "$@37", "hooks_params", "hooks_param", "library",
+  "$@38", "parameters", "$@39", "expired_leases_processing", "$@40",
   "expired_leases_params", "expired_leases_param",
   "reclaim_timer_wait_time", "flush_reclaimed_timer_wait_time",
   "hold_reclaimed_time", "max_reclaim_leases", "max_reclaim_time",
-  "unwarned_reclaim_cycles", "subnet4_list", "$@40",
-  "subnet4_list_content", "not_empty_subnet4_list", "subnet4", "$@41",
-  "sub_subnet4", "$@42", "subnet4_params", "subnet4_param", "subnet",
-  "$@43", "subnet_4o6_interface", "$@44", "subnet_4o6_interface_id",
-  "$@45", "subnet_4o6_subnet", "$@46", "interface", "$@47", "interface_id",
-  "$@48", "client_class", "$@49", "reservation_mode", "$@50", "hr_mode",
-  "id", "rapid_commit", "shared_networks", "$@51",
+  "unwarned_reclaim_cycles", "subnet4_list", "$@41",
+  "subnet4_list_content", "not_empty_subnet4_list", "subnet4", "$@42",
+  "sub_subnet4", "$@43", "subnet4_params", "subnet4_param", "subnet",
+  "$@44", "subnet_4o6_interface", "$@45", "subnet_4o6_interface_id",
+  "$@46", "subnet_4o6_subnet", "$@47", "interface", "$@48", "interface_id",
+  "$@49", "client_class", "$@50", "reservation_mode", "$@51", "hr_mode",
+  "id", "rapid_commit", "shared_networks", "$@52",
   "shared_networks_content", "shared_networks_list", "shared_network",
-  "$@52", "shared_network_params", "shared_network_param",
-  "option_def_list", "$@53", "sub_option_def_list", "$@54",
+  "$@53", "shared_network_params", "shared_network_param",
+  "option_def_list", "$@54", "sub_option_def_list", "$@55",
   "option_def_list_content", "not_empty_option_def_list",
-  "option_def_entry", "$@55", "sub_option_def", "$@56",
+  "option_def_entry", "$@56", "sub_option_def", "$@57",
   "option_def_params", "not_empty_option_def_params", "option_def_param",
-  "option_def_name", "code", "option_def_code", "option_def_type", "$@57",
-  "option_def_record_types", "$@58", "space", "$@59", "option_def_space",
-  "option_def_encapsulate", "$@60", "option_def_array", "option_data_list",
-  "$@61", "option_data_list_content", "not_empty_option_data_list",
-  "option_data_entry", "$@62", "sub_option_data", "$@63",
+  "option_def_name", "code", "option_def_code", "option_def_type", "$@58",
+  "option_def_record_types", "$@59", "space", "$@60", "option_def_space",
+  "option_def_encapsulate", "$@61", "option_def_array", "option_data_list",
+  "$@62", "option_data_list_content", "not_empty_option_data_list",
+  "option_data_entry", "$@63", "sub_option_data", "$@64",
   "option_data_params", "not_empty_option_data_params",
-  "option_data_param", "option_data_name", "option_data_data", "$@64",
+  "option_data_param", "option_data_name", "option_data_data", "$@65",
   "option_data_code", "option_data_space", "option_data_csv_format",
-  "option_data_always_send", "pools_list", "$@65", "pools_list_content",
-  "not_empty_pools_list", "pool_list_entry", "$@66", "sub_pool4", "$@67",
-  "pool_params", "pool_param", "pool_entry", "$@68", "user_context",
-  "$@69", "reservations", "$@70", "reservations_list",
-  "not_empty_reservations_list", "reservation", "$@71", "sub_reservation",
-  "$@72", "reservation_params", "not_empty_reservation_params",
-  "reservation_param", "next_server", "$@73", "server_hostname", "$@74",
-  "boot_file_name", "$@75", "ip_address", "$@76", "duid", "$@77",
-  "hw_address", "$@78", "client_id_value", "$@79", "circuit_id_value",
-  "$@80", "flex_id_value", "$@81", "hostname", "$@82",
-  "reservation_client_classes", "$@83", "relay", "$@84", "relay_map",
-  "$@85", "client_classes", "$@86", "client_classes_list", "$@87",
+  "option_data_always_send", "pools_list", "$@66", "pools_list_content",
+  "not_empty_pools_list", "pool_list_entry", "$@67", "sub_pool4", "$@68",
+  "pool_params", "pool_param", "pool_entry", "$@69", "user_context",
+  "$@70", "reservations", "$@71", "reservations_list",
+  "not_empty_reservations_list", "reservation", "$@72", "sub_reservation",
+  "$@73", "reservation_params", "not_empty_reservation_params",
+  "reservation_param", "next_server", "$@74", "server_hostname", "$@75",
+  "boot_file_name", "$@76", "ip_address", "$@77", "duid", "$@78",
+  "hw_address", "$@79", "client_id_value", "$@80", "circuit_id_value",
+  "$@81", "flex_id_value", "$@82", "hostname", "$@83",
+  "reservation_client_classes", "$@84", "relay", "$@85", "relay_map",
+  "$@86", "client_classes", "$@87", "client_classes_list", "$@88",
   "client_class_params", "not_empty_client_class_params",
-  "client_class_param", "client_class_name", "client_class_test", "$@88",
-  "dhcp4o6_port", "control_socket", "$@89", "control_socket_params",
-  "control_socket_param", "control_socket_type", "$@90",
-  "control_socket_name", "$@91", "dhcp_ddns", "$@92", "sub_dhcp_ddns",
-  "$@93", "dhcp_ddns_params", "dhcp_ddns_param", "enable_updates",
-  "qualifying_suffix", "$@94", "server_ip", "$@95", "server_port",
-  "sender_ip", "$@96", "sender_port", "max_queue_size", "ncr_protocol",
-  "$@97", "ncr_protocol_value", "ncr_format", "$@98",
+  "client_class_param", "client_class_name", "client_class_test", "$@89",
+  "dhcp4o6_port", "control_socket", "$@90", "control_socket_params",
+  "control_socket_param", "control_socket_type", "$@91",
+  "control_socket_name", "$@92", "dhcp_ddns", "$@93", "sub_dhcp_ddns",
+  "$@94", "dhcp_ddns_params", "dhcp_ddns_param", "enable_updates",
+  "qualifying_suffix", "$@95", "server_ip", "$@96", "server_port",
+  "sender_ip", "$@97", "sender_port", "max_queue_size", "ncr_protocol",
+  "$@98", "ncr_protocol_value", "ncr_format", "$@99",
   "always_include_fqdn", "override_no_update", "override_client_update",
-  "replace_client_name", "$@99", "replace_client_name_value",
-  "generated_prefix", "$@100", "dhcp6_json_object", "$@101",
-  "dhcpddns_json_object", "$@102", "control_agent_json_object", "$@103",
-  "logging_object", "$@104", "logging_params", "logging_param", "loggers",
-  "$@105", "loggers_entries", "logger_entry", "$@106", "logger_params",
-  "logger_param", "debuglevel", "severity", "$@107", "output_options_list",
-  "$@108", "output_options_list_content", "output_entry", "$@109",
-  "output_params_list", "output_params", "output", "$@110", "flush",
+  "replace_client_name", "$@100", "replace_client_name_value",
+  "generated_prefix", "$@101", "dhcp6_json_object", "$@102",
+  "dhcpddns_json_object", "$@103", "control_agent_json_object", "$@104",
+  "logging_object", "$@105", "logging_params", "logging_param", "loggers",
+  "$@106", "loggers_entries", "logger_entry", "$@107", "logger_params",
+  "logger_param", "debuglevel", "severity", "$@108", "output_options_list",
+  "$@109", "output_options_list_content", "output_entry", "$@110",
+  "output_params_list", "output_params", "output", "$@111", "flush",
   "maxsize", "maxver", YY_NULLPTR
   };
 
@@ -4283,62 +4477,65 @@ namespace isc { namespace dhcp {
   const unsigned short int
   Dhcp4Parser::yyrline_[] =
   {
-       0,   233,   233,   233,   234,   234,   235,   235,   236,   236,
-     237,   237,   238,   238,   239,   239,   240,   240,   241,   241,
-     242,   242,   243,   243,   244,   244,   252,   253,   254,   255,
-     256,   257,   258,   261,   266,   266,   277,   280,   281,   284,
-     288,   295,   295,   302,   303,   306,   310,   317,   317,   324,
-     325,   328,   332,   343,   353,   353,   369,   370,   374,   375,
-     376,   377,   378,   379,   382,   382,   397,   397,   406,   407,
-     412,   413,   414,   415,   416,   417,   418,   419,   420,   421,
-     422,   423,   424,   425,   426,   427,   428,   429,   430,   431,
-     432,   433,   434,   435,   438,   443,   448,   453,   458,   463,
-     469,   469,   480,   481,   484,   485,   486,   487,   490,   490,
-     499,   499,   509,   509,   516,   517,   520,   520,   527,   529,
-     533,   539,   539,   551,   551,   563,   564,   567,   568,   569,
-     570,   571,   572,   573,   574,   575,   576,   577,   578,   579,
-     582,   582,   589,   590,   591,   592,   595,   595,   603,   603,
-     611,   611,   619,   624,   624,   632,   637,   642,   647,   652,
-     652,   660,   660,   669,   669,   679,   680,   683,   684,   685,
-     686,   687,   690,   695,   700,   705,   710,   715,   715,   725,
-     726,   729,   730,   733,   733,   743,   743,   753,   754,   755,
-     758,   759,   762,   762,   770,   770,   778,   778,   789,   790,
-     793,   794,   795,   796,   797,   798,   801,   806,   811,   816,
-     821,   826,   834,   834,   847,   848,   851,   852,   859,   859,
-     885,   885,   896,   897,   901,   902,   903,   904,   905,   906,
-     907,   908,   909,   910,   911,   912,   913,   914,   915,   916,
-     917,   918,   919,   920,   921,   922,   923,   926,   926,   934,
-     934,   942,   942,   950,   950,   958,   958,   966,   966,   974,
-     974,   982,   982,   989,   990,   991,   994,   999,  1006,  1006,
-    1017,  1018,  1022,  1023,  1026,  1026,  1034,  1035,  1038,  1039,
-    1040,  1041,  1042,  1043,  1044,  1045,  1046,  1047,  1048,  1049,
-    1050,  1051,  1052,  1059,  1059,  1072,  1072,  1081,  1082,  1085,
-    1086,  1091,  1091,  1106,  1106,  1120,  1121,  1124,  1125,  1128,
-    1129,  1130,  1131,  1132,  1133,  1134,  1135,  1138,  1140,  1145,
-    1147,  1147,  1155,  1155,  1163,  1163,  1171,  1173,  1173,  1181,
-    1190,  1190,  1202,  1203,  1208,  1209,  1214,  1214,  1226,  1226,
-    1238,  1239,  1244,  1245,  1250,  1251,  1252,  1253,  1254,  1255,
-    1256,  1259,  1261,  1261,  1269,  1271,  1273,  1278,  1286,  1286,
-    1298,  1299,  1302,  1303,  1306,  1306,  1316,  1316,  1326,  1327,
-    1330,  1331,  1332,  1333,  1336,  1336,  1344,  1344,  1354,  1354,
-    1364,  1365,  1368,  1369,  1372,  1372,  1381,  1381,  1390,  1391,
-    1394,  1395,  1399,  1400,  1401,  1402,  1403,  1404,  1405,  1406,
-    1407,  1408,  1409,  1410,  1411,  1414,  1414,  1422,  1422,  1430,
-    1430,  1438,  1438,  1446,  1446,  1454,  1454,  1462,  1462,  1470,
-    1470,  1478,  1478,  1486,  1486,  1494,  1494,  1507,  1507,  1517,
-    1517,  1528,  1528,  1538,  1539,  1542,  1542,  1552,  1553,  1556,
-    1557,  1560,  1561,  1562,  1563,  1564,  1565,  1566,  1567,  1570,
-    1572,  1572,  1584,  1591,  1591,  1601,  1602,  1605,  1606,  1609,
-    1609,  1617,  1617,  1627,  1627,  1639,  1639,  1649,  1650,  1653,
-    1654,  1655,  1656,  1657,  1658,  1659,  1660,  1661,  1662,  1663,
-    1664,  1665,  1666,  1667,  1670,  1675,  1675,  1683,  1683,  1691,
-    1696,  1696,  1704,  1709,  1714,  1714,  1722,  1723,  1726,  1726,
-    1734,  1739,  1744,  1749,  1749,  1757,  1760,  1763,  1766,  1769,
-    1775,  1775,  1785,  1785,  1792,  1792,  1799,  1799,  1811,  1811,
-    1824,  1825,  1829,  1833,  1833,  1845,  1846,  1850,  1850,  1858,
-    1859,  1862,  1863,  1864,  1865,  1866,  1869,  1874,  1874,  1882,
-    1882,  1892,  1893,  1896,  1896,  1904,  1905,  1908,  1909,  1910,
-    1911,  1914,  1914,  1922,  1927,  1932
+       0,   248,   248,   248,   249,   249,   250,   250,   251,   251,
+     252,   252,   253,   253,   254,   254,   255,   255,   256,   256,
+     257,   257,   258,   258,   259,   259,   267,   268,   269,   270,
+     271,   272,   273,   276,   281,   281,   292,   295,   296,   299,
+     303,   310,   310,   317,   318,   321,   325,   332,   332,   339,
+     340,   343,   347,   358,   368,   368,   384,   385,   389,   390,
+     391,   392,   393,   394,   397,   397,   412,   412,   421,   422,
+     427,   428,   429,   430,   431,   432,   433,   434,   435,   436,
+     437,   438,   439,   440,   441,   442,   443,   444,   445,   446,
+     447,   448,   449,   450,   453,   458,   463,   468,   473,   478,
+     484,   484,   495,   496,   499,   500,   501,   502,   505,   505,
+     514,   514,   524,   524,   531,   532,   535,   535,   542,   544,
+     548,   554,   554,   566,   566,   578,   579,   582,   583,   584,
+     585,   586,   587,   588,   589,   590,   591,   592,   593,   594,
+     595,   596,   597,   598,   599,   600,   601,   602,   603,   604,
+     605,   606,   607,   608,   609,   612,   612,   619,   620,   621,
+     622,   625,   625,   633,   633,   641,   641,   649,   654,   654,
+     662,   667,   672,   677,   682,   682,   690,   690,   698,   703,
+     708,   713,   718,   723,   728,   733,   738,   743,   743,   751,
+     756,   761,   766,   771,   777,   777,   787,   788,   791,   792,
+     793,   794,   795,   798,   803,   808,   813,   818,   823,   823,
+     833,   834,   837,   838,   841,   841,   851,   851,   861,   862,
+     863,   866,   867,   870,   870,   878,   878,   886,   886,   897,
+     898,   901,   902,   903,   904,   905,   906,   909,   914,   919,
+     924,   929,   934,   942,   942,   955,   956,   959,   960,   967,
+     967,   993,   993,  1004,  1005,  1009,  1010,  1011,  1012,  1013,
+    1014,  1015,  1016,  1017,  1018,  1019,  1020,  1021,  1022,  1023,
+    1024,  1025,  1026,  1027,  1028,  1029,  1030,  1031,  1034,  1034,
+    1042,  1042,  1050,  1050,  1058,  1058,  1066,  1066,  1074,  1074,
+    1082,  1082,  1090,  1090,  1097,  1098,  1099,  1102,  1107,  1114,
+    1114,  1125,  1126,  1130,  1131,  1134,  1134,  1142,  1143,  1146,
+    1147,  1148,  1149,  1150,  1151,  1152,  1153,  1154,  1155,  1156,
+    1157,  1158,  1159,  1160,  1167,  1167,  1180,  1180,  1189,  1190,
+    1193,  1194,  1199,  1199,  1214,  1214,  1228,  1229,  1232,  1233,
+    1236,  1237,  1238,  1239,  1240,  1241,  1242,  1243,  1246,  1248,
+    1253,  1255,  1255,  1263,  1263,  1271,  1271,  1279,  1281,  1281,
+    1289,  1298,  1298,  1310,  1311,  1316,  1317,  1322,  1322,  1334,
+    1334,  1346,  1347,  1352,  1353,  1358,  1359,  1360,  1361,  1362,
+    1363,  1364,  1367,  1369,  1369,  1377,  1379,  1381,  1386,  1394,
+    1394,  1406,  1407,  1410,  1411,  1414,  1414,  1424,  1424,  1434,
+    1435,  1438,  1439,  1440,  1441,  1444,  1444,  1452,  1452,  1462,
+    1462,  1472,  1473,  1476,  1477,  1480,  1480,  1489,  1489,  1498,
+    1499,  1502,  1503,  1507,  1508,  1509,  1510,  1511,  1512,  1513,
+    1514,  1515,  1516,  1517,  1518,  1519,  1522,  1522,  1530,  1530,
+    1538,  1538,  1546,  1546,  1554,  1554,  1562,  1562,  1570,  1570,
+    1578,  1578,  1586,  1586,  1594,  1594,  1602,  1602,  1615,  1615,
+    1625,  1625,  1636,  1636,  1646,  1647,  1650,  1650,  1660,  1661,
+    1664,  1665,  1668,  1669,  1670,  1671,  1672,  1673,  1674,  1675,
+    1678,  1680,  1680,  1692,  1699,  1699,  1709,  1710,  1713,  1714,
+    1717,  1717,  1725,  1725,  1735,  1735,  1747,  1747,  1757,  1758,
+    1761,  1762,  1763,  1764,  1765,  1766,  1767,  1768,  1769,  1770,
+    1771,  1772,  1773,  1774,  1775,  1778,  1783,  1783,  1791,  1791,
+    1799,  1804,  1804,  1812,  1817,  1822,  1822,  1830,  1831,  1834,
+    1834,  1842,  1847,  1852,  1857,  1857,  1865,  1868,  1871,  1874,
+    1877,  1883,  1883,  1893,  1893,  1900,  1900,  1907,  1907,  1919,
+    1919,  1932,  1933,  1937,  1941,  1941,  1953,  1954,  1958,  1958,
+    1966,  1967,  1970,  1971,  1972,  1973,  1974,  1977,  1982,  1982,
+    1990,  1990,  2000,  2001,  2004,  2004,  2012,  2013,  2016,  2017,
+    2018,  2019,  2022,  2022,  2030,  2035,  2040
   };
 
   // Print the state stack on the debug stream.
@@ -4373,8 +4570,8 @@ namespace isc { namespace dhcp {
 
 #line 14 "dhcp4_parser.yy" // lalr1.cc:1167
 } } // isc::dhcp
-#line 4377 "dhcp4_parser.cc" // lalr1.cc:1167
-#line 1937 "dhcp4_parser.yy" // lalr1.cc:1168
+#line 4574 "dhcp4_parser.cc" // lalr1.cc:1167
+#line 2045 "dhcp4_parser.yy" // lalr1.cc:1168
 
 
 void
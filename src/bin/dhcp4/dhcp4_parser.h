@@ -387,114 +387,129 @@ namespace isc { namespace dhcp {
         TOKEN_CONNECT_TIMEOUT = 294,
         TOKEN_CONTACT_POINTS = 295,
         TOKEN_KEYSPACE = 296,
-        TOKEN_VALID_LIFETIME = 297,
-        TOKEN_RENEW_TIMER = 298,
-        TOKEN_REBIND_TIMER = 299,
-        TOKEN_DECLINE_PROBATION_PERIOD = 300,
-        TOKEN_SUBNET4 = 301,
-        TOKEN_SUBNET_4O6_INTERFACE = 302,
-        TOKEN_SUBNET_4O6_INTERFACE_ID = 303,
-        TOKEN_SUBNET_4O6_SUBNET = 304,
-        TOKEN_OPTION_DEF = 305,
-        TOKEN_OPTION_DATA = 306,
-        TOKEN_NAME = 307,
-        TOKEN_DATA = 308,
-        TOKEN_CODE = 309,
-        TOKEN_SPACE = 310,
-        TOKEN_CSV_FORMAT = 311,
-        TOKEN_ALWAYS_SEND = 312,
-        TOKEN_RECORD_TYPES = 313,
-        TOKEN_ENCAPSULATE = 314,
-        TOKEN_ARRAY = 315,
-        TOKEN_SHARED_NETWORKS = 316,
-        TOKEN_POOLS = 317,
-        TOKEN_POOL = 318,
-        TOKEN_USER_CONTEXT = 319,
-        TOKEN_SUBNET = 320,
-        TOKEN_INTERFACE = 321,
-        TOKEN_INTERFACE_ID = 322,
-        TOKEN_ID = 323,
-        TOKEN_RAPID_COMMIT = 324,
-        TOKEN_RESERVATION_MODE = 325,
-        TOKEN_DISABLED = 326,
-        TOKEN_OUT_OF_POOL = 327,
-        TOKEN_ALL = 328,
-        TOKEN_HOST_RESERVATION_IDENTIFIERS = 329,
-        TOKEN_CLIENT_CLASSES = 330,
-        TOKEN_TEST = 331,
-        TOKEN_CLIENT_CLASS = 332,
-        TOKEN_RESERVATIONS = 333,
-        TOKEN_DUID = 334,
-        TOKEN_HW_ADDRESS = 335,
-        TOKEN_CIRCUIT_ID = 336,
-        TOKEN_CLIENT_ID = 337,
-        TOKEN_HOSTNAME = 338,
-        TOKEN_FLEX_ID = 339,
-        TOKEN_RELAY = 340,
-        TOKEN_IP_ADDRESS = 341,
-        TOKEN_HOOKS_LIBRARIES = 342,
-        TOKEN_LIBRARY = 343,
-        TOKEN_PARAMETERS = 344,
-        TOKEN_EXPIRED_LEASES_PROCESSING = 345,
-        TOKEN_RECLAIM_TIMER_WAIT_TIME = 346,
-        TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 347,
-        TOKEN_HOLD_RECLAIMED_TIME = 348,
-        TOKEN_MAX_RECLAIM_LEASES = 349,
-        TOKEN_MAX_RECLAIM_TIME = 350,
-        TOKEN_UNWARNED_RECLAIM_CYCLES = 351,
-        TOKEN_DHCP4O6_PORT = 352,
-        TOKEN_CONTROL_SOCKET = 353,
-        TOKEN_SOCKET_TYPE = 354,
-        TOKEN_SOCKET_NAME = 355,
-        TOKEN_DHCP_DDNS = 356,
-        TOKEN_ENABLE_UPDATES = 357,
-        TOKEN_QUALIFYING_SUFFIX = 358,
-        TOKEN_SERVER_IP = 359,
-        TOKEN_SERVER_PORT = 360,
-        TOKEN_SENDER_IP = 361,
-        TOKEN_SENDER_PORT = 362,
-        TOKEN_MAX_QUEUE_SIZE = 363,
-        TOKEN_NCR_PROTOCOL = 364,
-        TOKEN_NCR_FORMAT = 365,
-        TOKEN_ALWAYS_INCLUDE_FQDN = 366,
-        TOKEN_OVERRIDE_NO_UPDATE = 367,
-        TOKEN_OVERRIDE_CLIENT_UPDATE = 368,
-        TOKEN_REPLACE_CLIENT_NAME = 369,
-        TOKEN_GENERATED_PREFIX = 370,
-        TOKEN_TCP = 371,
-        TOKEN_JSON = 372,
-        TOKEN_WHEN_PRESENT = 373,
-        TOKEN_NEVER = 374,
-        TOKEN_ALWAYS = 375,
-        TOKEN_WHEN_NOT_PRESENT = 376,
-        TOKEN_LOGGING = 377,
-        TOKEN_LOGGERS = 378,
-        TOKEN_OUTPUT_OPTIONS = 379,
-        TOKEN_OUTPUT = 380,
-        TOKEN_DEBUGLEVEL = 381,
-        TOKEN_SEVERITY = 382,
-        TOKEN_FLUSH = 383,
-        TOKEN_MAXSIZE = 384,
-        TOKEN_MAXVER = 385,
-        TOKEN_DHCP6 = 386,
-        TOKEN_DHCPDDNS = 387,
-        TOKEN_CONTROL_AGENT = 388,
-        TOKEN_TOPLEVEL_JSON = 389,
-        TOKEN_TOPLEVEL_DHCP4 = 390,
-        TOKEN_SUB_DHCP4 = 391,
-        TOKEN_SUB_INTERFACES4 = 392,
-        TOKEN_SUB_SUBNET4 = 393,
-        TOKEN_SUB_POOL4 = 394,
-        TOKEN_SUB_RESERVATION = 395,
-        TOKEN_SUB_OPTION_DEFS = 396,
-        TOKEN_SUB_OPTION_DEF = 397,
-        TOKEN_SUB_OPTION_DATA = 398,
-        TOKEN_SUB_HOOKS_LIBRARY = 399,
-        TOKEN_SUB_DHCP_DDNS = 400,
-        TOKEN_STRING = 401,
-        TOKEN_INTEGER = 402,
-        TOKEN_FLOAT = 403,
-        TOKEN_BOOLEAN = 404
+        TOKEN_PACKED = 297,
+        TOKEN_GROUP_COMMIT = 298,
+        TOKEN_GROUP_COMMIT_SYNC = 299,
+        TOKEN_GROUP_COMMIT_MAX_BATCH = 300,
+        TOKEN_GROUP_COMMIT_MAX_LATENCY = 301,
+        TOKEN_LOAD_THREADS = 302,
+        TOKEN_LFC_IN_PROCESS = 303,
+        TOKEN_LFC_BATCH_SIZE = 304,
+        TOKEN_LFC_BATCH_INTERVAL = 305,
+        TOKEN_LFC_SNAPSHOT_FORMAT = 306,
+        TOKEN_CACHE_SIZE = 307,
+        TOKEN_CACHE_TTL = 308,
+        TOKEN_CACHE_NEGATIVE_TTL = 309,
+        TOKEN_CONNECTION_POOL_SIZE = 310,
+        TOKEN_RECONNECT_WAIT_TIME = 311,
+        TOKEN_VALID_LIFETIME = 312,
+        TOKEN_RENEW_TIMER = 313,
+        TOKEN_REBIND_TIMER = 314,
+        TOKEN_DECLINE_PROBATION_PERIOD = 315,
+        TOKEN_SUBNET4 = 316,
+        TOKEN_SUBNET_4O6_INTERFACE = 317,
+        TOKEN_SUBNET_4O6_INTERFACE_ID = 318,
+        TOKEN_SUBNET_4O6_SUBNET = 319,
+        TOKEN_OPTION_DEF = 320,
+        TOKEN_OPTION_DATA = 321,
+        TOKEN_NAME = 322,
+        TOKEN_DATA = 323,
+        TOKEN_CODE = 324,
+        TOKEN_SPACE = 325,
+        TOKEN_CSV_FORMAT = 326,
+        TOKEN_ALWAYS_SEND = 327,
+        TOKEN_RECORD_TYPES = 328,
+        TOKEN_ENCAPSULATE = 329,
+        TOKEN_ARRAY = 330,
+        TOKEN_SHARED_NETWORKS = 331,
+        TOKEN_POOLS = 332,
+        TOKEN_POOL = 333,
+        TOKEN_USER_CONTEXT = 334,
+        TOKEN_SUBNET = 335,
+        TOKEN_INTERFACE = 336,
+        TOKEN_INTERFACE_ID = 337,
+        TOKEN_ID = 338,
+        TOKEN_RAPID_COMMIT = 339,
+        TOKEN_RESERVATION_MODE = 340,
+        TOKEN_DISABLED = 341,
+        TOKEN_OUT_OF_POOL = 342,
+        TOKEN_ALL = 343,
+        TOKEN_HOST_RESERVATION_IDENTIFIERS = 344,
+        TOKEN_CLIENT_CLASSES = 345,
+        TOKEN_TEST = 346,
+        TOKEN_CLIENT_CLASS = 347,
+        TOKEN_RESERVATIONS = 348,
+        TOKEN_DUID = 349,
+        TOKEN_HW_ADDRESS = 350,
+        TOKEN_CIRCUIT_ID = 351,
+        TOKEN_CLIENT_ID = 352,
+        TOKEN_HOSTNAME = 353,
+        TOKEN_FLEX_ID = 354,
+        TOKEN_RELAY = 355,
+        TOKEN_IP_ADDRESS = 356,
+        TOKEN_HOOKS_LIBRARIES = 357,
+        TOKEN_LIBRARY = 358,
+        TOKEN_PARAMETERS = 359,
+        TOKEN_EXPIRED_LEASES_PROCESSING = 360,
+        TOKEN_RECLAIM_TIMER_WAIT_TIME = 361,
+        TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 362,
+        TOKEN_HOLD_RECLAIMED_TIME = 363,
+        TOKEN_MAX_RECLAIM_LEASES = 364,
+        TOKEN_MAX_RECLAIM_TIME = 365,
+        TOKEN_UNWARNED_RECLAIM_CYCLES = 366,
+        TOKEN_DHCP4O6_PORT = 367,
+        TOKEN_CONTROL_SOCKET = 368,
+        TOKEN_SOCKET_TYPE = 369,
+        TOKEN_SOCKET_NAME = 370,
+        TOKEN_DHCP_DDNS = 371,
+        TOKEN_ENABLE_UPDATES = 372,
+        TOKEN_QUALIFYING_SUFFIX = 373,
+        TOKEN_SERVER_IP = 374,
+        TOKEN_SERVER_PORT = 375,
+        TOKEN_SENDER_IP = 376,
+        TOKEN_SENDER_PORT = 377,
+        TOKEN_MAX_QUEUE_SIZE = 378,
+        TOKEN_NCR_PROTOCOL = 379,
+        TOKEN_NCR_FORMAT = 380,
+        TOKEN_ALWAYS_INCLUDE_FQDN = 381,
+        TOKEN_OVERRIDE_NO_UPDATE = 382,
+        TOKEN_OVERRIDE_CLIENT_UPDATE = 383,
+        TOKEN_REPLACE_CLIENT_NAME = 384,
+        TOKEN_GENERATED_PREFIX = 385,
+        TOKEN_TCP = 386,
+        TOKEN_JSON = 387,
+        TOKEN_WHEN_PRESENT = 388,
+        TOKEN_NEVER = 389,
+        TOKEN_ALWAYS = 390,
+        TOKEN_WHEN_NOT_PRESENT = 391,
+        TOKEN_LOGGING = 392,
+        TOKEN_LOGGERS = 393,
+        TOKEN_OUTPUT_OPTIONS = 394,
+        TOKEN_OUTPUT = 395,
+        TOKEN_DEBUGLEVEL = 396,
+        TOKEN_SEVERITY = 397,
+        TOKEN_FLUSH = 398,
+        TOKEN_MAXSIZE = 399,
+        TOKEN_MAXVER = 400,
+        TOKEN_DHCP6 = 401,
+        TOKEN_DHCPDDNS = 402,
+        TOKEN_CONTROL_AGENT = 403,
+        TOKEN_TOPLEVEL_JSON = 404,
+        TOKEN_TOPLEVEL_DHCP4 = 405,
+        TOKEN_SUB_DHCP4 = 406,
+        TOKEN_SUB_INTERFACES4 = 407,
+        TOKEN_SUB_SUBNET4 = 408,
+        TOKEN_SUB_POOL4 = 409,
+        TOKEN_SUB_RESERVATION = 410,
+        TOKEN_SUB_OPTION_DEFS = 411,
+        TOKEN_SUB_OPTION_DEF = 412,
+        TOKEN_SUB_OPTION_DATA = 413,
+        TOKEN_SUB_HOOKS_LIBRARY = 414,
+        TOKEN_SUB_DHCP_DDNS = 415,
+        TOKEN_STRING = 416,
+        TOKEN_INTEGER = 417,
+        TOKEN_FLOAT = 418,
+        TOKEN_BOOLEAN = 419
       };
     };
 
@@ -769,6 +784,66 @@ namespace isc { namespace dhcp {
     symbol_type
     make_KEYSPACE (const location_type& l);
 
+    static inline
+    symbol_type
+    make_PACKED (const location_type& l);
+
+    static inline
+    symbol_type
+    make_GROUP_COMMIT (const location_type& l);
+
+    static inline
+    symbol_type
+    make_GROUP_COMMIT_SYNC (const location_type& l);
+
+    static inline
+    symbol_type
+    make_GROUP_COMMIT_MAX_BATCH (const location_type& l);
+
+    static inline
+    symbol_type
+    make_GROUP_COMMIT_MAX_LATENCY (const location_type& l);
+
+    static inline
+    symbol_type
+    make_LOAD_THREADS (const location_type& l);
+
+    static inline
+    symbol_type
+    make_LFC_IN_PROCESS (const location_type& l);
+
+    static inline
+    symbol_type
+    make_LFC_BATCH_SIZE (const location_type& l);
+
+    static inline
+    symbol_type
+    make_LFC_BATCH_INTERVAL (const location_type& l);
+
+    static inline
+    symbol_type
+    make_LFC_SNAPSHOT_FORMAT (const location_type& l);
+
+    static inline
+    symbol_type
+    make_CACHE_SIZE (const location_type& l);
+
+    static inline
+    symbol_type
+    make_CACHE_TTL (const location_type& l);
+
+    static inline
+    symbol_type
+    make_CACHE_NEGATIVE_TTL (const location_type& l);
+
+    static inline
+    symbol_type
+    make_CONNECTION_POOL_SIZE (const location_type& l);
+
+    static inline
+    symbol_type
+    make_RECONNECT_WAIT_TIME (const location_type& l);
+
     static inline
     symbol_type
     make_VALID_LIFETIME (const location_type& l);
@@ -1406,12 +1481,12 @@ namespace isc { namespace dhcp {
     enum
     {
       yyeof_ = 0,
-      yylast_ = 804,     ///< Last index in yytable_.
-      yynnts_ = 332,  ///< Number of nonterminal symbols.
+      yylast_ = 865,     ///< Last index in yytable_.
+      yynnts_ = 348,  ///< Number of nonterminal symbols.
       yyfinal_ = 26, ///< Termination state number.
       yyterror_ = 1,
       yyerrcode_ = 256,
-      yyntokens_ = 150  ///< Number of tokens.
+      yyntokens_ = 165  ///< Number of tokens.
     };
 
 
@@ -1468,9 +1543,10 @@ namespace isc { namespace dhcp {
      115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
      125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
      135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
-     145,   146,   147,   148,   149
+     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
+     155,   156,   157,   158,   159,   160,   161,   162,   163,   164
     };
-    const unsigned int user_token_number_max_ = 404;
+    const unsigned int user_token_number_max_ = 419;
     const token_number_type undef_token_ = 2;
 
     if (static_cast<int>(t) <= yyeof_)
@@ -1503,30 +1579,30 @@ namespace isc { namespace dhcp {
   {
       switch (other.type_get ())
     {
-      case 164: // value
-      case 168: // map_value
-      case 206: // socket_type
-      case 209: // outbound_interface_value
-      case 219: // db_type
-      case 296: // hr_mode
-      case 439: // ncr_protocol_value
-      case 447: // replace_client_name_value
+      case 179: // value
+      case 183: // map_value
+      case 221: // socket_type
+      case 224: // outbound_interface_value
+      case 234: // db_type
+      case 327: // hr_mode
+      case 470: // ncr_protocol_value
+      case 478: // replace_client_name_value
         value.copy< ElementPtr > (other.value);
         break;
 
-      case 149: // "boolean"
+      case 164: // "boolean"
         value.copy< bool > (other.value);
         break;
 
-      case 148: // "floating point"
+      case 163: // "floating point"
         value.copy< double > (other.value);
         break;
 
-      case 147: // "integer"
+      case 162: // "integer"
         value.copy< int64_t > (other.value);
         break;
 
-      case 146: // "constant string"
+      case 161: // "constant string"
         value.copy< std::string > (other.value);
         break;
 
@@ -1547,30 +1623,30 @@ namespace isc { namespace dhcp {
     (void) v;
       switch (this->type_get ())
     {
-      case 164: // value
-      case 168: // map_value
-      case 206: // socket_type
-      case 209: // outbound_interface_value
-      case 219: // db_type
-      case 296: // hr_mode
-      case 439: // ncr_protocol_value
-      case 447: // replace_client_name_value
+      case 179: // value
+      case 183: // map_value
+      case 221: // socket_type
+      case 224: // outbound_interface_value
+      case 234: // db_type
+      case 327: // hr_mode
+      case 470: // ncr_protocol_value
+      case 478: // replace_client_name_value
         value.copy< ElementPtr > (v);
         break;
 
-      case 149: // "boolean"
+      case 164: // "boolean"
         value.copy< bool > (v);
         break;
 
-      case 148: // "floating point"
+      case 163: // "floating point"
         value.copy< double > (v);
         break;
 
-      case 147: // "integer"
+      case 162: // "integer"
         value.copy< int64_t > (v);
         break;
 
-      case 146: // "constant string"
+      case 161: // "constant string"
         value.copy< std::string > (v);
         break;
 
@@ -1650,30 +1726,30 @@ namespace isc { namespace dhcp {
     // Type destructor.
     switch (yytype)
     {
-      case 164: // value
-      case 168: // map_value
-      case 206: // socket_type
-      case 209: // outbound_interface_value
-      case 219: // db_type
-      case 296: // hr_mode
-      case 439: // ncr_protocol_value
-      case 447: // replace_client_name_value
+      case 179: // value
+      case 183: // map_value
+      case 221: // socket_type
+      case 224: // outbound_interface_value
+      case 234: // db_type
+      case 327: // hr_mode
+      case 470: // ncr_protocol_value
+      case 478: // replace_client_name_value
         value.template destroy< ElementPtr > ();
         break;
 
-      case 149: // "boolean"
+      case 164: // "boolean"
         value.template destroy< bool > ();
         break;
 
-      case 148: // "floating point"
+      case 163: // "floating point"
         value.template destroy< double > ();
         break;
 
-      case 147: // "integer"
+      case 162: // "integer"
         value.template destroy< int64_t > ();
         break;
 
-      case 146: // "constant string"
+      case 161: // "constant string"
         value.template destroy< std::string > ();
         break;
 
@@ -1700,30 +1776,30 @@ namespace isc { namespace dhcp {
     super_type::move(s);
       switch (this->type_get ())
     {
-      case 164: // value
-      case 168: // map_value
-      case 206: // socket_type
-      case 209: // outbound_interface_value
-      case 219: // db_type
-      case 296: // hr_mode
-      case 439: // ncr_protocol_value
-      case 447: // replace_client_name_value
+      case 179: // value
+      case 183: // map_value
+      case 221: // socket_type
+      case 224: // outbound_interface_value
+      case 234: // db_type
+      case 327: // hr_mode
+      case 470: // ncr_protocol_value
+      case 478: // replace_client_name_value
         value.move< ElementPtr > (s.value);
         break;
 
-      case 149: // "boolean"
+      case 164: // "boolean"
         value.move< bool > (s.value);
         break;
 
-      case 148: // "floating point"
+      case 163: // "floating point"
         value.move< double > (s.value);
         break;
 
-      case 147: // "integer"
+      case 162: // "integer"
         value.move< int64_t > (s.value);
         break;
 
-      case 146: // "constant string"
+      case 161: // "constant string"
         value.move< std::string > (s.value);
         break;
 
@@ -1796,7 +1872,9 @@ namespace isc { namespace dhcp {
      365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
      375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
      385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
-     395,   396,   397,   398,   399,   400,   401,   402,   403,   404
+     395,   396,   397,   398,   399,   400,   401,   402,   403,   404,
+     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
+     415,   416,   417,   418,   419
     };
     return static_cast<token_type> (yytoken_number_[type]);
   }
@@ -2041,6 +2119,96 @@ namespace isc { namespace dhcp {
     return symbol_type (token::TOKEN_KEYSPACE, l);
   }
 
+  Dhcp4Parser::symbol_type
+  Dhcp4Parser::make_PACKED (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_PACKED, l);
+  }
+
+  Dhcp4Parser::symbol_type
+  Dhcp4Parser::make_GROUP_COMMIT (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_GROUP_COMMIT, l);
+  }
+
+  Dhcp4Parser::symbol_type
+  Dhcp4Parser::make_GROUP_COMMIT_SYNC (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_GROUP_COMMIT_SYNC, l);
+  }
+
+  Dhcp4Parser::symbol_type
+  Dhcp4Parser::make_GROUP_COMMIT_MAX_BATCH (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_GROUP_COMMIT_MAX_BATCH, l);
+  }
+
+  Dhcp4Parser::symbol_type
+  Dhcp4Parser::make_GROUP_COMMIT_MAX_LATENCY (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_GROUP_COMMIT_MAX_LATENCY, l);
+  }
+
+  Dhcp4Parser::symbol_type
+  Dhcp4Parser::make_LOAD_THREADS (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_LOAD_THREADS, l);
+  }
+
+  Dhcp4Parser::symbol_type
+  Dhcp4Parser::make_LFC_IN_PROCESS (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_LFC_IN_PROCESS, l);
+  }
+
+  Dhcp4Parser::symbol_type
+  Dhcp4Parser::make_LFC_BATCH_SIZE (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_LFC_BATCH_SIZE, l);
+  }
+
+  Dhcp4Parser::symbol_type
+  Dhcp4Parser::make_LFC_BATCH_INTERVAL (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_LFC_BATCH_INTERVAL, l);
+  }
+
+  Dhcp4Parser::symbol_type
+  Dhcp4Parser::make_LFC_SNAPSHOT_FORMAT (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_LFC_SNAPSHOT_FORMAT, l);
+  }
+
+  Dhcp4Parser::symbol_type
+  Dhcp4Parser::make_CACHE_SIZE (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_CACHE_SIZE, l);
+  }
+
+  Dhcp4Parser::symbol_type
+  Dhcp4Parser::make_CACHE_TTL (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_CACHE_TTL, l);
+  }
+
+  Dhcp4Parser::symbol_type
+  Dhcp4Parser::make_CACHE_NEGATIVE_TTL (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_CACHE_NEGATIVE_TTL, l);
+  }
+
+  Dhcp4Parser::symbol_type
+  Dhcp4Parser::make_CONNECTION_POOL_SIZE (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_CONNECTION_POOL_SIZE, l);
+  }
+
+  Dhcp4Parser::symbol_type
+  Dhcp4Parser::make_RECONNECT_WAIT_TIME (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_RECONNECT_WAIT_TIME, l);
+  }
+
   Dhcp4Parser::symbol_type
   Dhcp4Parser::make_VALID_LIFETIME (const location_type& l)
   {
@@ -2692,7 +2860,7 @@ namespace isc { namespace dhcp {
 
 #line 14 "dhcp4_parser.yy" // lalr1.cc:377
 } } // isc::dhcp
-#line 2696 "dhcp4_parser.h" // lalr1.cc:377
+#line 2864 "dhcp4_parser.h" // lalr1.cc:377
 
 
 
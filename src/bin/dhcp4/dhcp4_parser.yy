@@ -83,6 +83,21 @@ using namespace std;
   CONNECT_TIMEOUT "connect-timeout"
   CONTACT_POINTS "contact-points"
   KEYSPACE "keyspace"
+  PACKED "packed"
+  GROUP_COMMIT "group-commit"
+  GROUP_COMMIT_SYNC "group-commit-sync"
+  GROUP_COMMIT_MAX_BATCH "group-commit-max-batch"
+  GROUP_COMMIT_MAX_LATENCY "group-commit-max-latency"
+  LOAD_THREADS "load-threads"
+  LFC_IN_PROCESS "lfc-in-process"
+  LFC_BATCH_SIZE "lfc-batch-size"
+  LFC_BATCH_INTERVAL "lfc-batch-interval"
+  LFC_SNAPSHOT_FORMAT "lfc-snapshot-format"
+  CACHE_SIZE "cache-size"
+  CACHE_TTL "cache-ttl"
+  CACHE_NEGATIVE_TTL "cache-negative-ttl"
+  CONNECTION_POOL_SIZE "connection-pool-size"
+  RECONNECT_WAIT_TIME "reconnect-wait-time"
 
   VALID_LIFETIME "valid-lifetime"
   RENEW_TIMER "renew-timer"
@@ -576,6 +591,21 @@ database_map_param: database_type
                   | connect_timeout
                   | contact_points
                   | keyspace
+                  | packed
+                  | group_commit
+                  | group_commit_sync
+                  | group_commit_max_batch
+                  | group_commit_max_latency
+                  | load_threads
+                  | lfc_in_process
+                  | lfc_batch_size
+                  | lfc_batch_interval
+                  | lfc_snapshot_format
+                  | cache_size
+                  | cache_ttl
+                  | cache_negative_ttl
+                  | connection_pool_size
+                  | reconnect_wait_time
                   | unknown_map_entry
 ;
 
@@ -665,6 +695,84 @@ keyspace: KEYSPACE {
     ctx.leave();
 };
 
+packed: PACKED COLON BOOLEAN {
+    ElementPtr n(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("packed", n);
+};
+
+group_commit: GROUP_COMMIT COLON BOOLEAN {
+    ElementPtr n(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("group-commit", n);
+};
+
+group_commit_sync: GROUP_COMMIT_SYNC COLON BOOLEAN {
+    ElementPtr n(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("group-commit-sync", n);
+};
+
+group_commit_max_batch: GROUP_COMMIT_MAX_BATCH COLON INTEGER {
+    ElementPtr n(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("group-commit-max-batch", n);
+};
+
+group_commit_max_latency: GROUP_COMMIT_MAX_LATENCY COLON INTEGER {
+    ElementPtr n(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("group-commit-max-latency", n);
+};
+
+load_threads: LOAD_THREADS COLON INTEGER {
+    ElementPtr n(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("load-threads", n);
+};
+
+lfc_in_process: LFC_IN_PROCESS COLON BOOLEAN {
+    ElementPtr n(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("lfc-in-process", n);
+};
+
+lfc_batch_size: LFC_BATCH_SIZE COLON INTEGER {
+    ElementPtr n(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("lfc-batch-size", n);
+};
+
+lfc_batch_interval: LFC_BATCH_INTERVAL COLON INTEGER {
+    ElementPtr n(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("lfc-batch-interval", n);
+};
+
+lfc_snapshot_format: LFC_SNAPSHOT_FORMAT {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON STRING {
+    ElementPtr s(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("lfc-snapshot-format", s);
+    ctx.leave();
+};
+
+cache_size: CACHE_SIZE COLON INTEGER {
+    ElementPtr n(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("cache-size", n);
+};
+
+cache_ttl: CACHE_TTL COLON INTEGER {
+    ElementPtr n(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("cache-ttl", n);
+};
+
+cache_negative_ttl: CACHE_NEGATIVE_TTL COLON INTEGER {
+    ElementPtr n(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("cache-negative-ttl", n);
+};
+
+connection_pool_size: CONNECTION_POOL_SIZE COLON INTEGER {
+    ElementPtr n(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("connection-pool-size", n);
+};
+
+reconnect_wait_time: RECONNECT_WAIT_TIME COLON INTEGER {
+    ElementPtr n(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("reconnect-wait-time", n);
+};
+
 
 host_reservation_identifiers: HOST_RESERVATION_IDENTIFIERS {
     ElementPtr l(new ListElement(ctx.loc2pos(@1)));
@@ -26,10 +26,12 @@
 #include <dhcpsrv/addr_utilities.h>
 #include <dhcpsrv/callout_handle_store.h>
 #include <dhcpsrv/cfgmgr.h>
+#include <dhcpsrv/client_class_index.h>
 #include <dhcpsrv/cfg_host_operations.h>
 #include <dhcpsrv/cfg_iface.h>
 #include <dhcpsrv/cfg_shared_networks.h>
 #include <dhcpsrv/cfg_subnets4.h>
+#include <dhcpsrv/host_mgr.h>
 #include <dhcpsrv/lease_mgr.h>
 #include <dhcpsrv/lease_mgr_factory.h>
 #include <dhcpsrv/ncr_generator.h>
@@ -45,6 +47,7 @@
 #include <hooks/hooks_manager.h>
 #include <stats/stats_mgr.h>
 #include <util/strutil.h>
+#include <util/threads/sync.h>
 #include <stats/stats_mgr.h>
 #include <log/logger.h>
 #include <cryptolink/cryptolink.h>
@@ -77,6 +80,7 @@ using namespace isc::dhcp_ddns;
 using namespace isc::hooks;
 using namespace isc::log;
 using namespace isc::stats;
+using namespace isc::util::thread;
 using namespace std;
 
 /// Structure that holds registered hook indexes
@@ -109,6 +113,129 @@ struct Dhcp4Hooks {
 // module is called.
 Dhcp4Hooks Hooks;
 
+namespace {
+
+/// @brief Maximum number of received packets waiting for processing
+/// when multi-threading is enabled. Packets received when the queue
+/// is full are dropped.
+const size_t PACKET_QUEUE_SIZE = 1024;
+
+/// @brief Handles of the packet statistics updated for each packet.
+struct Dhcp4Stats {
+    StatHandle received_;      ///< "pkt4-received"
+    StatHandle receive_drop_;  ///< "pkt4-receive-drop"
+    StatHandle parse_failed_;  ///< "pkt4-parse-failed"
+    StatHandle sent_;          ///< "pkt4-sent"
+    StatHandle offer_sent_;    ///< "pkt4-offer-sent"
+    StatHandle ack_sent_;      ///< "pkt4-ack-sent"
+    StatHandle nak_sent_;      ///< "pkt4-nak-sent"
+
+    /// "pkt4-<type>-received" by message type, "pkt4-unknown-received"
+    /// for the unknown types.
+    StatHandle type_received_[DHCPINFORM + 1];
+
+    /// Constructor that registers the statistics
+    Dhcp4Stats() {
+        StatsMgr& mgr = StatsMgr::instance();
+        received_     = mgr.getHandle("pkt4-received");
+        receive_drop_ = mgr.getHandle("pkt4-receive-drop");
+        parse_failed_ = mgr.getHandle("pkt4-parse-failed");
+        sent_         = mgr.getHandle("pkt4-sent");
+        offer_sent_   = mgr.getHandle("pkt4-offer-sent");
+        ack_sent_     = mgr.getHandle("pkt4-ack-sent");
+        nak_sent_     = mgr.getHandle("pkt4-nak-sent");
+
+        const StatHandle unknown = mgr.getHandle("pkt4-unknown-received");
+        for (int type = 0; type <= DHCPINFORM; ++type) {
+            type_received_[type] = unknown;
+        }
+        type_received_[DHCPDISCOVER] = mgr.getHandle("pkt4-discover-received");
+        // Should not happen, but let's keep a counter for it
+        type_received_[DHCPOFFER]    = mgr.getHandle("pkt4-offer-received");
+        type_received_[DHCPREQUEST]  = mgr.getHandle("pkt4-request-received");
+        // Should not happen, but let's keep a counter for it
+        type_received_[DHCPACK]      = mgr.getHandle("pkt4-ack-received");
+        // Should not happen, but let's keep a counter for it
+        type_received_[DHCPNAK]      = mgr.getHandle("pkt4-nak-received");
+        type_received_[DHCPRELEASE]  = mgr.getHandle("pkt4-release-received");
+        type_received_[DHCPDECLINE]  = mgr.getHandle("pkt4-decline-received");
+        type_received_[DHCPINFORM]   = mgr.getHandle("pkt4-inform-received");
+    }
+};
+
+// Declare the statistics handles. As for the Hooks object, the handles
+// are resolved when the module is loaded.
+Dhcp4Stats Stats;
+
+/// @brief Counts the updates of the declined leases in progress.
+///
+/// The declined leases are updated asynchronously, so the processing of
+/// a DHCPDECLINE doesn't wait for the lease database. The allocation of
+/// a lease waits for these updates though: until the update is done the
+/// database still holds the lease of the client which declined the
+/// address, and the address could be allocated to it again.
+class PendingDeclines {
+public:
+
+    /// @brief Constructor.
+    PendingDeclines() : count_(0) {
+    }
+
+    /// @brief Records an update issued for a declined lease.
+    void add() {
+        Mutex::Locker lock(mutex_);
+        ++count_;
+    }
+
+    /// @brief Records the completion of an update.
+    void remove() {
+        Mutex::Locker lock(mutex_);
+        --count_;
+    }
+
+    /// @brief Waits for the updates issued so far, if any.
+    void wait() {
+        {
+            Mutex::Locker lock(mutex_);
+            if (count_ == 0) {
+                return;
+            }
+        }
+        LeaseMgrFactory::instance().asyncWait();
+    }
+
+private:
+
+    /// @brief Number of the updates in progress.
+    size_t count_;
+
+    /// @brief Mutex protecting the count.
+    Mutex mutex_;
+};
+
+PendingDeclines Declines;
+
+/// @brief Logs the result of the update of a declined lease.
+///
+/// @param label label of the DHCPDECLINE message
+/// @param addr declined address
+/// @param valid_lft time the address will be unavailable for
+/// @param result result of the lease update
+void
+declinedLeaseUpdated(const std::string& label, const IOAddress& addr,
+                     const uint32_t valid_lft, const AsyncLeaseResult& result) {
+    if (result.success_) {
+        LOG_INFO(lease4_logger, DHCP4_DECLINE_LEASE).arg(addr.toText())
+            .arg(label).arg(valid_lft);
+    } else {
+        LOG_ERROR(lease4_logger, DHCP4_DECLINE_FAIL).arg(addr.toText())
+            .arg(label).arg(result.error_);
+    }
+    Declines.remove();
+}
+
+}
+
 namespace isc {
 namespace dhcp {
 
@@ -416,7 +543,14 @@ const std::string Dhcpv4Srv::VENDOR_CLASS_PREFIX("VENDOR_CLASS_");
 Dhcpv4Srv::Dhcpv4Srv(uint16_t port, const bool use_bcast,
                      const bool direct_response_desired)
     : io_service_(new IOService()), shutdown_(true), alloc_engine_(), port_(port),
-      use_bcast_(use_bcast) {
+      use_bcast_(use_bcast), packet_thread_count_(0), packet_thread_pool_(),
+      latency_("pkt4"), lazy_unpack_(false) {
+
+    latency_.addMessageType(DHCPDISCOVER, "discover");
+    latency_.addMessageType(DHCPREQUEST, "request");
+    latency_.addMessageType(DHCPRELEASE, "release");
+    latency_.addMessageType(DHCPDECLINE, "decline");
+    latency_.addMessageType(DHCPINFORM, "inform");
 
     LOG_DEBUG(dhcp4_logger, DBG_DHCP4_START, DHCP4_OPEN_SOCKET).arg(port);
     try {
@@ -452,6 +586,9 @@ Dhcpv4Srv::Dhcpv4Srv(uint16_t port, const bool use_bcast,
 }
 
 Dhcpv4Srv::~Dhcpv4Srv() {
+    // Packet processing threads use the resources released below.
+    stopPacketThreads();
+
     try {
         stopD2();
     } catch(const std::exception& ex) {
@@ -482,8 +619,60 @@ Dhcpv4Srv::shutdown() {
     shutdown_ = true;
 }
 
+void
+Dhcpv4Srv::startPacketThreads() {
+    if ((packet_thread_count_ == 0) || packetThreadsRunning()) {
+        return;
+    }
+
+    // The lease backend and the host data source, if any, must be safe
+    // to be used concurrently, i.e. the memfile backend or a backend with
+    // a pool of connections.
+    std::string lease_db = "none";
+    bool thread_safe = false;
+    if (LeaseMgrFactory::haveInstance()) {
+        lease_db = LeaseMgrFactory::instance().getType();
+        thread_safe = LeaseMgrFactory::instance().isThreadSafe();
+    }
+    std::string hosts_db = "none";
+    HostDataSourcePtr host_data_source = HostMgr::instance().getHostDataSource();
+    if (host_data_source) {
+        hosts_db = host_data_source->getType();
+        thread_safe = thread_safe && host_data_source->isThreadSafe();
+    }
+    if (!thread_safe) {
+        LOG_WARN(dhcp4_logger, DHCP4_PACKET_THREADS_UNSUPPORTED)
+            .arg(lease_db).arg(hosts_db);
+        return;
+    }
+
+    if (!packet_thread_pool_) {
+        packet_thread_pool_.reset(new isc::util::thread::ThreadPool(PACKET_QUEUE_SIZE));
+    }
+#ifdef HAVE_MYSQL
+    // The MySQL client library must be initialized by each thread using it.
+    packet_thread_pool_->start(packet_thread_count_,
+                               &MySqlConnection::initThread,
+                               &MySqlConnection::endThread);
+#else
+    packet_thread_pool_->start(packet_thread_count_);
+#endif
+
+    LOG_INFO(dhcp4_logger, DHCP4_PACKET_THREADS_STARTED)
+        .arg(packet_thread_count_);
+}
+
+void
+Dhcpv4Srv::stopPacketThreads() {
+    if (packet_thread_pool_) {
+        packet_thread_pool_->wait();
+        packet_thread_pool_->stop();
+    }
+}
+
 isc::dhcp::Subnet4Ptr
 Dhcpv4Srv::selectSubnet(const Pkt4Ptr& query) const {
+    StageTimer timer(ProcessingLatency::STAGE_SUBNET_SELECTION);
 
     // DHCPv4-over-DHCPv6 is a special (and complex) case
     if (query->isDhcp4o6()) {
@@ -709,6 +898,11 @@ Dhcpv4Srv::sendPacket(const Pkt4Ptr& packet) {
     IfaceMgr::instance().send(packet);
 }
 
+void
+Dhcpv4Srv::sendPackets(const std::vector<Pkt4Ptr>& packets) {
+    IfaceMgr::instance().sendBatch(packets);
+}
+
 bool
 Dhcpv4Srv::run() {
     while (!shutdown_) {
@@ -728,14 +922,17 @@ Dhcpv4Srv::run() {
         }
     }
 
+    // Let the packet processing threads complete before the server is
+    // torn down.
+    stopPacketThreads();
+
     return (true);
 }
 
 void
 Dhcpv4Srv::run_one() {
-    // client's message and server's response
+    // client's message
     Pkt4Ptr query;
-    Pkt4Ptr rsp;
 
     try {
         // Set select() timeout to 1s. This value should not be modified
@@ -804,12 +1001,107 @@ Dhcpv4Srv::run_one() {
         return;
     }
 
-    processPacket(query, rsp);
+    // The responses to the packets received together are sent together.
+    if (!response_batch_) {
+        response_batch_.reset(new ResponseBatch4());
+    }
+    ResponseBatch4Ptr batch = response_batch_;
+    batch->add();
 
-    if (!rsp) {
-        return;
+    if (packetThreadsRunning()) {
+        // Hand the packet over to one of the packet processing threads.
+        if (!packet_thread_pool_->add(boost::bind(&Dhcpv4Srv::processPacketInThread,
+                                                  this, query, batch))) {
+            LOG_DEBUG(packet4_logger, DBG_DHCP4_BASIC, DHCP4_PACKET_QUEUE_FULL)
+                .arg(query->getRemoteAddr().toText())
+                .arg(query->getIface());
+            StatsMgr::instance().addValue(Stats.received_,
+                                          static_cast<int64_t>(1));
+            StatsMgr::instance().addValue(Stats.receive_drop_,
+                                          static_cast<int64_t>(1));
+            std::vector<Pkt4Ptr> ready;
+            batch->done(Pkt4Ptr(), ready);
+        }
+
+    } else {
+        processPacketAndSendResponse(query, batch);
+    }
+
+    // The reception cycle ends with the last packet received together with
+    // this one. The responses are sent by the thread which processes the
+    // last packet of the cycle, or here if all have been processed.
+    if (!IfaceMgr::instance().hasReceived4()) {
+        response_batch_.reset();
+        std::vector<Pkt4Ptr> ready;
+        if (batch->close(ready)) {
+            sendResponses(ready);
+        }
+    }
+}
+
+void
+Dhcpv4Srv::dropMalformedPacket(const Pkt4Ptr& query,
+                               const std::string& reason) {
+    LOG_DEBUG(bad_packet4_logger, DBG_DHCP4_DETAIL, DHCP4_PACKET_DROP_0001)
+        .arg(query->getRemoteAddr().toText())
+        .arg(query->getLocalAddr().toText())
+        .arg(query->getIface())
+        .arg(reason);
+
+    // Increase the statistics of parse failures and dropped packets.
+    isc::stats::StatsMgr::instance().addValue(Stats.parse_failed_,
+                                              static_cast<int64_t>(1));
+    isc::stats::StatsMgr::instance().addValue(Stats.receive_drop_,
+                                              static_cast<int64_t>(1));
+}
+
+void
+Dhcpv4Srv::processPacketInThread(Pkt4Ptr query, ResponseBatch4Ptr batch) {
+    processPacketAndSendResponse(query, batch);
+
+    // The callout handle associated with the query is held by the thread
+    // local store. Release it so as it doesn't outlive the packet.
+    getCalloutHandle(Pkt4Ptr());
+}
+
+void
+Dhcpv4Srv::processPacketAndSendResponse(Pkt4Ptr query, ResponseBatch4Ptr batch) {
+    // Measure the time spent in the processing stages until the response
+    // is sent.
+    LatencyMeasurement latency(latency_, query);
+
+    Pkt4Ptr rsp;
+
+    try {
+        processPacket(query, rsp);
+    } catch (const std::exception& e) {
+        LOG_ERROR(packet4_logger, DHCP4_PACKET_PROCESS_STD_EXCEPTION)
+            .arg(e.what());
+    } catch (...) {
+        LOG_ERROR(packet4_logger, DHCP4_PACKET_PROCESS_EXCEPTION);
+    }
+
+    if (rsp) {
+        prepareResponse(query, rsp);
     }
 
+    // The batch must learn about every processed packet, including these
+    // having no response.
+    std::vector<Pkt4Ptr> ready;
+    if (batch) {
+        if (!batch->done(rsp, ready)) {
+            return;
+        }
+
+    } else if (rsp) {
+        ready.push_back(rsp);
+    }
+
+    sendResponses(ready);
+}
+
+void
+Dhcpv4Srv::prepareResponse(const Pkt4Ptr& query, Pkt4Ptr& rsp) {
     try {
         // Now all fields and options are constructed into output wire buffer.
         // Option objects modification does not make sense anymore. Hooks
@@ -838,6 +1130,7 @@ Dhcpv4Srv::run_one() {
                 LOG_DEBUG(hooks_logger, DBG_DHCP4_HOOKS,
                           DHCP4_HOOK_BUFFER_SEND_SKIP)
                     .arg(rsp->getLabel());
+                rsp.reset();
                 return;
             }
 
@@ -863,15 +1156,37 @@ Dhcpv4Srv::run_one() {
             .arg(rsp->getName())
             .arg(static_cast<int>(rsp->getType()))
             .arg(rsp->toText());
-        sendPacket(rsp);
-
-        // Update statistics accordingly for sent packet.
-        processStatsSent(rsp);
 
     } catch (const std::exception& e) {
         LOG_ERROR(packet4_logger, DHCP4_PACKET_SEND_FAIL)
             .arg(rsp->getLabel())
             .arg(e.what());
+        rsp.reset();
+    }
+}
+
+void
+Dhcpv4Srv::sendResponses(const std::vector<Pkt4Ptr>& responses) {
+    if (responses.empty()) {
+        return;
+    }
+
+    try {
+        {
+            StageTimer timer(ProcessingLatency::STAGE_SEND);
+            sendPackets(responses);
+        }
+
+        // Update statistics accordingly for sent packets.
+        for (std::vector<Pkt4Ptr>::const_iterator rsp = responses.begin();
+             rsp != responses.end(); ++rsp) {
+            processStatsSent(*rsp);
+        }
+
+    } catch (const std::exception& e) {
+        LOG_ERROR(packet4_logger, DHCP4_PACKET_BATCH_SEND_FAIL)
+            .arg(responses.size())
+            .arg(e.what());
     }
 }
 
@@ -881,7 +1196,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp) {
     // failures in unpacking will cause the packet to be dropped. We
     // will increase type specific statistic further down the road.
     // See processStatsReceived().
-    isc::stats::StatsMgr::instance().addValue("pkt4-received",
+    isc::stats::StatsMgr::instance().addValue(Stats.received_,
                                               static_cast<int64_t>(1));
 
     bool skip_unpack = false;
@@ -926,25 +1241,16 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp) {
     // indicated they did it
     if (!skip_unpack) {
         try {
+            StageTimer timer(ProcessingLatency::STAGE_UNPACK);
             LOG_DEBUG(options4_logger, DBG_DHCP4_DETAIL, DHCP4_BUFFER_UNPACK)
                 .arg(query->getRemoteAddr().toText())
                 .arg(query->getLocalAddr().toText())
                 .arg(query->getIface());
+            query->setLazyUnpack(lazy_unpack_);
             query->unpack();
         } catch (const std::exception& e) {
             // Failed to parse the packet.
-            LOG_DEBUG(bad_packet4_logger, DBG_DHCP4_DETAIL,
-                      DHCP4_PACKET_DROP_0001)
-                .arg(query->getRemoteAddr().toText())
-                .arg(query->getLocalAddr().toText())
-                .arg(query->getIface())
-                .arg(e.what());
-
-            // Increase the statistics of parse failures and dropped packets.
-            isc::stats::StatsMgr::instance().addValue("pkt4-parse-failed",
-                                                      static_cast<int64_t>(1));
-            isc::stats::StatsMgr::instance().addValue("pkt4-receive-drop",
-                                                      static_cast<int64_t>(1));
+            dropMalformedPacket(query, e.what());
             return;
         }
     }
@@ -952,20 +1258,27 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp) {
     // Update statistics accordingly for received packet.
     processStatsReceived(query);
 
-    // Assign this packet to one or more classes if needed. We need to do
-    // this before calling accept(), because getSubnet4() may need client
-    // class information.
-    classifyPacket(query);
-
-    // Now it is classified the deferred unpacking can be done.
-    deferredUnpack(query);
-
-    // Check whether the message should be further processed or discarded.
-    // There is no need to log anything here. This function logs by itself.
-    if (!accept(query)) {
-        // Increase the statistic of dropped packets.
-        isc::stats::StatsMgr::instance().addValue("pkt4-receive-drop",
-                                                  static_cast<int64_t>(1));
+    // If the options are unpacked lazily, a malformed option is found
+    // when it is first retrieved, from here on.
+    try {
+        // Assign this packet to one or more classes if needed. We need to do
+        // this before calling accept(), because getSubnet4() may need client
+        // class information.
+        classifyPacket(query);
+
+        // Now it is classified the deferred unpacking can be done.
+        deferredUnpack(query);
+
+        // Check whether the message should be further processed or discarded.
+        // There is no need to log anything here. This function logs by itself.
+        if (!accept(query)) {
+            // Increase the statistic of dropped packets.
+            isc::stats::StatsMgr::instance().addValue(Stats.receive_drop_,
+                                                      static_cast<int64_t>(1));
+            return;
+        }
+    } catch (const LazyUnpackError& e) {
+        dropMalformedPacket(query, e.what());
         return;
     }
 
@@ -1046,6 +1359,10 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp) {
             // "switch" statement.
             ;
         }
+    } catch (const LazyUnpackError& e) {
+        // The query has a malformed option, found when retrieved.
+        dropMalformedPacket(query, e.what());
+
     } catch (const std::exception& e) {
 
         // Catch-all exception (we used to call only isc::Exception, but
@@ -1061,7 +1378,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp) {
             .arg(e.what());
 
         // Increase the statistic of dropped packets.
-        isc::stats::StatsMgr::instance().addValue("pkt4-receive-drop",
+        isc::stats::StatsMgr::instance().addValue(Stats.receive_drop_,
                                                   static_cast<int64_t>(1));
     }
 
@@ -1111,6 +1428,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp) {
 
     if (!skip_pack) {
         try {
+            StageTimer timer(ProcessingLatency::STAGE_PACK);
             LOG_DEBUG(options4_logger, DBG_DHCP4_DETAIL, DHCP4_PACKET_PACK)
                 .arg(rsp->getLabel());
             rsp->pack();
@@ -1227,6 +1545,18 @@ Dhcpv4Srv::buildCfgOptionList(Dhcpv4Exchange& ex) {
     if (!CfgMgr::instance().getCurrentCfg()->getCfgOption()->empty()) {
         co_list.push_back(CfgMgr::instance().getCurrentCfg()->getCfgOption());
     }
+
+    // Resolve the options. Host options are specific to the client
+    // and possibly fetched from a database for each query, so the
+    // options resolved with them are not cached.
+    if (host && !host->getCfgOption4()->empty()) {
+        ex.setCfgOptionSet(ConstCfgOptionSetPtr(new CfgOptionSet(co_list,
+                                                                 DHCP4_OPTION_SPACE)));
+    } else {
+        ex.setCfgOptionSet(CfgMgr::instance().getCurrentCfg()->
+                           getCfgOptionSetCache()->get(co_list,
+                                                       DHCP4_OPTION_SPACE));
+    }
 }
 
 void
@@ -1244,7 +1574,8 @@ Dhcpv4Srv::appendRequestedOptions(Dhcpv4Exchange& ex) {
 
     // Unlikely short cut
     const CfgOptionList& co_list = ex.getCfgOptionList();
-    if (co_list.empty()) {
+    ConstCfgOptionSetPtr options = ex.getCfgOptionSet();
+    if (co_list.empty() || !options) {
         return;
     }
 
@@ -1260,24 +1591,11 @@ Dhcpv4Srv::appendRequestedOptions(Dhcpv4Exchange& ex) {
     if (option_prl) {
         requested_opts = option_prl->getValues();
     }
-    // Iterate on the configured option list to add persistent options
-    for (CfgOptionList::const_iterator copts = co_list.begin();
-         copts != co_list.end(); ++copts) {
-        const OptionContainerPtr& opts = (*copts)->getAll(DHCP4_OPTION_SPACE);
-        if (!opts) {
-            continue;
-        }
-        // Get persistent options
-        const OptionContainerPersistIndex& idx = opts->get<2>();
-        const OptionContainerPersistRange& range = idx.equal_range(true);
-        for (OptionContainerPersistIndex::const_iterator desc = range.first;
-             desc != range.second; ++desc) {
-            // Add the persistent option code to requested options
-            if (desc->option_) {
-                uint8_t code = static_cast<uint8_t>(desc->option_->getType());
-                requested_opts.push_back(code);
-            }
-        }
+    // Add the persistent option codes to requested options
+    const std::vector<uint16_t>& persistent = options->getPersistentCodes();
+    for (std::vector<uint16_t>::const_iterator code = persistent.begin();
+         code != persistent.end(); ++code) {
+        requested_opts.push_back(static_cast<uint8_t>(*code));
     }
 
     // For each requested option code get the instance of the option
@@ -1286,15 +1604,10 @@ Dhcpv4Srv::appendRequestedOptions(Dhcpv4Exchange& ex) {
          opt != requested_opts.end(); ++opt) {
         // Add nothing when it is already there
         if (!resp->getOption(*opt)) {
-            // Iterate on the configured option list
-            for (CfgOptionList::const_iterator copts = co_list.begin();
-                 copts != co_list.end(); ++copts) {
-                OptionDescriptor desc = (*copts)->get(DHCP4_OPTION_SPACE, *opt);
-                // Got it: add it and jump to the outer loop
-                if (desc.option_) {
-                    resp->addOption(desc.option_);
-                    break;
-                }
+            // Get the option configured with the highest priority
+            OptionPtr option = options->get(*opt);
+            if (option) {
+                resp->addOption(option);
             }
         }
     }
@@ -1409,7 +1722,8 @@ Dhcpv4Srv::appendBasicOptions(Dhcpv4Exchange& ex) {
 
     // Unlikely short cut
     const CfgOptionList& co_list = ex.getCfgOptionList();
-    if (co_list.empty()) {
+    ConstCfgOptionSetPtr options = ex.getCfgOptionSet();
+    if (co_list.empty() || !options) {
         return;
     }
 
@@ -1421,14 +1735,9 @@ Dhcpv4Srv::appendBasicOptions(Dhcpv4Exchange& ex) {
         OptionPtr opt = resp->getOption(required_options[i]);
         if (!opt) {
             // Check whether option has been configured.
-            for (CfgOptionList::const_iterator copts = co_list.begin();
-                 copts != co_list.end(); ++copts) {
-                OptionDescriptor desc = (*copts)->get(DHCP4_OPTION_SPACE,
-                                                      required_options[i]);
-                if (desc.option_) {
-                    resp->addOption(desc.option_);
-                    break;
-                }
+            opt = options->get(required_options[i]);
+            if (opt) {
+                resp->addOption(opt);
             }
         }
     }
@@ -1700,6 +2009,12 @@ Dhcpv4Srv::createNameChangeRequests(const Lease4Ptr& lease,
 
 void
 Dhcpv4Srv::assignLease(Dhcpv4Exchange& ex) {
+    StageTimer timer(ProcessingLatency::STAGE_ALLOCATION);
+
+    // The lease database must not be read before the declined leases
+    // are marked as such, or a declined address could be allocated.
+    Declines.wait();
+
     // Get the pointers to the query and the response messages.
     Pkt4Ptr query = ex.getQuery();
     Pkt4Ptr resp = ex.getResponse();
@@ -2497,6 +2812,13 @@ Dhcpv4Srv::processRelease(Pkt4Ptr& release) {
                     StatsMgr::generateName("subnet", lease->subnet_id_, "assigned-addresses"),
                     static_cast<int64_t>(-1));
 
+                // The address can be allocated to another client.
+                ConstSubnet4Ptr subnet = CfgMgr::instance().getCurrentCfg()->
+                    getCfgSubnets4()->getBySubnetId(lease->subnet_id_);
+                if (subnet) {
+                    subnet->markLeaseFree(Lease::TYPE_V4, lease->addr_);
+                }
+
                 // Remove existing DNS entries for the lease, if any.
                 queueNCR(CHG_REMOVE, lease);
 
@@ -2651,10 +2973,22 @@ Dhcpv4Srv::declineLease(const Lease4Ptr& lease, const Pkt4Ptr& decline) {
     // way.
     lease->decline(CfgMgr::instance().getCurrentCfg()->getDeclinePeriod());
 
-    LeaseMgrFactory::instance().updateLease4(lease);
-
-    LOG_INFO(lease4_logger, DHCP4_DECLINE_LEASE).arg(lease->addr_.toText())
-        .arg(decline->getLabel()).arg(lease->valid_lft_);
+    // No response is sent to the DHCPDECLINE, so the lease doesn't need to
+    // be updated before the processing thread moves to the next packet.
+    // The allocation of a lease waits for the update, see assignLease.
+    // The callback may be invoked before the update returns, so the update
+    // is counted first.
+    Declines.add();
+    try {
+        LeaseMgrFactory::instance().
+            asyncUpdateLease4(lease, boost::bind(&declinedLeaseUpdated,
+                                                 decline->getLabel(),
+                                                 lease->addr_,
+                                                 lease->valid_lft_, _1));
+    } catch (...) {
+        Declines.remove();
+        throw;
+    }
 }
 
 Pkt4Ptr
@@ -2953,43 +3287,85 @@ void Dhcpv4Srv::classifyByVendor(const Pkt4Ptr& pkt) {
 }
 
 void Dhcpv4Srv::classifyPacket(const Pkt4Ptr& pkt) {
+    StageTimer timer(ProcessingLatency::STAGE_CLASSIFICATION);
+
     // First phase: built-in vendor class processing
     classifyByVendor(pkt);
 
     // Run match expressions
     // Note getClientClassDictionary() cannot be null
-    const ClientClassDefMapPtr& defs_ptr = CfgMgr::instance().getCurrentCfg()->
-        getClientClassDictionary()->getClasses();
-    for (ClientClassDefMap::const_iterator it = defs_ptr->begin();
-         it != defs_ptr->end(); ++it) {
-        // Note second cannot be null
-        const ExpressionPtr& expr_ptr = it->second->getMatchExpr();
-        // Nothing to do without an expression to evaluate
-        if (!expr_ptr) {
-            continue;
+    const ClientClassIndex& index = CfgMgr::instance().getCurrentCfg()->
+        getClientClassDictionary()->getIndex();
+    // The value stack is shared by all expressions
+    ValueStack values;
+    // Classes comparing the same value with constants: the value is
+    // computed once and selects the matching classes
+    const ClientClassIndex::GroupMap& groups = index.getGroups();
+    for (ClientClassIndex::GroupMap::const_iterator group = groups.begin();
+         group != groups.end(); ++group) {
+        try {
+            const ClientClassDefList& matches =
+                group->second->match(*pkt, values);
+            for (ClientClassDefList::const_iterator cclass = matches.begin();
+                 cclass != matches.end(); ++cclass) {
+                LOG_INFO(options4_logger, EVAL_RESULT)
+                    .arg((*cclass)->getName())
+                    .arg(true);
+                // Matching: add the class
+                pkt->addClass((*cclass)->getName());
+            }
+        } catch (const LazyUnpackError&) {
+            // The packet is malformed, it will be dropped.
+            throw;
+        } catch (const Exception& ex) {
+            const ClientClassDefList& failed = group->second->getClasses();
+            for (ClientClassDefList::const_iterator cclass = failed.begin();
+                 cclass != failed.end(); ++cclass) {
+                LOG_ERROR(options4_logger, EVAL_RESULT)
+                    .arg((*cclass)->getName())
+                    .arg(ex.what());
+            }
+        } catch (...) {
+            const ClientClassDefList& failed = group->second->getClasses();
+            for (ClientClassDefList::const_iterator cclass = failed.begin();
+                 cclass != failed.end(); ++cclass) {
+                LOG_ERROR(options4_logger, EVAL_RESULT)
+                    .arg((*cclass)->getName())
+                    .arg("get exception?");
+            }
         }
+    }
+    // Other classes are evaluated one by one
+    const ClientClassDefList& others = index.getOthers();
+    for (ClientClassDefList::const_iterator it = others.begin();
+         it != others.end(); ++it) {
+        // Note the index holds only classes with an expression
+        const CompiledExpressionPtr& expr_ptr = (*it)->getCompiledMatchExpr();
         // Evaluate the expression which can return false (no match),
         // true (match) or raise an exception (error)
         try {
-            bool status = evaluateBool(*expr_ptr, *pkt);
+            bool status = expr_ptr->evaluateBool(*pkt, values);
             if (status) {
                 LOG_INFO(options4_logger, EVAL_RESULT)
-                    .arg(it->first)
+                    .arg((*it)->getName())
                     .arg(status);
                 // Matching: add the class
-                pkt->addClass(it->first);
+                pkt->addClass((*it)->getName());
             } else {
                 LOG_DEBUG(options4_logger, DBG_DHCP4_DETAIL, EVAL_RESULT)
-                    .arg(it->first)
+                    .arg((*it)->getName())
                     .arg(status);
             }
+        } catch (const LazyUnpackError&) {
+            // The packet is malformed, it will be dropped.
+            throw;
         } catch (const Exception& ex) {
             LOG_ERROR(options4_logger, EVAL_RESULT)
-                .arg(it->first)
+                .arg((*it)->getName())
                 .arg(ex.what());
         } catch (...) {
             LOG_ERROR(options4_logger, EVAL_RESULT)
-                .arg(it->first)
+                .arg((*it)->getName())
                 .arg("get exception?");
         }
     }
@@ -2998,6 +3374,8 @@ void Dhcpv4Srv::classifyPacket(const Pkt4Ptr& pkt) {
 void
 Dhcpv4Srv::deferredUnpack(Pkt4Ptr& query)
 {
+    StageTimer timer(ProcessingLatency::STAGE_UNPACK);
+
     // Iterate on the list of deferred option codes
     BOOST_FOREACH(const uint16_t& code, query->getDeferredOptions()) {
         OptionDefinitionPtr def;
@@ -3122,38 +3500,11 @@ void Dhcpv4Srv::processStatsReceived(const Pkt4Ptr& query) {
     // Note that we're not bumping pkt4-received statistic as it was
     // increased early in the packet reception code.
 
-    string stat_name = "pkt4-unknown-received";
+    StatHandle handle = Stats.type_received_[0];
     try {
-        switch (query->getType()) {
-        case DHCPDISCOVER:
-            stat_name = "pkt4-discover-received";
-            break;
-        case DHCPOFFER:
-            // Should not happen, but let's keep a counter for it
-            stat_name = "pkt4-offer-received";
-            break;
-        case DHCPREQUEST:
-            stat_name = "pkt4-request-received";
-            break;
-        case DHCPACK:
-            // Should not happen, but let's keep a counter for it
-            stat_name = "pkt4-ack-received";
-            break;
-        case DHCPNAK:
-            // Should not happen, but let's keep a counter for it
-            stat_name = "pkt4-nak-received";
-            break;
-        case DHCPRELEASE:
-            stat_name = "pkt4-release-received";
-        break;
-        case DHCPDECLINE:
-            stat_name = "pkt4-decline-received";
-            break;
-        case DHCPINFORM:
-            stat_name = "pkt4-inform-received";
-            break;
-        default:
-            ; // do nothing
+        const uint8_t type = query->getType();
+        if (type <= DHCPINFORM) {
+            handle = Stats.type_received_[type];
         }
     }
     catch (...) {
@@ -3163,33 +3514,33 @@ void Dhcpv4Srv::processStatsReceived(const Pkt4Ptr& query) {
         // name of pkt4-unknown-received.
     }
 
-    isc::stats::StatsMgr::instance().addValue(stat_name,
+    isc::stats::StatsMgr::instance().addValue(handle,
                                               static_cast<int64_t>(1));
 }
 
 void Dhcpv4Srv::processStatsSent(const Pkt4Ptr& response) {
     // Increase generic counter for sent packets.
-    isc::stats::StatsMgr::instance().addValue("pkt4-sent",
+    isc::stats::StatsMgr::instance().addValue(Stats.sent_,
                                               static_cast<int64_t>(1));
 
     // Increase packet type specific counter for packets sent.
-    string stat_name;
+    StatHandle handle;
     switch (response->getType()) {
     case DHCPOFFER:
-        stat_name = "pkt4-offer-sent";
+        handle = Stats.offer_sent_;
         break;
     case DHCPACK:
-        stat_name = "pkt4-ack-sent";
+        handle = Stats.ack_sent_;
         break;
     case DHCPNAK:
-        stat_name = "pkt4-nak-sent";
+        handle = Stats.nak_sent_;
         break;
     default:
         // That should never happen
         return;
     }
 
-    isc::stats::StatsMgr::instance().addValue(stat_name,
+    isc::stats::StatsMgr::instance().addValue(handle,
                                               static_cast<int64_t>(1));
 }
 
@@ -21,6 +21,9 @@
 #include <dhcpsrv/cfg_option.h>
 #include <hooks/callout_handle.h>
 #include <dhcpsrv/daemon.h>
+#include <dhcpsrv/processing_latency.h>
+#include <dhcpsrv/response_batch.h>
+#include <util/threads/thread_pool.h>
 
 #include <boost/noncopyable.hpp>
 
@@ -119,6 +122,20 @@ public:
         return (cfg_option_list_);
     }
 
+    /// @brief Returns the options resolved from the configured option list.
+    ///
+    /// @return the resolved options or null if the list was not built
+    ConstCfgOptionSetPtr getCfgOptionSet() const {
+        return (cfg_option_set_);
+    }
+
+    /// @brief Sets the options resolved from the configured option list.
+    ///
+    /// @param cfg_option_set the resolved options
+    void setCfgOptionSet(const ConstCfgOptionSetPtr& cfg_option_set) {
+        cfg_option_set_ = cfg_option_set;
+    }
+
     /// @brief Sets reserved values of siaddr, sname and file in the
     /// server's response.
     void setReservedMessageFields();
@@ -170,11 +187,19 @@ private:
     /// @note The configured option list is an *ordered* list of
     /// @c CfgOption objects used to append options to the response.
     CfgOptionList cfg_option_list_;
+    /// @brief Options resolved from the configured option list.
+    ConstCfgOptionSetPtr cfg_option_set_;
 };
 
 /// @brief Type representing the pointer to the @c Dhcpv4Exchange.
 typedef boost::shared_ptr<Dhcpv4Exchange> Dhcpv4ExchangePtr;
 
+/// @brief Type of the responses to the queries received together.
+typedef ResponseBatch<Pkt4Ptr> ResponseBatch4;
+
+/// @brief Type representing the pointer to the @c ResponseBatch4.
+typedef boost::shared_ptr<ResponseBatch4> ResponseBatch4Ptr;
+
 
 /// @brief DHCPv4 server service.
 ///
@@ -260,9 +285,92 @@ public:
     /// @param rsp A pointer to the response
     void processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp);
 
+    /// @brief Process a single incoming DHCPv4 packet and send the response.
+    ///
+    /// This method calls @ref processPacket and transmits the response, if
+    /// any. It is executed by the packet processing threads when
+    /// multi-threading is enabled, or directly by @ref run_one otherwise.
+    /// It doesn't throw.
+    ///
+    /// @param query A pointer to the packet to be processed.
+    /// @param batch Responses to the queries received together with this
+    /// one. The response is added to them and they are sent when the last
+    /// of these queries has been processed. If null, the response is sent
+    /// at once.
+    void processPacketAndSendResponse(Pkt4Ptr query,
+                                      ResponseBatch4Ptr batch =
+                                      ResponseBatch4Ptr());
+
     /// @brief Instructs the server to shut down.
     void shutdown();
 
+    /// @name Multi-threaded packet processing.
+    ///
+    //@{
+    /// @brief Sets the number of threads processing received packets.
+    ///
+    /// The value of 0 (default) disables multi-threading, i.e. the packets
+    /// are received and processed by the main thread. The new value is
+    /// used next time @ref startPacketThreads is called.
+    ///
+    /// @param thread_count Number of packet processing threads.
+    void setPacketThreadCount(const size_t thread_count) {
+        packet_thread_count_ = thread_count;
+    }
+
+    /// @brief Returns the configured number of packet processing threads.
+    size_t getPacketThreadCount() const {
+        return (packet_thread_count_);
+    }
+
+    /// @brief Starts the packet processing threads.
+    ///
+    /// The threads are started only if the number of threads is greater
+    /// than 0 and the current configuration allows multi-threading, i.e.
+    /// the lease database is memfile and no hosts database is configured.
+    /// Otherwise, a warning is logged and the packets are processed by
+    /// the main thread.
+    void startPacketThreads();
+
+    /// @brief Stops the packet processing threads.
+    ///
+    /// Waits until all queued packets have been processed and stops the
+    /// threads. This must be called before any change to the state used
+    /// during packet processing, e.g. before applying a new configuration
+    /// or reloading hooks libraries.
+    void stopPacketThreads();
+
+    /// @brief Checks if the packets are processed by multiple threads.
+    bool packetThreadsRunning() const {
+        return (packet_thread_pool_ && packet_thread_pool_->isRunning());
+    }
+
+    /// @brief Returns the latency of the packet processing stages.
+    ProcessingLatency& getLatency() {
+        return (latency_);
+    }
+    //@}
+
+    /// @brief Controls whether the options of the received packets are
+    /// unpacked lazily.
+    ///
+    /// When enabled, the options of a received packet are unpacked when
+    /// they are first retrieved (see @ref Pkt::setLazyUnpack), so the
+    /// options which the server and the hooks libraries don't use are
+    /// never unpacked. A malformed option doesn't cause the packet to be
+    /// dropped unless the option is used. The packet is then dropped by
+    /// @ref processPacket as if it had failed to be unpacked.
+    ///
+    /// @param lazy Indicates if the options should be unpacked lazily.
+    void setLazyUnpack(const bool lazy) {
+        lazy_unpack_ = lazy;
+    }
+
+    /// @brief Returns whether the options are unpacked lazily.
+    bool isLazyUnpack() const {
+        return (lazy_unpack_);
+    }
+
     ///
     /// @name Public accessors returning values required to (re)open sockets.
     ///
@@ -478,6 +586,11 @@ protected:
     /// @note The configured option list is an *ordered* list of
     /// @c CfgOption objects used to append options to the response.
     ///
+    /// The options of the list are resolved in the DHCPv4 option space
+    /// (see @ref CfgOptionSet). The resolved options are shared by the
+    /// clients having the same configured option list, unless the list
+    /// holds options of a host reservation.
+    ///
     /// @param ex The exchange where the configured option list is cached
     void buildCfgOptionList(Dhcpv4Exchange& ex);
 
@@ -791,6 +904,12 @@ protected:
     /// simulates transmission of a packet. For that purpose it is protected.
     virtual void sendPacket(const Pkt4Ptr& pkt);
 
+    /// @brief dummy wrapper around IfaceMgr::sendBatch()
+    ///
+    /// This method is useful for testing purposes, where its replacement
+    /// simulates transmission of packets. For that purpose it is protected.
+    virtual void sendPackets(const std::vector<Pkt4Ptr>& pkts);
+
     /// @brief Assigns incoming packet to zero or more classes.
     ///
     /// @note This is done in two phases: first the content of the
@@ -840,6 +959,61 @@ private:
     uint16_t port_;  ///< UDP port number on which server listens.
     bool use_bcast_; ///< Should broadcast be enabled on sockets (if true).
 
+    /// @brief Number of packet processing threads.
+    size_t packet_thread_count_;
+
+    /// @brief Pool of packet processing threads.
+    isc::util::thread::ThreadPoolPtr packet_thread_pool_;
+
+    /// @brief Latency of the packet processing stages.
+    ProcessingLatency latency_;
+
+    /// @brief Indicates if the options of the received packets are unpacked
+    /// lazily.
+    bool lazy_unpack_;
+
+    /// @brief Work item executed by the packet processing threads.
+    ///
+    /// Calls @ref processPacketAndSendResponse and releases the callout
+    /// handle associated with the packet.
+    ///
+    /// @param query A pointer to the packet to be processed.
+    /// @param batch Responses to the queries received together with this
+    /// one.
+    void processPacketInThread(Pkt4Ptr query, ResponseBatch4Ptr batch);
+
+    /// @brief Drops a query which could not be parsed.
+    ///
+    /// Logs the reason and increases the statistics of the parse failures
+    /// and of the dropped packets. It is called when the unpacking fails
+    /// or, if the options are unpacked lazily, when a malformed option is
+    /// retrieved.
+    ///
+    /// @param query A pointer to the dropped packet.
+    /// @param reason Reason of the failure.
+    void dropMalformedPacket(const Pkt4Ptr& query, const std::string& reason);
+
+    /// @brief Runs the buffer4_send callouts and logs the response.
+    ///
+    /// It doesn't throw.
+    ///
+    /// @param query A pointer to the packet processed.
+    /// @param [in,out] rsp A pointer to the response, reset if the
+    /// response must not be sent.
+    void prepareResponse(const Pkt4Ptr& query, Pkt4Ptr& rsp);
+
+    /// @brief Sends the responses and updates the statistics.
+    ///
+    /// It doesn't throw.
+    ///
+    /// @param responses Responses to be sent.
+    void sendResponses(const std::vector<Pkt4Ptr>& responses);
+
+    /// @brief Responses to the queries of the current reception cycle.
+    ///
+    /// It is used by the thread receiving the packets only.
+    ResponseBatch4Ptr response_batch_;
+
 public:
     /// Class methods for DHCPv4-over-DHCPv6 handler
 
@@ -42,7 +42,8 @@ usage() {
     cerr << "Kea DHCPv4 server, version " << VERSION << endl;
     cerr << endl;
     cerr << "Usage: " << DHCP4_NAME
-         << " -[v|V|W] [-d] [-{c|t} cfgfile] [-p number]" << endl;
+         << " -[v|V|W] [-d] [-{c|t} cfgfile] [-p number] [-N number] [-L]"
+         << endl;
     cerr << "  -v: print version number and exit" << endl;
     cerr << "  -V: print extended version and exit" << endl;
     cerr << "  -W: display the configuration report and exit" << endl;
@@ -51,6 +52,10 @@ usage() {
     cerr << "  -t file: check the configuration file syntax and exit" << endl;
     cerr << "  -p number: specify non-standard port number 1-65535 "
          << "(useful for testing only)" << endl;
+    cerr << "  -N number: specify the number of packet processing threads"
+         << " 0-256 (0 disables multi-threading)" << endl;
+    cerr << "  -L: unpack the options of the received packets when used"
+         << endl;
     exit(EXIT_FAILURE);
 }
 } // end of anonymous namespace
@@ -62,11 +67,13 @@ main(int argc, char* argv[]) {
                                          // useful for testing only.
     bool verbose_mode = false; // Should server be verbose?
     bool check_mode = false;   // Check syntax
+    int thread_count = 0;      // Packet processing threads
+    bool lazy_unpack = false;  // Unpack options when used
 
     // The standard config file
     std::string config_file("");
 
-    while ((ch = getopt(argc, argv, "dvVWc:p:t:")) != -1) {
+    while ((ch = getopt(argc, argv, "dvVWc:p:t:N:L")) != -1) {
         switch (ch) {
         case 'd':
             verbose_mode = true;
@@ -107,6 +114,25 @@ main(int argc, char* argv[]) {
             }
             break;
 
+        case 'N':
+            try {
+                thread_count = boost::lexical_cast<int>(optarg);
+            } catch (const boost::bad_lexical_cast &) {
+                cerr << "Failed to parse number of threads: [" << optarg
+                     << "], 0-256 allowed." << endl;
+                usage();
+            }
+            if (thread_count < 0 || thread_count > 256) {
+                cerr << "Failed to parse number of threads: [" << optarg
+                     << "], 0-256 allowed." << endl;
+                usage();
+            }
+            break;
+
+        case 'L':
+            lazy_unpack = true;
+            break;
+
         default:
             usage();
         }
@@ -195,6 +221,12 @@ main(int argc, char* argv[]) {
         // Remember verbose-mode
         server.setVerbose(verbose_mode);
 
+        // The threads are started when the configuration is applied.
+        server.setPacketThreadCount(thread_count);
+
+        // Received options are unpacked when used.
+        server.setLazyUnpack(lazy_unpack);
+
         // Create our PID file.
         server.setProcName(DHCP4_NAME);
         server.setConfigFile(config_file);
@@ -3938,6 +3938,44 @@ TEST_F(Dhcpv4SrvTest, statisticsUnknownRcvd) {
     EXPECT_EQ(1, drop_stat->getInteger().first);
 }
 
+// Test checks that a query holding a malformed option is dropped and
+// counted as a parse failure when the options are unpacked lazily.
+TEST_F(Dhcpv4SrvTest, lazyUnpackMalformedOption) {
+    IfaceMgrTestConfig test_config(true);
+    IfaceMgr::instance().openSockets4();
+
+    NakedDhcpv4Srv srv(0);
+    configure(CONFIGS[0]);
+    srv.setLazyUnpack(true);
+
+    // The server identifier is too short to hold an address. It is
+    // retrieved when the server checks if the query is addressed to it.
+    Pkt4Ptr req(new Pkt4(DHCPREQUEST, 1234));
+    req->addOption(OptionPtr(new Option(Option::V4, DHO_DHCP_SERVER_IDENTIFIER,
+                                        OptionBuffer(2, 1))));
+    ASSERT_NO_THROW(req->pack());
+    const isc::util::OutputBuffer& buf = req->getBuffer();
+    Pkt4Ptr query(new Pkt4(static_cast<const uint8_t*>(buf.getData()),
+                           buf.getLength()));
+    query->setRemoteAddr(IOAddress("192.0.2.1"));
+    query->setIface("eth1");
+
+    srv.fakeReceive(query);
+    srv.run();
+
+    // The query is dropped as if it had failed to be unpacked.
+    EXPECT_TRUE(srv.fake_sent_.empty());
+
+    using namespace isc::stats;
+    StatsMgr& mgr = StatsMgr::instance();
+    ObservationPtr parse_failed = mgr.getObservation("pkt4-parse-failed");
+    ObservationPtr drop_stat = mgr.getObservation("pkt4-receive-drop");
+    ASSERT_TRUE(parse_failed);
+    ASSERT_TRUE(drop_stat);
+    EXPECT_EQ(1, parse_failed->getInteger().first);
+    EXPECT_EQ(1, drop_stat->getInteger().first);
+}
+
 // This test verifies that the server is able to handle an empty client-id
 // in incoming client message.
 TEST_F(Dhcpv4SrvTest, emptyClientId) {
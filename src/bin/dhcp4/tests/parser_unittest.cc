@@ -129,6 +129,78 @@ TEST(ParserTest, keywordDhcp4) {
      testParser(txt, Parser4Context::PARSER_DHCP4);
 }
 
+// Checks that the packed lease database parameter is accepted.
+TEST(ParserTest, leaseDatabasePacked) {
+    string txt = "{ \"Dhcp4\": { \"lease-database\": {"
+                 " \"type\": \"memfile\", \"packed\": true } } }";
+    testParser(txt, Parser4Context::PARSER_DHCP4);
+}
+
+// Checks that the group commit lease database parameters are accepted.
+TEST(ParserTest, leaseDatabaseGroupCommit) {
+    string txt = "{ \"Dhcp4\": { \"lease-database\": {"
+                 " \"type\": \"memfile\","
+                 " \"group-commit\": true,"
+                 " \"group-commit-sync\": false,"
+                 " \"group-commit-max-batch\": 64,"
+                 " \"group-commit-max-latency\": 10 } } }";
+    testParser(txt, Parser4Context::PARSER_DHCP4);
+}
+
+// Checks that the load-threads lease database parameter is accepted.
+TEST(ParserTest, leaseDatabaseLoadThreads) {
+    string txt = "{ \"Dhcp4\": { \"lease-database\": {"
+                 " \"type\": \"memfile\","
+                 " \"load-threads\": 4 } } }";
+    testParser(txt, Parser4Context::PARSER_DHCP4);
+}
+
+// Checks that the in-process lease file cleanup parameters are accepted.
+TEST(ParserTest, leaseDatabaseLfcInProcess) {
+    string txt = "{ \"Dhcp4\": { \"lease-database\": {"
+                 " \"type\": \"memfile\","
+                 " \"lfc-in-process\": true,"
+                 " \"lfc-batch-size\": 1000,"
+                 " \"lfc-batch-interval\": 5 } } }";
+    testParser(txt, Parser4Context::PARSER_DHCP4);
+}
+
+// Checks that the lfc-snapshot-format lease database parameter is accepted.
+TEST(ParserTest, leaseDatabaseLfcSnapshotFormat) {
+    string txt = "{ \"Dhcp4\": { \"lease-database\": {"
+                 " \"type\": \"memfile\","
+                 " \"lfc-snapshot-format\": \"binary\" } } }";
+    testParser(txt, Parser4Context::PARSER_DHCP4);
+}
+
+// Checks that the host cache parameters are accepted.
+TEST(ParserTest, hostsDatabaseCache) {
+    string txt = "{ \"Dhcp4\": { \"hosts-database\": {"
+                 " \"type\": \"mysql\","
+                 " \"cache-size\": 1024,"
+                 " \"cache-ttl\": 60,"
+                 " \"cache-negative-ttl\": 5 } } }";
+    testParser(txt, Parser4Context::PARSER_DHCP4);
+}
+
+// Checks that the connection pool lease database parameters are accepted.
+TEST(ParserTest, leaseDatabaseConnectionPool) {
+    string txt = "{ \"Dhcp4\": { \"lease-database\": {"
+                 " \"type\": \"memfile\","
+                 " \"connection-pool-size\": 8,"
+                 " \"reconnect-wait-time\": 1000 } } }";
+    testParser(txt, Parser4Context::PARSER_DHCP4);
+}
+
+// Checks that the connection pool hosts database parameters are accepted.
+TEST(ParserTest, hostsDatabaseConnectionPool) {
+    string txt = "{ \"Dhcp4\": { \"hosts-database\": {"
+                 " \"type\": \"mysql\","
+                 " \"connection-pool-size\": 8,"
+                 " \"reconnect-wait-time\": 1000 } } }";
+    testParser(txt, Parser4Context::PARSER_DHCP4);
+}
+
 // Tests if bash (#) comments are supported. That's the only comment type that
 // was supported by the old parser.
 TEST(ParserTest, bashComments) {
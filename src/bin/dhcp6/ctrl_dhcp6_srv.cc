@@ -11,6 +11,7 @@
 #include <dhcp/libdhcp++.h>
 #include <dhcpsrv/cfgmgr.h>
 #include <dhcpsrv/cfg_db_access.h>
+#include <dhcpsrv/host_mgr.h>
 #include <dhcp6/ctrl_dhcp6_srv.h>
 #include <dhcp6/dhcp6to4_ipc.h>
 #include <dhcp6/dhcp6_log.h>
@@ -186,9 +187,12 @@ ControlledDhcpv6Srv::commandShutdownHandler(const string&, ConstElementPtr) {
 ConstElementPtr
 ControlledDhcpv6Srv::commandLibReloadHandler(const string&, ConstElementPtr) {
     /// @todo delete any stored CalloutHandles referring to the old libraries
-    /// Get list of currently loaded libraries and reload them.
+    /// Get list of currently loaded libraries and reload them. The packet
+    /// processing threads must not execute callouts in the meantime.
+    stopPacketThreads();
     HookLibsCollection loaded = HooksManager::getLibraryInfo();
     bool status = HooksManager::loadLibraries(loaded);
+    startPacketThreads();
     if (!status) {
         LOG_ERROR(dhcp6_logger, DHCP6_HOOKS_LIBS_RELOAD_FAIL);
         ConstElementPtr answer = isc::config::createAnswer(1,
@@ -321,6 +325,10 @@ ControlledDhcpv6Srv::commandConfigSetHandler(const string&,
     Daemon::configureLogger(args->get("Logging"),
                             CfgMgr::instance().getStagingCfg());
 
+    // The packet processing threads use the current configuration, so
+    // they are stopped until the new configuration is in place.
+    stopPacketThreads();
+
     // Now we configure the server proper.
     ConstElementPtr result = processConfig(dhcp6);
 
@@ -336,6 +344,10 @@ ControlledDhcpv6Srv::commandConfigSetHandler(const string&,
         CfgMgr::instance().commit();
     }
 
+    // The new configuration may have changed the lease database type,
+    // so it must be checked again whether the threads can be used.
+    startPacketThreads();
+
     return (result);
 }
 
@@ -422,6 +434,35 @@ ControlledDhcpv6Srv::commandLeasesReclaimHandler(const string&,
 }
 
 isc::data::ConstElementPtr
+ControlledDhcpv6Srv::commandHostCacheFlushHandler(const string&,
+                                                 ConstElementPtr) {
+    HostMgr& host_mgr = HostMgr::instance();
+    if (!host_mgr.getHostCache()) {
+        return (isc::config::createAnswer(CONTROL_RESULT_ERROR,
+                                          "Host cache is not enabled."));
+    }
+    const size_t count = host_mgr.flushCache();
+    std::ostringstream msg;
+    msg << "Host cache flushed: " << count << " entries removed.";
+    return (isc::config::createAnswer(CONTROL_RESULT_SUCCESS, msg.str()));
+}
+
+ConstElementPtr
+ControlledDhcpv6Srv::commandLatencyGetHandler(const string&,
+                                              ConstElementPtr) {
+    return (isc::config::createAnswer(CONTROL_RESULT_SUCCESS,
+                                      getLatency().toElement()));
+}
+
+ConstElementPtr
+ControlledDhcpv6Srv::commandLatencyResetHandler(const string&,
+                                                ConstElementPtr) {
+    getLatency().reset();
+    return (isc::config::createAnswer(CONTROL_RESULT_SUCCESS,
+                                      "Latency histograms reset."));
+}
+
+ConstElementPtr
 ControlledDhcpv6Srv::processCommand(const std::string& command,
                                     isc::data::ConstElementPtr args) {
     string txt = args ? args->str() : "(none)";
@@ -469,6 +510,15 @@ ControlledDhcpv6Srv::processCommand(const std::string& command,
         } else if (command == "config-write") {
             return (srv->commandConfigWriteHandler(command, args));
 
+        } else if (command == "host-cache-flush") {
+            return (srv->commandHostCacheFlushHandler(command, args));
+
+        } else if (command == "latency-get") {
+            return (srv->commandLatencyGetHandler(command, args));
+
+        } else if (command == "latency-reset") {
+            return (srv->commandLatencyResetHandler(command, args));
+
         }
 
         return (isc::config::createAnswer(1, "Unrecognized command:"
@@ -638,6 +688,15 @@ ControlledDhcpv6Srv::ControlledDhcpv6Srv(uint16_t port)
     CommandMgr::instance().registerCommand("config-write",
         boost::bind(&ControlledDhcpv6Srv::commandConfigWriteHandler, this, _1, _2));
 
+    CommandMgr::instance().registerCommand("host-cache-flush",
+        boost::bind(&ControlledDhcpv6Srv::commandHostCacheFlushHandler, this, _1, _2));
+
+    CommandMgr::instance().registerCommand("latency-get",
+        boost::bind(&ControlledDhcpv6Srv::commandLatencyGetHandler, this, _1, _2));
+
+    CommandMgr::instance().registerCommand("latency-reset",
+        boost::bind(&ControlledDhcpv6Srv::commandLatencyResetHandler, this, _1, _2));
+
     CommandMgr::instance().registerCommand("leases-reclaim",
         boost::bind(&ControlledDhcpv6Srv::commandLeasesReclaimHandler, this, _1, _2));
 
@@ -671,6 +730,15 @@ ControlledDhcpv6Srv::ControlledDhcpv6Srv(uint16_t port)
 
     CommandMgr::instance().registerCommand("statistic-remove-all",
         boost::bind(&StatsMgr::statisticRemoveAllHandler, _1, _2));
+
+    CommandMgr::instance().registerCommand("statistic-sample-age-set",
+        boost::bind(&StatsMgr::statisticSetMaxSampleAgeHandler, _1, _2));
+
+    CommandMgr::instance().registerCommand("statistic-sample-count-set",
+        boost::bind(&StatsMgr::statisticSetMaxSampleCountHandler, _1, _2));
+
+    CommandMgr::instance().registerCommand("statistic-rates-get",
+        boost::bind(&StatsMgr::statisticGetRatesHandler, _1, _2));
 }
 
 void ControlledDhcpv6Srv::shutdown() {
@@ -694,15 +762,21 @@ ControlledDhcpv6Srv::~ControlledDhcpv6Srv() {
         CommandMgr::instance().deregisterCommand("config-reload");
         CommandMgr::instance().deregisterCommand("config-test");
         CommandMgr::instance().deregisterCommand("config-write");
+        CommandMgr::instance().deregisterCommand("host-cache-flush");
+        CommandMgr::instance().deregisterCommand("latency-get");
+        CommandMgr::instance().deregisterCommand("latency-reset");
         CommandMgr::instance().deregisterCommand("leases-reclaim");
         CommandMgr::instance().deregisterCommand("libreload");
         CommandMgr::instance().deregisterCommand("shutdown");
         CommandMgr::instance().deregisterCommand("statistic-get");
         CommandMgr::instance().deregisterCommand("statistic-get-all");
+        CommandMgr::instance().deregisterCommand("statistic-rates-get");
         CommandMgr::instance().deregisterCommand("statistic-remove");
         CommandMgr::instance().deregisterCommand("statistic-remove-all");
         CommandMgr::instance().deregisterCommand("statistic-reset");
         CommandMgr::instance().deregisterCommand("statistic-reset-all");
+        CommandMgr::instance().deregisterCommand("statistic-sample-age-set");
+        CommandMgr::instance().deregisterCommand("statistic-sample-count-set");
         CommandMgr::instance().deregisterCommand("version-get");
 
     } catch (...) {
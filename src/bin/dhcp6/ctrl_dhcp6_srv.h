@@ -265,6 +265,47 @@ private:
     commandLeasesReclaimHandler(const std::string& command,
                                 isc::data::ConstElementPtr args);
 
+    /// @brief Handler for processing 'host-cache-flush' command
+    ///
+    /// This handler processes host-cache-flush command, which removes all
+    /// entries of the cache of the host reservations retrieved from the
+    /// hosts database.
+    ///
+    /// @param command (parameter ignored)
+    /// @param args (parameter ignored)
+    ///
+    /// @return status of the command (an error if the cache is not enabled)
+    isc::data::ConstElementPtr
+    commandHostCacheFlushHandler(const std::string& command,
+                                 isc::data::ConstElementPtr args);
+
+    /// @brief Handler for processing 'latency-get' command
+    ///
+    /// This handler processes latency-get command, which returns the
+    /// summaries of the latency histograms of the packet processing stages
+    /// by message type.
+    ///
+    /// @param command (parameter ignored)
+    /// @param args (parameter ignored)
+    ///
+    /// @return status of the command with the latency summaries
+    isc::data::ConstElementPtr
+    commandLatencyGetHandler(const std::string& command,
+                             isc::data::ConstElementPtr args);
+
+    /// @brief Handler for processing 'latency-reset' command
+    ///
+    /// This handler processes latency-reset command, which discards the
+    /// values recorded in the latency histograms.
+    ///
+    /// @param command (parameter ignored)
+    /// @param args (parameter ignored)
+    ///
+    /// @return status of the command
+    isc::data::ConstElementPtr
+    commandLatencyResetHandler(const std::string& command,
+                               isc::data::ConstElementPtr args);
+
     /// @brief Reclaims expired IPv6 leases and reschedules timer.
     ///
     /// This is a wrapper method for @c AllocEngine::reclaimExpiredLeases6.
@@ -691,8 +691,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 /* %% [3.0] code to copy yytext_ptr to yytext[] goes here, if %array \ */\
 	(yy_c_buf_p) = yy_cp;
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 161
-#define YY_END_OF_BUFFER 162
+#define YY_NUM_RULES 175
+#define YY_END_OF_BUFFER 176
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -700,147 +700,163 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[1266] =
+static const flex_int16_t yy_accept[1411] =
     {   0,
-      154,  154,    0,    0,    0,    0,    0,    0,    0,    0,
-      162,  160,   10,   11,  160,    1,  154,  151,  154,  154,
-      160,  153,  152,  160,  160,  160,  160,  160,  147,  148,
-      160,  160,  160,  149,  150,    5,    5,    5,  160,  160,
-      160,   10,   11,    0,    0,  143,    0,    0,    0,    0,
+      168,  168,    0,    0,    0,    0,    0,    0,    0,    0,
+      176,  174,   10,   11,  174,    1,  168,  165,  168,  168,
+      174,  167,  166,  174,  174,  174,  174,  174,  161,  162,
+      174,  174,  174,  163,  164,    5,    5,    5,  174,  174,
+      174,   10,   11,    0,    0,  157,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    1,  154,
-      154,    0,  153,  154,    3,    2,    6,    0,  154,    0,
-        0,    0,    0,    0,    0,    4,    0,    0,    9,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    1,  168,
+      168,    0,  167,    3,    2,    6,    0,  168,    0,    0,
+        0,    0,    0,    0,    4,    0,    0,    9,  158,    0,
 
-      144,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  146,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  160,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    2,    0,    0,    0,    0,    0,    0,    0,
-        8,    0,    0,    0,    0,  122,    0,    0,  123,    0,
-        0,    0,    0,    0,    0,    0,    0,  145,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    8,
+        0,    0,    0,    0,  136,    0,    0,  137,    0,    0,
+        0,    0,    0,    0,    0,  159,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   80,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   94,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  159,  157,
-        0,  156,  155,    0,    0,    0,    0,    0,    0,    0,
-      121,    0,    0,   27,    0,   26,    0,    0,   86,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  173,
+      171,    0,  170,  169,    0,    0,    0,    0,    0,    0,
+        0,  135,    0,    0,   27,    0,   26,    0,    0,  100,
 
-        0,    0,    0,    0,    0,   46,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   46,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   84,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   98,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      158,  155,    0,    0,    0,    0,    0,    0,    0,    0,
-       28,    0,    0,   30,    0,    0,    0,    0,    0,   87,
+        0,    0,    0,    0,  172,  169,    0,    0,    0,    0,
+        0,    0,    0,    0,   28,    0,    0,   30,    0,    0,
 
-        0,    0,    0,    0,   66,    0,    0,    0,    0,    0,
-        0,  106,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   49,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  101,    0,    0,    0,    0,   80,
+        0,    0,    0,    0,    0,    0,  120,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   49,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   65,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   75,    0,   50,    0,    0,    0,
+        0,    0,   79,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   89,    0,   50,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  102,  126,
-       42,    0,   47,    0,    0,    0,    0,    0,    0,  140,
-       35,    0,   32,    0,   31,    0,    0,    0,  114,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  116,  140,
+       42,    0,   47,    0,    0,    0,    0,    0,    0,  154,
 
+       35,    0,   32,    0,   31,    0,    0,    0,  128,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  109,    0,    0,
+        0,    0,    0,    0,    0,    0,  139,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   44,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   82,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  129,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  124,    0,
+        0,    0,    0,    7,   33,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   95,    0,    0,    0,
-        0,    0,    0,    0,  125,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       44,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   68,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  115,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  110,    0,    0,    0,    0,    7,   33,    0,
+        0,    0,    0,    0,    0,    0,  111,    0,    0,    0,
+        0,    0,  108,    0,    0,    0,    0,    0,    0,    0,
+        0,   84,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   91,    0,    0,    0,    0,    0,    0,  105,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  123,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   97,    0,    0,    0,    0,    0,   94,    0,
-        0,    0,    0,    0,    0,    0,    0,   70,    0,    0,
+        0,    0,  133,    0,  106,    0,    0,    0,  110,   43,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   51,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   77,    0,    0,    0,
-        0,    0,    0,   91,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  109,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  119,
+        0,    0,    0,    0,   75,    0,    0,    0,    0,  155,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   97,    0,
 
-       92,    0,    0,    0,   96,   43,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   51,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   61,
-        0,    0,    0,    0,  141,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   83,
+      122,    0,    0,    0,    0,    0,   54,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      108,    0,    0,    0,    0,    0,   54,    0,    0,    0,
+        0,    0,    0,    0,   48,   83,    0,    0,    0,  119,
+        0,    0,    0,   41,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  113,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       48,   69,    0,    0,    0,  105,    0,    0,    0,   41,
+        0,   66,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  153,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   92,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   99,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  139,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   78,    0,    0,
+        0,    0,    0,    0,   38,    0,    0,    0,    0,    0,
+        0,    0,    0,   16,    0,  134,   14,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       65,    0,    0,    0,    0,    0,  125,  112,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  121,  138,    0,   37,    0,  130,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       38,    0,    0,    0,    0,    0,    0,    0,   16,    0,
-      120,   14,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  111,   98,
+       20,    0,    0,   77,    0,    0,    0,    0,  132,   45,
 
+        0,   85,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  107,  124,    0,   37,    0,  116,
-        0,    0,    0,    0,    0,    0,   20,    0,    0,   63,
-        0,    0,    0,    0,  118,   45,    0,   71,    0,    0,
+        0,    0,    0,    0,   81,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  127,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   67,
-        0,    0,    0,    0,    0,    0,    0,    0,  113,    0,
+        0,    0,    0,    0,    0,    0,  102,    0,    0,    0,
+       78,   99,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   72,    0,    0,    0,   17,   15,    0,
+      152,  151,    0,    0,    0,    0,    0,   29,    0,    0,
+      115,    0,    0,    0,    0,    0,    0,    0,  149,    0,
+
+        0,    0,    0,    0,    0,   56,    0,    0,    0,    0,
+        0,   93,    0,  118,    0,    0,    0,    0,   52,    0,
+       60,    0,    0,    0,   19,    0,    0,    0,    0,    0,
+       95,   73,    0,    0,  126,    0,    0,    0,  117,    0,
+        0,   90,    0,  156,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   88,    0,  141,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   88,    0,    0,    0,   64,   85,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   58,
-
-        0,    0,    0,   17,   15,    0,  138,  137,    0,    0,
-        0,    0,    0,   29,    0,  101,    0,    0,    0,    0,
-        0,    0,  135,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   79,    0,  104,    0,   52,    0,    0,
-        0,   19,    0,    0,    0,    0,    0,   81,   59,    0,
-      112,    0,    0,    0,  103,    0,    0,   76,    0,  142,
-        0,    0,    0,    0,    0,    0,    0,   74,    0,  127,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  100,    0,   55,
+        0,  114,    0,    0,   55,  150,    0,   12,    0,    0,
 
-      136,    0,   12,    0,    0,    0,    0,    0,    0,    0,
-       40,    0,   39,   18,    0,    0,   93,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   57,    0,    0,
-       53,    0,   72,    0,    0,    0,    0,    0,  117,    0,
+        0,    0,    0,    0,    0,    0,    0,   40,    0,   39,
+        0,   62,   61,    0,   18,    0,    0,  107,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   71,
+        0,    0,    0,   53,    0,    0,   86,    0,    0,    0,
+        0,    0,    0,    0,  131,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   62,    0,   34,    0,    0,    0,    0,    0,   25,
-        0,    0,    0,    0,  133,    0,    0,    0,    0,    0,
-        0,    0,   82,    0,    0,    0,    0,    0,    0,    0,
-        0,   36,    0,    0,    0,    0,   13,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  132,    0,
-
-       22,   56,    0,    0,    0,    0,   21,    0,   73,    0,
-        0,  131,    0,    0,    0,    0,   24,    0,    0,    0,
+       76,    0,   34,    0,    0,    0,    0,    0,    0,    0,
+       25,    0,    0,    0,    0,    0,    0,    0,    0,  147,
+        0,    0,    0,    0,    0,    0,    0,    0,   96,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   57,
+
+        0,    0,   36,    0,    0,    0,    0,    0,    0,   13,
+        0,    0,    0,    0,    0,    0,   67,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   63,    0,  146,    0,
+       22,   70,    0,    0,    0,    0,    0,   21,    0,    0,
+       87,    0,    0,    0,    0,  145,    0,   64,    0,    0,
+       69,    0,   24,    0,   68,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   23,    0,
-       89,    0,    0,    0,    0,    0,  129,  134,   60,    0,
-        0,    0,  128,    0,    0,    0,    0,    0,    0,    0,
-       90,    0,    0,  130,    0
+        0,    0,    0,    0,    0,    0,    0,    0,   58,    0,
+        0,   23,    0,  103,    0,    0,    0,    0,    0,    0,
+      143,  148,   74,    0,    0,   59,    0,  142,    0,    0,
+
+        0,    0,    0,    0,    0,  104,    0,    0,  144,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -856,9 +872,9 @@ static const YY_CHAR yy_ec[256] =
         5,   33,   34,   35,   36,   37,   38,    5,   39,    5,
        40,   41,   42,    5,   43,    5,   44,   45,   46,   47,
 
-       48,   49,   50,   51,   52,   53,   54,   55,   56,   57,
-       58,   59,   60,   61,   62,   63,   64,   65,   66,   67,
-       68,   69,   70,    5,   71,    5,    5,    5,    5,    5,
+       48,   49,   50,   51,   52,   28,   53,   54,   55,   56,
+       57,   58,   59,   60,   61,   62,   63,   64,   65,   66,
+       67,   68,   69,    5,   70,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
@@ -875,686 +891,837 @@ static const YY_CHAR yy_ec[256] =
         5,    5,    5,    5,    5
     } ;
 
-static const YY_CHAR yy_meta[72] =
+static const YY_CHAR yy_meta[71] =
     {   0,
-        1,    1,    2,    3,    3,    4,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    3,    3,    3,    3,
-        5,    5,    5,    5,    5,    5,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    5,    5,    5,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1
     } ;
 
-static const flex_int16_t yy_base[1278] =
+static const flex_int16_t yy_base[1411] =
     {   0,
-        0,   70,   19,   29,   41,   49,   52,   58,   87,   95,
-     1628, 1629,   32, 1624,  141,    0,  201, 1629,  206,   88,
-       11,  213, 1629, 1606,  114,   25,    2,    6, 1629, 1629,
-       73,   11,   17, 1629, 1629, 1629,  104, 1612, 1567,    0,
-     1604,  107, 1619,  217,  241, 1629,  185, 1563, 1569, 1589,
-       93,   58,  190,   91,  211,  200,   14,  267,  213,  175,
-      269,   64,  231, 1570,  187,   75, 1569,  274,  188,  290,
-      276,  295, 1552,  195,  296,  325,  305, 1571,    0,  349,
-      354,  367,  373,  376, 1629,    0, 1629,  267,  295,  290,
-      317,  339,  351,  355,  358, 1629, 1568, 1607, 1629,  308,
-
-     1629,  394,  357, 1555, 1565, 1604,  370,  220,  249, 1559,
-      367,  377,  369,  379,  302, 1602,    0,  445,  374, 1546,
-     1554,  304, 1550, 1539, 1540,  371, 1556, 1539, 1548,  374,
-      200,  366, 1542,  386, 1530, 1586,  402, 1533, 1584, 1526,
-     1549, 1546, 1546, 1540,  367, 1533, 1526, 1531, 1525, 1536,
-     1521, 1520, 1534,  366, 1570, 1519,  384, 1531, 1534, 1518,
-      441,  415, 1532, 1529, 1530, 1528, 1510, 1515, 1511, 1503,
-     1520, 1512,    0,  385,  420,  406,  419,  427,  440, 1511,
-     1629,    0,  453, 1502, 1505, 1629,  439,  447, 1629, 1557,
-     1512,  454, 1555,  458, 1554,  448, 1553, 1629,  493, 1552,
-
-      478, 1513, 1508, 1507,  463, 1548, 1542, 1508, 1487, 1495,
-     1501, 1489, 1503, 1499, 1500, 1500, 1495, 1487, 1489, 1473,
-     1477, 1490, 1490, 1482, 1472, 1475, 1489, 1629, 1475, 1483,
-     1486, 1467, 1466, 1516, 1465, 1475, 1513,  484, 1474, 1462,
-     1473, 1509, 1513, 1466,    9, 1456, 1472, 1453, 1455, 1451,
-     1457, 1448, 1447, 1460, 1453, 1455, 1459, 1458, 1452,   80,
-     1459, 1454, 1446, 1452, 1452, 1433, 1449, 1435, 1441, 1448,
-     1436, 1429, 1443, 1442, 1445, 1427, 1435,  485, 1629, 1629,
-      486, 1629, 1629, 1422,    0,  445, 1424,  508,  487, 1478,
-     1629, 1431,  492, 1629, 1476, 1629, 1470,  540, 1629,  482,
-
-     1412, 1422, 1472, 1429,  483, 1629, 1427, 1469, 1424, 1421,
-     1422,  532, 1426, 1464, 1414, 1409, 1406, 1402, 1404, 1453,
-     1412, 1401, 1450, 1398,  546, 1411, 1411, 1394, 1395, 1408,
-     1395, 1405, 1400, 1407, 1402, 1387,  402, 1396, 1399, 1394,
-     1390, 1438,  499, 1629, 1385, 1384, 1377, 1379, 1383, 1372,
-     1379, 1384,  353, 1429, 1384,  519, 1381, 1385, 1383, 1372,
-     1372, 1384, 1366, 1358, 1359, 1380, 1362, 1374, 1373, 1359,
-     1371, 1370, 1369, 1368, 1409, 1408, 1407, 1351,  525, 1364,
-     1629, 1629, 1363,    0,  511, 1351, 1402, 1401, 1359, 1399,
-     1629, 1347, 1397, 1629,  538,  595,  517, 1396, 1338, 1629,
-
-     1354, 1353, 1340, 1339, 1629, 1341, 1338, 1350, 1346, 1334,
-     1336, 1629, 1342, 1327, 1329, 1340, 1338, 1333,  563, 1340,
-     1322, 1371, 1629, 1320, 1336, 1368, 1372, 1330, 1324, 1326,
-     1327, 1329, 1361, 1314, 1309, 1308, 1310, 1303, 1318, 1296,
-     1303, 1308, 1356, 1629, 1303, 1299, 1302, 1309, 1294, 1304,
-     1307, 1296, 1295, 1290, 1629, 1345, 1629, 1289, 1288, 1281,
-     1298, 1335, 1282, 1287, 1296, 1290, 1294,  566, 1329, 1293,
-     1273, 1276, 1275, 1283, 1287, 1270, 1326, 1268, 1629, 1629,
-     1629, 1273, 1629, 1283, 1317, 1279,    0, 1320, 1270, 1629,
-     1629, 1267, 1629, 1273, 1629,  544,  543,  572, 1629, 1311,
-
-     1258, 1257, 1264, 1257, 1269, 1268, 1252, 1267, 1297, 1264,
-     1300, 1246, 1248, 1260, 1260, 1259, 1629, 1244, 1241, 1255,
-     1247, 1253, 1244, 1252, 1629, 1237, 1248, 1252, 1234, 1248,
-     1246, 1229, 1223, 1228, 1225, 1240, 1241, 1238, 1279, 1236,
-     1629, 1222, 1224, 1270, 1269,  553, 1232, 1215, 1216, 1221,
-     1212, 1629, 1226, 1212,  587, 1204, 1225, 1222, 1214, 1257,
-     1211, 1255, 1629, 1203, 1201, 1215, 1218, 1250, 1249, 1196,
-     1247, 1246, 1629,  574, 1208, 1197, 1199, 1629, 1629, 1242,
-     1190, 1245,  559,  557,  529, 1204, 1238, 1237, 1236, 1190,
-     1180, 1233, 1195, 1185, 1230, 1193, 1175, 1183, 1185, 1189,
-
-     1224, 1228, 1185, 1184, 1185, 1178, 1167, 1180, 1183, 1178,
-     1173, 1178, 1175, 1174, 1177, 1172, 1213, 1212, 1156, 1152,
-     1160, 1208, 1629, 1207, 1156, 1148, 1163, 1150, 1629, 1150,
-     1159, 1158, 1158, 1142, 1197, 1140, 1153, 1629, 1145, 1137,
-     1146, 1139, 1150, 1127, 1131, 1182, 1129, 1127, 1138, 1178,
-     1125,  540,  548, 1119, 1129,  549, 1629, 1179, 1137, 1126,
-     1130, 1137, 1174, 1629, 1168,  567, 1121, 1129, 1121, 1112,
-     1115, 1111, 1128, 1123, 1111, 1122, 1106, 1108, 1160, 1106,
-     1120, 1101, 1151, 1106, 1629, 1114, 1112, 1103, 1112, 1108,
-     1149, 1091, 1091, 1104, 1103, 1088, 1143, 1085, 1086, 1629,
-
-     1629, 1100, 1097, 1100, 1629, 1629, 1099, 1084,  579, 1083,
-     1081, 1128, 1077, 1131, 1130, 1629, 1075, 1087, 1085, 1126,
-     1074, 1074,   61,  120,  189,  197,  195,  259,  281,  311,
-      344,  405,  470,  566,  471,  524,  512,  570,  547, 1629,
-      613,  563,  579,  580, 1629,  599,  607,  587,  577,  592,
-      585,  580,  587,  583,  592,  587,  638,  644,  593, 1629,
-      605,  590,  606,  597,  609,  604,  649,  617,  601,  602,
-     1629,  620,  603,  605,  661,  606, 1629,  625,  605,  623,
-      662,  622,  612,  630,  614,  629,  621,  617,  635,  620,
-     1629, 1629,  628,  673,  628, 1629,  636,  631,  682, 1629,
-
-      633,  638,  632,  634,  646,  640,  638,  691,  637,  693,
-      694,  640, 1629,  639,  647,  645,  644,  658,  659,  660,
-      676,  681,  655,  665,  651,  658,  663,  670,  711,  712,
-      661,  665, 1629,  660,  678,  676,  714,  665,  683,  684,
-      670,  678,  687,  667,  688,  728,  729, 1629,  684,  733,
-      734,  696,  698,  681,  683,  690,  741,  690,  705,  744,
-      696,  700,  698,  696,  749,  750,  702,  752,  748,  708,
-     1629,  713,  706,  715,  709,  704,  714,  710, 1629,  705,
-     1629, 1629,  706,  704,  723,  724,  725,  707,  712,  719,
-      752,  743,  715,  774,  719,  735,  727,  731, 1629, 1629,
-
-      741,  739,  725,  726,  784,  739,  744,  731,  742,  734,
-      740,  736,  754,  755, 1629, 1629,  754, 1629,  756, 1629,
-      741,  760,  750,  801,  756,  798, 1629,  755,  805, 1629,
-      806,  755,  762,  804, 1629, 1629,  764, 1629,  755,  755,
-      758,  772,  759,  770,  817,  776,  814,  820,  821,  770,
-      823,  824,  785,  769,  781,  771,  801,  830,  790, 1629,
-      832,  781,  777,  793,  798,  786,  838,  797, 1629,  799,
-      798,  800,  793,  802,  803,  800,  790,  792,  849,  798,
-      851,  796,  853, 1629,  791,  806,  856, 1629, 1629,  807,
-      817,  802,  818,  804,  864,  865,  811,  867,  826, 1629,
-
-      818,  821,  872, 1629, 1629,  818, 1629, 1629,  826,  876,
-      827,  878,  860, 1629,  838, 1629,  825,  824,  827,  827,
-      828,  886, 1629,  831,  888,  843,  834,  849,  849,  852,
-      852,  849,  854, 1629,  846, 1629,  856, 1629,  857,  858,
-      855, 1629,  847,  853,  852,  864,  864, 1629, 1629,  903,
-     1629,  868,  853,  859, 1629,  864,  875, 1629,  872, 1629,
-      891,  911,  917,  861,  919,  920,  875, 1629,  922, 1629,
-      862,  919,  884,  880,  922,  872,  877,  930,  888,  932,
-      933,  896,  885,  936,  880,  897,  882,  897,  881,  938,
-      939,  904,  890,  901,  948,  920,  907, 1629,  951, 1629,
-
-     1629,  900, 1629,  953,  901,  950,  895,  900,  959,  909,
-     1629,  915, 1629, 1629,  906,  921, 1629,  959,  927,  920,
-      921,  930,  917,  919,  929,  972,  923, 1629,  974,  921,
-     1629,  925, 1629,  929,  924,  923,  981,  936, 1629,  978,
-      940,  943,  986,  929,  931,  939,  929,  945,  939,  955,
-      994, 1629,  990, 1629,  955,  992,  956,  947,  954, 1629,
-      951,  956, 1003,  948, 1629,  952,  964,  965, 1008,  952,
-      953,  961, 1629,  972,  962,  961,  964,  976,  967,  976,
-      978, 1629, 1020,  980, 1022, 1023, 1629, 1019,  979,  984,
-      965, 1028,  987, 1030,  989,  990, 1033,  992, 1629,  997,
-
-     1629, 1629,  979,  985, 1038,  999, 1629,  985, 1629,  985,
-      987, 1629,  992,  987,  999,  995, 1629,  998, 1002,  993,
-     1045,  994, 1010, 1003,  998, 1013, 1004, 1011,  998, 1013,
-     1060, 1019, 1062, 1007, 1023, 1014, 1028, 1024, 1629, 1068,
-     1629, 1069, 1070, 1027, 1026, 1027, 1629, 1629, 1629, 1074,
-     1018, 1034, 1629, 1072, 1023, 1022, 1024, 1035, 1082, 1033,
-     1629, 1042, 1085, 1629, 1629, 1091, 1096, 1101, 1106, 1111,
-     1116, 1121, 1124, 1098, 1103, 1105, 1118
+        0,    0,   70,    0,  135,    0,  137,  148,  136,  138,
+       73,    0,  153,  156,  205,  275,  334,    0,  148,  157,
+      166,  152,    0,  156,  187,  326,  315,  319,    0,    0,
+      332,  318,  323,    0,    0,    0,  176,  168,  126,  383,
+      166,  190,  183,  450,  500,    0,  326,  136,  144,  169,
+      342,  328,  510,  497,  543,  544,  542,  603,  541,  314,
+      527,  301,  631,  312,  304,  484,  230,  525,  615,  640,
+      523,  630,  301,  489,  641,  660,  655,  321,    0,  582,
+        0,    0,  569,    0,  724,    0,  523,  532,  647,  651,
+      655,  665,  667,  659,    0,  328,  371,    0,    0,  789,
+
+      659,  471,  534,  582,  767,  650,  791,  542,  761,  769,
+      768,  771,  675,  805,    0,  856,  774,  539,  554,  550,
+      753,  562,  584,  641,  768,  663,  649,  661,  771,  774,
+      792,  658,  658,  762,  650,  788,  799,  748,  813,  768,
+      792,  791,  796,  798,  797,  789,  792,  801,  800,  815,
+      804,  807,  825,  814,  865,  823,  827,  837,  842,  831,
+      879,  835,  848,  847,  850,  851,  836,  843,  848,  842,
+      860,  855,  877,  885,  888,  881,  887,  895,  856,    0,
+      930,  905,  850,  859,    0,  887,  901,    0,  912,  869,
+      902,  916,  922,  922,  902,    0,  966,  923,  939,  886,
+
+      883,  911,  913,  906,  957,  953,  921,  903,  913,  921,
+      913,  928,  926,  939,  941,  938,  939,  942,  929,  935,
+      949,  935,  952,  947,  939,  944,  959,    0,  948,  957,
+      962,  946,  947,  998,  956,  970,  968, 1008, 1009,  972,
+      963,  975, 1013, 1019,  974, 1016,  968,  985,  969,  973,
+      971,  979,  972,  973,  987,  983,  986,  992,  993,  989,
+      988,  999,  996,  992,  999, 1001,  985, 1002,  991,  999,
+     1007,  998,  993, 1008, 1009, 1014,  999, 1008, 1036,    0,
+        0, 1037,    0,    0, 1000, 1065, 1025, 1005, 1051, 1046,
+     1062,    0, 1017, 1039,    0, 1070,    0, 1066, 1081,    0,
+
+     1054, 1011, 1034, 1027, 1092, 1052, 1057,    0, 1059, 1109,
+     1066, 1066, 1069, 1109, 1077, 1117, 1077, 1074, 1073, 1071,
+     1075, 1125, 1086, 1078, 1081, 1129, 1080, 1136, 1095, 1097,
+     1083, 1086, 1101, 1091, 1102, 1106, 1108, 1142, 1106, 1094,
+     1097, 1107, 1112, 1109, 1108, 1157, 1115,    0, 1108, 1109,
+     1105, 1109, 1115, 1106, 1115, 1122, 1169, 1170, 1127, 1130,
+     1127, 1133, 1133, 1126, 1128, 1141, 1130, 1120, 1123, 1145,
+     1131, 1145, 1146, 1135, 1148, 1150, 1151, 1152, 1195, 1196,
+     1197, 1144, 1199, 1159,    0,    0, 1160, 1197, 1174, 1152,
+     1208, 1209, 1169, 1211,    0, 1168, 1219,    0, 1196, 1234,
+
+     1200, 1221, 1218, 1169,    0, 1186, 1187, 1179, 1180,    0,
+     1184, 1183, 1196, 1200, 1194, 1199,    0, 1214, 1202, 1206,
+     1218, 1218, 1215, 1262, 1225, 1259, 1211, 1261,    0, 1214,
+     1231, 1265, 1271, 1237, 1233, 1237, 1240, 1244, 1278, 1246,
+     1235, 1236, 1233, 1232, 1235, 1239, 1234, 1250, 1231, 1240,
+     1247, 1296,    0, 1246, 1244, 1249, 1257, 1245, 1256, 1261,
+     1253, 1254, 1251,    0, 1307,    0, 1254, 1255, 1250, 1268,
+     1307, 1257, 1264, 1274, 1270, 1267, 1277, 1319, 1315, 1281,
+     1264, 1269, 1271, 1280, 1286, 1272, 1329, 1274,    0,    0,
+        0, 1281,    0, 1292, 1328, 1292, 1327, 1338, 1291,    0,
+
+        0, 1290,    0, 1297,    0, 1323, 1322, 1350,    0, 1301,
+     1347, 1297, 1298, 1310, 1305, 1318, 1319, 1306, 1322, 1354,
+     1329, 1367, 1316, 1321, 1335, 1337, 1338,    0, 1326, 1325,
+     1342, 1341, 1336, 1343, 1337, 1346,    0, 1334, 1346, 1352,
+     1337, 1352, 1352, 1338, 1390, 1358, 1336, 1353, 1344, 1343,
+     1359, 1362, 1361, 1404, 1363,    0, 1352, 1356, 1403, 1404,
+     1410, 1370, 1356, 1359, 1366, 1359,    0, 1374, 1363, 1418,
+     1358, 1380, 1379, 1374, 1419, 1376, 1384, 1422,    0, 1373,
+     1373, 1388, 1393, 1427, 1428, 1378, 1430, 1431,    0, 1438,
+     1395, 1388, 1392,    0,    0, 1436, 1387, 1443, 1415, 1426,
+
+     1403, 1408, 1405, 1396, 1413, 1449, 1450, 1451, 1408, 1401,
+     1456, 1420, 1413, 1459, 1424, 1409, 1419, 1423, 1429, 1467,
+     1473, 1432, 1433, 1425, 1437, 1432, 1424, 1438, 1443, 1440,
+     1437, 1444, 1443, 1444, 1449, 1448, 1437, 1448, 1439, 1492,
+     1439, 1494, 1442, 1440, 1450, 1499,    0, 1500, 1452, 1446,
+     1462, 1452,    0, 1454, 1464, 1465, 1467, 1454, 1510, 1456,
+     1470,    0, 1465, 1459, 1469, 1465, 1477, 1457, 1463, 1515,
+     1481, 1466, 1466, 1478, 1520, 1470, 1481, 1482, 1468, 1480,
+     1481,    0, 1532, 1494, 1486, 1492, 1501, 1540,    0, 1536,
+     1514, 1493, 1502, 1501, 1484, 1499, 1500, 1493, 1499, 1499,
+
+     1497, 1515, 1512, 1503, 1515, 1502, 1506, 1559, 1508, 1523,
+     1507, 1558, 1516,    0, 1525, 1525, 1518, 1520, 1531, 1529,
+     1572, 1517, 1519, 1533, 1534, 1522, 1578, 1523, 1535, 1527,
+     1528, 1528,    0, 1542,    0, 1545, 1544, 1549,    0,    0,
+     1550, 1538, 1552, 1540, 1540, 1588, 1541, 1596, 1597,    0,
+     1545, 1558, 1558, 1601, 1552, 1554, 1548, 1605, 1560, 1551,
+     1552, 1548, 1558, 1562, 1572, 1567, 1562, 1564, 1575, 1566,
+     1618, 1577, 1582, 1560,    0, 1617, 1567, 1581, 1581,    0,
+     1600, 1609, 1589, 1580, 1593, 1590, 1633, 1596, 1589, 1586,
+     1586, 1587, 1583, 1592, 1587, 1637, 1643, 1593,    0, 1604,
+
+     1590, 1605, 1596, 1607, 1602, 1648, 1605, 1617, 1602, 1603,
+        0, 1620, 1604, 1606, 1661, 1607,    0, 1625, 1659, 1614,
+     1609, 1623, 1631, 1628, 1666, 1626, 1617, 1634, 1619, 1633,
+     1626, 1622, 1639, 1625,    0,    0, 1633, 1677, 1633,    0,
+     1640, 1636, 1686,    0, 1638, 1642, 1685, 1639, 1640, 1651,
+     1646, 1644, 1696, 1643, 1698, 1699, 1646,    0, 1645, 1653,
+     1651, 1650, 1663, 1664, 1665, 1681, 1686, 1661, 1670, 1656,
+     1713,    0, 1659, 1666, 1712, 1672, 1679, 1720, 1721, 1671,
+     1675,    0, 1670, 1687, 1684, 1722, 1674, 1691, 1692, 1679,
+     1686, 1687, 1696, 1679, 1699, 1739, 1740,    0, 1695, 1742,
+
+     1743, 1705, 1699, 1706, 1710, 1698, 1709, 1696, 1697, 1704,
+     1755, 1705, 1719, 1758, 1711, 1714, 1713, 1711, 1763, 1764,
+     1717, 1766, 1762, 1722,    0, 1727, 1721, 1712, 1730, 1725,
+     1720, 1729, 1726,    0, 1721,    0,    0, 1722, 1720, 1738,
+     1739, 1740, 1723, 1728, 1736, 1768, 1759, 1732, 1790, 1745,
+        0, 1737, 1751, 1742, 1745, 1749,    0,    0, 1758, 1756,
+     1743, 1744, 1801, 1756, 1761, 1749, 1759, 1752, 1751, 1759,
+     1755, 1773, 1774,    0,    0, 1772,    0, 1774,    0, 1761,
+     1779, 1768, 1773, 1778, 1773, 1766, 1768, 1824, 1779, 1821,
+        0, 1779, 1828,    0, 1829, 1779, 1785, 1827,    0,    0,
+
+     1787,    0, 1779, 1779, 1782, 1795, 1800, 1784, 1794, 1841,
+     1800, 1838, 1844, 1845, 1795, 1847, 1848, 1809, 1794, 1805,
+     1796, 1825, 1854, 1814,    0, 1798, 1857, 1807, 1808, 1804,
+     1819, 1824, 1813, 1864, 1823,    0, 1825, 1824, 1826, 1820,
+     1828, 1871, 1830, 1827, 1818, 1820, 1877, 1827, 1879, 1826,
+     1826, 1821, 1829, 1885, 1881, 1887,    0, 1826, 1841, 1890,
+        0,    0, 1841, 1850, 1837, 1852, 1839, 1898, 1900, 1847,
+     1856, 1903, 1862,    0, 1855, 1857, 1907,    0,    0, 1854,
+        0,    0, 1861, 1910, 1862, 1912, 1894,    0, 1872, 1873,
+        0, 1861, 1860, 1867, 1864, 1864, 1865, 1922,    0, 1868,
+
+     1924, 1879, 1871, 1885, 1885,    0, 1880, 1889, 1889, 1886,
+     1891,    0, 1884,    0, 1895, 1896, 1897, 1885,    0, 1898,
+        0, 1900, 1901, 1898,    0, 1890, 1896, 1895, 1906, 1906,
+        0,    0, 1945, 1895,    0, 1911, 1897, 1903,    0, 1908,
+     1918,    0, 1915,    0, 1934, 1954, 1955, 1961, 1906, 1915,
+     1964, 1965, 1920,    0, 1967,    0, 1908, 1964, 1929, 1925,
+     1934, 1912, 1969, 1920, 1925, 1977, 1935, 1979, 1926, 1981,
+     1982, 1932, 1985, 1948, 1938, 1988, 1933, 1949, 1935, 1949,
+     1934, 1989, 1990, 1991, 1956, 1943, 1953, 2000, 1972, 1959,
+     1947,    0, 2004, 2000,    0,    0, 1955,    0, 2007, 1956,
+
+     2004, 1950, 1951, 1963, 1958, 2015, 1966,    0, 1971,    0,
+     1960,    0,    0, 1965,    0, 1965, 1979,    0, 2017, 1985,
+     1978, 1979, 1988, 1971, 1978, 1980, 1989, 2032, 1984,    0,
+     2034, 1982, 1980,    0, 1982, 1988,    0, 1991, 1986, 1985,
+     2042, 2038, 2004, 1999,    0, 2041, 2003, 2010, 2000, 2008,
+     2051, 1995, 1997, 2005, 1995, 2010, 2011, 2006, 2021, 2060,
+        0, 2056,    0, 2021, 2015, 2018, 2060, 2024, 2016, 2022,
+        0, 2030, 2070, 2022, 2026, 2073, 2026, 2037, 2021,    0,
+     2025, 2037, 2038, 2081, 2026, 2034, 2028, 2036,    0, 2046,
+     2037, 2088, 2027, 2038, 2041, 2052, 2044, 2056, 2057,    0,
+
+     2054, 2056,    0, 2098, 2043, 2100, 2060, 2102, 2103,    0,
+     2099, 2063, 2060, 2065, 2047, 2109,    0, 2068, 2069, 2112,
+     2071, 2072, 2059, 2060, 2117, 2076,    0, 2119,    0, 2082,
+        0,    0, 2065, 2122, 2072, 2124, 2085,    0, 2126, 2073,
+        0, 2073, 2075, 2090, 2089,    0, 2082,    0, 2077, 2088,
+        0, 2085,    0, 2088,    0, 2091, 2083, 2134, 2095, 2091,
+     2086, 2101, 2095, 2090, 2104, 2096, 2102, 2090, 2150, 2111,
+     2106, 2153, 2112, 2155, 2101, 2116, 2108, 2121,    0, 2099,
+     2118,    0, 2162,    0, 2163, 2164, 2121, 2120, 2167, 2122,
+        0,    0,    0, 2169, 2114,    0, 2129,    0, 2167, 2119,
+
+     2118, 2120, 2130, 2177, 2129,    0, 2137, 2180,    0, 2187
     } ;
 
-static const flex_int16_t yy_def[1278] =
+static const flex_int16_t yy_def[1411] =
     {   0,
-     1266, 1266, 1267, 1267, 1266, 1266, 1266, 1266, 1266, 1266,
-     1265, 1265, 1265, 1265, 1265, 1268, 1265, 1265, 1265, 1265,
-     1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265,
-     1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1269,
-     1265, 1265, 1265, 1270,   15, 1265,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1271,   45,   45,
+     1410,    1,    1,    3,    1,    5,    5,    5,    5,    5,
+     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,   17,   17,
+     1410,   17, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
+     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
+     1410, 1410, 1410,   15,   15, 1410,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1268, 1265,
-     1265, 1265, 1265, 1265, 1265, 1272, 1265, 1265, 1265, 1265,
-     1265, 1265, 1265, 1265, 1265, 1265, 1265, 1269, 1265, 1270,
+       45,   45,   45,   45,   45,   45,   45,   45,   16,   17,
+       17,   25,   17, 1410, 1410, 1410,   25,   25, 1410, 1410,
+     1410, 1410, 1410, 1410, 1410, 1410,   40, 1410, 1410, 1410,
 
-     1265, 1265,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1273,   45, 1271,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   58,   45,  114,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1272, 1265, 1265, 1265, 1265, 1265, 1265, 1265,
-     1265, 1274,   45,   45,   45, 1265,   45,   45, 1265,   45,
-       45,   45,   45,   45,   45,   45, 1273, 1265, 1271,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
+     1410,   45,   45,   45, 1410,   45,   45, 1410,   45,   45,
+       45,   45,   45,   45,   45, 1410,  116,   45,   45,   45,
 
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1265,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1410,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1265, 1265, 1265,
-     1265, 1265, 1265, 1265, 1275,   45,   45,   45,   45,   45,
-     1265,   45,   45, 1265,   45, 1265,   45, 1271, 1265,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1410, 1410,
+     1410, 1410, 1410, 1410, 1410, 1410,   45,   45,   45,   45,
+       45, 1410,   45,   45, 1410,   45, 1410,   45,  197, 1410,
 
-       45,   45,   45,   45,   45, 1265,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1410,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1410,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1265,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 1410, 1410, 1410, 1410,   45,   45,
+       45,   45,   45,   45, 1410,   45,   45, 1410,   45,  299,
+
+       45,   45,   45,   45, 1410,   45,   45,   45,   45, 1410,
+       45,   45,   45,   45,   45,   45, 1410,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1410,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1410,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 1410,   45, 1410,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1265, 1265, 1265, 1276,   45,   45,   45,   45,   45,   45,
-     1265,   45,   45, 1265,   45, 1271,   45,   45,   45, 1265,
+       45,   45,   45,   45,   45,   45,   45,   45, 1410, 1410,
+     1410,   45, 1410,   45,   45, 1410, 1410,   45,   45, 1410,
 
-       45,   45,   45,   45, 1265,   45,   45,   45,   45,   45,
-       45, 1265,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1265,   45,   45,   45,   45,   45,   45,   45,
+     1410,   45, 1410,   45, 1410,   45,   45,   45, 1410,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1265,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1265,   45, 1265,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1410,   45,   45,
+       45,   45,   45,   45,   45,   45, 1410,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1265, 1265,
-     1265,   45, 1265,   45,   45, 1265, 1277,   45,   45, 1265,
-     1265,   45, 1265,   45, 1265,   45,   45,   45, 1265,   45,
+       45,   45,   45,   45,   45, 1410,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1410,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1410,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1410,   45,
+       45,   45,   45, 1410, 1410,   45,   45,   45,   45,   45,
 
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1265,   45,   45,   45,
-       45,   45,   45,   45, 1265,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1265,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1265,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1265,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1265,   45,   45,   45,   45, 1265, 1265,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1410,   45,   45,   45,
+       45,   45, 1410,   45,   45,   45,   45,   45,   45,   45,
+       45, 1410,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 1410,   45,   45,   45,   45,   45,   45, 1410,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 1410,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1410,   45, 1410,   45,   45,   45, 1410, 1410,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1410,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1265,   45,   45,   45,   45,   45, 1265,   45,
-       45,   45,   45,   45,   45,   45,   45, 1265,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1265,   45,   45,   45,
-       45,   45,   45, 1265,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 1410,   45,   45,   45,   45, 1410,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1265,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1265,
+       45,   45,   45,   45,   45,   45,   45,   45, 1410,   45,
 
-     1265,   45,   45,   45, 1265, 1265,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1265,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1265,
-       45,   45,   45,   45, 1265,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1265,
+     1410,   45,   45,   45,   45,   45, 1410,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1265,   45,   45,   45,   45,   45, 1265,   45,   45,   45,
+       45,   45,   45,   45, 1410, 1410,   45,   45,   45, 1410,
+       45,   45,   45, 1410,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1410,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1265, 1265,   45,   45,   45, 1265,   45,   45,   45, 1265,
+       45, 1410,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 1410,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1410,   45,   45,
 
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1265,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1265,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1265,   45,   45,
+       45,   45,   45,   45, 1410,   45,   45,   45,   45,   45,
+       45,   45,   45, 1410,   45, 1410, 1410,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1410,   45,   45,   45,   45,   45, 1410, 1410,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1265,   45,   45,   45,   45,   45,   45,   45, 1265,   45,
-     1265, 1265,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1265, 1265,
+       45,   45,   45, 1410, 1410,   45, 1410,   45, 1410,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1410,   45,   45, 1410,   45,   45,   45,   45, 1410, 1410,
 
+       45, 1410,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1265, 1265,   45, 1265,   45, 1265,
-       45,   45,   45,   45,   45,   45, 1265,   45,   45, 1265,
-       45,   45,   45,   45, 1265, 1265,   45, 1265,   45,   45,
+       45,   45,   45,   45, 1410,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 1410,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1265,
-       45,   45,   45,   45,   45,   45,   45,   45, 1265,   45,
+       45,   45,   45,   45,   45,   45, 1410,   45,   45,   45,
+     1410, 1410,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 1410,   45,   45,   45, 1410, 1410,   45,
+     1410, 1410,   45,   45,   45,   45,   45, 1410,   45,   45,
+     1410,   45,   45,   45,   45,   45,   45,   45, 1410,   45,
+
+       45,   45,   45,   45,   45, 1410,   45,   45,   45,   45,
+       45, 1410,   45, 1410,   45,   45,   45,   45, 1410,   45,
+     1410,   45,   45,   45, 1410,   45,   45,   45,   45,   45,
+     1410, 1410,   45,   45, 1410,   45,   45,   45, 1410,   45,
+       45, 1410,   45, 1410,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 1410,   45, 1410,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1265,   45,   45,   45, 1265, 1265,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1265,
-
-       45,   45,   45, 1265, 1265,   45, 1265, 1265,   45,   45,
-       45,   45,   45, 1265,   45, 1265,   45,   45,   45,   45,
-       45,   45, 1265,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1265,   45, 1265,   45, 1265,   45,   45,
-       45, 1265,   45,   45,   45,   45,   45, 1265, 1265,   45,
-     1265,   45,   45,   45, 1265,   45,   45, 1265,   45, 1265,
-       45,   45,   45,   45,   45,   45,   45, 1265,   45, 1265,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1265,   45, 1265,
+       45, 1410,   45,   45, 1410, 1410,   45, 1410,   45,   45,
 
-     1265,   45, 1265,   45,   45,   45,   45,   45,   45,   45,
-     1265,   45, 1265, 1265,   45,   45, 1265,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1265,   45,   45,
-     1265,   45, 1265,   45,   45,   45,   45,   45, 1265,   45,
+       45,   45,   45,   45,   45,   45,   45, 1410,   45, 1410,
+       45, 1410, 1410,   45, 1410,   45,   45, 1410,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1410,
+       45,   45,   45, 1410,   45,   45, 1410,   45,   45,   45,
+       45,   45,   45,   45, 1410,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1265,   45, 1265,   45,   45,   45,   45,   45, 1265,
-       45,   45,   45,   45, 1265,   45,   45,   45,   45,   45,
-       45,   45, 1265,   45,   45,   45,   45,   45,   45,   45,
-       45, 1265,   45,   45,   45,   45, 1265,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1265,   45,
-
-     1265, 1265,   45,   45,   45,   45, 1265,   45, 1265,   45,
-       45, 1265,   45,   45,   45,   45, 1265,   45,   45,   45,
+     1410,   45, 1410,   45,   45,   45,   45,   45,   45,   45,
+     1410,   45,   45,   45,   45,   45,   45,   45,   45, 1410,
+       45,   45,   45,   45,   45,   45,   45,   45, 1410,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1410,
+
+       45,   45, 1410,   45,   45,   45,   45,   45,   45, 1410,
+       45,   45,   45,   45,   45,   45, 1410,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1410,   45, 1410,   45,
+     1410, 1410,   45,   45,   45,   45,   45, 1410,   45,   45,
+     1410,   45,   45,   45,   45, 1410,   45, 1410,   45,   45,
+     1410,   45, 1410,   45, 1410,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1265,   45,
-     1265,   45,   45,   45,   45,   45, 1265, 1265, 1265,   45,
-       45,   45, 1265,   45,   45,   45,   45,   45,   45,   45,
-     1265,   45,   45, 1265,    0, 1265, 1265, 1265, 1265, 1265,
-     1265, 1265, 1265, 1265, 1265, 1265, 1265
+       45,   45,   45,   45,   45,   45,   45,   45, 1410,   45,
+       45, 1410,   45, 1410,   45,   45,   45,   45,   45,   45,
+     1410, 1410, 1410,   45,   45, 1410,   45, 1410,   45,   45,
+
+       45,   45,   45,   45,   45, 1410,   45,   45, 1410,    0
     } ;
 
-static const flex_int16_t yy_nxt[1701] =
+static const flex_int16_t yy_nxt[2258] =
     {   0,
-     1265,   13,   14,   13, 1265,   15,   16, 1265,   17,   18,
-       19,   20,   21,   22,   22,   22,   23,   24,   85,  346,
-       37,   14,   37,   86,   25,   26,   38, 1265, 1265,   27,
-       37,   14,   37,   42,   28,   42,   38,   91,   92,   29,
-      115,   30,   13,   14,   13,   90,   91,   25,   31,   92,
-       13,   14,   13,   13,   14,   13,   32,   40, 1265,   13,
-       14,   13,   33,   40,  115,   91,   92,  347,   90,   34,
-       35,   13,   14,   13,   94,   15,   16,   95,   17,   18,
-       19,   20,   21,   22,   22,   22,   23,   24,   13,   14,
-       13,  108,   39,   90,   25,   26,   13,   14,   13,   27,
-
-       39,   84,   84,   84,   28,   42,   41,   42,   42,   29,
-       42,   30,   82,  107,   41,  111,   93,   25,   31,  108,
-      130,  137,   88,  799,   88,  800,   32,   89,   89,   89,
-      131,  138,   33,  139,  362,   82,  107,  363,  111,   34,
-       35,   44,   44,   44,   45,   45,   46,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   47,   45,   48,   49,   50,   51,   45,   52,   53,
-       54,   45,   45,   45,   45,   55,   56,   45,   57,   45,
-       45,   58,   45,   45,   59,   45,   60,   61,   62,   63,
-       64,   65,   66,   52,   67,   68,   69,   70,   71,   72,
-
-       73,   74,   75,   76,   77,   78,   57,   45,   45,   45,
-       45,   45,   80,  103,   81,   81,   81,   80,  109,   83,
-       83,   83,  101,  114,   80,   82,   83,   83,   83,  121,
-       82,  145,  122,  112,  123,  146,  124,   82,  160,  103,
-      801,  103,  161,  113,  134,  218,  114,  110,   82,  135,
-      188,  107,  136,   82,  189,  147,  112,  102,  219,  802,
-       82,   45,  803,   45,   45,   45,   45,  119,   45,   45,
-       45,  113,  117,  120,  107,   45,   45,  188,   45,   45,
-       89,   89,   89,  190,   45,  132,   45,   45,   45,   45,
+       12,   13,   14,   13,   12,   15,   16,   12,   17,   18,
+       19,   20,   21,   22,   22,   22,   23,   24,   12,   12,
+       12,   12,   12,   12,   25,   26,   12,   12,   12,   27,
+       12,   12,   12,   12,   28,   12,   12,   12,   12,   29,
+       12,   30,   12,   12,   12,   12,   12,   25,   31,   12,
+       12,   12,   12,   12,   12,   32,   12,   12,   12,   12,
+       12,   33,   12,   12,   12,   12,   12,   12,   34,   35,
+       36,   37, 1410,   37,   36,   36,   36,   38,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       12,   12,   40,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   40,   42,   41,   42,   41,   43,   12,
+       12,   83,   83,   83,   12,   83,   83,   83, 1410,   12,
+       80,   80,   80,   84,   12,   86,   12,   42,   85,   42,
+       95,   96,   12,   12,   98,   43,   39,   12,   12,   12,
+       12,   42,  102,   42,  103,   87,   12,   87,  104,   12,
+
+       88,   88,   88,   12,   12,   44,   44,   44,   45,   45,
+       46,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   47,   45,   48,   49,   50,
+       51,   45,   52,   53,   54,   45,   45,   45,   45,   55,
+       56,   45,   57,   45,   45,   58,   45,   45,   59,   45,
+       60,   61,   62,   63,   64,   65,   66,   67,   68,   69,
+       70,   71,   72,   73,   74,   75,   76,   77,   78,   57,
+       45,   45,   45,   45,   45,   79,   79,  140,   79,   79,
+       79,   79,   79,   79,   79,   79,   79,   79,   79,   79,
+       79,   79,   79,   79,   79,   79,   79,   79,   79,   79,
+
+       79,   79,   79,   79,   79,   79,   79,   79,   79,   79,
+       79,   79,   79,   79,   79,   79,   79,   79,   79,   79,
+       79,   79,   79,   79,   79,   79,   79,   79,   79,   79,
+       79,   79,   79,   79,   79,   79,   79,   79,   79,   79,
+       79,   79,   79,   79,   79,   80,   89,   81,   81,   81,
+       90,   91,   89,   90,  101,   91,  129,  119,   82,  132,
+      134,  106,  105,  159,  172,  135,  130,  120,  136,   89,
+      121,  133,  122,  179,  123,   92,  180,   90,   91,  101,
+       93,   82,   94,   97,   97,  105,   97,   97,  106,   97,
+       97,   97,   97,   97,   97,   97,   97,   97,   97,   97,
+
+       97,   97,   97,   97,   97,   97,   97,   97,   97,   97,
+       97,   97,   97,   97,   97,   97,   97,   97,   97,   97,
+       97,   97,   97,   97,   97,   97,   97,   97,   97,   97,
+       97,   97,   97,   97,   97,   97,   97,   97,   97,   97,
+       97,   97,   97,   97,   97,   97,   97,   97,   97,   97,
+       97,   97,   97,   44,   44,   99,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+      100,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       45,  109,   45,   45,   45,   45,  183,   45,   45,   45,
+      137, 1410,  160, 1410,   45,   45,  161,   45,  107,  138,
+     1410,  139, 1410,   45,  109,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,  110,  108,  112,  113,  101,
+      124,  150,  141,  142,  125,  111,  143,  126,  127,  184,
+      151,  144,   83,   83,   83,  152,  153,  185,  110,  128,
+      112,  190,  113, 1410,  117,   80,   80,   80,  200,  201,
+
+      118,  202,  111,  114,  114,  114,  114,  114,  115,  114,
+      114,  114,  114,  114,  114,  205,  114,  114,  114,  114,
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+      114,  114,  114,   45,  114,  114,  114,  206,  114,  114,
+      114,  105,  114,  114,  114,  114,  114,  114,  145,  114,
+      114,  114,  146,  114,  109,  116,  114,  114,  114,  114,
+      114,  114,  114,  154,  105,  173,  155,  156,  112,  174,
+      187,  147,  110,  148,  131,  149,  157,  109,  162,  158,
+      175,  163,  111,  173,  175,  174,  182,  164,  165,  195,
+
+      173,  112,  207,  166,  174,  110,  187,  167,  211,  212,
+      170,  168,  213,  221,  222,  171,  226,  175,  176,  111,
+      177,  178,  195,  182,   85,   85,  169,   85,   85,   85,
+       85,   85,   85,   85,   85,   85,   85,   85,   85,   85,
+       85,   85,   85,   85,   85,   85,   85,   85,   85,   85,
+       85,   85,   85,   85,   85,   85,   85,   85,   85,   85,
+       85,   85,   85,   85,   85,   85,   85,   85,   85,   85,
+       85,   85,   85,   85,   85,   85,   85,   85,   85,   85,
+       85,   85,   85,   85,   85,   85,   85,   85,   85,   85,
+       85,   85,   85,   85,   44,  186,  188,  191,  227,  203,
+
+      192,   44,  194,  193,  228, 1410, 1410, 1410,  204,  230,
+      196,  182,  208,  209,  214,  223,  215,  114,  224,  217,
+      186,  210,  225,  231,  191,  189,  192,  198,  194,   44,
+      193,  218,  216,   44,  232,  233,  234,   44,  199,  219,
+      235,  236,  238,  240,   44,  114,  229,  237,   44,  114,
+       44,  181,  241,  114,  220,  242,  114,  114,  114,  243,
+      114,  114,  239,  244,  114,  245,  114,  114,  246,  197,
+      197,  197,  247,  248,  249,  250,  197,  197,  197,  197,
+      197,  197,  251,  252,  255,  256,  253,  254,  257,  258,
+      266,  269,  270,  271,  267,  272,  273,  274,  268,  197,
+
+      197,  197,  197,  197,  197,  275,  276,  277,  278,  285,
+      279,  288,  281,  280,  279,  280,  289,  292,  293,  281,
+      290,  295,  259,  260,  261,  287,  294,  297,  300,  302,
+      291,  298,  262,  303,  263,  281,  264,  279,  280,  265,
+      283,  282,  284,  286,  286,  286,  296,  290,  287,  294,
+      286,  286,  286,  286,  286,  286,  291,  298,  304,  287,
+      305,  306,  308,  309,  310,  311,  312,  307,  313,  296,
+      314,  315,  316,  286,  286,  286,  286,  286,  286,  299,
+      299,  299,  301,  317,  318,  319,  299,  299,  299,  299,
+      299,  299,  320,  321,  322,  323,  324,  325,  326,  327,
+
+      328,  329,  330,  331,  332,  333,  334,  335,  336,  299,
+      299,  299,  299,  299,  299,  337,  338,  339,  340,  341,
+      344,  345,  346,  347,  348,  349,  350,  352,  353,  354,
+      355,  356,  357,  358,  359,  360,  361,  362,  363,  364,
+      365,  366,  368,  369,  367,  370,  371,  372,  373,  374,
+      375,  376,  377,  378,  379,  380,  381,  382,  383,  384,
+      385,  385,  387,  389,  390,  391,  392,  395,  396,  342,
+      394,  397,  343,  351,  393,  398,  399,  402,  388,  388,
+      388,  403,  404,  385,  386,  388,  388,  388,  388,  388,
+      388,  389,  389,  394,  400,  400,  400,  405,  397,  406,
+
+      407,  400,  400,  400,  400,  400,  400,  409,  388,  388,
+      388,  388,  388,  388,  410,  411,  408,  412,  413,  414,
+      401,  416,  417,  415,  400,  400,  400,  400,  400,  400,
+      418,  419,  420,  421,  422,  423,  424,  425,  426,  427,
+      428,  429,  433,  434,  435,  436,  430,  437,  438,  439,
+      440,  443,  444,  445,  446,  447,  448,  441,  449,  450,
+      451,  452,  453,  454,  456,  457,  442,  458,  459,  460,
+      461,  462,  455,  463,  464,  466,  467,  468,  470,  471,
+      472,  469,  473,  474,  475,  476,  478,  479,  480,  477,
+      481,  431,  482,  483,  484,  485,  432,  486,  487,  488,
+
+      489,  490,  491,  492,  493,  495,  496,  498,  499,  494,
+      497,  497,  497,  500,  501,  502,  503,  497,  497,  497,
+      497,  497,  497,  504,  505,  506,  509,  507,  510,  465,
+      511,  512,  513,  498,  498,  514,  515,  516,  517,  518,
+      497,  497,  497,  497,  497,  497,  519,   45,   45,   45,
+      520,  506,  521,  507,   45,   45,   45,   45,   45,   45,
+      508,  522,  523,  524,  525,  526,  527,  528,  530,  531,
+      532,  533,  529,  534,  535,  536,  537,   45,   45,   45,
+       45,   45,   45,  538,  539,  540,  541,  542,  543,  544,
+      545,  546,  547,  548,  549,  550,  551,  552,  553,  554,
+
+      555,  556,  557,  558,  559,  560,  561,  562,  563,  564,
+      565,  566,  567,  568,  569,  570,  571,  572,  573,  574,
+      575,  576,  577,  578,  579,  581,  582,  583,  584,  580,
+      585,  586,  587,  588,  589,  590,  591,  592,  593,  594,
+       44,   44,   44,  595,  596,  597,  598,   44,   44,   44,
+       44,   44,   44,  599,  600,  595,  602,  605,  606,  607,
+      601,  603,  604,  608,  609,  610,  611,  612,  613,  614,
+       44,   44,   44,   44,   44,   44,  615,  616,  617,  599,
+      618,  600,  619,  620,  621,  622,  623,  624,  625,  626,
+      627,  628,  629,  630,  631,  632,  633,  634,  635,  636,
+
+      637,  639,  640,  641,  642,  643,  644,  645,  646,  647,
+      648,  649,  650,  651,  652,  653,  655,  656,  657,  658,
+      659,  660,  661,  662,  665,  666,  667,  668,  663,  669,
+      670,  671,  672,  673,  674,  675,  676,  677,  678,  679,
+      680,  681,  684,  682,  685,  686,  687,  688,  689,  690,
+      691,  638,  654,  683,  692,  694,  695,  696,  697,  698,
+      700,  701,  702,  693,  703,  664,  704,  705,  706,  707,
+      708,  709,  710,  691,  711,  712,  690,  713,  714,  715,
+      716,  717,  718,  719,  720,  721,  722,  723,  724,  725,
+      726,  727,  728,  729,  730,  731,  732,  733,  734,  735,
+
+      699,  736,  737,  738,  739,  740,  741,  742,  743,  744,
+      745,  746,  747,  748,  749,  750,  751,  752,  753,  754,
+      755,  756,  757,  758,  759,  760,  761,  762,  763,  764,
+      765,  766,  767,  769,  771,  772,  773,  775,  768,  770,
+      776,  777,  774,  778,  779,  780,  781,  782,  783,  784,
+      785,  786,  787,  788,  789,  790,  791,  792,  793,  794,
+      795,  796,  797,  798,  799,  800,  801,  802,  803,  804,
+      805,  806,  807,  808,  782,  809,  810,  811,  812,  813,
+      814,  815,  816,  817,  818,  819,  820,  821,  822,  823,
+      824,  825,  826,  827,  828,  829,  831,  832,  833,  830,
+
+      834,  835,  836,  837,  838,  839,  840,  841,  842,  843,
+      844,  845,  846,  847,  848,  849,  850,  851,  852,  853,
+      854,  855,  857,  858,  859,  860,  861,  862,  863,  864,
+      865,  866,  856,  867,  868,  869,  870,  871,  872,  873,
+      874,  875,  876,  877,  878,  879,  880,  881,  882,  883,
+      884,  885,  886,  887,  888,  889,  867,  866,  890,  891,
+      892,  893,  894,  895,  896,  897,  898,  901,  902,  903,
+      904,  899,  905,  906,  907,  908,  909,  910,  911,  912,
+      913,  914,  915,  916,  917,  919,  920,  921,  922,  923,
+      924,  925,  926,  927,  918,  928,  929,  930,  931,  932,
+
+      933,  934,  935,  936,  937,  938,  939,  940,  941,  942,
+      943,  944,  945,  946,  948,  947,  949,  950,  951,  952,
+      953,  900,  954,  955,  956,  957,  958,  959,  960,  961,
+      962,  963,  964,  965,  966,  967,  968,  969,  970,  971,
+      946,  947,  972,  973,  974,  975,  976,  977,  979,  981,
+      982,  984,  978,  985,  986,  987,  988,  989,  990,  983,
+      991,  992,  993,  994,  995,  996,  997,  998,  999, 1000,
+     1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010,
+     1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020,
+      980, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029,
 
-       45,   45,   45,   45,   45,   45,   45,   45,   89,   89,
-       89,   45,  125,  101,  111,   45,  126,  804,  174,  127,
-      128,  141,  142,   45,  150,  143,  196,   45,  114,   45,
-      118,  144,  129,  148,  151,  149,  805,  111,  154,  152,
-      153,  155,  156,  162,  174,  175,  163,  112,  102,  196,
-      204,  114,  157,  164,  165,  158,  806,  113,  455,  166,
-      205,  170,   84,   84,   84,   80,  171,   81,   81,   81,
-      112,  175,  167,   82,  176,   88,  168,   88,   82,  174,
-       89,   89,   89,  175,   80,  113,   83,   83,   83,   84,
-       84,   84,  169,  176,  183,  807,   82,   82,  187,  100,
-
-       82,   82,  176,  192,  194,  177,  100,  228,  193,  178,
-      195,  183,  237,  220,  456,  209,  210,  215,  278,  216,
-       82,  179,  183,   82,  187,  211,  247,  248,  200,  221,
-      280,  192,  194,  238,  100,  193,  217,  195,  100,  201,
-      223,  251,  100,  224,  252,  253,  278,  225,  279,  229,
-      100,  257,  278,  280,  100,  279,  100,  182,  199,  199,
-      199,  438,  439,  808,  280,  199,  199,  199,  199,  199,
-      199,  265,  289,  286,  279,  266,  290,  297,  293,  267,
-      281,  282,  295,  385,  258,  259,  260,  283,  199,  199,
-      199,  199,  199,  199,  337,  261,  286,  262,  286,  263,
-
-      289,  293,  264,  290,  297,  295,  298,  298,  298,  381,
-      381,  390,  385,  298,  298,  298,  298,  298,  298,  304,
-      385,  300,  387,  388,  393,  305,  402,  809,  812,  813,
-      483,  389,  381,  382,  390,  484,  298,  298,  298,  298,
-      298,  298,  409,  403,  488,  338,  410,  445,  339,  397,
-      488,  423,  393,  396,  396,  396,  424,  446,  629,  814,
-      396,  396,  396,  396,  396,  396,  459,  496,  517,  497,
-      460,  563,  488,  518,  583,  584,  564,  579,  498,  657,
-      667,  666,  585,  396,  396,  396,  396,  396,  396,  658,
-      668,  732,  638,  665,  496,  630,  497,  639,  733,  734,
-
-      747,  583,  425,  584,  666,  738,  735,  426,   45,   45,
-       45,  739,  810,  815,  816,   45,   45,   45,   45,   45,
-       45,  665,  785,  817,  811,  818,  786,  819,  747,  820,
-      821,  822,  823,  824,  640,  825,  826,  827,   45,   45,
-       45,   45,   45,   45,  828,  829,  830,  831,  832,  833,
-      834,  835,  836,  837,  822,  838,  839,  821,  840,  841,
-      842,  843,  844,  845,  846,  847,  848,  851,  852,  853,
-      854,  849,  855,  856,  857,  858,  859,  860,  861,  862,
-      863,  865,  866,  867,  868,  869,  870,  871,  872,  873,
-      874,  864,  875,  876,  877,  878,  879,  880,  881,  882,
-
-      883,  884,  885,  886,  887,  888,  889,  890,  891,  893,
-      892,  894,  895,  896,  897,  898,  899,  900,  901,  902,
-      903,  904,  850,  905,  906,  907,  908,  909,  910,  911,
-      912,  913,  914,  915,  916,  917,  891,  892,  918,  920,
-      922,  923,  924,  919,  925,  926,  927,  928,  929,  930,
-      931,  932,  933,  934,  935,  936,  937,  938,  939,  940,
-      941,  942,  943,  944,  945,  946,  947,  948,  949,  950,
-      951,  952,  953,  954,  955,  956,  957,  958,  959,  960,
-      961,  921,  962,  963,  964,  965,  966,  967,  968,  969,
-      970,  971,  972,  973,  974,  975,  976,  977,  978,  957,
-
-      979,  980,  981,  982,  983,  958,  984,  985,  986,  987,
-      988,  989,  990,  991,  992,  993,  994,  995,  996,  997,
-      998,  999, 1000, 1001, 1002, 1004, 1005, 1006, 1007, 1008,
-     1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1018, 1019,
-     1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029,
      1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039,
-     1040, 1042, 1013, 1043, 1044, 1045, 1046, 1047, 1041, 1048,
-     1049, 1050, 1051, 1052, 1053, 1003, 1054, 1055, 1056, 1017,
-     1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066,
-     1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076,
-
-     1077, 1078, 1079, 1080, 1081, 1082, 1083, 1061, 1084, 1085,
-     1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095,
-     1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105,
-     1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115,
-     1116, 1117, 1118, 1119, 1120, 1121, 1122, 1096, 1123, 1124,
-     1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1135,
-     1136, 1137, 1138, 1134, 1139, 1140, 1141, 1142, 1143, 1144,
-     1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153, 1154,
-     1155, 1156, 1129, 1157, 1158, 1159, 1160, 1161, 1162, 1163,
-     1164, 1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173,
-
-     1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183,
-     1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193,
-     1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203,
-     1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213,
-     1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223,
-     1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233,
-     1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243,
-     1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253,
-     1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263,
-     1264,   12,   12,   12,   12,   12,   36,   36,   36,   36,
-
-       36,   79,  285,   79,   79,   79,   98,  384,   98,  487,
-       98,  100,  100,  100,  100,  100,  116,  116,  116,  116,
-      116,  173,  100,  173,  173,  173,  197,  197,  197,  798,
-      797,  796,  795,  794,  793,  792,  791,  790,  789,  788,
-      787,  784,  783,  782,  781,  780,  779,  778,  777,  776,
-      775,  774,  773,  772,  771,  770,  769,  768,  767,  766,
-      765,  764,  763,  762,  761,  760,  759,  758,  757,  756,
-      755,  754,  753,  752,  751,  750,  749,  748,  746,  745,
-      744,  743,  742,  741,  740,  737,  736,  731,  730,  729,
-      728,  727,  726,  725,  724,  723,  722,  721,  720,  719,
-
-      718,  717,  716,  715,  714,  713,  712,  711,  710,  709,
-      708,  707,  706,  705,  704,  703,  702,  701,  700,  699,
-      698,  697,  696,  695,  694,  693,  692,  691,  690,  689,
-      688,  687,  686,  685,  684,  683,  682,  681,  680,  679,
-      678,  677,  676,  675,  674,  673,  672,  671,  670,  669,
-      664,  663,  662,  661,  660,  659,  656,  655,  654,  653,
-      652,  651,  650,  649,  648,  647,  646,  645,  644,  643,
-      642,  641,  637,  636,  635,  634,  633,  632,  631,  628,
-      627,  626,  625,  624,  623,  622,  621,  620,  619,  618,
-      617,  616,  615,  614,  613,  612,  611,  610,  609,  608,
-
-      607,  606,  605,  604,  603,  602,  601,  600,  599,  598,
-      597,  596,  595,  594,  593,  592,  591,  590,  589,  588,
-      587,  586,  582,  581,  580,  579,  578,  577,  576,  575,
-      574,  573,  572,  571,  570,  569,  568,  567,  566,  565,
-      562,  561,  560,  559,  558,  557,  556,  555,  554,  553,
-      552,  551,  550,  549,  548,  547,  546,  545,  544,  543,
-      542,  541,  540,  539,  538,  537,  536,  535,  534,  533,
-      532,  531,  530,  529,  528,  527,  526,  525,  524,  523,
-      522,  521,  520,  519,  516,  515,  514,  513,  512,  511,
-      510,  509,  508,  507,  506,  505,  504,  503,  502,  501,
-
-      500,  499,  495,  494,  493,  492,  491,  490,  489,  486,
-      485,  482,  481,  480,  479,  478,  477,  476,  475,  474,
-      473,  472,  471,  470,  469,  468,  467,  466,  465,  464,
-      463,  462,  461,  458,  457,  454,  453,  452,  451,  450,
-      449,  448,  447,  444,  443,  442,  441,  440,  437,  436,
-      435,  434,  433,  432,  431,  430,  429,  428,  427,  422,
-      421,  420,  419,  418,  417,  416,  415,  414,  413,  412,
-      411,  408,  407,  406,  405,  404,  401,  400,  399,  398,
-      395,  394,  392,  391,  386,  383,  380,  379,  378,  377,
-      376,  375,  374,  373,  372,  371,  370,  369,  368,  367,
-
-      366,  365,  364,  361,  360,  359,  358,  357,  356,  355,
-      354,  353,  352,  351,  350,  349,  348,  345,  344,  343,
-      342,  341,  340,  336,  335,  334,  333,  332,  331,  330,
-      329,  328,  327,  326,  325,  324,  323,  322,  321,  320,
-      319,  318,  317,  316,  315,  314,  313,  312,  311,  310,
-      309,  308,  307,  306,  303,  302,  301,  299,  198,  296,
-      294,  292,  291,  288,  287,  284,  277,  276,  275,  274,
-      273,  272,  271,  270,  269,  268,  256,  255,  254,  250,
-      249,  246,  245,  244,  243,  242,  241,  240,  239,  236,
-      235,  234,  233,  232,  231,  230,  227,  226,  222,  214,
-
-      213,  212,  208,  207,  206,  203,  202,  198,  191,  186,
-      185,  184,  181,  180,  172,  159,  140,  133,  106,  105,
-      104,   43,   99,   97,   96,   87,   43, 1265,   11, 1265,
-     1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265,
-     1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265,
-     1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265,
-     1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265,
-     1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265,
-     1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265,
-     1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265
-
+     1040, 1041, 1042, 1043, 1044, 1022, 1045, 1046, 1047, 1048,
+     1023, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057,
+     1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067,
+     1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076, 1078,
+     1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087, 1088,
+     1089, 1090, 1091, 1093, 1094, 1095, 1096, 1097, 1098, 1099,
+     1100, 1101, 1102, 1103, 1104, 1105, 1106, 1108, 1109, 1110,
+     1111, 1107, 1112, 1113, 1114, 1087, 1115, 1116, 1117, 1118,
+     1119, 1120, 1121, 1122, 1123, 1125, 1126, 1127, 1077, 1128,
+
+     1129, 1130, 1124, 1131, 1092, 1132, 1133, 1134, 1135, 1136,
+     1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146,
+     1147, 1148, 1149, 1150, 1151, 1152, 1153, 1154, 1155, 1156,
+     1157, 1158, 1159, 1160, 1161, 1163, 1164, 1165, 1166, 1167,
+     1162, 1145, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175,
+     1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185,
+     1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195,
+     1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204, 1205,
+     1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1189,
+     1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224,
+
+     1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234,
+     1235, 1236, 1237, 1239, 1240, 1241, 1242, 1238, 1243, 1244,
+     1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254,
+     1255, 1256, 1257, 1231, 1258, 1259, 1260, 1261, 1262, 1263,
+     1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273,
+     1274, 1275, 1276, 1277, 1278, 1279, 1280, 1281, 1282, 1283,
+     1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293,
+     1294, 1295, 1296, 1297, 1298, 1300, 1301, 1302, 1303, 1304,
+     1305, 1306, 1307, 1299, 1308, 1309, 1310, 1311, 1312, 1313,
+     1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323,
+
+     1324, 1325, 1326, 1327, 1328, 1329, 1330, 1331, 1332, 1333,
+     1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343,
+     1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353,
+     1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362, 1363,
+     1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373,
+     1374, 1375, 1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383,
+     1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393,
+     1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403,
+     1404, 1405, 1406, 1407, 1408, 1409,   11, 1410, 1410, 1410,
+     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
+
+     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
+     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
+     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
+     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
+     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
+     1410, 1410, 1410, 1410, 1410, 1410, 1410
     } ;
 
-static const flex_int16_t yy_chk[1701] =
+static const flex_int16_t yy_chk[2258] =
     {   0,
-        0,    1,    1,    1,    0,    1,    1,    0,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,   21,  245,
-        3,    3,    3,   21,    1,    1,    3,    0,    0,    1,
-        4,    4,    4,   13,    1,   13,    4,   27,   28,    1,
-       57,    1,    5,    5,    5,   26,   32,    1,    1,   33,
-        6,    6,    6,    7,    7,    7,    1,    7,    0,    8,
-        8,    8,    1,    8,   57,   27,   28,  245,   26,    1,
-        1,    2,    2,    2,   32,    2,    2,   33,    2,    2,
-        2,    2,    2,    2,    2,    2,    2,    2,    9,    9,
-        9,   52,    5,   31,    2,    2,   10,   10,   10,    2,
-
-        6,   20,   20,   20,    2,   37,    9,   37,   42,    2,
-       42,    2,   20,   51,   10,   54,   31,    2,    2,   52,
-       62,   66,   25,  723,   25,  724,    2,   25,   25,   25,
-       62,   66,    2,   66,  260,   20,   51,  260,   54,    2,
-        2,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        3,    3,   11,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        5,    5,    7,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    8,   13,    9,   13,   10,   14,    5,
+        5,   19,   19,   19,    5,   22,   22,   22,   20,    5,
+       20,   20,   20,   21,    5,   24,    5,   37,   21,   37,
+       38,   39,    5,    5,   41,   43,    5,    9,    7,   10,
+        5,   42,   48,   42,   49,   25,    5,   25,   50,    8,
+
+       25,   25,   25,    5,    5,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   17,   47,   17,   17,   17,   19,   53,   19,
-       19,   19,   44,   56,   22,   17,   22,   22,   22,   60,
-       19,   69,   60,   55,   60,   69,   60,   22,   74,   47,
-      725,   59,   74,   55,   65,  131,   56,   53,   17,   65,
-      108,   63,   65,   19,  109,   69,   55,   44,  131,  726,
-       22,   45,  727,   45,   45,   45,   45,   59,   45,   45,
-       45,   55,   58,   59,   63,   45,   45,  108,   45,   58,
-       88,   88,   88,  109,   45,   63,   45,   45,   45,   45,
+       15,   15,   15,   15,   15,   16,   16,   67,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   17,   26,   17,   17,   17,
+       27,   28,   31,   32,   47,   33,   62,   60,   17,   64,
+       65,   52,   51,   73,   78,   65,   62,   60,   65,   26,
+       60,   64,   60,   96,   60,   31,   97,   27,   28,   47,
+       32,   17,   33,   40,   40,   51,   40,   40,   52,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       45,   54,   45,   45,   45,   45,  102,   45,   45,   45,
+       66,   87,   74,   87,   45,   45,   74,   45,   53,   66,
+       88,   66,   88,   45,   54,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   58,   89,   89,
-       89,   58,   61,  100,   70,   58,   61,  728,   90,   61,
-       61,   68,   68,   58,   71,   68,  115,   58,   77,   58,
-       58,   68,   61,   70,   71,   70,  729,   70,   72,   71,
-       71,   72,   72,   75,   90,   91,   75,   76,  100,  115,
-      122,   77,   72,   75,   75,   72,  730,   76,  353,   75,
-      122,   77,   80,   80,   80,   81,   77,   81,   81,   81,
-       76,   91,   76,   80,   92,   82,   76,   82,   81,   93,
-       82,   82,   82,   94,   83,   76,   83,   83,   83,   84,
-       84,   84,   76,   95,  103,  731,   80,   83,  107,  102,
-
-       84,   81,   92,  111,  113,   93,  102,  137,  112,   94,
-      114,  119,  145,  132,  353,  126,  126,  130,  174,  130,
-       83,   95,  103,   84,  107,  126,  154,  154,  119,  132,
-      176,  111,  113,  145,  102,  112,  130,  114,  102,  119,
-      134,  157,  102,  134,  157,  157,  174,  134,  175,  137,
-      102,  161,  177,  176,  102,  178,  102,  102,  118,  118,
-      118,  337,  337,  732,  179,  118,  118,  118,  118,  118,
-      118,  162,  187,  183,  175,  162,  188,  196,  192,  162,
-      177,  178,  194,  286,  161,  161,  161,  179,  118,  118,
-      118,  118,  118,  118,  238,  161,  183,  161,  201,  161,
-
-      187,  192,  161,  188,  196,  194,  199,  199,  199,  278,
-      281,  289,  286,  199,  199,  199,  199,  199,  199,  205,
-      300,  201,  288,  288,  293,  205,  305,  733,  735,  736,
-      379,  288,  278,  281,  289,  379,  199,  199,  199,  199,
-      199,  199,  312,  305,  385,  238,  312,  343,  238,  300,
-      397,  325,  293,  298,  298,  298,  325,  343,  546,  737,
-      298,  298,  298,  298,  298,  298,  356,  395,  419,  395,
-      356,  468,  385,  419,  496,  497,  468,  498,  397,  574,
-      585,  584,  498,  298,  298,  298,  298,  298,  298,  574,
-      585,  652,  555,  583,  395,  546,  395,  555,  652,  653,
-
-      666,  496,  325,  497,  584,  656,  653,  325,  396,  396,
-      396,  656,  734,  738,  739,  396,  396,  396,  396,  396,
-      396,  583,  709,  741,  734,  742,  709,  743,  666,  744,
-      746,  747,  748,  749,  555,  750,  751,  752,  396,  396,
-      396,  396,  396,  396,  753,  754,  755,  756,  757,  758,
-      759,  761,  762,  763,  747,  764,  765,  746,  766,  767,
-      768,  769,  770,  772,  773,  774,  775,  776,  778,  779,
-      780,  775,  781,  782,  783,  784,  785,  786,  787,  788,
-      789,  790,  793,  794,  795,  797,  798,  799,  801,  802,
-      803,  789,  804,  805,  806,  807,  808,  809,  810,  811,
-
-      812,  814,  815,  816,  817,  818,  819,  820,  821,  823,
-      822,  824,  825,  826,  827,  828,  829,  830,  831,  832,
-      834,  835,  775,  836,  837,  838,  839,  840,  841,  842,
-      843,  844,  845,  846,  847,  849,  821,  822,  850,  851,
-      852,  853,  854,  850,  855,  856,  857,  858,  859,  860,
-      861,  862,  863,  864,  865,  866,  867,  868,  869,  870,
-      872,  873,  874,  875,  876,  877,  878,  880,  883,  884,
-      885,  886,  887,  888,  889,  890,  891,  892,  893,  894,
-      895,  851,  896,  897,  898,  901,  902,  903,  904,  905,
-      906,  907,  908,  909,  910,  911,  912,  913,  914,  891,
-
-      917,  919,  921,  922,  923,  892,  924,  925,  926,  928,
-      929,  931,  932,  933,  934,  937,  939,  940,  941,  942,
-      943,  944,  945,  946,  947,  948,  949,  950,  951,  952,
-      953,  954,  955,  956,  957,  958,  959,  961,  962,  963,
-      964,  965,  966,  967,  968,  970,  971,  972,  973,  974,
-      975,  976,  977,  978,  979,  980,  981,  982,  983,  985,
-      986,  987,  957,  990,  991,  992,  993,  994,  986,  995,
-      996,  997,  998,  999, 1001,  947, 1002, 1003, 1006,  961,
-     1009, 1010, 1011, 1012, 1013, 1015, 1017, 1018, 1019, 1020,
-     1021, 1022, 1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031,
-
-     1032, 1033, 1035, 1037, 1039, 1040, 1041, 1013, 1043, 1044,
-     1045, 1046, 1047, 1050, 1052, 1053, 1054, 1056, 1057, 1059,
-     1061, 1062, 1063, 1064, 1065, 1066, 1067, 1069, 1071, 1072,
-     1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082,
-     1083, 1084, 1085, 1086, 1087, 1088, 1089, 1061, 1090, 1091,
-     1092, 1093, 1094, 1095, 1096, 1097, 1099, 1102, 1104, 1105,
-     1106, 1107, 1108, 1104, 1109, 1110, 1112, 1115, 1116, 1118,
-     1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 1129,
-     1130, 1132, 1096, 1134, 1135, 1136, 1137, 1138, 1140, 1141,
-     1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151,
-
-     1153, 1155, 1156, 1157, 1158, 1159, 1161, 1162, 1163, 1164,
-     1166, 1167, 1168, 1169, 1170, 1171, 1172, 1174, 1175, 1176,
-     1177, 1178, 1179, 1180, 1181, 1183, 1184, 1185, 1186, 1188,
-     1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198,
-     1200, 1203, 1204, 1205, 1206, 1208, 1210, 1211, 1213, 1214,
-     1215, 1216, 1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225,
-     1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234, 1235,
-     1236, 1237, 1238, 1240, 1242, 1243, 1244, 1245, 1246, 1250,
-     1251, 1252, 1254, 1255, 1256, 1257, 1258, 1259, 1260, 1262,
-     1263, 1266, 1266, 1266, 1266, 1266, 1267, 1267, 1267, 1267,
-
-     1267, 1268, 1274, 1268, 1268, 1268, 1269, 1275, 1269, 1276,
-     1269, 1270, 1270, 1270, 1270, 1270, 1271, 1271, 1271, 1271,
-     1271, 1272, 1277, 1272, 1272, 1272, 1273, 1273, 1273,  722,
-      721,  720,  719,  718,  717,  715,  714,  713,  712,  711,
-      710,  708,  707,  704,  703,  702,  699,  698,  697,  696,
-      695,  694,  693,  692,  691,  690,  689,  688,  687,  686,
-      684,  683,  682,  681,  680,  679,  678,  677,  676,  675,
-      674,  673,  672,  671,  670,  669,  668,  667,  665,  663,
-      662,  661,  660,  659,  658,  655,  654,  651,  650,  649,
-      648,  647,  646,  645,  644,  643,  642,  641,  640,  639,
-
-      637,  636,  635,  634,  633,  632,  631,  630,  628,  627,
-      626,  625,  624,  622,  621,  620,  619,  618,  617,  616,
-      615,  614,  613,  612,  611,  610,  609,  608,  607,  606,
-      605,  604,  603,  602,  601,  600,  599,  598,  597,  596,
-      595,  594,  593,  592,  591,  590,  589,  588,  587,  586,
-      582,  581,  580,  577,  576,  575,  572,  571,  570,  569,
-      568,  567,  566,  565,  564,  562,  561,  560,  559,  558,
-      557,  556,  554,  553,  551,  550,  549,  548,  547,  545,
-      544,  543,  542,  540,  539,  538,  537,  536,  535,  534,
-      533,  532,  531,  530,  529,  528,  527,  526,  524,  523,
-
-      522,  521,  520,  519,  518,  516,  515,  514,  513,  512,
-      511,  510,  509,  508,  507,  506,  505,  504,  503,  502,
-      501,  500,  494,  492,  489,  488,  486,  485,  484,  482,
-      478,  477,  476,  475,  474,  473,  472,  471,  470,  469,
-      467,  466,  465,  464,  463,  462,  461,  460,  459,  458,
-      456,  454,  453,  452,  451,  450,  449,  448,  447,  446,
-      445,  443,  442,  441,  440,  439,  438,  437,  436,  435,
-      434,  433,  432,  431,  430,  429,  428,  427,  426,  425,
-      424,  422,  421,  420,  418,  417,  416,  415,  414,  413,
-      411,  410,  409,  408,  407,  406,  404,  403,  402,  401,
-
-      399,  398,  393,  392,  390,  389,  388,  387,  386,  383,
-      380,  378,  377,  376,  375,  374,  373,  372,  371,  370,
-      369,  368,  367,  366,  365,  364,  363,  362,  361,  360,
-      359,  358,  357,  355,  354,  352,  351,  350,  349,  348,
-      347,  346,  345,  342,  341,  340,  339,  338,  336,  335,
-      334,  333,  332,  331,  330,  329,  328,  327,  326,  324,
-      323,  322,  321,  320,  319,  318,  317,  316,  315,  314,
-      313,  311,  310,  309,  308,  307,  304,  303,  302,  301,
-      297,  295,  292,  290,  287,  284,  277,  276,  275,  274,
-      273,  272,  271,  270,  269,  268,  267,  266,  265,  264,
-
-      263,  262,  261,  259,  258,  257,  256,  255,  254,  253,
-      252,  251,  250,  249,  248,  247,  246,  244,  243,  242,
-      241,  240,  239,  237,  236,  235,  234,  233,  232,  231,
-      230,  229,  227,  226,  225,  224,  223,  222,  221,  220,
-      219,  218,  217,  216,  215,  214,  213,  212,  211,  210,
-      209,  208,  207,  206,  204,  203,  202,  200,  197,  195,
-      193,  191,  190,  185,  184,  180,  172,  171,  170,  169,
-      168,  167,  166,  165,  164,  163,  160,  159,  158,  156,
-      155,  153,  152,  151,  150,  149,  148,  147,  146,  144,
-      143,  142,  141,  140,  139,  138,  136,  135,  133,  129,
-
-      128,  127,  125,  124,  123,  121,  120,  116,  110,  106,
-      105,  104,   98,   97,   78,   73,   67,   64,   50,   49,
-       48,   43,   41,   39,   38,   24,   14,   11, 1265, 1265,
-     1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265,
-     1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265,
-     1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265,
-     1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265,
-     1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265,
-     1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265,
-     1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265
-
+       45,   45,   45,   45,   45,   55,   53,   56,   57,   59,
+       61,   71,   68,   68,   61,   55,   68,   61,   61,  103,
+       71,   68,   83,   83,   83,   71,   71,  104,   55,   61,
+       56,  108,   57,   80,   59,   80,   80,   80,  118,  119,
+
+       59,  120,   55,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,  122,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,  123,   58,   58,
+       58,   63,   58,   58,   58,   58,   58,   58,   69,   58,
+       58,   58,   69,   58,   70,   58,   58,   58,   58,   58,
+       58,   58,   58,   72,   63,   89,   72,   72,   77,   90,
+      106,   69,   76,   70,   63,   70,   72,   70,   75,   72,
+       91,   75,   76,   92,   94,   93,  101,   75,   75,  113,
+
+       89,   77,  124,   75,   90,   76,  106,   76,  126,  127,
+       77,   76,  128,  132,  133,   77,  135,   91,   92,   76,
+       93,   94,  113,  101,   85,   85,   76,   85,   85,   85,
+       85,   85,   85,   85,   85,   85,   85,   85,   85,   85,
+       85,   85,   85,   85,   85,   85,   85,   85,   85,   85,
+       85,   85,   85,   85,   85,   85,   85,   85,   85,   85,
+       85,   85,   85,   85,   85,   85,   85,   85,   85,   85,
+       85,   85,   85,   85,   85,   85,   85,   85,   85,   85,
+       85,   85,   85,   85,   85,   85,   85,   85,   85,   85,
+       85,   85,   85,   85,  100,  105,  107,  109,  136,  121,
+
+      110,  100,  112,  111,  137,  114,  114,  114,  121,  138,
+      114,  117,  125,  125,  129,  134,  129,  114,  134,  130,
+      105,  125,  134,  139,  109,  107,  110,  117,  112,  100,
+      111,  130,  129,  100,  140,  141,  142,  100,  117,  131,
+      143,  144,  145,  146,  100,  114,  137,  144,  100,  114,
+      100,  100,  147,  114,  131,  148,  116,  116,  116,  149,
+      114,  116,  145,  150,  114,  151,  114,  114,  152,  116,
+      116,  116,  153,  154,  154,  155,  116,  116,  116,  116,
+      116,  116,  156,  157,  158,  159,  157,  157,  160,  161,
+      162,  163,  164,  165,  162,  166,  167,  168,  162,  116,
+
+      116,  116,  116,  116,  116,  169,  170,  171,  172,  179,
+      173,  183,  175,  174,  176,  177,  184,  189,  190,  178,
+      186,  192,  161,  161,  161,  182,  191,  194,  198,  200,
+      187,  195,  161,  201,  161,  175,  161,  173,  174,  161,
+      177,  176,  178,  181,  181,  181,  193,  186,  182,  191,
+      181,  181,  181,  181,  181,  181,  187,  195,  202,  199,
+      203,  204,  205,  206,  207,  208,  209,  204,  210,  193,
+      211,  212,  213,  181,  181,  181,  181,  181,  181,  197,
+      197,  197,  199,  214,  215,  216,  197,  197,  197,  197,
+      197,  197,  217,  218,  219,  220,  221,  222,  223,  224,
+
+      225,  226,  227,  229,  230,  231,  232,  233,  234,  197,
+      197,  197,  197,  197,  197,  235,  236,  237,  238,  239,
+      240,  241,  242,  243,  244,  245,  246,  247,  248,  249,
+      250,  251,  252,  253,  254,  255,  256,  257,  258,  259,
+      260,  261,  262,  263,  261,  264,  265,  266,  267,  268,
+      269,  270,  271,  272,  273,  274,  275,  276,  277,  278,
+      279,  282,  285,  287,  288,  289,  289,  291,  293,  239,
+      290,  294,  239,  246,  289,  296,  298,  302,  286,  286,
+      286,  303,  304,  279,  282,  286,  286,  286,  286,  286,
+      286,  287,  301,  290,  299,  299,  299,  305,  294,  306,
+
+      307,  299,  299,  299,  299,  299,  299,  309,  286,  286,
+      286,  286,  286,  286,  310,  311,  307,  312,  313,  314,
+      301,  315,  316,  314,  299,  299,  299,  299,  299,  299,
+      317,  318,  319,  320,  321,  322,  323,  324,  325,  326,
+      327,  328,  329,  330,  331,  332,  328,  333,  334,  335,
+      336,  337,  338,  339,  340,  341,  341,  336,  342,  343,
+      344,  345,  346,  347,  349,  350,  336,  351,  352,  353,
+      354,  355,  347,  356,  357,  358,  359,  360,  361,  362,
+      363,  360,  364,  365,  366,  367,  368,  369,  370,  367,
+      371,  328,  372,  373,  374,  375,  328,  376,  377,  378,
+
+      379,  380,  381,  382,  383,  384,  387,  389,  390,  383,
+      388,  388,  388,  391,  392,  393,  394,  388,  388,  388,
+      388,  388,  388,  396,  397,  399,  402,  399,  403,  357,
+      404,  406,  407,  401,  389,  408,  409,  411,  412,  413,
+      388,  388,  388,  388,  388,  388,  414,  400,  400,  400,
+      415,  399,  416,  399,  400,  400,  400,  400,  400,  400,
+      401,  418,  419,  420,  421,  422,  423,  424,  425,  426,
+      427,  428,  424,  430,  431,  432,  433,  400,  400,  400,
+      400,  400,  400,  434,  435,  436,  437,  438,  439,  440,
+      441,  442,  443,  444,  445,  446,  447,  448,  449,  450,
+
+      451,  452,  454,  455,  456,  457,  458,  459,  460,  461,
+      462,  463,  465,  467,  468,  469,  470,  471,  472,  473,
+      474,  475,  476,  477,  478,  479,  480,  481,  482,  478,
+      483,  484,  485,  486,  487,  488,  492,  494,  495,  496,
+      497,  497,  497,  498,  499,  502,  504,  497,  497,  497,
+      497,  497,  497,  506,  507,  508,  510,  511,  512,  513,
+      508,  510,  510,  514,  515,  516,  517,  518,  519,  520,
+      497,  497,  497,  497,  497,  497,  521,  522,  523,  506,
+      524,  507,  525,  526,  527,  529,  530,  531,  532,  533,
+      534,  535,  536,  538,  539,  540,  541,  542,  543,  544,
+
+      545,  546,  547,  548,  549,  550,  551,  552,  553,  554,
+      555,  557,  558,  559,  560,  561,  562,  563,  564,  565,
+      566,  568,  569,  570,  571,  572,  573,  574,  570,  575,
+      576,  577,  578,  580,  581,  582,  583,  584,  585,  586,
+      587,  588,  591,  590,  592,  593,  596,  597,  598,  599,
+      600,  545,  561,  590,  601,  602,  603,  604,  605,  606,
+      607,  608,  609,  601,  610,  570,  611,  612,  613,  614,
+      615,  616,  617,  600,  618,  619,  599,  620,  621,  622,
+      623,  624,  625,  626,  627,  628,  629,  630,  631,  632,
+      633,  634,  635,  636,  637,  638,  639,  640,  641,  642,
+
+      606,  643,  644,  645,  646,  648,  649,  650,  651,  652,
+      654,  655,  656,  657,  658,  659,  660,  661,  663,  664,
+      665,  666,  667,  668,  669,  670,  671,  672,  673,  674,
+      675,  676,  677,  678,  679,  680,  681,  683,  677,  678,
+      684,  685,  681,  686,  687,  688,  690,  691,  692,  693,
+      694,  695,  696,  697,  698,  699,  700,  701,  702,  703,
+      704,  705,  706,  707,  708,  709,  710,  711,  712,  713,
+      715,  716,  717,  718,  691,  719,  720,  721,  722,  723,
+      724,  725,  726,  727,  728,  729,  730,  731,  732,  734,
+      736,  737,  738,  741,  742,  743,  744,  745,  746,  743,
+
+      747,  748,  749,  751,  752,  753,  754,  755,  756,  757,
+      758,  759,  760,  761,  762,  763,  764,  765,  766,  767,
+      768,  769,  770,  771,  772,  773,  774,  776,  777,  778,
+      779,  781,  769,  782,  783,  784,  785,  786,  787,  788,
+      789,  790,  791,  792,  793,  794,  795,  796,  797,  798,
+      800,  801,  802,  803,  804,  805,  782,  781,  806,  807,
+      808,  809,  810,  812,  813,  814,  815,  816,  818,  819,
+      820,  815,  821,  822,  823,  824,  825,  826,  827,  828,
+      829,  830,  831,  832,  833,  834,  837,  838,  839,  841,
+      842,  843,  845,  846,  833,  847,  848,  849,  850,  851,
+
+      852,  853,  854,  855,  856,  857,  859,  860,  861,  862,
+      863,  864,  865,  866,  868,  867,  869,  870,  871,  873,
+      874,  815,  875,  876,  877,  878,  879,  880,  881,  883,
+      884,  885,  886,  887,  888,  889,  890,  891,  892,  893,
+      866,  867,  894,  895,  896,  897,  899,  900,  901,  902,
+      903,  904,  900,  905,  906,  907,  908,  909,  910,  903,
+      911,  912,  913,  914,  915,  916,  917,  918,  919,  920,
+      921,  922,  923,  924,  926,  927,  928,  929,  930,  931,
+      932,  933,  935,  938,  939,  940,  941,  942,  943,  944,
+      901,  945,  946,  947,  948,  949,  950,  952,  953,  954,
+
+      955,  956,  959,  960,  961,  962,  963,  964,  965,  966,
+      967,  968,  969,  970,  971,  946,  972,  973,  976,  978,
+      947,  980,  981,  982,  983,  984,  985,  986,  987,  988,
+      989,  990,  992,  993,  995,  996,  997,  998, 1001, 1003,
+     1004, 1005, 1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013,
+     1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023,
+     1024, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034,
+     1035, 1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044, 1045,
+     1046, 1042, 1047, 1048, 1049, 1022, 1050, 1051, 1052, 1053,
+     1054, 1055, 1056, 1058, 1059, 1060, 1063, 1064, 1012, 1065,
+
+     1066, 1067, 1059, 1068, 1027, 1069, 1070, 1071, 1072, 1073,
+     1075, 1076, 1077, 1080, 1083, 1084, 1085, 1086, 1087, 1089,
+     1090, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1100, 1101,
+     1102, 1103, 1104, 1105, 1107, 1108, 1109, 1110, 1111, 1113,
+     1107, 1087, 1115, 1116, 1117, 1118, 1120, 1122, 1123, 1124,
+     1126, 1127, 1128, 1129, 1130, 1133, 1134, 1136, 1137, 1138,
+     1140, 1141, 1143, 1145, 1146, 1147, 1148, 1149, 1150, 1151,
+     1152, 1153, 1155, 1157, 1158, 1159, 1160, 1161, 1162, 1163,
+     1164, 1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172, 1145,
+     1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182,
+
+     1183, 1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 1193,
+     1194, 1197, 1199, 1200, 1201, 1202, 1203, 1199, 1204, 1205,
+     1206, 1207, 1209, 1211, 1214, 1216, 1217, 1219, 1220, 1221,
+     1222, 1223, 1224, 1189, 1225, 1226, 1227, 1228, 1229, 1231,
+     1232, 1233, 1235, 1236, 1238, 1239, 1240, 1241, 1242, 1243,
+     1244, 1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254,
+     1255, 1256, 1257, 1258, 1259, 1260, 1262, 1264, 1265, 1266,
+     1267, 1268, 1269, 1270, 1272, 1273, 1274, 1275, 1276, 1277,
+     1278, 1279, 1281, 1272, 1282, 1283, 1284, 1285, 1286, 1287,
+     1288, 1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297, 1298,
+
+     1299, 1301, 1302, 1304, 1305, 1306, 1307, 1308, 1309, 1311,
+     1312, 1313, 1314, 1315, 1316, 1318, 1319, 1320, 1321, 1322,
+     1323, 1324, 1325, 1326, 1328, 1330, 1333, 1334, 1335, 1336,
+     1337, 1339, 1340, 1342, 1343, 1344, 1345, 1347, 1349, 1350,
+     1352, 1354, 1356, 1357, 1358, 1359, 1360, 1361, 1362, 1363,
+     1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373,
+     1374, 1375, 1376, 1377, 1378, 1380, 1381, 1383, 1385, 1386,
+     1387, 1388, 1389, 1390, 1394, 1395, 1397, 1399, 1400, 1401,
+     1402, 1403, 1404, 1405, 1407, 1408, 1410, 1410, 1410, 1410,
+     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
+
+     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
+     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
+     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
+     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
+     1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410,
+     1410, 1410, 1410, 1410, 1410, 1410, 1410
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1563,25 +1730,27 @@ static char *yy_last_accepting_cpos;
 extern int yy_flex_debug;
 int yy_flex_debug = 1;
 
-static const flex_int16_t yy_rule_linenum[161] =
+static const flex_int16_t yy_rule_linenum[175] =
     {   0,
       145,  147,  149,  154,  155,  160,  161,  162,  174,  177,
       182,  189,  198,  207,  216,  225,  234,  243,  252,  261,
       270,  279,  288,  297,  306,  315,  325,  335,  345,  355,
       365,  375,  385,  395,  405,  414,  423,  432,  441,  450,
       459,  468,  480,  489,  498,  507,  516,  526,  536,  546,
-      556,  567,  577,  587,  597,  607,  618,  629,  640,  651,
-      660,  670,  679,  688,  704,  720,  729,  738,  747,  756,
-      765,  774,  783,  792,  801,  810,  821,  830,  840,  850,
-      859,  869,  879,  888,  897,  906,  915,  925,  934,  943,
-      952,  961,  970,  979,  988,  997, 1006, 1016, 1025, 1034,
-
-     1044, 1055, 1065, 1074, 1083, 1092, 1103, 1113, 1122, 1132,
-     1142, 1151, 1160, 1169, 1178, 1188, 1197, 1207, 1216, 1225,
-     1234, 1243, 1252, 1261, 1270, 1279, 1288, 1297, 1306, 1315,
-     1324, 1333, 1342, 1351, 1360, 1369, 1378, 1387, 1396, 1405,
-     1414, 1423, 1433, 1531, 1536, 1541, 1546, 1547, 1548, 1549,
-     1550, 1551, 1553, 1571, 1584, 1589, 1593, 1595, 1597, 1599
+      556,  567,  577,  587,  597,  607,  616,  625,  634,  643,
+      652,  661,  670,  679,  688,  697,  706,  715,  725,  735,
+      746,  757,  768,  779,  788,  798,  807,  816,  832,  848,
+      857,  866,  875,  884,  893,  902,  911,  920,  929,  938,
+      949,  958,  968,  978,  987,  997, 1007, 1016, 1025, 1034,
+
+     1043, 1053, 1062, 1071, 1080, 1089, 1098, 1107, 1116, 1125,
+     1134, 1144, 1153, 1162, 1172, 1183, 1193, 1202, 1211, 1220,
+     1231, 1241, 1250, 1260, 1270, 1279, 1288, 1297, 1306, 1316,
+     1325, 1335, 1344, 1353, 1362, 1371, 1380, 1389, 1398, 1407,
+     1416, 1425, 1434, 1443, 1452, 1461, 1470, 1479, 1488, 1497,
+     1506, 1515, 1524, 1533, 1542, 1551, 1561, 1659, 1664, 1669,
+     1674, 1675, 1676, 1677, 1678, 1679, 1681, 1699, 1712, 1717,
+     1721, 1723, 1725, 1727
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1634,7 +1803,7 @@ using namespace isc::dhcp;
 
 /* To avoid the call to exit... oops! */
 #define YY_FATAL_ERROR(msg) isc::dhcp::Parser6Context::fatal(msg)
-#line 1637 "dhcp6_lexer.cc"
+#line 1806 "dhcp6_lexer.cc"
 /* noyywrap disables automatic rewinding for the next file to parse. Since we
    always parse only a single string, there's no need to do any wraps. And
    using yywrap requires linking with -lfl, which provides the default yywrap
@@ -1660,8 +1829,8 @@ using namespace isc::dhcp;
    by moving it ahead by yyleng bytes. yyleng specifies the length of the
    currently matched token. */
 #define YY_USER_ACTION  driver.loc_.columns(yyleng);
-#line 1663 "dhcp6_lexer.cc"
-#line 1664 "dhcp6_lexer.cc"
+#line 1832 "dhcp6_lexer.cc"
+#line 1833 "dhcp6_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -1989,7 +2158,7 @@ YY_DECL
     }
 
 
-#line 1992 "dhcp6_lexer.cc"
+#line 2161 "dhcp6_lexer.cc"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -2018,13 +2187,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 1266 )
+				if ( yy_current_state >= 1411 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 1265 );
+		while ( yy_current_state != 1410 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -2043,13 +2212,13 @@ do_action:	/* This label is used only to access EOF actions. */
 			{
 			if ( yy_act == 0 )
 				fprintf( stderr, "--scanner backing up\n" );
-			else if ( yy_act < 161 )
+			else if ( yy_act < 175 )
 				fprintf( stderr, "--accepting rule at line %ld (\"%s\")\n",
 				         (long)yy_rule_linenum[yy_act], yytext );
-			else if ( yy_act == 161 )
+			else if ( yy_act == 175 )
 				fprintf( stderr, "--accepting default rule (\"%s\")\n",
 				         yytext );
-			else if ( yy_act == 162 )
+			else if ( yy_act == 176 )
 				fprintf( stderr, "--(end of buffer or a NUL)\n" );
 			else
 				fprintf( stderr, "--EOF (start condition %d)\n", YY_START );
@@ -2706,6 +2875,176 @@ YY_RULE_SETUP
 case 56:
 YY_RULE_SETUP
 #line 607 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_GROUP_COMMIT(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("group-commit", driver.loc_);
+    }
+}
+	YY_BREAK
+case 57:
+YY_RULE_SETUP
+#line 616 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_GROUP_COMMIT_SYNC(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("group-commit-sync", driver.loc_);
+    }
+}
+	YY_BREAK
+case 58:
+YY_RULE_SETUP
+#line 625 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_GROUP_COMMIT_MAX_BATCH(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("group-commit-max-batch", driver.loc_);
+    }
+}
+	YY_BREAK
+case 59:
+YY_RULE_SETUP
+#line 634 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_GROUP_COMMIT_MAX_LATENCY(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("group-commit-max-latency", driver.loc_);
+    }
+}
+	YY_BREAK
+case 60:
+YY_RULE_SETUP
+#line 643 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_LOAD_THREADS(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("load-threads", driver.loc_);
+    }
+}
+	YY_BREAK
+case 61:
+YY_RULE_SETUP
+#line 652 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_LFC_IN_PROCESS(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("lfc-in-process", driver.loc_);
+    }
+}
+	YY_BREAK
+case 62:
+YY_RULE_SETUP
+#line 661 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_LFC_BATCH_SIZE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("lfc-batch-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 63:
+YY_RULE_SETUP
+#line 670 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_LFC_BATCH_INTERVAL(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("lfc-batch-interval", driver.loc_);
+    }
+}
+	YY_BREAK
+case 64:
+YY_RULE_SETUP
+#line 679 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_LFC_SNAPSHOT_FORMAT(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("lfc-snapshot-format", driver.loc_);
+    }
+}
+	YY_BREAK
+case 65:
+YY_RULE_SETUP
+#line 688 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::HOSTS_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_CACHE_SIZE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("cache-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 66:
+YY_RULE_SETUP
+#line 697 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::HOSTS_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_CACHE_TTL(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("cache-ttl", driver.loc_);
+    }
+}
+	YY_BREAK
+case 67:
+YY_RULE_SETUP
+#line 706 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::HOSTS_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_CACHE_NEGATIVE_TTL(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("cache-negative-ttl", driver.loc_);
+    }
+}
+	YY_BREAK
+case 68:
+YY_RULE_SETUP
+#line 715 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+    case isc::dhcp::Parser6Context::HOSTS_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_CONNECTION_POOL_SIZE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("connection-pool-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 69:
+YY_RULE_SETUP
+#line 725 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+    case isc::dhcp::Parser6Context::HOSTS_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_RECONNECT_WAIT_TIME(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("reconnect-wait-time", driver.loc_);
+    }
+}
+	YY_BREAK
+case 70:
+YY_RULE_SETUP
+#line 735 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2717,9 +3056,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 57:
+case 71:
 YY_RULE_SETUP
-#line 618 "dhcp6_lexer.ll"
+#line 746 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2731,9 +3070,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 58:
+case 72:
 YY_RULE_SETUP
-#line 629 "dhcp6_lexer.ll"
+#line 757 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2745,9 +3084,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 59:
+case 73:
 YY_RULE_SETUP
-#line 640 "dhcp6_lexer.ll"
+#line 768 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2759,9 +3098,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 60:
+case 74:
 YY_RULE_SETUP
-#line 651 "dhcp6_lexer.ll"
+#line 779 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2771,9 +3110,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 61:
+case 75:
 YY_RULE_SETUP
-#line 660 "dhcp6_lexer.ll"
+#line 788 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2784,9 +3123,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 62:
+case 76:
 YY_RULE_SETUP
-#line 670 "dhcp6_lexer.ll"
+#line 798 "dhcp6_lexer.ll"
 {
     switch (driver.ctx_) {
     case Parser6Context::DHCP6:
@@ -2796,9 +3135,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 63:
+case 77:
 YY_RULE_SETUP
-#line 679 "dhcp6_lexer.ll"
+#line 807 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2808,9 +3147,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 64:
+case 78:
 YY_RULE_SETUP
-#line 688 "dhcp6_lexer.ll"
+#line 816 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2827,9 +3166,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 65:
+case 79:
 YY_RULE_SETUP
-#line 704 "dhcp6_lexer.ll"
+#line 832 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2846,9 +3185,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 66:
+case 80:
 YY_RULE_SETUP
-#line 720 "dhcp6_lexer.ll"
+#line 848 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DATA:
@@ -2858,9 +3197,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 67:
+case 81:
 YY_RULE_SETUP
-#line 729 "dhcp6_lexer.ll"
+#line 857 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DATA:
@@ -2870,9 +3209,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 68:
+case 82:
 YY_RULE_SETUP
-#line 738 "dhcp6_lexer.ll"
+#line 866 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -2882,9 +3221,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 69:
+case 83:
 YY_RULE_SETUP
-#line 747 "dhcp6_lexer.ll"
+#line 875 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -2894,9 +3233,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 70:
+case 84:
 YY_RULE_SETUP
-#line 756 "dhcp6_lexer.ll"
+#line 884 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -2906,9 +3245,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 71:
+case 85:
 YY_RULE_SETUP
-#line 765 "dhcp6_lexer.ll"
+#line 893 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -2918,9 +3257,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 72:
+case 86:
 YY_RULE_SETUP
-#line 774 "dhcp6_lexer.ll"
+#line 902 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -2930,9 +3269,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 73:
+case 87:
 YY_RULE_SETUP
-#line 783 "dhcp6_lexer.ll"
+#line 911 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -2942,9 +3281,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 74:
+case 88:
 YY_RULE_SETUP
-#line 792 "dhcp6_lexer.ll"
+#line 920 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -2954,9 +3293,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 75:
+case 89:
 YY_RULE_SETUP
-#line 801 "dhcp6_lexer.ll"
+#line 929 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::POOLS:
@@ -2966,9 +3305,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 76:
+case 90:
 YY_RULE_SETUP
-#line 810 "dhcp6_lexer.ll"
+#line 938 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::POOLS:
@@ -2980,9 +3319,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 77:
+case 91:
 YY_RULE_SETUP
-#line 821 "dhcp6_lexer.ll"
+#line 949 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -2992,9 +3331,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 78:
+case 92:
 YY_RULE_SETUP
-#line 830 "dhcp6_lexer.ll"
+#line 958 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3005,9 +3344,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 79:
+case 93:
 YY_RULE_SETUP
-#line 840 "dhcp6_lexer.ll"
+#line 968 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3018,9 +3357,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 80:
+case 94:
 YY_RULE_SETUP
-#line 850 "dhcp6_lexer.ll"
+#line 978 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3030,9 +3369,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 81:
+case 95:
 YY_RULE_SETUP
-#line 859 "dhcp6_lexer.ll"
+#line 987 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3043,9 +3382,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 82:
+case 96:
 YY_RULE_SETUP
-#line 869 "dhcp6_lexer.ll"
+#line 997 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3056,9 +3395,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 83:
+case 97:
 YY_RULE_SETUP
-#line 879 "dhcp6_lexer.ll"
+#line 1007 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATION_MODE:
@@ -3068,9 +3407,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 84:
+case 98:
 YY_RULE_SETUP
-#line 888 "dhcp6_lexer.ll"
+#line 1016 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATION_MODE:
@@ -3080,9 +3419,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 85:
+case 99:
 YY_RULE_SETUP
-#line 897 "dhcp6_lexer.ll"
+#line 1025 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATION_MODE:
@@ -3092,9 +3431,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 86:
+case 100:
 YY_RULE_SETUP
-#line 906 "dhcp6_lexer.ll"
+#line 1034 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATION_MODE:
@@ -3104,9 +3443,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 87:
+case 101:
 YY_RULE_SETUP
-#line 915 "dhcp6_lexer.ll"
+#line 1043 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -3117,9 +3456,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 88:
+case 102:
 YY_RULE_SETUP
-#line 925 "dhcp6_lexer.ll"
+#line 1053 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3129,9 +3468,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 89:
+case 103:
 YY_RULE_SETUP
-#line 934 "dhcp6_lexer.ll"
+#line 1062 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3141,9 +3480,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 90:
+case 104:
 YY_RULE_SETUP
-#line 943 "dhcp6_lexer.ll"
+#line 1071 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3153,9 +3492,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 91:
+case 105:
 YY_RULE_SETUP
-#line 952 "dhcp6_lexer.ll"
+#line 1080 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -3165,9 +3504,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 92:
+case 106:
 YY_RULE_SETUP
-#line 961 "dhcp6_lexer.ll"
+#line 1089 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGING:
@@ -3177,9 +3516,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 93:
+case 107:
 YY_RULE_SETUP
-#line 970 "dhcp6_lexer.ll"
+#line 1098 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGERS:
@@ -3189,9 +3528,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 94:
+case 108:
 YY_RULE_SETUP
-#line 979 "dhcp6_lexer.ll"
+#line 1107 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
@@ -3201,9 +3540,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 95:
+case 109:
 YY_RULE_SETUP
-#line 988 "dhcp6_lexer.ll"
+#line 1116 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
@@ -3213,9 +3552,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 96:
+case 110:
 YY_RULE_SETUP
-#line 997 "dhcp6_lexer.ll"
+#line 1125 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
@@ -3225,9 +3564,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 97:
+case 111:
 YY_RULE_SETUP
-#line 1006 "dhcp6_lexer.ll"
+#line 1134 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
@@ -3237,9 +3576,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 98:
+case 112:
 YY_RULE_SETUP
-#line 1016 "dhcp6_lexer.ll"
+#line 1144 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGERS:
@@ -3249,9 +3588,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 99:
+case 113:
 YY_RULE_SETUP
-#line 1025 "dhcp6_lexer.ll"
+#line 1153 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGERS:
@@ -3261,9 +3600,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 100:
+case 114:
 YY_RULE_SETUP
-#line 1034 "dhcp6_lexer.ll"
+#line 1162 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3274,9 +3613,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 101:
+case 115:
 YY_RULE_SETUP
-#line 1044 "dhcp6_lexer.ll"
+#line 1172 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3288,9 +3627,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 102:
+case 116:
 YY_RULE_SETUP
-#line 1055 "dhcp6_lexer.ll"
+#line 1183 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CLIENT_CLASSES:
@@ -3301,9 +3640,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 103:
+case 117:
 YY_RULE_SETUP
-#line 1065 "dhcp6_lexer.ll"
+#line 1193 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3313,9 +3652,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 104:
+case 118:
 YY_RULE_SETUP
-#line 1074 "dhcp6_lexer.ll"
+#line 1202 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATIONS:
@@ -3325,9 +3664,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 105:
+case 119:
 YY_RULE_SETUP
-#line 1083 "dhcp6_lexer.ll"
+#line 1211 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATIONS:
@@ -3337,9 +3676,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 106:
+case 120:
 YY_RULE_SETUP
-#line 1092 "dhcp6_lexer.ll"
+#line 1220 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::MAC_SOURCES:
@@ -3351,9 +3690,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 107:
+case 121:
 YY_RULE_SETUP
-#line 1103 "dhcp6_lexer.ll"
+#line 1231 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3364,9 +3703,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 108:
+case 122:
 YY_RULE_SETUP
-#line 1113 "dhcp6_lexer.ll"
+#line 1241 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATIONS:
@@ -3376,9 +3715,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 109:
+case 123:
 YY_RULE_SETUP
-#line 1122 "dhcp6_lexer.ll"
+#line 1250 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3389,9 +3728,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 110:
+case 124:
 YY_RULE_SETUP
-#line 1132 "dhcp6_lexer.ll"
+#line 1260 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -3402,9 +3741,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 111:
+case 125:
 YY_RULE_SETUP
-#line 1142 "dhcp6_lexer.ll"
+#line 1270 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DATA:
@@ -3414,9 +3753,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 112:
+case 126:
 YY_RULE_SETUP
-#line 1151 "dhcp6_lexer.ll"
+#line 1279 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -3426,9 +3765,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 113:
+case 127:
 YY_RULE_SETUP
-#line 1160 "dhcp6_lexer.ll"
+#line 1288 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -3438,9 +3777,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 114:
+case 128:
 YY_RULE_SETUP
-#line 1169 "dhcp6_lexer.ll"
+#line 1297 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -3450,9 +3789,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 115:
+case 129:
 YY_RULE_SETUP
-#line 1178 "dhcp6_lexer.ll"
+#line 1306 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3463,9 +3802,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 116:
+case 130:
 YY_RULE_SETUP
-#line 1188 "dhcp6_lexer.ll"
+#line 1316 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RELAY:
@@ -3475,9 +3814,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 117:
+case 131:
 YY_RULE_SETUP
-#line 1197 "dhcp6_lexer.ll"
+#line 1325 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3487,9 +3826,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 118:
+case 132:
 YY_RULE_SETUP
-#line 1207 "dhcp6_lexer.ll"
+#line 1335 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOOKS_LIBRARIES:
@@ -3499,9 +3838,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 119:
+case 133:
 YY_RULE_SETUP
-#line 1216 "dhcp6_lexer.ll"
+#line 1344 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOOKS_LIBRARIES:
@@ -3511,9 +3850,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 120:
+case 134:
 YY_RULE_SETUP
-#line 1225 "dhcp6_lexer.ll"
+#line 1353 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3523,9 +3862,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 121:
+case 135:
 YY_RULE_SETUP
-#line 1234 "dhcp6_lexer.ll"
+#line 1362 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DUID_TYPE:
@@ -3535,9 +3874,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 122:
+case 136:
 YY_RULE_SETUP
-#line 1243 "dhcp6_lexer.ll"
+#line 1371 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DUID_TYPE:
@@ -3547,9 +3886,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 123:
+case 137:
 YY_RULE_SETUP
-#line 1252 "dhcp6_lexer.ll"
+#line 1380 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DUID_TYPE:
@@ -3559,9 +3898,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 124:
+case 138:
 YY_RULE_SETUP
-#line 1261 "dhcp6_lexer.ll"
+#line 1389 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -3571,9 +3910,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 125:
+case 139:
 YY_RULE_SETUP
-#line 1270 "dhcp6_lexer.ll"
+#line 1398 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -3583,9 +3922,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 126:
+case 140:
 YY_RULE_SETUP
-#line 1279 "dhcp6_lexer.ll"
+#line 1407 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -3595,9 +3934,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 127:
+case 141:
 YY_RULE_SETUP
-#line 1288 "dhcp6_lexer.ll"
+#line 1416 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -3607,9 +3946,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 128:
+case 142:
 YY_RULE_SETUP
-#line 1297 "dhcp6_lexer.ll"
+#line 1425 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3619,9 +3958,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 129:
+case 143:
 YY_RULE_SETUP
-#line 1306 "dhcp6_lexer.ll"
+#line 1434 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -3631,9 +3970,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 130:
+case 144:
 YY_RULE_SETUP
-#line 1315 "dhcp6_lexer.ll"
+#line 1443 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -3643,9 +3982,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 131:
+case 145:
 YY_RULE_SETUP
-#line 1324 "dhcp6_lexer.ll"
+#line 1452 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -3655,9 +3994,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 132:
+case 146:
 YY_RULE_SETUP
-#line 1333 "dhcp6_lexer.ll"
+#line 1461 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -3667,9 +4006,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 133:
+case 147:
 YY_RULE_SETUP
-#line 1342 "dhcp6_lexer.ll"
+#line 1470 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -3679,9 +4018,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 134:
+case 148:
 YY_RULE_SETUP
-#line 1351 "dhcp6_lexer.ll"
+#line 1479 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -3691,9 +4030,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 135:
+case 149:
 YY_RULE_SETUP
-#line 1360 "dhcp6_lexer.ll"
+#line 1488 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3703,9 +4042,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 136:
+case 150:
 YY_RULE_SETUP
-#line 1369 "dhcp6_lexer.ll"
+#line 1497 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3715,9 +4054,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 137:
+case 151:
 YY_RULE_SETUP
-#line 1378 "dhcp6_lexer.ll"
+#line 1506 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONTROL_SOCKET:
@@ -3727,9 +4066,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 138:
+case 152:
 YY_RULE_SETUP
-#line 1387 "dhcp6_lexer.ll"
+#line 1515 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONTROL_SOCKET:
@@ -3739,9 +4078,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 139:
+case 153:
 YY_RULE_SETUP
-#line 1396 "dhcp6_lexer.ll"
+#line 1524 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3751,9 +4090,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 140:
+case 154:
 YY_RULE_SETUP
-#line 1405 "dhcp6_lexer.ll"
+#line 1533 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -3763,9 +4102,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 141:
+case 155:
 YY_RULE_SETUP
-#line 1414 "dhcp6_lexer.ll"
+#line 1542 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -3775,9 +4114,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 142:
+case 156:
 YY_RULE_SETUP
-#line 1423 "dhcp6_lexer.ll"
+#line 1551 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -3787,9 +4126,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 143:
+case 157:
 YY_RULE_SETUP
-#line 1433 "dhcp6_lexer.ll"
+#line 1561 "dhcp6_lexer.ll"
 {
     /* A string has been matched. It contains the actual string and single quotes.
        We need to get those quotes out of the way and just use its content, e.g.
@@ -3888,65 +4227,65 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 144:
-/* rule 144 can match eol */
+case 158:
+/* rule 158 can match eol */
 YY_RULE_SETUP
-#line 1531 "dhcp6_lexer.ll"
+#line 1659 "dhcp6_lexer.ll"
 {
     /* Bad string with a forbidden control character inside */
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
 }
 	YY_BREAK
-case 145:
-/* rule 145 can match eol */
+case 159:
+/* rule 159 can match eol */
 YY_RULE_SETUP
-#line 1536 "dhcp6_lexer.ll"
+#line 1664 "dhcp6_lexer.ll"
 {
     /* Bad string with a bad escape inside */
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 146:
+case 160:
 YY_RULE_SETUP
-#line 1541 "dhcp6_lexer.ll"
+#line 1669 "dhcp6_lexer.ll"
 {
     /* Bad string with an open escape at the end */
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 147:
+case 161:
 YY_RULE_SETUP
-#line 1546 "dhcp6_lexer.ll"
+#line 1674 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 148:
+case 162:
 YY_RULE_SETUP
-#line 1547 "dhcp6_lexer.ll"
+#line 1675 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 149:
+case 163:
 YY_RULE_SETUP
-#line 1548 "dhcp6_lexer.ll"
+#line 1676 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 150:
+case 164:
 YY_RULE_SETUP
-#line 1549 "dhcp6_lexer.ll"
+#line 1677 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 151:
+case 165:
 YY_RULE_SETUP
-#line 1550 "dhcp6_lexer.ll"
+#line 1678 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 152:
+case 166:
 YY_RULE_SETUP
-#line 1551 "dhcp6_lexer.ll"
+#line 1679 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 153:
+case 167:
 YY_RULE_SETUP
-#line 1553 "dhcp6_lexer.ll"
+#line 1681 "dhcp6_lexer.ll"
 {
     /* An integer was found. */
     std::string tmp(yytext);
@@ -3965,9 +4304,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 154:
+case 168:
 YY_RULE_SETUP
-#line 1571 "dhcp6_lexer.ll"
+#line 1699 "dhcp6_lexer.ll"
 {
     /* A floating point was found. */
     std::string tmp(yytext);
@@ -3981,43 +4320,43 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 155:
+case 169:
 YY_RULE_SETUP
-#line 1584 "dhcp6_lexer.ll"
+#line 1712 "dhcp6_lexer.ll"
 {
     string tmp(yytext);
     return isc::dhcp::Dhcp6Parser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 156:
+case 170:
 YY_RULE_SETUP
-#line 1589 "dhcp6_lexer.ll"
+#line 1717 "dhcp6_lexer.ll"
 {
    return isc::dhcp::Dhcp6Parser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 157:
+case 171:
 YY_RULE_SETUP
-#line 1593 "dhcp6_lexer.ll"
+#line 1721 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 158:
+case 172:
 YY_RULE_SETUP
-#line 1595 "dhcp6_lexer.ll"
+#line 1723 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 159:
+case 173:
 YY_RULE_SETUP
-#line 1597 "dhcp6_lexer.ll"
+#line 1725 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 160:
+case 174:
 YY_RULE_SETUP
-#line 1599 "dhcp6_lexer.ll"
+#line 1727 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 1601 "dhcp6_lexer.ll"
+#line 1729 "dhcp6_lexer.ll"
 {
     if (driver.states_.empty()) {
         return isc::dhcp::Dhcp6Parser::make_END(driver.loc_);
@@ -4041,12 +4380,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 161:
+case 175:
 YY_RULE_SETUP
-#line 1624 "dhcp6_lexer.ll"
+#line 1752 "dhcp6_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 4049 "dhcp6_lexer.cc"
+#line 4388 "dhcp6_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -4365,7 +4704,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 1266 )
+			if ( yy_current_state >= 1411 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -4398,11 +4737,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 1266 )
+		if ( yy_current_state >= 1411 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 1265);
+	yy_is_jam = (yy_current_state == 1410);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -5151,8 +5490,7 @@ void yyfree (void * ptr )
 
 /* %ok-for-header */
 
-#line 1624 "dhcp6_lexer.ll"
-
+#line 1752 "dhcp6_lexer.ll"
 
 using namespace isc::dhcp;
 
@@ -5254,4 +5592,3 @@ class Dummy {
 };
 }
 #endif /* !__clang_analyzer__ */
-
@@ -253,29 +253,29 @@ namespace isc { namespace dhcp {
   {
       switch (that.type_get ())
     {
-      case 170: // value
-      case 174: // map_value
-      case 218: // db_type
-      case 294: // hr_mode
-      case 425: // duid_type
-      case 458: // ncr_protocol_value
-      case 466: // replace_client_name_value
+      case 184: // value
+      case 188: // map_value
+      case 232: // db_type
+      case 323: // hr_mode
+      case 454: // duid_type
+      case 487: // ncr_protocol_value
+      case 495: // replace_client_name_value
         value.move< ElementPtr > (that.value);
         break;
 
-      case 154: // "boolean"
+      case 168: // "boolean"
         value.move< bool > (that.value);
         break;
 
-      case 153: // "floating point"
+      case 167: // "floating point"
         value.move< double > (that.value);
         break;
 
-      case 152: // "integer"
+      case 166: // "integer"
         value.move< int64_t > (that.value);
         break;
 
-      case 151: // "constant string"
+      case 165: // "constant string"
         value.move< std::string > (that.value);
         break;
 
@@ -294,29 +294,29 @@ namespace isc { namespace dhcp {
     state = that.state;
       switch (that.type_get ())
     {
-      case 170: // value
-      case 174: // map_value
-      case 218: // db_type
-      case 294: // hr_mode
-      case 425: // duid_type
-      case 458: // ncr_protocol_value
-      case 466: // replace_client_name_value
+      case 184: // value
+      case 188: // map_value
+      case 232: // db_type
+      case 323: // hr_mode
+      case 454: // duid_type
+      case 487: // ncr_protocol_value
+      case 495: // replace_client_name_value
         value.copy< ElementPtr > (that.value);
         break;
 
-      case 154: // "boolean"
+      case 168: // "boolean"
         value.copy< bool > (that.value);
         break;
 
-      case 153: // "floating point"
+      case 167: // "floating point"
         value.copy< double > (that.value);
         break;
 
-      case 152: // "integer"
+      case 166: // "integer"
         value.copy< int64_t > (that.value);
         break;
 
-      case 151: // "constant string"
+      case 165: // "constant string"
         value.copy< std::string > (that.value);
         break;
 
@@ -356,79 +356,79 @@ namespace isc { namespace dhcp {
         << yysym.location << ": ";
     switch (yytype)
     {
-            case 151: // "constant string"
+            case 165: // "constant string"
 
-#line 227 "dhcp6_parser.yy" // lalr1.cc:636
+#line 241 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< std::string > (); }
 #line 364 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 152: // "integer"
+      case 166: // "integer"
 
-#line 227 "dhcp6_parser.yy" // lalr1.cc:636
+#line 241 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< int64_t > (); }
 #line 371 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 153: // "floating point"
+      case 167: // "floating point"
 
-#line 227 "dhcp6_parser.yy" // lalr1.cc:636
+#line 241 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< double > (); }
 #line 378 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 154: // "boolean"
+      case 168: // "boolean"
 
-#line 227 "dhcp6_parser.yy" // lalr1.cc:636
+#line 241 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< bool > (); }
 #line 385 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 170: // value
+      case 184: // value
 
-#line 227 "dhcp6_parser.yy" // lalr1.cc:636
+#line 241 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 392 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 174: // map_value
+      case 188: // map_value
 
-#line 227 "dhcp6_parser.yy" // lalr1.cc:636
+#line 241 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 399 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 218: // db_type
+      case 232: // db_type
 
-#line 227 "dhcp6_parser.yy" // lalr1.cc:636
+#line 241 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 406 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 294: // hr_mode
+      case 323: // hr_mode
 
-#line 227 "dhcp6_parser.yy" // lalr1.cc:636
+#line 241 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 413 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 425: // duid_type
+      case 454: // duid_type
 
-#line 227 "dhcp6_parser.yy" // lalr1.cc:636
+#line 241 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 420 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 458: // ncr_protocol_value
+      case 487: // ncr_protocol_value
 
-#line 227 "dhcp6_parser.yy" // lalr1.cc:636
+#line 241 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 427 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 466: // replace_client_name_value
+      case 495: // replace_client_name_value
 
-#line 227 "dhcp6_parser.yy" // lalr1.cc:636
+#line 241 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 434 "dhcp6_parser.cc" // lalr1.cc:636
         break;
@@ -630,29 +630,29 @@ namespace isc { namespace dhcp {
          when using variants.  */
         switch (yyr1_[yyn])
     {
-      case 170: // value
-      case 174: // map_value
-      case 218: // db_type
-      case 294: // hr_mode
-      case 425: // duid_type
-      case 458: // ncr_protocol_value
-      case 466: // replace_client_name_value
+      case 184: // value
+      case 188: // map_value
+      case 232: // db_type
+      case 323: // hr_mode
+      case 454: // duid_type
+      case 487: // ncr_protocol_value
+      case 495: // replace_client_name_value
         yylhs.value.build< ElementPtr > ();
         break;
 
-      case 154: // "boolean"
+      case 168: // "boolean"
         yylhs.value.build< bool > ();
         break;
 
-      case 153: // "floating point"
+      case 167: // "floating point"
         yylhs.value.build< double > ();
         break;
 
-      case 152: // "integer"
+      case 166: // "integer"
         yylhs.value.build< int64_t > ();
         break;
 
-      case 151: // "constant string"
+      case 165: // "constant string"
         yylhs.value.build< std::string > ();
         break;
 
@@ -674,127 +674,127 @@ namespace isc { namespace dhcp {
           switch (yyn)
             {
   case 2:
-#line 236 "dhcp6_parser.yy" // lalr1.cc:859
+#line 250 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.NO_KEYWORD; }
 #line 680 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 4:
-#line 237 "dhcp6_parser.yy" // lalr1.cc:859
+#line 251 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.CONFIG; }
 #line 686 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 6:
-#line 238 "dhcp6_parser.yy" // lalr1.cc:859
+#line 252 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.DHCP6; }
 #line 692 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 8:
-#line 239 "dhcp6_parser.yy" // lalr1.cc:859
+#line 253 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.INTERFACES_CONFIG; }
 #line 698 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 10:
-#line 240 "dhcp6_parser.yy" // lalr1.cc:859
+#line 254 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.SUBNET6; }
 #line 704 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 12:
-#line 241 "dhcp6_parser.yy" // lalr1.cc:859
+#line 255 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.POOLS; }
 #line 710 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 14:
-#line 242 "dhcp6_parser.yy" // lalr1.cc:859
+#line 256 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.PD_POOLS; }
 #line 716 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 16:
-#line 243 "dhcp6_parser.yy" // lalr1.cc:859
+#line 257 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.RESERVATIONS; }
 #line 722 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 18:
-#line 244 "dhcp6_parser.yy" // lalr1.cc:859
+#line 258 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.DHCP6; }
 #line 728 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 20:
-#line 245 "dhcp6_parser.yy" // lalr1.cc:859
+#line 259 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.OPTION_DEF; }
 #line 734 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 22:
-#line 246 "dhcp6_parser.yy" // lalr1.cc:859
+#line 260 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.OPTION_DATA; }
 #line 740 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 24:
-#line 247 "dhcp6_parser.yy" // lalr1.cc:859
+#line 261 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.HOOKS_LIBRARIES; }
 #line 746 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 26:
-#line 248 "dhcp6_parser.yy" // lalr1.cc:859
+#line 262 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.DHCP_DDNS; }
 #line 752 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 28:
-#line 256 "dhcp6_parser.yy" // lalr1.cc:859
+#line 270 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location))); }
 #line 758 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 29:
-#line 257 "dhcp6_parser.yy" // lalr1.cc:859
+#line 271 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as< double > (), ctx.loc2pos(yystack_[0].location))); }
 #line 764 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 30:
-#line 258 "dhcp6_parser.yy" // lalr1.cc:859
+#line 272 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location))); }
 #line 770 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 31:
-#line 259 "dhcp6_parser.yy" // lalr1.cc:859
+#line 273 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location))); }
 #line 776 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 32:
-#line 260 "dhcp6_parser.yy" // lalr1.cc:859
+#line 274 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
 #line 782 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 33:
-#line 261 "dhcp6_parser.yy" // lalr1.cc:859
+#line 275 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 788 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 34:
-#line 262 "dhcp6_parser.yy" // lalr1.cc:859
+#line 276 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 794 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 35:
-#line 265 "dhcp6_parser.yy" // lalr1.cc:859
+#line 279 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Push back the JSON value on the stack
     ctx.stack_.push_back(yystack_[0].value.as< ElementPtr > ());
@@ -803,7 +803,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 36:
-#line 270 "dhcp6_parser.yy" // lalr1.cc:859
+#line 284 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -814,7 +814,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 37:
-#line 275 "dhcp6_parser.yy" // lalr1.cc:859
+#line 289 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
@@ -824,13 +824,13 @@ namespace isc { namespace dhcp {
     break;
 
   case 38:
-#line 281 "dhcp6_parser.yy" // lalr1.cc:859
+#line 295 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 830 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 41:
-#line 288 "dhcp6_parser.yy" // lalr1.cc:859
+#line 302 "dhcp6_parser.yy" // lalr1.cc:859
     {
                   // map containing a single entry
                   ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
@@ -839,7 +839,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 42:
-#line 292 "dhcp6_parser.yy" // lalr1.cc:859
+#line 306 "dhcp6_parser.yy" // lalr1.cc:859
     {
                   // map consisting of a shorter map followed by
                   // comma and string:value
@@ -849,7 +849,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 43:
-#line 299 "dhcp6_parser.yy" // lalr1.cc:859
+#line 313 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
@@ -858,7 +858,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 44:
-#line 302 "dhcp6_parser.yy" // lalr1.cc:859
+#line 316 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // list parsing complete. Put any sanity checking here
 }
@@ -866,7 +866,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 47:
-#line 310 "dhcp6_parser.yy" // lalr1.cc:859
+#line 324 "dhcp6_parser.yy" // lalr1.cc:859
     {
                   // List consisting of a single element.
                   ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
@@ -875,7 +875,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 48:
-#line 314 "dhcp6_parser.yy" // lalr1.cc:859
+#line 328 "dhcp6_parser.yy" // lalr1.cc:859
     {
                   // List ending with , and a value.
                   ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
@@ -884,7 +884,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 49:
-#line 321 "dhcp6_parser.yy" // lalr1.cc:859
+#line 335 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // List parsing about to start
 }
@@ -892,7 +892,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 50:
-#line 323 "dhcp6_parser.yy" // lalr1.cc:859
+#line 337 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // list parsing complete. Put any sanity checking here
     //ctx.stack_.pop_back();
@@ -901,7 +901,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 53:
-#line 332 "dhcp6_parser.yy" // lalr1.cc:859
+#line 346 "dhcp6_parser.yy" // lalr1.cc:859
     {
                           ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
@@ -910,7 +910,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 54:
-#line 336 "dhcp6_parser.yy" // lalr1.cc:859
+#line 350 "dhcp6_parser.yy" // lalr1.cc:859
     {
                           ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
@@ -919,7 +919,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 55:
-#line 347 "dhcp6_parser.yy" // lalr1.cc:859
+#line 361 "dhcp6_parser.yy" // lalr1.cc:859
     {
     const std::string& where = ctx.contextName();
     const std::string& keyword = yystack_[1].value.as< std::string > ();
@@ -930,7 +930,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 56:
-#line 357 "dhcp6_parser.yy" // lalr1.cc:859
+#line 371 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -941,7 +941,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 57:
-#line 362 "dhcp6_parser.yy" // lalr1.cc:859
+#line 376 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
@@ -954,7 +954,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 66:
-#line 385 "dhcp6_parser.yy" // lalr1.cc:859
+#line 399 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -967,7 +967,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 67:
-#line 392 "dhcp6_parser.yy" // lalr1.cc:859
+#line 406 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // No global parameter is required
     ctx.stack_.pop_back();
@@ -977,7 +977,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 68:
-#line 400 "dhcp6_parser.yy" // lalr1.cc:859
+#line 414 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the Dhcp6 map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -987,7 +987,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 69:
-#line 404 "dhcp6_parser.yy" // lalr1.cc:859
+#line 418 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // No global parameter is required
     // parsing completed
@@ -996,7 +996,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 95:
-#line 440 "dhcp6_parser.yy" // lalr1.cc:859
+#line 454 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("preferred-lifetime", prf);
@@ -1005,7 +1005,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 96:
-#line 445 "dhcp6_parser.yy" // lalr1.cc:859
+#line 459 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("valid-lifetime", prf);
@@ -1014,7 +1014,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 97:
-#line 450 "dhcp6_parser.yy" // lalr1.cc:859
+#line 464 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("renew-timer", prf);
@@ -1023,7 +1023,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 98:
-#line 455 "dhcp6_parser.yy" // lalr1.cc:859
+#line 469 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rebind-timer", prf);
@@ -1032,7 +1032,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 99:
-#line 460 "dhcp6_parser.yy" // lalr1.cc:859
+#line 474 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr dpp(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("decline-probation-period", dpp);
@@ -1041,7 +1041,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 100:
-#line 465 "dhcp6_parser.yy" // lalr1.cc:859
+#line 479 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces-config", i);
@@ -1052,7 +1052,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 101:
-#line 470 "dhcp6_parser.yy" // lalr1.cc:859
+#line 484 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // No interfaces config param is required
     ctx.stack_.pop_back();
@@ -1062,7 +1062,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 102:
-#line 476 "dhcp6_parser.yy" // lalr1.cc:859
+#line 490 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the interfaces-config map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -1072,7 +1072,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 103:
-#line 480 "dhcp6_parser.yy" // lalr1.cc:859
+#line 494 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // No interfaces config param is required
     // parsing completed
@@ -1081,7 +1081,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 108:
-#line 493 "dhcp6_parser.yy" // lalr1.cc:859
+#line 507 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces", l);
@@ -1092,7 +1092,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 109:
-#line 498 "dhcp6_parser.yy" // lalr1.cc:859
+#line 512 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1101,7 +1101,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 110:
-#line 503 "dhcp6_parser.yy" // lalr1.cc:859
+#line 517 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("re-detect", b);
@@ -1110,7 +1110,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 111:
-#line 509 "dhcp6_parser.yy" // lalr1.cc:859
+#line 523 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lease-database", i);
@@ -1121,7 +1121,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 112:
-#line 514 "dhcp6_parser.yy" // lalr1.cc:859
+#line 528 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
@@ -1132,7 +1132,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 113:
-#line 521 "dhcp6_parser.yy" // lalr1.cc:859
+#line 535 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hosts-database", i);
@@ -1143,7 +1143,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 114:
-#line 526 "dhcp6_parser.yy" // lalr1.cc:859
+#line 540 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
@@ -1153,16 +1153,16 @@ namespace isc { namespace dhcp {
 #line 1154 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 130:
-#line 552 "dhcp6_parser.yy" // lalr1.cc:859
+  case 144:
+#line 580 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.DATABASE_TYPE);
 }
 #line 1162 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 131:
-#line 554 "dhcp6_parser.yy" // lalr1.cc:859
+  case 145:
+#line 582 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("type", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
@@ -1170,40 +1170,40 @@ namespace isc { namespace dhcp {
 #line 1171 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 132:
-#line 559 "dhcp6_parser.yy" // lalr1.cc:859
+  case 146:
+#line 587 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("memfile", ctx.loc2pos(yystack_[0].location))); }
 #line 1177 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 133:
-#line 560 "dhcp6_parser.yy" // lalr1.cc:859
+  case 147:
+#line 588 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("mysql", ctx.loc2pos(yystack_[0].location))); }
 #line 1183 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 134:
-#line 561 "dhcp6_parser.yy" // lalr1.cc:859
+  case 148:
+#line 589 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("postgresql", ctx.loc2pos(yystack_[0].location))); }
 #line 1189 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 135:
-#line 562 "dhcp6_parser.yy" // lalr1.cc:859
+  case 149:
+#line 590 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("cql", ctx.loc2pos(yystack_[0].location))); }
 #line 1195 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 136:
-#line 565 "dhcp6_parser.yy" // lalr1.cc:859
+  case 150:
+#line 593 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1203 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 137:
-#line 567 "dhcp6_parser.yy" // lalr1.cc:859
+  case 151:
+#line 595 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr user(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("user", user);
@@ -1212,16 +1212,16 @@ namespace isc { namespace dhcp {
 #line 1213 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 138:
-#line 573 "dhcp6_parser.yy" // lalr1.cc:859
+  case 152:
+#line 601 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1221 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 139:
-#line 575 "dhcp6_parser.yy" // lalr1.cc:859
+  case 153:
+#line 603 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr pwd(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("password", pwd);
@@ -1230,16 +1230,16 @@ namespace isc { namespace dhcp {
 #line 1231 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 140:
-#line 581 "dhcp6_parser.yy" // lalr1.cc:859
+  case 154:
+#line 609 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1239 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 141:
-#line 583 "dhcp6_parser.yy" // lalr1.cc:859
+  case 155:
+#line 611 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr h(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host", h);
@@ -1248,8 +1248,8 @@ namespace isc { namespace dhcp {
 #line 1249 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 142:
-#line 589 "dhcp6_parser.yy" // lalr1.cc:859
+  case 156:
+#line 617 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr p(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("port", p);
@@ -1257,16 +1257,16 @@ namespace isc { namespace dhcp {
 #line 1258 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 143:
-#line 594 "dhcp6_parser.yy" // lalr1.cc:859
+  case 157:
+#line 622 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1266 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 144:
-#line 596 "dhcp6_parser.yy" // lalr1.cc:859
+  case 158:
+#line 624 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
@@ -1275,8 +1275,8 @@ namespace isc { namespace dhcp {
 #line 1276 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 145:
-#line 602 "dhcp6_parser.yy" // lalr1.cc:859
+  case 159:
+#line 630 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("persist", n);
@@ -1284,8 +1284,8 @@ namespace isc { namespace dhcp {
 #line 1285 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 146:
-#line 607 "dhcp6_parser.yy" // lalr1.cc:859
+  case 160:
+#line 635 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lfc-interval", n);
@@ -1293,8 +1293,8 @@ namespace isc { namespace dhcp {
 #line 1294 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 147:
-#line 612 "dhcp6_parser.yy" // lalr1.cc:859
+  case 161:
+#line 640 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("readonly", n);
@@ -1302,8 +1302,8 @@ namespace isc { namespace dhcp {
 #line 1303 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 148:
-#line 617 "dhcp6_parser.yy" // lalr1.cc:859
+  case 162:
+#line 645 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("connect-timeout", n);
@@ -1311,16 +1311,16 @@ namespace isc { namespace dhcp {
 #line 1312 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 149:
-#line 622 "dhcp6_parser.yy" // lalr1.cc:859
+  case 163:
+#line 650 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1320 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 150:
-#line 624 "dhcp6_parser.yy" // lalr1.cc:859
+  case 164:
+#line 652 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr cp(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("contact-points", cp);
@@ -1329,16 +1329,16 @@ namespace isc { namespace dhcp {
 #line 1330 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 151:
-#line 630 "dhcp6_parser.yy" // lalr1.cc:859
+  case 165:
+#line 658 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1338 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 152:
-#line 632 "dhcp6_parser.yy" // lalr1.cc:859
+  case 166:
+#line 660 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr ks(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("keyspace", ks);
@@ -1347,304 +1347,439 @@ namespace isc { namespace dhcp {
 #line 1348 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 153:
-#line 639 "dhcp6_parser.yy" // lalr1.cc:859
+  case 167:
+#line 666 "dhcp6_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("group-commit", n);
+}
+#line 1357 "dhcp6_parser.cc" // lalr1.cc:859
+    break;
+
+  case 168:
+#line 671 "dhcp6_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("group-commit-sync", n);
+}
+#line 1366 "dhcp6_parser.cc" // lalr1.cc:859
+    break;
+
+  case 169:
+#line 676 "dhcp6_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("group-commit-max-batch", n);
+}
+#line 1375 "dhcp6_parser.cc" // lalr1.cc:859
+    break;
+
+  case 170:
+#line 681 "dhcp6_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("group-commit-max-latency", n);
+}
+#line 1384 "dhcp6_parser.cc" // lalr1.cc:859
+    break;
+
+  case 171:
+#line 686 "dhcp6_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("load-threads", n);
+}
+#line 1393 "dhcp6_parser.cc" // lalr1.cc:859
+    break;
+
+  case 172:
+#line 691 "dhcp6_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("lfc-in-process", n);
+}
+#line 1402 "dhcp6_parser.cc" // lalr1.cc:859
+    break;
+
+  case 173:
+#line 696 "dhcp6_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("lfc-batch-size", n);
+}
+#line 1411 "dhcp6_parser.cc" // lalr1.cc:859
+    break;
+
+  case 174:
+#line 701 "dhcp6_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("lfc-batch-interval", n);
+}
+#line 1420 "dhcp6_parser.cc" // lalr1.cc:859
+    break;
+
+  case 175:
+#line 706 "dhcp6_parser.yy" // lalr1.cc:859
+    {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 1428 "dhcp6_parser.cc" // lalr1.cc:859
+    break;
+
+  case 176:
+#line 708 "dhcp6_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("lfc-snapshot-format", s);
+    ctx.leave();
+}
+#line 1438 "dhcp6_parser.cc" // lalr1.cc:859
+    break;
+
+  case 177:
+#line 714 "dhcp6_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("cache-size", n);
+}
+#line 1447 "dhcp6_parser.cc" // lalr1.cc:859
+    break;
+
+  case 178:
+#line 719 "dhcp6_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("cache-ttl", n);
+}
+#line 1456 "dhcp6_parser.cc" // lalr1.cc:859
+    break;
+
+  case 179:
+#line 724 "dhcp6_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("cache-negative-ttl", n);
+}
+#line 1465 "dhcp6_parser.cc" // lalr1.cc:859
+    break;
+
+  case 180:
+#line 729 "dhcp6_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("connection-pool-size", n);
+}
+#line 1474 "dhcp6_parser.cc" // lalr1.cc:859
+    break;
+
+  case 181:
+#line 734 "dhcp6_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("reconnect-wait-time", n);
+}
+#line 1483 "dhcp6_parser.cc" // lalr1.cc:859
+    break;
+
+  case 182:
+#line 740 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("mac-sources", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.MAC_SOURCES);
 }
-#line 1359 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1494 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 154:
-#line 644 "dhcp6_parser.yy" // lalr1.cc:859
+  case 183:
+#line 745 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1368 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1503 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 159:
-#line 657 "dhcp6_parser.yy" // lalr1.cc:859
+  case 188:
+#line 758 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr duid(new StringElement("duid", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(duid);
 }
-#line 1377 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1512 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 160:
-#line 662 "dhcp6_parser.yy" // lalr1.cc:859
+  case 189:
+#line 763 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr duid(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(duid);
 }
-#line 1386 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1521 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 161:
-#line 667 "dhcp6_parser.yy" // lalr1.cc:859
+  case 190:
+#line 768 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host-reservation-identifiers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOST_RESERVATION_IDENTIFIERS);
 }
-#line 1397 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1532 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 162:
-#line 672 "dhcp6_parser.yy" // lalr1.cc:859
+  case 191:
+#line 773 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1406 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1541 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 168:
-#line 686 "dhcp6_parser.yy" // lalr1.cc:859
+  case 197:
+#line 787 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr hwaddr(new StringElement("hw-address", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(hwaddr);
 }
-#line 1415 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1550 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 169:
-#line 691 "dhcp6_parser.yy" // lalr1.cc:859
+  case 198:
+#line 792 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr flex_id(new StringElement("flex-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(flex_id);
 }
-#line 1424 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1559 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 170:
-#line 698 "dhcp6_parser.yy" // lalr1.cc:859
+  case 199:
+#line 799 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("relay-supplied-options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1435 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1570 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 171:
-#line 703 "dhcp6_parser.yy" // lalr1.cc:859
+  case 200:
+#line 804 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1444 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1579 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 172:
-#line 708 "dhcp6_parser.yy" // lalr1.cc:859
+  case 201:
+#line 809 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hooks-libraries", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOOKS_LIBRARIES);
 }
-#line 1455 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1590 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 173:
-#line 713 "dhcp6_parser.yy" // lalr1.cc:859
+  case 202:
+#line 814 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1464 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1599 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 178:
-#line 726 "dhcp6_parser.yy" // lalr1.cc:859
+  case 207:
+#line 827 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1474 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1609 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 179:
-#line 730 "dhcp6_parser.yy" // lalr1.cc:859
+  case 208:
+#line 831 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The library hooks parameter is required
     ctx.require("library", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 1484 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1619 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 180:
-#line 736 "dhcp6_parser.yy" // lalr1.cc:859
+  case 209:
+#line 837 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the hooks-libraries list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1494 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1629 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 181:
-#line 740 "dhcp6_parser.yy" // lalr1.cc:859
+  case 210:
+#line 841 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The library hooks parameter is required
     ctx.require("library", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 1504 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1639 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 187:
-#line 755 "dhcp6_parser.yy" // lalr1.cc:859
+  case 216:
+#line 856 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1512 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1647 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 188:
-#line 757 "dhcp6_parser.yy" // lalr1.cc:859
+  case 217:
+#line 858 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr lib(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("library", lib);
     ctx.leave();
 }
-#line 1522 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1657 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 189:
-#line 763 "dhcp6_parser.yy" // lalr1.cc:859
+  case 218:
+#line 864 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1530 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1665 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 190:
-#line 765 "dhcp6_parser.yy" // lalr1.cc:859
+  case 219:
+#line 866 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("parameters", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 1539 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1674 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 191:
-#line 771 "dhcp6_parser.yy" // lalr1.cc:859
+  case 220:
+#line 872 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("expired-leases-processing", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.EXPIRED_LEASES_PROCESSING);
 }
-#line 1550 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1685 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 192:
-#line 776 "dhcp6_parser.yy" // lalr1.cc:859
+  case 221:
+#line 877 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // No expired lease parameter is required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1560 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1695 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 201:
-#line 794 "dhcp6_parser.yy" // lalr1.cc:859
+  case 230:
+#line 895 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reclaim-timer-wait-time", value);
 }
-#line 1569 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1704 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 202:
-#line 799 "dhcp6_parser.yy" // lalr1.cc:859
+  case 231:
+#line 900 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush-reclaimed-timer-wait-time", value);
 }
-#line 1578 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1713 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 203:
-#line 804 "dhcp6_parser.yy" // lalr1.cc:859
+  case 232:
+#line 905 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hold-reclaimed-time", value);
 }
-#line 1587 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1722 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 204:
-#line 809 "dhcp6_parser.yy" // lalr1.cc:859
+  case 233:
+#line 910 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-leases", value);
 }
-#line 1596 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1731 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 205:
-#line 814 "dhcp6_parser.yy" // lalr1.cc:859
+  case 234:
+#line 915 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-time", value);
 }
-#line 1605 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1740 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 206:
-#line 819 "dhcp6_parser.yy" // lalr1.cc:859
+  case 235:
+#line 920 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("unwarned-reclaim-cycles", value);
 }
-#line 1614 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1749 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 207:
-#line 827 "dhcp6_parser.yy" // lalr1.cc:859
+  case 236:
+#line 928 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet6", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.SUBNET6);
 }
-#line 1625 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1760 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 208:
-#line 832 "dhcp6_parser.yy" // lalr1.cc:859
+  case 237:
+#line 933 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1634 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1769 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 213:
-#line 852 "dhcp6_parser.yy" // lalr1.cc:859
+  case 242:
+#line 953 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1644 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1779 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 214:
-#line 856 "dhcp6_parser.yy" // lalr1.cc:859
+  case 243:
+#line 957 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Once we reached this place, the subnet parsing is now complete.
     // If we want to, we can implement default values here.
@@ -1666,241 +1801,241 @@ namespace isc { namespace dhcp {
     ctx.require("subnet", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 1670 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1805 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 215:
-#line 878 "dhcp6_parser.yy" // lalr1.cc:859
+  case 244:
+#line 979 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the subnet6 list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1680 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1815 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 216:
-#line 882 "dhcp6_parser.yy" // lalr1.cc:859
+  case 245:
+#line 983 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The subnet subnet6 parameter is required
     ctx.require("subnet", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 1690 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1825 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 237:
-#line 914 "dhcp6_parser.yy" // lalr1.cc:859
+  case 266:
+#line 1015 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1698 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1833 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 238:
-#line 916 "dhcp6_parser.yy" // lalr1.cc:859
+  case 267:
+#line 1017 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr subnet(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet", subnet);
     ctx.leave();
 }
-#line 1708 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1843 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 239:
-#line 922 "dhcp6_parser.yy" // lalr1.cc:859
+  case 268:
+#line 1023 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1716 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1851 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 240:
-#line 924 "dhcp6_parser.yy" // lalr1.cc:859
+  case 269:
+#line 1025 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface", iface);
     ctx.leave();
 }
-#line 1726 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1861 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 241:
-#line 930 "dhcp6_parser.yy" // lalr1.cc:859
+  case 270:
+#line 1031 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1734 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1869 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 242:
-#line 932 "dhcp6_parser.yy" // lalr1.cc:859
+  case 271:
+#line 1033 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface-id", iface);
     ctx.leave();
 }
-#line 1744 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1879 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 243:
-#line 938 "dhcp6_parser.yy" // lalr1.cc:859
+  case 272:
+#line 1039 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.CLIENT_CLASS);
 }
-#line 1752 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1887 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 244:
-#line 940 "dhcp6_parser.yy" // lalr1.cc:859
+  case 273:
+#line 1041 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr cls(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-class", cls);
     ctx.leave();
 }
-#line 1762 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1897 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 245:
-#line 946 "dhcp6_parser.yy" // lalr1.cc:859
+  case 274:
+#line 1047 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.RESERVATION_MODE);
 }
-#line 1770 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1905 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 246:
-#line 948 "dhcp6_parser.yy" // lalr1.cc:859
+  case 275:
+#line 1049 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("reservation-mode", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 1779 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1914 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 247:
-#line 953 "dhcp6_parser.yy" // lalr1.cc:859
+  case 276:
+#line 1054 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("disabled", ctx.loc2pos(yystack_[0].location))); }
-#line 1785 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1920 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 248:
-#line 954 "dhcp6_parser.yy" // lalr1.cc:859
+  case 277:
+#line 1055 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("out-of-pool", ctx.loc2pos(yystack_[0].location))); }
-#line 1791 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1926 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 249:
-#line 955 "dhcp6_parser.yy" // lalr1.cc:859
+  case 278:
+#line 1056 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("all", ctx.loc2pos(yystack_[0].location))); }
-#line 1797 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1932 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 250:
-#line 958 "dhcp6_parser.yy" // lalr1.cc:859
+  case 279:
+#line 1059 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr id(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("id", id);
 }
-#line 1806 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1941 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 251:
-#line 963 "dhcp6_parser.yy" // lalr1.cc:859
+  case 280:
+#line 1064 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr rc(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rapid-commit", rc);
 }
-#line 1815 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1950 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 252:
-#line 971 "dhcp6_parser.yy" // lalr1.cc:859
+  case 281:
+#line 1072 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("shared-networks", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.SHARED_NETWORK);
 }
-#line 1826 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1961 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 253:
-#line 976 "dhcp6_parser.yy" // lalr1.cc:859
+  case 282:
+#line 1077 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1835 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1970 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 258:
-#line 991 "dhcp6_parser.yy" // lalr1.cc:859
+  case 287:
+#line 1092 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1845 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1980 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 259:
-#line 995 "dhcp6_parser.yy" // lalr1.cc:859
+  case 288:
+#line 1096 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
 }
-#line 1853 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1988 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 276:
-#line 1023 "dhcp6_parser.yy" // lalr1.cc:859
+  case 305:
+#line 1124 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-def", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DEF);
 }
-#line 1864 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1999 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 277:
-#line 1028 "dhcp6_parser.yy" // lalr1.cc:859
+  case 306:
+#line 1129 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1873 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2008 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 278:
-#line 1036 "dhcp6_parser.yy" // lalr1.cc:859
+  case 307:
+#line 1137 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1882 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2017 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 279:
-#line 1039 "dhcp6_parser.yy" // lalr1.cc:859
+  case 308:
+#line 1140 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // parsing completed
 }
-#line 1890 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2025 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 284:
-#line 1055 "dhcp6_parser.yy" // lalr1.cc:859
+  case 313:
+#line 1156 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1900 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2035 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 285:
-#line 1059 "dhcp6_parser.yy" // lalr1.cc:859
+  case 314:
+#line 1160 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The name, code and type option def parameters are required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -1908,21 +2043,21 @@ namespace isc { namespace dhcp {
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 1912 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2047 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 286:
-#line 1070 "dhcp6_parser.yy" // lalr1.cc:859
+  case 315:
+#line 1171 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the option-def list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1922 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2057 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 287:
-#line 1074 "dhcp6_parser.yy" // lalr1.cc:859
+  case 316:
+#line 1175 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The name, code and type option def parameters are required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -1930,319 +2065,319 @@ namespace isc { namespace dhcp {
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 1934 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2069 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 301:
-#line 1104 "dhcp6_parser.yy" // lalr1.cc:859
+  case 330:
+#line 1205 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr code(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("code", code);
 }
-#line 1943 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2078 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 303:
-#line 1111 "dhcp6_parser.yy" // lalr1.cc:859
+  case 332:
+#line 1212 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1951 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2086 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 304:
-#line 1113 "dhcp6_parser.yy" // lalr1.cc:859
+  case 333:
+#line 1214 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("type", prf);
     ctx.leave();
 }
-#line 1961 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2096 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 305:
-#line 1119 "dhcp6_parser.yy" // lalr1.cc:859
+  case 334:
+#line 1220 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1969 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2104 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 306:
-#line 1121 "dhcp6_parser.yy" // lalr1.cc:859
+  case 335:
+#line 1222 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr rtypes(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("record-types", rtypes);
     ctx.leave();
 }
-#line 1979 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2114 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 307:
-#line 1127 "dhcp6_parser.yy" // lalr1.cc:859
+  case 336:
+#line 1228 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1987 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2122 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 308:
-#line 1129 "dhcp6_parser.yy" // lalr1.cc:859
+  case 337:
+#line 1230 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr space(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("space", space);
     ctx.leave();
 }
-#line 1997 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2132 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 310:
-#line 1137 "dhcp6_parser.yy" // lalr1.cc:859
+  case 339:
+#line 1238 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2005 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2140 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 311:
-#line 1139 "dhcp6_parser.yy" // lalr1.cc:859
+  case 340:
+#line 1240 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr encap(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("encapsulate", encap);
     ctx.leave();
 }
-#line 2015 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2150 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 312:
-#line 1145 "dhcp6_parser.yy" // lalr1.cc:859
+  case 341:
+#line 1246 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr array(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("array", array);
 }
-#line 2024 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2159 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 313:
-#line 1154 "dhcp6_parser.yy" // lalr1.cc:859
+  case 342:
+#line 1255 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-data", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DATA);
 }
-#line 2035 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2170 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 314:
-#line 1159 "dhcp6_parser.yy" // lalr1.cc:859
+  case 343:
+#line 1260 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2044 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2179 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 319:
-#line 1178 "dhcp6_parser.yy" // lalr1.cc:859
+  case 348:
+#line 1279 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2054 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2189 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 320:
-#line 1182 "dhcp6_parser.yy" // lalr1.cc:859
+  case 349:
+#line 1283 "dhcp6_parser.yy" // lalr1.cc:859
     {
     /// @todo: the code or name parameters are required.
     ctx.stack_.pop_back();
 }
-#line 2063 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2198 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 321:
-#line 1190 "dhcp6_parser.yy" // lalr1.cc:859
+  case 350:
+#line 1291 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the option-data list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2073 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2208 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 322:
-#line 1194 "dhcp6_parser.yy" // lalr1.cc:859
+  case 351:
+#line 1295 "dhcp6_parser.yy" // lalr1.cc:859
     {
     /// @todo: the code or name parameters are required.
     // parsing completed
 }
-#line 2082 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2217 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 335:
-#line 1225 "dhcp6_parser.yy" // lalr1.cc:859
+  case 364:
+#line 1326 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2090 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2225 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 336:
-#line 1227 "dhcp6_parser.yy" // lalr1.cc:859
+  case 365:
+#line 1328 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr data(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("data", data);
     ctx.leave();
 }
-#line 2100 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2235 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 339:
-#line 1237 "dhcp6_parser.yy" // lalr1.cc:859
+  case 368:
+#line 1338 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr space(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("csv-format", space);
 }
-#line 2109 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2244 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 340:
-#line 1242 "dhcp6_parser.yy" // lalr1.cc:859
+  case 369:
+#line 1343 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr persist(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("always-send", persist);
 }
-#line 2118 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2253 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 341:
-#line 1250 "dhcp6_parser.yy" // lalr1.cc:859
+  case 370:
+#line 1351 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pools", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.POOLS);
 }
-#line 2129 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2264 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 342:
-#line 1255 "dhcp6_parser.yy" // lalr1.cc:859
+  case 371:
+#line 1356 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2138 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2273 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 347:
-#line 1270 "dhcp6_parser.yy" // lalr1.cc:859
+  case 376:
+#line 1371 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2148 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2283 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 348:
-#line 1274 "dhcp6_parser.yy" // lalr1.cc:859
+  case 377:
+#line 1375 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The pool parameter is required.
     ctx.require("pool", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2158 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2293 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 349:
-#line 1280 "dhcp6_parser.yy" // lalr1.cc:859
+  case 378:
+#line 1381 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the pool list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2168 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2303 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 350:
-#line 1284 "dhcp6_parser.yy" // lalr1.cc:859
+  case 379:
+#line 1385 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The pool parameter is required.
     ctx.require("pool", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
 }
-#line 2177 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2312 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 357:
-#line 1299 "dhcp6_parser.yy" // lalr1.cc:859
+  case 386:
+#line 1400 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2185 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2320 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 358:
-#line 1301 "dhcp6_parser.yy" // lalr1.cc:859
+  case 387:
+#line 1402 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr pool(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pool", pool);
     ctx.leave();
 }
-#line 2195 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2330 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 359:
-#line 1307 "dhcp6_parser.yy" // lalr1.cc:859
+  case 388:
+#line 1408 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2203 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2338 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 360:
-#line 1309 "dhcp6_parser.yy" // lalr1.cc:859
+  case 389:
+#line 1410 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("user-context", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 2212 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2347 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 361:
-#line 1317 "dhcp6_parser.yy" // lalr1.cc:859
+  case 390:
+#line 1418 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pd-pools", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.PD_POOLS);
 }
-#line 2223 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2358 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 362:
-#line 1322 "dhcp6_parser.yy" // lalr1.cc:859
+  case 391:
+#line 1423 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2232 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2367 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 367:
-#line 1337 "dhcp6_parser.yy" // lalr1.cc:859
+  case 396:
+#line 1438 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2242 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2377 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 368:
-#line 1341 "dhcp6_parser.yy" // lalr1.cc:859
+  case 397:
+#line 1442 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The prefix, prefix len and delegated len parameters are required.
     ctx.require("prefix", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -2250,21 +2385,21 @@ namespace isc { namespace dhcp {
     ctx.require("delegated-len", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2254 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2389 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 369:
-#line 1349 "dhcp6_parser.yy" // lalr1.cc:859
+  case 398:
+#line 1450 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the pd-pool list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2264 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2399 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 370:
-#line 1353 "dhcp6_parser.yy" // lalr1.cc:859
+  case 399:
+#line 1454 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The prefix, prefix len and delegated len parameters are required.
     ctx.require("prefix", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -2272,1028 +2407,1028 @@ namespace isc { namespace dhcp {
     ctx.require("delegated-len", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2276 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2411 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 381:
-#line 1375 "dhcp6_parser.yy" // lalr1.cc:859
+  case 410:
+#line 1476 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2284 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2419 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 382:
-#line 1377 "dhcp6_parser.yy" // lalr1.cc:859
+  case 411:
+#line 1478 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("prefix", prf);
     ctx.leave();
 }
-#line 2294 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2429 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 383:
-#line 1383 "dhcp6_parser.yy" // lalr1.cc:859
+  case 412:
+#line 1484 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("prefix-len", prf);
 }
-#line 2303 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2438 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 384:
-#line 1388 "dhcp6_parser.yy" // lalr1.cc:859
+  case 413:
+#line 1489 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2311 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2446 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 385:
-#line 1390 "dhcp6_parser.yy" // lalr1.cc:859
+  case 414:
+#line 1491 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("excluded-prefix", prf);
     ctx.leave();
 }
-#line 2321 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2456 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 386:
-#line 1396 "dhcp6_parser.yy" // lalr1.cc:859
+  case 415:
+#line 1497 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("excluded-prefix-len", prf);
 }
-#line 2330 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2465 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 387:
-#line 1401 "dhcp6_parser.yy" // lalr1.cc:859
+  case 416:
+#line 1502 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr deleg(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("delegated-len", deleg);
 }
-#line 2339 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2474 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 388:
-#line 1409 "dhcp6_parser.yy" // lalr1.cc:859
+  case 417:
+#line 1510 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reservations", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.RESERVATIONS);
 }
-#line 2350 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2485 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 389:
-#line 1414 "dhcp6_parser.yy" // lalr1.cc:859
+  case 418:
+#line 1515 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2359 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2494 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 394:
-#line 1427 "dhcp6_parser.yy" // lalr1.cc:859
+  case 423:
+#line 1528 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2369 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2504 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 395:
-#line 1431 "dhcp6_parser.yy" // lalr1.cc:859
+  case 424:
+#line 1532 "dhcp6_parser.yy" // lalr1.cc:859
     {
     /// @todo: an identifier parameter is required.
     ctx.stack_.pop_back();
 }
-#line 2378 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2513 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 396:
-#line 1436 "dhcp6_parser.yy" // lalr1.cc:859
+  case 425:
+#line 1537 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the reservations list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2388 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2523 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 397:
-#line 1440 "dhcp6_parser.yy" // lalr1.cc:859
+  case 426:
+#line 1541 "dhcp6_parser.yy" // lalr1.cc:859
     {
     /// @todo: an identifier parameter is required.
     // parsing completed
 }
-#line 2397 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2532 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 411:
-#line 1465 "dhcp6_parser.yy" // lalr1.cc:859
+  case 440:
+#line 1566 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-addresses", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2408 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2543 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 412:
-#line 1470 "dhcp6_parser.yy" // lalr1.cc:859
+  case 441:
+#line 1571 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2417 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2552 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 413:
-#line 1475 "dhcp6_parser.yy" // lalr1.cc:859
+  case 442:
+#line 1576 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("prefixes", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2428 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2563 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 414:
-#line 1480 "dhcp6_parser.yy" // lalr1.cc:859
+  case 443:
+#line 1581 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2437 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2572 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 415:
-#line 1485 "dhcp6_parser.yy" // lalr1.cc:859
+  case 444:
+#line 1586 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2445 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2580 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 416:
-#line 1487 "dhcp6_parser.yy" // lalr1.cc:859
+  case 445:
+#line 1588 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr d(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("duid", d);
     ctx.leave();
 }
-#line 2455 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2590 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 417:
-#line 1493 "dhcp6_parser.yy" // lalr1.cc:859
+  case 446:
+#line 1594 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2463 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2598 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 418:
-#line 1495 "dhcp6_parser.yy" // lalr1.cc:859
+  case 447:
+#line 1596 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hw-address", hw);
     ctx.leave();
 }
-#line 2473 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2608 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 419:
-#line 1501 "dhcp6_parser.yy" // lalr1.cc:859
+  case 448:
+#line 1602 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2481 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2616 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 420:
-#line 1503 "dhcp6_parser.yy" // lalr1.cc:859
+  case 449:
+#line 1604 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr host(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname", host);
     ctx.leave();
 }
-#line 2491 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2626 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 421:
-#line 1509 "dhcp6_parser.yy" // lalr1.cc:859
+  case 450:
+#line 1610 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2499 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2634 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 422:
-#line 1511 "dhcp6_parser.yy" // lalr1.cc:859
+  case 451:
+#line 1612 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flex-id", hw);
     ctx.leave();
 }
-#line 2509 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2644 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 423:
-#line 1517 "dhcp6_parser.yy" // lalr1.cc:859
+  case 452:
+#line 1618 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr c(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", c);
     ctx.stack_.push_back(c);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2520 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2655 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 424:
-#line 1522 "dhcp6_parser.yy" // lalr1.cc:859
+  case 453:
+#line 1623 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2529 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2664 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 425:
-#line 1530 "dhcp6_parser.yy" // lalr1.cc:859
+  case 454:
+#line 1631 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("relay", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.RELAY);
 }
-#line 2540 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2675 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 426:
-#line 1535 "dhcp6_parser.yy" // lalr1.cc:859
+  case 455:
+#line 1636 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2549 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2684 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 427:
-#line 1540 "dhcp6_parser.yy" // lalr1.cc:859
+  case 456:
+#line 1641 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2557 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2692 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 428:
-#line 1542 "dhcp6_parser.yy" // lalr1.cc:859
+  case 457:
+#line 1643 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr ip(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", ip);
     ctx.leave();
 }
-#line 2567 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2702 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 429:
-#line 1551 "dhcp6_parser.yy" // lalr1.cc:859
+  case 458:
+#line 1652 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.CLIENT_CLASSES);
 }
-#line 2578 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2713 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 430:
-#line 1556 "dhcp6_parser.yy" // lalr1.cc:859
+  case 459:
+#line 1657 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2587 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2722 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 433:
-#line 1565 "dhcp6_parser.yy" // lalr1.cc:859
+  case 462:
+#line 1666 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2597 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2732 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 434:
-#line 1569 "dhcp6_parser.yy" // lalr1.cc:859
+  case 463:
+#line 1670 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The name client class parameter is required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2607 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2742 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 444:
-#line 1591 "dhcp6_parser.yy" // lalr1.cc:859
+  case 473:
+#line 1692 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2615 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2750 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 445:
-#line 1593 "dhcp6_parser.yy" // lalr1.cc:859
+  case 474:
+#line 1694 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr test(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("test", test);
     ctx.leave();
 }
-#line 2625 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2760 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 446:
-#line 1602 "dhcp6_parser.yy" // lalr1.cc:859
+  case 475:
+#line 1703 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-id", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SERVER_ID);
 }
-#line 2636 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2771 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 447:
-#line 1607 "dhcp6_parser.yy" // lalr1.cc:859
+  case 476:
+#line 1708 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The type parameter is required.
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2647 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2782 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 457:
-#line 1627 "dhcp6_parser.yy" // lalr1.cc:859
+  case 486:
+#line 1728 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.DUID_TYPE);
 }
-#line 2655 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2790 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 458:
-#line 1629 "dhcp6_parser.yy" // lalr1.cc:859
+  case 487:
+#line 1730 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("type", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 2664 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2799 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 459:
-#line 1634 "dhcp6_parser.yy" // lalr1.cc:859
+  case 488:
+#line 1735 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("LLT", ctx.loc2pos(yystack_[0].location))); }
-#line 2670 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2805 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 460:
-#line 1635 "dhcp6_parser.yy" // lalr1.cc:859
+  case 489:
+#line 1736 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("EN", ctx.loc2pos(yystack_[0].location))); }
-#line 2676 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2811 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 461:
-#line 1636 "dhcp6_parser.yy" // lalr1.cc:859
+  case 490:
+#line 1737 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("LL", ctx.loc2pos(yystack_[0].location))); }
-#line 2682 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2817 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 462:
-#line 1639 "dhcp6_parser.yy" // lalr1.cc:859
+  case 491:
+#line 1740 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr htype(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("htype", htype);
 }
-#line 2691 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2826 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 463:
-#line 1644 "dhcp6_parser.yy" // lalr1.cc:859
+  case 492:
+#line 1745 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2699 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2834 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 464:
-#line 1646 "dhcp6_parser.yy" // lalr1.cc:859
+  case 493:
+#line 1747 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr id(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("identifier", id);
     ctx.leave();
 }
-#line 2709 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2844 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 465:
-#line 1652 "dhcp6_parser.yy" // lalr1.cc:859
+  case 494:
+#line 1753 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr time(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("time", time);
 }
-#line 2718 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2853 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 466:
-#line 1657 "dhcp6_parser.yy" // lalr1.cc:859
+  case 495:
+#line 1758 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr time(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enterprise-id", time);
 }
-#line 2727 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2862 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 467:
-#line 1664 "dhcp6_parser.yy" // lalr1.cc:859
+  case 496:
+#line 1765 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr time(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp4o6-port", time);
 }
-#line 2736 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2871 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 468:
-#line 1671 "dhcp6_parser.yy" // lalr1.cc:859
+  case 497:
+#line 1772 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("control-socket", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.CONTROL_SOCKET);
 }
-#line 2747 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2882 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 469:
-#line 1676 "dhcp6_parser.yy" // lalr1.cc:859
+  case 498:
+#line 1777 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2756 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2891 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 474:
-#line 1689 "dhcp6_parser.yy" // lalr1.cc:859
+  case 503:
+#line 1790 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2764 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2899 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 475:
-#line 1691 "dhcp6_parser.yy" // lalr1.cc:859
+  case 504:
+#line 1792 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr stype(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-type", stype);
     ctx.leave();
 }
-#line 2774 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2909 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 476:
-#line 1697 "dhcp6_parser.yy" // lalr1.cc:859
+  case 505:
+#line 1798 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2782 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2917 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 477:
-#line 1699 "dhcp6_parser.yy" // lalr1.cc:859
+  case 506:
+#line 1800 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-name", name);
     ctx.leave();
 }
-#line 2792 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2927 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 478:
-#line 1707 "dhcp6_parser.yy" // lalr1.cc:859
+  case 507:
+#line 1808 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp-ddns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCP_DDNS);
 }
-#line 2803 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2938 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 479:
-#line 1712 "dhcp6_parser.yy" // lalr1.cc:859
+  case 508:
+#line 1813 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The enable updates DHCP DDNS parameter is required.
     ctx.require("enable-updates", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2814 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2949 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 480:
-#line 1719 "dhcp6_parser.yy" // lalr1.cc:859
+  case 509:
+#line 1820 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the dhcp-ddns map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2824 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2959 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 481:
-#line 1723 "dhcp6_parser.yy" // lalr1.cc:859
+  case 510:
+#line 1824 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The enable updates DHCP DDNS parameter is required.
     ctx.require("enable-updates", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2834 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2969 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 499:
-#line 1750 "dhcp6_parser.yy" // lalr1.cc:859
+  case 528:
+#line 1851 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enable-updates", b);
 }
-#line 2843 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2978 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 500:
-#line 1755 "dhcp6_parser.yy" // lalr1.cc:859
+  case 529:
+#line 1856 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2851 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2986 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 501:
-#line 1757 "dhcp6_parser.yy" // lalr1.cc:859
+  case 530:
+#line 1858 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("qualifying-suffix", s);
     ctx.leave();
 }
-#line 2861 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2996 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 502:
-#line 1763 "dhcp6_parser.yy" // lalr1.cc:859
+  case 531:
+#line 1864 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2869 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3004 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 503:
-#line 1765 "dhcp6_parser.yy" // lalr1.cc:859
+  case 532:
+#line 1866 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-ip", s);
     ctx.leave();
 }
-#line 2879 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3014 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 504:
-#line 1771 "dhcp6_parser.yy" // lalr1.cc:859
+  case 533:
+#line 1872 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-port", i);
 }
-#line 2888 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3023 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 505:
-#line 1776 "dhcp6_parser.yy" // lalr1.cc:859
+  case 534:
+#line 1877 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2896 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3031 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 506:
-#line 1778 "dhcp6_parser.yy" // lalr1.cc:859
+  case 535:
+#line 1879 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-ip", s);
     ctx.leave();
 }
-#line 2906 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3041 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 507:
-#line 1784 "dhcp6_parser.yy" // lalr1.cc:859
+  case 536:
+#line 1885 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-port", i);
 }
-#line 2915 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3050 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 508:
-#line 1789 "dhcp6_parser.yy" // lalr1.cc:859
+  case 537:
+#line 1890 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-queue-size", i);
 }
-#line 2924 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3059 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 509:
-#line 1794 "dhcp6_parser.yy" // lalr1.cc:859
+  case 538:
+#line 1895 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NCR_PROTOCOL);
 }
-#line 2932 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3067 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 510:
-#line 1796 "dhcp6_parser.yy" // lalr1.cc:859
+  case 539:
+#line 1897 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 2941 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3076 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 511:
-#line 1802 "dhcp6_parser.yy" // lalr1.cc:859
+  case 540:
+#line 1903 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
-#line 2947 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3082 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 512:
-#line 1803 "dhcp6_parser.yy" // lalr1.cc:859
+  case 541:
+#line 1904 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
-#line 2953 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3088 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 513:
-#line 1806 "dhcp6_parser.yy" // lalr1.cc:859
+  case 542:
+#line 1907 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NCR_FORMAT);
 }
-#line 2961 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3096 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 514:
-#line 1808 "dhcp6_parser.yy" // lalr1.cc:859
+  case 543:
+#line 1909 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr json(new StringElement("JSON", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ncr-format", json);
     ctx.leave();
 }
-#line 2971 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3106 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 515:
-#line 1814 "dhcp6_parser.yy" // lalr1.cc:859
+  case 544:
+#line 1915 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("always-include-fqdn", b);
 }
-#line 2980 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3115 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 516:
-#line 1819 "dhcp6_parser.yy" // lalr1.cc:859
+  case 545:
+#line 1920 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-no-update", b);
 }
-#line 2989 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3124 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 517:
-#line 1824 "dhcp6_parser.yy" // lalr1.cc:859
+  case 546:
+#line 1925 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-client-update", b);
 }
-#line 2998 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3133 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 518:
-#line 1829 "dhcp6_parser.yy" // lalr1.cc:859
+  case 547:
+#line 1930 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.REPLACE_CLIENT_NAME);
 }
-#line 3006 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3141 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 519:
-#line 1831 "dhcp6_parser.yy" // lalr1.cc:859
+  case 548:
+#line 1932 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("replace-client-name", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 3015 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3150 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 520:
-#line 1837 "dhcp6_parser.yy" // lalr1.cc:859
+  case 549:
+#line 1938 "dhcp6_parser.yy" // lalr1.cc:859
     {
       yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("when-present", ctx.loc2pos(yystack_[0].location))); 
       }
-#line 3023 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3158 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 521:
-#line 1840 "dhcp6_parser.yy" // lalr1.cc:859
+  case 550:
+#line 1941 "dhcp6_parser.yy" // lalr1.cc:859
     {
       yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("never", ctx.loc2pos(yystack_[0].location)));
       }
-#line 3031 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3166 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 522:
-#line 1843 "dhcp6_parser.yy" // lalr1.cc:859
+  case 551:
+#line 1944 "dhcp6_parser.yy" // lalr1.cc:859
     {
       yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("always", ctx.loc2pos(yystack_[0].location)));
       }
-#line 3039 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3174 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 523:
-#line 1846 "dhcp6_parser.yy" // lalr1.cc:859
+  case 552:
+#line 1947 "dhcp6_parser.yy" // lalr1.cc:859
     {
       yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("when-not-present", ctx.loc2pos(yystack_[0].location)));
       }
-#line 3047 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3182 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 524:
-#line 1849 "dhcp6_parser.yy" // lalr1.cc:859
+  case 553:
+#line 1950 "dhcp6_parser.yy" // lalr1.cc:859
     {
       error(yystack_[0].location, "boolean values for the replace-client-name are "
                 "no longer supported");
       }
-#line 3056 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3191 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 525:
-#line 1855 "dhcp6_parser.yy" // lalr1.cc:859
+  case 554:
+#line 1956 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3064 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3199 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 526:
-#line 1857 "dhcp6_parser.yy" // lalr1.cc:859
+  case 555:
+#line 1958 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("generated-prefix", s);
     ctx.leave();
 }
-#line 3074 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3209 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 527:
-#line 1865 "dhcp6_parser.yy" // lalr1.cc:859
+  case 556:
+#line 1966 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3082 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3217 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 528:
-#line 1867 "dhcp6_parser.yy" // lalr1.cc:859
+  case 557:
+#line 1968 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("Dhcp4", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 3091 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3226 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 529:
-#line 1872 "dhcp6_parser.yy" // lalr1.cc:859
+  case 558:
+#line 1973 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3099 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3234 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 530:
-#line 1874 "dhcp6_parser.yy" // lalr1.cc:859
+  case 559:
+#line 1975 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("DhcpDdns", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 3108 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3243 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 531:
-#line 1879 "dhcp6_parser.yy" // lalr1.cc:859
+  case 560:
+#line 1980 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3116 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3251 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 532:
-#line 1881 "dhcp6_parser.yy" // lalr1.cc:859
+  case 561:
+#line 1982 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("Control-agent", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 3125 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3260 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 533:
-#line 1892 "dhcp6_parser.yy" // lalr1.cc:859
+  case 562:
+#line 1993 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.LOGGING);
 }
-#line 3136 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3271 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 534:
-#line 1897 "dhcp6_parser.yy" // lalr1.cc:859
+  case 563:
+#line 1998 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3145 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3280 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 538:
-#line 1914 "dhcp6_parser.yy" // lalr1.cc:859
+  case 567:
+#line 2015 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.LOGGERS);
 }
-#line 3156 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3291 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 539:
-#line 1919 "dhcp6_parser.yy" // lalr1.cc:859
+  case 568:
+#line 2020 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3165 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3300 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 542:
-#line 1931 "dhcp6_parser.yy" // lalr1.cc:859
+  case 571:
+#line 2032 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
     ctx.stack_.push_back(l);
 }
-#line 3175 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3310 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 543:
-#line 1935 "dhcp6_parser.yy" // lalr1.cc:859
+  case 572:
+#line 2036 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
 }
-#line 3183 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3318 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 551:
-#line 1950 "dhcp6_parser.yy" // lalr1.cc:859
+  case 580:
+#line 2051 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr dl(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
 }
-#line 3192 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3327 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 552:
-#line 1955 "dhcp6_parser.yy" // lalr1.cc:859
+  case 581:
+#line 2056 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3200 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3335 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 553:
-#line 1957 "dhcp6_parser.yy" // lalr1.cc:859
+  case 582:
+#line 2058 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
     ctx.leave();
 }
-#line 3210 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3345 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 554:
-#line 1963 "dhcp6_parser.yy" // lalr1.cc:859
+  case 583:
+#line 2064 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 3221 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3356 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 555:
-#line 1968 "dhcp6_parser.yy" // lalr1.cc:859
+  case 584:
+#line 2069 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3230 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3365 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 558:
-#line 1977 "dhcp6_parser.yy" // lalr1.cc:859
+  case 587:
+#line 2078 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 3240 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3375 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 559:
-#line 1981 "dhcp6_parser.yy" // lalr1.cc:859
+  case 588:
+#line 2082 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
 }
-#line 3248 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3383 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 566:
-#line 1995 "dhcp6_parser.yy" // lalr1.cc:859
+  case 595:
+#line 2096 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3256 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3391 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 567:
-#line 1997 "dhcp6_parser.yy" // lalr1.cc:859
+  case 596:
+#line 2098 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 3266 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3401 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 568:
-#line 2003 "dhcp6_parser.yy" // lalr1.cc:859
+  case 597:
+#line 2104 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr flush(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush", flush);
 }
-#line 3275 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3410 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 569:
-#line 2008 "dhcp6_parser.yy" // lalr1.cc:859
+  case 598:
+#line 2109 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr maxsize(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxsize", maxsize);
 }
-#line 3284 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3419 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 570:
-#line 2013 "dhcp6_parser.yy" // lalr1.cc:859
+  case 599:
+#line 2114 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr maxver(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxver", maxver);
 }
-#line 3293 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3428 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
 
-#line 3297 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3432 "dhcp6_parser.cc" // lalr1.cc:859
             default:
               break;
             }
@@ -3548,107 +3683,113 @@ namespace isc { namespace dhcp {
   }
 
 
-  const short int Dhcp6Parser::yypact_ninf_ = -707;
+  const short int Dhcp6Parser::yypact_ninf_ = -747;
 
   const signed char Dhcp6Parser::yytable_ninf_ = -1;
 
   const short int
   Dhcp6Parser::yypact_[] =
   {
-     211,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,
-    -707,  -707,  -707,  -707,    45,    23,    61,    76,    86,   116,
-     124,   126,   166,   177,   187,   204,   227,   238,  -707,  -707,
-    -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,
-    -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,
-    -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,
-    -707,  -707,  -707,  -707,    23,   120,    14,   121,   135,    16,
-      73,    63,    67,   246,    53,   189,   -13,   143,  -707,   281,
-     297,   304,   302,   309,  -707,  -707,  -707,  -707,  -707,   314,
-    -707,    59,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,
-    -707,   318,   319,   337,   338,   343,  -707,  -707,  -707,  -707,
-    -707,  -707,  -707,  -707,  -707,  -707,  -707,   358,  -707,  -707,
-    -707,    82,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,
-    -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,
-    -707,  -707,  -707,  -707,  -707,  -707,   359,    94,  -707,  -707,
-    -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,   360,   361,
-    -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,   100,
-    -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,
-    -707,  -707,  -707,  -707,  -707,  -707,  -707,   131,  -707,  -707,
-    -707,  -707,   362,  -707,   363,   364,  -707,  -707,  -707,   158,
-    -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,
-    -707,  -707,  -707,  -707,  -707,   365,   366,  -707,  -707,  -707,
-    -707,  -707,  -707,  -707,  -707,   367,  -707,  -707,   368,  -707,
-    -707,  -707,   370,  -707,  -707,   369,   373,  -707,  -707,  -707,
-    -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,   374,   375,
-    -707,  -707,  -707,  -707,   372,   378,  -707,  -707,  -707,  -707,
-    -707,  -707,  -707,  -707,  -707,  -707,   160,  -707,  -707,  -707,
-     379,  -707,  -707,   380,  -707,   381,   382,  -707,  -707,   383,
-     384,   385,  -707,  -707,  -707,   194,  -707,  -707,  -707,  -707,
-    -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,
-    -707,  -707,    23,    23,  -707,   219,   386,   387,   388,   389,
-     390,  -707,    14,  -707,   391,   392,   393,   230,   247,   248,
-     249,   250,   394,   399,   400,   401,   402,   403,   404,   405,
-     406,   407,   408,   261,   410,   411,   121,  -707,   412,   217,
-     135,  -707,    20,   413,   414,   415,   416,   417,   418,   272,
-     269,   421,   422,   423,   427,    16,  -707,   428,    73,  -707,
-     429,   282,   431,   284,   285,    63,  -707,   434,   435,   436,
-     437,   438,   439,   440,  -707,    67,  -707,   441,   442,   298,
-     445,   447,   448,   299,  -707,    53,   450,   303,   305,  -707,
-     189,   454,   456,   -23,  -707,   307,   458,   459,   312,   461,
-     316,   320,   466,   467,   321,   322,   323,   469,   474,   143,
-    -707,  -707,  -707,   475,   473,   476,    23,    23,    23,  -707,
-     477,   478,   480,  -707,  -707,  -707,  -707,  -707,   483,   484,
-     485,   486,   487,   488,   489,   490,   491,   492,   493,  -707,
-     494,   495,  -707,   498,  -707,  -707,  -707,  -707,  -707,  -707,
-     496,   479,  -707,  -707,  -707,   500,   501,   503,   330,   346,
-     347,  -707,  -707,   271,   356,   506,   505,  -707,   357,  -707,
-     371,  -707,   376,  -707,  -707,  -707,   498,   498,   498,   377,
-     395,   396,   397,  -707,   398,   409,  -707,   419,   420,   424,
-    -707,  -707,   425,  -707,  -707,  -707,   426,    23,  -707,  -707,
-     430,   432,  -707,   433,  -707,  -707,    -7,   443,  -707,  -707,
-    -707,    85,   444,  -707,    23,   121,   446,  -707,  -707,  -707,
-     135,    13,    13,   507,   508,   509,   510,   -30,    23,    93,
-      58,   511,   176,    28,   229,   143,  -707,  -707,   515,  -707,
-      20,   513,   514,  -707,  -707,  -707,  -707,  -707,  -707,  -707,
-    -707,  -707,  -707,   516,   449,  -707,  -707,  -707,  -707,  -707,
-    -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,
-    -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,
-    -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,   197,  -707,
-     209,  -707,  -707,   212,  -707,  -707,  -707,  -707,   520,   521,
-     525,   527,   528,  -707,  -707,  -707,   232,  -707,  -707,  -707,
-    -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,
-     234,  -707,   529,   530,  -707,  -707,   531,   533,  -707,  -707,
-     532,   536,  -707,  -707,   534,   538,  -707,  -707,  -707,   195,
-    -707,  -707,  -707,   537,  -707,  -707,  -707,   220,  -707,  -707,
-    -707,  -707,   235,  -707,   539,   541,  -707,   546,   547,   548,
-     549,   550,   551,   266,  -707,  -707,  -707,  -707,  -707,  -707,
-    -707,  -707,  -707,   552,   553,   554,  -707,  -707,   267,  -707,
-    -707,  -707,  -707,  -707,  -707,  -707,  -707,   270,  -707,  -707,
-    -707,   274,   451,   452,  -707,  -707,   555,   556,  -707,  -707,
-     557,   559,  -707,  -707,   560,   562,  -707,  -707,   526,  -707,
-     563,   446,  -707,  -707,   564,   565,   568,   570,   453,   455,
-     460,   457,   462,   574,   575,    13,  -707,  -707,    16,  -707,
-     507,    53,  -707,   508,   189,  -707,   509,    48,  -707,   510,
-     -30,  -707,  -707,    93,  -707,    58,  -707,   -13,  -707,   511,
-     463,   464,   465,   468,   470,   471,   176,  -707,   576,   578,
-     472,   481,   482,    28,  -707,   581,   582,   229,  -707,  -707,
-    -707,   583,   584,  -707,    73,  -707,   513,    63,  -707,   514,
-      67,  -707,   516,   586,  -707,   587,  -707,   308,   497,   499,
-     502,  -707,  -707,  -707,  -707,  -707,   504,   518,  -707,   276,
-    -707,   580,  -707,   585,  -707,  -707,  -707,  -707,  -707,  -707,
-    -707,  -707,  -707,  -707,  -707,  -707,  -707,   277,  -707,  -707,
-    -707,  -707,  -707,  -707,  -707,   278,  -707,  -707,  -707,  -707,
-    -707,  -707,  -707,  -707,   244,   519,  -707,  -707,  -707,  -707,
-     535,   540,  -707,  -707,   542,   287,  -707,   288,  -707,   588,
-    -707,   543,   590,  -707,  -707,  -707,  -707,  -707,  -707,  -707,
-    -707,  -707,  -707,  -707,  -707,  -707,    48,  -707,  -707,  -707,
-    -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,
-    -707,  -707,   241,  -707,  -707,    65,   590,  -707,  -707,   594,
-    -707,  -707,  -707,   294,  -707,  -707,  -707,  -707,  -707,   595,
-     512,   596,    65,  -707,   589,  -707,   544,  -707,   597,  -707,
-    -707,   327,  -707,    49,   597,  -707,  -707,   602,   603,   604,
-     295,  -707,  -707,  -707,  -707,  -707,  -707,   606,   522,   558,
-     561,    49,  -707,   545,  -707,  -707,  -707,  -707,  -707
+      95,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,    29,    23,    39,    41,    59,    63,
+      72,    90,    92,    98,   100,   104,   108,   112,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,    23,  -105,    14,   121,   251,    16,
+      -5,   -16,   -17,    34,    53,   153,   -15,   258,  -747,   133,
+     138,   151,   166,   158,  -747,  -747,  -747,  -747,  -747,   172,
+    -747,   114,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,   180,   210,   221,   230,   240,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,   290,  -747,  -747,
+    -747,   130,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,  -747,   296,   144,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,   304,   306,
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,   148,
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,   150,  -747,  -747,
+    -747,  -747,   308,  -747,   333,   334,  -747,  -747,  -747,   184,
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,   190,   238,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,   265,  -747,  -747,   364,  -747,
+    -747,  -747,   365,  -747,  -747,   362,   368,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,   369,   370,
+    -747,  -747,  -747,  -747,   367,   388,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,  -747,   191,  -747,  -747,  -747,
+     389,  -747,  -747,   390,  -747,   391,   392,  -747,  -747,   393,
+     394,   395,  -747,  -747,  -747,   218,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,    23,    23,  -747,   207,   396,   397,   398,   399,
+     400,  -747,    14,  -747,   402,   403,   404,   226,   243,   244,
+     245,   246,   409,   410,   411,   412,   413,   414,   415,   416,
+     417,   418,   420,   260,   421,   423,   121,  -747,   427,   264,
+     251,  -747,    -8,   429,   430,   431,   432,   433,   434,   273,
+     272,   437,   438,   439,   440,    16,  -747,   441,    -5,  -747,
+     442,   283,   446,   285,   286,   -16,  -747,   449,   450,   453,
+     454,   455,   456,   457,  -747,   -17,  -747,   458,   459,   298,
+     461,   464,   466,   303,  -747,    53,   468,   305,   307,  -747,
+     153,   472,   473,   183,  -747,   310,   475,   476,   315,   478,
+     317,   318,   481,   483,   321,   322,   324,   487,   489,   258,
+    -747,  -747,  -747,   490,   488,   491,    23,    23,    23,  -747,
+     492,   493,   494,  -747,  -747,  -747,  -747,  -747,   497,   498,
+     499,   500,   501,   502,   503,   505,   506,   507,   508,  -747,
+     509,   510,  -747,   513,  -747,  -747,  -747,  -747,  -747,  -747,
+     504,   516,  -747,  -747,  -747,   515,   517,   514,   331,   332,
+     348,  -747,  -747,    52,   358,   519,   518,  -747,   363,  -747,
+     366,  -747,   371,  -747,  -747,  -747,   513,   513,   513,   372,
+     373,   374,   375,  -747,   376,   377,  -747,   378,   379,   380,
+    -747,  -747,   381,  -747,  -747,  -747,   382,    23,  -747,  -747,
+     383,   384,  -747,   385,  -747,  -747,   192,   419,  -747,  -747,
+    -747,     7,   386,  -747,    23,   121,   422,  -747,  -747,  -747,
+     251,   323,   323,   520,   522,   523,   525,   -47,    23,   -34,
+      30,   526,   128,    15,   167,   258,  -747,  -747,   530,  -747,
+      -8,   528,   545,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,   546,   460,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,   234,  -747,
+     235,  -747,  -747,   237,  -747,  -747,  -747,  -747,   552,   553,
+     554,   555,   556,  -747,  -747,   557,   558,   560,   561,   562,
+     563,   564,   565,  -747,   566,   567,   568,   569,   570,  -747,
+     257,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,   259,  -747,
+     571,   572,  -747,  -747,   573,   575,  -747,  -747,   574,   578,
+    -747,  -747,   576,   580,  -747,  -747,  -747,    78,  -747,  -747,
+    -747,   579,  -747,  -747,  -747,   134,  -747,  -747,  -747,  -747,
+     156,  -747,   581,   583,  -747,   584,   585,   586,   587,   588,
+     589,   263,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,   590,   591,   592,  -747,  -747,   267,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,   269,  -747,  -747,  -747,   271,
+     435,   436,  -747,  -747,   593,   594,  -747,  -747,   596,   595,
+    -747,  -747,   597,   601,  -747,  -747,   598,  -747,   603,   422,
+    -747,  -747,   604,   605,   606,   607,   447,   408,   448,   444,
+     451,   611,   612,   452,   462,   463,   465,   467,   469,   470,
+     474,   614,   477,   479,   480,   482,   484,   323,  -747,  -747,
+      16,  -747,   520,    53,  -747,   522,   153,  -747,   523,    48,
+    -747,   525,   -47,  -747,  -747,   -34,  -747,    30,  -747,   -15,
+    -747,   526,   485,   486,   495,   496,   511,   512,   128,  -747,
+     615,   617,   521,   524,   529,    15,  -747,   618,   619,   167,
+    -747,  -747,  -747,   599,   621,  -747,    -5,  -747,   528,   -16,
+    -747,   545,   -17,  -747,   546,   622,  -747,   620,  -747,   313,
+     527,   531,   532,  -747,  -747,  -747,  -747,  -747,   533,   534,
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,   535,  -747,
+    -747,  -747,  -747,  -747,  -747,   279,  -747,   624,  -747,   626,
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,   287,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,   288,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+     227,   541,  -747,  -747,  -747,  -747,   544,   547,  -747,  -747,
+     549,   294,  -747,   295,  -747,   627,  -747,   559,   577,  -747,
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,    48,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,   194,
+    -747,  -747,    51,   577,  -747,  -747,   623,  -747,  -747,  -747,
+     319,  -747,  -747,  -747,  -747,  -747,   634,   582,   635,    51,
+    -747,   636,  -747,   602,  -747,   637,  -747,  -747,   209,  -747,
+      76,   637,  -747,  -747,   638,   643,   645,   320,  -747,  -747,
+    -747,  -747,  -747,  -747,   649,   543,   600,   609,    76,  -747,
+     608,  -747,  -747,  -747,  -747,  -747
   };
 
   const unsigned short int
@@ -3658,136 +3799,144 @@ namespace isc { namespace dhcp {
       20,    22,    24,    26,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     1,    43,
       36,    32,    31,    28,    29,    30,    35,     3,    33,    34,
-      56,     5,    68,     7,   102,     9,   215,    11,   349,    13,
-     369,    15,   396,    17,   278,    19,   286,    21,   321,    23,
-     180,    25,   480,    27,    45,    39,     0,     0,     0,     0,
-       0,     0,   398,     0,   288,   323,     0,     0,    47,     0,
-      46,     0,     0,    40,    66,   533,   527,   529,   531,     0,
+      56,     5,    68,     7,   102,     9,   244,    11,   378,    13,
+     398,    15,   425,    17,   307,    19,   315,    21,   350,    23,
+     209,    25,   509,    27,    45,    39,     0,     0,     0,     0,
+       0,     0,   427,     0,   317,   352,     0,     0,    47,     0,
+      46,     0,     0,    40,    66,   562,   556,   558,   560,     0,
       65,     0,    58,    60,    62,    63,    64,    61,   100,   111,
-     113,     0,     0,     0,     0,     0,   207,   276,   313,   252,
-     153,   170,   161,   429,   172,   191,   446,     0,   468,   478,
+     113,     0,     0,     0,     0,     0,   236,   305,   342,   281,
+     182,   199,   190,   458,   201,   220,   475,     0,   497,   507,
       94,     0,    70,    72,    73,    74,    75,    76,    79,    80,
       81,    82,    84,    83,    88,    89,    77,    78,    86,    87,
       85,    90,    91,    92,    93,   108,     0,     0,   104,   106,
-     107,   433,   341,   361,   359,   237,   239,   241,     0,     0,
-     245,   243,   388,   425,   236,   219,   220,   221,   222,     0,
-     217,   226,   227,   228,   231,   233,   229,   230,   223,   224,
-     235,   225,   232,   234,   357,   356,   354,     0,   351,   353,
-     355,   381,     0,   384,     0,     0,   380,   376,   379,     0,
-     371,   373,   374,   377,   378,   375,   423,   411,   413,   415,
-     417,   419,   421,   410,   409,     0,   399,   400,   404,   405,
-     402,   406,   407,   408,   403,     0,   303,   143,     0,   307,
-     305,   310,     0,   299,   300,     0,   289,   290,   292,   302,
-     293,   294,   295,   309,   296,   297,   298,   335,     0,     0,
-     333,   334,   337,   338,     0,   324,   325,   327,   328,   329,
-     330,   331,   332,   187,   189,   184,     0,   182,   185,   186,
-       0,   500,   502,     0,   505,     0,     0,   509,   513,     0,
-       0,     0,   518,   525,   498,     0,   482,   484,   485,   486,
-     487,   488,   489,   490,   491,   492,   493,   494,   495,   496,
-     497,    44,     0,     0,    37,     0,     0,     0,     0,     0,
+     107,   462,   370,   390,   388,   266,   268,   270,     0,     0,
+     274,   272,   417,   454,   265,   248,   249,   250,   251,     0,
+     246,   255,   256,   257,   260,   262,   258,   259,   252,   253,
+     264,   254,   261,   263,   386,   385,   383,     0,   380,   382,
+     384,   410,     0,   413,     0,     0,   409,   405,   408,     0,
+     400,   402,   403,   406,   407,   404,   452,   440,   442,   444,
+     446,   448,   450,   439,   438,     0,   428,   429,   433,   434,
+     431,   435,   436,   437,   432,     0,   332,   157,     0,   336,
+     334,   339,     0,   328,   329,     0,   318,   319,   321,   331,
+     322,   323,   324,   338,   325,   326,   327,   364,     0,     0,
+     362,   363,   366,   367,     0,   353,   354,   356,   357,   358,
+     359,   360,   361,   216,   218,   213,     0,   211,   214,   215,
+       0,   529,   531,     0,   534,     0,     0,   538,   542,     0,
+       0,     0,   547,   554,   527,     0,   511,   513,   514,   515,
+     516,   517,   518,   519,   520,   521,   522,   523,   524,   525,
+     526,    44,     0,     0,    37,     0,     0,     0,     0,     0,
        0,    55,     0,    57,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,    69,     0,     0,
-       0,   103,   435,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   216,     0,     0,   350,
-       0,     0,     0,     0,     0,     0,   370,     0,     0,     0,
-       0,     0,     0,     0,   397,     0,   279,     0,     0,     0,
-       0,     0,     0,     0,   287,     0,     0,     0,     0,   322,
-       0,     0,     0,     0,   181,     0,     0,     0,     0,     0,
+       0,   103,   464,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   245,     0,     0,   379,
+       0,     0,     0,     0,     0,     0,   399,     0,     0,     0,
+       0,     0,     0,     0,   426,     0,   308,     0,     0,     0,
+       0,     0,     0,     0,   316,     0,     0,     0,     0,   351,
+       0,     0,     0,     0,   210,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     481,    48,    41,     0,     0,     0,     0,     0,     0,    59,
+     510,    48,    41,     0,     0,     0,     0,     0,     0,    59,
        0,     0,     0,    95,    96,    97,    98,    99,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   467,
-       0,     0,    71,     0,   110,   105,   444,   442,   443,   441,
-       0,   436,   437,   439,   440,     0,     0,     0,     0,     0,
-       0,   250,   251,     0,     0,     0,     0,   218,     0,   352,
-       0,   383,     0,   386,   387,   372,     0,     0,     0,     0,
-       0,     0,     0,   401,     0,     0,   301,     0,     0,     0,
-     312,   291,     0,   339,   340,   326,     0,     0,   183,   499,
-       0,     0,   504,     0,   507,   508,     0,     0,   515,   516,
-     517,     0,     0,   483,     0,     0,     0,   528,   530,   532,
-       0,     0,     0,   209,   280,   315,   254,     0,    45,     0,
-       0,   174,     0,     0,     0,     0,    49,   109,     0,   434,
-       0,   343,   363,    38,   360,   238,   240,   242,   247,   248,
-     249,   246,   244,   390,     0,   358,   382,   385,   424,   412,
-     414,   416,   418,   420,   422,   304,   144,   308,   306,   311,
-     336,   188,   190,   501,   503,   506,   511,   512,   510,   514,
-     520,   521,   522,   523,   524,   519,   526,    42,     0,   538,
-       0,   535,   537,     0,   130,   136,   138,   140,     0,     0,
-       0,     0,     0,   149,   151,   129,     0,   115,   117,   118,
-     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
-       0,   213,     0,   210,   211,   284,     0,   281,   282,   319,
-       0,   316,   317,   258,     0,   255,   256,   159,   160,     0,
-     155,   157,   158,     0,   168,   169,   165,     0,   163,   166,
-     167,   431,     0,   178,     0,   175,   176,     0,     0,     0,
-       0,     0,     0,     0,   193,   195,   196,   197,   198,   199,
-     200,   457,   463,     0,     0,     0,   456,   455,     0,   448,
-     450,   453,   451,   452,   454,   474,   476,     0,   470,   472,
-     473,     0,    51,     0,   438,   347,     0,   344,   345,   367,
-       0,   364,   365,   394,     0,   391,   392,   427,     0,    67,
-       0,     0,   534,   101,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   112,   114,     0,   208,
-       0,   288,   277,     0,   323,   314,     0,     0,   253,     0,
-       0,   154,   171,     0,   162,     0,   430,     0,   173,     0,
-       0,     0,     0,     0,     0,     0,     0,   192,     0,     0,
-       0,     0,     0,     0,   447,     0,     0,     0,   469,   479,
-      53,     0,    52,   445,     0,   342,     0,     0,   362,     0,
-     398,   389,     0,     0,   426,     0,   536,     0,     0,     0,
-       0,   142,   145,   146,   147,   148,     0,     0,   116,     0,
-     212,     0,   283,     0,   318,   275,   272,   274,   266,   267,
-     262,   263,   264,   265,   271,   270,   273,     0,   260,   268,
-     269,   257,   156,   164,   432,     0,   177,   201,   202,   203,
-     204,   205,   206,   194,     0,     0,   462,   465,   466,   449,
-       0,     0,   471,    50,     0,     0,   346,     0,   366,     0,
-     393,     0,     0,   132,   133,   134,   135,   131,   137,   139,
-     141,   150,   152,   214,   285,   320,     0,   259,   179,   459,
-     460,   461,   458,   464,   475,   477,    54,   348,   368,   395,
-     428,   542,     0,   540,   261,     0,     0,   539,   554,     0,
-     552,   550,   546,     0,   544,   548,   549,   547,   541,     0,
-       0,     0,     0,   543,     0,   551,     0,   545,     0,   553,
-     558,     0,   556,     0,     0,   555,   566,     0,     0,     0,
-       0,   560,   562,   563,   564,   565,   557,     0,     0,     0,
-       0,     0,   559,     0,   568,   569,   570,   561,   567
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   496,
+       0,     0,    71,     0,   110,   105,   473,   471,   472,   470,
+       0,   465,   466,   468,   469,     0,     0,     0,     0,     0,
+       0,   279,   280,     0,     0,     0,     0,   247,     0,   381,
+       0,   412,     0,   415,   416,   401,     0,     0,     0,     0,
+       0,     0,     0,   430,     0,     0,   330,     0,     0,     0,
+     341,   320,     0,   368,   369,   355,     0,     0,   212,   528,
+       0,     0,   533,     0,   536,   537,     0,     0,   544,   545,
+     546,     0,     0,   512,     0,     0,     0,   557,   559,   561,
+       0,     0,     0,   238,   309,   344,   283,     0,    45,     0,
+       0,   203,     0,     0,     0,     0,    49,   109,     0,   463,
+       0,   372,   392,    38,   389,   267,   269,   271,   276,   277,
+     278,   275,   273,   419,     0,   387,   411,   414,   453,   441,
+     443,   445,   447,   449,   451,   333,   158,   337,   335,   340,
+     365,   217,   219,   530,   532,   535,   540,   541,   539,   543,
+     549,   550,   551,   552,   553,   548,   555,    42,     0,   567,
+       0,   564,   566,     0,   144,   150,   152,   154,     0,     0,
+       0,     0,     0,   163,   165,     0,     0,     0,     0,     0,
+       0,     0,     0,   175,     0,     0,     0,     0,     0,   143,
+       0,   115,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142,     0,   242,
+       0,   239,   240,   313,     0,   310,   311,   348,     0,   345,
+     346,   287,     0,   284,   285,   188,   189,     0,   184,   186,
+     187,     0,   197,   198,   194,     0,   192,   195,   196,   460,
+       0,   207,     0,   204,   205,     0,     0,     0,     0,     0,
+       0,     0,   222,   224,   225,   226,   227,   228,   229,   486,
+     492,     0,     0,     0,   485,   484,     0,   477,   479,   482,
+     480,   481,   483,   503,   505,     0,   499,   501,   502,     0,
+      51,     0,   467,   376,     0,   373,   374,   396,     0,   393,
+     394,   423,     0,   420,   421,   456,     0,    67,     0,     0,
+     563,   101,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   112,   114,
+       0,   237,     0,   317,   306,     0,   352,   343,     0,     0,
+     282,     0,     0,   183,   200,     0,   191,     0,   459,     0,
+     202,     0,     0,     0,     0,     0,     0,     0,     0,   221,
+       0,     0,     0,     0,     0,     0,   476,     0,     0,     0,
+     498,   508,    53,     0,    52,   474,     0,   371,     0,     0,
+     391,     0,   427,   418,     0,     0,   455,     0,   565,     0,
+       0,     0,     0,   156,   159,   160,   161,   162,     0,     0,
+     167,   168,   169,   170,   171,   172,   173,   174,     0,   177,
+     178,   179,   180,   181,   116,     0,   241,     0,   312,     0,
+     347,   304,   301,   303,   295,   296,   291,   292,   293,   294,
+     300,   299,   302,     0,   289,   297,   298,   286,   185,   193,
+     461,     0,   206,   230,   231,   232,   233,   234,   235,   223,
+       0,     0,   491,   494,   495,   478,     0,     0,   500,    50,
+       0,     0,   375,     0,   395,     0,   422,     0,     0,   146,
+     147,   148,   149,   145,   151,   153,   155,   164,   166,   176,
+     243,   314,   349,     0,   288,   208,   488,   489,   490,   487,
+     493,   504,   506,    54,   377,   397,   424,   457,   571,     0,
+     569,   290,     0,     0,   568,   583,     0,   581,   579,   575,
+       0,   573,   577,   578,   576,   570,     0,     0,     0,     0,
+     572,     0,   580,     0,   574,     0,   582,   587,     0,   585,
+       0,     0,   584,   595,     0,     0,     0,     0,   589,   591,
+     592,   593,   594,   586,     0,     0,     0,     0,     0,   588,
+       0,   597,   598,   599,   590,   596
   };
 
   const short int
   Dhcp6Parser::yypgoto_[] =
   {
-    -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,
-    -707,  -707,  -707,  -707,  -707,    12,  -707,    56,  -707,  -707,
-    -707,  -707,  -707,  -707,    90,  -707,  -132,  -707,  -707,  -707,
-     -66,  -707,  -707,  -707,   279,  -707,  -707,  -707,  -707,    27,
-     265,   -62,   -50,   -49,   -48,  -707,  -707,  -707,  -707,  -707,
-      99,   273,  -707,  -707,  -707,  -707,  -707,  -707,  -707,   103,
-    -104,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,
-    -707,   -74,  -707,  -520,  -707,  -707,  -707,  -707,  -707,  -707,
-    -707,  -707,  -707,  -707,  -114,  -507,  -707,  -707,  -707,  -707,
-    -116,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -121,
-    -707,  -707,  -707,  -118,   237,  -707,  -707,  -707,  -707,  -707,
-    -707,  -707,  -125,  -707,  -707,  -707,  -707,  -707,  -707,  -706,
-    -707,  -707,  -707,   -98,  -707,  -707,  -707,   -93,   283,  -707,
-    -707,  -704,  -707,  -686,  -707,  -518,  -707,  -681,  -707,  -707,
-    -707,  -680,  -707,  -707,  -707,  -707,  -103,  -707,  -707,  -229,
-     566,  -707,  -707,  -707,  -707,  -707,   -92,  -707,  -707,  -707,
-     -91,  -707,   257,  -707,   -73,  -707,  -707,  -707,  -707,  -707,
-     -61,  -707,  -707,  -707,  -707,  -707,   -54,  -707,  -707,  -707,
-     -90,  -707,  -707,  -707,   -89,  -707,   253,  -707,  -707,  -707,
-    -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -129,  -707,
-    -707,  -707,  -130,   291,  -707,  -707,   -45,  -707,  -707,  -707,
-    -707,  -707,  -127,  -707,  -707,  -707,  -123,   292,  -707,  -707,
-    -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -126,
-    -707,  -707,  -707,  -122,  -707,   310,  -707,  -707,  -707,  -707,
-    -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,
-    -674,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,
-     127,  -707,  -707,  -707,  -707,  -707,  -707,   -86,  -707,  -707,
-    -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,
-     -95,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,   147,
-     275,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,
-    -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,
-    -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,  -707,
-    -707,  -707,  -707,   -21,  -707,  -707,  -707,  -194,  -707,  -707,
-    -204,  -707,  -707,  -707,  -707,  -707,  -707,  -215,  -707,  -707,
-    -231,  -707,  -707,  -707,  -707,  -707
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,    12,  -747,   171,  -747,  -747,
+    -747,  -747,  -747,  -747,   126,  -747,  -136,  -747,  -747,  -747,
+     -66,  -747,  -747,  -747,   343,  -747,  -747,  -747,  -747,   141,
+     327,   -62,   -50,   -49,   -48,  -747,  -747,  -747,  -747,  -747,
+     137,   325,  -747,  -747,  -747,  -747,  -747,  -747,  -747,   136,
+    -108,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,   -74,  -747,  -520,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -122,
+    -507,  -747,  -747,  -747,  -747,  -121,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -125,  -747,  -747,  -747,  -120,   274,
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,  -130,  -747,  -747,
+    -747,  -747,  -747,  -747,  -746,  -747,  -747,  -747,  -102,  -747,
+    -747,  -747,   -99,   326,  -747,  -747,  -745,  -747,  -741,  -747,
+    -518,  -747,  -740,  -747,  -747,  -747,  -738,  -747,  -747,  -747,
+    -747,  -109,  -747,  -747,  -250,   610,  -747,  -747,  -747,  -747,
+    -747,  -101,  -747,  -747,  -747,   -98,  -747,   291,  -747,   -73,
+    -747,  -747,  -747,  -747,  -747,   -61,  -747,  -747,  -747,  -747,
+    -747,   -54,  -747,  -747,  -747,   -96,  -747,  -747,  -747,   -97,
+    -747,   299,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -138,  -747,  -747,  -747,  -132,   328,  -747,
+    -747,   -45,  -747,  -747,  -747,  -747,  -747,  -133,  -747,  -747,
+    -747,  -134,   329,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -106,  -747,  -747,  -747,  -131,  -747,
+     344,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,  -737,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,   186,  -747,  -747,  -747,  -747,
+    -747,  -747,   -78,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,   -81,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,   197,   335,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,    -6,  -747,
+    -747,  -747,  -209,  -747,  -747,  -224,  -747,  -747,  -747,  -747,
+    -747,  -747,  -235,  -747,  -747,  -251,  -747,  -747,  -747,  -747,
+    -747
   };
 
   const short int
@@ -3795,128 +3944,136 @@ namespace isc { namespace dhcp {
   {
       -1,    14,    15,    16,    17,    18,    19,    20,    21,    22,
       23,    24,    25,    26,    27,    78,    37,    38,    65,   544,
-      82,    83,    39,    64,    79,    80,   537,   692,   771,   772,
+      82,    83,    39,    64,    79,    80,   537,   720,   813,   814,
      120,    41,    66,    91,    92,    93,   306,    43,    67,   121,
      122,   123,   124,   125,   126,   127,   128,   314,    45,    68,
-     147,   148,   149,   338,   150,   129,   315,   130,   316,   606,
-     607,   608,   714,   857,   609,   715,   610,   716,   611,   717,
-     612,   234,   378,   614,   615,   616,   617,   618,   723,   619,
-     724,   131,   326,   639,   640,   641,   642,   132,   328,   647,
-     648,   649,   650,   133,   327,   134,   330,   654,   655,   656,
-     747,    61,    76,   266,   267,   268,   391,   269,   392,   135,
-     331,   663,   664,   665,   666,   667,   668,   669,   670,   136,
-     322,   622,   623,   624,   728,    47,    69,   169,   170,   171,
-     346,   172,   347,   173,   348,   174,   352,   175,   351,   551,
-     176,   177,   137,   325,   634,   635,   636,   737,   817,   818,
-     138,   323,    55,    73,   626,   627,   628,   731,    57,    74,
-     235,   236,   237,   238,   239,   240,   241,   377,   242,   381,
-     243,   380,   244,   245,   382,   246,   139,   324,   630,   631,
-     632,   734,    59,    75,   254,   255,   256,   257,   258,   386,
-     259,   260,   261,   262,   179,   343,   696,   697,   698,   774,
-      49,    70,   187,   188,   189,   357,   180,   345,   181,   344,
-     700,   701,   702,   777,    51,    71,   199,   200,   201,   360,
-     202,   203,   362,   204,   205,   182,   353,   704,   705,   706,
-     780,    53,    72,   215,   216,   217,   218,   368,   219,   369,
-     220,   370,   221,   371,   222,   372,   223,   373,   224,   367,
-     183,   354,   708,   783,   140,   329,   652,   342,   450,   451,
-     452,   453,   454,   538,   141,   332,   678,   679,   680,   758,
-     872,   681,   682,   759,   683,   684,   142,   143,   334,   687,
-     688,   689,   765,   690,   766,   144,   335,    63,    77,   285,
-     286,   287,   288,   396,   289,   397,   290,   291,   399,   292,
-     293,   294,   402,   578,   295,   403,   296,   297,   298,   299,
-     407,   585,   300,   408,    94,   308,    95,   309,    96,   310,
-      97,   307,   590,   591,   592,   710,   882,   883,   885,   893,
-     894,   895,   896,   901,   897,   899,   911,   912,   913,   920,
-     921,   922,   927,   923,   924,   925
+     147,   148,   149,   338,   150,   129,   315,   130,   316,   620,
+     621,   622,   742,   913,   623,   743,   624,   744,   625,   745,
+     626,   234,   378,   628,   629,   630,   631,   632,   751,   633,
+     752,   634,   635,   636,   637,   638,   639,   640,   641,   642,
+     761,   643,   644,   645,   646,   647,   131,   326,   667,   668,
+     669,   670,   132,   328,   675,   676,   677,   678,   133,   327,
+     134,   330,   682,   683,   684,   789,    61,    76,   266,   267,
+     268,   391,   269,   392,   135,   331,   691,   692,   693,   694,
+     695,   696,   697,   698,   136,   322,   650,   651,   652,   770,
+      47,    69,   169,   170,   171,   346,   172,   347,   173,   348,
+     174,   352,   175,   351,   551,   176,   177,   137,   325,   662,
+     663,   664,   779,   873,   874,   138,   323,    55,    73,   654,
+     655,   656,   773,    57,    74,   235,   236,   237,   238,   239,
+     240,   241,   377,   242,   381,   243,   380,   244,   245,   382,
+     246,   139,   324,   658,   659,   660,   776,    59,    75,   254,
+     255,   256,   257,   258,   386,   259,   260,   261,   262,   179,
+     343,   724,   725,   726,   816,    49,    70,   187,   188,   189,
+     357,   180,   345,   181,   344,   728,   729,   730,   819,    51,
+      71,   199,   200,   201,   360,   202,   203,   362,   204,   205,
+     182,   353,   732,   733,   734,   822,    53,    72,   215,   216,
+     217,   218,   368,   219,   369,   220,   370,   221,   371,   222,
+     372,   223,   373,   224,   367,   183,   354,   736,   825,   140,
+     329,   680,   342,   450,   451,   452,   453,   454,   538,   141,
+     332,   706,   707,   708,   800,   929,   709,   710,   801,   711,
+     712,   142,   143,   334,   715,   716,   717,   807,   718,   808,
+     144,   335,    63,    77,   285,   286,   287,   288,   396,   289,
+     397,   290,   291,   399,   292,   293,   294,   402,   578,   295,
+     403,   296,   297,   298,   299,   407,   585,   300,   408,    94,
+     308,    95,   309,    96,   310,    97,   307,   590,   591,   592,
+     738,   939,   940,   942,   950,   951,   952,   953,   958,   954,
+     956,   968,   969,   970,   977,   978,   979,   984,   980,   981,
+     982
   };
 
   const unsigned short int
   Dhcp6Parser::yytable_[] =
   {
       90,   251,   252,   164,   185,   196,   213,   165,   233,   250,
-     265,   284,   651,   677,   253,   178,   186,   197,   214,   166,
-     167,   168,   646,   151,    84,   190,   198,    36,    29,   594,
-      30,   811,    31,   812,   595,   596,   597,   598,   599,   600,
-     601,   602,   603,   604,   671,    28,   637,   101,   102,   103,
-     104,   813,   227,   599,   108,   151,   815,   816,   108,   227,
-     263,   264,   312,   820,   152,   151,   153,   313,    40,   226,
-     263,   264,   154,   155,   156,   157,   158,   159,   160,   101,
-     102,   103,   104,    42,   106,   336,   108,   227,   161,   162,
-     337,   446,   227,    44,   228,   229,   163,   340,   230,   231,
-     232,   108,   341,   355,   227,   108,   156,   157,   356,   159,
-     160,   108,   576,   577,   191,   192,   193,   194,   195,   154,
-     161,   638,   184,    46,   672,   673,   674,   675,   163,   154,
-     161,    48,    98,    50,   358,    99,   100,   206,    89,   359,
-      85,   207,   208,   209,   210,   211,   212,   145,   146,    86,
-      87,    88,   101,   102,   103,   104,   105,   106,   107,   108,
-     811,   365,   812,   393,    89,    89,   366,    89,   394,   637,
-     644,    89,   645,    52,    32,    33,    34,    35,   916,    89,
-     813,   917,   918,   919,    54,   815,   816,   109,   110,   111,
-     112,   113,   820,   888,    56,   889,   890,   409,   740,    89,
-     336,   741,   410,   114,    89,   709,   115,   580,   581,   582,
-     583,    58,   711,   116,    89,   340,    89,   712,    89,   814,
-     713,   117,   118,   743,    89,   119,   744,   824,   227,   247,
-     228,   229,   248,   249,    60,   725,   646,   725,   745,   584,
-     726,   746,   727,   677,   886,    62,    90,   887,   270,   271,
-     272,   273,   274,   275,   276,   277,   278,   279,   280,   281,
-     282,   283,   657,   658,   659,   660,   661,   662,   448,   756,
-     763,    81,    89,   767,   757,   764,   447,   409,   768,   355,
-     866,   393,   769,   107,   863,   867,   868,   301,   449,   164,
-     358,   365,   185,   165,    89,   877,   878,   902,   931,   196,
-     302,   178,   903,   932,   186,   166,   167,   168,   303,   213,
-     304,   197,   305,   190,   411,   412,   251,   252,   311,   233,
-     198,   214,   317,   318,   250,   853,   854,   855,   856,   253,
-     914,   685,   686,   915,   548,   549,   550,   869,   870,   871,
-      89,   319,   320,   284,   558,   559,   560,   321,   814,     1,
-       2,     3,     4,     5,     6,     7,     8,     9,    10,    11,
-      12,    13,   333,   339,   349,   350,   361,   363,   364,   375,
-     413,   444,   379,   374,   383,   376,   385,   384,   387,   388,
-     389,   390,   423,   395,   398,   400,   401,   404,   405,   406,
-     414,   415,   416,   417,   418,   420,   421,   422,   428,   424,
-     425,   426,   427,   429,   430,   431,   432,   433,   434,   435,
-     436,   437,   438,   439,   440,   441,   443,   455,   456,   457,
-     458,   459,   460,   462,   461,   463,   464,   465,   517,   518,
-     519,   466,   468,   470,   471,   472,   473,   474,   476,   477,
-     478,   479,   480,   481,   482,   484,   485,   613,   613,   487,
-     486,   488,   489,   490,   492,   605,   605,   493,   496,   494,
-     497,   499,   500,   501,   502,   503,   448,   676,   504,   284,
-     506,   507,   505,   511,   447,   508,   509,   510,   512,   514,
-     515,   545,   540,   516,   520,   521,   449,   522,   523,   524,
-     525,   526,   527,   528,   529,   530,   531,   546,   547,   532,
-     533,   534,   535,   536,   539,   541,   542,   552,   555,   572,
-      30,   553,   554,   543,   621,   625,   629,   633,   653,   693,
-     695,   699,   556,   703,   718,   719,   587,   557,   561,   720,
-     707,   721,   722,   730,   784,   729,   733,   732,   735,   736,
-     738,   739,   588,   742,   749,   748,   562,   563,   564,   565,
-     750,   751,   752,   753,   754,   755,   760,   761,   762,   776,
-     566,   775,   779,   778,   579,   782,   781,   785,   787,   788,
-     567,   568,   789,   589,   790,   569,   570,   571,   796,   797,
-     834,   573,   835,   574,   575,   840,   841,   844,   864,   843,
-     851,   419,   852,   865,   908,   586,   879,   881,   900,   904,
-     906,   442,   770,   773,   910,   791,   928,   929,   930,   792,
-     933,   794,   793,   445,   795,   827,   828,   829,   643,   593,
-     830,   798,   831,   832,   836,   620,   822,   823,   826,   825,
-     498,   833,   800,   837,   838,   799,   821,   884,   467,   225,
-     801,   802,   491,   495,   845,   803,   804,   846,   858,   469,
-     859,   613,   848,   860,   847,   861,   850,   475,   849,   605,
-     251,   252,   164,   810,   905,   233,   165,   694,   250,   862,
-     873,   805,   842,   253,   178,   806,   934,   839,   166,   167,
-     168,   265,   691,   819,   513,   483,   874,   807,   808,   809,
-     786,   875,   898,   876,   880,   909,   938,   676,   907,   926,
-     937,     0,     0,     0,     0,     0,     0,     0,   185,     0,
-     935,   196,     0,   936,   213,     0,     0,     0,     0,     0,
-     186,     0,     0,   197,     0,     0,   214,     0,     0,   190,
-       0,     0,   198,     0,     0,     0,     0,     0,     0,     0,
+     265,   284,   679,   705,   253,   178,   186,   197,   214,   166,
+     167,   168,   674,   151,    84,   190,   198,    36,    29,    28,
+      30,   699,    31,   867,   868,   108,   108,   151,   869,   871,
+     599,   872,   876,   665,   108,   227,    40,   108,    42,   191,
+     192,   193,   194,   195,   154,   151,   665,   672,   184,   673,
+      81,   101,   102,   103,   104,   154,    44,   206,   108,   226,
+      46,   207,   208,   209,   210,   211,   212,   446,   152,    48,
+     153,   782,   263,   264,   783,   107,   154,   155,   156,   157,
+     158,   159,   160,   101,   102,   103,   104,    50,   106,    52,
+     108,   227,   161,   162,   227,    54,   227,    56,   228,   229,
+     163,    58,   230,   231,   232,    60,   161,   312,   666,    62,
+     156,   157,   313,   159,   160,   700,   701,   702,   703,   548,
+     549,   550,    98,   336,   161,    99,   100,   785,   337,   301,
+     786,   302,   163,   580,   581,   582,   583,   340,    89,    89,
+      89,   355,   341,   358,    85,   303,   356,    89,   359,   787,
+      89,   305,   788,    86,    87,    88,   101,   102,   103,   104,
+     105,   106,   107,   108,   304,   584,   311,   867,   868,    89,
+      89,    89,   869,   871,   317,   872,   876,   365,    32,    33,
+      34,    35,   366,   945,   393,   946,   947,   943,   374,   394,
+     944,   109,   110,   111,   112,   113,   227,   247,   228,   229,
+     248,   249,   971,    89,   318,   972,    89,   114,    89,   973,
+     115,   409,   974,   975,   976,   319,   410,   116,   685,   686,
+     687,   688,   689,   690,   320,   117,   118,   336,   739,   119,
+     340,   375,   737,   740,   321,   741,    90,     1,     2,     3,
+       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
+     767,   870,   767,   145,   146,   768,   798,   769,   448,   880,
+     805,   799,   809,   376,   409,   806,   447,   810,   674,   811,
+     263,   264,   355,   713,   714,   705,    89,   920,   449,   164,
+     923,   393,   185,   165,   333,   924,   925,   358,   365,   196,
+     339,   178,   934,   935,   186,   166,   167,   168,   349,   213,
+     350,   197,   361,   190,   411,   412,   251,   252,    89,   233,
+     198,   214,   959,   988,   250,   576,   577,   960,   989,   253,
+     909,   910,   911,   912,   926,   927,   928,   363,   364,   594,
+     558,   559,   560,   284,   595,   596,   597,   598,   599,   600,
+     601,   602,   603,   604,   605,   606,   607,   608,   609,   610,
+     611,   612,   613,   614,   615,   616,   617,   618,   379,   383,
+     384,   385,   413,   387,   388,   389,   227,   270,   271,   272,
+     273,   274,   275,   276,   277,   278,   279,   280,   281,   282,
+     283,   390,   423,   395,   398,   400,   401,   404,   405,   406,
+     414,   415,   416,   417,   418,   870,   420,   421,   422,   424,
+     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
+     435,   436,   437,    89,   438,   440,   439,   441,   517,   518,
+     519,   443,   444,   455,   456,   457,   458,   459,   460,   461,
+     462,   463,   464,   465,   466,   468,   470,   627,   627,   471,
+     472,   473,   474,   476,   477,   619,   619,   478,   479,   480,
+     481,   482,   484,   485,   486,   487,   448,   704,   488,   284,
+     489,   490,   492,   493,   447,   494,   496,   497,   499,   500,
+     501,   502,   503,   504,   505,   506,   449,   507,    89,   508,
+     509,   511,   510,   512,   514,   515,   545,   546,   516,   520,
+     521,   522,   523,   524,   525,   526,   527,   528,   529,   572,
+     530,   531,   539,   547,   532,   533,   534,   535,   536,   540,
+     541,    30,   542,   552,   553,   554,   587,   649,   555,   653,
+     657,   556,   661,   681,   721,   723,   557,   561,   562,   563,
+     564,   565,   566,   567,   568,   569,   570,   571,   573,   574,
+     575,   586,   727,   731,   579,   735,   746,   747,   748,   749,
+     750,   753,   754,   589,   755,   756,   757,   758,   759,   760,
+     762,   763,   764,   765,   766,   772,   834,   771,   775,   774,
+     777,   778,   780,   781,   938,   784,   791,   790,   792,   793,
+     794,   795,   796,   797,   802,   803,   804,   818,   821,   817,
+     812,   815,   820,   823,   824,   899,   826,   827,   829,   830,
+     831,   832,   836,   833,   835,   838,   839,   837,   848,   890,
+     840,   891,   896,   897,   900,   908,   907,   957,   543,   842,
+     841,   843,   921,   844,   922,   936,   846,   845,   961,   963,
+     847,   965,   985,   849,   967,   850,   851,   986,   852,   987,
+     853,   883,   884,   990,   671,   419,   588,   593,   648,   854,
+     878,   885,   886,   442,   879,   445,   882,   498,   889,   881,
+     856,   855,   877,   941,   858,   857,   491,   887,   888,   859,
+     902,   467,   860,   225,   901,   903,   469,   892,   904,   495,
+     893,   905,   914,   627,   475,   894,   915,   916,   917,   918,
+     919,   619,   251,   252,   164,   866,   930,   233,   165,   931,
+     250,   991,   932,   861,   933,   253,   178,   862,   906,   483,
+     166,   167,   168,   265,   937,   875,   722,   895,   898,   863,
+     864,   865,   719,   828,   955,   964,   983,   994,     0,   704,
+       0,     0,     0,     0,   513,     0,     0,     0,   962,     0,
+     185,     0,     0,   196,     0,     0,   213,     0,     0,     0,
+       0,     0,   186,     0,     0,   197,   992,   966,   214,     0,
+       0,   190,     0,   995,   198,   993,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   810,     0,     0,     0,     0,     0,     0,     0,
-     805,     0,     0,     0,   806,     0,     0,     0,     0,     0,
-       0,   892,   819,     0,     0,     0,   807,   808,   809,   891,
-       0,     0,     0,     0,     0,     0,     0,     0,   892,     0,
-       0,     0,     0,     0,     0,     0,   891
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   866,
+       0,     0,     0,     0,     0,     0,     0,   861,     0,     0,
+       0,   862,     0,     0,     0,     0,     0,     0,   949,   875,
+       0,     0,     0,   863,   864,   865,   948,     0,     0,     0,
+       0,     0,     0,     0,     0,   949,     0,     0,     0,     0,
+       0,     0,     0,   948
   };
 
   const short int
@@ -3924,250 +4081,264 @@ namespace isc { namespace dhcp {
   {
       66,    75,    75,    69,    70,    71,    72,    69,    74,    75,
       76,    77,   530,   533,    75,    69,    70,    71,    72,    69,
-      69,    69,   529,     7,    10,    70,    71,    15,     5,    16,
-       7,   737,     9,   737,    21,    22,    23,    24,    25,    26,
-      27,    28,    29,    30,    16,     0,    76,    31,    32,    33,
-      34,   737,    39,    25,    38,     7,   737,   737,    38,    39,
-      83,    84,     3,   737,    48,     7,    50,     8,     7,    16,
-      83,    84,    56,    57,    58,    59,    60,    61,    62,    31,
-      32,    33,    34,     7,    36,     3,    38,    39,    72,    73,
-       8,    71,    39,     7,    41,    42,    80,     3,    45,    46,
-      47,    38,     8,     3,    39,    38,    58,    59,     8,    61,
-      62,    38,   119,   120,    51,    52,    53,    54,    55,    56,
-      72,   151,    49,     7,    96,    97,    98,    99,    80,    56,
-      72,     7,    11,     7,     3,    14,    15,    70,   151,     8,
-     126,    74,    75,    76,    77,    78,    79,    12,    13,   135,
-     136,   137,    31,    32,    33,    34,    35,    36,    37,    38,
-     866,     3,   866,     3,   151,   151,     8,   151,     8,    76,
-      77,   151,    79,     7,   151,   152,   153,   154,   129,   151,
-     866,   132,   133,   134,     7,   866,   866,    66,    67,    68,
-      69,    70,   866,   128,     7,   130,   131,     3,     3,   151,
-       3,     6,     8,    82,   151,     8,    85,   122,   123,   124,
-     125,     7,     3,    92,   151,     3,   151,     8,   151,   737,
-       8,   100,   101,     3,   151,   104,     6,   745,    39,    40,
-      41,    42,    43,    44,     7,     3,   743,     3,     3,   154,
-       8,     6,     8,   763,     3,     7,   312,     6,   105,   106,
-     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
-     117,   118,    86,    87,    88,    89,    90,    91,   342,     3,
-       3,   151,   151,     3,     8,     8,   342,     3,     8,     3,
-       3,     3,     8,    37,     8,     8,     8,     6,   342,   355,
-       3,     3,   358,   355,   151,     8,     8,     3,     3,   365,
-       3,   355,     8,     8,   358,   355,   355,   355,     4,   375,
-       8,   365,     3,   358,   302,   303,   390,   390,     4,   385,
-     365,   375,     4,     4,   390,    17,    18,    19,    20,   390,
-       3,   102,   103,     6,    63,    64,    65,    93,    94,    95,
-     151,     4,     4,   409,   476,   477,   478,     4,   866,   138,
-     139,   140,   141,   142,   143,   144,   145,   146,   147,   148,
-     149,   150,     4,     4,     4,     4,     4,     4,     4,     3,
-     151,   154,     4,     8,     4,     8,     3,     8,     4,     4,
-       8,     3,   152,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,     4,     4,     4,     4,   152,
-     152,   152,   152,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,   152,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,   154,   152,     4,     4,     4,   416,   417,
-     418,     4,     4,     4,   152,     4,   152,   152,     4,     4,
-       4,     4,     4,     4,     4,     4,     4,   521,   522,     4,
-     152,     4,     4,   154,     4,   521,   522,   154,     4,   154,
-       4,   154,     4,     4,   152,     4,   540,   533,   152,   535,
-       4,     4,   152,     4,   540,   154,   154,   154,     4,     4,
-       7,   151,     3,     7,     7,     7,   540,     7,     5,     5,
-       5,     5,     5,     5,     5,     5,     5,   151,   151,     7,
-       7,     7,     7,     5,     8,     5,     5,   151,   151,   497,
-       7,     5,     7,   457,     7,     7,     7,     7,     7,     4,
-       7,     7,   151,     7,     4,     4,   514,   151,   151,     4,
-      81,     4,     4,     3,     8,     6,     3,     6,     6,     3,
-       6,     3,   515,     6,     3,     6,   151,   151,   151,   151,
-       4,     4,     4,     4,     4,     4,     4,     4,     4,     3,
-     151,     6,     3,     6,   121,     3,     6,     4,     4,     4,
-     151,   151,     4,   127,     4,   151,   151,   151,     4,     4,
-       4,   151,     4,   151,   151,     4,     4,     3,     8,     6,
-       4,   312,     5,     8,     5,   151,     8,     7,     4,     4,
-       4,   336,   151,   151,     7,   152,     4,     4,     4,   154,
-       4,   154,   152,   340,   152,   152,   152,   152,   528,   520,
-     152,   725,   152,   152,   152,   522,   740,   743,   749,   747,
-     393,   756,   730,   152,   152,   728,   739,   866,   355,    73,
-     731,   733,   385,   390,   774,   734,   736,   776,   151,   358,
-     151,   725,   779,   151,   777,   151,   782,   365,   780,   725,
-     734,   734,   728,   737,   152,   731,   728,   540,   734,   151,
-     151,   737,   767,   734,   728,   737,   154,   763,   728,   728,
-     728,   747,   535,   737,   409,   375,   151,   737,   737,   737,
-     711,   151,   886,   151,   151,   151,   151,   763,   902,   914,
-     931,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   774,    -1,
-     152,   777,    -1,   152,   780,    -1,    -1,    -1,    -1,    -1,
-     774,    -1,    -1,   777,    -1,    -1,   780,    -1,    -1,   774,
-      -1,    -1,   777,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      69,    69,   529,     7,    10,    70,    71,    15,     5,     0,
+       7,    16,     9,   779,   779,    52,    52,     7,   779,   779,
+      25,   779,   779,    90,    52,    53,     7,    52,     7,    65,
+      66,    67,    68,    69,    70,     7,    90,    91,    63,    93,
+     165,    45,    46,    47,    48,    70,     7,    84,    52,    16,
+       7,    88,    89,    90,    91,    92,    93,    85,    62,     7,
+      64,     3,    97,    98,     6,    51,    70,    71,    72,    73,
+      74,    75,    76,    45,    46,    47,    48,     7,    50,     7,
+      52,    53,    86,    87,    53,     7,    53,     7,    55,    56,
+      94,     7,    59,    60,    61,     7,    86,     3,   165,     7,
+      72,    73,     8,    75,    76,   110,   111,   112,   113,    77,
+      78,    79,    11,     3,    86,    14,    15,     3,     8,     6,
+       6,     3,    94,   136,   137,   138,   139,     3,   165,   165,
+     165,     3,     8,     3,   140,     4,     8,   165,     8,     3,
+     165,     3,     6,   149,   150,   151,    45,    46,    47,    48,
+      49,    50,    51,    52,     8,   168,     4,   923,   923,   165,
+     165,   165,   923,   923,     4,   923,   923,     3,   165,   166,
+     167,   168,     8,   142,     3,   144,   145,     3,     8,     8,
+       6,    80,    81,    82,    83,    84,    53,    54,    55,    56,
+      57,    58,     3,   165,     4,     6,   165,    96,   165,   143,
+      99,     3,   146,   147,   148,     4,     8,   106,   100,   101,
+     102,   103,   104,   105,     4,   114,   115,     3,     3,   118,
+       3,     3,     8,     8,     4,     8,   312,   152,   153,   154,
+     155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
+       3,   779,     3,    12,    13,     8,     3,     8,   342,   787,
+       3,     8,     3,     8,     3,     8,   342,     8,   785,     8,
+      97,    98,     3,   116,   117,   805,   165,     8,   342,   355,
+       3,     3,   358,   355,     4,     8,     8,     3,     3,   365,
+       4,   355,     8,     8,   358,   355,   355,   355,     4,   375,
+       4,   365,     4,   358,   302,   303,   390,   390,   165,   385,
+     365,   375,     3,     3,   390,   133,   134,     8,     8,   390,
+      17,    18,    19,    20,   107,   108,   109,     4,     4,    16,
+     476,   477,   478,   409,    21,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    42,    43,    44,     4,     4,
+       8,     3,   165,     4,     4,     8,    53,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,     3,   166,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,   923,     4,     4,     4,   166,
+     166,   166,   166,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,   165,     4,     4,   166,     4,   416,   417,
+     418,     4,   168,     4,     4,     4,     4,     4,     4,   166,
+     168,     4,     4,     4,     4,     4,     4,   521,   522,   166,
+       4,   166,   166,     4,     4,   521,   522,     4,     4,     4,
+       4,     4,     4,     4,   166,     4,   540,   533,     4,   535,
+       4,   168,     4,   168,   540,   168,     4,     4,   168,     4,
+       4,   166,     4,   166,   166,     4,   540,     4,   165,   168,
+     168,     4,   168,     4,     4,     7,   165,   165,     7,     7,
+       7,     7,     5,     5,     5,     5,     5,     5,     5,   497,
+       5,     5,     8,   165,     7,     7,     7,     7,     5,     3,
+       5,     7,     5,   165,     5,     7,   514,     7,   165,     7,
+       7,   165,     7,     7,     4,     7,   165,   165,   165,   165,
+     165,   165,   165,   165,   165,   165,   165,   165,   165,   165,
+     165,   165,     7,     7,   135,    95,     4,     4,     4,     4,
+       4,     4,     4,   141,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,     3,   168,     6,     3,     6,
+       6,     3,     6,     3,     7,     6,     3,     6,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     3,     3,     6,
+     165,   165,     6,     6,     3,     6,     8,     4,     4,     4,
+       4,     4,   168,   166,   166,     4,     4,   166,     4,     4,
+     168,     4,     4,     4,     3,     5,     4,     4,   457,   166,
+     168,   166,     8,   166,     8,     8,   166,   168,     4,     4,
+     166,     5,     4,   166,     7,   166,   166,     4,   166,     4,
+     166,   166,   166,     4,   528,   312,   515,   520,   522,   767,
+     782,   166,   166,   336,   785,   340,   791,   393,   798,   789,
+     772,   770,   781,   923,   775,   773,   385,   166,   166,   776,
+     818,   355,   778,    73,   816,   819,   358,   166,   821,   390,
+     166,   822,   165,   767,   365,   166,   165,   165,   165,   165,
+     165,   767,   776,   776,   770,   779,   165,   773,   770,   165,
+     776,   168,   165,   779,   165,   776,   770,   779,   824,   375,
+     770,   770,   770,   789,   165,   779,   540,   805,   809,   779,
+     779,   779,   535,   739,   943,   959,   971,   988,    -1,   805,
+      -1,    -1,    -1,    -1,   409,    -1,    -1,    -1,   166,    -1,
+     816,    -1,    -1,   819,    -1,    -1,   822,    -1,    -1,    -1,
+      -1,    -1,   816,    -1,    -1,   819,   166,   165,   822,    -1,
+      -1,   816,    -1,   165,   819,   166,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   866,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     866,    -1,    -1,    -1,   866,    -1,    -1,    -1,    -1,    -1,
-      -1,   885,   866,    -1,    -1,    -1,   866,   866,   866,   885,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   902,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   902
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   923,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   923,    -1,    -1,
+      -1,   923,    -1,    -1,    -1,    -1,    -1,    -1,   942,   923,
+      -1,    -1,    -1,   923,   923,   923,   942,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   959,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   959
   };
 
   const unsigned short int
   Dhcp6Parser::yystos_[] =
   {
-       0,   138,   139,   140,   141,   142,   143,   144,   145,   146,
-     147,   148,   149,   150,   156,   157,   158,   159,   160,   161,
-     162,   163,   164,   165,   166,   167,   168,   169,     0,     5,
-       7,     9,   151,   152,   153,   154,   170,   171,   172,   177,
-       7,   186,     7,   192,     7,   203,     7,   280,     7,   355,
-       7,   369,     7,   386,     7,   307,     7,   313,     7,   337,
-       7,   256,     7,   442,   178,   173,   187,   193,   204,   281,
-     356,   370,   387,   308,   314,   338,   257,   443,   170,   179,
-     180,   151,   175,   176,    10,   126,   135,   136,   137,   151,
-     185,   188,   189,   190,   469,   471,   473,   475,    11,    14,
-      15,    31,    32,    33,    34,    35,    36,    37,    38,    66,
-      67,    68,    69,    70,    82,    85,    92,   100,   101,   104,
-     185,   194,   195,   196,   197,   198,   199,   200,   201,   210,
-     212,   236,   242,   248,   250,   264,   274,   297,   305,   331,
-     409,   419,   431,   432,   440,    12,    13,   205,   206,   207,
-     209,     7,    48,    50,    56,    57,    58,    59,    60,    61,
-      62,    72,    73,    80,   185,   196,   197,   198,   199,   282,
-     283,   284,   286,   288,   290,   292,   295,   296,   331,   349,
-     361,   363,   380,   405,    49,   185,   331,   357,   358,   359,
-     361,    51,    52,    53,    54,    55,   185,   331,   361,   371,
-     372,   373,   375,   376,   378,   379,    70,    74,    75,    76,
-      77,    78,    79,   185,   331,   388,   389,   390,   391,   393,
-     395,   397,   399,   401,   403,   305,    16,    39,    41,    42,
-      45,    46,    47,   185,   226,   315,   316,   317,   318,   319,
-     320,   321,   323,   325,   327,   328,   330,    40,    43,    44,
-     185,   226,   319,   325,   339,   340,   341,   342,   343,   345,
-     346,   347,   348,    83,    84,   185,   258,   259,   260,   262,
-     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
-     115,   116,   117,   118,   185,   444,   445,   446,   447,   449,
-     451,   452,   454,   455,   456,   459,   461,   462,   463,   464,
-     467,     6,     3,     4,     8,     3,   191,   476,   470,   472,
-     474,     4,     3,     8,   202,   211,   213,     4,     4,     4,
-       4,     4,   275,   306,   332,   298,   237,   249,   243,   410,
-     251,   265,   420,     4,   433,   441,     3,     8,   208,     4,
-       3,     8,   412,   350,   364,   362,   285,   287,   289,     4,
-       4,   293,   291,   381,   406,     3,     8,   360,     3,     8,
-     374,     4,   377,     4,     4,     3,     8,   404,   392,   394,
-     396,   398,   400,   402,     8,     3,     8,   322,   227,     4,
-     326,   324,   329,     4,     8,     3,   344,     4,     4,     8,
-       3,   261,   263,     3,     8,     4,   448,   450,     4,   453,
-       4,     4,   457,   460,     4,     4,     4,   465,   468,     3,
-       8,   170,   170,   151,     4,     4,     4,     4,     4,   189,
-       4,     4,     4,   152,   152,   152,   152,   152,     4,     4,
-       4,     4,     4,     4,     4,     4,     4,     4,     4,   152,
-       4,     4,   195,     4,   154,   206,    71,   185,   226,   331,
-     413,   414,   415,   416,   417,     4,     4,     4,     4,     4,
-       4,   152,   154,     4,     4,     4,     4,   283,     4,   358,
-       4,   152,     4,   152,   152,   372,     4,     4,     4,     4,
-       4,     4,     4,   390,     4,     4,   152,     4,     4,     4,
-     154,   317,     4,   154,   154,   341,     4,     4,   259,   154,
-       4,     4,   152,     4,   152,   152,     4,     4,   154,   154,
-     154,     4,     4,   445,     4,     7,     7,   170,   170,   170,
+       0,   152,   153,   154,   155,   156,   157,   158,   159,   160,
+     161,   162,   163,   164,   170,   171,   172,   173,   174,   175,
+     176,   177,   178,   179,   180,   181,   182,   183,     0,     5,
+       7,     9,   165,   166,   167,   168,   184,   185,   186,   191,
+       7,   200,     7,   206,     7,   217,     7,   309,     7,   384,
+       7,   398,     7,   415,     7,   336,     7,   342,     7,   366,
+       7,   285,     7,   471,   192,   187,   201,   207,   218,   310,
+     385,   399,   416,   337,   343,   367,   286,   472,   184,   193,
+     194,   165,   189,   190,    10,   140,   149,   150,   151,   165,
+     199,   202,   203,   204,   498,   500,   502,   504,    11,    14,
+      15,    45,    46,    47,    48,    49,    50,    51,    52,    80,
+      81,    82,    83,    84,    96,    99,   106,   114,   115,   118,
+     199,   208,   209,   210,   211,   212,   213,   214,   215,   224,
+     226,   265,   271,   277,   279,   293,   303,   326,   334,   360,
+     438,   448,   460,   461,   469,    12,    13,   219,   220,   221,
+     223,     7,    62,    64,    70,    71,    72,    73,    74,    75,
+      76,    86,    87,    94,   199,   210,   211,   212,   213,   311,
+     312,   313,   315,   317,   319,   321,   324,   325,   360,   378,
+     390,   392,   409,   434,    63,   199,   360,   386,   387,   388,
+     390,    65,    66,    67,    68,    69,   199,   360,   390,   400,
+     401,   402,   404,   405,   407,   408,    84,    88,    89,    90,
+      91,    92,    93,   199,   360,   417,   418,   419,   420,   422,
+     424,   426,   428,   430,   432,   334,    16,    53,    55,    56,
+      59,    60,    61,   199,   240,   344,   345,   346,   347,   348,
+     349,   350,   352,   354,   356,   357,   359,    54,    57,    58,
+     199,   240,   348,   354,   368,   369,   370,   371,   372,   374,
+     375,   376,   377,    97,    98,   199,   287,   288,   289,   291,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,   131,   132,   199,   473,   474,   475,   476,   478,
+     480,   481,   483,   484,   485,   488,   490,   491,   492,   493,
+     496,     6,     3,     4,     8,     3,   205,   505,   499,   501,
+     503,     4,     3,     8,   216,   225,   227,     4,     4,     4,
+       4,     4,   304,   335,   361,   327,   266,   278,   272,   439,
+     280,   294,   449,     4,   462,   470,     3,     8,   222,     4,
+       3,     8,   441,   379,   393,   391,   314,   316,   318,     4,
+       4,   322,   320,   410,   435,     3,     8,   389,     3,     8,
+     403,     4,   406,     4,     4,     3,     8,   433,   421,   423,
+     425,   427,   429,   431,     8,     3,     8,   351,   241,     4,
+     355,   353,   358,     4,     8,     3,   373,     4,     4,     8,
+       3,   290,   292,     3,     8,     4,   477,   479,     4,   482,
+       4,     4,   486,   489,     4,     4,     4,   494,   497,     3,
+       8,   184,   184,   165,     4,     4,     4,     4,     4,   203,
+       4,     4,     4,   166,   166,   166,   166,   166,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,     4,   166,
+       4,     4,   209,     4,   168,   220,    85,   199,   240,   360,
+     442,   443,   444,   445,   446,     4,     4,     4,     4,     4,
+       4,   166,   168,     4,     4,     4,     4,   312,     4,   387,
+       4,   166,     4,   166,   166,   401,     4,     4,     4,     4,
+       4,     4,     4,   419,     4,     4,   166,     4,     4,     4,
+     168,   346,     4,   168,   168,   370,     4,     4,   288,   168,
+       4,     4,   166,     4,   166,   166,     4,     4,   168,   168,
+     168,     4,     4,   474,     4,     7,     7,   184,   184,   184,
        7,     7,     7,     5,     5,     5,     5,     5,     5,     5,
-       5,     5,     7,     7,     7,     7,     5,   181,   418,     8,
-       3,     5,     5,   172,   174,   151,   151,   151,    63,    64,
-      65,   294,   151,     5,     7,   151,   151,   151,   181,   181,
-     181,   151,   151,   151,   151,   151,   151,   151,   151,   151,
-     151,   151,   170,   151,   151,   151,   119,   120,   458,   121,
-     122,   123,   124,   125,   154,   466,   151,   170,   194,   127,
-     477,   478,   479,   205,    16,    21,    22,    23,    24,    25,
-      26,    27,    28,    29,    30,   185,   214,   215,   216,   219,
-     221,   223,   225,   226,   228,   229,   230,   231,   232,   234,
-     214,     7,   276,   277,   278,     7,   309,   310,   311,     7,
-     333,   334,   335,     7,   299,   300,   301,    76,   151,   238,
-     239,   240,   241,   179,    77,    79,   240,   244,   245,   246,
-     247,   290,   411,     7,   252,   253,   254,    86,    87,    88,
-      89,    90,    91,   266,   267,   268,   269,   270,   271,   272,
-     273,    16,    96,    97,    98,    99,   185,   228,   421,   422,
-     423,   426,   427,   429,   430,   102,   103,   434,   435,   436,
-     438,   444,   182,     4,   415,     7,   351,   352,   353,     7,
-     365,   366,   367,     7,   382,   383,   384,    81,   407,     8,
-     480,     3,     8,     8,   217,   220,   222,   224,     4,     4,
-       4,     4,     4,   233,   235,     3,     8,     8,   279,     6,
-       3,   312,     6,     3,   336,     6,     3,   302,     6,     3,
-       3,     6,     6,     3,     6,     3,     6,   255,     6,     3,
-       4,     4,     4,     4,     4,     4,     3,     8,   424,   428,
-       4,     4,     4,     3,     8,   437,   439,     3,     8,     8,
-     151,   183,   184,   151,   354,     6,     3,   368,     6,     3,
-     385,     6,     3,   408,     8,     4,   478,     4,     4,     4,
-       4,   152,   154,   152,   154,   152,     4,     4,   215,   282,
-     278,   315,   311,   339,   335,   185,   196,   197,   198,   199,
-     226,   274,   286,   288,   290,   292,   296,   303,   304,   331,
-     405,   301,   239,   245,   290,   258,   254,   152,   152,   152,
-     152,   152,   152,   267,     4,     4,   152,   152,   152,   422,
-       4,     4,   435,     6,     3,   357,   353,   371,   367,   388,
-     384,     4,     5,    17,    18,    19,    20,   218,   151,   151,
-     151,   151,   151,     8,     8,     8,     3,     8,     8,    93,
-      94,    95,   425,   151,   151,   151,   151,     8,     8,     8,
-     151,     7,   481,   482,   304,   483,     3,     6,   128,   130,
-     131,   185,   226,   484,   485,   486,   487,   489,   482,   490,
-       4,   488,     3,     8,     4,   152,     4,   485,     5,   151,
-       7,   491,   492,   493,     3,     6,   129,   132,   133,   134,
-     494,   495,   496,   498,   499,   500,   492,   497,     4,     4,
-       4,     3,     8,     4,   154,   152,   152,   495,   151
+       5,     5,     7,     7,     7,     7,     5,   195,   447,     8,
+       3,     5,     5,   186,   188,   165,   165,   165,    77,    78,
+      79,   323,   165,     5,     7,   165,   165,   165,   195,   195,
+     195,   165,   165,   165,   165,   165,   165,   165,   165,   165,
+     165,   165,   184,   165,   165,   165,   133,   134,   487,   135,
+     136,   137,   138,   139,   168,   495,   165,   184,   208,   141,
+     506,   507,   508,   219,    16,    21,    22,    23,    24,    25,
+      26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    41,    42,    43,    44,   199,
+     228,   229,   230,   233,   235,   237,   239,   240,   242,   243,
+     244,   245,   246,   248,   250,   251,   252,   253,   254,   255,
+     256,   257,   258,   260,   261,   262,   263,   264,   228,     7,
+     305,   306,   307,     7,   338,   339,   340,     7,   362,   363,
+     364,     7,   328,   329,   330,    90,   165,   267,   268,   269,
+     270,   193,    91,    93,   269,   273,   274,   275,   276,   319,
+     440,     7,   281,   282,   283,   100,   101,   102,   103,   104,
+     105,   295,   296,   297,   298,   299,   300,   301,   302,    16,
+     110,   111,   112,   113,   199,   242,   450,   451,   452,   455,
+     456,   458,   459,   116,   117,   463,   464,   465,   467,   473,
+     196,     4,   444,     7,   380,   381,   382,     7,   394,   395,
+     396,     7,   411,   412,   413,    95,   436,     8,   509,     3,
+       8,     8,   231,   234,   236,   238,     4,     4,     4,     4,
+       4,   247,   249,     4,     4,     4,     4,     4,     4,     4,
+       4,   259,     4,     4,     4,     4,     4,     3,     8,     8,
+     308,     6,     3,   341,     6,     3,   365,     6,     3,   331,
+       6,     3,     3,     6,     6,     3,     6,     3,     6,   284,
+       6,     3,     4,     4,     4,     4,     4,     4,     3,     8,
+     453,   457,     4,     4,     4,     3,     8,   466,   468,     3,
+       8,     8,   165,   197,   198,   165,   383,     6,     3,   397,
+       6,     3,   414,     6,     3,   437,     8,     4,   507,     4,
+       4,     4,     4,   166,   168,   166,   168,   166,     4,     4,
+     168,   168,   166,   166,   166,   168,   166,   166,     4,   166,
+     166,   166,   166,   166,   229,   311,   307,   344,   340,   368,
+     364,   199,   210,   211,   212,   213,   240,   303,   315,   317,
+     319,   321,   325,   332,   333,   360,   434,   330,   268,   274,
+     319,   287,   283,   166,   166,   166,   166,   166,   166,   296,
+       4,     4,   166,   166,   166,   451,     4,     4,   464,     6,
+       3,   386,   382,   400,   396,   417,   413,     4,     5,    17,
+      18,    19,    20,   232,   165,   165,   165,   165,   165,   165,
+       8,     8,     8,     3,     8,     8,   107,   108,   109,   454,
+     165,   165,   165,   165,     8,     8,     8,   165,     7,   510,
+     511,   333,   512,     3,     6,   142,   144,   145,   199,   240,
+     513,   514,   515,   516,   518,   511,   519,     4,   517,     3,
+       8,     4,   166,     4,   514,     5,   165,     7,   520,   521,
+     522,     3,     6,   143,   146,   147,   148,   523,   524,   525,
+     527,   528,   529,   521,   526,     4,     4,     4,     3,     8,
+       4,   168,   166,   166,   524,   165
   };
 
   const unsigned short int
   Dhcp6Parser::yyr1_[] =
   {
-       0,   155,   157,   156,   158,   156,   159,   156,   160,   156,
-     161,   156,   162,   156,   163,   156,   164,   156,   165,   156,
-     166,   156,   167,   156,   168,   156,   169,   156,   170,   170,
-     170,   170,   170,   170,   170,   171,   173,   172,   174,   175,
-     175,   176,   176,   178,   177,   179,   179,   180,   180,   182,
-     181,   183,   183,   184,   184,   185,   187,   186,   188,   188,
-     189,   189,   189,   189,   189,   189,   191,   190,   193,   192,
-     194,   194,   195,   195,   195,   195,   195,   195,   195,   195,
-     195,   195,   195,   195,   195,   195,   195,   195,   195,   195,
-     195,   195,   195,   195,   195,   196,   197,   198,   199,   200,
-     202,   201,   204,   203,   205,   205,   206,   206,   208,   207,
-     209,   211,   210,   213,   212,   214,   214,   215,   215,   215,
-     215,   215,   215,   215,   215,   215,   215,   215,   215,   215,
-     217,   216,   218,   218,   218,   218,   220,   219,   222,   221,
-     224,   223,   225,   227,   226,   228,   229,   230,   231,   233,
-     232,   235,   234,   237,   236,   238,   238,   239,   239,   240,
-     241,   243,   242,   244,   244,   245,   245,   245,   246,   247,
-     249,   248,   251,   250,   252,   252,   253,   253,   255,   254,
-     257,   256,   258,   258,   258,   259,   259,   261,   260,   263,
-     262,   265,   264,   266,   266,   267,   267,   267,   267,   267,
-     267,   268,   269,   270,   271,   272,   273,   275,   274,   276,
-     276,   277,   277,   279,   278,   281,   280,   282,   282,   283,
-     283,   283,   283,   283,   283,   283,   283,   283,   283,   283,
-     283,   283,   283,   283,   283,   283,   283,   285,   284,   287,
-     286,   289,   288,   291,   290,   293,   292,   294,   294,   294,
-     295,   296,   298,   297,   299,   299,   300,   300,   302,   301,
-     303,   303,   304,   304,   304,   304,   304,   304,   304,   304,
-     304,   304,   304,   304,   304,   304,   306,   305,   308,   307,
-     309,   309,   310,   310,   312,   311,   314,   313,   315,   315,
-     316,   316,   317,   317,   317,   317,   317,   317,   317,   317,
-     318,   319,   320,   322,   321,   324,   323,   326,   325,   327,
-     329,   328,   330,   332,   331,   333,   333,   334,   334,   336,
-     335,   338,   337,   339,   339,   340,   340,   341,   341,   341,
-     341,   341,   341,   341,   342,   344,   343,   345,   346,   347,
-     348,   350,   349,   351,   351,   352,   352,   354,   353,   356,
-     355,   357,   357,   358,   358,   358,   358,   360,   359,   362,
-     361,   364,   363,   365,   365,   366,   366,   368,   367,   370,
-     369,   371,   371,   372,   372,   372,   372,   372,   372,   372,
-     372,   374,   373,   375,   377,   376,   378,   379,   381,   380,
-     382,   382,   383,   383,   385,   384,   387,   386,   388,   388,
-     389,   389,   390,   390,   390,   390,   390,   390,   390,   390,
-     390,   392,   391,   394,   393,   396,   395,   398,   397,   400,
-     399,   402,   401,   404,   403,   406,   405,   408,   407,   410,
-     409,   411,   411,   412,   290,   413,   413,   414,   414,   415,
-     415,   415,   415,   416,   418,   417,   420,   419,   421,   421,
-     422,   422,   422,   422,   422,   422,   422,   424,   423,   425,
-     425,   425,   426,   428,   427,   429,   430,   431,   433,   432,
-     434,   434,   435,   435,   437,   436,   439,   438,   441,   440,
-     443,   442,   444,   444,   445,   445,   445,   445,   445,   445,
-     445,   445,   445,   445,   445,   445,   445,   445,   445,   446,
-     448,   447,   450,   449,   451,   453,   452,   454,   455,   457,
-     456,   458,   458,   460,   459,   461,   462,   463,   465,   464,
-     466,   466,   466,   466,   466,   468,   467,   470,   469,   472,
-     471,   474,   473,   476,   475,   477,   477,   478,   480,   479,
-     481,   481,   483,   482,   484,   484,   485,   485,   485,   485,
-     485,   486,   488,   487,   490,   489,   491,   491,   493,   492,
-     494,   494,   495,   495,   495,   495,   497,   496,   498,   499,
-     500
+       0,   169,   171,   170,   172,   170,   173,   170,   174,   170,
+     175,   170,   176,   170,   177,   170,   178,   170,   179,   170,
+     180,   170,   181,   170,   182,   170,   183,   170,   184,   184,
+     184,   184,   184,   184,   184,   185,   187,   186,   188,   189,
+     189,   190,   190,   192,   191,   193,   193,   194,   194,   196,
+     195,   197,   197,   198,   198,   199,   201,   200,   202,   202,
+     203,   203,   203,   203,   203,   203,   205,   204,   207,   206,
+     208,   208,   209,   209,   209,   209,   209,   209,   209,   209,
+     209,   209,   209,   209,   209,   209,   209,   209,   209,   209,
+     209,   209,   209,   209,   209,   210,   211,   212,   213,   214,
+     216,   215,   218,   217,   219,   219,   220,   220,   222,   221,
+     223,   225,   224,   227,   226,   228,   228,   229,   229,   229,
+     229,   229,   229,   229,   229,   229,   229,   229,   229,   229,
+     229,   229,   229,   229,   229,   229,   229,   229,   229,   229,
+     229,   229,   229,   229,   231,   230,   232,   232,   232,   232,
+     234,   233,   236,   235,   238,   237,   239,   241,   240,   242,
+     243,   244,   245,   247,   246,   249,   248,   250,   251,   252,
+     253,   254,   255,   256,   257,   259,   258,   260,   261,   262,
+     263,   264,   266,   265,   267,   267,   268,   268,   269,   270,
+     272,   271,   273,   273,   274,   274,   274,   275,   276,   278,
+     277,   280,   279,   281,   281,   282,   282,   284,   283,   286,
+     285,   287,   287,   287,   288,   288,   290,   289,   292,   291,
+     294,   293,   295,   295,   296,   296,   296,   296,   296,   296,
+     297,   298,   299,   300,   301,   302,   304,   303,   305,   305,
+     306,   306,   308,   307,   310,   309,   311,   311,   312,   312,
+     312,   312,   312,   312,   312,   312,   312,   312,   312,   312,
+     312,   312,   312,   312,   312,   312,   314,   313,   316,   315,
+     318,   317,   320,   319,   322,   321,   323,   323,   323,   324,
+     325,   327,   326,   328,   328,   329,   329,   331,   330,   332,
+     332,   333,   333,   333,   333,   333,   333,   333,   333,   333,
+     333,   333,   333,   333,   333,   335,   334,   337,   336,   338,
+     338,   339,   339,   341,   340,   343,   342,   344,   344,   345,
+     345,   346,   346,   346,   346,   346,   346,   346,   346,   347,
+     348,   349,   351,   350,   353,   352,   355,   354,   356,   358,
+     357,   359,   361,   360,   362,   362,   363,   363,   365,   364,
+     367,   366,   368,   368,   369,   369,   370,   370,   370,   370,
+     370,   370,   370,   371,   373,   372,   374,   375,   376,   377,
+     379,   378,   380,   380,   381,   381,   383,   382,   385,   384,
+     386,   386,   387,   387,   387,   387,   389,   388,   391,   390,
+     393,   392,   394,   394,   395,   395,   397,   396,   399,   398,
+     400,   400,   401,   401,   401,   401,   401,   401,   401,   401,
+     403,   402,   404,   406,   405,   407,   408,   410,   409,   411,
+     411,   412,   412,   414,   413,   416,   415,   417,   417,   418,
+     418,   419,   419,   419,   419,   419,   419,   419,   419,   419,
+     421,   420,   423,   422,   425,   424,   427,   426,   429,   428,
+     431,   430,   433,   432,   435,   434,   437,   436,   439,   438,
+     440,   440,   441,   319,   442,   442,   443,   443,   444,   444,
+     444,   444,   445,   447,   446,   449,   448,   450,   450,   451,
+     451,   451,   451,   451,   451,   451,   453,   452,   454,   454,
+     454,   455,   457,   456,   458,   459,   460,   462,   461,   463,
+     463,   464,   464,   466,   465,   468,   467,   470,   469,   472,
+     471,   473,   473,   474,   474,   474,   474,   474,   474,   474,
+     474,   474,   474,   474,   474,   474,   474,   474,   475,   477,
+     476,   479,   478,   480,   482,   481,   483,   484,   486,   485,
+     487,   487,   489,   488,   490,   491,   492,   494,   493,   495,
+     495,   495,   495,   495,   497,   496,   499,   498,   501,   500,
+     503,   502,   505,   504,   506,   506,   507,   509,   508,   510,
+     510,   512,   511,   513,   513,   514,   514,   514,   514,   514,
+     515,   517,   516,   519,   518,   520,   520,   522,   521,   523,
+     523,   524,   524,   524,   524,   526,   525,   527,   528,   529
   };
 
   const unsigned char
@@ -4186,51 +4357,53 @@ namespace isc { namespace dhcp {
        0,     6,     0,     4,     1,     3,     1,     1,     0,     4,
        3,     0,     6,     0,     6,     1,     3,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       0,     4,     1,     1,     1,     1,     0,     4,     0,     4,
-       0,     4,     3,     0,     4,     3,     3,     3,     3,     0,
-       4,     0,     4,     0,     6,     1,     3,     1,     1,     1,
-       1,     0,     6,     1,     3,     1,     1,     1,     1,     1,
-       0,     6,     0,     6,     0,     1,     1,     3,     0,     4,
-       0,     4,     1,     3,     1,     1,     1,     0,     4,     0,
-       4,     0,     6,     1,     3,     1,     1,     1,     1,     1,
-       1,     3,     3,     3,     3,     3,     3,     0,     6,     0,
-       1,     1,     3,     0,     4,     0,     4,     1,     3,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     0,     4,     0,
-       4,     0,     4,     0,     4,     0,     4,     1,     1,     1,
-       3,     3,     0,     6,     0,     1,     1,     3,     0,     4,
-       1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     0,     6,     0,     4,
-       0,     1,     1,     3,     0,     4,     0,     4,     0,     1,
+       1,     1,     1,     1,     0,     4,     1,     1,     1,     1,
+       0,     4,     0,     4,     0,     4,     3,     0,     4,     3,
+       3,     3,     3,     0,     4,     0,     4,     3,     3,     3,
+       3,     3,     3,     3,     3,     0,     4,     3,     3,     3,
+       3,     3,     0,     6,     1,     3,     1,     1,     1,     1,
+       0,     6,     1,     3,     1,     1,     1,     1,     1,     0,
+       6,     0,     6,     0,     1,     1,     3,     0,     4,     0,
+       4,     1,     3,     1,     1,     1,     0,     4,     0,     4,
+       0,     6,     1,     3,     1,     1,     1,     1,     1,     1,
+       3,     3,     3,     3,     3,     3,     0,     6,     0,     1,
+       1,     3,     0,     4,     0,     4,     1,     3,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     0,     4,     0,     4,
+       0,     4,     0,     4,     0,     4,     1,     1,     1,     3,
+       3,     0,     6,     0,     1,     1,     3,     0,     4,     1,
+       3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     0,     6,     0,     4,     0,
+       1,     1,     3,     0,     4,     0,     4,     0,     1,     1,
+       3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       3,     1,     0,     4,     0,     4,     0,     4,     1,     0,
+       4,     3,     0,     6,     0,     1,     1,     3,     0,     4,
+       0,     4,     0,     1,     1,     3,     1,     1,     1,     1,
+       1,     1,     1,     1,     0,     4,     1,     1,     3,     3,
+       0,     6,     0,     1,     1,     3,     0,     4,     0,     4,
+       1,     3,     1,     1,     1,     1,     0,     4,     0,     4,
+       0,     6,     0,     1,     1,     3,     0,     4,     0,     4,
        1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     3,     1,     0,     4,     0,     4,     0,     4,     1,
-       0,     4,     3,     0,     6,     0,     1,     1,     3,     0,
-       4,     0,     4,     0,     1,     1,     3,     1,     1,     1,
-       1,     1,     1,     1,     1,     0,     4,     1,     1,     3,
-       3,     0,     6,     0,     1,     1,     3,     0,     4,     0,
-       4,     1,     3,     1,     1,     1,     1,     0,     4,     0,
-       4,     0,     6,     0,     1,     1,     3,     0,     4,     0,
+       0,     4,     3,     0,     4,     3,     3,     0,     6,     0,
+       1,     1,     3,     0,     4,     0,     4,     0,     1,     1,
+       3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       0,     4,     0,     4,     0,     4,     0,     4,     0,     4,
+       0,     4,     0,     4,     0,     6,     0,     4,     0,     6,
+       1,     3,     0,     4,     0,     1,     1,     3,     1,     1,
+       1,     1,     1,     0,     4,     0,     6,     1,     3,     1,
+       1,     1,     1,     1,     1,     1,     0,     4,     1,     1,
+       1,     3,     0,     4,     3,     3,     3,     0,     6,     1,
+       3,     1,     1,     0,     4,     0,     4,     0,     6,     0,
        4,     1,     3,     1,     1,     1,     1,     1,     1,     1,
-       1,     0,     4,     3,     0,     4,     3,     3,     0,     6,
-       0,     1,     1,     3,     0,     4,     0,     4,     0,     1,
-       1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     0,     4,     0,     4,     0,     4,     0,     4,     0,
-       4,     0,     4,     0,     4,     0,     6,     0,     4,     0,
-       6,     1,     3,     0,     4,     0,     1,     1,     3,     1,
-       1,     1,     1,     1,     0,     4,     0,     6,     1,     3,
-       1,     1,     1,     1,     1,     1,     1,     0,     4,     1,
-       1,     1,     3,     0,     4,     3,     3,     3,     0,     6,
-       1,     3,     1,     1,     0,     4,     0,     4,     0,     6,
-       0,     4,     1,     3,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     3,
-       0,     4,     0,     4,     3,     0,     4,     3,     3,     0,
-       4,     1,     1,     0,     4,     3,     3,     3,     0,     4,
-       1,     1,     1,     1,     1,     0,     4,     0,     4,     0,
-       4,     0,     4,     0,     6,     1,     3,     1,     0,     6,
-       1,     3,     0,     4,     1,     3,     1,     1,     1,     1,
-       1,     3,     0,     4,     0,     6,     1,     3,     0,     4,
-       1,     3,     1,     1,     1,     1,     0,     4,     3,     3,
-       3
+       1,     1,     1,     1,     1,     1,     1,     1,     3,     0,
+       4,     0,     4,     3,     0,     4,     3,     3,     0,     4,
+       1,     1,     0,     4,     3,     3,     3,     0,     4,     1,
+       1,     1,     1,     1,     0,     4,     0,     4,     0,     4,
+       0,     4,     0,     6,     1,     3,     1,     0,     6,     1,
+       3,     0,     4,     1,     3,     1,     1,     1,     1,     1,
+       3,     0,     4,     0,     6,     1,     3,     0,     4,     1,
+       3,     1,     1,     1,     1,     0,     4,     3,     3,     3
   };
 
 
@@ -4247,15 +4420,21 @@ namespace isc { namespace dhcp {
   "\"mysql\"", "\"postgresql\"", "\"cql\"", "\"user\"", "\"password\"",
   "\"host\"", "\"port\"", "\"persist\"", "\"lfc-interval\"",
   "\"readonly\"", "\"connect-timeout\"", "\"contact-points\"",
-  "\"keyspace\"", "\"preferred-lifetime\"", "\"valid-lifetime\"",
-  "\"renew-timer\"", "\"rebind-timer\"", "\"decline-probation-period\"",
-  "\"subnet6\"", "\"option-def\"", "\"option-data\"", "\"name\"",
-  "\"data\"", "\"code\"", "\"space\"", "\"csv-format\"", "\"always-send\"",
-  "\"record-types\"", "\"encapsulate\"", "\"array\"", "\"pools\"",
-  "\"pool\"", "\"pd-pools\"", "\"prefix\"", "\"prefix-len\"",
-  "\"excluded-prefix\"", "\"excluded-prefix-len\"", "\"delegated-len\"",
-  "\"user-context\"", "\"subnet\"", "\"interface\"", "\"interface-id\"",
-  "\"id\"", "\"rapid-commit\"", "\"reservation-mode\"", "\"disabled\"",
+  "\"keyspace\"", "\"group-commit\"", "\"group-commit-sync\"",
+  "\"group-commit-max-batch\"", "\"group-commit-max-latency\"",
+  "\"load-threads\"", "\"lfc-in-process\"", "\"lfc-batch-size\"",
+  "\"lfc-batch-interval\"", "\"lfc-snapshot-format\"", "\"cache-size\"",
+  "\"cache-ttl\"", "\"cache-negative-ttl\"", "\"connection-pool-size\"",
+  "\"reconnect-wait-time\"", "\"preferred-lifetime\"",
+  "\"valid-lifetime\"", "\"renew-timer\"", "\"rebind-timer\"",
+  "\"decline-probation-period\"", "\"subnet6\"", "\"option-def\"",
+  "\"option-data\"", "\"name\"", "\"data\"", "\"code\"", "\"space\"",
+  "\"csv-format\"", "\"always-send\"", "\"record-types\"",
+  "\"encapsulate\"", "\"array\"", "\"pools\"", "\"pool\"", "\"pd-pools\"",
+  "\"prefix\"", "\"prefix-len\"", "\"excluded-prefix\"",
+  "\"excluded-prefix-len\"", "\"delegated-len\"", "\"user-context\"",
+  "\"subnet\"", "\"interface\"", "\"interface-id\"", "\"id\"",
+  "\"rapid-commit\"", "\"reservation-mode\"", "\"disabled\"",
   "\"out-of-pool\"", "\"all\"", "\"shared-networks\"", "\"mac-sources\"",
   "\"relay-supplied-options\"", "\"host-reservation-identifiers\"",
   "\"client-classes\"", "\"test\"", "\"client-class\"", "\"reservations\"",
@@ -4298,72 +4477,77 @@ namespace isc { namespace dhcp {
   "database_map_params", "database_map_param", "database_type", "$@25",
   "db_type", "user", "$@26", "password", "$@27", "host", "$@28", "port",
   "name", "$@29", "persist", "lfc_interval", "readonly", "connect_timeout",
-  "contact_points", "$@30", "keyspace", "$@31", "mac_sources", "$@32",
-  "mac_sources_list", "mac_sources_value", "duid_id", "string_id",
-  "host_reservation_identifiers", "$@33",
+  "contact_points", "$@30", "keyspace", "$@31", "group_commit",
+  "group_commit_sync", "group_commit_max_batch",
+  "group_commit_max_latency", "load_threads", "lfc_in_process",
+  "lfc_batch_size", "lfc_batch_interval", "lfc_snapshot_format", "$@32",
+  "cache_size", "cache_ttl", "cache_negative_ttl", "connection_pool_size",
+  "reconnect_wait_time", "mac_sources", "$@33", "mac_sources_list",
+  "mac_sources_value", "duid_id", "string_id",
+  "host_reservation_identifiers", "$@34",
   "host_reservation_identifiers_list", "host_reservation_identifier",
-  "hw_address_id", "flex_id", "relay_supplied_options", "$@34",
-  "hooks_libraries", "$@35", "hooks_libraries_list",
-  "not_empty_hooks_libraries_list", "hooks_library", "$@36",
-  "sub_hooks_library", "$@37", "hooks_params", "hooks_param", "library",
-  "$@38", "parameters", "$@39", "expired_leases_processing", "$@40",
+  "hw_address_id", "flex_id", "relay_supplied_options", "$@35",
+  "hooks_libraries", "$@36", "hooks_libraries_list",
+  "not_empty_hooks_libraries_list", "hooks_library", "$@37",
+  "sub_hooks_library", "$@38", "hooks_params", "hooks_param", "library",
+  "$@39", "parameters", "$@40", "expired_leases_processing", "$@41",
   "expired_leases_params", "expired_leases_param",
   "reclaim_timer_wait_time", "flush_reclaimed_timer_wait_time",
   "hold_reclaimed_time", "max_reclaim_leases", "max_reclaim_time",
-  "unwarned_reclaim_cycles", "subnet6_list", "$@41",
-  "subnet6_list_content", "not_empty_subnet6_list", "subnet6", "$@42",
-  "sub_subnet6", "$@43", "subnet6_params", "subnet6_param", "subnet",
-  "$@44", "interface", "$@45", "interface_id", "$@46", "client_class",
-  "$@47", "reservation_mode", "$@48", "hr_mode", "id", "rapid_commit",
-  "shared_networks", "$@49", "shared_networks_content",
-  "shared_networks_list", "shared_network", "$@50",
+  "unwarned_reclaim_cycles", "subnet6_list", "$@42",
+  "subnet6_list_content", "not_empty_subnet6_list", "subnet6", "$@43",
+  "sub_subnet6", "$@44", "subnet6_params", "subnet6_param", "subnet",
+  "$@45", "interface", "$@46", "interface_id", "$@47", "client_class",
+  "$@48", "reservation_mode", "$@49", "hr_mode", "id", "rapid_commit",
+  "shared_networks", "$@50", "shared_networks_content",
+  "shared_networks_list", "shared_network", "$@51",
   "shared_network_params", "shared_network_param", "option_def_list",
-  "$@51", "sub_option_def_list", "$@52", "option_def_list_content",
-  "not_empty_option_def_list", "option_def_entry", "$@53",
-  "sub_option_def", "$@54", "option_def_params",
+  "$@52", "sub_option_def_list", "$@53", "option_def_list_content",
+  "not_empty_option_def_list", "option_def_entry", "$@54",
+  "sub_option_def", "$@55", "option_def_params",
   "not_empty_option_def_params", "option_def_param", "option_def_name",
-  "code", "option_def_code", "option_def_type", "$@55",
-  "option_def_record_types", "$@56", "space", "$@57", "option_def_space",
-  "option_def_encapsulate", "$@58", "option_def_array", "option_data_list",
-  "$@59", "option_data_list_content", "not_empty_option_data_list",
-  "option_data_entry", "$@60", "sub_option_data", "$@61",
+  "code", "option_def_code", "option_def_type", "$@56",
+  "option_def_record_types", "$@57", "space", "$@58", "option_def_space",
+  "option_def_encapsulate", "$@59", "option_def_array", "option_data_list",
+  "$@60", "option_data_list_content", "not_empty_option_data_list",
+  "option_data_entry", "$@61", "sub_option_data", "$@62",
   "option_data_params", "not_empty_option_data_params",
-  "option_data_param", "option_data_name", "option_data_data", "$@62",
+  "option_data_param", "option_data_name", "option_data_data", "$@63",
   "option_data_code", "option_data_space", "option_data_csv_format",
-  "option_data_always_send", "pools_list", "$@63", "pools_list_content",
-  "not_empty_pools_list", "pool_list_entry", "$@64", "sub_pool6", "$@65",
-  "pool_params", "pool_param", "pool_entry", "$@66", "user_context",
-  "$@67", "pd_pools_list", "$@68", "pd_pools_list_content",
-  "not_empty_pd_pools_list", "pd_pool_entry", "$@69", "sub_pd_pool",
-  "$@70", "pd_pool_params", "pd_pool_param", "pd_prefix", "$@71",
-  "pd_prefix_len", "excluded_prefix", "$@72", "excluded_prefix_len",
-  "pd_delegated_len", "reservations", "$@73", "reservations_list",
-  "not_empty_reservations_list", "reservation", "$@74", "sub_reservation",
-  "$@75", "reservation_params", "not_empty_reservation_params",
-  "reservation_param", "ip_addresses", "$@76", "prefixes", "$@77", "duid",
-  "$@78", "hw_address", "$@79", "hostname", "$@80", "flex_id_value",
-  "$@81", "reservation_client_classes", "$@82", "relay", "$@83",
-  "relay_map", "$@84", "client_classes", "$@85", "client_classes_list",
-  "$@86", "client_class_params", "not_empty_client_class_params",
-  "client_class_param", "client_class_name", "client_class_test", "$@87",
-  "server_id", "$@88", "server_id_params", "server_id_param",
-  "server_id_type", "$@89", "duid_type", "htype", "identifier", "$@90",
-  "time", "enterprise_id", "dhcp4o6_port", "control_socket", "$@91",
-  "control_socket_params", "control_socket_param", "socket_type", "$@92",
-  "socket_name", "$@93", "dhcp_ddns", "$@94", "sub_dhcp_ddns", "$@95",
+  "option_data_always_send", "pools_list", "$@64", "pools_list_content",
+  "not_empty_pools_list", "pool_list_entry", "$@65", "sub_pool6", "$@66",
+  "pool_params", "pool_param", "pool_entry", "$@67", "user_context",
+  "$@68", "pd_pools_list", "$@69", "pd_pools_list_content",
+  "not_empty_pd_pools_list", "pd_pool_entry", "$@70", "sub_pd_pool",
+  "$@71", "pd_pool_params", "pd_pool_param", "pd_prefix", "$@72",
+  "pd_prefix_len", "excluded_prefix", "$@73", "excluded_prefix_len",
+  "pd_delegated_len", "reservations", "$@74", "reservations_list",
+  "not_empty_reservations_list", "reservation", "$@75", "sub_reservation",
+  "$@76", "reservation_params", "not_empty_reservation_params",
+  "reservation_param", "ip_addresses", "$@77", "prefixes", "$@78", "duid",
+  "$@79", "hw_address", "$@80", "hostname", "$@81", "flex_id_value",
+  "$@82", "reservation_client_classes", "$@83", "relay", "$@84",
+  "relay_map", "$@85", "client_classes", "$@86", "client_classes_list",
+  "$@87", "client_class_params", "not_empty_client_class_params",
+  "client_class_param", "client_class_name", "client_class_test", "$@88",
+  "server_id", "$@89", "server_id_params", "server_id_param",
+  "server_id_type", "$@90", "duid_type", "htype", "identifier", "$@91",
+  "time", "enterprise_id", "dhcp4o6_port", "control_socket", "$@92",
+  "control_socket_params", "control_socket_param", "socket_type", "$@93",
+  "socket_name", "$@94", "dhcp_ddns", "$@95", "sub_dhcp_ddns", "$@96",
   "dhcp_ddns_params", "dhcp_ddns_param", "enable_updates",
-  "qualifying_suffix", "$@96", "server_ip", "$@97", "server_port",
-  "sender_ip", "$@98", "sender_port", "max_queue_size", "ncr_protocol",
-  "$@99", "ncr_protocol_value", "ncr_format", "$@100",
+  "qualifying_suffix", "$@97", "server_ip", "$@98", "server_port",
+  "sender_ip", "$@99", "sender_port", "max_queue_size", "ncr_protocol",
+  "$@100", "ncr_protocol_value", "ncr_format", "$@101",
   "always_include_fqdn", "override_no_update", "override_client_update",
-  "replace_client_name", "$@101", "replace_client_name_value",
-  "generated_prefix", "$@102", "dhcp4_json_object", "$@103",
-  "dhcpddns_json_object", "$@104", "control_agent_json_object", "$@105",
-  "logging_object", "$@106", "logging_params", "logging_param", "loggers",
-  "$@107", "loggers_entries", "logger_entry", "$@108", "logger_params",
-  "logger_param", "debuglevel", "severity", "$@109", "output_options_list",
-  "$@110", "output_options_list_content", "output_entry", "$@111",
-  "output_params_list", "output_params", "output", "$@112", "flush",
+  "replace_client_name", "$@102", "replace_client_name_value",
+  "generated_prefix", "$@103", "dhcp4_json_object", "$@104",
+  "dhcpddns_json_object", "$@105", "control_agent_json_object", "$@106",
+  "logging_object", "$@107", "logging_params", "logging_param", "loggers",
+  "$@108", "loggers_entries", "logger_entry", "$@109", "logger_params",
+  "logger_param", "debuglevel", "severity", "$@110", "output_options_list",
+  "$@111", "output_options_list_content", "output_entry", "$@112",
+  "output_params_list", "output_params", "output", "$@113", "flush",
   "maxsize", "maxver", YY_NULLPTR
   };
 
@@ -4371,64 +4555,66 @@ namespace isc { namespace dhcp {
   const unsigned short int
   Dhcp6Parser::yyrline_[] =
   {
-       0,   236,   236,   236,   237,   237,   238,   238,   239,   239,
-     240,   240,   241,   241,   242,   242,   243,   243,   244,   244,
-     245,   245,   246,   246,   247,   247,   248,   248,   256,   257,
-     258,   259,   260,   261,   262,   265,   270,   270,   281,   284,
-     285,   288,   292,   299,   299,   306,   307,   310,   314,   321,
-     321,   328,   329,   332,   336,   347,   357,   357,   372,   373,
-     377,   378,   379,   380,   381,   382,   385,   385,   400,   400,
-     409,   410,   415,   416,   417,   418,   419,   420,   421,   422,
-     423,   424,   425,   426,   427,   428,   429,   430,   431,   432,
-     433,   434,   435,   436,   437,   440,   445,   450,   455,   460,
-     465,   465,   476,   476,   485,   486,   489,   490,   493,   493,
-     503,   509,   509,   521,   521,   533,   534,   537,   538,   539,
-     540,   541,   542,   543,   544,   545,   546,   547,   548,   549,
-     552,   552,   559,   560,   561,   562,   565,   565,   573,   573,
-     581,   581,   589,   594,   594,   602,   607,   612,   617,   622,
-     622,   630,   630,   639,   639,   649,   650,   653,   654,   657,
-     662,   667,   667,   677,   678,   681,   682,   683,   686,   691,
-     698,   698,   708,   708,   718,   719,   722,   723,   726,   726,
-     736,   736,   746,   747,   748,   751,   752,   755,   755,   763,
-     763,   771,   771,   782,   783,   786,   787,   788,   789,   790,
-     791,   794,   799,   804,   809,   814,   819,   827,   827,   840,
-     841,   844,   845,   852,   852,   878,   878,   889,   890,   894,
-     895,   896,   897,   898,   899,   900,   901,   902,   903,   904,
-     905,   906,   907,   908,   909,   910,   911,   914,   914,   922,
-     922,   930,   930,   938,   938,   946,   946,   953,   954,   955,
-     958,   963,   971,   971,   982,   983,   987,   988,   991,   991,
-     999,  1000,  1003,  1004,  1005,  1006,  1007,  1008,  1009,  1010,
-    1011,  1012,  1013,  1014,  1015,  1016,  1023,  1023,  1036,  1036,
-    1045,  1046,  1049,  1050,  1055,  1055,  1070,  1070,  1084,  1085,
-    1088,  1089,  1092,  1093,  1094,  1095,  1096,  1097,  1098,  1099,
-    1102,  1104,  1109,  1111,  1111,  1119,  1119,  1127,  1127,  1135,
-    1137,  1137,  1145,  1154,  1154,  1166,  1167,  1172,  1173,  1178,
-    1178,  1190,  1190,  1202,  1203,  1208,  1209,  1214,  1215,  1216,
-    1217,  1218,  1219,  1220,  1223,  1225,  1225,  1233,  1235,  1237,
-    1242,  1250,  1250,  1262,  1263,  1266,  1267,  1270,  1270,  1280,
-    1280,  1289,  1290,  1293,  1294,  1295,  1296,  1299,  1299,  1307,
-    1307,  1317,  1317,  1329,  1330,  1333,  1334,  1337,  1337,  1349,
-    1349,  1361,  1362,  1365,  1366,  1367,  1368,  1369,  1370,  1371,
-    1372,  1375,  1375,  1383,  1388,  1388,  1396,  1401,  1409,  1409,
-    1419,  1420,  1423,  1424,  1427,  1427,  1436,  1436,  1445,  1446,
-    1449,  1450,  1454,  1455,  1456,  1457,  1458,  1459,  1460,  1461,
-    1462,  1465,  1465,  1475,  1475,  1485,  1485,  1493,  1493,  1501,
-    1501,  1509,  1509,  1517,  1517,  1530,  1530,  1540,  1540,  1551,
-    1551,  1561,  1562,  1565,  1565,  1575,  1576,  1579,  1580,  1583,
-    1584,  1585,  1586,  1589,  1591,  1591,  1602,  1602,  1614,  1615,
-    1618,  1619,  1620,  1621,  1622,  1623,  1624,  1627,  1627,  1634,
-    1635,  1636,  1639,  1644,  1644,  1652,  1657,  1664,  1671,  1671,
-    1681,  1682,  1685,  1686,  1689,  1689,  1697,  1697,  1707,  1707,
-    1719,  1719,  1729,  1730,  1733,  1734,  1735,  1736,  1737,  1738,
-    1739,  1740,  1741,  1742,  1743,  1744,  1745,  1746,  1747,  1750,
-    1755,  1755,  1763,  1763,  1771,  1776,  1776,  1784,  1789,  1794,
-    1794,  1802,  1803,  1806,  1806,  1814,  1819,  1824,  1829,  1829,
-    1837,  1840,  1843,  1846,  1849,  1855,  1855,  1865,  1865,  1872,
-    1872,  1879,  1879,  1892,  1892,  1905,  1906,  1910,  1914,  1914,
-    1926,  1927,  1931,  1931,  1939,  1940,  1943,  1944,  1945,  1946,
-    1947,  1950,  1955,  1955,  1963,  1963,  1973,  1974,  1977,  1977,
-    1985,  1986,  1989,  1990,  1991,  1992,  1995,  1995,  2003,  2008,
-    2013
+       0,   250,   250,   250,   251,   251,   252,   252,   253,   253,
+     254,   254,   255,   255,   256,   256,   257,   257,   258,   258,
+     259,   259,   260,   260,   261,   261,   262,   262,   270,   271,
+     272,   273,   274,   275,   276,   279,   284,   284,   295,   298,
+     299,   302,   306,   313,   313,   320,   321,   324,   328,   335,
+     335,   342,   343,   346,   350,   361,   371,   371,   386,   387,
+     391,   392,   393,   394,   395,   396,   399,   399,   414,   414,
+     423,   424,   429,   430,   431,   432,   433,   434,   435,   436,
+     437,   438,   439,   440,   441,   442,   443,   444,   445,   446,
+     447,   448,   449,   450,   451,   454,   459,   464,   469,   474,
+     479,   479,   490,   490,   499,   500,   503,   504,   507,   507,
+     517,   523,   523,   535,   535,   547,   548,   551,   552,   553,
+     554,   555,   556,   557,   558,   559,   560,   561,   562,   563,
+     564,   565,   566,   567,   568,   569,   570,   571,   572,   573,
+     574,   575,   576,   577,   580,   580,   587,   588,   589,   590,
+     593,   593,   601,   601,   609,   609,   617,   622,   622,   630,
+     635,   640,   645,   650,   650,   658,   658,   666,   671,   676,
+     681,   686,   691,   696,   701,   706,   706,   714,   719,   724,
+     729,   734,   740,   740,   750,   751,   754,   755,   758,   763,
+     768,   768,   778,   779,   782,   783,   784,   787,   792,   799,
+     799,   809,   809,   819,   820,   823,   824,   827,   827,   837,
+     837,   847,   848,   849,   852,   853,   856,   856,   864,   864,
+     872,   872,   883,   884,   887,   888,   889,   890,   891,   892,
+     895,   900,   905,   910,   915,   920,   928,   928,   941,   942,
+     945,   946,   953,   953,   979,   979,   990,   991,   995,   996,
+     997,   998,   999,  1000,  1001,  1002,  1003,  1004,  1005,  1006,
+    1007,  1008,  1009,  1010,  1011,  1012,  1015,  1015,  1023,  1023,
+    1031,  1031,  1039,  1039,  1047,  1047,  1054,  1055,  1056,  1059,
+    1064,  1072,  1072,  1083,  1084,  1088,  1089,  1092,  1092,  1100,
+    1101,  1104,  1105,  1106,  1107,  1108,  1109,  1110,  1111,  1112,
+    1113,  1114,  1115,  1116,  1117,  1124,  1124,  1137,  1137,  1146,
+    1147,  1150,  1151,  1156,  1156,  1171,  1171,  1185,  1186,  1189,
+    1190,  1193,  1194,  1195,  1196,  1197,  1198,  1199,  1200,  1203,
+    1205,  1210,  1212,  1212,  1220,  1220,  1228,  1228,  1236,  1238,
+    1238,  1246,  1255,  1255,  1267,  1268,  1273,  1274,  1279,  1279,
+    1291,  1291,  1303,  1304,  1309,  1310,  1315,  1316,  1317,  1318,
+    1319,  1320,  1321,  1324,  1326,  1326,  1334,  1336,  1338,  1343,
+    1351,  1351,  1363,  1364,  1367,  1368,  1371,  1371,  1381,  1381,
+    1390,  1391,  1394,  1395,  1396,  1397,  1400,  1400,  1408,  1408,
+    1418,  1418,  1430,  1431,  1434,  1435,  1438,  1438,  1450,  1450,
+    1462,  1463,  1466,  1467,  1468,  1469,  1470,  1471,  1472,  1473,
+    1476,  1476,  1484,  1489,  1489,  1497,  1502,  1510,  1510,  1520,
+    1521,  1524,  1525,  1528,  1528,  1537,  1537,  1546,  1547,  1550,
+    1551,  1555,  1556,  1557,  1558,  1559,  1560,  1561,  1562,  1563,
+    1566,  1566,  1576,  1576,  1586,  1586,  1594,  1594,  1602,  1602,
+    1610,  1610,  1618,  1618,  1631,  1631,  1641,  1641,  1652,  1652,
+    1662,  1663,  1666,  1666,  1676,  1677,  1680,  1681,  1684,  1685,
+    1686,  1687,  1690,  1692,  1692,  1703,  1703,  1715,  1716,  1719,
+    1720,  1721,  1722,  1723,  1724,  1725,  1728,  1728,  1735,  1736,
+    1737,  1740,  1745,  1745,  1753,  1758,  1765,  1772,  1772,  1782,
+    1783,  1786,  1787,  1790,  1790,  1798,  1798,  1808,  1808,  1820,
+    1820,  1830,  1831,  1834,  1835,  1836,  1837,  1838,  1839,  1840,
+    1841,  1842,  1843,  1844,  1845,  1846,  1847,  1848,  1851,  1856,
+    1856,  1864,  1864,  1872,  1877,  1877,  1885,  1890,  1895,  1895,
+    1903,  1904,  1907,  1907,  1915,  1920,  1925,  1930,  1930,  1938,
+    1941,  1944,  1947,  1950,  1956,  1956,  1966,  1966,  1973,  1973,
+    1980,  1980,  1993,  1993,  2006,  2007,  2011,  2015,  2015,  2027,
+    2028,  2032,  2032,  2040,  2041,  2044,  2045,  2046,  2047,  2048,
+    2051,  2056,  2056,  2064,  2064,  2074,  2075,  2078,  2078,  2086,
+    2087,  2090,  2091,  2092,  2093,  2096,  2096,  2104,  2109,  2114
   };
 
   // Print the state stack on the debug stream.
@@ -4463,8 +4649,8 @@ namespace isc { namespace dhcp {
 
 #line 14 "dhcp6_parser.yy" // lalr1.cc:1167
 } } // isc::dhcp
-#line 4467 "dhcp6_parser.cc" // lalr1.cc:1167
-#line 2018 "dhcp6_parser.yy" // lalr1.cc:1168
+#line 4653 "dhcp6_parser.cc" // lalr1.cc:1167
+#line 2119 "dhcp6_parser.yy" // lalr1.cc:1168
 
 
 void
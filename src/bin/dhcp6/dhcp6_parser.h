@@ -375,130 +375,144 @@ namespace isc { namespace dhcp {
         TOKEN_CONNECT_TIMEOUT = 283,
         TOKEN_CONTACT_POINTS = 284,
         TOKEN_KEYSPACE = 285,
-        TOKEN_PREFERRED_LIFETIME = 286,
-        TOKEN_VALID_LIFETIME = 287,
-        TOKEN_RENEW_TIMER = 288,
-        TOKEN_REBIND_TIMER = 289,
-        TOKEN_DECLINE_PROBATION_PERIOD = 290,
-        TOKEN_SUBNET6 = 291,
-        TOKEN_OPTION_DEF = 292,
-        TOKEN_OPTION_DATA = 293,
-        TOKEN_NAME = 294,
-        TOKEN_DATA = 295,
-        TOKEN_CODE = 296,
-        TOKEN_SPACE = 297,
-        TOKEN_CSV_FORMAT = 298,
-        TOKEN_ALWAYS_SEND = 299,
-        TOKEN_RECORD_TYPES = 300,
-        TOKEN_ENCAPSULATE = 301,
-        TOKEN_ARRAY = 302,
-        TOKEN_POOLS = 303,
-        TOKEN_POOL = 304,
-        TOKEN_PD_POOLS = 305,
-        TOKEN_PREFIX = 306,
-        TOKEN_PREFIX_LEN = 307,
-        TOKEN_EXCLUDED_PREFIX = 308,
-        TOKEN_EXCLUDED_PREFIX_LEN = 309,
-        TOKEN_DELEGATED_LEN = 310,
-        TOKEN_USER_CONTEXT = 311,
-        TOKEN_SUBNET = 312,
-        TOKEN_INTERFACE = 313,
-        TOKEN_INTERFACE_ID = 314,
-        TOKEN_ID = 315,
-        TOKEN_RAPID_COMMIT = 316,
-        TOKEN_RESERVATION_MODE = 317,
-        TOKEN_DISABLED = 318,
-        TOKEN_OUT_OF_POOL = 319,
-        TOKEN_ALL = 320,
-        TOKEN_SHARED_NETWORKS = 321,
-        TOKEN_MAC_SOURCES = 322,
-        TOKEN_RELAY_SUPPLIED_OPTIONS = 323,
-        TOKEN_HOST_RESERVATION_IDENTIFIERS = 324,
-        TOKEN_CLIENT_CLASSES = 325,
-        TOKEN_TEST = 326,
-        TOKEN_CLIENT_CLASS = 327,
-        TOKEN_RESERVATIONS = 328,
-        TOKEN_IP_ADDRESSES = 329,
-        TOKEN_PREFIXES = 330,
-        TOKEN_DUID = 331,
-        TOKEN_HW_ADDRESS = 332,
-        TOKEN_HOSTNAME = 333,
-        TOKEN_FLEX_ID = 334,
-        TOKEN_RELAY = 335,
-        TOKEN_IP_ADDRESS = 336,
-        TOKEN_HOOKS_LIBRARIES = 337,
-        TOKEN_LIBRARY = 338,
-        TOKEN_PARAMETERS = 339,
-        TOKEN_EXPIRED_LEASES_PROCESSING = 340,
-        TOKEN_RECLAIM_TIMER_WAIT_TIME = 341,
-        TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 342,
-        TOKEN_HOLD_RECLAIMED_TIME = 343,
-        TOKEN_MAX_RECLAIM_LEASES = 344,
-        TOKEN_MAX_RECLAIM_TIME = 345,
-        TOKEN_UNWARNED_RECLAIM_CYCLES = 346,
-        TOKEN_SERVER_ID = 347,
-        TOKEN_LLT = 348,
-        TOKEN_EN = 349,
-        TOKEN_LL = 350,
-        TOKEN_IDENTIFIER = 351,
-        TOKEN_HTYPE = 352,
-        TOKEN_TIME = 353,
-        TOKEN_ENTERPRISE_ID = 354,
-        TOKEN_DHCP4O6_PORT = 355,
-        TOKEN_CONTROL_SOCKET = 356,
-        TOKEN_SOCKET_TYPE = 357,
-        TOKEN_SOCKET_NAME = 358,
-        TOKEN_DHCP_DDNS = 359,
-        TOKEN_ENABLE_UPDATES = 360,
-        TOKEN_QUALIFYING_SUFFIX = 361,
-        TOKEN_SERVER_IP = 362,
-        TOKEN_SERVER_PORT = 363,
-        TOKEN_SENDER_IP = 364,
-        TOKEN_SENDER_PORT = 365,
-        TOKEN_MAX_QUEUE_SIZE = 366,
-        TOKEN_NCR_PROTOCOL = 367,
-        TOKEN_NCR_FORMAT = 368,
-        TOKEN_ALWAYS_INCLUDE_FQDN = 369,
-        TOKEN_OVERRIDE_NO_UPDATE = 370,
-        TOKEN_OVERRIDE_CLIENT_UPDATE = 371,
-        TOKEN_REPLACE_CLIENT_NAME = 372,
-        TOKEN_GENERATED_PREFIX = 373,
-        TOKEN_UDP = 374,
-        TOKEN_TCP = 375,
-        TOKEN_JSON = 376,
-        TOKEN_WHEN_PRESENT = 377,
-        TOKEN_NEVER = 378,
-        TOKEN_ALWAYS = 379,
-        TOKEN_WHEN_NOT_PRESENT = 380,
-        TOKEN_LOGGING = 381,
-        TOKEN_LOGGERS = 382,
-        TOKEN_OUTPUT_OPTIONS = 383,
-        TOKEN_OUTPUT = 384,
-        TOKEN_DEBUGLEVEL = 385,
-        TOKEN_SEVERITY = 386,
-        TOKEN_FLUSH = 387,
-        TOKEN_MAXSIZE = 388,
-        TOKEN_MAXVER = 389,
-        TOKEN_DHCP4 = 390,
-        TOKEN_DHCPDDNS = 391,
-        TOKEN_CONTROL_AGENT = 392,
-        TOKEN_TOPLEVEL_JSON = 393,
-        TOKEN_TOPLEVEL_DHCP6 = 394,
-        TOKEN_SUB_DHCP6 = 395,
-        TOKEN_SUB_INTERFACES6 = 396,
-        TOKEN_SUB_SUBNET6 = 397,
-        TOKEN_SUB_POOL6 = 398,
-        TOKEN_SUB_PD_POOL = 399,
-        TOKEN_SUB_RESERVATION = 400,
-        TOKEN_SUB_OPTION_DEFS = 401,
-        TOKEN_SUB_OPTION_DEF = 402,
-        TOKEN_SUB_OPTION_DATA = 403,
-        TOKEN_SUB_HOOKS_LIBRARY = 404,
-        TOKEN_SUB_DHCP_DDNS = 405,
-        TOKEN_STRING = 406,
-        TOKEN_INTEGER = 407,
-        TOKEN_FLOAT = 408,
-        TOKEN_BOOLEAN = 409
+        TOKEN_GROUP_COMMIT = 286,
+        TOKEN_GROUP_COMMIT_SYNC = 287,
+        TOKEN_GROUP_COMMIT_MAX_BATCH = 288,
+        TOKEN_GROUP_COMMIT_MAX_LATENCY = 289,
+        TOKEN_LOAD_THREADS = 290,
+        TOKEN_LFC_IN_PROCESS = 291,
+        TOKEN_LFC_BATCH_SIZE = 292,
+        TOKEN_LFC_BATCH_INTERVAL = 293,
+        TOKEN_LFC_SNAPSHOT_FORMAT = 294,
+        TOKEN_CACHE_SIZE = 295,
+        TOKEN_CACHE_TTL = 296,
+        TOKEN_CACHE_NEGATIVE_TTL = 297,
+        TOKEN_CONNECTION_POOL_SIZE = 298,
+        TOKEN_RECONNECT_WAIT_TIME = 299,
+        TOKEN_PREFERRED_LIFETIME = 300,
+        TOKEN_VALID_LIFETIME = 301,
+        TOKEN_RENEW_TIMER = 302,
+        TOKEN_REBIND_TIMER = 303,
+        TOKEN_DECLINE_PROBATION_PERIOD = 304,
+        TOKEN_SUBNET6 = 305,
+        TOKEN_OPTION_DEF = 306,
+        TOKEN_OPTION_DATA = 307,
+        TOKEN_NAME = 308,
+        TOKEN_DATA = 309,
+        TOKEN_CODE = 310,
+        TOKEN_SPACE = 311,
+        TOKEN_CSV_FORMAT = 312,
+        TOKEN_ALWAYS_SEND = 313,
+        TOKEN_RECORD_TYPES = 314,
+        TOKEN_ENCAPSULATE = 315,
+        TOKEN_ARRAY = 316,
+        TOKEN_POOLS = 317,
+        TOKEN_POOL = 318,
+        TOKEN_PD_POOLS = 319,
+        TOKEN_PREFIX = 320,
+        TOKEN_PREFIX_LEN = 321,
+        TOKEN_EXCLUDED_PREFIX = 322,
+        TOKEN_EXCLUDED_PREFIX_LEN = 323,
+        TOKEN_DELEGATED_LEN = 324,
+        TOKEN_USER_CONTEXT = 325,
+        TOKEN_SUBNET = 326,
+        TOKEN_INTERFACE = 327,
+        TOKEN_INTERFACE_ID = 328,
+        TOKEN_ID = 329,
+        TOKEN_RAPID_COMMIT = 330,
+        TOKEN_RESERVATION_MODE = 331,
+        TOKEN_DISABLED = 332,
+        TOKEN_OUT_OF_POOL = 333,
+        TOKEN_ALL = 334,
+        TOKEN_SHARED_NETWORKS = 335,
+        TOKEN_MAC_SOURCES = 336,
+        TOKEN_RELAY_SUPPLIED_OPTIONS = 337,
+        TOKEN_HOST_RESERVATION_IDENTIFIERS = 338,
+        TOKEN_CLIENT_CLASSES = 339,
+        TOKEN_TEST = 340,
+        TOKEN_CLIENT_CLASS = 341,
+        TOKEN_RESERVATIONS = 342,
+        TOKEN_IP_ADDRESSES = 343,
+        TOKEN_PREFIXES = 344,
+        TOKEN_DUID = 345,
+        TOKEN_HW_ADDRESS = 346,
+        TOKEN_HOSTNAME = 347,
+        TOKEN_FLEX_ID = 348,
+        TOKEN_RELAY = 349,
+        TOKEN_IP_ADDRESS = 350,
+        TOKEN_HOOKS_LIBRARIES = 351,
+        TOKEN_LIBRARY = 352,
+        TOKEN_PARAMETERS = 353,
+        TOKEN_EXPIRED_LEASES_PROCESSING = 354,
+        TOKEN_RECLAIM_TIMER_WAIT_TIME = 355,
+        TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 356,
+        TOKEN_HOLD_RECLAIMED_TIME = 357,
+        TOKEN_MAX_RECLAIM_LEASES = 358,
+        TOKEN_MAX_RECLAIM_TIME = 359,
+        TOKEN_UNWARNED_RECLAIM_CYCLES = 360,
+        TOKEN_SERVER_ID = 361,
+        TOKEN_LLT = 362,
+        TOKEN_EN = 363,
+        TOKEN_LL = 364,
+        TOKEN_IDENTIFIER = 365,
+        TOKEN_HTYPE = 366,
+        TOKEN_TIME = 367,
+        TOKEN_ENTERPRISE_ID = 368,
+        TOKEN_DHCP4O6_PORT = 369,
+        TOKEN_CONTROL_SOCKET = 370,
+        TOKEN_SOCKET_TYPE = 371,
+        TOKEN_SOCKET_NAME = 372,
+        TOKEN_DHCP_DDNS = 373,
+        TOKEN_ENABLE_UPDATES = 374,
+        TOKEN_QUALIFYING_SUFFIX = 375,
+        TOKEN_SERVER_IP = 376,
+        TOKEN_SERVER_PORT = 377,
+        TOKEN_SENDER_IP = 378,
+        TOKEN_SENDER_PORT = 379,
+        TOKEN_MAX_QUEUE_SIZE = 380,
+        TOKEN_NCR_PROTOCOL = 381,
+        TOKEN_NCR_FORMAT = 382,
+        TOKEN_ALWAYS_INCLUDE_FQDN = 383,
+        TOKEN_OVERRIDE_NO_UPDATE = 384,
+        TOKEN_OVERRIDE_CLIENT_UPDATE = 385,
+        TOKEN_REPLACE_CLIENT_NAME = 386,
+        TOKEN_GENERATED_PREFIX = 387,
+        TOKEN_UDP = 388,
+        TOKEN_TCP = 389,
+        TOKEN_JSON = 390,
+        TOKEN_WHEN_PRESENT = 391,
+        TOKEN_NEVER = 392,
+        TOKEN_ALWAYS = 393,
+        TOKEN_WHEN_NOT_PRESENT = 394,
+        TOKEN_LOGGING = 395,
+        TOKEN_LOGGERS = 396,
+        TOKEN_OUTPUT_OPTIONS = 397,
+        TOKEN_OUTPUT = 398,
+        TOKEN_DEBUGLEVEL = 399,
+        TOKEN_SEVERITY = 400,
+        TOKEN_FLUSH = 401,
+        TOKEN_MAXSIZE = 402,
+        TOKEN_MAXVER = 403,
+        TOKEN_DHCP4 = 404,
+        TOKEN_DHCPDDNS = 405,
+        TOKEN_CONTROL_AGENT = 406,
+        TOKEN_TOPLEVEL_JSON = 407,
+        TOKEN_TOPLEVEL_DHCP6 = 408,
+        TOKEN_SUB_DHCP6 = 409,
+        TOKEN_SUB_INTERFACES6 = 410,
+        TOKEN_SUB_SUBNET6 = 411,
+        TOKEN_SUB_POOL6 = 412,
+        TOKEN_SUB_PD_POOL = 413,
+        TOKEN_SUB_RESERVATION = 414,
+        TOKEN_SUB_OPTION_DEFS = 415,
+        TOKEN_SUB_OPTION_DEF = 416,
+        TOKEN_SUB_OPTION_DATA = 417,
+        TOKEN_SUB_HOOKS_LIBRARY = 418,
+        TOKEN_SUB_DHCP_DDNS = 419,
+        TOKEN_STRING = 420,
+        TOKEN_INTEGER = 421,
+        TOKEN_FLOAT = 422,
+        TOKEN_BOOLEAN = 423
       };
     };
 
@@ -729,6 +743,62 @@ namespace isc { namespace dhcp {
     symbol_type
     make_KEYSPACE (const location_type& l);
 
+    static inline
+    symbol_type
+    make_GROUP_COMMIT (const location_type& l);
+
+    static inline
+    symbol_type
+    make_GROUP_COMMIT_SYNC (const location_type& l);
+
+    static inline
+    symbol_type
+    make_GROUP_COMMIT_MAX_BATCH (const location_type& l);
+
+    static inline
+    symbol_type
+    make_GROUP_COMMIT_MAX_LATENCY (const location_type& l);
+
+    static inline
+    symbol_type
+    make_LOAD_THREADS (const location_type& l);
+
+    static inline
+    symbol_type
+    make_LFC_IN_PROCESS (const location_type& l);
+
+    static inline
+    symbol_type
+    make_LFC_BATCH_SIZE (const location_type& l);
+
+    static inline
+    symbol_type
+    make_LFC_BATCH_INTERVAL (const location_type& l);
+
+    static inline
+    symbol_type
+    make_LFC_SNAPSHOT_FORMAT (const location_type& l);
+
+    static inline
+    symbol_type
+    make_CACHE_SIZE (const location_type& l);
+
+    static inline
+    symbol_type
+    make_CACHE_TTL (const location_type& l);
+
+    static inline
+    symbol_type
+    make_CACHE_NEGATIVE_TTL (const location_type& l);
+
+    static inline
+    symbol_type
+    make_CONNECTION_POOL_SIZE (const location_type& l);
+
+    static inline
+    symbol_type
+    make_RECONNECT_WAIT_TIME (const location_type& l);
+
     static inline
     symbol_type
     make_PREFERRED_LIFETIME (const location_type& l);
@@ -1430,12 +1500,12 @@ namespace isc { namespace dhcp {
     enum
     {
       yyeof_ = 0,
-      yylast_ = 836,     ///< Last index in yytable_.
-      yynnts_ = 346,  ///< Number of nonterminal symbols.
+      yylast_ = 893,     ///< Last index in yytable_.
+      yynnts_ = 361,  ///< Number of nonterminal symbols.
       yyfinal_ = 28, ///< Termination state number.
       yyterror_ = 1,
       yyerrcode_ = 256,
-      yyntokens_ = 155  ///< Number of tokens.
+      yyntokens_ = 169  ///< Number of tokens.
     };
 
 
@@ -1492,9 +1562,11 @@ namespace isc { namespace dhcp {
      115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
      125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
      135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
-     145,   146,   147,   148,   149,   150,   151,   152,   153,   154
+     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
+     155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
+     165,   166,   167,   168
     };
-    const unsigned int user_token_number_max_ = 409;
+    const unsigned int user_token_number_max_ = 423;
     const token_number_type undef_token_ = 2;
 
     if (static_cast<int>(t) <= yyeof_)
@@ -1527,29 +1599,29 @@ namespace isc { namespace dhcp {
   {
       switch (other.type_get ())
     {
-      case 170: // value
-      case 174: // map_value
-      case 218: // db_type
-      case 294: // hr_mode
-      case 425: // duid_type
-      case 458: // ncr_protocol_value
-      case 466: // replace_client_name_value
+      case 184: // value
+      case 188: // map_value
+      case 232: // db_type
+      case 323: // hr_mode
+      case 454: // duid_type
+      case 487: // ncr_protocol_value
+      case 495: // replace_client_name_value
         value.copy< ElementPtr > (other.value);
         break;
 
-      case 154: // "boolean"
+      case 168: // "boolean"
         value.copy< bool > (other.value);
         break;
 
-      case 153: // "floating point"
+      case 167: // "floating point"
         value.copy< double > (other.value);
         break;
 
-      case 152: // "integer"
+      case 166: // "integer"
         value.copy< int64_t > (other.value);
         break;
 
-      case 151: // "constant string"
+      case 165: // "constant string"
         value.copy< std::string > (other.value);
         break;
 
@@ -1570,29 +1642,29 @@ namespace isc { namespace dhcp {
     (void) v;
       switch (this->type_get ())
     {
-      case 170: // value
-      case 174: // map_value
-      case 218: // db_type
-      case 294: // hr_mode
-      case 425: // duid_type
-      case 458: // ncr_protocol_value
-      case 466: // replace_client_name_value
+      case 184: // value
+      case 188: // map_value
+      case 232: // db_type
+      case 323: // hr_mode
+      case 454: // duid_type
+      case 487: // ncr_protocol_value
+      case 495: // replace_client_name_value
         value.copy< ElementPtr > (v);
         break;
 
-      case 154: // "boolean"
+      case 168: // "boolean"
         value.copy< bool > (v);
         break;
 
-      case 153: // "floating point"
+      case 167: // "floating point"
         value.copy< double > (v);
         break;
 
-      case 152: // "integer"
+      case 166: // "integer"
         value.copy< int64_t > (v);
         break;
 
-      case 151: // "constant string"
+      case 165: // "constant string"
         value.copy< std::string > (v);
         break;
 
@@ -1672,29 +1744,29 @@ namespace isc { namespace dhcp {
     // Type destructor.
     switch (yytype)
     {
-      case 170: // value
-      case 174: // map_value
-      case 218: // db_type
-      case 294: // hr_mode
-      case 425: // duid_type
-      case 458: // ncr_protocol_value
-      case 466: // replace_client_name_value
+      case 184: // value
+      case 188: // map_value
+      case 232: // db_type
+      case 323: // hr_mode
+      case 454: // duid_type
+      case 487: // ncr_protocol_value
+      case 495: // replace_client_name_value
         value.template destroy< ElementPtr > ();
         break;
 
-      case 154: // "boolean"
+      case 168: // "boolean"
         value.template destroy< bool > ();
         break;
 
-      case 153: // "floating point"
+      case 167: // "floating point"
         value.template destroy< double > ();
         break;
 
-      case 152: // "integer"
+      case 166: // "integer"
         value.template destroy< int64_t > ();
         break;
 
-      case 151: // "constant string"
+      case 165: // "constant string"
         value.template destroy< std::string > ();
         break;
 
@@ -1721,29 +1793,29 @@ namespace isc { namespace dhcp {
     super_type::move(s);
       switch (this->type_get ())
     {
-      case 170: // value
-      case 174: // map_value
-      case 218: // db_type
-      case 294: // hr_mode
-      case 425: // duid_type
-      case 458: // ncr_protocol_value
-      case 466: // replace_client_name_value
+      case 184: // value
+      case 188: // map_value
+      case 232: // db_type
+      case 323: // hr_mode
+      case 454: // duid_type
+      case 487: // ncr_protocol_value
+      case 495: // replace_client_name_value
         value.move< ElementPtr > (s.value);
         break;
 
-      case 154: // "boolean"
+      case 168: // "boolean"
         value.move< bool > (s.value);
         break;
 
-      case 153: // "floating point"
+      case 167: // "floating point"
         value.move< double > (s.value);
         break;
 
-      case 152: // "integer"
+      case 166: // "integer"
         value.move< int64_t > (s.value);
         break;
 
-      case 151: // "constant string"
+      case 165: // "constant string"
         value.move< std::string > (s.value);
         break;
 
@@ -1817,7 +1889,8 @@ namespace isc { namespace dhcp {
      375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
      385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
      395,   396,   397,   398,   399,   400,   401,   402,   403,   404,
-     405,   406,   407,   408,   409
+     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
+     415,   416,   417,   418,   419,   420,   421,   422,   423
     };
     return static_cast<token_type> (yytoken_number_[type]);
   }
@@ -1996,6 +2069,90 @@ namespace isc { namespace dhcp {
     return symbol_type (token::TOKEN_KEYSPACE, l);
   }
 
+  Dhcp6Parser::symbol_type
+  Dhcp6Parser::make_GROUP_COMMIT (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_GROUP_COMMIT, l);
+  }
+
+  Dhcp6Parser::symbol_type
+  Dhcp6Parser::make_GROUP_COMMIT_SYNC (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_GROUP_COMMIT_SYNC, l);
+  }
+
+  Dhcp6Parser::symbol_type
+  Dhcp6Parser::make_GROUP_COMMIT_MAX_BATCH (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_GROUP_COMMIT_MAX_BATCH, l);
+  }
+
+  Dhcp6Parser::symbol_type
+  Dhcp6Parser::make_GROUP_COMMIT_MAX_LATENCY (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_GROUP_COMMIT_MAX_LATENCY, l);
+  }
+
+  Dhcp6Parser::symbol_type
+  Dhcp6Parser::make_LOAD_THREADS (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_LOAD_THREADS, l);
+  }
+
+  Dhcp6Parser::symbol_type
+  Dhcp6Parser::make_LFC_IN_PROCESS (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_LFC_IN_PROCESS, l);
+  }
+
+  Dhcp6Parser::symbol_type
+  Dhcp6Parser::make_LFC_BATCH_SIZE (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_LFC_BATCH_SIZE, l);
+  }
+
+  Dhcp6Parser::symbol_type
+  Dhcp6Parser::make_LFC_BATCH_INTERVAL (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_LFC_BATCH_INTERVAL, l);
+  }
+
+  Dhcp6Parser::symbol_type
+  Dhcp6Parser::make_LFC_SNAPSHOT_FORMAT (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_LFC_SNAPSHOT_FORMAT, l);
+  }
+
+  Dhcp6Parser::symbol_type
+  Dhcp6Parser::make_CACHE_SIZE (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_CACHE_SIZE, l);
+  }
+
+  Dhcp6Parser::symbol_type
+  Dhcp6Parser::make_CACHE_TTL (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_CACHE_TTL, l);
+  }
+
+  Dhcp6Parser::symbol_type
+  Dhcp6Parser::make_CACHE_NEGATIVE_TTL (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_CACHE_NEGATIVE_TTL, l);
+  }
+
+  Dhcp6Parser::symbol_type
+  Dhcp6Parser::make_CONNECTION_POOL_SIZE (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_CONNECTION_POOL_SIZE, l);
+  }
+
+  Dhcp6Parser::symbol_type
+  Dhcp6Parser::make_RECONNECT_WAIT_TIME (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_RECONNECT_WAIT_TIME, l);
+  }
+
   Dhcp6Parser::symbol_type
   Dhcp6Parser::make_PREFERRED_LIFETIME (const location_type& l)
   {
@@ -2743,7 +2900,7 @@ namespace isc { namespace dhcp {
 
 #line 14 "dhcp6_parser.yy" // lalr1.cc:377
 } } // isc::dhcp
-#line 2747 "dhcp6_parser.h" // lalr1.cc:377
+#line 2904 "dhcp6_parser.h" // lalr1.cc:377
 
 
 
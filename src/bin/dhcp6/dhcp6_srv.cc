@@ -32,6 +32,8 @@
 #include <dhcpsrv/callout_handle_store.h>
 #include <dhcpsrv/cfg_host_operations.h>
 #include <dhcpsrv/cfgmgr.h>
+#include <dhcpsrv/client_class_index.h>
+#include <dhcpsrv/host_mgr.h>
 #include <dhcpsrv/lease_mgr.h>
 #include <dhcpsrv/lease_mgr_factory.h>
 #include <dhcpsrv/ncr_generator.h>
@@ -122,6 +124,76 @@ struct Dhcp6Hooks {
 // module is called.
 Dhcp6Hooks Hooks;
 
+/// @brief Maximum number of received packets waiting for processing
+/// when multi-threading is enabled. Packets received when the queue
+/// is full are dropped.
+const size_t PACKET_QUEUE_SIZE = 1024;
+
+/// @brief Handles of the packet statistics updated for each packet.
+struct Dhcp6Stats {
+    StatHandle received_;             ///< "pkt6-received"
+    StatHandle receive_drop_;         ///< "pkt6-receive-drop"
+    StatHandle parse_failed_;         ///< "pkt6-parse-failed"
+    StatHandle sent_;                 ///< "pkt6-sent"
+    StatHandle advertise_sent_;       ///< "pkt6-advertise-sent"
+    StatHandle reply_sent_;           ///< "pkt6-reply-sent"
+    StatHandle dhcpv4_response_sent_; ///< "pkt6-dhcpv4-response-sent"
+
+    /// "pkt6-<type>-received" by message type, "pkt6-unknown-received"
+    /// for the unknown types.
+    StatHandle type_received_[DHCPV6_DHCPV4_RESPONSE + 1];
+
+    /// Constructor that registers the statistics
+    Dhcp6Stats() {
+        StatsMgr& mgr = StatsMgr::instance();
+        received_             = mgr.getHandle("pkt6-received");
+        receive_drop_         = mgr.getHandle("pkt6-receive-drop");
+        parse_failed_         = mgr.getHandle("pkt6-parse-failed");
+        sent_                 = mgr.getHandle("pkt6-sent");
+        advertise_sent_       = mgr.getHandle("pkt6-advertise-sent");
+        reply_sent_           = mgr.getHandle("pkt6-reply-sent");
+        dhcpv4_response_sent_ = mgr.getHandle("pkt6-dhcpv4-response-sent");
+
+        const StatHandle unknown = mgr.getHandle("pkt6-unknown-received");
+        for (int type = 0; type <= DHCPV6_DHCPV4_RESPONSE; ++type) {
+            type_received_[type] = unknown;
+        }
+        type_received_[DHCPV6_SOLICIT] =
+            mgr.getHandle("pkt6-solicit-received");
+        // Should not happen, but let's keep a counter for it
+        type_received_[DHCPV6_ADVERTISE] =
+            mgr.getHandle("pkt6-advertise-received");
+        type_received_[DHCPV6_REQUEST] =
+            mgr.getHandle("pkt6-request-received");
+        type_received_[DHCPV6_CONFIRM] =
+            mgr.getHandle("pkt6-confirm-received");
+        type_received_[DHCPV6_RENEW] =
+            mgr.getHandle("pkt6-renew-received");
+        type_received_[DHCPV6_REBIND] =
+            mgr.getHandle("pkt6-rebind-received");
+        // Should not happen, but let's keep a counter for it
+        type_received_[DHCPV6_REPLY] =
+            mgr.getHandle("pkt6-reply-received");
+        type_received_[DHCPV6_RELEASE] =
+            mgr.getHandle("pkt6-release-received");
+        type_received_[DHCPV6_DECLINE] =
+            mgr.getHandle("pkt6-decline-received");
+        type_received_[DHCPV6_RECONFIGURE] =
+            mgr.getHandle("pkt6-reconfigure-received");
+        type_received_[DHCPV6_INFORMATION_REQUEST] =
+            mgr.getHandle("pkt6-infrequest-received");
+        type_received_[DHCPV6_DHCPV4_QUERY] =
+            mgr.getHandle("pkt6-dhcpv4-query-received");
+        // Should not happen, but let's keep a counter for it
+        type_received_[DHCPV6_DHCPV4_RESPONSE] =
+            mgr.getHandle("pkt6-dhcpv4-response-received");
+    }
+};
+
+// Declare the statistics handles. As for the Hooks object, the handles
+// are resolved when the module is loaded.
+Dhcp6Stats Stats;
+
 /// @brief Creates instance of the Status Code option.
 ///
 /// This variant of the function is used when the Status Code option
@@ -178,9 +250,19 @@ namespace dhcp {
 const std::string Dhcpv6Srv::VENDOR_CLASS_PREFIX("VENDOR_CLASS_");
 
 Dhcpv6Srv::Dhcpv6Srv(uint16_t port)
-    : io_service_(new IOService()), port_(port), serverid_(), shutdown_(true),
+    : io_service_(new IOService()), port_(port), packet_thread_count_(0),
+      packet_thread_pool_(), latency_("pkt6"), serverid_(), shutdown_(true),
       alloc_engine_()
 {
+    latency_.addMessageType(DHCPV6_SOLICIT, "solicit");
+    latency_.addMessageType(DHCPV6_REQUEST, "request");
+    latency_.addMessageType(DHCPV6_CONFIRM, "confirm");
+    latency_.addMessageType(DHCPV6_RENEW, "renew");
+    latency_.addMessageType(DHCPV6_REBIND, "rebind");
+    latency_.addMessageType(DHCPV6_RELEASE, "release");
+    latency_.addMessageType(DHCPV6_DECLINE, "decline");
+    latency_.addMessageType(DHCPV6_INFORMATION_REQUEST, "infrequest");
+    latency_.addMessageType(DHCPV6_DHCPV4_QUERY, "dhcpv4-query");
 
     LOG_DEBUG(dhcp6_logger, DBG_DHCP6_START, DHCP6_OPEN_SOCKET).arg(port);
 
@@ -216,6 +298,9 @@ Dhcpv6Srv::Dhcpv6Srv(uint16_t port)
 }
 
 Dhcpv6Srv::~Dhcpv6Srv() {
+    // Packet processing threads use the resources released below.
+    stopPacketThreads();
+
     try {
         stopD2();
     } catch(const std::exception& ex) {
@@ -243,6 +328,57 @@ void Dhcpv6Srv::shutdown() {
     shutdown_ = true;
 }
 
+void
+Dhcpv6Srv::startPacketThreads() {
+    if ((packet_thread_count_ == 0) || packetThreadsRunning()) {
+        return;
+    }
+
+    // The lease backend and the host data source, if any, must be safe
+    // to be used concurrently, i.e. the memfile backend or a backend with
+    // a pool of connections.
+    std::string lease_db = "none";
+    bool thread_safe = false;
+    if (LeaseMgrFactory::haveInstance()) {
+        lease_db = LeaseMgrFactory::instance().getType();
+        thread_safe = LeaseMgrFactory::instance().isThreadSafe();
+    }
+    std::string hosts_db = "none";
+    HostDataSourcePtr host_data_source = HostMgr::instance().getHostDataSource();
+    if (host_data_source) {
+        hosts_db = host_data_source->getType();
+        thread_safe = thread_safe && host_data_source->isThreadSafe();
+    }
+    if (!thread_safe) {
+        LOG_WARN(dhcp6_logger, DHCP6_PACKET_THREADS_UNSUPPORTED)
+            .arg(lease_db).arg(hosts_db);
+        return;
+    }
+
+    if (!packet_thread_pool_) {
+        packet_thread_pool_.reset(new isc::util::thread::ThreadPool(PACKET_QUEUE_SIZE));
+    }
+#ifdef HAVE_MYSQL
+    // The MySQL client library must be initialized by each thread using it.
+    packet_thread_pool_->start(packet_thread_count_,
+                               &MySqlConnection::initThread,
+                               &MySqlConnection::endThread);
+#else
+    packet_thread_pool_->start(packet_thread_count_);
+#endif
+
+    LOG_INFO(dhcp6_logger, DHCP6_PACKET_THREADS_STARTED)
+        .arg(packet_thread_count_);
+}
+
+void
+Dhcpv6Srv::stopPacketThreads() {
+    if (packet_thread_pool_) {
+        packet_thread_pool_->wait();
+        packet_thread_pool_->stop();
+    }
+}
+
 Pkt6Ptr Dhcpv6Srv::receivePacket(int timeout) {
     return (IfaceMgr::instance().receive6(timeout));
 }
@@ -251,6 +387,10 @@ void Dhcpv6Srv::sendPacket(const Pkt6Ptr& packet) {
     IfaceMgr::instance().send(packet);
 }
 
+void Dhcpv6Srv::sendPackets(const std::vector<Pkt6Ptr>& packets) {
+    IfaceMgr::instance().sendBatch(packets);
+}
+
 bool
 Dhcpv6Srv::testServerID(const Pkt6Ptr& pkt) {
     /// @todo Currently we always check server identifier regardless if
@@ -389,13 +529,16 @@ bool Dhcpv6Srv::run() {
         }
     }
 
+    // Let the packet processing threads complete before the server is
+    // torn down.
+    stopPacketThreads();
+
     return (true);
 }
 
 void Dhcpv6Srv::run_one() {
-    // client's message and server's response
+    // client's message
     Pkt6Ptr query;
-    Pkt6Ptr rsp;
 
     try {
         // Set select() timeout to 1s. This value should not be modified
@@ -422,7 +565,7 @@ void Dhcpv6Srv::run_one() {
             // any failures in unpacking will cause the packet to be dropped.
             // we will increase type specific packets further down the road.
             // See processStatsReceived().
-            StatsMgr::instance().addValue("pkt6-received", static_cast<int64_t>(1));
+            StatsMgr::instance().addValue(Stats.received_, static_cast<int64_t>(1));
 
         }
         // We used to log that the wait was interrupted, but this is no longer
@@ -468,12 +611,86 @@ void Dhcpv6Srv::run_one() {
         return;
     }
 
-    processPacket(query, rsp);
+    // The responses to the packets received together are sent together.
+    if (!response_batch_) {
+        response_batch_.reset(new ResponseBatch6());
+    }
+    ResponseBatch6Ptr batch = response_batch_;
+    batch->add();
+
+    if (packetThreadsRunning()) {
+        // Hand the packet over to one of the packet processing threads.
+        if (!packet_thread_pool_->add(boost::bind(&Dhcpv6Srv::processPacketInThread,
+                                                  this, query, batch))) {
+            LOG_DEBUG(packet6_logger, DBG_DHCP6_BASIC, DHCP6_PACKET_QUEUE_FULL)
+                .arg(query->getRemoteAddr().toText())
+                .arg(query->getIface());
+            StatsMgr::instance().addValue(Stats.receive_drop_,
+                                          static_cast<int64_t>(1));
+            std::vector<Pkt6Ptr> ready;
+            batch->done(Pkt6Ptr(), ready);
+        }
 
-    if (!rsp) {
-        return;
+    } else {
+        processPacketAndSendResponse(query, batch);
     }
 
+    // The reception cycle ends with the last packet received together with
+    // this one. The responses are sent by the thread which processes the
+    // last packet of the cycle, or here if all have been processed.
+    if (!IfaceMgr::instance().hasReceived6()) {
+        response_batch_.reset();
+        std::vector<Pkt6Ptr> ready;
+        if (batch->close(ready)) {
+            sendResponses(ready);
+        }
+    }
+}
+
+void
+Dhcpv6Srv::processPacketInThread(Pkt6Ptr query, ResponseBatch6Ptr batch) {
+    processPacketAndSendResponse(query, batch);
+
+    // The callout handle associated with the query is held by the thread
+    // local store. Release it so as it doesn't outlive the packet.
+    getCalloutHandle(Pkt6Ptr());
+}
+
+void
+Dhcpv6Srv::processPacketAndSendResponse(Pkt6Ptr query, ResponseBatch6Ptr batch) {
+    LatencyMeasurement latency(latency_, query);
+    Pkt6Ptr rsp;
+
+    try {
+        processPacket(query, rsp);
+    } catch (const std::exception& e) {
+        LOG_ERROR(packet6_logger, DHCP6_PACKET_PROCESS_STD_EXCEPTION)
+            .arg(e.what());
+    } catch (...) {
+        LOG_ERROR(packet6_logger, DHCP6_PACKET_PROCESS_EXCEPTION);
+    }
+
+    if (rsp) {
+        prepareResponse(query, rsp);
+    }
+
+    // The batch must learn about every processed packet, including these
+    // having no response.
+    std::vector<Pkt6Ptr> ready;
+    if (batch) {
+        if (!batch->done(rsp, ready)) {
+            return;
+        }
+
+    } else if (rsp) {
+        ready.push_back(rsp);
+    }
+
+    sendResponses(ready);
+}
+
+void
+Dhcpv6Srv::prepareResponse(const Pkt6Ptr& query, Pkt6Ptr& rsp) {
     try {
 
         // Now all fields and options are constructed into output wire buffer.
@@ -501,6 +718,7 @@ void Dhcpv6Srv::run_one() {
             if (callout_handle->getStatus() == CalloutHandle::NEXT_STEP_SKIP) {
                 LOG_DEBUG(hooks_logger, DBG_DHCP6_HOOKS, DHCP6_HOOK_BUFFER_SEND_SKIP)
                     .arg(rsp->getLabel());
+                rsp.reset();
                 return;
             }
 
@@ -512,13 +730,34 @@ void Dhcpv6Srv::run_one() {
         LOG_DEBUG(packet6_logger, DBG_DHCP6_DETAIL_DATA, DHCP6_RESPONSE_DATA)
             .arg(static_cast<int>(rsp->getType())).arg(rsp->toText());
 
-        sendPacket(rsp);
+    } catch (const std::exception& e) {
+        LOG_ERROR(packet6_logger, DHCP6_PACKET_SEND_FAIL).arg(e.what());
+        rsp.reset();
+    }
+}
+
+void
+Dhcpv6Srv::sendResponses(const std::vector<Pkt6Ptr>& responses) {
+    if (responses.empty()) {
+        return;
+    }
+
+    try {
+        {
+            StageTimer timer(ProcessingLatency::STAGE_SEND);
+            sendPackets(responses);
+        }
 
-        // Update statistics accordingly for sent packet.
-        processStatsSent(rsp);
+        // Update statistics accordingly for sent packets.
+        for (std::vector<Pkt6Ptr>::const_iterator rsp = responses.begin();
+             rsp != responses.end(); ++rsp) {
+            processStatsSent(*rsp);
+        }
 
     } catch (const std::exception& e) {
-        LOG_ERROR(packet6_logger, DHCP6_PACKET_SEND_FAIL).arg(e.what());
+        LOG_ERROR(packet6_logger, DHCP6_PACKET_BATCH_SEND_FAIL)
+            .arg(responses.size())
+            .arg(e.what());
     }
 }
 
@@ -568,6 +807,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
                 .arg(query->getRemoteAddr().toText())
                 .arg(query->getLocalAddr().toText())
                 .arg(query->getIface());
+            StageTimer timer(ProcessingLatency::STAGE_UNPACK);
             query->unpack();
         } catch (const std::exception &e) {
             // Failed to parse the packet.
@@ -579,9 +819,9 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
                 .arg(e.what());
 
             // Increase the statistics of parse failures and dropped packets.
-            StatsMgr::instance().addValue("pkt6-parse-failed",
+            StatsMgr::instance().addValue(Stats.parse_failed_,
                                           static_cast<int64_t>(1));
-            StatsMgr::instance().addValue("pkt6-receive-drop",
+            StatsMgr::instance().addValue(Stats.receive_drop_,
                                           static_cast<int64_t>(1));
             return;
         }
@@ -595,7 +835,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
     if (!testServerID(query)) {
 
         // Increase the statistic of dropped packets.
-        StatsMgr::instance().addValue("pkt6-receive-drop", static_cast<int64_t>(1));
+        StatsMgr::instance().addValue(Stats.receive_drop_, static_cast<int64_t>(1));
         return;
     }
 
@@ -605,7 +845,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
     if (!testUnicast(query)) {
 
         // Increase the statistic of dropped packets.
-        StatsMgr::instance().addValue("pkt6-receive-drop", static_cast<int64_t>(1));
+        StatsMgr::instance().addValue(Stats.receive_drop_, static_cast<int64_t>(1));
         return;
     }
 
@@ -713,7 +953,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
             .arg(e.what());
 
         // Increase the statistic of dropped packets.
-        StatsMgr::instance().addValue("pkt6-receive-drop", static_cast<int64_t>(1));
+        StatsMgr::instance().addValue(Stats.receive_drop_, static_cast<int64_t>(1));
 
     } catch (const std::exception& e) {
 
@@ -730,7 +970,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
             .arg(e.what());
 
         // Increase the statistic of dropped packets.
-        StatsMgr::instance().addValue("pkt6-receive-drop", static_cast<int64_t>(1));
+        StatsMgr::instance().addValue(Stats.receive_drop_, static_cast<int64_t>(1));
     }
 
     if (!rsp) {
@@ -805,6 +1045,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
 
     if (!skip_pack) {
         try {
+            StageTimer timer(ProcessingLatency::STAGE_PACK);
             rsp->pack();
         } catch (const std::exception& e) {
             LOG_ERROR(options6_logger, DHCP6_PACK_FAIL).arg(e.what());
@@ -1108,6 +1349,8 @@ Dhcpv6Srv::sanityCheck(const Pkt6Ptr& pkt, RequirementLevel clientid,
 
 Subnet6Ptr
 Dhcpv6Srv::selectSubnet(const Pkt6Ptr& question) {
+    StageTimer timer(ProcessingLatency::STAGE_SUBNET_SELECTION);
+
     // Initialize subnet selector with the values used to select the subnet.
     SubnetSelector selector;
     selector.iface_name_ = question->getIface();
@@ -1195,6 +1438,7 @@ Dhcpv6Srv::selectSubnet(const Pkt6Ptr& question) {
 void
 Dhcpv6Srv::assignLeases(const Pkt6Ptr& question, Pkt6Ptr& answer,
                         AllocEngine::ClientContext6& ctx) {
+    StageTimer timer(ProcessingLatency::STAGE_ALLOCATION);
 
     Subnet6Ptr subnet = ctx.subnet_;
 
@@ -2047,6 +2291,8 @@ Dhcpv6Srv::extendIA_PD(const Pkt6Ptr& query,
 void
 Dhcpv6Srv::extendLeases(const Pkt6Ptr& query, Pkt6Ptr& reply,
                        AllocEngine::ClientContext6& ctx) {
+    StageTimer timer(ProcessingLatency::STAGE_ALLOCATION);
+
 
     // We will try to extend lease lifetime for all IA options in the client's
     // Renew or Rebind message.
@@ -2294,6 +2540,13 @@ Dhcpv6Srv::releaseIA_NA(const DuidPtr& duid, const Pkt6Ptr& query,
             StatsMgr::generateName("subnet", lease->subnet_id_, "assigned-nas"),
             static_cast<int64_t>(-1));
 
+        // The address can be allocated to another client.
+        ConstSubnet6Ptr subnet = CfgMgr::instance().getCurrentCfg()->
+            getCfgSubnets6()->getBySubnetId(lease->subnet_id_);
+        if (subnet) {
+            subnet->markLeaseFree(lease->type_, lease->addr_);
+        }
+
         // Check if a lease has flags indicating that the FQDN update has
         // been performed. If so, create NameChangeRequest which removes
         // the entries.
@@ -2452,6 +2705,13 @@ Dhcpv6Srv::releaseIA_PD(const DuidPtr& duid, const Pkt6Ptr& query,
         StatsMgr::instance().addValue(
             StatsMgr::generateName("subnet", lease->subnet_id_, "assigned-pds"),
             static_cast<int64_t>(-1));
+
+        // The prefix can be allocated to another client.
+        ConstSubnet6Ptr subnet = CfgMgr::instance().getCurrentCfg()->
+            getCfgSubnets6()->getBySubnetId(lease->subnet_id_);
+        if (subnet) {
+            subnet->markLeaseFree(lease->type_, lease->addr_);
+        }
     }
 
     return (ia_rsp);
@@ -3078,6 +3338,8 @@ void Dhcpv6Srv::classifyByVendor(const Pkt6Ptr& pkt, std::string& classes) {
 }
 
 void Dhcpv6Srv::classifyPacket(const Pkt6Ptr& pkt) {
+    StageTimer timer(ProcessingLatency::STAGE_CLASSIFICATION);
+
     string classes = "";
 
     // First phase: built-in vendor class processing
@@ -3085,39 +3347,74 @@ void Dhcpv6Srv::classifyPacket(const Pkt6Ptr& pkt) {
 
     // Run match expressions
     // Note getClientClassDictionary() cannot be null
-    const ClientClassDefMapPtr& defs_ptr = CfgMgr::instance().getCurrentCfg()->
-        getClientClassDictionary()->getClasses();
-    for (ClientClassDefMap::const_iterator it = defs_ptr->begin();
-         it != defs_ptr->end(); ++it) {
-        // Note second cannot be null
-        const ExpressionPtr& expr_ptr = it->second->getMatchExpr();
-        // Nothing to do without an expression to evaluate
-        if (!expr_ptr) {
-            continue;
+    const ClientClassIndex& index = CfgMgr::instance().getCurrentCfg()->
+        getClientClassDictionary()->getIndex();
+    // The value stack is shared by all expressions
+    ValueStack values;
+    // Classes comparing the same value with constants: the value is
+    // computed once and selects the matching classes
+    const ClientClassIndex::GroupMap& groups = index.getGroups();
+    for (ClientClassIndex::GroupMap::const_iterator group = groups.begin();
+         group != groups.end(); ++group) {
+        try {
+            const ClientClassDefList& matches =
+                group->second->match(*pkt, values);
+            for (ClientClassDefList::const_iterator cclass = matches.begin();
+                 cclass != matches.end(); ++cclass) {
+                LOG_INFO(dhcp6_logger, EVAL_RESULT)
+                    .arg((*cclass)->getName())
+                    .arg(true);
+                // Matching: add the class
+                pkt->addClass((*cclass)->getName());
+                classes += (*cclass)->getName() + " ";
+            }
+        } catch (const Exception& ex) {
+            const ClientClassDefList& failed = group->second->getClasses();
+            for (ClientClassDefList::const_iterator cclass = failed.begin();
+                 cclass != failed.end(); ++cclass) {
+                LOG_ERROR(dhcp6_logger, EVAL_RESULT)
+                    .arg((*cclass)->getName())
+                    .arg(ex.what());
+            }
+        } catch (...) {
+            const ClientClassDefList& failed = group->second->getClasses();
+            for (ClientClassDefList::const_iterator cclass = failed.begin();
+                 cclass != failed.end(); ++cclass) {
+                LOG_ERROR(dhcp6_logger, EVAL_RESULT)
+                    .arg((*cclass)->getName())
+                    .arg("get exception?");
+            }
         }
+    }
+    // Other classes are evaluated one by one
+    const ClientClassDefList& others = index.getOthers();
+    for (ClientClassDefList::const_iterator it = others.begin();
+         it != others.end(); ++it) {
+        // Note the index holds only classes with an expression
+        const CompiledExpressionPtr& expr_ptr = (*it)->getCompiledMatchExpr();
         // Evaluate the expression which can return false (no match),
         // true (match) or raise an exception (error)
         try {
-            bool status = evaluateBool(*expr_ptr, *pkt);
+            bool status = expr_ptr->evaluateBool(*pkt, values);
             if (status) {
                 LOG_INFO(dhcp6_logger, EVAL_RESULT)
-                    .arg(it->first)
+                    .arg((*it)->getName())
                     .arg(status);
                 // Matching: add the class
-                pkt->addClass(it->first);
-                classes += it->first + " ";
+                pkt->addClass((*it)->getName());
+                classes += (*it)->getName() + " ";
             } else {
                 LOG_DEBUG(dhcp6_logger, DBG_DHCP6_DETAIL, EVAL_RESULT)
-                    .arg(it->first)
+                    .arg((*it)->getName())
                     .arg(status);
             }
         } catch (const Exception& ex) {
             LOG_ERROR(dhcp6_logger, EVAL_RESULT)
-                .arg(it->first)
+                .arg((*it)->getName())
                 .arg(ex.what());
         } catch (...) {
             LOG_ERROR(dhcp6_logger, EVAL_RESULT)
-                .arg(it->first)
+                .arg((*it)->getName())
                 .arg("get exception?");
         }
     }
@@ -3357,79 +3654,37 @@ void Dhcpv6Srv::processStatsReceived(const Pkt6Ptr& query) {
     // Note that we're not bumping pkt6-received statistic as it was
     // increased early in the packet reception code.
 
-    string stat_name = "pkt6-unknown-received";
-    switch (query->getType()) {
-    case DHCPV6_SOLICIT:
-        stat_name = "pkt6-solicit-received";
-        break;
-    case DHCPV6_ADVERTISE:
-        // Should not happen, but let's keep a counter for it
-        stat_name = "pkt6-advertise-received";
-        break;
-    case DHCPV6_REQUEST:
-        stat_name = "pkt6-request-received";
-        break;
-    case DHCPV6_CONFIRM:
-        stat_name = "pkt6-confirm-received";
-        break;
-    case DHCPV6_RENEW:
-        stat_name = "pkt6-renew-received";
-        break;
-    case DHCPV6_REBIND:
-        stat_name = "pkt6-rebind-received";
-        break;
-    case DHCPV6_REPLY:
-        // Should not happen, but let's keep a counter for it
-        stat_name = "pkt6-reply-received";
-        break;
-    case DHCPV6_RELEASE:
-        stat_name = "pkt6-release-received";
-        break;
-    case DHCPV6_DECLINE:
-        stat_name = "pkt6-decline-received";
-        break;
-    case DHCPV6_RECONFIGURE:
-        stat_name = "pkt6-reconfigure-received";
-        break;
-    case DHCPV6_INFORMATION_REQUEST:
-        stat_name = "pkt6-infrequest-received";
-        break;
-    case DHCPV6_DHCPV4_QUERY:
-        stat_name = "pkt6-dhcpv4-query-received";
-        break;
-    case DHCPV6_DHCPV4_RESPONSE:
-        // Should not happen, but let's keep a counter for it
-        stat_name = "pkt6-dhcpv4-response-received";
-        break;
-    default:
-            ; // do nothing
+    StatHandle handle = Stats.type_received_[0];
+    const uint8_t type = query->getType();
+    if (type <= DHCPV6_DHCPV4_RESPONSE) {
+        handle = Stats.type_received_[type];
     }
 
-    StatsMgr::instance().addValue(stat_name, static_cast<int64_t>(1));
+    StatsMgr::instance().addValue(handle, static_cast<int64_t>(1));
 }
 
 void Dhcpv6Srv::processStatsSent(const Pkt6Ptr& response) {
     // Increase generic counter for sent packets.
-    StatsMgr::instance().addValue("pkt6-sent", static_cast<int64_t>(1));
+    StatsMgr::instance().addValue(Stats.sent_, static_cast<int64_t>(1));
 
     // Increase packet type specific counter for packets sent.
-    string stat_name;
+    StatHandle handle;
     switch (response->getType()) {
     case DHCPV6_ADVERTISE:
-        stat_name = "pkt6-advertise-sent";
+        handle = Stats.advertise_sent_;
         break;
     case DHCPV6_REPLY:
-        stat_name = "pkt6-reply-sent";
+        handle = Stats.reply_sent_;
         break;
     case DHCPV6_DHCPV4_RESPONSE:
-        stat_name = "pkt6-dhcpv4-response-sent";
+        handle = Stats.dhcpv4_response_sent_;
         break;
     default:
         // That should never happen
         return;
     }
 
-    StatsMgr::instance().addValue(stat_name, static_cast<int64_t>(1));
+    StatsMgr::instance().addValue(handle, static_cast<int64_t>(1));
 }
 
 int Dhcpv6Srv::getHookIndexBuffer6Send() {
@@ -19,9 +19,12 @@
 #include <dhcpsrv/alloc_engine.h>
 #include <dhcpsrv/cfg_option.h>
 #include <dhcpsrv/d2_client_mgr.h>
+#include <dhcpsrv/processing_latency.h>
+#include <dhcpsrv/response_batch.h>
 #include <dhcpsrv/subnet.h>
 #include <hooks/callout_handle.h>
 #include <dhcpsrv/daemon.h>
+#include <util/threads/thread_pool.h>
 
 #include <iostream>
 #include <queue>
@@ -45,6 +48,12 @@ public:
         isc::Exception(file, line, what) { };
 };
 
+/// @brief Type of the responses to the queries received together.
+typedef ResponseBatch<Pkt6Ptr> ResponseBatch6;
+
+/// @brief Type representing the pointer to the @c ResponseBatch6.
+typedef boost::shared_ptr<ResponseBatch6> ResponseBatch6Ptr;
+
 /// @brief DHCPv6 server service.
 ///
 /// This class represents DHCPv6 server. It contains all
@@ -121,9 +130,72 @@ public:
     /// @param rsp A pointer to the response
     void processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp);
 
+    /// @brief Process a single incoming DHCPv6 packet and send the response.
+    ///
+    /// This method calls @ref processPacket and transmits the response, if
+    /// any. It is executed by the packet processing threads when
+    /// multi-threading is enabled, or directly by @ref run_one otherwise.
+    /// It doesn't throw.
+    ///
+    /// @param query A pointer to the packet to be processed.
+    /// @param batch Responses to the queries received together with this
+    /// one. The response is added to them and they are sent when the last
+    /// of these queries has been processed. If null, the response is sent
+    /// at once.
+    void processPacketAndSendResponse(Pkt6Ptr query,
+                                      ResponseBatch6Ptr batch =
+                                      ResponseBatch6Ptr());
+
     /// @brief Instructs the server to shut down.
     void shutdown();
 
+    /// @name Multi-threaded packet processing.
+    ///
+    //@{
+    /// @brief Sets the number of threads processing received packets.
+    ///
+    /// The value of 0 (default) disables multi-threading, i.e. the packets
+    /// are received and processed by the main thread. The new value is
+    /// used next time @ref startPacketThreads is called.
+    ///
+    /// @param thread_count Number of packet processing threads.
+    void setPacketThreadCount(const size_t thread_count) {
+        packet_thread_count_ = thread_count;
+    }
+
+    /// @brief Returns the configured number of packet processing threads.
+    size_t getPacketThreadCount() const {
+        return (packet_thread_count_);
+    }
+
+    /// @brief Starts the packet processing threads.
+    ///
+    /// The threads are started only if the number of threads is greater
+    /// than 0 and the current configuration allows multi-threading, i.e.
+    /// the lease database is memfile and no hosts database is configured.
+    /// Otherwise, a warning is logged and the packets are processed by
+    /// the main thread.
+    void startPacketThreads();
+
+    /// @brief Stops the packet processing threads.
+    ///
+    /// Waits until all queued packets have been processed and stops the
+    /// threads. This must be called before any change to the state used
+    /// during packet processing, e.g. before applying a new configuration
+    /// or reloading hooks libraries.
+    void stopPacketThreads();
+
+    /// @brief Checks if the packets are processed by multiple threads.
+    bool packetThreadsRunning() const {
+        return (packet_thread_pool_ && packet_thread_pool_->isRunning());
+    }
+
+    /// @brief Returns the latency of the packet processing stages.
+    ProcessingLatency& getLatency() {
+        return (latency_);
+    }
+    //@}
+
     /// @brief Get UDP port on which server should listen.
     ///
     /// Typically, server listens on UDP port 547. Other ports are only
@@ -630,6 +702,12 @@ protected:
     /// simulates transmission of a packet. For that purpose it is protected.
     virtual void sendPacket(const Pkt6Ptr& pkt);
 
+    /// @brief dummy wrapper around IfaceMgr::sendBatch()
+    ///
+    /// This method is useful for testing purposes, where its replacement
+    /// simulates transmission of packets. For that purpose it is protected.
+    virtual void sendPackets(const std::vector<Pkt6Ptr>& pkts);
+
     /// @brief Assigns incoming packet to zero or more classes.
     ///
     /// @note This is done in two phases: first the content of the
@@ -842,6 +920,46 @@ private:
     /// UDP port number on which server listens.
     uint16_t port_;
 
+    /// @brief Number of packet processing threads.
+    size_t packet_thread_count_;
+
+    /// @brief Pool of packet processing threads.
+    isc::util::thread::ThreadPoolPtr packet_thread_pool_;
+
+    /// @brief Latency of the packet processing stages.
+    ProcessingLatency latency_;
+
+    /// @brief Work item executed by the packet processing threads.
+    ///
+    /// Calls @ref processPacketAndSendResponse and releases the callout
+    /// handle associated with the packet.
+    ///
+    /// @param query A pointer to the packet to be processed.
+    /// @param batch Responses to the queries received together with this
+    /// one.
+    void processPacketInThread(Pkt6Ptr query, ResponseBatch6Ptr batch);
+
+    /// @brief Runs the buffer6_send callouts and logs the response.
+    ///
+    /// It doesn't throw.
+    ///
+    /// @param query A pointer to the packet processed.
+    /// @param [in,out] rsp A pointer to the response, reset if the
+    /// response must not be sent.
+    void prepareResponse(const Pkt6Ptr& query, Pkt6Ptr& rsp);
+
+    /// @brief Sends the responses and updates the statistics.
+    ///
+    /// It doesn't throw.
+    ///
+    /// @param responses Responses to be sent.
+    void sendResponses(const std::vector<Pkt6Ptr>& responses);
+
+    /// @brief Responses to the queries of the current reception cycle.
+    ///
+    /// It is used by the thread receiving the packets only.
+    ResponseBatch6Ptr response_batch_;
+
 public:
     /// @note used by DHCPv4-over-DHCPv6 so must be public and static
 
@@ -55,6 +55,8 @@ usage() {
     cerr << "  -t file: check the configuration file syntax and exit" << endl;
     cerr << "  -p number: specify non-standard port number 1-65535 "
          << "(useful for testing only)" << endl;
+    cerr << "  -N number: specify the number of packet processing threads"
+         << " 0-256 (0 disables multi-threading)" << endl;
     exit(EXIT_FAILURE);
 }
 } // end of anonymous namespace
@@ -66,11 +68,12 @@ main(int argc, char* argv[]) {
                                          // useful for testing only.
     bool verbose_mode = false; // Should server be verbose?
     bool check_mode = false;   // Check syntax
+    int thread_count = 0;      // Packet processing threads
 
     // The standard config file
     std::string config_file("");
 
-    while ((ch = getopt(argc, argv, "dvVWc:p:t:")) != -1) {
+    while ((ch = getopt(argc, argv, "dvVWc:p:t:N:")) != -1) {
         switch (ch) {
         case 'd':
             verbose_mode = true;
@@ -111,6 +114,21 @@ main(int argc, char* argv[]) {
             }
             break;
 
+        case 'N':
+            try {
+                thread_count = boost::lexical_cast<int>(optarg);
+            } catch (const boost::bad_lexical_cast &) {
+                cerr << "Failed to parse number of threads: [" << optarg
+                     << "], 0-256 allowed." << endl;
+                usage();
+            }
+            if (thread_count < 0 || thread_count > 256) {
+                cerr << "Failed to parse number of threads: [" << optarg
+                     << "], 0-256 allowed." << endl;
+                usage();
+            }
+            break;
+
         default:
             usage();
         }
@@ -201,6 +219,9 @@ main(int argc, char* argv[]) {
         // Remember verbose-mode
         server.setVerbose(verbose_mode);
 
+        // The threads are started when the configuration is applied.
+        server.setPacketThreadCount(thread_count);
+
         // Create our PID file
         server.setProcName(DHCP6_NAME);
         server.setConfigFile(config_file);
@@ -171,6 +171,17 @@ public:
         fake_sent_.push_back(pkt);
     }
 
+    /// @brief fake sending of many packets
+    ///
+    /// Pretend to send packets, but instead just store them in fake_send_
+    /// list using @c sendPacket.
+    virtual void sendPackets(const std::vector<isc::dhcp::Pkt6Ptr>& pkts) {
+        for (std::vector<isc::dhcp::Pkt6Ptr>::const_iterator pkt = pkts.begin();
+             pkt != pkts.end(); ++pkt) {
+            sendPacket(*pkt);
+        }
+    }
+
     /// @brief adds a packet to fake receive queue
     ///
     /// See fake_received_ field for description
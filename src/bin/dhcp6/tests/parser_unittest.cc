@@ -130,6 +130,71 @@ TEST(ParserTest, keywordDhcp6) {
      testParser(txt, Parser6Context::PARSER_DHCP6);
 }
 
+// Checks that the group commit lease database parameters are accepted.
+TEST(ParserTest, leaseDatabaseGroupCommit) {
+    string txt = "{ \"Dhcp6\": { \"lease-database\": {"
+                 " \"type\": \"memfile\","
+                 " \"group-commit\": true,"
+                 " \"group-commit-sync\": false,"
+                 " \"group-commit-max-batch\": 64,"
+                 " \"group-commit-max-latency\": 10 } } }";
+    testParser(txt, Parser6Context::PARSER_DHCP6);
+}
+
+// Checks that the load-threads lease database parameter is accepted.
+TEST(ParserTest, leaseDatabaseLoadThreads) {
+    string txt = "{ \"Dhcp6\": { \"lease-database\": {"
+                 " \"type\": \"memfile\","
+                 " \"load-threads\": 4 } } }";
+    testParser(txt, Parser6Context::PARSER_DHCP6);
+}
+
+// Checks that the in-process lease file cleanup parameters are accepted.
+TEST(ParserTest, leaseDatabaseLfcInProcess) {
+    string txt = "{ \"Dhcp6\": { \"lease-database\": {"
+                 " \"type\": \"memfile\","
+                 " \"lfc-in-process\": true,"
+                 " \"lfc-batch-size\": 1000,"
+                 " \"lfc-batch-interval\": 5 } } }";
+    testParser(txt, Parser6Context::PARSER_DHCP6);
+}
+
+// Checks that the lfc-snapshot-format lease database parameter is accepted.
+TEST(ParserTest, leaseDatabaseLfcSnapshotFormat) {
+    string txt = "{ \"Dhcp6\": { \"lease-database\": {"
+                 " \"type\": \"memfile\","
+                 " \"lfc-snapshot-format\": \"binary\" } } }";
+    testParser(txt, Parser6Context::PARSER_DHCP6);
+}
+
+// Checks that the host cache parameters are accepted.
+TEST(ParserTest, hostsDatabaseCache) {
+    string txt = "{ \"Dhcp6\": { \"hosts-database\": {"
+                 " \"type\": \"mysql\","
+                 " \"cache-size\": 1024,"
+                 " \"cache-ttl\": 60,"
+                 " \"cache-negative-ttl\": 5 } } }";
+    testParser(txt, Parser6Context::PARSER_DHCP6);
+}
+
+// Checks that the connection pool lease database parameters are accepted.
+TEST(ParserTest, leaseDatabaseConnectionPool) {
+    string txt = "{ \"Dhcp6\": { \"lease-database\": {"
+                 " \"type\": \"memfile\","
+                 " \"connection-pool-size\": 8,"
+                 " \"reconnect-wait-time\": 1000 } } }";
+    testParser(txt, Parser6Context::PARSER_DHCP6);
+}
+
+// Checks that the connection pool hosts database parameters are accepted.
+TEST(ParserTest, hostsDatabaseConnectionPool) {
+    string txt = "{ \"Dhcp6\": { \"hosts-database\": {"
+                 " \"type\": \"mysql\","
+                 " \"connection-pool-size\": 8,"
+                 " \"reconnect-wait-time\": 1000 } } }";
+    testParser(txt, Parser6Context::PARSER_DHCP6);
+}
+
 // Tests if bash (#) comments are supported. That's the only comment type that
 // was supported by the old parser.
 TEST(ParserTest, bashComments) {
@@ -511,6 +576,13 @@ TEST(ParserTest, errors) {
               "<string>:2.2-21: got unexpected keyword "
               "\"preferred_lifetime\" in Dhcp6 map.");
 
+    // the DHCPv6 leases are never packed
+    testError("{ \"Dhcp6\":{\n"
+              " \"lease-database\":{ \"packed\":true }}}\n",
+              Parser6Context::PARSER_DHCP6,
+              "<string>:2.21-28: got unexpected keyword "
+              "\"packed\" in lease-database map.");
+
     // missing parameter
     testError("{ \"name\": \"foo\",\n"
               "  \"code\": 123 }\n",
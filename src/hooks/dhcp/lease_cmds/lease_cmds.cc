@@ -24,6 +24,8 @@
 #include <util/strutil.h>
 
 #include <boost/bind.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <sstream>
 #include <string>
 
 using namespace isc::dhcp;
@@ -33,6 +35,14 @@ using namespace isc::asiolink;
 using namespace isc::hooks;
 using namespace std;
 
+namespace {
+
+/// @brief Number of leases fetched at once by the lease4-get-all and
+/// lease6-get-all commands returning all leases.
+const size_t GET_ALL_PAGE_SIZE = 1000;
+
+}
+
 namespace isc {
 namespace lease_cmds {
 
@@ -129,6 +139,26 @@ public:
     int
     leaseGetHandler(CalloutHandle& handle);
 
+    /// @brief lease4-get-all, lease6-get-all commands handler
+    ///
+    /// Provides the implementation for @ref isc::lease_cmds::LeaseCmds::leaseGetAllHandler
+    ///
+    /// @param handle Callout context - which is expected to contain the
+    /// get command JSON text in the "command" argument
+    /// @return 0 upon success, non-zero otherwise
+    int
+    leaseGetAllHandler(CalloutHandle& handle);
+
+    /// @brief lease4-get-page, lease6-get-page commands handler
+    ///
+    /// Provides the implementation for @ref isc::lease_cmds::LeaseCmds::leaseGetPageHandler
+    ///
+    /// @param handle Callout context - which is expected to contain the
+    /// get command JSON text in the "command" argument
+    /// @return 0 upon success, non-zero otherwise
+    int
+    leaseGetPageHandler(CalloutHandle& handle);
+
     /// @brief lease4-del command handler
     ///
     /// Provides the implementation for @ref isc::lease_cmds::LeaseCmds::lease4DelHandler
@@ -189,6 +219,16 @@ public:
     int
     lease6WipeHandler(CalloutHandle& handle);
 
+    /// @brief lease4-bulk-apply, lease6-bulk-apply commands handler
+    ///
+    /// Provides the implementation for @ref isc::lease_cmds::LeaseCmds::leaseBulkApplyHandler
+    ///
+    /// @param handle Callout context - which is expected to contain the
+    /// bulk apply command JSON text in the "command" argument
+    /// @return 0 upon success, non-zero otherwise
+    int
+    leaseBulkApplyHandler(CalloutHandle& handle);
+
     /// @brief Extracts parameters required for reservation-get and reservation-del
     ///
     /// See @ref Parameters class for detailed description of what is expected
@@ -199,6 +239,47 @@ public:
     /// @return parsed parameters
     /// @throw BadValue if input arguments don't make sense.
     Parameters getParameters(bool v6, const ConstElementPtr& args);
+
+    /// @brief Appends leases to the list of leases returned to the client.
+    ///
+    /// @tparam LeaseCollection Type of the lease collection, i.e.
+    /// @c Lease4Collection or @c Lease6Collection.
+    /// @param leases Leases to be converted to JSON.
+    /// @param [out] leases_json List to which the leases are appended.
+    template<typename LeaseCollection>
+    static void addLeasesToList(const LeaseCollection& leases,
+                                const ElementPtr& leases_json) {
+        for (typename LeaseCollection::const_iterator lease = leases.begin();
+             lease != leases.end(); ++lease) {
+            leases_json->add((*lease)->toElement());
+        }
+    }
+
+    /// @brief Creates a response to the lease queries returning multiple
+    /// leases.
+    ///
+    /// The response is empty when no leases have been found.
+    ///
+    /// @param v4 Boolean value indicating if the IPv4 leases are returned.
+    /// @param leases_json List of leases to be returned.
+    /// @param with_count Boolean value indicating if the number of
+    /// returned leases should be included in the arguments.
+    /// @return Response to the command.
+    static ConstElementPtr
+    createLeasesAnswer(const bool v4, const ElementPtr& leases_json,
+                       const bool with_count) {
+        std::ostringstream s;
+        s << leases_json->size() << " IPv" << (v4 ? "4" : "6")
+          << " lease(s) found.";
+
+        ElementPtr args = Element::createMap();
+        args->set("leases", leases_json);
+        if (with_count) {
+            args->set("count", Element::create(static_cast<int64_t>(leases_json->size())));
+        }
+        return (createAnswer(leases_json->size() > 0 ? CONTROL_RESULT_SUCCESS :
+                             CONTROL_RESULT_EMPTY, s.str(), args));
+    }
 };
 
 int
@@ -455,6 +536,172 @@ LeaseCmdsImpl::leaseGetHandler(CalloutHandle& handle) {
     return (0);
 }
 
+int
+LeaseCmdsImpl::leaseGetAllHandler(CalloutHandle& handle) {
+    bool v4 = true;
+    try {
+        extractCommand(handle);
+        v4 = (cmd_name_ == "lease4-get-all");
+
+        ElementPtr leases_json = Element::createList();
+
+        // The arguments are optional. If they are specified they must
+        // contain the list of subnets for which the leases are returned.
+        if (cmd_args_) {
+            if (cmd_args_->getType() != Element::map) {
+                isc_throw(BadValue, "Parameters are not a map.");
+            }
+
+            ConstElementPtr subnets = cmd_args_->get("subnets");
+            if (!subnets) {
+                isc_throw(BadValue, "'subnets' parameter not specified");
+            }
+
+            if (subnets->getType() != Element::list) {
+                isc_throw(BadValue, "'subnets' parameter must be a list");
+            }
+
+            const std::vector<ElementPtr>& subnet_ids = subnets->listValue();
+            for (std::vector<ElementPtr>::const_iterator subnet_id = subnet_ids.begin();
+                 subnet_id != subnet_ids.end(); ++subnet_id) {
+                if ((*subnet_id)->getType() != Element::integer) {
+                    isc_throw(BadValue, "listed subnet identifiers must be numbers");
+                }
+
+                if (v4) {
+                    Lease4Collection leases =
+                        LeaseMgrFactory::instance().getLeases4((*subnet_id)->intValue());
+                    addLeasesToList(leases, leases_json);
+                } else {
+                    Lease6Collection leases =
+                        LeaseMgrFactory::instance().getLeases6((*subnet_id)->intValue());
+                    addLeasesToList(leases, leases_json);
+                }
+            }
+
+        } else {
+            // There is no 'subnets' argument so let's return all leases.
+            // They are fetched in pages, each converted to the response
+            // before the next one is fetched, so as the copies of all
+            // leases are not held in memory along with the response.
+            if (v4) {
+                IOAddress lower_bound = IOAddress::IPV4_ZERO_ADDRESS();
+                for (;;) {
+                    Lease4Collection leases = LeaseMgrFactory::instance().
+                        getLeases4(lower_bound, LeasePageSize(GET_ALL_PAGE_SIZE));
+                    addLeasesToList(leases, leases_json);
+                    if (leases.size() < GET_ALL_PAGE_SIZE) {
+                        break;
+                    }
+                    lower_bound = leases.back()->addr_;
+                }
+
+            } else {
+                IOAddress lower_bound = IOAddress::IPV6_ZERO_ADDRESS();
+                for (;;) {
+                    Lease6Collection leases = LeaseMgrFactory::instance().
+                        getLeases6(lower_bound, LeasePageSize(GET_ALL_PAGE_SIZE));
+                    addLeasesToList(leases, leases_json);
+                    if (leases.size() < GET_ALL_PAGE_SIZE) {
+                        break;
+                    }
+                    lower_bound = leases.back()->addr_;
+                }
+            }
+        }
+
+        ConstElementPtr response = createLeasesAnswer(v4, leases_json, false);
+        setResponse(handle, response);
+
+    } catch (const std::exception& ex) {
+        setErrorResponse(handle, ex.what());
+        return (1);
+    }
+
+    return (0);
+}
+
+int
+LeaseCmdsImpl::leaseGetPageHandler(CalloutHandle& handle) {
+    bool v4 = true;
+    try {
+        extractCommand(handle);
+        v4 = (cmd_name_ == "lease4-get-page");
+
+        // arguments must always be present
+        if (!cmd_args_ || (cmd_args_->getType() != Element::map)) {
+            isc_throw(BadValue, "no parameters specified for the "
+                      << cmd_name_ << " command");
+        }
+
+        // The 'from' argument denotes from which lease we should start the
+        // results page. The results page excludes this lease.
+        ConstElementPtr from = cmd_args_->get("from");
+        if (!from) {
+            isc_throw(BadValue, "'from' parameter not specified");
+        }
+
+        // The 'from' argument is a string. It may contain a 'start' keyword or
+        // an IP address.
+        if (from->getType() != Element::string) {
+            isc_throw(BadValue, "'from' parameter must be a string");
+        }
+
+        boost::scoped_ptr<IOAddress> from_address;
+        try {
+            if (from->stringValue() == "start") {
+                from_address.reset(new IOAddress(v4 ? "0.0.0.0" : "::"));
+
+            } else {
+                // Not a 'start' keyword, so it must be an IP address.
+                from_address.reset(new IOAddress(from->stringValue()));
+            }
+
+        } catch (...) {
+            isc_throw(BadValue, "'from' parameter value is neither 'start' keyword nor "
+                      "a valid IPv" << (v4 ? "4" : "6") << " address");
+        }
+
+        // It must be either IPv4 address for lease4-get-page or IPv6 address for
+        // lease6-get-page.
+        if (v4 && (!from_address->isV4())) {
+            isc_throw(BadValue, "'from' parameter value " << from_address->toText()
+                      << " is not an IPv4 address");
+
+        } else if (!v4 && from_address->isV4()) {
+            isc_throw(BadValue, "'from' parameter value " << from_address->toText()
+                      << " is not an IPv6 address");
+        }
+
+        // The 'limit' is mandatory. It bounds the number of leases returned
+        // in a single response.
+        SimpleParser parser;
+        LeasePageSize page_size(parser.getUint32(cmd_args_, "limit"));
+
+        ElementPtr leases_json = Element::createList();
+
+        if (v4) {
+            Lease4Collection leases =
+                LeaseMgrFactory::instance().getLeases4(*from_address, page_size);
+            addLeasesToList(leases, leases_json);
+
+        } else {
+            Lease6Collection leases =
+                LeaseMgrFactory::instance().getLeases6(*from_address, page_size);
+            addLeasesToList(leases, leases_json);
+        }
+
+        ConstElementPtr response = createLeasesAnswer(v4, leases_json, true);
+        setResponse(handle, response);
+
+    } catch (const std::exception& ex) {
+        setErrorResponse(handle, ex.what());
+        return (1);
+    }
+
+    return (0);
+}
+
 int
 LeaseCmdsImpl::lease4DelHandler(CalloutHandle& handle) {
     Parameters p;
@@ -697,6 +944,73 @@ LeaseCmdsImpl::lease6WipeHandler(CalloutHandle& handle) {
     return (0);
 }
 
+int
+LeaseCmdsImpl::leaseBulkApplyHandler(CalloutHandle& handle) {
+    // Arbitrary defaulting to DHCPv4 or with other words extractCommand
+    // below is not expected to throw...
+    bool v4 = true;
+    size_t num = 0;
+    try {
+        extractCommand(handle);
+        v4 = (cmd_name_ == "lease4-bulk-apply");
+
+        // arguments must always be present
+        if (!cmd_args_ || (cmd_args_->getType() != Element::map)) {
+            isc_throw(BadValue, "no parameters specified for the "
+                      << cmd_name_ << " command");
+        }
+
+        ConstElementPtr leases = cmd_args_->get("leases");
+        if (!leases) {
+            isc_throw(BadValue, "'leases' parameter not specified");
+        }
+
+        if (leases->getType() != Element::list) {
+            isc_throw(BadValue, "'leases' parameter must be a list");
+        }
+
+        // All leases are parsed before any of them is applied so as
+        // the invalid entry rejects the whole batch.
+        ConstSrvConfigPtr config = CfgMgr::instance().getCurrentCfg();
+        const std::vector<ElementPtr>& leases_list = leases->listValue();
+        if (v4) {
+            Lease4Collection leases4;
+            Lease4Parser parser;
+            for (std::vector<ElementPtr>::const_iterator lease = leases_list.begin();
+                 lease != leases_list.end(); ++lease) {
+                leases4.push_back(parser.parse(config, *lease));
+            }
+            LeaseMgrFactory::instance().applyLeases4(leases4);
+            num = leases4.size();
+
+        } else {
+            Lease6Collection leases6;
+            Lease6Parser parser;
+            for (std::vector<ElementPtr>::const_iterator lease = leases_list.begin();
+                 lease != leases_list.end(); ++lease) {
+                leases6.push_back(parser.parse(config, *lease));
+            }
+            LeaseMgrFactory::instance().applyLeases6(leases6);
+            num = leases6.size();
+        }
+
+    } catch (const std::exception& ex) {
+        LOG_ERROR(lease_cmds_logger, v4 ? LEASE_CMDS_BULK_APPLY4_FAILED :
+                  LEASE_CMDS_BULK_APPLY6_FAILED)
+            .arg(ex.what());
+        setErrorResponse(handle, ex.what());
+        return (1);
+    }
+
+    LOG_INFO(lease_cmds_logger, v4 ? LEASE_CMDS_BULK_APPLY4 :
+             LEASE_CMDS_BULK_APPLY6).arg(num);
+
+    stringstream tmp;
+    tmp << "Applied " << num << " IPv" << (v4 ? "4" : "6") << " lease(s).";
+    setSuccessResponse(handle, tmp.str());
+    return (0);
+}
+
 int
 LeaseCmds::leaseAddHandler(CalloutHandle& handle) {
     return(impl_->leaseAddHandler(handle));
@@ -707,6 +1021,16 @@ LeaseCmds::leaseGetHandler(CalloutHandle& handle) {
     return(impl_->leaseGetHandler(handle));
 }
 
+int
+LeaseCmds::leaseGetAllHandler(CalloutHandle& handle) {
+    return(impl_->leaseGetAllHandler(handle));
+}
+
+int
+LeaseCmds::leaseGetPageHandler(CalloutHandle& handle) {
+    return(impl_->leaseGetPageHandler(handle));
+}
+
 int
 LeaseCmds::lease4DelHandler(CalloutHandle& handle) {
     return(impl_->lease4DelHandler(handle));
@@ -737,6 +1061,11 @@ LeaseCmds::lease6WipeHandler(CalloutHandle& handle) {
    return(impl_->lease6WipeHandler(handle));
 }
 
+int
+LeaseCmds::leaseBulkApplyHandler(CalloutHandle& handle) {
+   return(impl_->leaseBulkApplyHandler(handle));
+}
+
 LeaseCmds::LeaseCmds()
     :impl_(new LeaseCmdsImpl()) {
 }
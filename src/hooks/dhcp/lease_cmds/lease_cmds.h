@@ -131,6 +131,58 @@ public:
     int
     leaseGetHandler(hooks::CalloutHandle& handle);
 
+    /// @brief lease4-get-all, lease6-get-all commands handler
+    ///
+    /// These commands attempt to retrieve all IPv4 or IPv6 leases,
+    /// or all IPv4 or all IPv6 leases belonging to the particular
+    /// subnets. If no subnet identifiers are provided, it returns all
+    /// IPv4 or IPv6 leases from the database.
+    ///
+    /// Example command for retrieving the leases of two subnets:
+    /// {
+    ///     "command": "lease4-get-all",
+    ///     "arguments": {
+    ///         "subnets": [ 1, 2 ]
+    ///     }
+    /// }
+    ///
+    /// The whole result is returned in a single response, so the
+    /// lease4-get-page and lease6-get-page commands should be preferred
+    /// for large lease databases.
+    ///
+    /// @param handle Callout context - which is expected to contain the
+    /// get command JSON text in the "command" argument
+    /// @return result of the operation (includes lease details, if found)
+    int
+    leaseGetAllHandler(hooks::CalloutHandle& handle);
+
+    /// @brief lease4-get-page, lease6-get-page commands handler
+    ///
+    /// These commands attempt to retrieve 1 page of leases. The size of
+    /// the page is specified by the caller with the "limit" argument.
+    /// The first page is fetched by specifying "start" as the value of
+    /// the "from" argument. The subsequent pages are fetched by
+    /// specifying the last address returned in the previous page,
+    /// which makes the address a cursor into the lease database.
+    ///
+    /// Example command fetching the first page of up to 1000 leases:
+    /// {
+    ///     "command": "lease4-get-page",
+    ///     "arguments": {
+    ///         "from": "start",
+    ///         "limit": 1000
+    ///     }
+    /// }
+    ///
+    /// The returned page includes the "count" of leases in the page.
+    /// The page holding fewer leases than the "limit" is the last page.
+    ///
+    /// @param handle Callout context - which is expected to contain the
+    /// get command JSON text in the "command" argument
+    /// @return result of the operation (includes lease details, if found)
+    int
+    leaseGetPageHandler(hooks::CalloutHandle& handle);
+
     /// @brief lease4-del command handler
     ///
     /// This command attempts to delete an IPv4 lease that match selected
@@ -309,6 +361,41 @@ public:
     int
     lease6WipeHandler(hooks::CalloutHandle& handle);
 
+    /// @brief lease4-bulk-apply, lease6-bulk-apply commands handler
+    ///
+    /// These commands add or update a batch of leases with a single
+    /// call to the lease manager, which applies them in a single
+    /// transaction when the lease database backend supports it. The
+    /// leases are specified in the same format as for the lease4-add
+    /// and lease6-add commands. The leases which don't exist in the
+    /// database are added, the remaining ones are updated. The whole
+    /// batch is rejected when any of the leases is invalid.
+    ///
+    /// Example command:
+    /// {
+    ///     "command": "lease4-bulk-apply",
+    ///     "arguments": {
+    ///         "leases": [
+    ///             {
+    ///                 "subnet-id": 1,
+    ///                 "ip-address": "192.0.2.202",
+    ///                 "hw-address": "1a:1b:1c:1d:1e:1f"
+    ///             },
+    ///             {
+    ///                 "subnet-id": 1,
+    ///                 "ip-address": "192.0.2.203",
+    ///                 "hw-address": "2a:2b:2c:2d:2e:2f"
+    ///             }
+    ///         ]
+    ///     }
+    /// }
+    ///
+    /// @param handle Callout context - which is expected to contain the
+    /// bulk apply command JSON text in the "command" argument
+    /// @return result of the operation
+    int
+    leaseBulkApplyHandler(hooks::CalloutHandle& handle);
+
 private:
     /// Pointer to the actual implementation
     boost::shared_ptr<LeaseCmdsImpl> impl_;
@@ -64,6 +64,50 @@ int lease6_get(CalloutHandle& handle) {
     return(lease_cmds.leaseGetHandler(handle));
 }
 
+/// @brief This is a command callout for 'lease4-get-all' command.
+///
+/// @param handle Callout handle used to retrieve a command and
+/// provide a response.
+/// @return 0 if this callout has been invoked successfully,
+/// 1 otherwise.
+int lease4_get_all(CalloutHandle& handle) {
+    LeaseCmds lease_cmds;
+    return(lease_cmds.leaseGetAllHandler(handle));
+}
+
+/// @brief This is a command callout for 'lease6-get-all' command.
+///
+/// @param handle Callout handle used to retrieve a command and
+/// provide a response.
+/// @return 0 if this callout has been invoked successfully,
+/// 1 otherwise.
+int lease6_get_all(CalloutHandle& handle) {
+    LeaseCmds lease_cmds;
+    return(lease_cmds.leaseGetAllHandler(handle));
+}
+
+/// @brief This is a command callout for 'lease4-get-page' command.
+///
+/// @param handle Callout handle used to retrieve a command and
+/// provide a response.
+/// @return 0 if this callout has been invoked successfully,
+/// 1 otherwise.
+int lease4_get_page(CalloutHandle& handle) {
+    LeaseCmds lease_cmds;
+    return(lease_cmds.leaseGetPageHandler(handle));
+}
+
+/// @brief This is a command callout for 'lease6-get-page' command.
+///
+/// @param handle Callout handle used to retrieve a command and
+/// provide a response.
+/// @return 0 if this callout has been invoked successfully,
+/// 1 otherwise.
+int lease6_get_page(CalloutHandle& handle) {
+    LeaseCmds lease_cmds;
+    return(lease_cmds.leaseGetPageHandler(handle));
+}
+
 /// @brief This is a command callout for 'lease4-del' command.
 ///
 /// @param handle Callout handle used to retrieve a command and
@@ -130,6 +174,28 @@ int lease6_wipe(CalloutHandle& handle) {
     return(lease_cmds.lease6WipeHandler(handle));
 }
 
+/// @brief This is a command callout for 'lease4-bulk-apply' command.
+///
+/// @param handle Callout handle used to retrieve a command and
+/// provide a response.
+/// @return 0 if this callout has been invoked successfully,
+/// 1 otherwise.
+int lease4_bulk_apply(CalloutHandle& handle) {
+    LeaseCmds lease_cmds;
+    return(lease_cmds.leaseBulkApplyHandler(handle));
+}
+
+/// @brief This is a command callout for 'lease6-bulk-apply' command.
+///
+/// @param handle Callout handle used to retrieve a command and
+/// provide a response.
+/// @return 0 if this callout has been invoked successfully,
+/// 1 otherwise.
+int lease6_bulk_apply(CalloutHandle& handle) {
+    LeaseCmds lease_cmds;
+    return(lease_cmds.leaseBulkApplyHandler(handle));
+}
+
 /// @brief This function is called when the library is loaded.
 ///
 /// @param handle library handle
@@ -139,12 +205,18 @@ int load(LibraryHandle& handle) {
     handle.registerCommandCallout("lease6-add", lease6_add);
     handle.registerCommandCallout("lease4-get", lease4_get);
     handle.registerCommandCallout("lease6-get", lease6_get);
+    handle.registerCommandCallout("lease4-get-all", lease4_get_all);
+    handle.registerCommandCallout("lease6-get-all", lease6_get_all);
+    handle.registerCommandCallout("lease4-get-page", lease4_get_page);
+    handle.registerCommandCallout("lease6-get-page", lease6_get_page);
     handle.registerCommandCallout("lease4-del", lease4_del);
     handle.registerCommandCallout("lease6-del", lease6_del);
     handle.registerCommandCallout("lease4-update", lease4_update);
     handle.registerCommandCallout("lease6-update", lease6_update);
     handle.registerCommandCallout("lease4-wipe", lease4_wipe);
     handle.registerCommandCallout("lease6-wipe", lease6_wipe);
+    handle.registerCommandCallout("lease4-bulk-apply", lease4_bulk_apply);
+    handle.registerCommandCallout("lease6-bulk-apply", lease6_bulk_apply);
 
     LOG_INFO(lease_cmds_logger, LEASE_CMDS_INIT_OK);
     return (0);
@@ -16,6 +16,9 @@
 #include <cc/data.h>
 #include <errno.h>
 
+#include <set>
+#include <sstream>
+
 using namespace std;
 using namespace isc;
 using namespace isc::hooks;
@@ -419,16 +422,86 @@ public:
         // Check that there are no v4 specific fields.
         EXPECT_FALSE(l->contains("client-id"));
     }
+
+    /// @brief Adds IPv4 leases for consecutive addresses.
+    ///
+    /// The leases are created with @ref createLease4 and only differ
+    /// by the address, which starts at 192.0.2.1.
+    ///
+    /// @param count Number of leases to be added.
+    void addLeases4(const size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            Lease4Ptr lease = createLease4();
+            lease->addr_ = IOAddress(lease->addr_.toUint32() + i);
+            ASSERT_TRUE(lmptr_->addLease(lease));
+        }
+    }
+
+    /// @brief Adds IPv6 leases for consecutive addresses.
+    ///
+    /// The leases are created with @ref createLease6 and only differ
+    /// by the address and IAID, which start at 2001:db8::1 and 42.
+    ///
+    /// @param count Number of leases to be added.
+    void addLeases6(const size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            Lease6Ptr lease = createLease6();
+            std::ostringstream s;
+            s << "2001:db8::" << std::hex << (i + 1);
+            lease->addr_ = IOAddress(s.str());
+            lease->iaid_ += i;
+            ASSERT_TRUE(lmptr_->addLease(lease));
+        }
+    }
+
+    /// @brief Returns the list of leases carried in the response.
+    ///
+    /// @param rsp Response to the leaseX-get-all or leaseX-get-page command.
+    /// @return Pointer to the list of leases or null pointer if the
+    /// response doesn't include it.
+    ConstElementPtr getLeasesList(const ConstElementPtr& rsp) {
+        if (!rsp || !rsp->get("arguments")) {
+            return (ConstElementPtr());
+        }
+        ConstElementPtr leases = rsp->get("arguments")->get("leases");
+        if (!leases || (leases->getType() != Element::list)) {
+            return (ConstElementPtr());
+        }
+        return (leases);
+    }
+
+    /// @brief Sends leaseX-get-page command.
+    ///
+    /// @param v6 true = lease6-get-page, false = lease4-get-page
+    /// @param from value of the "from" parameter
+    /// @param limit value of the "limit" parameter
+    /// @param exp_result expected status code of the response
+    /// @return full response returned by the command execution.
+    ConstElementPtr getPage(bool v6, const std::string& from,
+                            const size_t limit, int exp_result) {
+        std::ostringstream cmd;
+        cmd << "{\n"
+            << "    \"command\": \"lease" << (v6 ? "6" : "4") << "-get-page\",\n"
+            << "    \"arguments\": {"
+            << "        \"from\": \"" << from << "\","
+            << "        \"limit\": " << limit
+            << "    }\n"
+            << "}";
+        return (testCommand(cmd.str(), exp_result, ""));
+    }
 };
 
 // Simple test that checks the library really registers the commands.
 TEST_F(LeaseCmdsTest, commands) {
 
-    vector<string> cmds = { "lease4-add",    "lease6-add",
-                            "lease4-get",    "lease6-get",
-                            "lease4-del",    "lease6-del",
-                            "lease4-update", "lease6-update",
-                            "lease4-wipe",   "lease6-wipe" };
+    vector<string> cmds = { "lease4-add",        "lease6-add",
+                            "lease4-get",        "lease6-get",
+                            "lease4-get-all",    "lease6-get-all",
+                            "lease4-get-page",   "lease6-get-page",
+                            "lease4-del",        "lease6-del",
+                            "lease4-update",     "lease6-update",
+                            "lease4-wipe",       "lease6-wipe",
+                            "lease4-bulk-apply", "lease6-bulk-apply" };
     testCommands(cmds);
 }
 
@@ -2067,6 +2140,421 @@ TEST_F(LeaseCmdsTest, Lease6DelByDUID) {
     EXPECT_FALSE(lmptr_->getLease6(Lease::TYPE_NA, IOAddress("2001:db8::1")));
 }
 
+// Checks that lease4-get-all returns all leases.
+TEST_F(LeaseCmdsTest, Lease4GetAll) {
+
+    // Initialize lease manager (false = v4, false = no leases)
+    initLeaseMgr(false, false);
+    addLeases4(3);
+
+    string cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-all\"\n"
+        "}";
+    string exp_rsp = "3 IPv4 lease(s) found.";
+    ConstElementPtr rsp = testCommand(cmd, CONTROL_RESULT_SUCCESS, exp_rsp);
+
+    ConstElementPtr leases = getLeasesList(rsp);
+    ASSERT_TRUE(leases);
+    ASSERT_EQ(3, leases->size());
+
+    // The leases are returned in the same format as for lease4-get.
+    std::set<std::string> addresses;
+    for (size_t i = 0; i < leases->size(); ++i) {
+        ConstElementPtr l = leases->get(i);
+        ASSERT_TRUE(l->get("ip-address"));
+        std::string ip = l->get("ip-address")->stringValue();
+        checkLease4(l, ip, 44, "08:08:08:08:08:08", true);
+        addresses.insert(ip);
+    }
+    EXPECT_EQ(3, addresses.size());
+}
+
+// Checks that lease4-get-all returns all leases when they are fetched
+// from the lease manager in several pages.
+TEST_F(LeaseCmdsTest, Lease4GetAllMultiplePages) {
+
+    // Initialize lease manager (false = v4, false = no leases)
+    initLeaseMgr(false, false);
+    addLeases4(2500);
+
+    string cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-all\"\n"
+        "}";
+    string exp_rsp = "2500 IPv4 lease(s) found.";
+    ConstElementPtr rsp = testCommand(cmd, CONTROL_RESULT_SUCCESS, exp_rsp);
+
+    ConstElementPtr leases = getLeasesList(rsp);
+    ASSERT_TRUE(leases);
+    ASSERT_EQ(2500, leases->size());
+
+    // Each lease is returned once.
+    std::set<std::string> addresses;
+    for (size_t i = 0; i < leases->size(); ++i) {
+        addresses.insert(leases->get(i)->get("ip-address")->stringValue());
+    }
+    EXPECT_EQ(2500, addresses.size());
+}
+
+// Checks that lease4-get-all returns the leases of the specified subnets.
+TEST_F(LeaseCmdsTest, Lease4GetAllBySubnetId) {
+
+    // Initialize lease manager (false = v4, false = no leases)
+    initLeaseMgr(false, false);
+    addLeases4(2);
+
+    string cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-all\",\n"
+        "    \"arguments\": {"
+        "        \"subnets\": [ 44 ]"
+        "    }\n"
+        "}";
+    string exp_rsp = "2 IPv4 lease(s) found.";
+    ConstElementPtr rsp = testCommand(cmd, CONTROL_RESULT_SUCCESS, exp_rsp);
+    ConstElementPtr leases = getLeasesList(rsp);
+    ASSERT_TRUE(leases);
+    EXPECT_EQ(2, leases->size());
+
+    // There are no leases in other subnets.
+    cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-all\",\n"
+        "    \"arguments\": {"
+        "        \"subnets\": [ 1, 2 ]"
+        "    }\n"
+        "}";
+    exp_rsp = "0 IPv4 lease(s) found.";
+    testCommand(cmd, CONTROL_RESULT_EMPTY, exp_rsp);
+}
+
+// Checks that lease4-get-all verifies its arguments.
+TEST_F(LeaseCmdsTest, Lease4GetAllBadParams) {
+
+    // Initialize lease manager (false = v4, true = add a lease)
+    initLeaseMgr(false, true);
+
+    string cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-all\",\n"
+        "    \"arguments\": {"
+        "    }\n"
+        "}";
+    string exp_rsp = "'subnets' parameter not specified";
+    testCommand(cmd, CONTROL_RESULT_ERROR, exp_rsp);
+
+    cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-all\",\n"
+        "    \"arguments\": {"
+        "        \"subnets\": 44"
+        "    }\n"
+        "}";
+    exp_rsp = "'subnets' parameter must be a list";
+    testCommand(cmd, CONTROL_RESULT_ERROR, exp_rsp);
+
+    cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-all\",\n"
+        "    \"arguments\": {"
+        "        \"subnets\": [ \"44\" ]"
+        "    }\n"
+        "}";
+    exp_rsp = "listed subnet identifiers must be numbers";
+    testCommand(cmd, CONTROL_RESULT_ERROR, exp_rsp);
+}
+
+// Checks that lease6-get-all returns all leases or the leases of the
+// specified subnets.
+TEST_F(LeaseCmdsTest, Lease6GetAll) {
+
+    // Initialize lease manager (true = v6, false = no leases)
+    initLeaseMgr(true, false);
+    addLeases6(3);
+
+    string cmd =
+        "{\n"
+        "    \"command\": \"lease6-get-all\"\n"
+        "}";
+    string exp_rsp = "3 IPv6 lease(s) found.";
+    ConstElementPtr rsp = testCommand(cmd, CONTROL_RESULT_SUCCESS, exp_rsp);
+    ConstElementPtr leases = getLeasesList(rsp);
+    ASSERT_TRUE(leases);
+    ASSERT_EQ(3, leases->size());
+
+    // The leases are returned in the same format as for lease6-get.
+    for (size_t i = 0; i < leases->size(); ++i) {
+        ConstElementPtr l = leases->get(i);
+        ASSERT_TRUE(l->get("ip-address"));
+        checkLease6(l, l->get("ip-address")->stringValue(), 0, 66,
+                    "77:77:77:77:77:77:77:77", false);
+    }
+
+    cmd =
+        "{\n"
+        "    \"command\": \"lease6-get-all\",\n"
+        "    \"arguments\": {"
+        "        \"subnets\": [ 66 ]"
+        "    }\n"
+        "}";
+    rsp = testCommand(cmd, CONTROL_RESULT_SUCCESS, exp_rsp);
+    leases = getLeasesList(rsp);
+    ASSERT_TRUE(leases);
+    EXPECT_EQ(3, leases->size());
+
+    cmd =
+        "{\n"
+        "    \"command\": \"lease6-get-all\",\n"
+        "    \"arguments\": {"
+        "        \"subnets\": [ 1 ]"
+        "    }\n"
+        "}";
+    exp_rsp = "0 IPv6 lease(s) found.";
+    testCommand(cmd, CONTROL_RESULT_EMPTY, exp_rsp);
+}
+
+// Checks that lease4-get-page returns all leases in subsequent pages.
+TEST_F(LeaseCmdsTest, Lease4GetPaged) {
+
+    // Initialize lease manager (false = v4, false = no leases)
+    initLeaseMgr(false, false);
+    addLeases4(5);
+
+    // Fetch the pages of 2 leases. The last page holds one lease.
+    std::string last_address = "start";
+    std::vector<std::string> addresses;
+    for (size_t i = 0; i < 3; ++i) {
+        ConstElementPtr rsp = getPage(false, last_address, 2,
+                                      CONTROL_RESULT_SUCCESS);
+        ConstElementPtr leases = getLeasesList(rsp);
+        ASSERT_TRUE(leases);
+        EXPECT_EQ(i < 2 ? 2 : 1, leases->size());
+
+        ConstElementPtr count = rsp->get("arguments")->get("count");
+        ASSERT_TRUE(count);
+        EXPECT_EQ(leases->size(), count->intValue());
+
+        for (size_t j = 0; j < leases->size(); ++j) {
+            last_address = leases->get(j)->get("ip-address")->stringValue();
+            addresses.push_back(last_address);
+        }
+    }
+
+    // There are no more leases.
+    ConstElementPtr rsp = getPage(false, last_address, 2, CONTROL_RESULT_EMPTY);
+    ConstElementPtr leases = getLeasesList(rsp);
+    ASSERT_TRUE(leases);
+    EXPECT_EQ(0, leases->size());
+
+    // All leases have been returned in the order of addresses.
+    ASSERT_EQ(5, addresses.size());
+    EXPECT_EQ("192.0.2.1", addresses[0]);
+    EXPECT_EQ("192.0.2.3", addresses[2]);
+    EXPECT_EQ("192.0.2.5", addresses[4]);
+}
+
+// Checks that lease4-get-page verifies its arguments.
+TEST_F(LeaseCmdsTest, Lease4GetPagedBadParams) {
+
+    // Initialize lease manager (false = v4, true = add a lease)
+    initLeaseMgr(false, true);
+
+    string cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-page\",\n"
+        "    \"arguments\": {"
+        "        \"limit\": 2"
+        "    }\n"
+        "}";
+    string exp_rsp = "'from' parameter not specified";
+    testCommand(cmd, CONTROL_RESULT_ERROR, exp_rsp);
+
+    cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-page\",\n"
+        "    \"arguments\": {"
+        "        \"from\": \"foo\","
+        "        \"limit\": 2"
+        "    }\n"
+        "}";
+    exp_rsp = "'from' parameter value is neither 'start' keyword nor "
+        "a valid IPv4 address";
+    testCommand(cmd, CONTROL_RESULT_ERROR, exp_rsp);
+
+    cmd =
+        "{\n"
+        "    \"command\": \"lease4-get-page\",\n"
+        "    \"arguments\": {"
+        "        \"from\": \"2001:db8::1\","
+        "        \"limit\": 2"
+        "    }\n"
+        "}";
+    exp_rsp = "'from' parameter value 2001:db8::1 is not an IPv4 address";
+    testCommand(cmd, CONTROL_RESULT_ERROR, exp_rsp);
+
+    // The page size must be positive.
+    getPage(false, "start", 0, CONTROL_RESULT_ERROR);
+}
+
+// Checks that lease6-get-page returns all leases in subsequent pages.
+TEST_F(LeaseCmdsTest, Lease6GetPaged) {
+
+    // Initialize lease manager (true = v6, false = no leases)
+    initLeaseMgr(true, false);
+    addLeases6(5);
+
+    // Fetch the pages of 2 leases. The last page holds one lease.
+    std::string last_address = "start";
+    std::set<std::string> addresses;
+    for (size_t i = 0; i < 3; ++i) {
+        ConstElementPtr rsp = getPage(true, last_address, 2,
+                                      CONTROL_RESULT_SUCCESS);
+        ConstElementPtr leases = getLeasesList(rsp);
+        ASSERT_TRUE(leases);
+        EXPECT_EQ(i < 2 ? 2 : 1, leases->size());
+
+        for (size_t j = 0; j < leases->size(); ++j) {
+            last_address = leases->get(j)->get("ip-address")->stringValue();
+            EXPECT_TRUE(addresses.insert(last_address).second)
+                << "lease for address " << last_address
+                << " returned more than once";
+        }
+    }
+
+    // All leases have been returned.
+    EXPECT_EQ(5, addresses.size());
+
+    // Only IPv6 addresses are accepted.
+    getPage(true, "192.0.2.1", 2, CONTROL_RESULT_ERROR);
+}
+
+// Checks that lease4-bulk-apply adds new leases and updates existing
+// leases.
+TEST_F(LeaseCmdsTest, Lease4BulkApply) {
+
+    // Initialize lease manager (false = v4, true = add a lease)
+    initLeaseMgr(false, true);
+
+    string cmd =
+        "{\n"
+        "    \"command\": \"lease4-bulk-apply\",\n"
+        "    \"arguments\": {"
+        "        \"leases\": ["
+        "            {"
+        "                \"subnet-id\": 44,"
+        "                \"ip-address\": \"192.0.2.1\","
+        "                \"hw-address\": \"1a:1b:1c:1d:1e:1f\","
+        "                \"hostname\": \"newhostname.example.org\""
+        "            },"
+        "            {"
+        "                \"subnet-id\": 44,"
+        "                \"ip-address\": \"192.0.2.202\","
+        "                \"hw-address\": \"2a:2b:2c:2d:2e:2f\""
+        "            }"
+        "        ]"
+        "    }\n"
+        "}";
+    string exp_rsp = "Applied 2 IPv4 lease(s).";
+    testCommand(cmd, CONTROL_RESULT_SUCCESS, exp_rsp);
+
+    // The existing lease has been updated.
+    Lease4Ptr l = lmptr_->getLease4(IOAddress("192.0.2.1"));
+    ASSERT_TRUE(l);
+    ASSERT_TRUE(l->hwaddr_);
+    EXPECT_EQ("hwtype=1 1a:1b:1c:1d:1e:1f", l->hwaddr_->toText());
+    EXPECT_EQ("newhostname.example.org", l->hostname_);
+
+    // The new lease has been added.
+    l = lmptr_->getLease4(IOAddress("192.0.2.202"));
+    ASSERT_TRUE(l);
+    ASSERT_TRUE(l->hwaddr_);
+    EXPECT_EQ("hwtype=1 2a:2b:2c:2d:2e:2f", l->hwaddr_->toText());
+}
+
+// Checks that lease4-bulk-apply rejects the whole batch when any of the
+// leases is invalid.
+TEST_F(LeaseCmdsTest, Lease4BulkApplyBadParams) {
+
+    // Initialize lease manager (false = v4, false = no leases)
+    initLeaseMgr(false, false);
+
+    string cmd =
+        "{\n"
+        "    \"command\": \"lease4-bulk-apply\",\n"
+        "    \"arguments\": {"
+        "    }\n"
+        "}";
+    string exp_rsp = "'leases' parameter not specified";
+    testCommand(cmd, CONTROL_RESULT_ERROR, exp_rsp);
+
+    // The second lease doesn't belong to the subnet.
+    cmd =
+        "{\n"
+        "    \"command\": \"lease4-bulk-apply\",\n"
+        "    \"arguments\": {"
+        "        \"leases\": ["
+        "            {"
+        "                \"subnet-id\": 44,"
+        "                \"ip-address\": \"192.0.2.202\","
+        "                \"hw-address\": \"1a:1b:1c:1d:1e:1f\""
+        "            },"
+        "            {"
+        "                \"subnet-id\": 44,"
+        "                \"ip-address\": \"10.0.0.1\","
+        "                \"hw-address\": \"2a:2b:2c:2d:2e:2f\""
+        "            }"
+        "        ]"
+        "    }\n"
+        "}";
+    testCommand(cmd, CONTROL_RESULT_ERROR, "");
+
+    // None of the leases has been applied.
+    EXPECT_FALSE(lmptr_->getLease4(IOAddress("192.0.2.202")));
+}
+
+// Checks that lease6-bulk-apply adds new leases and updates existing
+// leases.
+TEST_F(LeaseCmdsTest, Lease6BulkApply) {
+
+    // Initialize lease manager (true = v6, true = add a lease)
+    initLeaseMgr(true, true);
+
+    string cmd =
+        "{\n"
+        "    \"command\": \"lease6-bulk-apply\",\n"
+        "    \"arguments\": {"
+        "        \"leases\": ["
+        "            {"
+        "                \"subnet-id\": 66,"
+        "                \"ip-address\": \"2001:db8::1\","
+        "                \"duid\": \"77:77:77:77:77:77:77:77\","
+        "                \"iaid\": 42,"
+        "                \"hostname\": \"newhostname.example.org\""
+        "            },"
+        "            {"
+        "                \"subnet-id\": 66,"
+        "                \"ip-address\": \"2001:db8::3\","
+        "                \"duid\": \"1a:1b:1c:1d:1e:1f:20:21:22:23:24\","
+        "                \"iaid\": 1234"
+        "            }"
+        "        ]"
+        "    }\n"
+        "}";
+    string exp_rsp = "Applied 2 IPv6 lease(s).";
+    testCommand(cmd, CONTROL_RESULT_SUCCESS, exp_rsp);
+
+    // The existing lease has been updated.
+    Lease6Ptr l = lmptr_->getLease6(Lease::TYPE_NA, IOAddress("2001:db8::1"));
+    ASSERT_TRUE(l);
+    EXPECT_EQ("newhostname.example.org", l->hostname_);
+
+    // The new lease has been added.
+    l = lmptr_->getLease6(Lease::TYPE_NA, IOAddress("2001:db8::3"));
+    ASSERT_TRUE(l);
+    EXPECT_EQ(1234, l->iaid_);
+}
+
 // Checks that lease4-wipe detects missing parmameter properly.
 TEST_F(LeaseCmdsTest, Lease4WipeMissingParam) {
 
@@ -10,6 +10,7 @@
 #include <asiolink/io_error.h>
 #include <exceptions/exceptions.h>
 
+#include <boost/functional/hash.hpp>
 #include <boost/static_assert.hpp>
 
 #include <unistd.h>             // for some IPC/network system calls
@@ -123,6 +124,18 @@ operator<<(std::ostream& os, const IOAddress& address) {
     return (os);
 }
 
+size_t
+hash_value(const IOAddress& address) {
+    if (address.isV4()) {
+        return (boost::hash<uint32_t>()(address.toUint32()));
+    }
+
+    // Hash the bytes in place to avoid the copy made by toBytes().
+    const boost::asio::ip::address_v6::bytes_type bytes6 =
+        address.asio_address_.to_v6().to_bytes();
+    return (boost::hash_range(bytes6.begin(), bytes6.end()));
+}
+
 IOAddress
 IOAddress::subtract(const IOAddress& a, const IOAddress& b) {
     if (a.getFamily() != b.getFamily()) {
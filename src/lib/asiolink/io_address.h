@@ -312,6 +312,8 @@ public:
 
 private:
     boost::asio::ip::address asio_address_;
+
+    friend size_t hash_value(const IOAddress& address);
 };
 
 /// \brief Insert the IOAddress as a string into stream.
@@ -330,6 +332,17 @@ private:
 std::ostream&
 operator<<(std::ostream& os, const IOAddress& address);
 
+/// \brief Computes the hash value of the \c IOAddress.
+///
+/// This function is found by \c boost::hash through argument dependent
+/// lookup, which allows for using the \c IOAddress as a key in hashed
+/// containers, e.g. in hashed indexes of the Boost multi index containers.
+///
+/// \param address The \c IOAddress object for which the hash is computed.
+/// \return Hash value of the address.
+size_t
+hash_value(const IOAddress& address);
+
 } // namespace asiolink
 } // namespace isc
 #endif // IO_ADDRESS_H
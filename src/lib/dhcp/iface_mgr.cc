@@ -22,6 +22,7 @@
 
 #include <cstring>
 #include <errno.h>
+#include <fcntl.h>
 #include <fstream>
 #include <sstream>
 
@@ -38,6 +39,8 @@ using namespace isc::util::io::internal;
 namespace isc {
 namespace dhcp {
 
+const size_t IfaceMgr::DEFAULT_RECEIVE_BATCH_SIZE;
+
 IfaceMgr&
 IfaceMgr::instance() {
     return (*instancePtr());
@@ -170,6 +173,8 @@ IfaceMgr::IfaceMgr()
      control_buf_(new char[control_buf_len_]),
      packet_filter_(new PktFilterInet()),
      packet_filter6_(new PktFilterInet6()),
+     poller_family_(0), poller_usable_(false),
+     receive_batch_size_(DEFAULT_RECEIVE_BATCH_SIZE),
      test_mode_(false)
 {
 
@@ -264,6 +269,9 @@ void IfaceMgr::closeSockets() {
     BOOST_FOREACH(IfacePtr iface, ifaces_) {
         iface->closeSockets();
     }
+    resetPoller();
+    received4_.clear();
+    received6_.clear();
 }
 
 void
@@ -271,6 +279,12 @@ IfaceMgr::closeSockets(const uint16_t family) {
     BOOST_FOREACH(IfacePtr iface, ifaces_) {
         iface->closeSockets(family);
     }
+    resetPoller();
+    if (family == AF_INET) {
+        received4_.clear();
+    } else if (family == AF_INET6) {
+        received6_.clear();
+    }
 }
 
 IfaceMgr::~IfaceMgr() {
@@ -305,6 +319,7 @@ IfaceMgr::addExternalSocket(int socketfd, SocketCallback callback) {
     x.socket_ = socketfd;
     x.callback_ = callback;
     callbacks_.push_back(x);
+    resetPoller();
 }
 
 void
@@ -313,6 +328,7 @@ IfaceMgr::deleteExternalSocket(int socketfd) {
          s != callbacks_.end(); ++s) {
         if (s->socket_ == socketfd) {
             callbacks_.erase(s);
+            resetPoller();
             return;
         }
     }
@@ -321,6 +337,7 @@ IfaceMgr::deleteExternalSocket(int socketfd) {
 void
 IfaceMgr::deleteAllExternalSockets() {
     callbacks_.clear();
+    resetPoller();
 }
 
 void
@@ -345,6 +362,7 @@ IfaceMgr::setPacketFilter(const PktFilterPtr& packet_filter) {
     }
     // Everything is fine, so replace packet filter.
     packet_filter_ = packet_filter;
+    resetPoller();
 }
 
 void
@@ -363,6 +381,7 @@ IfaceMgr::setPacketFilter(const PktFilter6Ptr& packet_filter) {
     }
 
     packet_filter6_ = packet_filter;
+    resetPoller();
 }
 
 bool
@@ -676,6 +695,7 @@ IfaceMgr::getIface(const std::string& ifname) {
 void
 IfaceMgr::clearIfaces() {
     ifaces_.clear();
+    resetPoller();
 }
 
 void
@@ -850,6 +870,7 @@ IfaceMgr::openSocket4(Iface& iface, const IOAddress& addr,
     SocketInfo info = packet_filter_->openSocket(iface, addr, port,
                                                  receive_bcast, send_bcast);
     iface.addSocket(info);
+    resetPoller();
 
     return (info.sockfd_);
 }
@@ -879,6 +900,66 @@ IfaceMgr::send(const Pkt4Ptr& pkt) {
     return (packet_filter_->send(*iface, getSocket(*pkt).sockfd_, pkt));
 }
 
+size_t
+IfaceMgr::sendBatch(const std::vector<Pkt6Ptr>& pkts) {
+    size_t sent = 0;
+    std::vector<Pkt6Ptr> same_socket;
+    IfacePtr iface;
+    uint16_t sockfd = 0;
+    for (std::vector<Pkt6Ptr>::const_iterator pkt = pkts.begin();
+         pkt != pkts.end(); ++pkt) {
+        IfacePtr pkt_iface = getIface((*pkt)->getIface());
+        if (!pkt_iface) {
+            isc_throw(BadValue, "Unable to send DHCPv6 message. Invalid"
+                      " interface (" << (*pkt)->getIface() << ") specified.");
+        }
+        uint16_t pkt_sockfd = getSocket(**pkt);
+        // Send the packets collected for the previous socket.
+        if (!same_socket.empty() &&
+            ((pkt_iface != iface) || (pkt_sockfd != sockfd))) {
+            sent += packet_filter6_->sendBatch(*iface, sockfd, same_socket);
+            same_socket.clear();
+        }
+        iface = pkt_iface;
+        sockfd = pkt_sockfd;
+        same_socket.push_back(*pkt);
+    }
+    if (!same_socket.empty()) {
+        sent += packet_filter6_->sendBatch(*iface, sockfd, same_socket);
+    }
+    return (sent);
+}
+
+size_t
+IfaceMgr::sendBatch(const std::vector<Pkt4Ptr>& pkts) {
+    size_t sent = 0;
+    std::vector<Pkt4Ptr> same_socket;
+    IfacePtr iface;
+    int sockfd = -1;
+    for (std::vector<Pkt4Ptr>::const_iterator pkt = pkts.begin();
+         pkt != pkts.end(); ++pkt) {
+        IfacePtr pkt_iface = getIface((*pkt)->getIface());
+        if (!pkt_iface) {
+            isc_throw(BadValue, "Unable to send DHCPv4 message. Invalid"
+                      " interface (" << (*pkt)->getIface() << ") specified.");
+        }
+        int pkt_sockfd = getSocket(**pkt).sockfd_;
+        // Send the packets collected for the previous socket.
+        if (!same_socket.empty() &&
+            ((pkt_iface != iface) || (pkt_sockfd != sockfd))) {
+            sent += packet_filter_->sendBatch(*iface, sockfd, same_socket);
+            same_socket.clear();
+        }
+        iface = pkt_iface;
+        sockfd = pkt_sockfd;
+        same_socket.push_back(*pkt);
+    }
+    if (!same_socket.empty()) {
+        sent += packet_filter_->sendBatch(*iface, sockfd, same_socket);
+    }
+    return (sent);
+}
+
 
 Pkt4Ptr IfaceMgr::receive4(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */) {
     // Sanity check for microsecond timeout.
@@ -886,6 +967,28 @@ Pkt4Ptr IfaceMgr::receive4(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */
         isc_throw(BadValue, "fractional timeout must be shorter than"
                   " one million microseconds");
     }
+
+    // Return the packet received together with the previous one, if any.
+    if (!received4_.empty()) {
+        return (popReceived4());
+    }
+
+    if (preparePoller(AF_INET)) {
+        if (!pollSockets(timeout_sec, timeout_usec)) {
+            return (Pkt4Ptr());
+        }
+        // Receive the packets from all sockets having data, until the
+        // batch is complete.
+        for (std::vector<uint32_t>::const_iterator key = poll_ready_.begin();
+             (key != poll_ready_.end()) &&
+                 (received4_.size() < receive_batch_size_); ++key) {
+            PollSocket& s = poll_sockets_[*key - poll_callbacks_.size()];
+            receiveBatch4(*s.first, s.second);
+        }
+        return (popReceived4());
+    }
+
+    // The poller is not supported, so use select().
     boost::scoped_ptr<SocketInfo> candidate;
     IfacePtr iface;
     fd_set sockets;
@@ -985,8 +1088,8 @@ Pkt4Ptr IfaceMgr::receive4(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */
     }
 
     // Now we have a socket, let's get some data from it!
-    // Assuming that packet filter is not NULL, because its modifier checks it.
-    return (packet_filter_->receive(*iface, *candidate));
+    receiveBatch4(*iface, *candidate);
+    return (popReceived4());
 }
 
 Pkt6Ptr IfaceMgr::receive6(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */ ) {
@@ -996,6 +1099,26 @@ Pkt6Ptr IfaceMgr::receive6(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */
                   " one million microseconds");
     }
 
+    // Return the message received together with the previous one, if any.
+    if (!received6_.empty()) {
+        return (popReceived6());
+    }
+
+    if (preparePoller(AF_INET6)) {
+        if (!pollSockets(timeout_sec, timeout_usec)) {
+            return (Pkt6Ptr());
+        }
+        // Receive the messages from all sockets having data, until the
+        // batch is complete.
+        for (std::vector<uint32_t>::const_iterator key = poll_ready_.begin();
+             (key != poll_ready_.end()) &&
+                 (received6_.size() < receive_batch_size_); ++key) {
+            receiveBatch6(poll_sockets_[*key - poll_callbacks_.size()].second);
+        }
+        return (popReceived6());
+    }
+
+    // The poller is not supported, so use select().
     boost::scoped_ptr<SocketInfo> candidate;
     fd_set sockets;
     int maxfd = 0;
@@ -1093,10 +1216,171 @@ Pkt6Ptr IfaceMgr::receive6(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */
     if (!candidate) {
         isc_throw(SocketReadError, "received data over unknown socket");
     }
+    receiveBatch6(*candidate);
+    return (popReceived6());
+}
+
+void
+IfaceMgr::setReceiveBatchSize(const size_t batch_size) {
+    if (batch_size == 0) {
+        isc_throw(BadValue, "the number of packets received at once must"
+                  " be greater than 0");
+    }
+    receive_batch_size_ = batch_size;
+}
+
+bool
+IfaceMgr::preparePoller(const uint16_t family) {
+    if (poller_family_ == family) {
+        return (poller_usable_);
+    }
+
+    poller_family_ = family;
+    poller_usable_ = false;
+    poll_callbacks_.clear();
+    poll_sockets_.clear();
+
+    if (!SocketPoller::isSupported()) {
+        return (false);
+    }
+
+    try {
+        if (poller_) {
+            poller_->clear();
+        } else {
+            poller_.reset(new SocketPoller());
+        }
+    } catch (const std::exception&) {
+        // Fall back to select().
+        return (false);
+    }
+
+    // External sockets are registered first, so as they have the lowest
+    // keys and are handled first.
+    for (SocketCallbackInfoContainer::const_iterator s = callbacks_.begin();
+         s != callbacks_.end(); ++s) {
+        if (!poller_->add(s->socket_, poll_callbacks_.size())) {
+            return (false);
+        }
+        poll_callbacks_.push_back(*s);
+    }
+
+    for (IfaceCollection::const_iterator iface = ifaces_.begin();
+         iface != ifaces_.end(); ++iface) {
+        const Iface::SocketCollection& sockets = (*iface)->getSockets();
+        for (Iface::SocketCollection::const_iterator s = sockets.begin();
+             s != sockets.end(); ++s) {
+            if ((family == AF_INET) ? !s->addr_.isV4() : !s->addr_.isV6()) {
+                continue;
+            }
+            if (!poller_->add(s->sockfd_, poll_callbacks_.size() +
+                              poll_sockets_.size())) {
+                return (false);
+            }
+            poll_sockets_.push_back(PollSocket(*iface, *s));
+        }
+    }
+
+    poller_usable_ = true;
+    return (true);
+}
+
+bool
+IfaceMgr::pollSockets(const uint32_t timeout_sec, const uint32_t timeout_usec) {
+    // zero out the errno to be safe
+    errno = 0;
+
+    int result = poller_->wait(timeout_sec, timeout_usec, poll_ready_);
+
+    if (result == 0) {
+        // The sockets closed without notifying IfaceMgr are silently
+        // removed from the poller, while select() reports them.
+        checkPollSockets();
+        // nothing received and timeout has been reached
+        return (false);
+
+    } else if (result < 0) {
+        // Report the signal in the same way as when select() is used.
+        if (errno == EINTR) {
+            isc_throw(SignalInterruptOnSelect, strerror(errno));
+        } else {
+            isc_throw(SocketReadError, strerror(errno));
+        }
+    }
+
+    // The keys are sorted, so the external socket having data, if any,
+    // comes first.
+    if (poll_ready_.front() < poll_callbacks_.size()) {
+        // Calling the external socket's callback provides its service
+        // layer access without integrating any specific features
+        // in IfaceMgr
+        SocketCallback callback = poll_callbacks_[poll_ready_.front()].callback_;
+        if (callback) {
+            callback();
+        }
+        return (false);
+    }
+
+    return (true);
+}
+
+void
+IfaceMgr::checkPollSockets() const {
+    for (std::vector<SocketCallbackInfo>::const_iterator s =
+             poll_callbacks_.begin(); s != poll_callbacks_.end(); ++s) {
+        if (fcntl(s->socket_, F_GETFD) < 0) {
+            isc_throw(SocketReadError, strerror(errno));
+        }
+    }
+    for (std::vector<PollSocket>::const_iterator s = poll_sockets_.begin();
+         s != poll_sockets_.end(); ++s) {
+        if (fcntl(s->second.sockfd_, F_GETFD) < 0) {
+            isc_throw(SocketReadError, strerror(errno));
+        }
+    }
+}
+
+void
+IfaceMgr::receiveBatch4(Iface& iface, const SocketInfo& socket_info) {
+    batch4_.clear();
     // Assuming that packet filter is not NULL, because its modifier checks it.
-    return (packet_filter6_->receive(*candidate));
+    packet_filter_->receiveBatch(iface, socket_info,
+                                 receive_batch_size_ - received4_.size(),
+                                 batch4_);
+    received4_.insert(received4_.end(), batch4_.begin(), batch4_.end());
 }
 
+void
+IfaceMgr::receiveBatch6(const SocketInfo& socket_info) {
+    batch6_.clear();
+    // Assuming that packet filter is not NULL, because its modifier checks it.
+    packet_filter6_->receiveBatch(socket_info,
+                                  receive_batch_size_ - received6_.size(),
+                                  batch6_);
+    received6_.insert(received6_.end(), batch6_.begin(), batch6_.end());
+}
+
+Pkt4Ptr
+IfaceMgr::popReceived4() {
+    if (received4_.empty()) {
+        return (Pkt4Ptr());
+    }
+    Pkt4Ptr pkt = received4_.front();
+    received4_.pop_front();
+    return (pkt);
+}
+
+Pkt6Ptr
+IfaceMgr::popReceived6() {
+    if (received6_.empty()) {
+        return (Pkt6Ptr());
+    }
+    Pkt6Ptr pkt = received6_.front();
+    received6_.pop_front();
+    return (pkt);
+}
+
+
 uint16_t IfaceMgr::getSocket(const isc::dhcp::Pkt6& pkt) {
     IfacePtr iface = getIface(pkt.getIface());
     if (!iface) {
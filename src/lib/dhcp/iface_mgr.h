@@ -14,14 +14,18 @@
 #include <dhcp/pkt6.h>
 #include <dhcp/pkt_filter.h>
 #include <dhcp/pkt_filter6.h>
+#include <dhcp/socket_poller.h>
 #include <util/optional_value.h>
 
 #include <boost/function.hpp>
 #include <boost/noncopyable.hpp>
 #include <boost/scoped_array.hpp>
+#include <boost/scoped_ptr.hpp>
 #include <boost/shared_ptr.hpp>
 
+#include <deque>
 #include <list>
+#include <utility>
 #include <vector>
 
 namespace isc {
@@ -519,6 +523,16 @@ boost::function<void(const std::string& errmsg)> IfaceMgrErrorMsgCallback;
 /// interfaces, configured addresses, link-local addresses, and provides
 /// API for using sockets.
 ///
+/// Where supported (on Linux), the sockets are registered with the
+/// @c SocketPoller when the packets are received for the first time after
+/// the sockets have been opened or closed, rather than on each call to
+/// @c IfaceMgr::receive4 or @c IfaceMgr::receive6. When a socket has data,
+/// the packet filter reads up to @c IfaceMgr::getReceiveBatchSize packets
+/// at once and the packets not returned to the caller are queued for the
+/// subsequent calls. The sockets added directly to the @c Iface are not
+/// registered until the sockets are opened or closed using the
+/// @c IfaceMgr.
+///
 class IfaceMgr : public boost::noncopyable {
 public:
     /// Defines callback used when data is received over external sockets.
@@ -545,6 +559,9 @@ public:
     /// we don't support packets larger than 1500.
     static const uint32_t RCVBUFSIZE = 1500;
 
+    /// @brief Default maximum number of packets received at once.
+    static const size_t DEFAULT_RECEIVE_BATCH_SIZE = 32;
+
     // TODO performance improvement: we may change this into
     //      2 maps (ifindex-indexed and name-indexed) and
     //      also hide it (make it public make tests easier for now)
@@ -710,6 +727,61 @@ public:
     /// @return true if sending was successful
     bool send(const Pkt4Ptr& pkt);
 
+    /// @brief Sends IPv6 packets.
+    ///
+    /// The consecutive packets to be sent over the same socket are sent
+    /// using a single call to the packet filter, which may send them with
+    /// a single system call.
+    ///
+    /// @param pkts Packets to be sent.
+    ///
+    /// @throw isc::BadValue if invalid interface specified in a packet.
+    /// The packets preceding this packet may have been sent.
+    /// @throw isc::dhcp::SocketWriteError if sending packets failed.
+    /// @return Number of packets sent.
+    size_t sendBatch(const std::vector<Pkt6Ptr>& pkts);
+
+    /// @brief Sends IPv4 packets.
+    ///
+    /// The consecutive packets to be sent over the same socket are sent
+    /// using a single call to the packet filter, which may send them with
+    /// a single system call.
+    ///
+    /// @param pkts Packets to be sent.
+    ///
+    /// @throw isc::BadValue if invalid interface specified in a packet.
+    /// The packets preceding this packet may have been sent.
+    /// @throw isc::dhcp::SocketWriteError if sending packets failed.
+    /// @return Number of packets sent.
+    size_t sendBatch(const std::vector<Pkt4Ptr>& pkts);
+
+    /// @brief Sets the maximum number of packets received at once.
+    ///
+    /// @param batch_size Maximum number of packets.
+    /// @throw isc::BadValue if the value is 0.
+    void setReceiveBatchSize(const size_t batch_size);
+
+    /// @brief Returns the maximum number of packets received at once.
+    size_t getReceiveBatchSize() const {
+        return (receive_batch_size_);
+    }
+
+    /// @brief Checks if received IPv4 packets are queued.
+    ///
+    /// @return true if @c receive4 will return a packet received together
+    /// with the previously returned one, without waiting for data.
+    bool hasReceived4() const {
+        return (!received4_.empty());
+    }
+
+    /// @brief Checks if received IPv6 packets are queued.
+    ///
+    /// @return true if @c receive6 will return a packet received together
+    /// with the previously returned one, without waiting for data.
+    bool hasReceived6() const {
+        return (!received6_.empty());
+    }
+
     /// @brief Tries to receive DHCPv6 message over open IPv6 sockets.
     ///
     /// Attempts to receive a single DHCPv6 message over any of the open IPv6
@@ -719,6 +791,9 @@ public:
     /// This method also checks if data arrived over registered external socket.
     /// This data may be of a different protocol family than AF_INET6.
     ///
+    /// The messages received together with the previously returned message
+    /// are returned first, without waiting for data.
+    ///
     /// @param timeout_sec specifies integral part of the timeout (in seconds)
     /// @param timeout_usec specifies fractional part of the timeout
     /// (in microseconds)
@@ -741,6 +816,9 @@ public:
     /// This method also checks if data arrived over registered external socket.
     /// This data may be of a different protocol family than AF_INET.
     ///
+    /// The packets received together with the previously returned packet
+    /// are returned first, without waiting for data.
+    ///
     /// @param timeout_sec specifies integral part of the timeout (in seconds)
     /// @param timeout_usec specifies fractional part of the timeout
     /// (in microseconds)
@@ -1057,6 +1135,7 @@ public:
     /// from unit tests.
     void addInterface(const IfacePtr& iface) {
         ifaces_.push_back(iface);
+        resetPoller();
     }
 
     /// @brief Checks if there is at least one socket of the specified family
@@ -1196,6 +1275,65 @@ private:
                              const uint16_t port,
                              IfaceMgrErrorMsgCallback error_handler = 0);
 
+    /// @brief Marks the sockets registered with the poller as outdated.
+    ///
+    /// This function must be called when the sockets are opened or closed
+    /// or the external sockets are modified.
+    void resetPoller() {
+        poller_family_ = 0;
+    }
+
+    /// @brief Registers the sockets with the poller if necessary.
+    ///
+    /// @param family Family of the interface sockets to be registered:
+    /// AF_INET or AF_INET6.
+    ///
+    /// @return true if the poller can be used, false if the select() must
+    /// be used instead.
+    bool preparePoller(const uint16_t family);
+
+    /// @brief Waits for data on the sockets registered with the poller.
+    ///
+    /// If data arrived over an external socket, its callback is called.
+    ///
+    /// @param timeout_sec Integral part of the timeout (in seconds).
+    /// @param timeout_usec Fractional part of the timeout (in microseconds).
+    ///
+    /// @return true if data arrived over the interface sockets, false
+    /// otherwise. The keys of the sockets having data are held in the
+    /// @c poll_ready_.
+    /// @throw isc::dhcp::SocketReadError if the poller fails.
+    /// @throw isc::dhcp::SignalInterruptOnSelect when waiting is interrupted
+    /// by a signal.
+    bool pollSockets(const uint32_t timeout_sec, const uint32_t timeout_usec);
+
+    /// @brief Checks that the sockets registered with the poller are open.
+    ///
+    /// @throw isc::dhcp::SocketReadError if any of the sockets has been
+    /// closed, in the same way as the select() reports it.
+    void checkPollSockets() const;
+
+    /// @brief Receives IPv4 packets from the socket and queues them.
+    ///
+    /// @param iface Interface.
+    /// @param socket_info Socket having data.
+    void receiveBatch4(Iface& iface, const SocketInfo& socket_info);
+
+    /// @brief Receives IPv6 packets from the socket and queues them.
+    ///
+    /// @param socket_info Socket having data.
+    void receiveBatch6(const SocketInfo& socket_info);
+
+    /// @brief Returns the first queued IPv4 packet.
+    ///
+    /// @return Packet or null pointer if no packet is queued.
+    Pkt4Ptr popReceived4();
+
+    /// @brief Returns the first queued IPv6 packet.
+    ///
+    /// @return Packet or null pointer if no packet is queued.
+    Pkt6Ptr popReceived6();
+
     /// Holds instance of a class derived from PktFilter, used by the
     /// IfaceMgr to open sockets and send/receive packets through these
     /// sockets. It is possible to supply custom object using
@@ -1215,6 +1353,49 @@ private:
     /// @brief Contains list of callbacks for external sockets
     SocketCallbackInfoContainer callbacks_;
 
+    /// @brief Type of the interface socket registered with the poller.
+    typedef std::pair<IfacePtr, SocketInfo> PollSocket;
+
+    /// @brief Poller waiting for data on the sockets.
+    boost::scoped_ptr<SocketPoller> poller_;
+
+    /// @brief Family of the interface sockets registered with the poller.
+    ///
+    /// It is 0 when the sockets must be registered again.
+    uint16_t poller_family_;
+
+    /// @brief Indicates if all sockets have been registered with the poller.
+    bool poller_usable_;
+
+    /// @brief External sockets registered with the poller.
+    ///
+    /// The key of each socket is its position in this container.
+    std::vector<SocketCallbackInfo> poll_callbacks_;
+
+    /// @brief Interface sockets registered with the poller.
+    ///
+    /// The key of each socket is its position in this container, increased
+    /// by the number of external sockets.
+    std::vector<PollSocket> poll_sockets_;
+
+    /// @brief Keys of the sockets having data.
+    std::vector<uint32_t> poll_ready_;
+
+    /// @brief Maximum number of packets received at once.
+    size_t receive_batch_size_;
+
+    /// @brief IPv4 packets received and not yet returned.
+    std::deque<Pkt4Ptr> received4_;
+
+    /// @brief IPv6 packets received and not yet returned.
+    std::deque<Pkt6Ptr> received6_;
+
+    /// @brief Buffer for the IPv4 packets received at once.
+    std::vector<Pkt4Ptr> batch4_;
+
+    /// @brief Buffer for the IPv6 packets received at once.
+    std::vector<Pkt6Ptr> batch6_;
+
     /// @brief Indicates if the IfaceMgr is in the test mode.
     bool test_mode_;
 };
@@ -582,6 +582,7 @@ IfaceMgr::openSocket6(Iface& iface, const IOAddress& addr, uint16_t port,
     SocketInfo info = packet_filter6_->openSocket(iface, addr, port,
                                                   join_multicast);
     iface.addSocket(info);
+    resetPoller();
 
     return (info.sockfd_);
 }
@@ -464,6 +464,77 @@ size_t LibDHCP::unpackOptions6(const OptionBuffer& buf,
     return (last_offset);
 }
 
+namespace {
+
+/// @brief Creates a DHCPv4 option from its data.
+///
+/// @param idx Index of the standard option definitions.
+/// @param runtime_idx Index of the runtime option definitions.
+/// @param option_space Option space of the option.
+/// @param opt_type Option code.
+/// @param defer Indicates that the option unpacking is deferred, i.e. the
+///        option is created as a generic option.
+/// @param first Beginning of the option data.
+/// @param last End of the option data.
+///
+/// @return Pointer to the option.
+OptionPtr
+createOption4(const OptionDefContainerTypeIndex& idx,
+              const OptionDefContainerTypeIndex& runtime_idx,
+              const std::string& option_space, const uint8_t opt_type,
+              const bool defer, OptionBufferConstIter first,
+              OptionBufferConstIter last) {
+    // Get all definitions with the particular option code. Note
+    // that option code is non-unique within this container
+    // however at this point we expect to get one option
+    // definition with the particular code. If more are returned
+    // we report an error.
+    OptionDefContainerTypeRange range;
+    // Number of option definitions returned.
+    size_t num_defs = 0;
+    if (option_space == DHCP4_OPTION_SPACE) {
+        range = idx.equal_range(opt_type);
+        num_defs = distance(range.first, range.second);
+    }
+
+    // Standard option definitions do not include the definition for
+    // our option or we're searching for non-standard option. Try to
+    // find the definition among runtime option definitions.
+    if (num_defs == 0) {
+        range = runtime_idx.equal_range(opt_type);
+        num_defs = distance(range.first, range.second);
+    }
+
+    // Check if option unpacking must be deferred
+    if (defer) {
+        num_defs = 0;
+    }
+
+    OptionPtr opt;
+    if (num_defs > 1) {
+        // Multiple options of the same code are not supported right now!
+        isc_throw(isc::Unexpected, "Internal error: multiple option"
+                  " definitions for option type " <<
+                  static_cast<int>(opt_type) <<
+                  " returned. Currently it is not supported to initialize"
+                  " multiple option definitions for the same option code."
+                  " This will be supported once support for option spaces"
+                  " is implemented");
+    } else if (num_defs == 0) {
+        opt = OptionPtr(new Option(Option::V4, opt_type, first, last));
+        opt->setEncapsulatedSpace(DHCP4_OPTION_SPACE);
+    } else {
+        // The option definition has been found. Use it to create
+        // the option instance from the provided buffer chunk.
+        const OptionDefinitionPtr& def = *(range.first);
+        assert(def);
+        opt = def->optionFactory(Option::V4, opt_type, first, last);
+    }
+    return (opt);
+}
+
+}
+
 size_t LibDHCP::unpackOptions4(const OptionBuffer& buf,
                                const std::string& option_space,
                                isc::dhcp::OptionCollection& options,
@@ -524,58 +595,15 @@ size_t LibDHCP::unpackOptions4(const OptionBuffer& buf,
             return (last_offset);
         }
 
-        // Get all definitions with the particular option code. Note
-        // that option code is non-unique within this container
-        // however at this point we expect to get one option
-        // definition with the particular code. If more are returned
-        // we report an error.
-        OptionDefContainerTypeRange range;
-        // Number of option definitions returned.
-        size_t num_defs = 0;
-        if (option_space == DHCP4_OPTION_SPACE) {
-            range = idx.equal_range(opt_type);
-            num_defs = distance(range.first, range.second);
-        }
-
-        // Standard option definitions do not include the definition for
-        // our option or we're searching for non-standard option. Try to
-        // find the definition among runtime option definitions.
-        if (num_defs == 0) {
-            range = runtime_idx.equal_range(opt_type);
-            num_defs = distance(range.first, range.second);
-        }
-
         // Check if option unpacking must be deferred
-        if (shouldDeferOptionUnpack(option_space, opt_type)) {
-            num_defs = 0;
+        const bool defer = shouldDeferOptionUnpack(option_space, opt_type);
+        if (defer) {
             deferred.push_back(opt_type);
         }
 
-        OptionPtr opt;
-        if (num_defs > 1) {
-            // Multiple options of the same code are not supported right now!
-            isc_throw(isc::Unexpected, "Internal error: multiple option"
-                      " definitions for option type " <<
-                      static_cast<int>(opt_type) <<
-                      " returned. Currently it is not supported to initialize"
-                      " multiple option definitions for the same option code."
-                      " This will be supported once support for option spaces"
-                      " is implemented");
-        } else if (num_defs == 0) {
-            opt = OptionPtr(new Option(Option::V4, opt_type,
-                                       buf.begin() + offset,
-                                       buf.begin() + offset + opt_len));
-            opt->setEncapsulatedSpace(DHCP4_OPTION_SPACE);
-        } else {
-            // The option definition has been found. Use it to create
-            // the option instance from the provided buffer chunk.
-            const OptionDefinitionPtr& def = *(range.first);
-            assert(def);
-            opt = def->optionFactory(Option::V4, opt_type,
-                                     buf.begin() + offset,
-                                     buf.begin() + offset + opt_len);
-        }
-
+        OptionPtr opt = createOption4(idx, runtime_idx, option_space,
+                                      opt_type, defer, buf.begin() + offset,
+                                      buf.begin() + offset + opt_len);
         options.insert(std::make_pair(opt_type, opt));
         offset += opt_len;
     }
@@ -583,6 +611,19 @@ size_t LibDHCP::unpackOptions4(const OptionBuffer& buf,
     return (last_offset);
 }
 
+OptionPtr
+LibDHCP::unpackOption4(const std::string& option_space, const uint8_t code,
+                       OptionBufferConstIter first,
+                       OptionBufferConstIter last) {
+    const OptionDefContainerPtr& option_defs = getOptionDefs(option_space);
+    const OptionDefContainerPtr& runtime_option_defs =
+        getRuntimeOptionDefs(option_space);
+    return (createOption4(option_defs->get<1>(), runtime_option_defs->get<1>(),
+                          option_space, code,
+                          shouldDeferOptionUnpack(option_space, code),
+                          first, last));
+}
+
 size_t LibDHCP::unpackVendorOptions6(const uint32_t vendor_id,
                                      const OptionBuffer& buf,
                                      isc::dhcp::OptionCollection& options) {
@@ -260,6 +260,26 @@ public:
                                  isc::dhcp::OptionCollection& options,
                                  std::list<uint16_t>& deferred);
 
+    /// @brief Creates a DHCPv4 option from its data.
+    ///
+    /// This function creates the option the same way as
+    /// @ref unpackOptions4, i.e. using the standard or runtime option
+    /// definition of the code, or as a generic option if there is no
+    /// definition or if the unpacking of the option must be deferred.
+    /// It is used to unpack the options of a packet lazily.
+    ///
+    /// @param option_space A name of the option space of the option.
+    /// @param code Option code.
+    /// @param first Beginning of the option data.
+    /// @param last End of the option data.
+    /// @return Pointer to the option.
+    ///
+    /// @note This function calls option building routines which can throw.
+    static OptionPtr unpackOption4(const std::string& option_space,
+                                   const uint8_t code,
+                                   OptionBufferConstIter first,
+                                   OptionBufferConstIter last);
+
     /// Registers factory method that produces options of specific option types.
     ///
     /// @throw isc::BadValue if provided the type is already registered, has
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2016 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -7,6 +7,7 @@
 #include <config.h>
 #include <utility>
 #include <dhcp/pkt.h>
+#include <dhcp/pkt_buffer_pool.h>
 #include <dhcp/iface_mgr.h>
 #include <dhcp/hwaddr.h>
 #include <vector>
@@ -25,8 +26,12 @@ Pkt::Pkt(uint32_t transid, const isc::asiolink::IOAddress& local_addr,
      local_port_(local_port),
      remote_port_(remote_port),
      buffer_out_(0),
-     copy_retrieved_options_(false)
+     copy_retrieved_options_(false),
+     lazy_unpack_(false),
+     pending_options_()
 {
+    // The packet is going to be sent, so it needs the output buffer.
+    PktBufferPool::instance().acquire(buffer_out_);
 }
 
 Pkt::Pkt(const uint8_t* buf, uint32_t len, const isc::asiolink::IOAddress& local_addr,
@@ -40,18 +45,27 @@ Pkt::Pkt(const uint8_t* buf, uint32_t len, const isc::asiolink::IOAddress& local
      local_port_(local_port),
      remote_port_(remote_port),
      buffer_out_(0),
-     copy_retrieved_options_(false)
+     copy_retrieved_options_(false),
+     lazy_unpack_(false),
+     pending_options_()
 {
 
     if (len != 0) {
         if (buf == NULL) {
             isc_throw(InvalidParameter, "data buffer passed to Pkt is NULL");
         }
+        PktBufferPool::instance().acquire(data_);
         data_.resize(len);
         memcpy(&data_[0], buf, len);
     }
 }
 
+Pkt::~Pkt() {
+    PktBufferPool& pool = PktBufferPool::instance();
+    pool.release(data_);
+    pool.release(buffer_out_);
+}
+
 void
 Pkt::addOption(const OptionPtr& opt) {
     options_.insert(std::pair<int, OptionPtr>(opt->getType(), opt));
@@ -59,6 +73,9 @@ Pkt::addOption(const OptionPtr& opt) {
 
 OptionPtr
 Pkt::getNonCopiedOption(const uint16_t type) const {
+    if (!pending_options_.empty()) {
+        unpackPendingOptions(type);
+    }
     OptionCollection::const_iterator x = options_.find(type);
     if (x != options_.end()) {
         return (x->second);
@@ -68,6 +85,9 @@ Pkt::getNonCopiedOption(const uint16_t type) const {
 
 OptionPtr
 Pkt::getOption(const uint16_t type) {
+    if (!pending_options_.empty()) {
+        unpackPendingOptions(type);
+    }
     OptionCollection::iterator x = options_.find(type);
     if (x != options_.end()) {
         if (copy_retrieved_options_) {
@@ -81,6 +101,9 @@ Pkt::getOption(const uint16_t type) {
 
 bool
 Pkt::delOption(uint16_t type) {
+    if (!pending_options_.empty()) {
+        unpackPendingOptions(type);
+    }
 
     isc::dhcp::OptionCollection::iterator x = options_.find(type);
     if (x!=options_.end()) {
@@ -91,6 +114,73 @@ Pkt::delOption(uint16_t type) {
     }
 }
 
+void
+Pkt::addPendingOption(const uint16_t code, const size_t offset,
+                      const size_t length) {
+    PendingOption pending;
+    pending.code_ = code;
+    pending.offset_ = offset;
+    pending.length_ = length;
+    pending_options_.push_back(pending);
+}
+
+void
+Pkt::unpackPendingOptions(const uint16_t code) const {
+    // Unpack all options of the code first, so as the packet is left
+    // unchanged if one of them is malformed.
+    std::vector<OptionPtr> unpacked;
+    for (std::vector<PendingOption>::const_iterator pending =
+             pending_options_.begin(); pending != pending_options_.end();
+         ++pending) {
+        if (pending->code_ == code) {
+            OptionBufferConstIter first = data_.begin() + pending->offset_;
+            try {
+                unpacked.push_back(unpackOption(code, first,
+                                                first + pending->length_));
+            } catch (const std::exception& ex) {
+                isc_throw(LazyUnpackError, "failed to unpack option "
+                          << code << ": " << ex.what());
+            }
+        }
+    }
+    if (unpacked.empty()) {
+        return;
+    }
+
+    std::vector<PendingOption> remaining;
+    remaining.reserve(pending_options_.size() - unpacked.size());
+    for (std::vector<PendingOption>::const_iterator pending =
+             pending_options_.begin(); pending != pending_options_.end();
+         ++pending) {
+        if (pending->code_ != code) {
+            remaining.push_back(*pending);
+        }
+    }
+    pending_options_.swap(remaining);
+
+    // The options are part of the received packet, unpacking them
+    // doesn't change its logical state.
+    OptionCollection& options = const_cast<OptionCollection&>(options_);
+    for (std::vector<OptionPtr>::const_iterator opt = unpacked.begin();
+         opt != unpacked.end(); ++opt) {
+        options.insert(std::make_pair(code, *opt));
+    }
+}
+
+void
+Pkt::unpackPendingOptions() const {
+    while (!pending_options_.empty()) {
+        unpackPendingOptions(pending_options_.front().code_);
+    }
+}
+
+OptionPtr
+Pkt::unpackOption(const uint16_t code, OptionBufferConstIter,
+                  OptionBufferConstIter) const {
+    isc_throw(NotImplemented, "lazy unpacking of option " << code
+              << " is not supported");
+}
+
 bool
 Pkt::inClass(const std::string& client_class) {
     return (classes_.find(client_class) != classes_.end());
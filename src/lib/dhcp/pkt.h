@@ -17,11 +17,22 @@
 #include <boost/shared_ptr.hpp>
 
 #include <utility>
+#include <vector>
 
 namespace isc {
 
 namespace dhcp {
 
+/// @brief Exception thrown when a received option unpacked lazily is
+/// malformed.
+///
+/// The packet must be dropped as if @ref Pkt::unpack had failed.
+class LazyUnpackError : public Exception {
+public:
+    LazyUnpackError(const char* file, size_t line, const char* what) :
+        isc::Exception(file, line, what) { };
+};
+
 /// @brief RAII object enabling copying options retrieved from the
 /// packet.
 ///
@@ -370,6 +381,47 @@ public:
         return (copy_retrieved_options_);
     }
 
+    /// @brief Controls whether the received options are unpacked lazily.
+    ///
+    /// When enabled before @ref unpack is called, the options are only
+    /// located in the received data: an option is unpacked when it is first
+    /// retrieved, e.g. by @ref getOption, or when the packet is packed or
+    /// converted to text. The options which are never retrieved are never
+    /// unpacked. As a consequence, a malformed option is reported by the
+    /// method retrieving it rather than by @ref unpack, with the
+    /// @ref LazyUnpackError exception.
+    ///
+    /// The code iterating over @ref options_ must call
+    /// @ref unpackPendingOptions first. The received data must not be
+    /// modified while options are pending.
+    ///
+    /// Only DHCPv4 packets support the lazy unpacking: the DHCPv6 packets
+    /// ignore this setting.
+    ///
+    /// @param lazy Indicates if the options should be unpacked lazily.
+    void setLazyUnpack(const bool lazy) {
+        lazy_unpack_ = lazy;
+    }
+
+    /// @brief Returns whether the received options are unpacked lazily.
+    ///
+    /// @return true if the options are unpacked lazily.
+    bool isLazyUnpack() const {
+        return (lazy_unpack_);
+    }
+
+    /// @brief Unpacks all options which were not unpacked yet.
+    ///
+    /// This is a no-op unless the options are unpacked lazily.
+    ///
+    /// @throw LazyUnpackError if an option is malformed.
+    void unpackPendingOptions() const;
+
+    /// @brief Returns the number of options not unpacked yet.
+    size_t getPendingOptionsCount() const {
+        return (pending_options_.size());
+    }
+
     /// @brief Update packet timestamp.
     ///
     /// Updates packet timestamp. This method is invoked
@@ -565,11 +617,9 @@ public:
 
     /// @brief Virtual destructor.
     ///
-    /// There is nothing to clean up here, but since there are virtual methods,
-    /// we define virtual destructor to ensure that derived classes will have
-    /// a virtual one, too.
-    virtual ~Pkt() {
-    }
+    /// Returns the data and output buffers to the @ref PktBufferPool,
+    /// so as they can be used by the next packets.
+    virtual ~Pkt();
 
     /// @brief Classes this packet belongs to.
     ///
@@ -745,6 +795,57 @@ protected:
     /// @see the documentation for @ref Pkt::setCopyRetrievedOptions.
     bool copy_retrieved_options_;
 
+    /// @brief Location of a received option which was not unpacked yet.
+    struct PendingOption {
+        /// @brief Option code.
+        uint16_t code_;
+
+        /// @brief Offset of the option data in @ref data_.
+        size_t offset_;
+
+        /// @brief Length of the option data.
+        size_t length_;
+    };
+
+    /// @brief Records an option to be unpacked when retrieved.
+    ///
+    /// @param code Option code.
+    /// @param offset Offset of the option data in @ref data_.
+    /// @param length Length of the option data.
+    void addPendingOption(const uint16_t code, const size_t offset,
+                          const size_t length);
+
+    /// @brief Unpacks the pending options of a code.
+    ///
+    /// The options are inserted in @ref options_ and removed from the
+    /// pending options. If unpacking fails, they remain pending.
+    ///
+    /// @param code Option code.
+    /// @throw LazyUnpackError if an option is malformed.
+    void unpackPendingOptions(const uint16_t code) const;
+
+    /// @brief Unpacks an option.
+    ///
+    /// Called to unpack the pending options. The default implementation
+    /// throws @c isc::NotImplemented.
+    ///
+    /// @param code Option code.
+    /// @param first Beginning of the option data.
+    /// @param last End of the option data.
+    ///
+    /// @return Pointer to the option.
+    virtual OptionPtr unpackOption(const uint16_t code,
+                                   OptionBufferConstIter first,
+                                   OptionBufferConstIter last) const;
+
+    /// @brief Indicates if the received options are unpacked lazily.
+    ///
+    /// @see the documentation for @ref Pkt::setLazyUnpack.
+    bool lazy_unpack_;
+
+    /// @brief Received options not unpacked yet, in the received order.
+    mutable std::vector<PendingOption> pending_options_;
+
     /// packet timestamp
     boost::posix_time::ptime timestamp_;
 
@@ -769,6 +870,9 @@ private:
                                  HWAddrPtr& storage);
 };
 
+/// @brief A pointer to either Pkt4 or Pkt6 packet
+typedef boost::shared_ptr<isc::dhcp::Pkt> PktPtr;
+
 }; // namespace isc::dhcp
 }; // namespace isc
 
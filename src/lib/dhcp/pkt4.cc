@@ -75,6 +75,8 @@ size_t
 Pkt4::len() {
     size_t length = DHCPV4_PKT_HDR_LEN; // DHCPv4 header
 
+    unpackPendingOptions();
+
     // ... and sum of lengths of all options
     for (OptionCollection::const_iterator it = options_.begin();
          it != options_.end();
@@ -135,6 +137,7 @@ Pkt4::pack() {
         // write DHCP magic cookie
         buffer_out_.writeUint32(DHCP_OPTIONS_COOKIE);
 
+        unpackPendingOptions();
         LibDHCP::packOptions4(buffer_out_, options_);
 
         // add END option that indicates end of options
@@ -196,6 +199,14 @@ Pkt4::unpack() {
       isc_throw(Unexpected, "Invalid or missing DHCP magic cookie");
     }
 
+    if (lazy_unpack_) {
+        // The options are unpacked when they are retrieved, except the
+        // message type which is required to process any packet.
+        locateOptions(buffer_in.getPosition());
+        unpackPendingOptions(DHO_DHCP_MESSAGE_TYPE);
+        return;
+    }
+
     size_t opts_len = buffer_in.getLength() - buffer_in.getPosition();
     vector<uint8_t> opts_buffer;
 
@@ -227,6 +238,43 @@ Pkt4::unpack() {
     // so we'll be able to log more detailed drop reason.
 }
 
+void
+Pkt4::locateOptions(const size_t offset) {
+    pending_options_.clear();
+
+    // The options are located as in LibDHCP::unpackOptions4: parsing
+    // stops at the DHO_END option or at a truncated option.
+    size_t pos = offset;
+    while (pos < data_.size()) {
+        uint8_t opt_type = data_[pos++];
+        if (opt_type == DHO_END) {
+            return;
+        }
+        if (opt_type == DHO_PAD) {
+            continue;
+        }
+        if (pos + 1 > data_.size()) {
+            return;
+        }
+        uint8_t opt_len = data_[pos++];
+        if (pos + opt_len > data_.size()) {
+            return;
+        }
+        if (LibDHCP::shouldDeferOptionUnpack(DHCP4_OPTION_SPACE, opt_type)) {
+            deferred_options_.push_back(opt_type);
+        }
+        addPendingOption(opt_type, pos, opt_len);
+        pos += opt_len;
+    }
+}
+
+OptionPtr
+Pkt4::unpackOption(const uint16_t code, OptionBufferConstIter first,
+                   OptionBufferConstIter last) const {
+    return (LibDHCP::unpackOption4(DHCP4_OPTION_SPACE,
+                                   static_cast<uint8_t>(code), first, last));
+}
+
 uint8_t Pkt4::getType() const {
     OptionPtr generic = getNonCopiedOption(DHO_DHCP_MESSAGE_TYPE);
     if (!generic) {
@@ -397,6 +445,13 @@ Pkt4::toText() const {
 
     output << ", transid=0x" << hex << transid_ << dec;
 
+    bool unpacked = true;
+    try {
+        unpackPendingOptions();
+    } catch (...) {
+        unpacked = false;
+    }
+
     if (!options_.empty()) {
         output << "," << std::endl << "options:";
         for (isc::dhcp::OptionCollection::const_iterator opt = options_.begin();
@@ -412,6 +467,11 @@ Pkt4::toText() const {
         output << ", message contains no options";
     }
 
+    if (!unpacked) {
+        output << "," << std::endl << "options not unpacked (malformed): "
+               << getPendingOptionsCount();
+    }
+
     return (output.str());
 }
 
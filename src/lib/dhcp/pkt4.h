@@ -87,6 +87,10 @@ public:
     /// be stored in options_ container.
     ///
     /// Method with throw exception if packet parsing fails.
+    ///
+    /// If the lazy unpacking is enabled (see @ref Pkt::setLazyUnpack),
+    /// the options are only located in the received data and they are
+    /// unpacked when retrieved.
     virtual void unpack();
 
     /// @brief Returns text representation of the primary packet identifiers
@@ -414,8 +418,29 @@ private:
                                  const std::vector<uint8_t>& mac_addr,
                                  HWAddrPtr& hw_addr);
 
+    /// @brief Locates the options in the received data.
+    ///
+    /// Records the code and location of each option as a pending option,
+    /// and the codes of the options which unpacking is deferred. The
+    /// options are located the same way as they are parsed by
+    /// @ref LibDHCP::unpackOptions4.
+    ///
+    /// @param offset Offset of the first option in @ref data_.
+    void locateOptions(const size_t offset);
+
 protected:
 
+    /// @brief Unpacks a DHCPv4 option.
+    ///
+    /// @param code Option code.
+    /// @param first Beginning of the option data.
+    /// @param last End of the option data.
+    ///
+    /// @return Pointer to the option.
+    virtual OptionPtr unpackOption(const uint16_t code,
+                                   OptionBufferConstIter first,
+                                   OptionBufferConstIter last) const;
+
     /// converts DHCP message type to BOOTP op type
     ///
     /// @param dhcpType DHCP message type (e.g. DHCPDISCOVER)
@@ -0,0 +1,206 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <dhcp/pkt_buffer_pool.h>
+
+using namespace isc::util;
+using namespace isc::util::thread;
+
+namespace {
+
+/// @brief Index of the shard to be used by the next thread using a pool.
+std::atomic<size_t> next_shard(0);
+
+/// @brief Appends an empty data buffer to the pooled buffers.
+///
+/// @param pooled Pooled buffers.
+void
+appendEmpty(std::vector<isc::dhcp::OptionBuffer>& pooled) {
+    pooled.push_back(isc::dhcp::OptionBuffer());
+}
+
+/// @brief Appends an empty output buffer to the pooled buffers.
+///
+/// @param pooled Pooled buffers.
+void
+appendEmpty(std::vector<OutputBuffer>& pooled) {
+    pooled.push_back(OutputBuffer(0));
+}
+
+} // end of anonymous namespace
+
+namespace isc {
+namespace dhcp {
+
+const size_t PktBufferPool::DEFAULT_MAX_BUFFERS;
+const size_t PktBufferPool::MAX_BUFFER_CAPACITY;
+const size_t PktBufferPool::NUM_SHARDS;
+const size_t PktBufferPool::MOVE_BATCH_SIZE;
+
+PktBufferPool&
+PktBufferPool::instance() {
+    // The pool is never destroyed, because the packets held in the static
+    // objects may be destroyed after it.
+    static PktBufferPool* pool = new PktBufferPool();
+    return (*pool);
+}
+
+PktBufferPool::PktBufferPool(const size_t max_buffers)
+    : max_buffers_(0), data_count_(0), output_count_(0) {
+    setMaxBuffers(max_buffers);
+}
+
+PktBufferPool::Shard&
+PktBufferPool::getShard() {
+    // The threads are spread over the shards in the order in which they
+    // first use a pool.
+    static thread_local size_t index = next_shard++ % NUM_SHARDS;
+    return (shards_[index]);
+}
+
+template<typename BufferType>
+void
+PktBufferPool::acquireBuffer(std::vector<BufferType> Shard::* list,
+                             std::atomic<size_t>& count, BufferType& buffer) {
+    Shard& own = getShard();
+    {
+        Mutex::Locker lock(own.mutex_);
+        std::vector<BufferType>& pooled = own.*list;
+        if (!pooled.empty()) {
+            buffer.swap(pooled.back());
+            pooled.pop_back();
+            --count;
+            return;
+        }
+    }
+
+    // This shard is empty: take a batch of buffers from another one. The
+    // shards are locked in the order of their addresses, so as the threads
+    // moving buffers between the same shards don't deadlock.
+    for (size_t i = 0; (i < NUM_SHARDS) && (count > 0); ++i) {
+        Shard& other = shards_[i];
+        if (&other == &own) {
+            continue;
+        }
+        Mutex::Locker first_lock(&own < &other ? own.mutex_ : other.mutex_);
+        Mutex::Locker second_lock(&own < &other ? other.mutex_ : own.mutex_);
+        std::vector<BufferType>& from = other.*list;
+        if (from.empty()) {
+            continue;
+        }
+        buffer.swap(from.back());
+        from.pop_back();
+        --count;
+
+        // Adding the buffers to this shard doesn't allocate, because the
+        // capacity of each shard is reserved for all pooled buffers.
+        std::vector<BufferType>& to = own.*list;
+        for (size_t moved = 1; (moved < MOVE_BATCH_SIZE) && !from.empty();
+             ++moved) {
+            appendEmpty(to);
+            to.back().swap(from.back());
+            from.pop_back();
+        }
+        return;
+    }
+}
+
+template<typename BufferType>
+void
+PktBufferPool::releaseBuffer(std::vector<BufferType> Shard::* list,
+                             std::atomic<size_t>& count, BufferType& buffer) {
+    // Count the buffer first, so as the pool never exceeds its limit.
+    if (++count > max_buffers_) {
+        --count;
+        return;
+    }
+    Shard& own = getShard();
+    Mutex::Locker lock(own.mutex_);
+    // Adding the empty buffer doesn't allocate, because the capacity
+    // of the pool is reserved.
+    std::vector<BufferType>& pooled = own.*list;
+    appendEmpty(pooled);
+    pooled.back().swap(buffer);
+}
+
+void
+PktBufferPool::acquire(OptionBuffer& data) {
+    acquireBuffer(&Shard::data_, data_count_, data);
+}
+
+void
+PktBufferPool::acquire(OutputBuffer& buffer) {
+    acquireBuffer(&Shard::output_, output_count_, buffer);
+}
+
+void
+PktBufferPool::release(OptionBuffer& data) {
+    if ((data.capacity() == 0) || (data.capacity() > MAX_BUFFER_CAPACITY)) {
+        return;
+    }
+    data.clear();
+    releaseBuffer(&Shard::data_, data_count_, data);
+}
+
+void
+PktBufferPool::release(OutputBuffer& buffer) {
+    if ((buffer.getCapacity() == 0) ||
+        (buffer.getCapacity() > MAX_BUFFER_CAPACITY)) {
+        return;
+    }
+    buffer.clear();
+    releaseBuffer(&Shard::output_, output_count_, buffer);
+}
+
+void
+PktBufferPool::setMaxBuffers(const size_t max_buffers) {
+    max_buffers_ = max_buffers;
+    for (size_t i = 0; i < NUM_SHARDS; ++i) {
+        Shard& shard = shards_[i];
+        Mutex::Locker lock(shard.mutex_);
+        while (!shard.data_.empty() && (data_count_ > max_buffers)) {
+            shard.data_.pop_back();
+            --data_count_;
+        }
+        while (!shard.output_.empty() && (output_count_ > max_buffers)) {
+            shard.output_.pop_back();
+            --output_count_;
+        }
+        shard.data_.reserve(max_buffers);
+        shard.output_.reserve(max_buffers);
+    }
+}
+
+size_t
+PktBufferPool::getMaxBuffers() const {
+    return (max_buffers_);
+}
+
+size_t
+PktBufferPool::getDataCount() const {
+    return (data_count_);
+}
+
+size_t
+PktBufferPool::getOutputCount() const {
+    return (output_count_);
+}
+
+void
+PktBufferPool::clear() {
+    for (size_t i = 0; i < NUM_SHARDS; ++i) {
+        Shard& shard = shards_[i];
+        Mutex::Locker lock(shard.mutex_);
+        data_count_ -= shard.data_.size();
+        output_count_ -= shard.output_.size();
+        shard.data_.clear();
+        shard.output_.clear();
+    }
+}
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
@@ -0,0 +1,161 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef PKT_BUFFER_POOL_H
+#define PKT_BUFFER_POOL_H
+
+#include <dhcp/option.h>
+#include <util/buffer.h>
+#include <util/threads/sync.h>
+#include <boost/noncopyable.hpp>
+#include <atomic>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Pool of the buffers holding the packets' wire data.
+///
+/// Each received packet copies its data into a new buffer and each
+/// packet being sent grows its output buffer while it is packed. Both
+/// buffers are freed when the packet is destroyed, so the heap is used
+/// several times for each processed packet. This pool keeps the buffers
+/// of destroyed packets and hands them to the new packets, so the heap
+/// is not used when the server processes packets at a steady rate.
+///
+/// The packets are received by the main thread and destroyed by the
+/// worker threads, so the buffers move between the threads. The pool
+/// is divided in shards, each protected by its own mutex, so as the
+/// threads don't contend for a single lock. A thread uses the shard
+/// selected when it first used a pool. A thread finding its shard empty
+/// moves a batch of buffers from another shard to its own, so the main
+/// thread gets the buffers released by the workers without locking
+/// another shard for each packet.
+///
+/// The pool holds at most @c getMaxBuffers buffers of each kind. The
+/// buffers returned to the full pool, as well as the buffers which grew
+/// larger than @c MAX_BUFFER_CAPACITY, are freed.
+class PktBufferPool : public boost::noncopyable {
+public:
+
+    /// @brief Default maximum number of pooled buffers of each kind.
+    static const size_t DEFAULT_MAX_BUFFERS = 1024;
+
+    /// @brief Capacity above which the buffers are not pooled.
+    static const size_t MAX_BUFFER_CAPACITY = 65536;
+
+    /// @brief Returns the pool used by the packets.
+    static PktBufferPool& instance();
+
+    /// @brief Constructor.
+    ///
+    /// @param max_buffers Maximum number of pooled buffers of each kind.
+    explicit PktBufferPool(const size_t max_buffers = DEFAULT_MAX_BUFFERS);
+
+    /// @brief Hands a pooled buffer to the packet.
+    ///
+    /// @param [out] data Empty buffer which is replaced with a pooled one,
+    /// if any. Otherwise it is left unchanged.
+    void acquire(OptionBuffer& data);
+
+    /// @brief Hands a pooled output buffer to the packet.
+    ///
+    /// @param [out] buffer Empty buffer which is replaced with a pooled one,
+    /// if any. Otherwise it is left unchanged.
+    void acquire(isc::util::OutputBuffer& buffer);
+
+    /// @brief Returns the buffer of the packet to the pool.
+    ///
+    /// @param [in,out] data Buffer which is pooled, if the pool is not full.
+    /// In this case it is left empty without any allocated memory.
+    void release(OptionBuffer& data);
+
+    /// @brief Returns the output buffer of the packet to the pool.
+    ///
+    /// @param [in,out] buffer Buffer which is pooled, if the pool is not
+    /// full. In this case it is left without any allocated memory.
+    void release(isc::util::OutputBuffer& buffer);
+
+    /// @brief Sets the maximum number of pooled buffers of each kind.
+    ///
+    /// The excess buffers are freed. Setting it to 0 disables the pool.
+    ///
+    /// @param max_buffers Maximum number of pooled buffers.
+    void setMaxBuffers(const size_t max_buffers);
+
+    /// @brief Returns the maximum number of pooled buffers of each kind.
+    size_t getMaxBuffers() const;
+
+    /// @brief Returns the number of pooled data buffers.
+    size_t getDataCount() const;
+
+    /// @brief Returns the number of pooled output buffers.
+    size_t getOutputCount() const;
+
+    /// @brief Frees all pooled buffers.
+    void clear();
+
+private:
+
+    /// @brief Number of shards.
+    static const size_t NUM_SHARDS = 8;
+
+    /// @brief Maximum number of buffers moved at once between shards.
+    static const size_t MOVE_BATCH_SIZE = 32;
+
+    /// @brief Part of the pool used by some of the threads.
+    struct Shard {
+        /// @brief Pooled data buffers.
+        ///
+        /// The capacity of the vector is reserved up front, so pooling
+        /// a buffer doesn't allocate.
+        std::vector<OptionBuffer> data_;
+
+        /// @brief Pooled output buffers.
+        std::vector<isc::util::OutputBuffer> output_;
+
+        /// @brief Mutex protecting the shard.
+        isc::util::thread::Mutex mutex_;
+    };
+
+    /// @brief Returns the shard used by the calling thread.
+    Shard& getShard();
+
+    /// @brief Hands a pooled buffer of a kind to the packet.
+    ///
+    /// @param list Pooled buffers of the kind in a shard.
+    /// @param count Number of pooled buffers of the kind.
+    /// @param [out] buffer Empty buffer which is replaced with a pooled one.
+    template<typename BufferType>
+    void acquireBuffer(std::vector<BufferType> Shard::* list,
+                       std::atomic<size_t>& count, BufferType& buffer);
+
+    /// @brief Returns the buffer of a kind to the pool.
+    ///
+    /// @param list Pooled buffers of the kind in a shard.
+    /// @param count Number of pooled buffers of the kind.
+    /// @param [in,out] buffer Empty buffer to be pooled.
+    template<typename BufferType>
+    void releaseBuffer(std::vector<BufferType> Shard::* list,
+                       std::atomic<size_t>& count, BufferType& buffer);
+
+    /// @brief Maximum number of pooled buffers of each kind.
+    std::atomic<size_t> max_buffers_;
+
+    /// @brief Number of pooled data buffers.
+    std::atomic<size_t> data_count_;
+
+    /// @brief Number of pooled output buffers.
+    std::atomic<size_t> output_count_;
+
+    /// @brief Shards of the pool.
+    Shard shards_[NUM_SHARDS];
+};
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
+
+#endif // PKT_BUFFER_POOL_H
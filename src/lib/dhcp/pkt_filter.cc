@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2016 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -14,6 +14,30 @@
 namespace isc {
 namespace dhcp {
 
+size_t
+PktFilter::receiveBatch(Iface& iface, const SocketInfo& socket_info,
+                        const size_t max_packets, std::vector<Pkt4Ptr>& pkts) {
+    if (max_packets == 0) {
+        return (0);
+    }
+    Pkt4Ptr pkt = receive(iface, socket_info);
+    if (!pkt) {
+        return (0);
+    }
+    pkts.push_back(pkt);
+    return (1);
+}
+
+size_t
+PktFilter::sendBatch(const Iface& iface, uint16_t sockfd,
+                     const std::vector<Pkt4Ptr>& pkts) {
+    for (std::vector<Pkt4Ptr>::const_iterator pkt = pkts.begin();
+         pkt != pkts.end(); ++pkt) {
+        send(iface, sockfd, *pkt);
+    }
+    return (pkts.size());
+}
+
 int
 PktFilter::openFallbackSocket(const isc::asiolink::IOAddress& addr,
                               const uint16_t port) {
@@ -10,6 +10,7 @@
 #include <dhcp/pkt4.h>
 #include <asiolink/io_address.h>
 #include <boost/shared_ptr.hpp>
+#include <vector>
 
 namespace isc {
 namespace dhcp {
@@ -103,6 +104,38 @@ public:
     virtual int send(const Iface& iface, uint16_t sockfd,
                      const Pkt4Ptr& pkt) = 0;
 
+    /// @brief Receives packets available on the specified socket.
+    ///
+    /// This function is called when the socket has data to read. The
+    /// default implementation receives a single packet using @c receive.
+    /// The derived classes may override it to read many packets with a
+    /// single system call.
+    ///
+    /// @param iface Interface.
+    /// @param socket_info Structure holding socket information.
+    /// @param max_packets Maximum number of packets to be received.
+    /// @param [out] pkts Container to which the received packets are
+    /// appended.
+    ///
+    /// @return Number of packets appended to the container.
+    virtual size_t receiveBatch(Iface& iface, const SocketInfo& socket_info,
+                                const size_t max_packets,
+                                std::vector<Pkt4Ptr>& pkts);
+
+    /// @brief Sends packets over the specified socket.
+    ///
+    /// The default implementation sends the packets one by one using
+    /// @c send. The derived classes may override it to send many packets
+    /// with a single system call.
+    ///
+    /// @param iface Interface to be used to send packets.
+    /// @param sockfd Socket descriptor.
+    /// @param pkts Packets to be sent.
+    ///
+    /// @return Number of packets sent.
+    virtual size_t sendBatch(const Iface& iface, uint16_t sockfd,
+                             const std::vector<Pkt4Ptr>& pkts);
+
 protected:
 
     /// @brief Default implementation to open a fallback socket.
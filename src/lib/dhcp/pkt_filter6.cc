@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2015,2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -11,6 +11,31 @@
 namespace isc {
 namespace dhcp {
 
+size_t
+PktFilter6::receiveBatch(const SocketInfo& socket_info,
+                         const size_t max_packets,
+                         std::vector<Pkt6Ptr>& pkts) {
+    if (max_packets == 0) {
+        return (0);
+    }
+    Pkt6Ptr pkt = receive(socket_info);
+    if (!pkt) {
+        return (0);
+    }
+    pkts.push_back(pkt);
+    return (1);
+}
+
+size_t
+PktFilter6::sendBatch(const Iface& iface, uint16_t sockfd,
+                      const std::vector<Pkt6Ptr>& pkts) {
+    for (std::vector<Pkt6Ptr>::const_iterator pkt = pkts.begin();
+         pkt != pkts.end(); ++pkt) {
+        send(iface, sockfd, *pkt);
+    }
+    return (pkts.size());
+}
+
 bool
 PktFilter6::joinMulticast(int sock, const std::string& ifname,
                           const std::string & mcast) {
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2015,2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -9,6 +9,7 @@
 
 #include <asiolink/io_address.h>
 #include <dhcp/pkt6.h>
+#include <vector>
 
 namespace isc {
 namespace dhcp {
@@ -115,6 +116,37 @@ public:
     virtual int send(const Iface& iface, uint16_t sockfd,
                      const Pkt6Ptr& pkt) = 0;
 
+    /// @brief Receives DHCPv6 messages available on the specified socket.
+    ///
+    /// This function is called when the socket has data to read. The
+    /// default implementation receives a single message using @c receive.
+    /// The derived classes may override it to read many messages with a
+    /// single system call.
+    ///
+    /// @param socket_info A structure holding socket information.
+    /// @param max_packets Maximum number of messages to be received.
+    /// @param [out] pkts Container to which the received messages are
+    /// appended.
+    ///
+    /// @return Number of messages appended to the container.
+    virtual size_t receiveBatch(const SocketInfo& socket_info,
+                                const size_t max_packets,
+                                std::vector<Pkt6Ptr>& pkts);
+
+    /// @brief Sends DHCPv6 messages through a specified interface and socket.
+    ///
+    /// The default implementation sends the messages one by one using
+    /// @c send. The derived classes may override it to send many messages
+    /// with a single system call.
+    ///
+    /// @param iface Interface to be used to send messages.
+    /// @param sockfd A socket descriptor.
+    /// @param pkts Messages to be sent.
+    ///
+    /// @return Number of messages sent.
+    virtual size_t sendBatch(const Iface& iface, uint16_t sockfd,
+                             const std::vector<Pkt6Ptr>& pkts);
+
     /// @brief Joins IPv6 multicast group on a socket.
     ///
     /// This function joins the socket to the specified multicast group.
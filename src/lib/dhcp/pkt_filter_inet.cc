@@ -9,6 +9,7 @@
 #include <dhcp/pkt4.h>
 #include <dhcp/pkt_filter_inet.h>
 #include <errno.h>
+#include <algorithm>
 #include <cstring>
 #include <fcntl.h>
 
@@ -17,9 +18,17 @@ using namespace isc::asiolink;
 namespace isc {
 namespace dhcp {
 
+const size_t PktFilterInet::RECEIVE_RING_SIZE;
+
 PktFilterInet::PktFilterInet()
     : control_buf_len_(CMSG_SPACE(sizeof(struct in6_pktinfo))),
       control_buf_(new char[control_buf_len_])
+#if defined (OS_LINUX)
+      , ring_buf_(RECEIVE_RING_SIZE * IfaceMgr::RCVBUFSIZE),
+      ring_control_(RECEIVE_RING_SIZE * control_buf_len_),
+      ring_msgs_(RECEIVE_RING_SIZE), ring_addrs_(RECEIVE_RING_SIZE),
+      ring_iov_(RECEIVE_RING_SIZE)
+#endif
 {
 }
 
@@ -143,8 +152,85 @@ PktFilterInet::receive(Iface& iface, const SocketInfo& socket_info) {
         isc_throw(SocketReadError, "failed to receive UDP4 data");
     }
 
+    return (createPacket(iface, socket_info, buf, result, from_addr, m));
+}
+
+#if defined (OS_LINUX)
+size_t
+PktFilterInet::receiveBatch(Iface& iface, const SocketInfo& socket_info,
+                            const size_t max_packets,
+                            std::vector<Pkt4Ptr>& pkts) {
+    const size_t count = std::min(max_packets, RECEIVE_RING_SIZE);
+    if (count == 0) {
+        return (0);
+    }
+
+    // Point the message headers to the buffers of the ring. The buffers
+    // are reused for each batch, so nothing is allocated here.
+    memset(&ring_control_[0], 0, count * control_buf_len_);
+    for (size_t i = 0; i < count; ++i) {
+        struct msghdr& m = ring_msgs_[i].msg_hdr;
+        memset(&m, 0, sizeof(m));
+        memset(&ring_addrs_[i], 0, sizeof(ring_addrs_[i]));
+        m.msg_name = &ring_addrs_[i];
+        m.msg_namelen = sizeof(ring_addrs_[i]);
+        ring_iov_[i].iov_base = &ring_buf_[i * IfaceMgr::RCVBUFSIZE];
+        ring_iov_[i].iov_len = IfaceMgr::RCVBUFSIZE;
+        m.msg_iov = &ring_iov_[i];
+        m.msg_iovlen = 1;
+        m.msg_control = &ring_control_[i * control_buf_len_];
+        m.msg_controllen = control_buf_len_;
+        ring_msgs_[i].msg_len = 0;
+    }
+
+    // The socket is known to have data, so the first datagram is received
+    // immediately. Don't wait for the remaining ones.
+    int result = recvmmsg(socket_info.sockfd_, &ring_msgs_[0], count,
+                          MSG_DONTWAIT, NULL);
+    if (result < 0) {
+        if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+            return (0);
+        }
+        isc_throw(SocketReadError, "failed to receive UDP4 data: "
+                  << strerror(errno));
+    }
+
+    // A malformed datagram must not cause the loss of the other datagrams
+    // received in the batch, so it is dropped. The error is only reported
+    // if no packet has been received.
+    size_t received = 0;
+    std::string error;
+    for (int i = 0; i < result; ++i) {
+        try {
+            pkts.push_back(createPacket(iface, socket_info,
+                                        &ring_buf_[i * IfaceMgr::RCVBUFSIZE],
+                                        ring_msgs_[i].msg_len, ring_addrs_[i],
+                                        ring_msgs_[i].msg_hdr));
+            ++received;
+
+        } catch (const std::exception& ex) {
+            if (error.empty()) {
+                error = ex.what();
+            }
+        }
+    }
+
+    if ((received == 0) && !error.empty()) {
+        isc_throw(SocketReadError, "failed to create DHCPv4 packet: "
+                  << error);
+    }
+
+    return (received);
+}
+#endif
+
+Pkt4Ptr
+PktFilterInet::createPacket(Iface& iface, const SocketInfo& socket_info,
+                            const uint8_t* buf, const size_t len,
+                            const struct sockaddr_in& from_addr,
+                            struct msghdr& m) const {
     // We have all data let's create Pkt4 object.
-    Pkt4Ptr pkt = Pkt4Ptr(new Pkt4(buf, result));
+    Pkt4Ptr pkt = Pkt4Ptr(new Pkt4(buf, len));
 
     pkt->updateTimestamp();
 
@@ -213,14 +299,69 @@ PktFilterInet::send(const Iface&, uint16_t sockfd,
                     const Pkt4Ptr& pkt) {
     memset(&control_buf_[0], 0, control_buf_len_);
 
-    // Set the target address we're sending to.
     sockaddr_in to;
+    struct iovec v;
+    struct msghdr m;
+    prepareSend(pkt, to, v, &control_buf_[0], m);
+
+    pkt->updateTimestamp();
+
+    int result = sendmsg(sockfd, &m, 0);
+    if (result < 0) {
+        isc_throw(SocketWriteError, "pkt4 send failed: sendmsg() returned "
+                  " with an error: " << strerror(errno));
+    }
+
+    return (result);
+}
+
+#if defined (OS_LINUX)
+size_t
+PktFilterInet::sendBatch(const Iface&, uint16_t sockfd,
+                         const std::vector<Pkt4Ptr>& pkts) {
+    if (pkts.empty()) {
+        return (0);
+    }
+
+    // The packets may be sent from many threads, so the buffers are not
+    // shared with other calls.
+    std::vector<struct mmsghdr> msgs(pkts.size());
+    std::vector<sockaddr_in> to(pkts.size());
+    std::vector<struct iovec> v(pkts.size());
+    std::vector<char> control(pkts.size() * control_buf_len_, 0);
+    for (size_t i = 0; i < pkts.size(); ++i) {
+        prepareSend(pkts[i], to[i], v[i], &control[i * control_buf_len_],
+                    msgs[i].msg_hdr);
+        msgs[i].msg_len = 0;
+        pkts[i]->updateTimestamp();
+    }
+
+    // The kernel may send fewer packets than requested, so the remaining
+    // ones are sent with the next call.
+    size_t sent = 0;
+    while (sent < pkts.size()) {
+        int result = sendmmsg(sockfd, &msgs[sent], pkts.size() - sent, 0);
+        if (result < 0) {
+            isc_throw(SocketWriteError, "pkt4 send failed: sendmmsg() returned"
+                      " with an error: " << strerror(errno));
+        }
+        sent += result;
+    }
+
+    return (sent);
+}
+#endif
+
+void
+PktFilterInet::prepareSend(const Pkt4Ptr& pkt, sockaddr_in& to,
+                           struct iovec& v, char* control,
+                           struct msghdr& m) const {
+    // Set the target address we're sending to.
     memset(&to, 0, sizeof(to));
     to.sin_family = AF_INET;
     to.sin_port = htons(pkt->getRemotePort());
     to.sin_addr.s_addr = htonl(pkt->getRemoteAddr().toUint32());
 
-    struct msghdr m;
     // Initialize our message header structure.
     memset(&m, 0, sizeof(m));
     m.msg_name = &to;
@@ -229,7 +370,6 @@ PktFilterInet::send(const Iface&, uint16_t sockfd,
     // Set the data buffer we're sending. (Using this wacky
     // "scatter-gather" stuff... we only have a single chunk
     // of data to send, so we declare a single vector entry.)
-    struct iovec v;
     memset(&v, 0, sizeof(v));
     // iov_base field is of void * type. We use it for packet
     // transmission, so this buffer will not be modified.
@@ -247,7 +387,7 @@ PktFilterInet::send(const Iface&, uint16_t sockfd,
     // We have to create a "control message", and set that to
     // define the IPv4 packet information. We set the source address
     // to handle correctly interfaces with multiple addresses.
-    m.msg_control = &control_buf_[0];
+    m.msg_control = control;
     m.msg_controllen = control_buf_len_;
     struct cmsghdr* cmsg = CMSG_FIRSTHDR(&m);
     cmsg->cmsg_level = IPPROTO_IP;
@@ -272,19 +412,7 @@ PktFilterInet::send(const Iface&, uint16_t sockfd,
 
     m.msg_controllen = CMSG_SPACE(sizeof(struct in_pktinfo));
 #endif
-
-    pkt->updateTimestamp();
-
-    int result = sendmsg(sockfd, &m, 0);
-    if (result < 0) {
-        isc_throw(SocketWriteError, "pkt4 send failed: sendmsg() returned "
-                  " with an error: " << strerror(errno));
-    }
-
-    return (result);
 }
 
-
-
 } // end of isc::dhcp namespace
 } // end of isc namespace
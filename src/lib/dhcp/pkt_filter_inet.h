@@ -9,6 +9,9 @@
 
 #include <dhcp/pkt_filter.h>
 #include <boost/scoped_array.hpp>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <vector>
 
 namespace isc {
 namespace dhcp {
@@ -17,9 +20,16 @@ namespace dhcp {
 ///
 /// This class provides methods to send and receive packet via socket using
 /// AF_INET family and SOCK_DGRAM type.
+///
+/// On Linux, the packets are received in batches using the recvmmsg
+/// system call into a ring of buffers allocated once by the constructor,
+/// and sent in batches using the sendmmsg system call.
 class PktFilterInet : public PktFilter {
 public:
 
+    /// @brief Maximum number of packets received with a single system call.
+    static const size_t RECEIVE_RING_SIZE = 32;
+
     /// @brief Constructor
     ///
     /// Allocates control buffer.
@@ -84,11 +94,86 @@ public:
     virtual int send(const Iface& iface, uint16_t sockfd,
                      const Pkt4Ptr& pkt);
 
+#if defined (OS_LINUX)
+    /// @brief Receives packets available on the specified socket.
+    ///
+    /// Up to @c RECEIVE_RING_SIZE packets are received using a single
+    /// recvmmsg call, which doesn't block waiting for more packets. The
+    /// malformed packets are dropped, unless no packet is received.
+    ///
+    /// @param iface Interface.
+    /// @param socket_info Structure holding socket information.
+    /// @param max_packets Maximum number of packets to be received.
+    /// @param [out] pkts Container to which the received packets are
+    /// appended.
+    ///
+    /// @return Number of packets appended to the container.
+    /// @throw isc::dhcp::SocketReadError if an error occurs during reception
+    /// of the packets or none of the packets can be parsed.
+    virtual size_t receiveBatch(Iface& iface, const SocketInfo& socket_info,
+                                const size_t max_packets,
+                                std::vector<Pkt4Ptr>& pkts);
+
+    /// @brief Sends packets over the specified socket.
+    ///
+    /// The packets are sent using the sendmmsg call.
+    ///
+    /// @param iface Interface to be used to send packets.
+    /// @param sockfd Socket descriptor.
+    /// @param pkts Packets to be sent.
+    ///
+    /// @return Number of packets sent.
+    /// @throw isc::dhcp::SocketWriteError if an error occurs during sending
+    /// the packets.
+    virtual size_t sendBatch(const Iface& iface, uint16_t sockfd,
+                             const std::vector<Pkt4Ptr>& pkts);
+#endif
+
 private:
+
+    /// @brief Creates the packet from the received datagram.
+    ///
+    /// @param iface Interface.
+    /// @param socket_info Structure holding socket information.
+    /// @param buf Buffer holding the datagram.
+    /// @param len Length of the datagram.
+    /// @param from_addr Address of the sender.
+    /// @param m Message header holding the control messages.
+    ///
+    /// @return Received packet.
+    Pkt4Ptr createPacket(Iface& iface, const SocketInfo& socket_info,
+                         const uint8_t* buf, const size_t len,
+                         const struct sockaddr_in& from_addr,
+                         struct msghdr& m) const;
+
+    /// @brief Prepares the message header for sending the packet.
+    ///
+    /// @param pkt Packet to be sent.
+    /// @param [out] to Destination address.
+    /// @param [out] v Structure pointing to the packet data.
+    /// @param control Buffer for the control message, of the length of
+    /// the @c control_buf_.
+    /// @param [out] m Message header.
+    void prepareSend(const Pkt4Ptr& pkt, sockaddr_in& to, struct iovec& v,
+                     char* control, struct msghdr& m) const;
+
     /// Length of the control_buf_ array.
     size_t control_buf_len_;
     /// Control buffer, used in transmission and reception.
     boost::scoped_array<char> control_buf_;
+
+#if defined (OS_LINUX)
+    /// Buffers of the ring used to receive data.
+    std::vector<uint8_t> ring_buf_;
+    /// Control buffers of the ring used to receive data.
+    std::vector<char> ring_control_;
+    /// Message headers of the ring used to receive data.
+    std::vector<struct mmsghdr> ring_msgs_;
+    /// Sender addresses of the ring used to receive data.
+    std::vector<sockaddr_in> ring_addrs_;
+    /// Data vectors of the ring used to receive data.
+    std::vector<struct iovec> ring_iov_;
+#endif
 };
 
 } // namespace isc::dhcp
@@ -11,6 +11,7 @@
 #include <dhcp/pkt_filter_inet6.h>
 #include <util/io/pktinfo_utilities.h>
 
+#include <algorithm>
 #include <fcntl.h>
 #include <netinet/in.h>
 
@@ -19,9 +20,18 @@ using namespace isc::asiolink;
 namespace isc {
 namespace dhcp {
 
+const size_t PktFilterInet6::RECEIVE_RING_SIZE;
+
 PktFilterInet6::PktFilterInet6()
 : control_buf_len_(CMSG_SPACE(sizeof(struct in6_pktinfo))),
-    control_buf_(new char[control_buf_len_]) {
+    control_buf_(new char[control_buf_len_])
+#if defined (OS_LINUX)
+    , ring_buf_(RECEIVE_RING_SIZE * IfaceMgr::RCVBUFSIZE),
+    ring_control_(RECEIVE_RING_SIZE * control_buf_len_),
+    ring_msgs_(RECEIVE_RING_SIZE), ring_addrs_(RECEIVE_RING_SIZE),
+    ring_iov_(RECEIVE_RING_SIZE)
+#endif
+{
 }
 
 SocketInfo
@@ -167,39 +177,117 @@ PktFilterInet6::receive(const SocketInfo& socket_info) {
     m.msg_controllen = control_buf_len_;
 
     int result = recvmsg(socket_info.sockfd_, &m, 0);
+    if (result < 0) {
+        isc_throw(SocketReadError, "failed to receive data");
+    }
+
+    return (createPacket(socket_info, buf, result, from, m));
+}
+
+#if defined (OS_LINUX)
+size_t
+PktFilterInet6::receiveBatch(const SocketInfo& socket_info,
+                             const size_t max_packets,
+                             std::vector<Pkt6Ptr>& pkts) {
+    const size_t count = std::min(max_packets, RECEIVE_RING_SIZE);
+    if (count == 0) {
+        return (0);
+    }
+
+    // Point the message headers to the buffers of the ring. The buffers
+    // are reused for each batch, so nothing is allocated here.
+    memset(&ring_control_[0], 0, count * control_buf_len_);
+    for (size_t i = 0; i < count; ++i) {
+        struct msghdr& m = ring_msgs_[i].msg_hdr;
+        memset(&m, 0, sizeof(m));
+        memset(&ring_addrs_[i], 0, sizeof(ring_addrs_[i]));
+        m.msg_name = &ring_addrs_[i];
+        m.msg_namelen = sizeof(ring_addrs_[i]);
+        ring_iov_[i].iov_base = &ring_buf_[i * IfaceMgr::RCVBUFSIZE];
+        ring_iov_[i].iov_len = IfaceMgr::RCVBUFSIZE;
+        m.msg_iov = &ring_iov_[i];
+        m.msg_iovlen = 1;
+        m.msg_control = &ring_control_[i * control_buf_len_];
+        m.msg_controllen = control_buf_len_;
+        ring_msgs_[i].msg_len = 0;
+    }
+
+    // The socket is known to have data, so the first datagram is received
+    // immediately. Don't wait for the remaining ones.
+    int result = recvmmsg(socket_info.sockfd_, &ring_msgs_[0], count,
+                          MSG_DONTWAIT, NULL);
+    if (result < 0) {
+        if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+            return (0);
+        }
+        isc_throw(SocketReadError, "failed to receive data: "
+                  << strerror(errno));
+    }
+
+    // A malformed datagram must not cause the loss of the other datagrams
+    // received in the batch, so it is dropped. The error is only reported
+    // if no message has been received.
+    size_t received = 0;
+    std::string error;
+    for (int i = 0; i < result; ++i) {
+        try {
+            Pkt6Ptr pkt = createPacket(socket_info,
+                                       &ring_buf_[i * IfaceMgr::RCVBUFSIZE],
+                                       ring_msgs_[i].msg_len, ring_addrs_[i],
+                                       ring_msgs_[i].msg_hdr);
+            // The message sent to the global unicast address over the
+            // multicast socket is dropped.
+            if (pkt) {
+                pkts.push_back(pkt);
+                ++received;
+            }
+
+        } catch (const std::exception& ex) {
+            if (error.empty()) {
+                error = ex.what();
+            }
+        }
+    }
+
+    if ((received == 0) && !error.empty()) {
+        isc_throw(SocketReadError, error);
+    }
 
+    return (received);
+}
+#endif
+
+Pkt6Ptr
+PktFilterInet6::createPacket(const SocketInfo& socket_info,
+                             const uint8_t* buf, const size_t result,
+                             const struct sockaddr_in6& from,
+                             struct msghdr& m) const {
     struct in6_addr to_addr;
     memset(&to_addr, 0, sizeof(to_addr));
 
     int ifindex = -1;
-    if (result >= 0) {
-        struct in6_pktinfo* pktinfo = NULL;
-
-
-        // If we did read successfully, then we need to loop
-        // through the control messages we received and
-        // find the one with our destination address.
-        //
-        // We also keep a flag to see if we found it. If we
-        // didn't, then we consider this to be an error.
-        bool found_pktinfo = false;
-        struct cmsghdr* cmsg = CMSG_FIRSTHDR(&m);
-        while (cmsg != NULL) {
-            if ((cmsg->cmsg_level == IPPROTO_IPV6) &&
-                (cmsg->cmsg_type == IPV6_PKTINFO)) {
-                pktinfo = util::io::internal::convertPktInfo6(CMSG_DATA(cmsg));
-                to_addr = pktinfo->ipi6_addr;
-                ifindex = pktinfo->ipi6_ifindex;
-                found_pktinfo = true;
-                break;
-            }
-            cmsg = CMSG_NXTHDR(&m, cmsg);
-        }
-        if (!found_pktinfo) {
-            isc_throw(SocketReadError, "unable to find pktinfo");
+    struct in6_pktinfo* pktinfo = NULL;
+
+    // We need to loop through the control messages we received and
+    // find the one with our destination address.
+    //
+    // We also keep a flag to see if we found it. If we
+    // didn't, then we consider this to be an error.
+    bool found_pktinfo = false;
+    struct cmsghdr* cmsg = CMSG_FIRSTHDR(&m);
+    while (cmsg != NULL) {
+        if ((cmsg->cmsg_level == IPPROTO_IPV6) &&
+            (cmsg->cmsg_type == IPV6_PKTINFO)) {
+            pktinfo = util::io::internal::convertPktInfo6(CMSG_DATA(cmsg));
+            to_addr = pktinfo->ipi6_addr;
+            ifindex = pktinfo->ipi6_ifindex;
+            found_pktinfo = true;
+            break;
         }
-    } else {
-        isc_throw(SocketReadError, "failed to receive data");
+        cmsg = CMSG_NXTHDR(&m, cmsg);
+    }
+    if (!found_pktinfo) {
+        isc_throw(SocketReadError, "unable to find pktinfo");
     }
 
     // Filter out packets sent to global unicast address (not link local and
@@ -247,8 +335,64 @@ PktFilterInet6::send(const Iface&, uint16_t sockfd, const Pkt6Ptr& pkt) {
 
     memset(&control_buf_[0], 0, control_buf_len_);
 
-    // Set the target address we're sending to.
     sockaddr_in6 to;
+    struct iovec v;
+    struct msghdr m;
+    prepareSend(pkt, to, v, &control_buf_[0], m);
+
+    pkt->updateTimestamp();
+
+    int result = sendmsg(sockfd, &m, 0);
+    if  (result < 0) {
+        isc_throw(SocketWriteError, "pkt6 send failed: sendmsg() returned"
+                  " with an error: " << strerror(errno));
+    }
+
+    return (result);
+}
+
+#if defined (OS_LINUX)
+size_t
+PktFilterInet6::sendBatch(const Iface&, uint16_t sockfd,
+                          const std::vector<Pkt6Ptr>& pkts) {
+    if (pkts.empty()) {
+        return (0);
+    }
+
+    // The messages may be sent from many threads, so the buffers are not
+    // shared with other calls.
+    std::vector<struct mmsghdr> msgs(pkts.size());
+    std::vector<sockaddr_in6> to(pkts.size());
+    std::vector<struct iovec> v(pkts.size());
+    std::vector<char> control(pkts.size() * control_buf_len_, 0);
+    for (size_t i = 0; i < pkts.size(); ++i) {
+        prepareSend(pkts[i], to[i], v[i], &control[i * control_buf_len_],
+                    msgs[i].msg_hdr);
+        msgs[i].msg_len = 0;
+        pkts[i]->updateTimestamp();
+    }
+
+    // The kernel may send fewer messages than requested, so the remaining
+    // ones are sent with the next call.
+    size_t sent = 0;
+    while (sent < pkts.size()) {
+        int result = sendmmsg(sockfd, &msgs[sent], pkts.size() - sent, 0);
+        if (result < 0) {
+            isc_throw(SocketWriteError, "pkt6 send failed: sendmmsg() returned"
+                      " with an error: " << strerror(errno));
+        }
+        sent += result;
+    }
+
+    return (sent);
+}
+#endif
+
+void
+PktFilterInet6::prepareSend(const Pkt6Ptr& pkt, sockaddr_in6& to,
+                            struct iovec& v, char* control,
+                            struct msghdr& m) const {
+    // Set the target address we're sending to.
     memset(&to, 0, sizeof(to));
     to.sin6_family = AF_INET6;
     to.sin6_port = htons(pkt->getRemotePort());
@@ -258,7 +402,6 @@ PktFilterInet6::send(const Iface&, uint16_t sockfd, const Pkt6Ptr& pkt) {
     to.sin6_scope_id = pkt->getIndex();
 
     // Initialize our message header structure.
-    struct msghdr m;
     memset(&m, 0, sizeof(m));
     m.msg_name = &to;
     m.msg_namelen = sizeof(to);
@@ -274,7 +417,6 @@ PktFilterInet6::send(const Iface&, uint16_t sockfd, const Pkt6Ptr& pkt) {
     // (defined as void*) we must use const cast from void *.
     // Otherwise C++ compiler would complain that we are trying
     // to assign const void* to void*.
-    struct iovec v;
     memset(&v, 0, sizeof(v));
     v.iov_base = const_cast<void *>(pkt->getBuffer().getData());
     v.iov_len = pkt->getBuffer().getLength();
@@ -287,7 +429,7 @@ PktFilterInet6::send(const Iface&, uint16_t sockfd, const Pkt6Ptr& pkt) {
     // define the IPv6 packet information. We could set the
     // source address if we wanted, but we can safely let the
     // kernel decide what that should be.
-    m.msg_control = &control_buf_[0];
+    m.msg_control = control;
     m.msg_controllen = control_buf_len_;
     struct cmsghdr *cmsg = CMSG_FIRSTHDR(&m);
 
@@ -313,18 +455,7 @@ PktFilterInet6::send(const Iface&, uint16_t sockfd, const Pkt6Ptr& pkt) {
     // which causes sendmsg to return EINVAL if the CMSG_LEN is
     // used to set the msg_controllen value.
     m.msg_controllen = CMSG_SPACE(sizeof(struct in6_pktinfo));
-
-    pkt->updateTimestamp();
-
-    int result = sendmsg(sockfd, &m, 0);
-    if  (result < 0) {
-        isc_throw(SocketWriteError, "pkt6 send failed: sendmsg() returned"
-                  " with an error: " << strerror(errno));
-    }
-
-    return (result);
 }
 
-
 }
 }
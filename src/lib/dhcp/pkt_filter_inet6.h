@@ -9,6 +9,9 @@
 
 #include <dhcp/pkt_filter6.h>
 #include <boost/scoped_array.hpp>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <vector>
 
 namespace isc {
 namespace dhcp {
@@ -18,9 +21,16 @@ namespace dhcp {
 /// This class opens a datagram IPv6/UDPv6 socket. It also implements functions
 /// to send and receive DHCPv6 messages through this socket. It is a default
 /// class to be used by @c IfaceMgr to access IPv6 sockets.
+///
+/// On Linux, the messages are received in batches using the recvmmsg
+/// system call into a ring of buffers allocated once by the constructor,
+/// and sent in batches using the sendmmsg system call.
 class PktFilterInet6 : public PktFilter6 {
 public:
 
+    /// @brief Maximum number of messages received with a single system call.
+    static const size_t RECEIVE_RING_SIZE = 32;
+
     /// @brief Constructor.
     ///
     /// Initializes a control buffer used in the message transmission.
@@ -83,11 +93,86 @@ public:
     virtual int send(const Iface& iface, uint16_t sockfd,
                      const Pkt6Ptr& pkt);
 
+#if defined (OS_LINUX)
+    /// @brief Receives DHCPv6 messages available on the specified socket.
+    ///
+    /// Up to @c RECEIVE_RING_SIZE messages are received using a single
+    /// recvmmsg call, which doesn't block waiting for more messages. The
+    /// messages are filtered as in @c receive. The malformed messages are
+    /// dropped, unless no message is received.
+    ///
+    /// @param socket_info A structure holding socket information.
+    /// @param max_packets Maximum number of messages to be received.
+    /// @param [out] pkts Container to which the received messages are
+    /// appended.
+    ///
+    /// @return Number of messages appended to the container.
+    /// @throw isc::dhcp::SocketReadError if error occurred during reception
+    /// of the messages or none of the messages can be parsed.
+    virtual size_t receiveBatch(const SocketInfo& socket_info,
+                                const size_t max_packets,
+                                std::vector<Pkt6Ptr>& pkts);
+
+    /// @brief Sends DHCPv6 messages through a specified interface and socket.
+    ///
+    /// The messages are sent using the sendmmsg call.
+    ///
+    /// @param iface Interface to be used to send messages.
+    /// @param sockfd A socket descriptor.
+    /// @param pkts Messages to be sent.
+    ///
+    /// @return Number of messages sent.
+    /// @throw isc::dhcp::SocketWriteError if error occurred when sending
+    /// the messages.
+    virtual size_t sendBatch(const Iface& iface, uint16_t sockfd,
+                             const std::vector<Pkt6Ptr>& pkts);
+#endif
+
 private:
+
+    /// @brief Creates the message from the received datagram.
+    ///
+    /// @param socket_info A structure holding socket information.
+    /// @param buf Buffer holding the datagram.
+    /// @param result Length of the datagram.
+    /// @param from Address of the sender.
+    /// @param m Message header holding the control messages.
+    ///
+    /// @return Received message or null pointer if the message has been
+    /// filtered out.
+    /// @throw isc::dhcp::SocketReadError if the message can't be created.
+    Pkt6Ptr createPacket(const SocketInfo& socket_info, const uint8_t* buf,
+                         const size_t result, const struct sockaddr_in6& from,
+                         struct msghdr& m) const;
+
+    /// @brief Prepares the message header for sending the message.
+    ///
+    /// @param pkt Message to be sent.
+    /// @param [out] to Destination address.
+    /// @param [out] v Structure pointing to the message data.
+    /// @param control Buffer for the control message, of the length of
+    /// the @c control_buf_.
+    /// @param [out] m Message header.
+    void prepareSend(const Pkt6Ptr& pkt, sockaddr_in6& to, struct iovec& v,
+                     char* control, struct msghdr& m) const;
+
     /// Length of the control_buf_ array.
     size_t control_buf_len_;
     /// Control buffer, used in transmission and reception.
     boost::scoped_array<char> control_buf_;
+
+#if defined (OS_LINUX)
+    /// Buffers of the ring used to receive data.
+    std::vector<uint8_t> ring_buf_;
+    /// Control buffers of the ring used to receive data.
+    std::vector<char> ring_control_;
+    /// Message headers of the ring used to receive data.
+    std::vector<struct mmsghdr> ring_msgs_;
+    /// Sender addresses of the ring used to receive data.
+    std::vector<sockaddr_in6> ring_addrs_;
+    /// Data vectors of the ring used to receive data.
+    std::vector<struct iovec> ring_iov_;
+#endif
 };
 
 } // namespace isc::dhcp
@@ -0,0 +1,125 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <dhcp/socket_poller.h>
+#include <exceptions/exceptions.h>
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <unistd.h>
+
+namespace isc {
+namespace dhcp {
+
+#if defined (OS_LINUX)
+
+SocketPoller::SocketPoller()
+    : fd_(epoll_create1(EPOLL_CLOEXEC)), size_(0), events_() {
+    if (fd_ < 0) {
+        isc_throw(Unexpected, "failed to create epoll descriptor: "
+                  << strerror(errno));
+    }
+}
+
+SocketPoller::~SocketPoller() {
+    close(fd_);
+}
+
+bool
+SocketPoller::isSupported() {
+    return (true);
+}
+
+bool
+SocketPoller::add(const int fd, const uint32_t key) {
+    struct epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN;
+    event.data.u32 = key;
+    if (epoll_ctl(fd_, EPOLL_CTL_ADD, fd, &event) != 0) {
+        return (false);
+    }
+    ++size_;
+    events_.resize(size_);
+    return (true);
+}
+
+void
+SocketPoller::clear() {
+    // Closing the descriptor is simpler than removing each socket, which
+    // may already be closed.
+    int fd = epoll_create1(EPOLL_CLOEXEC);
+    if (fd < 0) {
+        isc_throw(Unexpected, "failed to create epoll descriptor: "
+                  << strerror(errno));
+    }
+    close(fd_);
+    fd_ = fd;
+    size_ = 0;
+    events_.clear();
+}
+
+int
+SocketPoller::wait(const uint32_t timeout_sec, const uint32_t timeout_usec,
+                   std::vector<uint32_t>& ready) {
+    ready.clear();
+
+    // The epoll timeout is expressed in milliseconds.
+    const uint64_t timeout = static_cast<uint64_t>(timeout_sec) * 1000 +
+        (timeout_usec + 999) / 1000;
+    const int timeout_ms = static_cast<int>(std::min(timeout,
+        static_cast<uint64_t>(INT_MAX)));
+
+    if (events_.empty()) {
+        // Nothing to wait for, but the timeout must be honored.
+        struct epoll_event event;
+        return (epoll_wait(fd_, &event, 1, timeout_ms));
+    }
+
+    int result = epoll_wait(fd_, &events_[0], events_.size(), timeout_ms);
+    for (int i = 0; i < result; ++i) {
+        ready.push_back(events_[i].data.u32);
+    }
+    std::sort(ready.begin(), ready.end());
+    return (result);
+}
+
+#else
+
+SocketPoller::SocketPoller()
+    : fd_(-1), size_(0) {
+}
+
+SocketPoller::~SocketPoller() {
+}
+
+bool
+SocketPoller::isSupported() {
+    return (false);
+}
+
+bool
+SocketPoller::add(const int, const uint32_t) {
+    return (false);
+}
+
+void
+SocketPoller::clear() {
+    size_ = 0;
+}
+
+int
+SocketPoller::wait(const uint32_t, const uint32_t,
+                   std::vector<uint32_t>&) {
+    isc_throw(NotImplemented, "socket poller is not supported on this system");
+}
+
+#endif
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
@@ -0,0 +1,91 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef SOCKET_POLLER_H
+#define SOCKET_POLLER_H
+
+#include <boost/noncopyable.hpp>
+#include <stdint.h>
+#include <vector>
+
+#if defined (OS_LINUX)
+#include <sys/epoll.h>
+#endif
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Waits for data on a set of sockets.
+///
+/// The sockets are registered once and the same set is used by all
+/// subsequent waits, so, unlike with select(), the set of sockets doesn't
+/// have to be rebuilt and scanned on each wait. Each socket is registered
+/// with a key, which is returned when the socket has data to read.
+///
+/// On Linux this class uses epoll. On other systems @c isSupported returns
+/// false and the caller is expected to use select() instead.
+class SocketPoller : public boost::noncopyable {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @throw isc::Unexpected if the poller can't be created.
+    SocketPoller();
+
+    /// @brief Destructor.
+    ~SocketPoller();
+
+    /// @brief Checks if the poller is supported on this system.
+    static bool isSupported();
+
+    /// @brief Registers the socket.
+    ///
+    /// @param fd Socket descriptor.
+    /// @param key Key returned by @c wait when the socket has data.
+    ///
+    /// @return true if the socket has been registered, false if it can't
+    /// be watched by the poller, e.g. because it is a regular file.
+    bool add(const int fd, const uint32_t key);
+
+    /// @brief Unregisters all sockets.
+    void clear();
+
+    /// @brief Returns the number of registered sockets.
+    size_t size() const {
+        return (size_);
+    }
+
+    /// @brief Waits for data on the registered sockets.
+    ///
+    /// @param timeout_sec Integral part of the timeout (in seconds).
+    /// @param timeout_usec Fractional part of the timeout (in microseconds).
+    /// It is rounded up to milliseconds.
+    /// @param [out] ready Keys of the sockets having data to read, in the
+    /// ascending order.
+    ///
+    /// @return Number of sockets having data, 0 on timeout or -1 on error,
+    /// in which case errno is set.
+    int wait(const uint32_t timeout_sec, const uint32_t timeout_usec,
+             std::vector<uint32_t>& ready);
+
+private:
+
+    /// @brief Poller descriptor.
+    int fd_;
+
+    /// @brief Number of registered sockets.
+    size_t size_;
+
+#if defined (OS_LINUX)
+    /// @brief Buffer for the events returned by the poller.
+    std::vector<struct epoll_event> events_;
+#endif
+};
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
+
+#endif // SOCKET_POLLER_H
@@ -1235,6 +1235,59 @@ TEST_F(IfaceMgrTest, sendReceive4) {
     EXPECT_THROW(ifacemgr->send(sendPkt), SocketWriteError);
 }
 
+// Verifies that many DHCPv4 packets can be sent at once and that the
+// packets received together are returned one by one.
+TEST_F(IfaceMgrTest, sendReceiveBatch4) {
+    scoped_ptr<NakedIfaceMgr> ifacemgr(new NakedIfaceMgr());
+
+    IOAddress loAddr("127.0.0.1");
+    int socket1 = 0;
+    ASSERT_NO_THROW(
+        socket1 = ifacemgr->openSocket(LOOPBACK, loAddr, DHCP4_SERVER_PORT + 10000);
+    );
+    ASSERT_GE(socket1, 0);
+
+    // The number of packets received at once must be positive.
+    EXPECT_THROW(ifacemgr->setReceiveBatchSize(0), isc::BadValue);
+    ASSERT_NO_THROW(ifacemgr->setReceiveBatchSize(2));
+    EXPECT_EQ(2, ifacemgr->getReceiveBatchSize());
+
+    // Send three packets having distinct transaction ids.
+    std::vector<Pkt4Ptr> sent;
+    for (uint32_t transid = 1; transid <= 3; ++transid) {
+        Pkt4Ptr pkt(new Pkt4(DHCPDISCOVER, transid));
+        pkt->setLocalAddr(loAddr);
+        pkt->setLocalPort(DHCP4_SERVER_PORT + 10000 + 1);
+        pkt->setRemotePort(DHCP4_SERVER_PORT + 10000);
+        pkt->setRemoteAddr(loAddr);
+        pkt->setIface(string(LOOPBACK));
+        ASSERT_NO_THROW(pkt->pack());
+        sent.push_back(pkt);
+    }
+    ASSERT_EQ(3, ifacemgr->sendBatch(sent));
+
+    // The packets are received in the order in which they have been sent.
+    // The second packet is queued when the first one is returned.
+    for (uint32_t transid = 1; transid <= 3; ++transid) {
+        Pkt4Ptr rcvd;
+        ASSERT_NO_THROW(rcvd = ifacemgr->receive4(10));
+        ASSERT_TRUE(rcvd);
+        EXPECT_EQ(transid == 1, ifacemgr->hasReceived4());
+        ASSERT_NO_THROW(rcvd->unpack());
+        EXPECT_EQ(transid, rcvd->getTransid());
+        EXPECT_EQ(LOOPBACK, rcvd->getIface());
+    }
+
+    // Nothing more to receive.
+    Pkt4Ptr rcvd;
+    ASSERT_NO_THROW(rcvd = ifacemgr->receive4(0, 1000));
+    EXPECT_FALSE(rcvd);
+
+    // Sending over the unknown interface is rejected.
+    sent[0]->setIface("unknown");
+    EXPECT_THROW(ifacemgr->sendBatch(sent), isc::BadValue);
+}
+
 // Verifies that it is possible to set custom packet filter object
 // to handle sockets opening and send/receive operation.
 TEST_F(IfaceMgrTest, setPacketFilter) {
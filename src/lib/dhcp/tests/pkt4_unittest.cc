@@ -674,6 +674,107 @@ TEST_F(Pkt4Test, unpackOptions) {
     verifyParsedOptions(pkt);
 }
 
+// This test verifies that the options are unpacked when retrieved if the
+// lazy unpacking is enabled.
+TEST_F(Pkt4Test, unpackOptionsLazy) {
+
+    vector<uint8_t> expectedFormat = generateTestPacket2();
+
+    expectedFormat.push_back(0x63);
+    expectedFormat.push_back(0x82);
+    expectedFormat.push_back(0x53);
+    expectedFormat.push_back(0x63);
+
+    for (size_t i = 0; i < sizeof(v4_opts); i++) {
+        expectedFormat.push_back(v4_opts[i]);
+    }
+
+    Pkt4Ptr pkt(new Pkt4(&expectedFormat[0], expectedFormat.size()));
+    pkt->setLazyUnpack(true);
+    ASSERT_NO_THROW(pkt->unpack());
+
+    // Options are only located, except the message type. The option 254
+    // is deferred.
+    EXPECT_EQ(1, pkt->options_.size());
+    EXPECT_EQ(5, pkt->getPendingOptionsCount());
+    ASSERT_EQ(1, pkt->getDeferredOptions().size());
+    EXPECT_EQ(254, pkt->getDeferredOptions().front());
+
+    // Retrieving an option unpacks it.
+    OptionPtr x = pkt->getOption(12);
+    ASSERT_TRUE(x);
+    EXPECT_TRUE(boost::dynamic_pointer_cast<OptionString>(x));
+    EXPECT_EQ(2, pkt->options_.size());
+    EXPECT_EQ(4, pkt->getPendingOptionsCount());
+    EXPECT_FALSE(pkt->getOption(DHO_ROUTERS));
+
+    verifyParsedOptions(pkt);
+
+    // Packing unpacks all options and generates the received options.
+    ASSERT_NO_THROW(pkt->pack());
+    EXPECT_EQ(0, pkt->getPendingOptionsCount());
+    EXPECT_EQ(6, pkt->options_.size());
+    ASSERT_EQ(expectedFormat.size() + 1, pkt->getBuffer().getLength());
+    EXPECT_EQ(0, memcmp(&expectedFormat[0], pkt->getBuffer().getData(),
+                        expectedFormat.size()));
+}
+
+// Checks that a malformed option is reported when retrieved if the lazy
+// unpacking is enabled.
+TEST_F(Pkt4Test, unpackMalformedLazy) {
+
+    vector<uint8_t> orig = generateTestPacket2();
+
+    orig.push_back(0x63);
+    orig.push_back(0x82);
+    orig.push_back(0x53);
+    orig.push_back(0x63);
+
+    orig.push_back(53); // Message Type
+    orig.push_back(1); // length=1
+    orig.push_back(2); // type=2
+
+    orig.push_back(125); // vivso suboptions
+    orig.push_back(6); // length=6 (too short)
+    orig.push_back(1); // vendor_id=0x1020304
+    orig.push_back(2);
+    orig.push_back(3);
+    orig.push_back(4);
+    orig.push_back(10); // data-len=10
+    orig.push_back(128); // suboption type=128
+
+    orig.push_back(12); // Hostname
+    orig.push_back(3); // length=3
+    orig.push_back(102); // data="foo"
+    orig.push_back(111);
+    orig.push_back(111);
+
+    Pkt4Ptr pkt(new Pkt4(&orig[0], orig.size()));
+    pkt->setLazyUnpack(true);
+    EXPECT_NO_THROW(pkt->unpack());
+
+    // The message type is always unpacked.
+    EXPECT_EQ(DHCPOFFER, pkt->getType());
+    EXPECT_EQ(2, pkt->getPendingOptionsCount());
+
+    // The other options are unpacked when retrieved.
+    EXPECT_TRUE(pkt->getOption(12));
+    EXPECT_THROW(pkt->getOption(125), LazyUnpackError);
+    EXPECT_EQ(1, pkt->getPendingOptionsCount());
+    EXPECT_THROW(pkt->unpackPendingOptions(), LazyUnpackError);
+
+    // The conversion to text doesn't throw.
+    std::string text;
+    EXPECT_NO_THROW(text = pkt->toText());
+    EXPECT_NE(std::string::npos, text.find("options not unpacked"));
+
+    // A malformed message type makes unpack() fail.
+    orig[Pkt4::DHCPV4_PKT_HDR_LEN + 5] = 0;
+    Pkt4Ptr bad_type(new Pkt4(&orig[0], orig.size()));
+    bad_type->setLazyUnpack(true);
+    EXPECT_THROW(bad_type->unpack(), Exception);
+}
+
 // Checks if the code is able to handle a malformed option
 TEST_F(Pkt4Test, unpackMalformed) {
 
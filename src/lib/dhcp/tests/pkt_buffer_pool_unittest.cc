@@ -0,0 +1,201 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <dhcp/dhcp6.h>
+#include <dhcp/pkt4.h>
+#include <dhcp/pkt6.h>
+#include <dhcp/pkt_buffer_pool.h>
+#include <util/threads/thread.h>
+
+#include <boost/bind.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+using namespace isc::dhcp;
+using namespace isc::util;
+using namespace isc::util::thread;
+
+namespace {
+
+/// @brief Test fixture class for @c PktBufferPool.
+///
+/// It empties the pool used by the packets before and after each test.
+class PktBufferPoolTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    PktBufferPoolTest() {
+        PktBufferPool::instance().clear();
+    }
+
+    /// @brief Destructor.
+    virtual ~PktBufferPoolTest() {
+        PktBufferPool::instance().clear();
+    }
+};
+
+// This test verifies that the released data buffers are handed to the
+// subsequent callers without allocating new memory.
+TEST_F(PktBufferPoolTest, data) {
+    PktBufferPool pool(2);
+    EXPECT_EQ(2, pool.getMaxBuffers());
+
+    // Nothing pooled yet.
+    OptionBuffer data;
+    pool.acquire(data);
+    EXPECT_EQ(0, data.capacity());
+
+    // Empty buffers are not pooled.
+    pool.release(data);
+    EXPECT_EQ(0, pool.getDataCount());
+
+    data.resize(300);
+    const uint8_t* memory = &data[0];
+    pool.release(data);
+    EXPECT_EQ(1, pool.getDataCount());
+    EXPECT_EQ(0, data.capacity());
+
+    // The same memory is returned.
+    OptionBuffer other;
+    pool.acquire(other);
+    EXPECT_EQ(0, pool.getDataCount());
+    EXPECT_TRUE(other.empty());
+    ASSERT_GE(other.capacity(), 300);
+    other.resize(300);
+    EXPECT_EQ(memory, &other[0]);
+}
+
+// This test verifies that the released output buffers are handed to the
+// subsequent callers without allocating new memory.
+TEST_F(PktBufferPoolTest, output) {
+    PktBufferPool pool(2);
+
+    OutputBuffer buffer(0);
+    buffer.writeUint32(1);
+    const void* memory = buffer.getData();
+    pool.release(buffer);
+    EXPECT_EQ(1, pool.getOutputCount());
+    EXPECT_EQ(0, buffer.getCapacity());
+
+    OutputBuffer other(0);
+    pool.acquire(other);
+    EXPECT_EQ(0, pool.getOutputCount());
+    EXPECT_EQ(0, other.getLength());
+    EXPECT_EQ(memory, other.getData());
+}
+
+// This test verifies that the number of pooled buffers is limited.
+TEST_F(PktBufferPoolTest, maxBuffers) {
+    PktBufferPool pool(2);
+    for (int i = 0; i < 3; ++i) {
+        OptionBuffer data(10);
+        pool.release(data);
+        OutputBuffer buffer(10);
+        pool.release(buffer);
+    }
+    EXPECT_EQ(2, pool.getDataCount());
+    EXPECT_EQ(2, pool.getOutputCount());
+
+    // The buffers larger than the limit are not pooled.
+    pool.clear();
+    OptionBuffer data(PktBufferPool::MAX_BUFFER_CAPACITY + 1);
+    pool.release(data);
+    EXPECT_EQ(0, pool.getDataCount());
+
+    // Reducing the limit frees the excess buffers.
+    OptionBuffer data2(10);
+    pool.release(data2);
+    pool.setMaxBuffers(0);
+    EXPECT_EQ(0, pool.getDataCount());
+
+    // The pool is disabled.
+    OptionBuffer data3(10);
+    pool.release(data3);
+    EXPECT_EQ(0, pool.getDataCount());
+}
+
+/// @brief Releases data buffers to the pool.
+///
+/// @param pool Pool.
+/// @param memory Memory of the released buffers.
+void
+releaseData(PktBufferPool& pool, std::vector<const uint8_t*>& memory) {
+    for (int i = 0; i < 3; ++i) {
+        OptionBuffer data(10);
+        memory.push_back(&data[0]);
+        pool.release(data);
+    }
+}
+
+// This test verifies that the buffers released by a thread are handed to
+// another thread.
+TEST_F(PktBufferPoolTest, threads) {
+    PktBufferPool pool(4);
+
+    // The buffers are pooled by a thread other than the one acquiring them.
+    std::vector<const uint8_t*> memory;
+    Thread thread(boost::bind(&releaseData, boost::ref(pool),
+                              boost::ref(memory)));
+    thread.wait();
+    EXPECT_EQ(3, pool.getDataCount());
+
+    // All of them are acquired by this thread.
+    for (int i = 0; i < 3; ++i) {
+        OptionBuffer data;
+        pool.acquire(data);
+        ASSERT_GE(data.capacity(), 10);
+        data.resize(10);
+        EXPECT_TRUE(std::find(memory.begin(), memory.end(), &data[0]) !=
+                    memory.end());
+    }
+    EXPECT_EQ(0, pool.getDataCount());
+
+    // Nothing is left.
+    OptionBuffer data;
+    pool.acquire(data);
+    EXPECT_EQ(0, data.capacity());
+}
+
+// This test verifies that the packets return their buffers to the pool
+// when destroyed and use the pooled buffers when created.
+TEST_F(PktBufferPoolTest, packets) {
+    PktBufferPool& pool = PktBufferPool::instance();
+
+    // Receive a packet and destroy it.
+    std::vector<uint8_t> wire(Pkt4::DHCPV4_PKT_HDR_LEN + 4, 0);
+    const uint8_t* memory = 0;
+    {
+        Pkt4 query(&wire[0], wire.size());
+        memory = &query.data_[0];
+    }
+    EXPECT_EQ(1, pool.getDataCount());
+
+    // The next received packet uses the same buffer.
+    {
+        Pkt4 query(&wire[0], wire.size());
+        EXPECT_EQ(0, pool.getDataCount());
+        EXPECT_EQ(memory, &query.data_[0]);
+    }
+
+    // Pack a response and destroy it.
+    const void* out_memory = 0;
+    {
+        Pkt6 response(DHCPV6_REPLY, 1234);
+        ASSERT_NO_THROW(response.pack());
+        out_memory = response.getBuffer().getData();
+    }
+    EXPECT_EQ(1, pool.getOutputCount());
+
+    // The next response uses the same output buffer.
+    Pkt6 response(DHCPV6_REPLY, 1234);
+    EXPECT_EQ(0, pool.getOutputCount());
+    ASSERT_NO_THROW(response.pack());
+    EXPECT_EQ(out_memory, response.getBuffer().getData());
+}
+
+} // end of anonymous namespace
@@ -1,4 +1,4 @@
-// Copyright (C) 2015-2016 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -14,6 +14,7 @@
 #include <gtest/gtest.h>
 
 #include <sys/socket.h>
+#include <vector>
 
 using namespace isc::asiolink;
 using namespace isc::dhcp;
@@ -143,4 +144,40 @@ TEST_F(PktFilterInetTest, receive) {
     testRcvdMessageAddressPort(rcvd_pkt);
 }
 
+// This test verifies that many DHCPv4 packets are sent and received at
+// once and that the number of received packets is limited as requested.
+TEST_F(PktFilterInetTest, sendReceiveBatch) {
+
+    // Packets will be sent and received over loopback interface.
+    Iface iface(ifname_, ifindex_);
+    IOAddress addr("127.0.0.1");
+
+    // Create an instance of the class which we are testing.
+    PktFilterInet pkt_filter;
+    sock_info_ = pkt_filter.openSocket(iface, addr, PORT, false, false);
+    ASSERT_GE(sock_info_.sockfd_, 0);
+
+    // Send the same message three times.
+    std::vector<Pkt4Ptr> sent(3, test_message_);
+    ASSERT_EQ(3, pkt_filter.sendBatch(iface, sock_info_.sockfd_, sent));
+
+    // Receive at most two packets.
+    std::vector<Pkt4Ptr> rcvd;
+    ASSERT_EQ(2, pkt_filter.receiveBatch(iface, sock_info_, 2, rcvd));
+    ASSERT_EQ(2, rcvd.size());
+
+    // The packets are appended to the existing ones.
+    ASSERT_EQ(1, pkt_filter.receiveBatch(iface, sock_info_, 2, rcvd));
+    ASSERT_EQ(3, rcvd.size());
+
+    for (std::vector<Pkt4Ptr>::const_iterator pkt = rcvd.begin();
+         pkt != rcvd.end(); ++pkt) {
+        ASSERT_TRUE(*pkt);
+        ASSERT_NO_THROW((*pkt)->unpack());
+        testRcvdMessage(*pkt);
+        EXPECT_EQ(PORT, (*pkt)->getLocalPort());
+        EXPECT_EQ(iface.getName(), (*pkt)->getIface());
+    }
+}
+
 } // anonymous namespace
@@ -0,0 +1,117 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <dhcp/socket_poller.h>
+
+#include <gtest/gtest.h>
+
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
+
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief Test fixture class for @c SocketPoller.
+///
+/// It creates two pairs of connected sockets, which can be registered
+/// with the poller.
+class SocketPollerTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    SocketPollerTest() {
+        if (socketpair(AF_UNIX, SOCK_DGRAM, 0, pair1_) != 0 ||
+            socketpair(AF_UNIX, SOCK_DGRAM, 0, pair2_) != 0) {
+            ADD_FAILURE() << "unable to create socket pairs";
+        }
+    }
+
+    /// @brief Destructor.
+    ///
+    /// Closes the sockets.
+    virtual ~SocketPollerTest() {
+        close(pair1_[0]);
+        close(pair1_[1]);
+        close(pair2_[0]);
+        close(pair2_[1]);
+    }
+
+    /// @brief Writes one byte to the socket.
+    ///
+    /// @param sock Socket descriptor.
+    void writeByte(const int sock) {
+        const char data = 1;
+        ASSERT_EQ(1, write(sock, &data, 1));
+    }
+
+    /// @brief First pair of sockets.
+    int pair1_[2];
+
+    /// @brief Second pair of sockets.
+    int pair2_[2];
+};
+
+// This test verifies that the poller returns the keys of the sockets
+// having data in the ascending order.
+TEST_F(SocketPollerTest, wait) {
+    if (!SocketPoller::isSupported()) {
+        return;
+    }
+    SocketPoller poller;
+    ASSERT_TRUE(poller.add(pair1_[0], 7));
+    ASSERT_TRUE(poller.add(pair2_[0], 3));
+    EXPECT_EQ(2, poller.size());
+
+    // No data, so the timeout is reached.
+    std::vector<uint32_t> ready;
+    EXPECT_EQ(0, poller.wait(0, 1000, ready));
+    EXPECT_TRUE(ready.empty());
+
+    writeByte(pair1_[1]);
+    ASSERT_EQ(1, poller.wait(1, 0, ready));
+    ASSERT_EQ(1, ready.size());
+    EXPECT_EQ(7, ready[0]);
+
+    writeByte(pair2_[1]);
+    ASSERT_EQ(2, poller.wait(1, 0, ready));
+    ASSERT_EQ(2, ready.size());
+    EXPECT_EQ(3, ready[0]);
+    EXPECT_EQ(7, ready[1]);
+}
+
+// This test verifies that the sockets can be unregistered and that
+// the descriptors which can't be polled are rejected.
+TEST_F(SocketPollerTest, addClear) {
+    if (!SocketPoller::isSupported()) {
+        return;
+    }
+    SocketPoller poller;
+    ASSERT_TRUE(poller.add(pair1_[0], 0));
+    // The same socket can't be registered twice.
+    EXPECT_FALSE(poller.add(pair1_[0], 1));
+    // Invalid descriptor is rejected.
+    EXPECT_FALSE(poller.add(-1, 1));
+    EXPECT_EQ(1, poller.size());
+
+    ASSERT_NO_THROW(poller.clear());
+    EXPECT_EQ(0, poller.size());
+
+    // The data sent over unregistered socket is not reported.
+    writeByte(pair1_[1]);
+    std::vector<uint32_t> ready;
+    EXPECT_EQ(0, poller.wait(0, 1000, ready));
+
+    // The socket can be registered again.
+    ASSERT_TRUE(poller.add(pair1_[0], 5));
+    ASSERT_EQ(1, poller.wait(1, 0, ready));
+    ASSERT_EQ(1, ready.size());
+    EXPECT_EQ(5, ready[0]);
+}
+
+} // end of anonymous namespace
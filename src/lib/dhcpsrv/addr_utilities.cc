@@ -369,5 +369,95 @@ uint64_t prefixesInRange(const uint8_t pool_len, const uint8_t delegated_len) {
     }
 }
 
+isc::asiolink::IOAddress
+offsetAddress(const isc::asiolink::IOAddress& addr, const uint64_t offset,
+              const uint8_t prefix_len) {
+    if (addr.isV4()) {
+        return (IOAddress(static_cast<uint32_t>(addr.toUint32() + offset)));
+    }
+
+    if ((prefix_len < 1) || (prefix_len > 128)) {
+        isc_throw(BadValue, "invalid prefix length " << static_cast<int>(prefix_len)
+                  << " specified for the IPv6 address offset");
+    }
+
+    // The address is held in network byte order. Shift the offset to
+    // the position of the least significant bit of the prefix and add
+    // it to the address byte by byte, starting from the last byte.
+    std::vector<uint8_t> packed = addr.toBytes();
+    const unsigned shift = 128 - prefix_len;
+    int byte = V6ADDRESS_LEN - 1 - static_cast<int>(shift / 8);
+    // The shifted offset may not fit in 64 bits, so keep the bits
+    // shifted out in another word.
+    uint64_t low = offset << (shift % 8);
+    uint64_t high = ((shift % 8) == 0) ? 0 : (offset >> (64 - (shift % 8)));
+    unsigned carry = 0;
+    for (; byte >= 0; --byte) {
+        unsigned sum = packed[byte] + static_cast<unsigned>(low & 0xFF) + carry;
+        packed[byte] = static_cast<uint8_t>(sum & 0xFF);
+        carry = sum >> 8;
+        low = (low >> 8) | (high << 56);
+        high >>= 8;
+        if ((low == 0) && (high == 0) && (carry == 0)) {
+            break;
+        }
+    }
+
+    return (IOAddress::fromBytes(AF_INET6, &packed[0]));
+}
+
+uint64_t
+addressOffset(const isc::asiolink::IOAddress& base,
+              const isc::asiolink::IOAddress& addr,
+              const uint8_t prefix_len) {
+    if (base.getFamily() != addr.getFamily()) {
+        isc_throw(BadValue, "both addresses must belong to the same family");
+    }
+
+    if (addr < base) {
+        isc_throw(BadValue, addr << " is lower than " << base);
+    }
+
+    if (base.isV4()) {
+        return (addr.toUint32() - base.toUint32());
+    }
+
+    if ((prefix_len < 1) || (prefix_len > 128)) {
+        isc_throw(BadValue, "invalid prefix length " << static_cast<int>(prefix_len)
+                  << " specified for the IPv6 address offset");
+    }
+
+    // Subtract the addresses byte by byte and keep the 128 bit result
+    // in two 64 bit words.
+    const std::vector<uint8_t> base_bytes = base.toBytes();
+    const std::vector<uint8_t> addr_bytes = addr.toBytes();
+    uint8_t diff[V6ADDRESS_LEN];
+    int borrow = 0;
+    for (int i = V6ADDRESS_LEN - 1; i >= 0; --i) {
+        int value = static_cast<int>(addr_bytes[i]) - base_bytes[i] - borrow;
+        borrow = (value < 0 ? 1 : 0);
+        diff[i] = static_cast<uint8_t>(value & 0xFF);
+    }
+
+    uint64_t high = 0;
+    uint64_t low = 0;
+    for (int i = 0; i < V6ADDRESS_LEN / 2; ++i) {
+        high = (high << 8) | diff[i];
+        low = (low << 8) | diff[i + V6ADDRESS_LEN / 2];
+    }
+
+    // Convert the number of addresses to the number of prefixes.
+    const unsigned shift = 128 - prefix_len;
+    if (shift >= 64) {
+        low = high >> (shift - 64);
+        high = 0;
+    } else if (shift > 0) {
+        low = (low >> shift) | (high << (64 - shift));
+        high >>= shift;
+    }
+
+    return (high == 0 ? low : std::numeric_limits<uint64_t>::max());
+}
+
 };
 };
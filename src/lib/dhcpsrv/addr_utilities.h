@@ -87,6 +87,42 @@ int prefixLengthFromRange(const isc::asiolink::IOAddress& min,
 /// @param delegated_len length of the prefixes to be delegated from the pool
 /// @return number of prefixes in range
 uint64_t prefixesInRange(const uint8_t pool_len, const uint8_t delegated_len);
+
+/// @brief Returns an address or prefix at the specified offset.
+///
+/// For IPv4 addresses and for IPv6 addresses with the prefix length of
+/// 128 it returns the address incremented by offset. For shorter IPv6
+/// prefix lengths it returns the prefix incremented by offset prefixes
+/// of the given length, e.g. offsetAddress(2001:db8::, 3, 64) returns
+/// 2001:db8:0:3::. The result wraps around at the end of the address
+/// space.
+///
+/// Example: offsetAddress(192.0.2.1, 10) returns 192.0.2.11.
+///
+/// @param addr base address or prefix
+/// @param offset number of addresses or prefixes to be added
+/// @param prefix_len length of the prefixes (IPv6 only)
+/// @return address or prefix at the specified offset
+/// @throw BadValue if the prefix length is invalid
+isc::asiolink::IOAddress offsetAddress(const isc::asiolink::IOAddress& addr,
+                                       const uint64_t offset,
+                                       const uint8_t prefix_len = 128);
+
+/// @brief Returns the offset of an address or prefix from the base address.
+///
+/// This is the reverse of @ref offsetAddress, e.g. addressOffset(2001:db8::,
+/// 2001:db8:0:3::, 64) returns 3. If the offset doesn't fit in 64 bits,
+/// the maximum value of uint64_t is returned.
+///
+/// @param base base address or prefix
+/// @param addr address or prefix, must not be lower than the base
+/// @param prefix_len length of the prefixes (IPv6 only)
+/// @return number of addresses or prefixes between base and addr
+/// @throw BadValue if the address is lower than the base, the addresses
+/// belong to different families or the prefix length is invalid
+uint64_t addressOffset(const isc::asiolink::IOAddress& base,
+                       const isc::asiolink::IOAddress& addr,
+                       const uint8_t prefix_len = 128);
 };
 };
 
@@ -10,6 +10,7 @@
 #include <dhcp/pkt4.h>
 #include <dhcp/pkt6.h>
 #include <dhcp_ddns/ncr_msg.h>
+#include <dhcpsrv/addr_utilities.h>
 #include <dhcpsrv/alloc_engine.h>
 #include <dhcpsrv/alloc_engine_log.h>
 #include <dhcpsrv/cfgmgr.h>
@@ -19,6 +20,7 @@
 #include <dhcpsrv/lease_mgr_factory.h>
 #include <dhcpsrv/ncr_generator.h>
 #include <dhcpsrv/network.h>
+#include <dhcpsrv/processing_latency.h>
 #include <dhcpsrv/shared_network.h>
 #include <hooks/callout_handle.h>
 #include <hooks/hooks_manager.h>
@@ -29,6 +31,7 @@
 #include <hooks/hooks_manager.h>
 
 #include <boost/foreach.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
 
 #include <algorithm>
 #include <cstring>
@@ -44,6 +47,7 @@ using namespace isc::dhcp;
 using namespace isc::dhcp_ddns;
 using namespace isc::hooks;
 using namespace isc::stats;
+using namespace isc::util::thread;
 
 namespace {
 
@@ -79,6 +83,327 @@ struct AllocEngineHooks {
 // module is called.
 AllocEngineHooks Hooks;
 
+/// @brief Returns (a + b) mod m for a, b lower than m.
+uint64_t
+addMod(const uint64_t a, const uint64_t b, const uint64_t m) {
+    return (a >= m - b ? a - (m - b) : a + b);
+}
+
+/// @brief Returns (a * b) mod m for a, b lower than m.
+///
+/// The multiplication is done by doubling and adding, so as the
+/// intermediate results never exceed the modulus.
+uint64_t
+mulMod(uint64_t a, uint64_t b, const uint64_t m) {
+    uint64_t result = 0;
+    while (b > 0) {
+        if (b & 1) {
+            result = addMod(result, a, m);
+        }
+        a = addMod(a, a, m);
+        b >>= 1;
+    }
+    return (result);
+}
+
+/// @brief Returns the greatest common divisor of two numbers.
+uint64_t
+gcd(uint64_t a, uint64_t b) {
+    while (b != 0) {
+        uint64_t tmp = a % b;
+        a = b;
+        b = tmp;
+    }
+    return (a);
+}
+
+/// @brief Returns the smallest stride not lower than the specified value
+/// which is coprime with the capacity.
+///
+/// @param stride initial stride (1 to capacity - 1)
+/// @param capacity number of addresses in the pools (greater than 1)
+uint64_t
+coprimeStride(uint64_t stride, const uint64_t capacity) {
+    while (gcd(stride, capacity) != 1) {
+        if (++stride >= capacity) {
+            stride = 1;
+        }
+    }
+    return (stride);
+}
+
+/// @brief Returns the address (or prefix) with the specified index.
+///
+/// The addresses in the pools are indexed consecutively in the order
+/// in which the pools are configured.
+///
+/// @param pools pools of the subnet (non-empty)
+/// @param index index of the address
+IOAddress
+addressAtIndex(const PoolCollection& pools, uint64_t index) {
+    for (PoolCollection::const_iterator pool = pools.begin();
+         pool != pools.end(); ++pool) {
+        const uint64_t capacity = (*pool)->getCapacity();
+        if (index < capacity) {
+            return ((*pool)->getLeaseAddress(index));
+        }
+        index -= capacity;
+    }
+
+    // The index is bounded by the subnet's pool capacity, so we should
+    // never get here.
+    return (pools[0]->getFirstAddress());
+}
+
+/// @brief Computes a 64-bit FNV-1a hash of the client identifier.
+uint64_t
+hashIdentifier(const DuidPtr& duid) {
+    uint64_t hash = 14695981039346656037ULL;
+    if (duid) {
+        const std::vector<uint8_t>& id = duid->getDuid();
+        for (std::vector<uint8_t>::const_iterator b = id.begin();
+             b != id.end(); ++b) {
+            hash ^= *b;
+            hash *= 1099511628211ULL;
+        }
+    }
+    return (hash);
+}
+
+/// @brief Mixes bits of the hash to derive an independent value.
+uint64_t
+mixHash(uint64_t hash) {
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return (hash);
+}
+
+/// @brief Populates the lease bitmaps of the subnet's pools.
+///
+/// The bitmaps are populated with the leases fetched from the lease
+/// database when they are used for the first time. Expired leases
+/// which haven't been reclaimed are marked as used, because they can't
+/// be allocated before they are reclaimed. If the lease database
+/// backend doesn't support fetching leases by subnet, the bitmaps are
+/// never marked as seeded and the allocation engine doesn't use them.
+///
+/// @param subnet subnet which pools should be seeded
+/// @param type type of the pools
+void
+seedLeaseBitmaps(const SubnetPtr& subnet, const Lease::Type& type) {
+    const PoolCollection& pools = subnet->getPools(type);
+    std::vector<LeaseBitmapPtr> bitmaps;
+    for (PoolCollection::const_iterator pool = pools.begin();
+         pool != pools.end(); ++pool) {
+        const LeaseBitmapPtr& bitmap = (*pool)->getLeaseBitmap();
+        if (bitmap && bitmap->beginSeeding()) {
+            bitmaps.push_back(bitmap);
+        }
+    }
+
+    if (bitmaps.empty()) {
+        return;
+    }
+
+    try {
+        if (type == Lease::TYPE_V4) {
+            Lease4Collection leases =
+                LeaseMgrFactory::instance().getLeases4(subnet->getID());
+            for (Lease4Collection::const_iterator lease = leases.begin();
+                 lease != leases.end(); ++lease) {
+                if (!(*lease)->stateExpiredReclaimed()) {
+                    subnet->markLeaseUsed(type, (*lease)->addr_);
+                }
+            }
+
+        } else {
+            Lease6Collection leases =
+                LeaseMgrFactory::instance().getLeases6(subnet->getID());
+            for (Lease6Collection::const_iterator lease = leases.begin();
+                 lease != leases.end(); ++lease) {
+                if (((*lease)->type_ == type) &&
+                    !(*lease)->stateExpiredReclaimed()) {
+                    subnet->markLeaseUsed(type, (*lease)->addr_);
+                }
+            }
+        }
+
+    } catch (const isc::NotImplemented&) {
+        // The bitmaps will remain unseeded, so they will not be used.
+        LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
+                  ALLOC_ENGINE_LEASE_BITMAP_UNSUPPORTED)
+            .arg(subnet->toText());
+        return;
+
+    } catch (const std::exception& ex) {
+        // Let the next allocation in this subnet try again. Until then
+        // the candidate addresses are checked in the lease database.
+        LOG_WARN(alloc_engine_logger, ALLOC_ENGINE_LEASE_BITMAP_SEED_FAILED)
+            .arg(subnet->toText()).arg(ex.what());
+        for (std::vector<LeaseBitmapPtr>::const_iterator bitmap =
+                 bitmaps.begin(); bitmap != bitmaps.end(); ++bitmap) {
+            (*bitmap)->abortSeeding();
+        }
+        return;
+    }
+
+    for (std::vector<LeaseBitmapPtr>::const_iterator bitmap = bitmaps.begin();
+         bitmap != bitmaps.end(); ++bitmap) {
+        (*bitmap)->endSeeding();
+    }
+}
+
+/// @brief Replaces the candidate address with a free address found in the
+/// lease bitmaps.
+///
+/// The search starts at the candidate address returned by the allocator
+/// and continues over the following pools of the subnet, wrapping around
+/// to the first pool. If the candidate doesn't belong to a pool with a
+/// seeded bitmap, or all addresses in the bitmaps are used, the candidate
+/// is left unchanged and the caller checks it against the lease database
+/// as usual. The latter allows for reusing expired leases which haven't
+/// been reclaimed yet.
+///
+/// @param subnet subnet from which the address is allocated
+/// @param type type of the lease
+/// @param [in,out] candidate candidate address or prefix
+/// @return true if the candidate has been found in the lease bitmaps.
+bool
+findFreeCandidate(const SubnetPtr& subnet, const Lease::Type& type,
+                  IOAddress& candidate) {
+    const PoolCollection& pools = subnet->getPools(type);
+
+    // Find the pool to which the candidate belongs.
+    size_t first_pool = 0;
+    while ((first_pool < pools.size()) && !pools[first_pool]->inRange(candidate)) {
+        ++first_pool;
+    }
+    if (first_pool == pools.size()) {
+        return (false);
+    }
+
+    if (pools[first_pool]->getLeaseBitmap() &&
+        !pools[first_pool]->getLeaseBitmap()->isSeeded()) {
+        seedLeaseBitmaps(subnet, type);
+    }
+
+    for (size_t i = 0; i < pools.size(); ++i) {
+        const PoolPtr& pool = pools[(first_pool + i) % pools.size()];
+        const LeaseBitmapPtr& bitmap = pool->getLeaseBitmap();
+        if (!bitmap || !bitmap->isSeeded()) {
+            return (false);
+        }
+
+        const uint64_t start = (i == 0 ? pool->getLeaseIndex(candidate) : 0);
+        uint64_t index = 0;
+        if (bitmap->findFree(start, index)) {
+            candidate = pool->getLeaseAddress(index);
+            return (true);
+        }
+    }
+
+    return (false);
+}
+
+/// @brief Marks the address or prefix of the lease as free in the lease
+/// bitmap of the pool it belongs to.
+///
+/// @param lease lease which has been released or reclaimed
+void
+markLeaseFree(const Lease4Ptr& lease) {
+    ConstSubnet4Ptr subnet = CfgMgr::instance().getCurrentCfg()->
+        getCfgSubnets4()->getBySubnetId(lease->subnet_id_);
+    if (subnet) {
+        subnet->markLeaseFree(Lease::TYPE_V4, lease->addr_);
+    }
+}
+
+/// @brief Marks the address or prefix of the lease as free in the lease
+/// bitmap of the pool it belongs to.
+///
+/// @param lease lease which has been released or reclaimed
+void
+markLeaseFree(const Lease6Ptr& lease) {
+    ConstSubnet6Ptr subnet = CfgMgr::instance().getCurrentCfg()->
+        getCfgSubnets6()->getBySubnetId(lease->subnet_id_);
+    if (subnet) {
+        subnet->markLeaseFree(lease->type_, lease->addr_);
+    }
+}
+
+/// @brief Moves the lease to the expired-reclaimed state.
+///
+/// The FQDN information is cleared as the name change request to remove
+/// the DNS record has already been sent.
+///
+/// @param lease lease being reclaimed
+/// @tparam LeasePtrType One of the @c Lease6Ptr or @c Lease4Ptr.
+template<typename LeasePtrType>
+void
+setReclaimedState(const LeasePtrType& lease) {
+    lease->hostname_.clear();
+    lease->fqdn_fwd_ = false;
+    lease->fqdn_rev_ = false;
+    lease->state_ = Lease::STATE_EXPIRED_RECLAIMED;
+}
+
+/// @brief Records the changes of the statistics for a reclaimed IPv4 lease.
+///
+/// @param lease lease which has been reclaimed
+/// @param [out] stats values to be added to the statistics, by name
+void
+addReclamationStats(const Lease4Ptr& lease, std::map<std::string, int64_t>& stats) {
+    // Decrease number of assigned addresses.
+    stats[StatsMgr::generateName("subnet", lease->subnet_id_,
+                                 "assigned-addresses")] -= 1;
+
+    // Increase total number of reclaimed leases.
+    stats["reclaimed-leases"] += 1;
+
+    // Increase number of reclaimed leases for a subnet.
+    stats[StatsMgr::generateName("subnet", lease->subnet_id_,
+                                 "reclaimed-leases")] += 1;
+}
+
+/// @brief Records the changes of the statistics for a reclaimed IPv6 lease.
+///
+/// @param lease lease which has been reclaimed
+/// @param [out] stats values to be added to the statistics, by name
+void
+addReclamationStats(const Lease6Ptr& lease, std::map<std::string, int64_t>& stats) {
+    // Decrease number of assigned leases.
+    if (lease->type_ == Lease::TYPE_NA) {
+        // IA_NA
+        stats[StatsMgr::generateName("subnet", lease->subnet_id_,
+                                     "assigned-nas")] -= 1;
+
+    } else if (lease->type_ == Lease::TYPE_PD) {
+        // IA_PD
+        stats[StatsMgr::generateName("subnet", lease->subnet_id_,
+                                     "assigned-pds")] -= 1;
+    }
+
+    // Increase total number of reclaimed leases.
+    stats["reclaimed-leases"] += 1;
+
+    // Increase number of reclaimed leases for a subnet.
+    stats[StatsMgr::generateName("subnet", lease->subnet_id_,
+                                 "reclaimed-leases")] += 1;
+}
+
+/// @brief Adds the recorded changes to the statistics.
+///
+/// @param stats values to be added to the statistics, by name
+void
+applyReclamationStats(const std::map<std::string, int64_t>& stats) {
+    for (auto stat = stats.cbegin(); stat != stats.cend(); ++stat) {
+        StatsMgr::instance().addValue(stat->first, stat->second);
+    }
+}
+
 }; // anonymous namespace
 
 namespace isc {
@@ -222,28 +547,106 @@ AllocEngine::IterativeAllocator::pickAddress(const SubnetPtr& subnet,
 
 AllocEngine::HashedAllocator::HashedAllocator(Lease::Type lease_type)
     :Allocator(lease_type) {
-    isc_throw(NotImplemented, "Hashed allocator is not implemented");
 }
 
+isc::asiolink::IOAddress
+AllocEngine::HashedAllocator::pickAddress(const SubnetPtr& subnet,
+                                          const DuidPtr& duid,
+                                          const IOAddress& hint) {
+    return (pickAddress(subnet, duid, hint, 0));
+}
 
 isc::asiolink::IOAddress
-AllocEngine::HashedAllocator::pickAddress(const SubnetPtr&,
-                                          const DuidPtr&,
-                                          const IOAddress&) {
-    isc_throw(NotImplemented, "Hashed allocator is not implemented");
+AllocEngine::HashedAllocator::pickAddress(const SubnetPtr& subnet,
+                                          const DuidPtr& duid,
+                                          const IOAddress&,
+                                          const uint64_t attempt) {
+    const PoolCollection& pools = subnet->getPools(pool_type_);
+    if (pools.empty()) {
+        isc_throw(AllocFailed, "No pools defined in selected subnet");
+    }
+
+    const uint64_t capacity = subnet->getPoolCapacity(pool_type_);
+    if (capacity <= 1) {
+        return (pools[0]->getFirstAddress());
+    }
+
+    // The home address is selected by the hash of the client identifier.
+    // The subsequent candidates are selected by the second hash used as
+    // a stride. As the stride is coprime with the capacity, all addresses
+    // are visited before the home address is returned again.
+    const uint64_t hash = hashIdentifier(duid);
+    const uint64_t home = hash % capacity;
+    const uint64_t stride = coprimeStride(1 + mixHash(hash) % (capacity - 1),
+                                          capacity);
+    const uint64_t index = addMod(home, mulMod(attempt % capacity, stride,
+                                               capacity), capacity);
+
+    return (addressAtIndex(pools, index));
 }
 
 AllocEngine::RandomAllocator::RandomAllocator(Lease::Type lease_type)
-    :Allocator(lease_type) {
-    isc_throw(NotImplemented, "Random allocator is not implemented");
+    :Allocator(lease_type), permutations_(), generator_(), mutex_() {
+    generator_.seed(static_cast<uint64_t>(time(NULL)) ^
+                    reinterpret_cast<uintptr_t>(this));
 }
 
+void
+AllocEngine::RandomAllocator::newPermutation(const uint64_t capacity,
+                                             Permutation& permutation) {
+    permutation.capacity_ = capacity;
+    permutation.remaining_ = capacity;
+    if (capacity <= 1) {
+        permutation.position_ = 0;
+        permutation.stride_ = 0;
+        return;
+    }
+
+    boost::random::uniform_int_distribution<uint64_t> dist(0, capacity - 1);
+    permutation.position_ = dist(generator_);
+    permutation.stride_ = coprimeStride(1 + dist(generator_) % (capacity - 1),
+                                        capacity);
+}
 
 isc::asiolink::IOAddress
-AllocEngine::RandomAllocator::pickAddress(const SubnetPtr&,
+AllocEngine::RandomAllocator::pickAddress(const SubnetPtr& subnet,
                                           const DuidPtr&,
                                           const IOAddress&) {
-    isc_throw(NotImplemented, "Random allocator is not implemented");
+    const PoolCollection& pools = subnet->getPools(pool_type_);
+    if (pools.empty()) {
+        isc_throw(AllocFailed, "No pools defined in selected subnet");
+    }
+
+    const uint64_t capacity = subnet->getPoolCapacity(pool_type_);
+
+    uint64_t index = 0;
+    {
+        Mutex::Locker lock(mutex_);
+
+        // Start a new permutation when the previous one has been used up
+        // or when the pools have changed.
+        std::map<SubnetID, Permutation>::iterator it =
+            permutations_.find(subnet->getID());
+        if (it == permutations_.end()) {
+            it = permutations_.insert(std::make_pair(subnet->getID(),
+                                                     Permutation())).first;
+            newPermutation(capacity, it->second);
+
+        } else if ((it->second.capacity_ != capacity) ||
+                   (it->second.remaining_ == 0)) {
+            newPermutation(capacity, it->second);
+        }
+
+        Permutation& permutation = it->second;
+        index = permutation.position_;
+        if (capacity > 1) {
+            permutation.position_ = addMod(permutation.position_,
+                                           permutation.stride_, capacity);
+        }
+        --permutation.remaining_;
+    }
+
+    return (addressAtIndex(pools, index));
 }
 
 
@@ -311,6 +714,8 @@ void
 AllocEngine::findReservationInternal(ContextType& ctx,
                                      const AllocEngine::HostGetFunc& host_get,
                                      const bool ipv6_only) {
+    StageTimer timer(ProcessingLatency::STAGE_HOST_LOOKUP);
+
     ctx.hosts_.clear();
 
     auto subnet = ctx.subnet_;
@@ -783,7 +1188,15 @@ AllocEngine::allocateUnreservedLeases6(ClientContext6& ctx) {
             ++total_attempts;
 
             IOAddress candidate = allocator->pickAddress(subnet, ctx.duid_,
-                                                         hint);
+                                                         hint, i);
+
+            // The first candidate is checked against the lease database
+            // even if the lease bitmap marks it as used. The bitmap may be
+            // stale, e.g. when the lease has been deleted with a control
+            // command, and the allocator's choice is preferred. The next
+            // attempts skip the addresses which are known to be in use.
+            const bool from_bitmap = (i > 0) &&
+                findFreeCandidate(subnet, ctx.currentIA().type_, candidate);
 
             /// In-pool reservations: Check if this address is reserved for someone
             /// else. There is no need to check for whom it is reserved, because if
@@ -791,7 +1204,11 @@ AllocEngine::allocateUnreservedLeases6(ClientContext6& ctx) {
             if (hr_mode == Network::HR_ALL &&
                 HostMgr::instance().get6(subnet->getID(), candidate)) {
 
-                // Don't allocate.
+                // Don't allocate and don't return this address from the
+                // lease bitmap again.
+                if (from_bitmap) {
+                    subnet->markLeaseUsed(ctx.currentIA().type_, candidate);
+                }
                 continue;
             }
 
@@ -806,8 +1223,11 @@ AllocEngine::allocateUnreservedLeases6(ClientContext6& ctx) {
                 }
             }
 
-            Lease6Ptr existing = LeaseMgrFactory::instance().getLease6(ctx.currentIA().type_,
-                                                                   candidate);
+            // Most candidates are checked for existence only, so avoid
+            // copying the lease until it is known to be reused.
+            ConstLease6Ptr existing =
+                LeaseMgrFactory::instance().getConstLease6(ctx.currentIA().type_,
+                                                           candidate);
             if (!existing) {
 
                 // there's no existing lease for selected candidate, so it is
@@ -840,12 +1260,19 @@ AllocEngine::allocateUnreservedLeases6(ClientContext6& ctx) {
                     ctx.currentIA().old_leases_.push_back(old_lease);
 
                     ctx.subnet_ = subnet;
-                    existing = reuseExpiredLease(existing, ctx, prefix_len);
+                    Lease6Ptr reused(new Lease6(*existing));
+                    reused = reuseExpiredLease(reused, ctx, prefix_len);
 
-                    leases.push_back(existing);
+                    leases.push_back(reused);
                     return (leases);
                 }
             }
+
+            // The address is in use. Make sure it is not returned from the
+            // lease bitmap again.
+            if (from_bitmap) {
+                subnet->markLeaseUsed(ctx.currentIA().type_, candidate);
+            }
         }
 
         subnet = subnet->getNextSubnet(original_subnet);
@@ -967,8 +1394,8 @@ AllocEngine::allocateReservedLeases6(ClientContext6& ctx,
 
             // If there's a lease for this address, let's not create it.
             // It doesn't matter whether it is for this client or for someone else.
-            if (!LeaseMgrFactory::instance().getLease6(ctx.currentIA().type_,
-                                                   addr)) {
+            if (!LeaseMgrFactory::instance().getConstLease6(ctx.currentIA().type_,
+                                                            addr)) {
 
                 // Let's remember the subnet from which the reserved address has been
                 // allocated. We'll use this subnet for allocating other reserved
@@ -1098,6 +1525,7 @@ AllocEngine::removeNonmatchingReservedLeases6(ClientContext6& ctx,
         // Remove this lease from LeaseMgr as it is reserved to someone
         // else or doesn't belong to a pool.
         LeaseMgrFactory::instance().deleteLease(candidate->addr_);
+        markLeaseFree(candidate);
 
         // Update DNS if needed.
         queueNCR(CHG_REMOVE, candidate);
@@ -1173,6 +1601,7 @@ AllocEngine::removeNonreservedLeases6(ClientContext6& ctx,
 
             // Remove this lease from LeaseMgr
             LeaseMgrFactory::instance().deleteLease((*lease)->addr_);
+            markLeaseFree(*lease);
 
             // Update DNS if required.
             queueNCR(CHG_REMOVE, *lease);
@@ -1292,6 +1721,7 @@ AllocEngine::reuseExpiredLease(Lease6Ptr& expired, ClientContext6& ctx,
     if (!ctx.fake_allocation_) {
         // for REQUEST we do update the lease
         LeaseMgrFactory::instance().updateLease6(expired);
+        ctx.subnet_->markLeaseUsed(ctx.currentIA().type_, expired->addr_);
 
         // If the lease is in the current subnet we need to account
         // for the re-assignment of The lease.
@@ -1373,6 +1803,8 @@ Lease6Ptr AllocEngine::createLease6(ClientContext6& ctx,
         bool status = LeaseMgrFactory::instance().addLease(lease);
 
         if (status) {
+            ctx.subnet_->markLeaseUsed(ctx.currentIA().type_, addr);
+
             // The lease insertion succeeded - if the lease is in the
             // current subnet lets bump up the statistic.
             if (ctx.subnet_->inPool(ctx.currentIA().type_, addr)) {
@@ -1533,6 +1965,7 @@ AllocEngine::extendLease6(ClientContext6& ctx, Lease6Ptr lease) {
 
         // Remove this lease from LeaseMgr
         LeaseMgrFactory::instance().deleteLease(lease->addr_);
+        markLeaseFree(lease);
 
         // Updated DNS if required.
         queueNCR(CHG_REMOVE, lease);
@@ -1756,12 +2189,16 @@ AllocEngine::reclaimExpiredLeases6(const size_t max_leases, const uint16_t timeo
         callout_handle = HooksManager::createCalloutHandle();
     }
 
+    // The lease database is updated for all leases at once, after the
+    // callouts have been called and the name change requests queued.
+    ReclamationBatch<Lease6Ptr> batch;
+
     size_t leases_processed = 0;
     BOOST_FOREACH(Lease6Ptr lease, leases) {
 
         try {
             // Reclaim the lease.
-            reclaimExpiredLease(lease, remove_lease, callout_handle);
+            reclaimExpiredLease(lease, remove_lease, callout_handle, &batch);
             ++leases_processed;
 
         } catch (const std::exception& ex) {
@@ -1790,6 +2227,15 @@ AllocEngine::reclaimExpiredLeases6(const size_t max_leases, const uint16_t timeo
         }
     }
 
+    // Reclaim the leases in the lease database and update the statistics.
+    leases_processed -=
+        reclaimLeasesInDatabase<Lease6Ptr>(batch,
+                                           boost::bind(&LeaseMgr::reclaimLeases6,
+                                                       &lease_mgr, _1, _2),
+                                           boost::bind(&LeaseMgr::updateLease6,
+                                                       &lease_mgr, _1),
+                                           ALLOC_ENGINE_V6_LEASE_RECLAMATION_FAILED);
+
     // Stop measuring the time.
     stopwatch.stop();
 
@@ -1896,12 +2342,16 @@ AllocEngine::reclaimExpiredLeases4(const size_t max_leases, const uint16_t timeo
         callout_handle = HooksManager::createCalloutHandle();
     }
 
+    // The lease database is updated for all leases at once, after the
+    // callouts have been called and the name change requests queued.
+    ReclamationBatch<Lease4Ptr> batch;
+
     size_t leases_processed = 0;
     BOOST_FOREACH(Lease4Ptr lease, leases) {
 
         try {
             // Reclaim the lease.
-            reclaimExpiredLease(lease, remove_lease, callout_handle);
+            reclaimExpiredLease(lease, remove_lease, callout_handle, &batch);
             ++leases_processed;
 
         } catch (const std::exception& ex) {
@@ -1930,6 +2380,15 @@ AllocEngine::reclaimExpiredLeases4(const size_t max_leases, const uint16_t timeo
         }
     }
 
+    // Reclaim the leases in the lease database and update the statistics.
+    leases_processed -=
+        reclaimLeasesInDatabase<Lease4Ptr>(batch,
+                                           boost::bind(&LeaseMgr::reclaimLeases4,
+                                                       &lease_mgr, _1, _2),
+                                           boost::bind(&LeaseMgr::updateLease4,
+                                                       &lease_mgr, _1),
+                                           ALLOC_ENGINE_V4_LEASE_RECLAMATION_FAILED);
+
     // Stop measuring the time.
     stopwatch.stop();
 
@@ -1965,9 +2424,10 @@ AllocEngine::reclaimExpiredLeases4(const size_t max_leases, const uint16_t timeo
 template<typename LeasePtrType>
 void
 AllocEngine::reclaimExpiredLease(const LeasePtrType& lease, const bool remove_lease,
-                                 const CalloutHandlePtr& callout_handle) {
+                                 const CalloutHandlePtr& callout_handle,
+                                 ReclamationBatch<LeasePtrType>* batch) {
     reclaimExpiredLease(lease, remove_lease ? DB_RECLAIM_REMOVE : DB_RECLAIM_UPDATE,
-                        callout_handle);
+                        callout_handle, batch);
 }
 
 template<typename LeasePtrType>
@@ -1985,7 +2445,8 @@ AllocEngine::reclaimExpiredLease(const LeasePtrType& lease,
 void
 AllocEngine::reclaimExpiredLease(const Lease6Ptr& lease,
                                  const DbReclaimMode& reclaim_mode,
-                                 const CalloutHandlePtr& callout_handle) {
+                                 const CalloutHandlePtr& callout_handle,
+                                 ReclamationBatch<Lease6Ptr>* batch) {
 
     LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
               ALLOC_ENGINE_V6_LEASE_RECLAIM)
@@ -2034,7 +2495,19 @@ AllocEngine::reclaimExpiredLease(const Lease6Ptr& lease,
             remove_lease = reclaimDeclined(lease);
         }
 
-        if (reclaim_mode != DB_RECLAIM_LEAVE_UNCHANGED) {
+        if ((reclaim_mode != DB_RECLAIM_LEAVE_UNCHANGED) && batch) {
+            // Defer the update of the lease database and of the statistics
+            // until the batch is reclaimed by reclaimLeasesInDatabase.
+            if (remove_lease) {
+                batch->removed_.push_back(lease);
+
+            } else {
+                setReclaimedState(lease);
+                batch->updated_.push_back(lease);
+            }
+            return;
+
+        } else if (reclaim_mode != DB_RECLAIM_LEAVE_UNCHANGED) {
             // Reclaim the lease - depending on the configuration, set the
             // expired-reclaimed state or simply remove it.
             LeaseMgr& lease_mgr = LeaseMgrFactory::instance();
@@ -2045,38 +2518,21 @@ AllocEngine::reclaimExpiredLease(const Lease6Ptr& lease,
     }
 
     // Update statistics.
+    if (batch) {
+        addReclamationStats(lease, batch->stats_);
 
-    // Decrease number of assigned leases.
-    if (lease->type_ == Lease::TYPE_NA) {
-        // IA_NA
-        StatsMgr::instance().addValue(StatsMgr::generateName("subnet",
-                                                             lease->subnet_id_,
-                                                             "assigned-nas"),
-                                      int64_t(-1));
-
-    } else if (lease->type_ == Lease::TYPE_PD) {
-        // IA_PD
-        StatsMgr::instance().addValue(StatsMgr::generateName("subnet",
-                                                             lease->subnet_id_,
-                                                             "assigned-pds"),
-                                      int64_t(-1));
-
+    } else {
+        std::map<std::string, int64_t> stats;
+        addReclamationStats(lease, stats);
+        applyReclamationStats(stats);
     }
-
-    // Increase total number of reclaimed leases.
-    StatsMgr::instance().addValue("reclaimed-leases", int64_t(1));
-
-    // Increase number of reclaimed leases for a subnet.
-    StatsMgr::instance().addValue(StatsMgr::generateName("subnet",
-                                                         lease->subnet_id_,
-                                                         "reclaimed-leases"),
-                                  int64_t(1));
 }
 
 void
 AllocEngine::reclaimExpiredLease(const Lease4Ptr& lease,
                                  const DbReclaimMode& reclaim_mode,
-                                 const CalloutHandlePtr& callout_handle) {
+                                 const CalloutHandlePtr& callout_handle,
+                                 ReclamationBatch<Lease4Ptr>* batch) {
 
     LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
               ALLOC_ENGINE_V4_LEASE_RECLAIM)
@@ -2124,7 +2580,19 @@ AllocEngine::reclaimExpiredLease(const Lease4Ptr& lease,
             remove_lease = reclaimDeclined(lease);
         }
 
-        if (reclaim_mode != DB_RECLAIM_LEAVE_UNCHANGED) {
+        if ((reclaim_mode != DB_RECLAIM_LEAVE_UNCHANGED) && batch) {
+            // Defer the update of the lease database and of the statistics
+            // until the batch is reclaimed by reclaimLeasesInDatabase.
+            if (remove_lease) {
+                batch->removed_.push_back(lease);
+
+            } else {
+                setReclaimedState(lease);
+                batch->updated_.push_back(lease);
+            }
+            return;
+
+        } else if (reclaim_mode != DB_RECLAIM_LEAVE_UNCHANGED) {
             // Reclaim the lease - depending on the configuration, set the
             // expired-reclaimed state or simply remove it.
             LeaseMgr& lease_mgr = LeaseMgrFactory::instance();
@@ -2135,21 +2603,14 @@ AllocEngine::reclaimExpiredLease(const Lease4Ptr& lease,
     }
 
     // Update statistics.
+    if (batch) {
+        addReclamationStats(lease, batch->stats_);
 
-    // Decrease number of assigned addresses.
-    StatsMgr::instance().addValue(StatsMgr::generateName("subnet",
-                                                         lease->subnet_id_,
-                                                         "assigned-addresses"),
-                                  int64_t(-1));
-
-    // Increase total number of reclaimed leases.
-    StatsMgr::instance().addValue("reclaimed-leases", int64_t(1));
-
-    // Increase number of reclaimed leases for a subnet.
-    StatsMgr::instance().addValue(StatsMgr::generateName("subnet",
-                                                         lease->subnet_id_,
-                                                         "reclaimed-leases"),
-                                  int64_t(1));
+    } else {
+        std::map<std::string, int64_t> stats;
+        addReclamationStats(lease, stats);
+        applyReclamationStats(stats);
+    }
 }
 
 void
@@ -2308,22 +2769,80 @@ void AllocEngine::reclaimLeaseInDatabase(const LeasePtrType& lease,
     } else if (!lease_update_fun.empty()) {
         // Clear FQDN information as we have already sent the
         // name change request to remove the DNS record.
-        lease->hostname_.clear();
-        lease->fqdn_fwd_ = false;
-        lease->fqdn_rev_ = false;
-        lease->state_ = Lease::STATE_EXPIRED_RECLAIMED;
+        setReclaimedState(lease);
         lease_update_fun(lease);
 
     } else {
         return;
     }
 
+    // The address can be allocated to another client.
+    markLeaseFree(lease);
+
     // Lease has been reclaimed.
     LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
               ALLOC_ENGINE_LEASE_RECLAIMED)
         .arg(lease->addr_.toText());
 }
 
+template<typename LeasePtrType>
+size_t
+AllocEngine::reclaimLeasesInDatabase(ReclamationBatch<LeasePtrType>& batch,
+                                     const boost::function<void (const std::vector<LeasePtrType>&,
+                                                                 const std::vector<LeasePtrType>&)>&
+                                     lease_batch_fun,
+                                     const boost::function<void (const LeasePtrType&)>&
+                                     lease_update_fun,
+                                     const isc::log::MessageID& failed_msg) const {
+    const size_t batch_size = batch.updated_.size() + batch.removed_.size();
+    bool batch_reclaimed = true;
+    if (batch_size > 0) {
+        try {
+            lease_batch_fun(batch.updated_, batch.removed_);
+
+        } catch (const std::exception& ex) {
+            // Part of the batch may have been applied. Retry the leases
+            // one by one to find out which of them can't be reclaimed.
+            LOG_WARN(alloc_engine_logger, ALLOC_ENGINE_LEASES_BATCH_RECLAMATION_FAILED)
+                .arg(batch_size)
+                .arg(ex.what());
+            batch_reclaimed = false;
+        }
+    }
+
+    size_t failed = 0;
+    const std::vector<LeasePtrType>* leases[] = { &batch.updated_, &batch.removed_ };
+    for (int i = 0; i < 2; ++i) {
+        const bool remove_lease = (leases[i] == &batch.removed_);
+        BOOST_FOREACH(const LeasePtrType& lease, *leases[i]) {
+            if (batch_reclaimed) {
+                // The address can be allocated to another client.
+                markLeaseFree(lease);
+
+                LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
+                          ALLOC_ENGINE_LEASE_RECLAIMED)
+                    .arg(lease->addr_.toText());
+
+            } else {
+                try {
+                    reclaimLeaseInDatabase<LeasePtrType>(lease, remove_lease,
+                                                         lease_update_fun);
+                } catch (const std::exception& ex) {
+                    LOG_ERROR(alloc_engine_logger, failed_msg)
+                        .arg(lease->addr_.toText())
+                        .arg(ex.what());
+                    ++failed;
+                    continue;
+                }
+            }
+            addReclamationStats(lease, batch.stats_);
+        }
+    }
+
+    applyReclamationStats(batch.stats_);
+    return (failed);
+}
+
 
 } // end of isc::dhcp namespace
 } // end of isc namespace
@@ -2873,6 +3392,7 @@ AllocEngine::requestLease4(AllocEngine::ClientContext4& ctx) {
             .arg(client_lease->addr_.toText());
 
         lease_mgr.deleteLease(client_lease->addr_);
+        markLeaseFree(client_lease);
 
         // Need to decrease statistic for assigned addresses.
         StatsMgr::instance().addValue(
@@ -2960,6 +3480,7 @@ AllocEngine::createLease4(const ClientContext4& ctx, const IOAddress& addr) {
         // That is a real (REQUEST) allocation
         bool status = LeaseMgrFactory::instance().addLease(lease);
         if (status) {
+            ctx.subnet_->markLeaseUsed(Lease::TYPE_V4, addr);
 
             // The lease insertion succeeded, let's bump up the statistic.
             StatsMgr::instance().addValue(
@@ -3160,6 +3681,7 @@ AllocEngine::reuseExpiredLease4(Lease4Ptr& expired,
     if (!ctx.fake_allocation_) {
         // for REQUEST we do update the lease
         LeaseMgrFactory::instance().updateLease4(expired);
+        ctx.subnet_->markLeaseUsed(Lease::TYPE_V4, expired->addr_);
 
         // We need to account for the re-assignment of The lease.
         StatsMgr::instance().addValue(
@@ -3179,17 +3701,20 @@ Lease4Ptr
 AllocEngine::allocateOrReuseLease4(const IOAddress& candidate, ClientContext4& ctx) {
     ctx.conflicting_lease_.reset();
 
-    Lease4Ptr exist_lease = LeaseMgrFactory::instance().getLease4(candidate);
+    // Most candidates are checked for existence only, so avoid copying
+    // the lease until it is known to be needed.
+    ConstLease4Ptr exist_lease = LeaseMgrFactory::instance().getConstLease4(candidate);
     if (exist_lease) {
         if (exist_lease->expired()) {
             ctx.old_lease_ = Lease4Ptr(new Lease4(*exist_lease));
-            return (reuseExpiredLease4(exist_lease, ctx));
+            Lease4Ptr expired(new Lease4(*exist_lease));
+            return (reuseExpiredLease4(expired, ctx));
 
         } else {
             // If there is a lease and it is not expired, pass this lease back
             // to the caller in the context. The caller may need to know
             // which lease we're conflicting with.
-            ctx.conflicting_lease_ = exist_lease;
+            ctx.conflicting_lease_ = Lease4Ptr(new Lease4(*exist_lease));
         }
 
     } else {
@@ -3209,16 +3734,27 @@ AllocEngine::allocateUnreservedLease4(ClientContext4& ctx) {
     uint64_t total_attempts = 0;
     while (subnet) {
 
-        ClientIdPtr client_id;
-        if (subnet->getMatchClientId()) {
+        // The client identifier is used by the hashed allocator to select
+        // the address for the client. If the client identifier is not used
+        // in this subnet the HW address identifies the client.
+        DuidPtr client_id;
+        if (subnet->getMatchClientId() && ctx.clientid_) {
             client_id = ctx.clientid_;
+        } else if (ctx.hwaddr_ && !ctx.hwaddr_->hwaddr_.empty()) {
+            client_id.reset(new DUID(ctx.hwaddr_->hwaddr_));
         }
 
         const uint64_t max_attempts = (attempts_ > 0 ? attempts_ :
                                        subnet->getPoolCapacity(Lease::TYPE_V4));
         for (uint64_t i = 0; i < max_attempts; ++i) {
             IOAddress candidate = allocator->pickAddress(subnet, client_id,
-                                                         ctx.requested_address_);
+                                                         ctx.requested_address_,
+                                                         i);
+            // The first candidate is checked against the lease database
+            // even if the lease bitmap marks it as used. The next attempts
+            // skip the addresses which are known to be in use.
+            const bool from_bitmap = (i > 0) &&
+                findFreeCandidate(subnet, Lease::TYPE_V4, candidate);
             // If address is not reserved for another client, try to allocate it.
             if (!addressReserved(candidate, ctx)) {
                 // The call below will return the non-NULL pointer if we
@@ -3235,6 +3771,12 @@ AllocEngine::allocateUnreservedLease4(ClientContext4& ctx) {
                     break;
                 }
             }
+
+            // The address is in use or reserved for another client. Make
+            // sure it is not returned from the lease bitmap again.
+            if (from_bitmap) {
+                subnet->markLeaseUsed(Lease::TYPE_V4, candidate);
+            }
             ++total_attempts;
         }
 
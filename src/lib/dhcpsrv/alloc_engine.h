@@ -17,15 +17,20 @@
 #include <dhcpsrv/subnet.h>
 #include <dhcpsrv/lease_mgr.h>
 #include <hooks/callout_handle.h>
+#include <log/message_types.h>
+#include <util/threads/sync.h>
 
 #include <boost/function.hpp>
+#include <boost/random/mersenne_twister.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/noncopyable.hpp>
 
 #include <list>
 #include <map>
 #include <set>
+#include <string>
 #include <utility>
+#include <vector>
 
 namespace isc {
 namespace dhcp {
@@ -87,6 +92,28 @@ protected:
         pickAddress(const SubnetPtr& subnet, const DuidPtr& duid,
                     const isc::asiolink::IOAddress& hint) = 0;
 
+        /// @brief picks an address for the specified allocation attempt
+        ///
+        /// The allocation engine calls this variant of the method, passing
+        /// the number of previous unsuccessful attempts to allocate a lease
+        /// from the subnet for the current client. Allocators which derive
+        /// the address from the client identity use it to select the next
+        /// candidate. The default implementation ignores the attempt number.
+        ///
+        /// @param subnet next address will be returned from pool of that subnet
+        /// @param duid Client's DUID
+        /// @param hint client's hint
+        /// @param attempt number of previous attempts for this client
+        ///
+        /// @return the next address
+        virtual isc::asiolink::IOAddress
+        pickAddress(const SubnetPtr& subnet, const DuidPtr& duid,
+                    const isc::asiolink::IOAddress& hint,
+                    const uint64_t attempt) {
+            static_cast<void>(attempt);
+            return (pickAddress(subnet, duid, hint));
+        }
+
         /// @brief Default constructor.
         ///
         /// Specifies which type of leases this allocator will assign
@@ -122,6 +149,8 @@ protected:
         /// @param type - specifies allocation type
         IterativeAllocator(Lease::Type type);
 
+        using Allocator::pickAddress;
+
         /// @brief returns the next address from pools in a subnet
         ///
         /// @param subnet next address will be returned from pool of that subnet
@@ -151,7 +180,19 @@ protected:
 
     /// @brief Address/prefix allocator that gets an address based on a hash
     ///
-    /// @todo: This is a skeleton class for now and is missing an implementation.
+    /// The allocator uses the hash of the client's DUID (or client
+    /// identifier) to select a "home" address in the subnet's pools, so
+    /// as the client gets the same address as long as it is available,
+    /// e.g. after the client reboots or the server loses its leases.
+    /// If the home address is in use, the subsequent attempts visit the
+    /// pools with a stride which is also derived from the client's
+    /// identity (double hashing). This keeps the average number of
+    /// attempts low when the pools fill up (about 20 at 95% utilization)
+    /// and guarantees that each address is visited at most once before
+    /// all addresses have been tried.
+    ///
+    /// The allocator has no state, so it can be used by multiple threads
+    /// concurrently.
     class HashedAllocator : public Allocator {
     public:
 
@@ -159,40 +200,91 @@ protected:
         /// @param type - specifies allocation type
         HashedAllocator(Lease::Type type);
 
-        /// @brief returns an address based on hash calculated from client's DUID.
-        ///
-        /// @todo: Implement this method
+        /// @brief returns the home address of the client
         ///
         /// @param subnet an address will be picked from pool of that subnet
         /// @param duid Client's DUID
-        /// @param hint a hint (last address that was picked)
+        /// @param hint a hint (ignored)
         /// @return selected address
         virtual isc::asiolink::IOAddress pickAddress(const SubnetPtr& subnet,
                                                      const DuidPtr& duid,
                                                      const isc::asiolink::IOAddress& hint);
+
+        /// @brief returns an address based on hash calculated from client's DUID.
+        ///
+        /// @param subnet an address will be picked from pool of that subnet
+        /// @param duid Client's DUID
+        /// @param hint a hint (ignored)
+        /// @param attempt number of previous attempts for this client
+        /// @return selected address
+        /// @throw AllocFailed if there are no pools in the subnet
+        virtual isc::asiolink::IOAddress pickAddress(const SubnetPtr& subnet,
+                                                     const DuidPtr& duid,
+                                                     const isc::asiolink::IOAddress& hint,
+                                                     const uint64_t attempt);
     };
 
     /// @brief Random allocator that picks address randomly
     ///
-    /// @todo: This is a skeleton class for now and is missing an implementation.
+    /// For each subnet the allocator walks a random permutation of the
+    /// addresses (or prefixes) in the subnet's pools: it begins at a random
+    /// position and moves by a random stride which is coprime with the
+    /// number of addresses in the pools. Every address is thus returned
+    /// exactly once per cycle and an address which has been handed out is
+    /// not probed again until all other addresses have been tried. A new
+    /// random permutation is selected for each cycle and when the capacity
+    /// of the pools changes.
+    ///
+    /// The state of the allocator is protected by a mutex, so it can be
+    /// used by multiple threads concurrently.
     class RandomAllocator : public Allocator {
     public:
 
-        /// @brief default constructor (does nothing)
+        /// @brief default constructor
         /// @param type - specifies allocation type
         RandomAllocator(Lease::Type type);
 
+        using Allocator::pickAddress;
+
         /// @brief returns a random address from pool of specified subnet
         ///
-        /// @todo: Implement this method
-        ///
         /// @param subnet an address will be picked from pool of that subnet
         /// @param duid Client's DUID (ignored)
         /// @param hint the last address that was picked (ignored)
         /// @return a random address from the pool
+        /// @throw AllocFailed if there are no pools in the subnet
         virtual isc::asiolink::IOAddress
         pickAddress(const SubnetPtr& subnet, const DuidPtr& duid,
                     const isc::asiolink::IOAddress& hint);
+
+    private:
+
+        /// @brief State of the permutation walk in a subnet.
+        struct Permutation {
+            /// @brief Number of addresses in the subnet's pools.
+            uint64_t capacity_;
+            /// @brief Index of the next address to be returned.
+            uint64_t position_;
+            /// @brief Distance between the subsequent indexes.
+            uint64_t stride_;
+            /// @brief Number of addresses left in the current cycle.
+            uint64_t remaining_;
+        };
+
+        /// @brief Starts a new cycle of the permutation.
+        ///
+        /// @param capacity Number of addresses in the subnet's pools.
+        /// @param [out] permutation Permutation to be initialized.
+        void newPermutation(const uint64_t capacity, Permutation& permutation);
+
+        /// @brief Permutations indexed by subnet identifiers.
+        std::map<SubnetID, Permutation> permutations_;
+
+        /// @brief Random number generator.
+        boost::mt19937_64 generator_;
+
+        /// @brief Protects the state of the allocator.
+        isc::util::thread::Mutex mutex_;
     };
 
 public:
@@ -919,6 +1011,28 @@ private:
         DB_RECLAIM_LEAVE_UNCHANGED
     };
 
+    /// @brief Leases reclaimed in a reclamation pass, pending the update of
+    /// the lease database.
+    ///
+    /// The reclamation routines run the callouts and queue the name change
+    /// requests for each lease, collect the leases in this structure and
+    /// then reclaim them in the lease database with a single call to
+    /// @c LeaseMgr::reclaimLeases4 or @c LeaseMgr::reclaimLeases6. The
+    /// statistics of the reclaimed leases are updated in aggregate.
+    ///
+    /// @tparam LeasePtrType Lease type, i.e. @c Lease4Ptr or @c Lease6Ptr.
+    template<typename LeasePtrType>
+    struct ReclamationBatch {
+        /// @brief Leases to be set to the expired-reclaimed state.
+        std::vector<LeasePtrType> updated_;
+
+        /// @brief Leases to be removed from the lease database.
+        std::vector<LeasePtrType> removed_;
+
+        /// @brief Values to be added to the statistics, by statistic name.
+        std::map<std::string, int64_t> stats_;
+    };
+
     /// @brief Reclaim DHCPv4 or DHCPv6 lease with updating lease database.
     ///
     /// This method is called by the lease reclamation routine to reclaim the
@@ -929,11 +1043,16 @@ private:
     /// @param remove_lease A boolean flag indicating if the lease should be
     /// removed from the lease database (if true) upon reclamation.
     /// @param callout_handle Pointer to the callout handle.
+    /// @param batch Pointer to the batch to which the lease is added if
+    /// the update of the lease database is deferred, see
+    /// @ref reclaimLeasesInDatabase. If null, the lease database is
+    /// updated immediately.
     /// @tparam LeasePtrPtr Lease type, i.e. @c Lease4Ptr or @c Lease6Ptr.
     template<typename LeasePtrType>
     void reclaimExpiredLease(const LeasePtrType& lease,
                              const bool remove_lease,
-                             const hooks::CalloutHandlePtr& callout_handle);
+                             const hooks::CalloutHandlePtr& callout_handle,
+                             ReclamationBatch<LeasePtrType>* batch = 0);
 
     /// @brief Reclaim DHCPv4 or DHCPv6 lease without updating lease database.
     ///
@@ -959,9 +1078,12 @@ private:
     /// @param reclaim_mode Indicates what the method should do with the reclaimed
     /// lease in the lease database.
     /// @param callout_handle Pointer to the callout handle.
+    /// @param batch Pointer to the batch to which the lease is added instead
+    /// of updating the lease database and the statistics (may be null).
     void reclaimExpiredLease(const Lease6Ptr& lease,
                              const DbReclaimMode& reclaim_mode,
-                             const hooks::CalloutHandlePtr& callout_handle);
+                             const hooks::CalloutHandlePtr& callout_handle,
+                             ReclamationBatch<Lease6Ptr>* batch = 0);
 
     /// @brief Reclaim DHCPv4 lease.
     ///
@@ -973,9 +1095,12 @@ private:
     /// @param reclaim_mode Indicates what the method should do with the reclaimed
     /// lease in the lease database.
     /// @param callout_handle Pointer to the callout handle.
+    /// @param batch Pointer to the batch to which the lease is added instead
+    /// of updating the lease database and the statistics (may be null).
     void reclaimExpiredLease(const Lease4Ptr& lease,
                              const DbReclaimMode& reclaim_mode,
-                             const hooks::CalloutHandlePtr& callout_handle);
+                             const hooks::CalloutHandlePtr& callout_handle,
+                             ReclamationBatch<Lease4Ptr>* batch = 0);
 
     /// @brief Marks lease as reclaimed in the database.
     ///
@@ -1001,6 +1126,34 @@ private:
                                 const boost::function<void (const LeasePtrType&)>&
                                 lease_update_fun) const;
 
+    /// @brief Reclaims a batch of leases in the database.
+    ///
+    /// This method is called by the leases reclamation routines after
+    /// processing the expired leases of a pass. It applies the whole batch
+    /// with the @c lease_batch_fun, i.e. @c LeaseMgr::reclaimLeases4 or
+    /// @c LeaseMgr::reclaimLeases6. If it fails, the leases are reclaimed
+    /// one by one with @ref reclaimLeaseInDatabase so as the failures are
+    /// reported for the individual leases. Finally, the statistics of the
+    /// leases successfully reclaimed are updated.
+    ///
+    /// @param batch Batch of the leases to be reclaimed.
+    /// @param lease_batch_fun Pointer to the function in the @c LeaseMgr
+    /// to be used to reclaim the batch.
+    /// @param lease_update_fun Pointer to the function in the @c LeaseMgr to
+    /// be used to update a lease.
+    /// @param failed_msg Message logged when a lease can't be reclaimed.
+    ///
+    /// @return Number of leases which couldn't be reclaimed.
+    /// @tparam LeasePtrType One of the @c Lease6Ptr or @c Lease4Ptr.
+    template<typename LeasePtrType>
+    size_t reclaimLeasesInDatabase(ReclamationBatch<LeasePtrType>& batch,
+                                   const boost::function<void (const std::vector<LeasePtrType>&,
+                                                               const std::vector<LeasePtrType>&)>&
+                                   lease_batch_fun,
+                                   const boost::function<void (const LeasePtrType&)>&
+                                   lease_update_fun,
+                                   const isc::log::MessageID& failed_msg) const;
+
     /// @anchor reclaimDeclinedLease4
     /// @brief Conducts steps necessary for reclaiming declined IPv4 lease.
     ///
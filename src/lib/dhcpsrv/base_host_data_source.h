@@ -294,6 +294,17 @@ public:
     /// @return Type of the backend.
     virtual std::string getType() const = 0;
 
+    /// @brief Indicates if the backend can be used concurrently.
+    ///
+    /// The packet processing threads are started only if the host
+    /// data source is safe to be used by several threads at the same
+    /// time.
+    ///
+    /// @return false by default.
+    virtual bool isThreadSafe() const {
+        return (false);
+    }
+
     /// @brief Commit Transactions
     ///
     /// Commits all pending database operations.  On databases that don't
@@ -0,0 +1,633 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/binary_lease_file.h>
+#include <exceptions/exceptions.h>
+#include <util/csv_file.h>
+#include <boost/lexical_cast.hpp>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+using namespace isc::asiolink;
+using namespace isc::util;
+
+namespace {
+
+/// @brief Magic value at the beginning of the binary lease file.
+const char MAGIC[] = { 'K', 'E', 'A', 'L', 'E', 'A', 'S', 'E' };
+
+/// @brief Length of the file header.
+const size_t HEADER_LENGTH = sizeof(MAGIC) + 8;
+
+/// @brief Flag indicating that the forward DNS update has been performed.
+const uint8_t FLAG_FQDN_FWD = 0x01;
+
+/// @brief Flag indicating that the reverse DNS update has been performed.
+const uint8_t FLAG_FQDN_REV = 0x02;
+
+/// @brief Table used to calculate the CRC-32.
+///
+/// This is the table for the reflected polynomial 0xEDB88320 used by
+/// Ethernet, zlib and many others.
+class CRC32Table {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Computes the table.
+    CRC32Table() {
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t crc = i;
+            for (int bit = 0; bit < 8; ++bit) {
+                crc = (crc & 1) ? ((crc >> 1) ^ 0xEDB88320) : (crc >> 1);
+            }
+            table_[i] = crc;
+        }
+    }
+
+    /// @brief Computes the CRC-32 of the data.
+    ///
+    /// @param data Pointer to the data.
+    /// @param length Length of the data.
+    uint32_t compute(const uint8_t* data, const size_t length) const {
+        uint32_t crc = 0xFFFFFFFF;
+        for (size_t i = 0; i < length; ++i) {
+            crc = table_[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+        }
+        return (crc ^ 0xFFFFFFFF);
+    }
+
+private:
+
+    /// @brief Precomputed values for each byte.
+    uint32_t table_[256];
+};
+
+/// @brief Computes the CRC-32 of the data.
+///
+/// @param data Pointer to the data.
+/// @param length Length of the data.
+uint32_t
+crc32(const void* data, const size_t length) {
+    static const CRC32Table table;
+    return (table.compute(static_cast<const uint8_t*>(data), length));
+}
+
+/// @brief Writes the 64 bit signed value to the buffer.
+///
+/// @param buffer Output buffer.
+/// @param value Value to be written.
+void
+writeInt64(OutputBuffer& buffer, const int64_t value) {
+    const uint64_t u = static_cast<uint64_t>(value);
+    buffer.writeUint32(static_cast<uint32_t>(u >> 32));
+    buffer.writeUint32(static_cast<uint32_t>(u & 0xFFFFFFFF));
+}
+
+/// @brief Reads the 64 bit signed value from the buffer.
+///
+/// @param buffer Input buffer.
+int64_t
+readInt64(InputBuffer& buffer) {
+    uint64_t u = static_cast<uint64_t>(buffer.readUint32()) << 32;
+    u |= buffer.readUint32();
+    return (static_cast<int64_t>(u));
+}
+
+/// @brief Writes the data preceded by its 8 bit length.
+///
+/// @param buffer Output buffer.
+/// @param data Data to be written.
+/// @param name Name of the data used in the error message.
+/// @throw isc::BadValue if the data is too long.
+void
+writeShortData(OutputBuffer& buffer, const std::vector<uint8_t>& data,
+               const char* name) {
+    if (data.size() > 0xFF) {
+        isc_throw(isc::BadValue, name << " is too long");
+    }
+    buffer.writeUint8(static_cast<uint8_t>(data.size()));
+    if (!data.empty()) {
+        buffer.writeData(&data[0], data.size());
+    }
+}
+
+/// @brief Reads the data preceded by its 8 bit length.
+///
+/// @param buffer Input buffer.
+/// @param [out] data Data read.
+void
+readShortData(InputBuffer& buffer, std::vector<uint8_t>& data) {
+    const size_t length = buffer.readUint8();
+    data.clear();
+    if (length > 0) {
+        buffer.readVector(data, length);
+    }
+}
+
+/// @brief Writes the hostname preceded by its 16 bit length.
+///
+/// @param buffer Output buffer.
+/// @param hostname Hostname to be written.
+/// @throw isc::BadValue if the hostname is too long.
+void
+writeHostname(OutputBuffer& buffer, const std::string& hostname) {
+    if (hostname.size() > 0xFFFF) {
+        isc_throw(isc::BadValue, "hostname is too long");
+    }
+    buffer.writeUint16(static_cast<uint16_t>(hostname.size()));
+    if (!hostname.empty()) {
+        buffer.writeData(hostname.data(), hostname.size());
+    }
+}
+
+/// @brief Reads the hostname preceded by its 16 bit length.
+///
+/// @param buffer Input buffer.
+std::string
+readHostname(InputBuffer& buffer) {
+    const size_t length = buffer.readUint16();
+    std::vector<uint8_t> hostname;
+    if (length > 0) {
+        buffer.readVector(hostname, length);
+    }
+    return (std::string(hostname.begin(), hostname.end()));
+}
+
+/// @brief Writes the hardware address.
+///
+/// The address is written as its 8 bit length and the address followed
+/// by the hardware type. The null pointer is written as a zero length.
+///
+/// @param buffer Output buffer.
+/// @param hwaddr Hardware address to be written.
+void
+writeHWAddr(OutputBuffer& buffer, const isc::dhcp::HWAddrPtr& hwaddr) {
+    if (!hwaddr) {
+        buffer.writeUint8(0);
+        buffer.writeUint16(isc::dhcp::HTYPE_ETHER);
+        return;
+    }
+    writeShortData(buffer, hwaddr->hwaddr_, "hardware address");
+    buffer.writeUint16(hwaddr->htype_);
+}
+
+/// @brief Reads the hardware address.
+///
+/// @param buffer Input buffer.
+/// @return Pointer to the hardware address, which is null if the length of
+/// the address is 0.
+isc::dhcp::HWAddrPtr
+readHWAddr(InputBuffer& buffer) {
+    std::vector<uint8_t> hwaddr;
+    readShortData(buffer, hwaddr);
+    const uint16_t htype = buffer.readUint16();
+    if (hwaddr.empty()) {
+        return (isc::dhcp::HWAddrPtr());
+    }
+    return (isc::dhcp::HWAddrPtr(new isc::dhcp::HWAddr(hwaddr, htype)));
+}
+
+/// @brief Writes the flags of the DNS updates.
+///
+/// @param buffer Output buffer.
+/// @param lease Lease holding the flags.
+void
+writeFqdnFlags(OutputBuffer& buffer, const isc::dhcp::Lease& lease) {
+    buffer.writeUint8((lease.fqdn_fwd_ ? FLAG_FQDN_FWD : 0) |
+                      (lease.fqdn_rev_ ? FLAG_FQDN_REV : 0));
+}
+
+/// @brief Reads the flags of the DNS updates.
+///
+/// @param buffer Input buffer.
+/// @param [out] lease Lease to which the flags are written.
+void
+readFqdnFlags(InputBuffer& buffer, isc::dhcp::Lease& lease) {
+    const uint8_t flags = buffer.readUint8();
+    lease.fqdn_fwd_ = ((flags & FLAG_FQDN_FWD) != 0);
+    lease.fqdn_rev_ = ((flags & FLAG_FQDN_REV) != 0);
+}
+
+/// @brief Checks that the whole record has been consumed.
+///
+/// @param buffer Input buffer holding the record.
+/// @throw isc::BadValue if there is unexpected data in the record.
+void
+checkRecordEnd(const InputBuffer& buffer) {
+    if (buffer.getPosition() != buffer.getLength()) {
+        isc_throw(isc::BadValue, "unexpected " << (buffer.getLength() -
+                                                  buffer.getPosition())
+                  << " bytes at the end of the lease record");
+    }
+}
+
+} // end of anonymous namespace
+
+namespace isc {
+namespace dhcp {
+
+const uint16_t BinaryLeaseFile::FORMAT_VERSION;
+const uint32_t BinaryLeaseFile::MAX_RECORD_LENGTH;
+
+BinaryLeaseFile::BinaryLeaseFile(const std::string& filename,
+                                 const uint16_t universe)
+    : LeaseFileStats(), filename_(filename), universe_(universe), fs_(),
+      read_failed_(false), read_msg_() {
+}
+
+BinaryLeaseFile::~BinaryLeaseFile() {
+    close();
+}
+
+bool
+BinaryLeaseFile::isBinary(const std::string& filename) {
+    std::ifstream fs(filename.c_str(), std::ios_base::in |
+                     std::ios_base::binary);
+    char magic[sizeof(MAGIC)];
+    if (!fs.read(magic, sizeof(magic))) {
+        return (false);
+    }
+    return (memcmp(magic, MAGIC, sizeof(MAGIC)) == 0);
+}
+
+bool
+BinaryLeaseFile::exists() const {
+    std::ifstream fs(filename_.c_str());
+    return (fs.good());
+}
+
+void
+BinaryLeaseFile::open() {
+    close();
+    clearStatistics();
+    read_failed_ = false;
+    read_msg_.clear();
+
+    fs_.reset(new std::fstream(filename_.c_str(), std::ios_base::in |
+                               std::ios_base::binary));
+    if (!fs_->is_open()) {
+        fs_.reset();
+        isc_throw(CSVFileError, "unable to open '" << filename_ << "'");
+    }
+
+    uint8_t header[HEADER_LENGTH];
+    if (!fs_->read(reinterpret_cast<char*>(header), sizeof(header))) {
+        close();
+        isc_throw(CSVFileError, "unable to read the header of the binary"
+                  " lease file '" << filename_ << "'");
+    }
+
+    InputBuffer buffer(header, sizeof(header));
+    std::vector<uint8_t> magic;
+    buffer.readVector(magic, sizeof(MAGIC));
+    const uint16_t version = buffer.readUint16();
+    const uint16_t universe = buffer.readUint16();
+    const uint32_t crc = buffer.readUint32();
+
+    if ((memcmp(&magic[0], MAGIC, sizeof(MAGIC)) != 0) ||
+        (crc != crc32(header, HEADER_LENGTH - 4))) {
+        close();
+        isc_throw(CSVFileError, "invalid header of the binary lease file '"
+                  << filename_ << "'");
+    }
+    if (version != FORMAT_VERSION) {
+        close();
+        isc_throw(CSVFileError, "unsupported version " << version
+                  << " of the binary lease file '" << filename_ << "'");
+    }
+    if (universe != universe_) {
+        close();
+        isc_throw(CSVFileError, "binary lease file '" << filename_
+                  << "' holds DHCPv" << universe << " leases, expected"
+                  " DHCPv" << universe_ << " leases");
+    }
+}
+
+void
+BinaryLeaseFile::recreate() {
+    close();
+    clearStatistics();
+
+    // Remove the existing file.
+    if ((remove(filename_.c_str()) != 0) && (errno != ENOENT)) {
+        isc_throw(CSVFileError, "unable to remove the file '" << filename_
+                  << "': " << strerror(errno));
+    }
+
+    fs_.reset(new std::fstream(filename_.c_str(), std::ios_base::out |
+                               std::ios_base::trunc | std::ios_base::binary));
+    if (!fs_->is_open()) {
+        fs_.reset();
+        isc_throw(CSVFileError, "unable to create '" << filename_ << "'");
+    }
+
+    OutputBuffer header(HEADER_LENGTH);
+    header.writeData(MAGIC, sizeof(MAGIC));
+    header.writeUint16(FORMAT_VERSION);
+    header.writeUint16(universe_);
+    header.writeUint32(crc32(header.getData(), header.getLength()));
+    fs_->write(static_cast<const char*>(header.getData()), header.getLength());
+    if (!fs_->good()) {
+        close();
+        isc_throw(CSVFileError, "unable to write the header to '"
+                  << filename_ << "'");
+    }
+}
+
+void
+BinaryLeaseFile::close() {
+    if (fs_) {
+        fs_->flush();
+        fs_->close();
+        fs_.reset();
+    }
+}
+
+std::string
+BinaryLeaseFile::getSchemaVersion() const {
+    return (boost::lexical_cast<std::string>(FORMAT_VERSION) + ".0");
+}
+
+void
+BinaryLeaseFile::appendRecord(const OutputBuffer& payload) {
+    if (!fs_) {
+        isc_throw(CSVFileError, "unable to write the lease to the binary"
+                  " lease file '" << filename_ << "', the file is not open");
+    }
+    if (payload.getLength() > MAX_RECORD_LENGTH) {
+        isc_throw(CSVFileError, "lease record of " << payload.getLength()
+                  << " bytes is too long");
+    }
+
+    OutputBuffer record(payload.getLength() + 8);
+    record.writeUint32(static_cast<uint32_t>(payload.getLength()));
+    record.writeData(payload.getData(), payload.getLength());
+    record.writeUint32(crc32(payload.getData(), payload.getLength()));
+    fs_->write(static_cast<const char*>(record.getData()), record.getLength());
+    if (!fs_->good()) {
+        isc_throw(CSVFileError, "failed to write the lease to the binary"
+                  " lease file '" << filename_ << "'");
+    }
+}
+
+void
+BinaryLeaseFile::nextRecord(std::vector<uint8_t>& payload) {
+    payload.clear();
+    if (!fs_) {
+        isc_throw(CSVFileError, "unable to read the lease from the binary"
+                  " lease file '" << filename_ << "', the file is not open");
+    }
+
+    // The file can't be read after the length of the record has been
+    // found invalid.
+    if (read_failed_) {
+        return;
+    }
+
+    uint8_t length_data[4];
+    fs_->read(reinterpret_cast<char*>(length_data), sizeof(length_data));
+    if (fs_->gcount() == 0) {
+        // End of file.
+        return;
+    }
+    if (fs_->gcount() != sizeof(length_data)) {
+        read_failed_ = true;
+        isc_throw(CSVFileError, "truncated lease record");
+    }
+    InputBuffer length_buffer(length_data, sizeof(length_data));
+    const uint32_t length = length_buffer.readUint32();
+    if ((length == 0) || (length > MAX_RECORD_LENGTH)) {
+        read_failed_ = true;
+        isc_throw(CSVFileError, "invalid length " << length
+                  << " of the lease record");
+    }
+
+    std::vector<uint8_t> record(length + 4);
+    fs_->read(reinterpret_cast<char*>(&record[0]), record.size());
+    if (static_cast<size_t>(fs_->gcount()) != record.size()) {
+        read_failed_ = true;
+        isc_throw(CSVFileError, "truncated lease record");
+    }
+
+    InputBuffer crc_buffer(&record[length], 4);
+    if (crc_buffer.readUint32() != crc32(&record[0], length)) {
+        isc_throw(CSVFileError, "invalid checksum of the lease record");
+    }
+    record.resize(length);
+    payload.swap(record);
+}
+
+BinaryLeaseFile4::BinaryLeaseFile4(const std::string& filename)
+    : BinaryLeaseFile(filename, 4) {
+}
+
+void
+BinaryLeaseFile4::append(const Lease4& lease) {
+    // Bump the number of write attempts
+    ++writes_;
+
+    if (!lease.hwaddr_) {
+        // Bump the error counter
+        ++write_errs_;
+
+        isc_throw(BadValue, "Lease4 must have hardware address specified.");
+    }
+
+    try {
+        OutputBuffer payload(64);
+        payload.writeUint32(lease.addr_.toUint32());
+        writeHWAddr(payload, lease.hwaddr_);
+        writeShortData(payload, lease.client_id_ ?
+                       lease.client_id_->getClientId() :
+                       std::vector<uint8_t>(), "client identifier");
+        payload.writeUint32(lease.valid_lft_);
+        writeInt64(payload, lease.cltt_);
+        payload.writeUint32(lease.subnet_id_);
+        writeFqdnFlags(payload, lease);
+        writeHostname(payload, lease.hostname_);
+        payload.writeUint32(lease.state_);
+        appendRecord(payload);
+
+    } catch (const std::exception&) {
+        // Catch any errors so we can bump the error counter than rethrow it
+        ++write_errs_;
+        throw;
+    }
+
+    // Bump the number of leases written
+    ++write_leases_;
+}
+
+bool
+BinaryLeaseFile4::next(Lease4Ptr& lease) {
+    // Bump the number of read attempts
+    ++reads_;
+
+    try {
+        std::vector<uint8_t> payload;
+        nextRecord(payload);
+        // The empty record signals EOF.
+        if (payload.empty()) {
+            lease.reset();
+            return (true);
+        }
+
+        InputBuffer buffer(&payload[0], payload.size());
+        IOAddress addr(buffer.readUint32());
+        HWAddrPtr hwaddr = readHWAddr(buffer);
+        std::vector<uint8_t> client_id;
+        readShortData(buffer, client_id);
+        const uint32_t valid_lft = buffer.readUint32();
+        const int64_t cltt = readInt64(buffer);
+        const SubnetID subnet_id = buffer.readUint32();
+
+        lease.reset(new Lease4(addr, hwaddr,
+                               client_id.empty() ? NULL : &client_id[0],
+                               client_id.size(), valid_lft, 0, 0,
+                               static_cast<time_t>(cltt), subnet_id));
+        readFqdnFlags(buffer, *lease);
+        lease->hostname_ = readHostname(buffer);
+        lease->state_ = buffer.readUint32();
+        checkRecordEnd(buffer);
+
+        if (!hwaddr && (lease->state_ != Lease::STATE_DECLINED)) {
+            isc_throw(isc::BadValue, "A blank hardware address is only"
+                      " valid for declined leases");
+        }
+
+    } catch (const std::exception& ex) {
+        // bump the read error count
+        ++read_errs_;
+
+        // The lease might have been created, so let's set it back to NULL to
+        // signal that lease hasn't been parsed.
+        lease.reset();
+        setReadMsg(ex.what());
+        return (false);
+    }
+
+    // bump the number of leases read
+    ++read_leases_;
+
+    return (true);
+}
+
+BinaryLeaseFile6::BinaryLeaseFile6(const std::string& filename)
+    : BinaryLeaseFile(filename, 6) {
+}
+
+void
+BinaryLeaseFile6::append(const Lease6& lease) {
+    // Bump the number of write attempts
+    ++writes_;
+
+    if (!lease.duid_) {
+        // Bump the error counter
+        ++write_errs_;
+
+        isc_throw(BadValue, "Lease6 must have DUID specified.");
+    }
+
+    try {
+        OutputBuffer payload(96);
+        const std::vector<uint8_t>& addr = lease.addr_.toBytes();
+        payload.writeData(&addr[0], addr.size());
+        payload.writeUint8(static_cast<uint8_t>(lease.type_));
+        payload.writeUint8(lease.prefixlen_);
+        writeShortData(payload, lease.duid_->getDuid(), "DUID");
+        payload.writeUint32(lease.iaid_);
+        payload.writeUint32(lease.preferred_lft_);
+        payload.writeUint32(lease.valid_lft_);
+        writeInt64(payload, lease.cltt_);
+        payload.writeUint32(lease.subnet_id_);
+        writeFqdnFlags(payload, lease);
+        writeHostname(payload, lease.hostname_);
+        writeHWAddr(payload, lease.hwaddr_);
+        payload.writeUint32(lease.state_);
+        appendRecord(payload);
+
+    } catch (const std::exception&) {
+        // Catch any errors so we can bump the error counter than rethrow it
+        ++write_errs_;
+        throw;
+    }
+
+    // Bump the number of leases written
+    ++write_leases_;
+}
+
+bool
+BinaryLeaseFile6::next(Lease6Ptr& lease) {
+    // Bump the number of read attempts
+    ++reads_;
+
+    try {
+        std::vector<uint8_t> payload;
+        nextRecord(payload);
+        // The empty record signals EOF.
+        if (payload.empty()) {
+            lease.reset();
+            return (true);
+        }
+
+        InputBuffer buffer(&payload[0], payload.size());
+        std::vector<uint8_t> addr;
+        buffer.readVector(addr, 16);
+        const uint8_t type = buffer.readUint8();
+        if (type > static_cast<uint8_t>(Lease::TYPE_PD)) {
+            isc_throw(isc::BadValue, "invalid lease type "
+                      << static_cast<int>(type));
+        }
+        const uint8_t prefixlen = buffer.readUint8();
+        std::vector<uint8_t> duid;
+        readShortData(buffer, duid);
+        const uint32_t iaid = buffer.readUint32();
+        const uint32_t preferred_lft = buffer.readUint32();
+        const uint32_t valid_lft = buffer.readUint32();
+        const int64_t cltt = readInt64(buffer);
+        const SubnetID subnet_id = buffer.readUint32();
+
+        lease.reset(new Lease6(static_cast<Lease::Type>(type),
+                               IOAddress::fromBytes(AF_INET6, &addr[0]),
+                               DuidPtr(new DUID(duid)), iaid, preferred_lft,
+                               valid_lft, 0, 0, subnet_id, HWAddrPtr(),
+                               prefixlen));
+        lease->cltt_ = static_cast<time_t>(cltt);
+        readFqdnFlags(buffer, *lease);
+        lease->hostname_ = readHostname(buffer);
+        lease->hwaddr_ = readHWAddr(buffer);
+        lease->state_ = buffer.readUint32();
+        checkRecordEnd(buffer);
+
+        if ((*lease->duid_ == DUID::EMPTY())
+            && lease->state_ != Lease::STATE_DECLINED) {
+            isc_throw(isc::BadValue, "The Empty DUID is"
+                      "only valid for declined leases");
+        }
+
+    } catch (const std::exception& ex) {
+        // bump the read error count
+        ++read_errs_;
+
+        // The lease might have been created, so let's set it back to NULL to
+        // signal that lease hasn't been parsed.
+        lease.reset();
+        setReadMsg(ex.what());
+        return (false);
+    }
+
+    // bump the number of leases read
+    ++read_leases_;
+
+    return (true);
+}
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
@@ -0,0 +1,221 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef BINARY_LEASE_FILE_H
+#define BINARY_LEASE_FILE_H
+
+#include <dhcpsrv/lease.h>
+#include <dhcpsrv/lease_file_stats.h>
+#include <util/buffer.h>
+#include <util/versioned_csv_file.h>
+#include <boost/noncopyable.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <fstream>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Base class for the lease files holding leases in the binary
+/// format.
+///
+/// The binary lease file is a compact alternative to the CSV lease file,
+/// used by the Memfile backend for the lease snapshots produced by the
+/// lease file cleanup. Reading the binary records doesn't involve the
+/// text conversions and the column validation of the CSV files, so the
+/// snapshot is loaded much faster and takes less space on disk.
+///
+/// The file begins with the header holding the magic value, the version
+/// of the format and the universe of the leases. The header is followed
+/// by the records, each holding a single lease:
+///
+/// - length of the encoded lease (32 bits),
+/// - encoded lease,
+/// - CRC-32 of the encoded lease (32 bits).
+///
+/// All numbers are stored in network byte order. The record with the
+/// invalid checksum is skipped and reported as a read error, so as the
+/// remaining leases can still be read. If the length of the record is
+/// invalid or the record is truncated, the remaining part of the file
+/// can't be read.
+///
+/// The class provides the same functions as the @c CSVLeaseFile4 and
+/// @c CSVLeaseFile6 used by the @c LeaseFileLoader.
+class BinaryLeaseFile : public LeaseFileStats, public boost::noncopyable {
+public:
+
+    /// @brief Version of the format written by this class.
+    static const uint16_t FORMAT_VERSION = 1;
+
+    /// @brief Maximum length of the encoded lease.
+    static const uint32_t MAX_RECORD_LENGTH = 65535;
+
+    /// @brief Constructor.
+    ///
+    /// @param filename Name of the lease file.
+    /// @param universe 4 for DHCPv4 leases, 6 for DHCPv6 leases.
+    BinaryLeaseFile(const std::string& filename, const uint16_t universe);
+
+    /// @brief Destructor.
+    ///
+    /// Closes the file.
+    virtual ~BinaryLeaseFile();
+
+    /// @brief Checks if the file holds leases in the binary format.
+    ///
+    /// @param filename Name of the file.
+    /// @return true if the file exists and begins with the magic value
+    /// of the binary lease file.
+    static bool isBinary(const std::string& filename);
+
+    /// @brief Returns the name of the file.
+    std::string getFilename() const {
+        return (filename_);
+    }
+
+    /// @brief Checks if the file exists.
+    bool exists() const;
+
+    /// @brief Opens the existing file for reading.
+    ///
+    /// The header is read and verified. It also clears the statistics.
+    ///
+    /// @throw isc::util::CSVFileError if the file can't be opened or
+    /// its header is invalid.
+    void open();
+
+    /// @brief Creates the new file, removing the existing file.
+    ///
+    /// The header is written to the file, which is left open for
+    /// appending leases.
+    ///
+    /// @throw isc::util::CSVFileError if the file can't be created.
+    void recreate();
+
+    /// @brief Closes the file.
+    ///
+    /// The pending writes are flushed to disk.
+    void close();
+
+    /// @brief Returns the description of the last read error.
+    std::string getReadMsg() const {
+        return (read_msg_);
+    }
+
+    /// @brief Indicates if the file must be converted.
+    ///
+    /// There is only one version of the binary format, so the file
+    /// never needs the conversion.
+    bool needsConversion() const {
+        return (false);
+    }
+
+    /// @brief Returns the state of the file schema.
+    ///
+    /// This function is provided for compatibility with the CSV lease
+    /// files and it always returns @c util::VersionedCSVFile::CURRENT.
+    util::VersionedCSVFile::InputSchemaState getInputSchemaState() const {
+        return (util::VersionedCSVFile::CURRENT);
+    }
+
+    /// @brief Returns the version of the format as text.
+    std::string getSchemaVersion() const;
+
+protected:
+
+    /// @brief Appends the encoded lease to the file.
+    ///
+    /// @param payload Buffer holding the encoded lease.
+    /// @throw isc::util::CSVFileError if the file is not open or the
+    /// write fails.
+    void appendRecord(const util::OutputBuffer& payload);
+
+    /// @brief Reads the next encoded lease from the file.
+    ///
+    /// @param [out] payload Encoded lease. It is empty at the end of file.
+    /// @throw isc::util::CSVFileError if the record can't be read or its
+    /// checksum is invalid.
+    void nextRecord(std::vector<uint8_t>& payload);
+
+    /// @brief Sets the description of the last read error.
+    ///
+    /// @param read_msg Description of the error.
+    void setReadMsg(const std::string& read_msg) {
+        read_msg_ = read_msg;
+    }
+
+private:
+
+    /// @brief Name of the file.
+    std::string filename_;
+
+    /// @brief Universe of the leases held in the file.
+    uint16_t universe_;
+
+    /// @brief Stream used to read or write the file.
+    boost::scoped_ptr<std::fstream> fs_;
+
+    /// @brief Indicates that the remaining part of the file can't be read.
+    bool read_failed_;
+
+    /// @brief Description of the last read error.
+    std::string read_msg_;
+};
+
+/// @brief Binary lease file holding DHCPv4 leases.
+class BinaryLeaseFile4 : public BinaryLeaseFile {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param filename Name of the lease file.
+    explicit BinaryLeaseFile4(const std::string& filename);
+
+    /// @brief Appends the lease to the file.
+    ///
+    /// @param lease Lease to be appended.
+    /// @throw isc::BadValue if the lease has no hardware address.
+    /// @throw isc::util::CSVFileError if the write fails.
+    void append(const Lease4& lease);
+
+    /// @brief Reads the next lease from the file.
+    ///
+    /// @param [out] lease Lease read, or null pointer at the end of file.
+    /// @return true if the lease has been read or the end of file has
+    /// been reached, false if the lease can't be read.
+    bool next(Lease4Ptr& lease);
+};
+
+/// @brief Binary lease file holding DHCPv6 leases.
+class BinaryLeaseFile6 : public BinaryLeaseFile {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param filename Name of the lease file.
+    explicit BinaryLeaseFile6(const std::string& filename);
+
+    /// @brief Appends the lease to the file.
+    ///
+    /// @param lease Lease to be appended.
+    /// @throw isc::BadValue if the lease has no DUID.
+    /// @throw isc::util::CSVFileError if the write fails.
+    void append(const Lease6& lease);
+
+    /// @brief Reads the next lease from the file.
+    ///
+    /// @param [out] lease Lease read, or null pointer at the end of file.
+    /// @return true if the lease has been read or the end of file has
+    /// been reached, false if the lease can't be read.
+    bool next(Lease6Ptr& lease);
+};
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
+
+#endif // BINARY_LEASE_FILE_H
@@ -19,23 +19,24 @@ namespace dhcp {
 /// isc::hooks::CalloutHandle object with each request passing through the
 /// server.  For the DHCP servers, the association is provided by this function.
 ///
-/// The DHCP servers process a single request at a time. At points where the
-/// CalloutHandle is required, the pointer to the current request (packet) is
-/// passed to this function.  If the request is a new one, a pointer to
-/// the request is stored, a new CalloutHandle is allocated (and stored) and
-/// a pointer to the latter object returned to the caller.  If the request
-/// matches the one stored, the pointer to the stored CalloutHandle is
-/// returned.
+/// Each thread of the DHCP server processes a single request at a time. At
+/// points where the CalloutHandle is required, the pointer to the current
+/// request (packet) is passed to this function.  If the request is a new
+/// one, a pointer to the request is stored, a new CalloutHandle is allocated
+/// (and stored) and a pointer to the latter object returned to the caller.
+/// If the request matches the one stored, the pointer to the stored
+/// CalloutHandle is returned.
+///
+/// The stored pointers are thread local, so that packets processed
+/// concurrently by the packet processing threads get their own handles.
 ///
 /// A special case is a null pointer being passed.  This has the effect of
 /// clearing the stored pointers to the packet being processed and
-/// CalloutHandle.  As the stored pointers are shared pointers, clearing them
-/// removes one reference that keeps the pointed-to objects in existence.
-///
-/// @note If the behaviour of the server changes so that multiple packets can
-///       be active at the same time, this simplistic approach will no longer
-///       be adequate and a more complicated structure (such as a map) will
-///       be needed.
+/// CalloutHandle by the calling thread.  As the stored pointers are shared
+/// pointers, clearing them removes one reference that keeps the pointed-to
+/// objects in existence. The packet processing threads should do it when
+/// they are done with a packet, so as they don't hold references to the
+/// objects created by hooks libraries which may be unloaded.
 ///
 /// @param pktptr Pointer to the packet being processed.  This is typically a
 ///        Pkt4Ptr or Pkt6Ptr object.  An empty pointer is passed to clear
@@ -49,9 +50,10 @@ namespace dhcp {
 template <typename T>
 isc::hooks::CalloutHandlePtr getCalloutHandle(const T& pktptr) {
 
-    // Stored data is declared static, so is initialized when first accessed
-    static T stored_pointer;                // Pointer to last packet seen
-    static isc::hooks::CalloutHandlePtr stored_handle;
+    // Stored data is declared static, so is initialized when first accessed.
+    // It is thread local because packets may be processed concurrently.
+    static thread_local T stored_pointer;   // Pointer to last packet seen
+    static thread_local isc::hooks::CalloutHandlePtr stored_handle;
                                             // Pointer to stored handle
 
     if (pktptr) {
@@ -81,7 +81,17 @@ CfgDbAccess::toElementDbAccessString(const std::string& dbaccess) {
             std::string value = token.substr(pos + 1);
             if ((keyword == "lfc-interval") ||
                 (keyword == "connect-timeout") ||
-                (keyword == "port")) {
+                (keyword == "port") ||
+                (keyword == "group-commit-max-batch") ||
+                (keyword == "group-commit-max-latency") ||
+                (keyword == "load-threads") ||
+                (keyword == "lfc-batch-size") ||
+                (keyword == "lfc-batch-interval") ||
+                (keyword == "cache-size") ||
+                (keyword == "cache-ttl") ||
+                (keyword == "cache-negative-ttl") ||
+                (keyword == "connection-pool-size") ||
+                (keyword == "reconnect-wait-time")) {
                 // integer parameters
                 int64_t int_value;
                 try {
@@ -93,7 +103,11 @@ CfgDbAccess::toElementDbAccessString(const std::string& dbaccess) {
                               << keyword << "=" << value);
                 }
             } else if ((keyword == "persist") ||
-                       (keyword == "readonly")) {
+                       (keyword == "readonly") ||
+                       (keyword == "packed") ||
+                       (keyword == "group-commit") ||
+                       (keyword == "group-commit-sync") ||
+                       (keyword == "lfc-in-process")) {
                 if (value == "true") {
                     result->set(keyword, Element::create(true));
                 } else if (value == "false") {
@@ -0,0 +1,131 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/cfg_option_set.h>
+#include <algorithm>
+
+using namespace isc::util::thread;
+
+namespace {
+
+/// @brief Compares the codes of two options.
+///
+/// @param a first code and option
+/// @param b second code and option
+/// @return true if the first code is lower
+bool
+lowerCode(const std::pair<uint16_t, isc::dhcp::OptionPtr>& a,
+          const std::pair<uint16_t, isc::dhcp::OptionPtr>& b) {
+    return (a.first < b.first);
+}
+
+}
+
+namespace isc {
+namespace dhcp {
+
+const size_t CfgOptionSetCache::MAX_SIZE;
+
+CfgOptionSet::CfgOptionSet(const CfgOptionList& co_list,
+                           const std::string& option_space)
+    : co_list_(co_list), option_space_(option_space), options_(),
+      persistent_codes_() {
+    for (CfgOptionList::const_iterator copts = co_list_.begin();
+         copts != co_list_.end(); ++copts) {
+        const OptionContainerPtr& opts = (*copts)->getAll(option_space_);
+        if (!opts) {
+            continue;
+        }
+        for (OptionContainer::const_iterator desc = opts->begin();
+             desc != opts->end(); ++desc) {
+            if (!desc->option_) {
+                continue;
+            }
+            const uint16_t code = desc->option_->getType();
+            options_.push_back(CodeAndOption(code, desc->option_));
+            if (desc->persistent_ &&
+                (std::find(persistent_codes_.begin(), persistent_codes_.end(),
+                           code) == persistent_codes_.end())) {
+                persistent_codes_.push_back(code);
+            }
+        }
+    }
+
+    // Keep the first option of each code, i.e. the one configured with
+    // the highest priority.
+    std::stable_sort(options_.begin(), options_.end(), lowerCode);
+    std::vector<CodeAndOption> unique;
+    unique.reserve(options_.size());
+    for (std::vector<CodeAndOption>::const_iterator it = options_.begin();
+         it != options_.end(); ++it) {
+        if (unique.empty() || (unique.back().first != it->first)) {
+            unique.push_back(*it);
+        }
+    }
+    options_.swap(unique);
+}
+
+OptionPtr
+CfgOptionSet::get(const uint16_t code) const {
+    std::vector<CodeAndOption>::const_iterator it =
+        std::lower_bound(options_.begin(), options_.end(),
+                         CodeAndOption(code, OptionPtr()), lowerCode);
+    if ((it != options_.end()) && (it->first == code)) {
+        return (it->second);
+    }
+    return (OptionPtr());
+}
+
+CfgOptionSetCache::CfgOptionSetCache()
+    : sets_(), mutex_() {
+}
+
+ConstCfgOptionSetPtr
+CfgOptionSetCache::get(const CfgOptionList& co_list,
+                       const std::string& option_space) {
+    Key key;
+    key.first = option_space;
+    key.second.reserve(co_list.size());
+    for (CfgOptionList::const_iterator copts = co_list.begin();
+         copts != co_list.end(); ++copts) {
+        key.second.push_back(copts->get());
+    }
+
+    {
+        Mutex::Locker lock(mutex_);
+        std::map<Key, ConstCfgOptionSetPtr>::const_iterator it = sets_.find(key);
+        if (it != sets_.end()) {
+            return (it->second);
+        }
+    }
+
+    // Resolve the set without holding the lock. Another thread may resolve
+    // the same set concurrently, in which case the first one is kept.
+    ConstCfgOptionSetPtr set(new CfgOptionSet(co_list, option_space));
+
+    Mutex::Locker lock(mutex_);
+    if (sets_.size() >= MAX_SIZE) {
+        sets_.clear();
+    }
+    return (sets_.insert(std::make_pair(key, set)).first->second);
+}
+
+size_t
+CfgOptionSetCache::size() const {
+    Mutex::Locker lock(mutex_);
+    return (sets_.size());
+}
+
+void
+CfgOptionSetCache::clear() {
+    Mutex::Locker lock(mutex_);
+    sets_.clear();
+}
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
@@ -0,0 +1,154 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef CFG_OPTION_SET_H
+#define CFG_OPTION_SET_H
+
+#include <dhcp/option.h>
+#include <dhcpsrv/cfg_option.h>
+#include <util/threads/sync.h>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+#include <stdint.h>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Options of an option space resolved from a list of option
+/// configurations.
+///
+/// The server looks up the options to be sent to a client in a list of
+/// option configurations ordered by priority, e.g. the subnet, shared
+/// network, client classes and global options. This class resolves the
+/// list once: for each option code it holds the option configured in the
+/// first configuration of the list, and it holds the codes of the options
+/// which are always sent (persistent options). Looking up an option is
+/// then a single binary search instead of a search in each configuration.
+///
+/// The object keeps the option configurations it was built from, so it
+/// must not outlive the validity of these configurations, i.e. it is
+/// discarded when the server is reconfigured.
+class CfgOptionSet : public boost::noncopyable {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param co_list option configurations, by decreasing priority
+    /// @param option_space option space of the options
+    CfgOptionSet(const CfgOptionList& co_list, const std::string& option_space);
+
+    /// @brief Returns the option to be sent for a code.
+    ///
+    /// @param code option code
+    /// @return the option configured with the highest priority or null
+    OptionPtr get(const uint16_t code) const;
+
+    /// @brief Returns the codes of the persistent options.
+    ///
+    /// Each code appears once, in the order of the configurations. The
+    /// option sent for a code is returned by @ref get, which may not be
+    /// persistent if it has a higher priority.
+    const std::vector<uint16_t>& getPersistentCodes() const {
+        return (persistent_codes_);
+    }
+
+    /// @brief Returns the option configurations.
+    const CfgOptionList& getCfgOptionList() const {
+        return (co_list_);
+    }
+
+    /// @brief Returns the option space.
+    const std::string& getOptionSpace() const {
+        return (option_space_);
+    }
+
+private:
+
+    /// @brief Option and its code.
+    typedef std::pair<uint16_t, OptionPtr> CodeAndOption;
+
+    /// @brief Option configurations the set was built from.
+    CfgOptionList co_list_;
+
+    /// @brief Option space.
+    std::string option_space_;
+
+    /// @brief Options sorted by code.
+    std::vector<CodeAndOption> options_;
+
+    /// @brief Codes of the persistent options.
+    std::vector<uint16_t> persistent_codes_;
+};
+
+/// @brief Pointer to a @c CfgOptionSet.
+typedef boost::shared_ptr<CfgOptionSet> CfgOptionSetPtr;
+
+/// @brief Pointer to a const @c CfgOptionSet.
+typedef boost::shared_ptr<const CfgOptionSet> ConstCfgOptionSetPtr;
+
+/// @brief Cache of resolved option sets.
+///
+/// The clients of a subnet belonging to the same classes are sent the
+/// options resolved from the same list of option configurations. The
+/// cache returns the set resolved for a list, resolving it on the first
+/// use. The cache belongs to the server configuration, so the sets are
+/// discarded when a new configuration is committed.
+///
+/// The cache is shared by the packet processing threads and protected by
+/// a mutex.
+class CfgOptionSetCache : public boost::noncopyable {
+public:
+
+    /// @brief Maximum number of sets held.
+    ///
+    /// The cache is cleared when it is full, which should only happen with
+    /// a huge number of subnets and class combinations.
+    static const size_t MAX_SIZE = 8192;
+
+    /// @brief Constructor.
+    CfgOptionSetCache();
+
+    /// @brief Returns the set resolved from a list of option configurations.
+    ///
+    /// @param co_list option configurations, by decreasing priority
+    /// @param option_space option space of the options
+    /// @return the cached set or a new one
+    ConstCfgOptionSetPtr get(const CfgOptionList& co_list,
+                             const std::string& option_space);
+
+    /// @brief Returns the number of cached sets.
+    size_t size() const;
+
+    /// @brief Discards the cached sets.
+    void clear();
+
+private:
+
+    /// @brief Key of a set: the option space and the configurations.
+    ///
+    /// The configurations are identified by their address. They can't be
+    /// destroyed and their address reused while the set is cached because
+    /// the set holds them.
+    typedef std::pair<std::string, std::vector<const CfgOption*> > Key;
+
+    /// @brief Cached sets.
+    std::map<Key, ConstCfgOptionSetPtr> sets_;
+
+    /// @brief Mutex protecting the cached sets.
+    mutable isc::util::thread::Mutex mutex_;
+};
+
+/// @brief Pointer to a @c CfgOptionSetCache.
+typedef boost::shared_ptr<CfgOptionSetCache> CfgOptionSetCachePtr;
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
+
+#endif // CFG_OPTION_SET_H
@@ -14,6 +14,7 @@
 #include <dhcpsrv/addr_utilities.h>
 #include <asiolink/io_address.h>
 #include <stats/stats_mgr.h>
+#include <algorithm>
 #include <sstream>
 
 using namespace isc::asiolink;
@@ -22,6 +23,10 @@ using namespace isc::data;
 namespace isc {
 namespace dhcp {
 
+CfgSubnets4::CfgSubnets4()
+    : subnets_(), indexed_(false) {
+}
+
 void
 CfgSubnets4::add(const Subnet4Ptr& subnet) {
     if (getBySubnetId(subnet->getID())) {
@@ -38,6 +43,7 @@ CfgSubnets4::add(const Subnet4Ptr& subnet) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE, DHCPSRV_CFGMGR_ADD_SUBNET4)
               .arg(subnet->toText());
     subnets_.push_back(subnet);
+    indexed_ = false;
 }
 
 void
@@ -49,11 +55,73 @@ CfgSubnets4::del(const ConstSubnet4Ptr& subnet) {
                   << "' found");
     }
     index.erase(subnet_it);
+    indexed_ = false;
 
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE, DHCPSRV_CFGMGR_DEL_SUBNET4)
         .arg(subnet->toText());
 }
 
+void
+CfgSubnets4::buildSelectionIndexes() {
+    indexed_subnets_.clear();
+    prefix_index_.clear();
+    relay_index_.clear();
+    iface_index_.clear();
+    prefix4o6_index_.clear();
+    interface_id4o6_index_.clear();
+    iface4o6_index_.clear();
+
+    indexed_subnets_.reserve(subnets_.size());
+    for (Subnet4Collection::const_iterator subnet = subnets_.begin();
+         subnet != subnets_.end(); ++subnet) {
+        const size_t position = indexed_subnets_.size();
+        indexed_subnets_.push_back(*subnet);
+
+        std::pair<IOAddress, uint8_t> prefix = (*subnet)->get();
+        prefix_index_.add(prefix.first, prefix.second, position);
+
+        // The relay address and the interface name specified for the
+        // subnet take precedence over the values specified for the
+        // shared network.
+        SharedNetwork4Ptr network;
+        (*subnet)->getSharedNetwork(network);
+        IOAddress relay = (*subnet)->getRelayInfo().addr_;
+        if (relay.isV4Zero() && network) {
+            relay = network->getRelayInfo().addr_;
+        }
+        if (!relay.isV4Zero()) {
+            relay_index_.add(relay, position);
+        }
+
+        std::string iface = (*subnet)->getIface();
+        if (iface.empty() && network) {
+            iface = network->getIface();
+        }
+        if (!iface.empty()) {
+            iface_index_.add(iface, position);
+        }
+
+        Cfg4o6& cfg4o6 = (*subnet)->get4o6();
+        if (cfg4o6.enabled()) {
+            std::pair<IOAddress, uint8_t> pref = cfg4o6.getSubnet4o6();
+            if (!pref.first.isV6Zero()) {
+                prefix4o6_index_.add(pref.first, pref.second, position);
+            }
+            if (cfg4o6.getInterfaceId()) {
+                OptionPtr interface_id = cfg4o6.getInterfaceId();
+                interface_id4o6_index_.add(InterfaceIdKey(interface_id->getType(),
+                                                          interface_id->getData()),
+                                           position);
+            }
+            if (!cfg4o6.getIface4o6().empty()) {
+                iface4o6_index_.add(cfg4o6.getIface4o6(), position);
+            }
+        }
+    }
+
+    indexed_ = true;
+}
+
 ConstSubnet4Ptr
 CfgSubnets4::getBySubnetId(const SubnetID& subnet_id) const {
     const auto& index = subnets_.get<SubnetSubnetIdIndexTag>();
@@ -78,6 +146,24 @@ CfgSubnets4::hasSubnetWithServerId(const asiolink::IOAddress& server_id) const {
 Subnet4Ptr
 CfgSubnets4::selectSubnet4o6(const SubnetSelector& selector) const {
 
+    if (indexed_) {
+        // The first subnet matching any of the criteria is selected.
+        size_t found = prefix4o6_index_.find(selector.remote_address_,
+                                             AnySubnet());
+        if (selector.interface_id_) {
+            found = std::min(found, interface_id4o6_index_.
+                             find(InterfaceIdKey(selector.interface_id_->getType(),
+                                                 selector.interface_id_->getData()),
+                                  AnySubnet()));
+        }
+        if (!selector.iface_name_.empty()) {
+            found = std::min(found, iface4o6_index_.find(selector.iface_name_,
+                                                         AnySubnet()));
+        }
+        return (found != NO_SUBNET_POSITION ? indexed_subnets_[found] :
+                Subnet4Ptr());
+    }
+
     for (Subnet4Collection::const_iterator subnet = subnets_.begin();
          subnet != subnets_.end(); ++subnet) {
         Cfg4o6& cfg4o6 = (*subnet)->get4o6();
@@ -131,7 +217,15 @@ CfgSubnets4::selectSubnet(const SubnetSelector& selector) const {
     // possible that the relay address will not match with any of the relay
     // addresses across all subnets, but we need to verify that for all subnets
     // before we can try to use the giaddr to match with the subnet prefix.
-    if (!selector.giaddr_.isV4Zero()) {
+    if (!selector.giaddr_.isV4Zero() && indexed_) {
+        ClientSupportedSubnet<Subnet4Ptr> supported(indexed_subnets_,
+                                                    selector.client_classes_);
+        const size_t found = relay_index_.find(selector.giaddr_, supported);
+        if (found != NO_SUBNET_POSITION) {
+            return (indexed_subnets_[found]);
+        }
+
+    } else if (!selector.giaddr_.isV4Zero()) {
         for (Subnet4Collection::const_iterator subnet = subnets_.begin();
              subnet != subnets_.end(); ++subnet) {
 
@@ -219,6 +313,20 @@ CfgSubnets4::selectSubnet(const SubnetSelector& selector) const {
 Subnet4Ptr
 CfgSubnets4::selectSubnet(const std::string& iface,
                           const ClientClasses& client_classes) const {
+    if (indexed_) {
+        ClientSupportedSubnet<Subnet4Ptr> supported(indexed_subnets_,
+                                                    client_classes);
+        const size_t found = iface_index_.find(iface, supported);
+        if (found == NO_SUBNET_POSITION) {
+            return (Subnet4Ptr());
+        }
+        LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE,
+                  DHCPSRV_CFGMGR_SUBNET4_IFACE)
+            .arg(indexed_subnets_[found]->toText())
+            .arg(iface);
+        return (indexed_subnets_[found]);
+    }
+
     for (Subnet4Collection::const_iterator subnet = subnets_.begin();
          subnet != subnets_.end(); ++subnet) {
 
@@ -275,6 +383,19 @@ CfgSubnets4::getSubnet(const SubnetID id) const {
 Subnet4Ptr
 CfgSubnets4::selectSubnet(const IOAddress& address,
                  const ClientClasses& client_classes) const {
+    if (indexed_) {
+        ClientSupportedSubnet<Subnet4Ptr> supported(indexed_subnets_,
+                                                    client_classes);
+        const size_t found = prefix_index_.find(address, supported);
+        if (found == NO_SUBNET_POSITION) {
+            return (Subnet4Ptr());
+        }
+        LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE, DHCPSRV_CFGMGR_SUBNET4_ADDR)
+            .arg(indexed_subnets_[found]->toText())
+            .arg(address.toText());
+        return (indexed_subnets_[found]);
+    }
+
     for (Subnet4Collection::const_iterator subnet = subnets_.begin();
          subnet != subnets_.end(); ++subnet) {
 
@@ -297,7 +418,7 @@ CfgSubnets4::selectSubnet(const IOAddress& address,
 }
 
 void
-CfgSubnets4::removeStatistics() {
+CfgSubnets4::removeStatistics(const ConstCfgSubnets4Ptr& next) {
     using namespace isc::stats;
 
     // For each v4 subnet currently configured, remove the statistic.
@@ -305,6 +426,22 @@ CfgSubnets4::removeStatistics() {
     for (Subnet4Collection::const_iterator subnet4 = subnets_.begin();
          subnet4 != subnets_.end(); ++subnet4) {
         SubnetID subnet_id = (*subnet4)->getID();
+
+        // The statistics of the subnet are updated by the new configuration.
+        if (next && next->getBySubnetId(subnet_id)) {
+            continue;
+        }
+
+        // The declined addresses of the removed subnet no longer count
+        // in the global statistic.
+        ObservationPtr declined =
+            stats_mgr.getObservation(StatsMgr::generateName("subnet", subnet_id,
+                                                            "declined-addresses"));
+        if (declined && stats_mgr.getObservation("declined-addresses")) {
+            stats_mgr.addValue("declined-addresses",
+                               -declined->getInteger().first);
+        }
+
         stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
                                              "total-addresses"));
 
@@ -323,10 +460,11 @@ CfgSubnets4::removeStatistics() {
 }
 
 void
-CfgSubnets4::updateStatistics() {
+CfgSubnets4::updateStatistics(const ConstCfgSubnets4Ptr& previous) {
     using namespace isc::stats;
 
     StatsMgr& stats_mgr = StatsMgr::instance();
+    SubnetIDSet recount;
     for (Subnet4Collection::const_iterator subnet4 = subnets_.begin();
          subnet4 != subnets_.end(); ++subnet4) {
         SubnetID subnet_id = (*subnet4)->getID();
@@ -336,11 +474,32 @@ CfgSubnets4::updateStatistics() {
                                         static_cast<int64_t>
                                         ((*subnet4)->getPoolCapacity(Lease::
                                                                      TYPE_V4)));
+
+        // Recount the leases unless the subnet hasn't changed and its
+        // lease statistics are still in place.
+        ConstSubnet4Ptr previous_subnet = previous ?
+            previous->getBySubnetId(subnet_id) : ConstSubnet4Ptr();
+        if (!previous_subnet ||
+            (previous_subnet->toText() != (*subnet4)->toText()) ||
+            !previous_subnet->hasSamePools(**subnet4, Lease::TYPE_V4) ||
+            !stats_mgr.getObservation(StatsMgr::
+                                      generateName("subnet", subnet_id,
+                                                   "assigned-addresses"))) {
+            recount.insert(subnet_id);
+        }
+    }
+
+    // Only recount the stats if we have subnets to recount.
+    if (recount.empty()) {
+        return;
     }
 
-    // Only recount the stats if we have subnets.
-    if (subnets_.begin() != subnets_.end()) {
-            LeaseMgrFactory::instance().recountLeaseStats4();
+    // Recount all leases when none of the subnets has been kept, e.g.
+    // when the server is configured for the first time.
+    if (!previous || (recount.size() == subnets_.size())) {
+        LeaseMgrFactory::instance().recountLeaseStats4();
+    } else {
+        LeaseMgrFactory::instance().recountLeaseStats4(recount);
     }
 }
 
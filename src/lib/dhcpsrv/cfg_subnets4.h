@@ -11,13 +11,28 @@
 #include <cc/cfg_to_element.h>
 #include <dhcpsrv/subnet.h>
 #include <dhcpsrv/subnet_id.h>
+#include <dhcpsrv/subnet_selection_index.h>
 #include <dhcpsrv/subnet_selector.h>
 #include <boost/shared_ptr.hpp>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace isc {
 namespace dhcp {
 
+class CfgSubnets4;
+
+/// @name Pointer to the @c CfgSubnets4 objects.
+//@{
+/// @brief Non-const pointer.
+typedef boost::shared_ptr<CfgSubnets4> CfgSubnets4Ptr;
+
+/// @brief Const pointer.
+typedef boost::shared_ptr<const CfgSubnets4> ConstCfgSubnets4Ptr;
+
+//@}
+
 /// @brief Holds subnets configured for the DHCPv4 server.
 ///
 /// This class holds a collection of subnets configured for the DHCPv4 server.
@@ -28,9 +43,18 @@ namespace dhcp {
 ///
 /// See @c CfgSubnets4::selectSubnet documentation for more details on how the
 /// subnet is selected for the client.
+///
+/// When the configuration is committed, the indexes used for the subnet
+/// selection are built (see @c CfgSubnets4::buildSelectionIndexes), so as
+/// the subnet is selected without iterating over all subnets. Adding or
+/// removing a subnet invalidates the indexes and the subnets are selected
+/// by iterating over them until the indexes are built again.
 class CfgSubnets4 : public isc::data::CfgToElement {
 public:
 
+    /// @brief Constructor.
+    CfgSubnets4();
+
     /// @brief Adds new subnet to the configuration.
     ///
     /// @param subnet Pointer to the subnet being added.
@@ -46,6 +70,21 @@ public:
     /// @throw isc::BadValue if such subnet doesn't exist.
     void del(const ConstSubnet4Ptr& subnet);
 
+    /// @brief Builds the indexes used for the subnet selection.
+    ///
+    /// The subnets are indexed by prefix, relay address (specified for
+    /// the subnet or its shared network), interface name and DHCPv4o6
+    /// parameters. The indexes are built when the configuration is
+    /// committed and must be rebuilt when any of these parameters is
+    /// modified for any subnet afterwards.
+    void buildSelectionIndexes();
+
+    /// @brief Checks if the indexes used for the subnet selection are
+    /// up to date.
+    bool hasSelectionIndexes() const {
+        return (indexed_);
+    }
+
     /// @brief Returns pointer to the collection of all IPv4 subnets.
     ///
     /// This is used in a hook (subnet4_select), where the hook is able
@@ -131,13 +170,9 @@ public:
     ///
     /// If the address matches with a subnet, the subnet is returned.
     ///
-    /// @todo This method requires performance improvement! It currently
-    /// iterates over all existing subnets (possibly a couple of times)
-    /// to find the one which fulfills the search criteria. The subnet storage
-    /// is implemented as a simple STL vector which precludes fast searches
-    /// using specific keys. Hence, full scan is required. To improve the
-    /// search performance a different container type is required, e.g.
-    /// multi-index container, or something of a similar functionality.
+    /// If the selection indexes have been built, the relay addresses and
+    /// the prefixes are matched using the indexes, rather than iterating
+    /// over all subnets.
     ///
     /// @param selector Const reference to the selector structure which holds
     /// various information extracted from the client's packet which are used
@@ -163,14 +198,6 @@ public:
     /// testing. This method is also called by the
     /// @c selectSubnet(SubnetSelector).
     ///
-    /// @todo This method requires performance improvement! It currently
-    /// iterates over all existing subnets to find the one which fulfills
-    /// the search criteria. The subnet storage is implemented as a simple
-    /// STL vector which precludes fast searches using specific keys.
-    /// Hence, full scan is required. To improve the search performance a
-    /// different container type is required, e.g. multi-index container,
-    /// or something of a similar functionality.
-    ///
     /// @param address Address for which the subnet is searched.
     /// @param client_classes Optional parameter specifying the classes that
     /// the client belongs to.
@@ -188,14 +215,6 @@ public:
     /// not match a subnet definition. This method is also called by the
     /// @c selectSubnet(SubnetSelector).
     ///
-    /// @todo This method requires performance improvement! It currently
-    /// iterates over all existing subnets to find the one which fulfills
-    /// the search criteria. The subnet storage is implemented as a simple
-    /// STL vector which precludes fast searches using specific keys.
-    /// Hence, full scan is required. To improve the search performance a
-    /// different container type is required, e.g. multi-index container,
-    /// or something of a similar functionality.
-    ///
     /// @param iface name of the interface to be matched.
     /// @param client_classes Optional parameter specifying the classes that
     /// the client belongs to.
@@ -233,7 +252,18 @@ public:
     /// in each subnet. Other statistics may be added in the future. In general,
     /// these are statistics that are dependent only on configuration, so they are
     /// not expected to change until the next reconfiguration event.
-    void updateStatistics();
+    ///
+    /// The lease statistics are maintained by the server as the leases are
+    /// allocated and released, so they don't need to be recounted for the
+    /// subnets which have not been changed by the reconfiguration. The lease
+    /// statistics of a subnet are kept if the previous configuration contains
+    /// a subnet with the same identifier, prefix and pools. The leases of the
+    /// other subnets are recounted by the lease manager.
+    ///
+    /// @param previous Pointer to the subnets of the previous configuration.
+    /// If it is null, the lease statistics of all subnets are recounted.
+    void updateStatistics(const ConstCfgSubnets4Ptr& previous =
+                          ConstCfgSubnets4Ptr());
 
     /// @brief Removes statistics.
     ///
@@ -241,7 +271,13 @@ public:
     /// statistics for the old configuration. In particular, we need to remove
     /// anything related to subnets, as there may be fewer subnets in the new
     /// configuration and also subnet-ids may change.
-    void removeStatistics();
+    ///
+    /// @param next Pointer to the subnets of the new configuration. The
+    /// statistics of the subnets which are also present in the new
+    /// configuration are not removed, as they are updated by the
+    /// @c updateStatistics. If it is null, all statistics are removed.
+    void removeStatistics(const ConstCfgSubnets4Ptr& next =
+                          ConstCfgSubnets4Ptr());
 
     /// @brief Unparse a configuration object
     ///
@@ -250,20 +286,39 @@ public:
 
 private:
 
+    /// @brief Key of the DHCPv4o6 interface id index.
+    ///
+    /// It holds the option type and the option data.
+    typedef std::pair<uint16_t, OptionBuffer> InterfaceIdKey;
+
     /// @brief A container for IPv4 subnets.
     Subnet4Collection subnets_;
 
-};
+    /// @brief Indicates if the selection indexes are up to date.
+    bool indexed_;
 
-/// @name Pointer to the @c CfgSubnets4 objects.
-//@{
-/// @brief Non-const pointer.
-typedef boost::shared_ptr<CfgSubnets4> CfgSubnets4Ptr;
+    /// @brief Subnets by position held in the selection indexes.
+    std::vector<Subnet4Ptr> indexed_subnets_;
 
-/// @brief Const pointer.
-typedef boost::shared_ptr<const CfgSubnets4> ConstCfgSubnets4Ptr;
+    /// @brief Index of the subnets by prefix.
+    PrefixSelectionIndex prefix_index_;
 
-//@}
+    /// @brief Index of the subnets by relay address.
+    KeySelectionIndex<asiolink::IOAddress> relay_index_;
+
+    /// @brief Index of the subnets by interface name.
+    KeySelectionIndex<std::string> iface_index_;
+
+    /// @brief Index of the DHCPv4o6 subnets by IPv6 prefix.
+    PrefixSelectionIndex prefix4o6_index_;
+
+    /// @brief Index of the DHCPv4o6 subnets by interface id.
+    KeySelectionIndex<InterfaceIdKey> interface_id4o6_index_;
+
+    /// @brief Index of the DHCPv4o6 subnets by interface name.
+    KeySelectionIndex<std::string> iface4o6_index_;
+
+};
 
 }
 }
@@ -20,6 +20,10 @@ using namespace isc::data;
 namespace isc {
 namespace dhcp {
 
+CfgSubnets6::CfgSubnets6()
+    : subnets_(), indexed_(false) {
+}
+
 void
 CfgSubnets6::add(const Subnet6Ptr& subnet) {
     if (getBySubnetId(subnet->getID())) {
@@ -36,6 +40,7 @@ CfgSubnets6::add(const Subnet6Ptr& subnet) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE, DHCPSRV_CFGMGR_ADD_SUBNET6)
               .arg(subnet->toText());
     subnets_.push_back(subnet);
+    indexed_ = false;
 }
 
 void
@@ -47,11 +52,48 @@ CfgSubnets6::del(const ConstSubnet6Ptr& subnet) {
                   << "' found");
     }
     index.erase(subnet_it);
+    indexed_ = false;
 
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE, DHCPSRV_CFGMGR_DEL_SUBNET6)
         .arg(subnet->toText());
 }
 
+void
+CfgSubnets6::buildSelectionIndexes() {
+    indexed_subnets_.clear();
+    prefix_index_.clear();
+    relay_index_.clear();
+    iface_index_.clear();
+    interface_id_index_.clear();
+
+    indexed_subnets_.reserve(subnets_.size());
+    for (Subnet6Collection::const_iterator subnet = subnets_.begin();
+         subnet != subnets_.end(); ++subnet) {
+        const size_t position = indexed_subnets_.size();
+        indexed_subnets_.push_back(*subnet);
+
+        std::pair<IOAddress, uint8_t> prefix = (*subnet)->get();
+        prefix_index_.add(prefix.first, prefix.second, position);
+
+        // The subnets without the relay address are indexed too, as the
+        // relay address of zero matches them.
+        relay_index_.add((*subnet)->getRelayInfo().addr_, position);
+
+        if (!(*subnet)->getIface().empty()) {
+            iface_index_.add((*subnet)->getIface(), position);
+        }
+
+        OptionPtr interface_id = (*subnet)->getInterfaceId();
+        if (interface_id) {
+            interface_id_index_.add(InterfaceIdKey(interface_id->getType(),
+                                                   interface_id->getData()),
+                                    position);
+        }
+    }
+
+    indexed_ = true;
+}
+
 ConstSubnet6Ptr
 CfgSubnets6::getBySubnetId(const SubnetID& subnet_id) const {
     const auto& index = subnets_.get<SubnetSubnetIdIndexTag>();
@@ -112,7 +154,18 @@ CfgSubnets6::selectSubnet(const asiolink::IOAddress& address,
 
     // If the specified address is a relay address we first need to match
     // it with the relay addresses specified for all subnets.
-    if (is_relay_address) {
+    if (is_relay_address && indexed_) {
+        ClientSupportedSubnet<Subnet6Ptr> supported(indexed_subnets_,
+                                                    client_classes);
+        const size_t found = relay_index_.find(address, supported);
+        if (found != NO_SUBNET_POSITION) {
+            LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE,
+                      DHCPSRV_CFGMGR_SUBNET6_RELAY)
+                .arg(indexed_subnets_[found]->toText()).arg(address.toText());
+            return (indexed_subnets_[found]);
+        }
+
+    } else if (is_relay_address) {
         for (Subnet6Collection::const_iterator subnet = subnets_.begin();
              subnet != subnets_.end(); ++subnet) {
 
@@ -131,6 +184,18 @@ CfgSubnets6::selectSubnet(const asiolink::IOAddress& address,
 
     // No success so far. Check if the specified address is in range
     // with any subnet.
+    if (indexed_) {
+        ClientSupportedSubnet<Subnet6Ptr> supported(indexed_subnets_,
+                                                    client_classes);
+        const size_t found = prefix_index_.find(address, supported);
+        if (found == NO_SUBNET_POSITION) {
+            return (Subnet6Ptr());
+        }
+        LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE, DHCPSRV_CFGMGR_SUBNET6)
+            .arg(indexed_subnets_[found]->toText()).arg(address.toText());
+        return (indexed_subnets_[found]);
+    }
+
     for (Subnet6Collection::const_iterator subnet = subnets_.begin();
          subnet != subnets_.end(); ++subnet) {
         if ((*subnet)->inRange(address) &&
@@ -151,7 +216,18 @@ CfgSubnets6::selectSubnet(const std::string& iface_name,
                           const ClientClasses& client_classes) const {
 
     // If empty interface specified, we can't select subnet by interface.
-    if (!iface_name.empty()) {
+    if (!iface_name.empty() && indexed_) {
+        ClientSupportedSubnet<Subnet6Ptr> supported(indexed_subnets_,
+                                                    client_classes);
+        const size_t found = iface_index_.find(iface_name, supported);
+        if (found != NO_SUBNET_POSITION) {
+            LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE,
+                      DHCPSRV_CFGMGR_SUBNET6_IFACE)
+                .arg(indexed_subnets_[found]->toText()).arg(iface_name);
+            return (indexed_subnets_[found]);
+        }
+
+    } else if (!iface_name.empty()) {
         for (Subnet6Collection::const_iterator subnet = subnets_.begin();
              subnet != subnets_.end(); ++subnet) {
 
@@ -178,7 +254,20 @@ CfgSubnets6::selectSubnet(const OptionPtr& interface_id,
                           const ClientClasses& client_classes) const {
     // We can only select subnet using an interface id, if the interface
     // id is known.
-    if (interface_id) {
+    if (interface_id && indexed_) {
+        ClientSupportedSubnet<Subnet6Ptr> supported(indexed_subnets_,
+                                                    client_classes);
+        const size_t found = interface_id_index_.
+            find(InterfaceIdKey(interface_id->getType(), interface_id->getData()),
+                 supported);
+        if (found != NO_SUBNET_POSITION) {
+            LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE,
+                      DHCPSRV_CFGMGR_SUBNET6_IFACE_ID)
+                .arg(indexed_subnets_[found]->toText());
+            return (indexed_subnets_[found]);
+        }
+
+    } else if (interface_id) {
         for (Subnet6Collection::const_iterator subnet = subnets_.begin();
              subnet != subnets_.end(); ++subnet) {
 
@@ -213,7 +302,7 @@ CfgSubnets6::getSubnet(const SubnetID id) const {
 }
 
 void
-CfgSubnets6::removeStatistics() {
+CfgSubnets6::removeStatistics(const ConstCfgSubnets6Ptr& next) {
     using namespace isc::stats;
 
     StatsMgr& stats_mgr = StatsMgr::instance();
@@ -221,6 +310,22 @@ CfgSubnets6::removeStatistics() {
     for (Subnet6Collection::const_iterator subnet6 = subnets_.begin();
          subnet6 != subnets_.end(); ++subnet6) {
         SubnetID subnet_id = (*subnet6)->getID();
+
+        // The statistics of the subnet are updated by the new configuration.
+        if (next && next->getBySubnetId(subnet_id)) {
+            continue;
+        }
+
+        // The declined addresses of the removed subnet no longer count
+        // in the global statistic.
+        ObservationPtr declined =
+            stats_mgr.getObservation(StatsMgr::generateName("subnet", subnet_id,
+                                                            "declined-addresses"));
+        if (declined && stats_mgr.getObservation("declined-addresses")) {
+            stats_mgr.addValue("declined-addresses",
+                               -declined->getInteger().first);
+        }
+
         stats_mgr.del(StatsMgr::generateName("subnet", subnet_id, "total-nas"));
 
         stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
@@ -243,10 +348,11 @@ CfgSubnets6::removeStatistics() {
 }
 
 void
-CfgSubnets6::updateStatistics() {
+CfgSubnets6::updateStatistics(const ConstCfgSubnets6Ptr& previous) {
     using namespace isc::stats;
 
     StatsMgr& stats_mgr = StatsMgr::instance();
+    SubnetIDSet recount;
     // For each v6 subnet currently configured, calculate totals
     for (Subnet6Collection::const_iterator subnet6 = subnets_.begin();
          subnet6 != subnets_.end(); ++subnet6) {
@@ -261,11 +367,34 @@ CfgSubnets6::updateStatistics() {
                                                   "total-pds"),
                             static_cast<int64_t>
                             ((*subnet6)->getPoolCapacity(Lease::TYPE_PD)));
+
+        // Recount the leases unless the subnet hasn't changed and its
+        // lease statistics are still in place.
+        ConstSubnet6Ptr previous_subnet = previous ?
+            previous->getBySubnetId(subnet_id) : ConstSubnet6Ptr();
+        if (!previous_subnet ||
+            (previous_subnet->toText() != (*subnet6)->toText()) ||
+            !previous_subnet->hasSamePools(**subnet6, Lease::TYPE_NA) ||
+            !previous_subnet->hasSamePools(**subnet6, Lease::TYPE_TA) ||
+            !previous_subnet->hasSamePools(**subnet6, Lease::TYPE_PD) ||
+            !stats_mgr.getObservation(StatsMgr::
+                                      generateName("subnet", subnet_id,
+                                                   "assigned-nas"))) {
+            recount.insert(subnet_id);
+        }
+    }
+
+    // Only recount the stats if we have subnets to recount.
+    if (recount.empty()) {
+        return;
     }
 
-    // Only recount the stats if we have subnets.
-    if (subnets_.begin() != subnets_.end()) {
-            LeaseMgrFactory::instance().recountLeaseStats6();
+    // Recount all leases when none of the subnets has been kept, e.g.
+    // when the server is configured for the first time.
+    if (!previous || (recount.size() == subnets_.size())) {
+        LeaseMgrFactory::instance().recountLeaseStats6();
+    } else {
+        LeaseMgrFactory::instance().recountLeaseStats6(recount);
     }
 }
 
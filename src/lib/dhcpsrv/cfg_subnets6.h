@@ -12,14 +12,29 @@
 #include <cc/cfg_to_element.h>
 #include <dhcpsrv/subnet.h>
 #include <dhcpsrv/subnet_id.h>
+#include <dhcpsrv/subnet_selection_index.h>
 #include <dhcpsrv/subnet_selector.h>
 #include <util/optional_value.h>
 #include <boost/shared_ptr.hpp>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace isc {
 namespace dhcp {
 
+class CfgSubnets6;
+
+/// @name Pointer to the @c CfgSubnets6 objects.
+//@{
+/// @brief Non-const pointer.
+typedef boost::shared_ptr<CfgSubnets6> CfgSubnets6Ptr;
+
+/// @brief Const pointer.
+typedef boost::shared_ptr<const CfgSubnets6> ConstCfgSubnets6Ptr;
+
+//@}
+
 /// @brief Holds subnets configured for the DHCPv6 server.
 ///
 /// This class holds a collection of subnets configured for the DHCPv6 server.
@@ -29,9 +44,18 @@ namespace dhcp {
 ///
 /// See @c CfgSubnets6::selectSubnet documentation for more details on how the subnet
 /// is selected for the client.
+///
+/// When the configuration is committed, the indexes used for the subnet
+/// selection are built (see @c CfgSubnets6::buildSelectionIndexes), so as
+/// the subnet is selected without iterating over all subnets. Adding or
+/// removing a subnet invalidates the indexes and the subnets are selected
+/// by iterating over them until the indexes are built again.
 class CfgSubnets6 : public isc::data::CfgToElement {
 public:
 
+    /// @brief Constructor.
+    CfgSubnets6();
+
     /// @brief Adds new subnet to the configuration.
     ///
     /// @param subnet Pointer to the subnet being added.
@@ -47,6 +71,20 @@ public:
     /// @throw isc::BadValue if such subnet doesn't exist.
     void del(const ConstSubnet6Ptr& subnet);
 
+    /// @brief Builds the indexes used for the subnet selection.
+    ///
+    /// The subnets are indexed by prefix, relay address, interface name
+    /// and interface id. The indexes are built when the configuration is
+    /// committed and must be rebuilt when any of these parameters is
+    /// modified for any subnet afterwards.
+    void buildSelectionIndexes();
+
+    /// @brief Checks if the indexes used for the subnet selection are
+    /// up to date.
+    bool hasSelectionIndexes() const {
+        return (indexed_);
+    }
+
     /// @brief Returns pointer to the collection of all IPv6 subnets.
     ///
     /// This is used in a hook (subnet6_select), where the hook is able
@@ -115,13 +153,8 @@ public:
     /// associated with any subnet. If not, it is checked if the link address
     /// is in range with any of the subnets.
     ///
-    /// @todo This method requires performance improvement! It currently
-    /// iterates over all existing subnets (possibly a couple of times)
-    /// to find the one which fulfills the search criteria. The subnet storage
-    /// is implemented as a simple STL vector which precludes fast searches
-    /// using specific keys. Hence, full scan is required. To improve the
-    /// search performance a different container type is required, e.g.
-    /// multi-index container, or something of a similar functionality.
+    /// If the selection indexes have been built, the subnet is found using
+    /// the indexes, rather than iterating over all subnets.
     ///
     /// @param selector Const reference to the selector structure which holds
     /// various information extracted from the client's packet which are used
@@ -156,13 +189,8 @@ public:
     /// address. For other purposes the @c selectSubnet(SubnetSelector) should
     /// rather be used instead.
     ///
-    /// @todo This method requires performance improvement! It currently
-    /// iterates over all existing subnets (possibly a couple of times)
-    /// to find the one which fulfills the search criteria. The subnet storage
-    /// is implemented as a simple STL vector which precludes fast searches
-    /// using specific keys. Hence, full scan is required. To improve the
-    /// search performance a different container type is required, e.g.
-    /// multi-index container, or something of a similar functionality.
+    /// If the selection indexes have been built, the subnet is found using
+    /// the indexes, rather than iterating over all subnets.
     ///
     /// @param address Address for which the subnet is searched.
     /// @param client_classes Optional parameter specifying the classes that
@@ -183,7 +211,18 @@ public:
     /// and prefixes in each subnet. Other statistics may be added in the future. In
     /// general, these are statistics that are dependent only on configuration, so
     /// they are not expected to change until the next reconfiguration event.
-    void updateStatistics();
+    ///
+    /// The lease statistics are maintained by the server as the leases are
+    /// allocated and released, so they don't need to be recounted for the
+    /// subnets which have not been changed by the reconfiguration. The lease
+    /// statistics of a subnet are kept if the previous configuration contains
+    /// a subnet with the same identifier, prefix and pools. The leases of the
+    /// other subnets are recounted by the lease manager.
+    ///
+    /// @param previous Pointer to the subnets of the previous configuration.
+    /// If it is null, the lease statistics of all subnets are recounted.
+    void updateStatistics(const ConstCfgSubnets6Ptr& previous =
+                          ConstCfgSubnets6Ptr());
 
     /// @brief Removes statistics.
     ///
@@ -191,7 +230,13 @@ public:
     /// statistics for the old configuration. In particular, we need to remove
     /// anything related to subnets, as there may be fewer subnets in the new
     /// configuration and also subnet-ids may change.
-    void removeStatistics();
+    ///
+    /// @param next Pointer to the subnets of the new configuration. The
+    /// statistics of the subnets which are also present in the new
+    /// configuration are not removed, as they are updated by the
+    /// @c updateStatistics. If it is null, all statistics are removed.
+    void removeStatistics(const ConstCfgSubnets6Ptr& next =
+                          ConstCfgSubnets6Ptr());
 
     /// @brief Unparse a configuration object
     ///
@@ -206,13 +251,8 @@ private:
     /// If any of the subnets is explicitly associated with the interface
     /// name, the subnet is returned.
     ///
-    /// @todo This method requires performance improvement! It currently
-    /// iterates over all existing subnets to find the one which fulfills
-    /// the search criteria. The subnet storage is implemented as a
-    /// simple STL vector which precludes fast searches using specific
-    /// keys. Hence, full scan is required. To improve the search
-    /// performance a different container type is required, e.g.
-    /// multi-index container, or something of a similar functionality.
+    /// If the selection indexes have been built, the subnet is found using
+    /// the indexes, rather than iterating over all subnets.
     ///
     /// @param iface_name Interface name.
     /// @param client_classes Optional parameter specifying the classes that
@@ -230,13 +270,8 @@ private:
     /// of the subnets is explicitly associated with that interface id, the
     /// subnet is returned.
     ///
-    /// @todo This method requires performance improvement! It currently
-    /// iterates over all existing subnets to find the one which fulfills
-    /// the search criteria. The subnet storage is implemented as a
-    /// simple STL vector which precludes fast searches using specific
-    /// keys. Hence, full scan is required. To improve the search
-    /// performance a different container type is required, e.g.
-    /// multi-index container, or something of a similar functionality.
+    /// If the selection indexes have been built, the subnet is found using
+    /// the indexes, rather than iterating over all subnets.
     ///
     /// @param interface_id An instance of the Interface ID option received
     /// from the client.
@@ -248,20 +283,33 @@ private:
     selectSubnet(const OptionPtr& interface_id,
                  const ClientClasses& client_classes) const;
 
+    /// @brief Key of the interface id index.
+    ///
+    /// It holds the option type and the option data.
+    typedef std::pair<uint16_t, OptionBuffer> InterfaceIdKey;
+
     /// @brief A container for IPv6 subnets.
     Subnet6Collection subnets_;
 
-};
+    /// @brief Indicates if the selection indexes are up to date.
+    bool indexed_;
 
-/// @name Pointer to the @c CfgSubnets6 objects.
-//@{
-/// @brief Non-const pointer.
-typedef boost::shared_ptr<CfgSubnets6> CfgSubnets6Ptr;
+    /// @brief Subnets by position held in the selection indexes.
+    std::vector<Subnet6Ptr> indexed_subnets_;
 
-/// @brief Const pointer.
-typedef boost::shared_ptr<const CfgSubnets6> ConstCfgSubnets6Ptr;
+    /// @brief Index of the subnets by prefix.
+    PrefixSelectionIndex prefix_index_;
 
-//@}
+    /// @brief Index of the subnets by relay address.
+    KeySelectionIndex<asiolink::IOAddress> relay_index_;
+
+    /// @brief Index of the subnets by interface name.
+    KeySelectionIndex<std::string> iface_index_;
+
+    /// @brief Index of the subnets by interface id.
+    KeySelectionIndex<InterfaceIdKey> interface_id_index_;
+
+};
 
 }
 }
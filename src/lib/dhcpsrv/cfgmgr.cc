@@ -89,10 +89,9 @@ CfgMgr::commit() {
 
     ensureCurrentAllocated();
 
-    // First we need to remove statistics. The new configuration can have fewer
-    // subnets. Also, it may change subnet-ids. So we need to remove them all
-    // and add it back.
-    configuration_->removeStatistics();
+    // Remember the current configuration, so as the statistics of the
+    // subnets which haven't changed can be kept.
+    SrvConfigPtr previous = configuration_;
 
     if (!configs_.back()->sequenceEquals(*configuration_)) {
         configuration_ = configs_.back();
@@ -105,8 +104,19 @@ CfgMgr::commit() {
         }
     }
 
-    // Now we need to set the statistics back.
-    configuration_->updateStatistics();
+    // Build the indexes used to select subnets for the incoming packets,
+    // so as the subnets don't need to be iterated over for each packet.
+    configuration_->getCfgSubnets4()->buildSelectionIndexes();
+    configuration_->getCfgSubnets6()->buildSelectionIndexes();
+
+    // First we need to remove statistics. The new configuration can have
+    // fewer subnets. Also, it may change subnet-ids. So we remove the
+    // statistics of the subnets which are not in the new configuration.
+    previous->removeStatistics(configuration_);
+
+    // Now we need to set the statistics back. The lease statistics are
+    // only recounted for the subnets which have changed.
+    configuration_->updateStatistics(previous);
 }
 
 void
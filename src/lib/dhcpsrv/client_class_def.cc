@@ -5,6 +5,7 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <dhcpsrv/client_class_def.h>
+#include <dhcpsrv/client_class_index.h>
 #include <dhcpsrv/cfgmgr.h>
 #include <boost/foreach.hpp>
 
@@ -28,6 +29,7 @@ ClientClassDef::ClientClassDef(const std::string& name,
 
     // We permit an empty expression for now.  This will likely be useful
     // for automatic classes such as vendor class.
+    setMatchExpr(match_expr);
 
     // For classes without options, make sure we have an empty collection
     if (!cfg_option_) {
@@ -41,8 +43,9 @@ ClientClassDef::ClientClassDef(const ClientClassDef& rhs)
       next_server_(asiolink::IOAddress::IPV4_ZERO_ADDRESS()) {
 
     if (rhs.match_expr_) {
-        match_expr_.reset(new Expression());
-        *match_expr_ = *(rhs.match_expr_);
+        ExpressionPtr match_expr(new Expression());
+        *match_expr = *(rhs.match_expr_);
+        setMatchExpr(match_expr);
     }
 
     if (rhs.cfg_option_def_) {
@@ -79,6 +82,11 @@ ClientClassDef::getMatchExpr() const {
 void
 ClientClassDef::setMatchExpr(const ExpressionPtr& match_expr) {
     match_expr_ = match_expr;
+    if (match_expr_) {
+        compiled_match_expr_.reset(new CompiledExpression(*match_expr_));
+    } else {
+        compiled_match_expr_.reset();
+    }
 }
 
 std::string
@@ -165,11 +173,11 @@ std::ostream& operator<<(std::ostream& os, const ClientClassDef& x) {
 //********** ClientClassDictionary ******************//
 
 ClientClassDictionary::ClientClassDictionary()
-    : classes_(new ClientClassDefMap()) {
+    : classes_(new ClientClassDefMap()), index_(new ClientClassIndex()) {
 }
 
 ClientClassDictionary::ClientClassDictionary(const ClientClassDictionary& rhs)
-    : classes_(new ClientClassDefMap()) {
+    : classes_(new ClientClassDefMap()), index_(new ClientClassIndex()) {
     BOOST_FOREACH(ClientClassMapPair cclass, *(rhs.classes_)) {
         ClientClassDefPtr copy(new ClientClassDef(*(cclass.second)));
         addClass(copy);
@@ -210,6 +218,7 @@ ClientClassDictionary::addClass(ClientClassDefPtr& class_def) {
     }
 
     (*classes_)[class_def->getName()] = class_def;
+    index_->add(class_def);
 }
 
 ClientClassDefPtr
@@ -225,6 +234,7 @@ ClientClassDictionary::findClass(const std::string& name) const {
 void
 ClientClassDictionary::removeClass(const std::string& name) {
     classes_->erase(name);
+    index_->remove(name);
 }
 
 const ClientClassDefMapPtr&
@@ -232,6 +242,11 @@ ClientClassDictionary::getClasses() const {
     return (classes_);
 }
 
+const ClientClassIndex&
+ClientClassDictionary::getIndex() const {
+    return (*index_);
+}
+
 bool
 ClientClassDictionary::equals(const ClientClassDictionary& other) const {
     if (classes_->size() != other.classes_->size()) {
@@ -10,6 +10,7 @@
 #include <cc/cfg_to_element.h>
 #include <dhcpsrv/cfg_option.h>
 #include <dhcpsrv/cfg_option_def.h>
+#include <eval/compiled_expression.h>
 #include <eval/token.h>
 #include <exceptions/exceptions.h>
 
@@ -69,9 +70,19 @@ public:
 
     /// @brief Sets the class's match expression
     ///
+    /// The expression is compiled.
+    ///
     /// @param match_expr the expression to assign the class
     void setMatchExpr(const ExpressionPtr& match_expr);
 
+    /// @brief Fetches the class's compiled match expression
+    ///
+    /// @return the compiled expression or null if the class has no
+    /// match expression
+    const CompiledExpressionPtr& getCompiledMatchExpr() const {
+        return (compiled_match_expr_);
+    }
+
     /// @brief Fetches the class's original match expression
     std::string getTest() const;
 
@@ -176,6 +187,9 @@ private:
     /// this class.
     ExpressionPtr match_expr_;
 
+    /// @brief The compiled match expression used to classify packets.
+    CompiledExpressionPtr compiled_match_expr_;
+
     /// @brief The original expression which determines membership in
     /// this class.
     std::string test_;
@@ -217,6 +231,8 @@ typedef boost::shared_ptr<ClientClassDefMap> ClientClassDefMapPtr;
 /// @brief Defines a pair for working with ClientClassMap
 typedef std::pair<std::string, ClientClassDefPtr> ClientClassMapPair;
 
+class ClientClassIndex;
+
 /// @brief Maintains a list of ClientClassDef's
 class ClientClassDictionary : public isc::data::CfgToElement {
 
@@ -279,6 +295,15 @@ public:
     /// @return ClientClassDefMapPtr to the map of classes
     const ClientClassDefMapPtr& getClasses() const;
 
+    /// @brief Fetches the classification index of the dictionary
+    ///
+    /// The index is updated when the classes are added or removed, so
+    /// the match expressions of the classes must not be changed after
+    /// they were added.
+    ///
+    /// @return the index used to classify packets
+    const ClientClassIndex& getIndex() const;
+
     /// @brief Compares two @c ClientClassDictionary objects for equality.
     ///
     /// @param other Other client class definition to compare to.
@@ -314,6 +339,9 @@ private:
     /// @brief Map of the class definitions
     ClientClassDefMapPtr classes_;
 
+    /// @brief Index of the class definitions used to classify packets
+    boost::shared_ptr<ClientClassIndex> index_;
+
 };
 
 /// @brief Defines a pointer to a ClientClassDictionary
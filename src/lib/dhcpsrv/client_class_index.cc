@@ -0,0 +1,114 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <dhcpsrv/client_class_index.h>
+
+namespace {
+
+/// @brief Removes the class from the list.
+///
+/// @param classes List of classes.
+/// @param name Name of the class.
+/// @return true if the class was found.
+bool
+removeByName(isc::dhcp::ClientClassDefList& classes, const std::string& name) {
+    for (isc::dhcp::ClientClassDefList::iterator it = classes.begin();
+         it != classes.end(); ++it) {
+        if ((*it)->getName() == name) {
+            classes.erase(it);
+            return (true);
+        }
+    }
+    return (false);
+}
+
+/// @brief Empty list returned when no class matches.
+const isc::dhcp::ClientClassDefList EMPTY_LIST;
+
+}
+
+namespace isc {
+namespace dhcp {
+
+ClientClassIndex::Group::Group(const Expression& key)
+    : key_(key), by_value_(), classes_() {
+}
+
+void
+ClientClassIndex::Group::add(const std::string& constant,
+                             const ClientClassDefPtr& class_def) {
+    by_value_[constant].push_back(class_def);
+    classes_.push_back(class_def);
+}
+
+bool
+ClientClassIndex::Group::remove(const std::string& name) {
+    if (!removeByName(classes_, name)) {
+        return (false);
+    }
+    for (boost::unordered_map<std::string, ClientClassDefList>::iterator it =
+             by_value_.begin(); it != by_value_.end(); ++it) {
+        if (removeByName(it->second, name)) {
+            if (it->second.empty()) {
+                by_value_.erase(it);
+            }
+            break;
+        }
+    }
+    return (true);
+}
+
+const ClientClassDefList&
+ClientClassIndex::Group::match(Pkt& pkt, ValueStack& values) const {
+    boost::unordered_map<std::string, ClientClassDefList>::const_iterator it =
+        by_value_.find(key_.evaluateString(pkt, values));
+    if (it == by_value_.end()) {
+        return (EMPTY_LIST);
+    }
+    return (it->second);
+}
+
+void
+ClientClassIndex::add(const ClientClassDefPtr& class_def) {
+    const CompiledExpressionPtr& expr = class_def->getCompiledMatchExpr();
+    if (!expr) {
+        return;
+    }
+
+    Expression key;
+    std::string constant;
+    std::string signature;
+    if (!expr->getEqualityTest(key, constant) ||
+        !CompiledExpression::getSignature(key, signature)) {
+        others_.push_back(class_def);
+        return;
+    }
+
+    GroupPtr& group = groups_[signature];
+    if (!group) {
+        group.reset(new Group(key));
+    }
+    group->add(constant, class_def);
+}
+
+void
+ClientClassIndex::remove(const std::string& name) {
+    if (removeByName(others_, name)) {
+        return;
+    }
+    for (GroupMap::iterator it = groups_.begin(); it != groups_.end(); ++it) {
+        if (it->second->remove(name)) {
+            if (it->second->getClasses().empty()) {
+                groups_.erase(it);
+            }
+            return;
+        }
+    }
+}
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
@@ -0,0 +1,130 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef CLIENT_CLASS_INDEX_H
+#define CLIENT_CLASS_INDEX_H
+
+#include <dhcpsrv/client_class_def.h>
+#include <eval/compiled_expression.h>
+#include <boost/shared_ptr.hpp>
+#include <boost/unordered_map.hpp>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief List of client class definitions.
+typedef std::vector<ClientClassDefPtr> ClientClassDefList;
+
+/// @brief Classification plan for the client class definitions.
+///
+/// Most classes test the value of an option or a field against a constant,
+/// e.g. "option[60].hex == 'foo'" or "substring(option[61].hex,0,3) == 'bar'".
+/// Evaluating the expressions of all classes for each packet computes the
+/// same value once per class. The index groups the classes which compare
+/// the same value (the "key") with a constant: the key is evaluated once
+/// per packet and a hash table keyed by the constants selects the classes
+/// which match.
+///
+/// The classes which don't have this form are evaluated one by one, as
+/// before.
+class ClientClassIndex {
+public:
+
+    /// @brief Classes comparing the same key with constants.
+    class Group {
+    public:
+
+        /// @brief Constructor.
+        ///
+        /// @param key Expression computing the key.
+        explicit Group(const Expression& key);
+
+        /// @brief Adds a class to the group.
+        ///
+        /// @param constant Value of the key for which the class matches.
+        /// @param class_def Class definition.
+        void add(const std::string& constant,
+                 const ClientClassDefPtr& class_def);
+
+        /// @brief Removes a class from the group.
+        ///
+        /// @param name Name of the class.
+        /// @return true if the class was found in the group.
+        bool remove(const std::string& name);
+
+        /// @brief Returns the classes matching the packet.
+        ///
+        /// @param pkt Packet being classified.
+        /// @param values Value stack used for the evaluation.
+        /// @return Classes for which the key has the value of the constant.
+        /// @throw EvalBadStack, EvalTypeError or other exception raised
+        /// by the evaluation of the key.
+        const ClientClassDefList& match(Pkt& pkt, ValueStack& values) const;
+
+        /// @brief Returns all classes of the group.
+        const ClientClassDefList& getClasses() const {
+            return (classes_);
+        }
+
+    private:
+
+        /// @brief Compiled expression computing the key.
+        CompiledExpression key_;
+
+        /// @brief Classes by the value of the key.
+        boost::unordered_map<std::string, ClientClassDefList> by_value_;
+
+        /// @brief All classes of the group.
+        ClientClassDefList classes_;
+    };
+
+    /// @brief Pointer to the group.
+    typedef boost::shared_ptr<Group> GroupPtr;
+
+    /// @brief Groups by the signature of the key.
+    typedef std::map<std::string, GroupPtr> GroupMap;
+
+    /// @brief Adds a class definition.
+    ///
+    /// Classes without an expression are ignored.
+    ///
+    /// @param class_def Class definition.
+    void add(const ClientClassDefPtr& class_def);
+
+    /// @brief Removes a class definition.
+    ///
+    /// @param name Name of the class.
+    void remove(const std::string& name);
+
+    /// @brief Returns the groups of classes sharing a key.
+    const GroupMap& getGroups() const {
+        return (groups_);
+    }
+
+    /// @brief Returns the classes evaluated one by one.
+    const ClientClassDefList& getOthers() const {
+        return (others_);
+    }
+
+private:
+
+    /// @brief Groups by the signature of the key.
+    GroupMap groups_;
+
+    /// @brief Classes evaluated one by one.
+    ClientClassDefList others_;
+};
+
+/// @brief Pointer to the classification index.
+typedef boost::shared_ptr<ClientClassIndex> ClientClassIndexPtr;
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
+
+#endif // CLIENT_CLASS_INDEX_H
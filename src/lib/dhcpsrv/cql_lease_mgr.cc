@@ -20,6 +20,7 @@
 #include <dhcp/hwaddr.h>
 #include <dhcpsrv/dhcpsrv_log.h>
 #include <dhcpsrv/cql_lease_mgr.h>
+#include <dhcpsrv/processing_latency.h>
 #include <boost/static_assert.hpp>
 #include <iostream>
 #include <iomanip>
@@ -29,6 +30,7 @@
 
 using namespace isc;
 using namespace isc::dhcp;
+using namespace isc::util::thread;
 using namespace std;
 
 namespace isc {
@@ -151,6 +153,8 @@ static const char* delete_expired_lease6_params[] = {
         static_cast<const char*>("state"),
         static_cast<const char*>("expire"),
         NULL };
+static const char* get_lease4_params[] = {
+        NULL };
 static const char* get_lease4_addr_params[] = {
         static_cast<const char*>("address"),
         NULL };
@@ -173,6 +177,18 @@ static const char* get_lease4_expired_params[] = {
         static_cast<const char*>("expire"),
         static_cast<const char*>("limit"),
         NULL };
+static const char* get_lease4_limit_params[] = {
+        static_cast<const char*>("limit"),
+        NULL };
+static const char* get_lease4_page_params[] = {
+        static_cast<const char*>("address"),
+        static_cast<const char*>("limit"),
+        NULL };
+static const char* get_lease4_subid_params[] = {
+        static_cast<const char*>("subnet_id"),
+        NULL };
+static const char* get_lease6_params[] = {
+        NULL };
 static const char* get_lease6_addr_params[] = {
         static_cast<const char*>("address"),
         static_cast<const char*>("lease_type"),
@@ -193,6 +209,16 @@ static const char* get_lease6_expired_params[] = {
         static_cast<const char*>("expire"),
         static_cast<const char*>("limit"),
         NULL };
+static const char* get_lease6_limit_params[] = {
+        static_cast<const char*>("limit"),
+        NULL };
+static const char* get_lease6_page_params[] = {
+        static_cast<const char*>("address"),
+        static_cast<const char*>("limit"),
+        NULL };
+static const char* get_lease6_subid_params[] = {
+        static_cast<const char*>("subnet_id"),
+        NULL };
 static const char* get_version_params[] = {
         NULL };
 static const char* insert_lease4_params[] = {
@@ -290,6 +316,14 @@ CqlTaggedStatement CqlLeaseMgr::tagged_statements_[] = {
       "WHERE state = ? AND expire < ? "
       "ALLOW FILTERING" },
 
+    // GET_LEASE4
+    { get_lease4_params,
+      "get_lease4",
+      "SELECT address, hwaddr, client_id, "
+        "valid_lifetime, expire, subnet_id, "
+        "fqdn_fwd, fqdn_rev, hostname, state "
+      "FROM lease4" },
+
     // GET_LEASE4_ADDR
     { get_lease4_addr_params,
       "get_lease4_addr",
@@ -348,6 +382,44 @@ CqlTaggedStatement CqlLeaseMgr::tagged_statements_[] = {
       "LIMIT ? "
       "ALLOW FILTERING" },
 
+    // GET_LEASE4_LIMIT
+    { get_lease4_limit_params,
+      "get_lease4_limit",
+      "SELECT address, hwaddr, client_id, "
+        "valid_lifetime, expire, subnet_id, "
+        "fqdn_fwd, fqdn_rev, hostname, state "
+      "FROM lease4 "
+      "LIMIT ?" },
+
+    // GET_LEASE4_PAGE
+    { get_lease4_page_params,
+      "get_lease4_page",
+      "SELECT address, hwaddr, client_id, "
+        "valid_lifetime, expire, subnet_id, "
+        "fqdn_fwd, fqdn_rev, hostname, state "
+      "FROM lease4 "
+      "WHERE TOKEN(address) > TOKEN(?) "
+      "LIMIT ?" },
+
+    // GET_LEASE4_SUBID
+    { get_lease4_subid_params,
+      "get_lease4_subid",
+      "SELECT address, hwaddr, client_id, "
+        "valid_lifetime, expire, subnet_id, "
+        "fqdn_fwd, fqdn_rev, hostname, state "
+      "FROM lease4 "
+      "WHERE subnet_id = ? "
+      "ALLOW FILTERING" },
+
+    // GET_LEASE6
+    { get_lease6_params,
+      "get_lease6",
+      "SELECT address, duid, valid_lifetime, "
+        "expire, subnet_id, pref_lifetime, "
+        "lease_type, iaid, prefix_len, fqdn_fwd, fqdn_rev, hostname, "
+        "hwaddr, hwtype, hwaddr_source, state "
+      "FROM lease6" },
+
     // GET_LEASE6_ADDR
     { get_lease6_addr_params,
       "get_lease6_addr",
@@ -393,6 +465,38 @@ CqlTaggedStatement CqlLeaseMgr::tagged_statements_[] = {
       "LIMIT ? "
       "ALLOW FILTERING" },
 
+    // GET_LEASE6_LIMIT
+    { get_lease6_limit_params,
+      "get_lease6_limit",
+      "SELECT address, duid, valid_lifetime, "
+        "expire, subnet_id, pref_lifetime, "
+        "lease_type, iaid, prefix_len, fqdn_fwd, fqdn_rev, hostname, "
+        "hwaddr, hwtype, hwaddr_source, state "
+      "FROM lease6 "
+      "LIMIT ?" },
+
+    // GET_LEASE6_PAGE
+    { get_lease6_page_params,
+      "get_lease6_page",
+      "SELECT address, duid, valid_lifetime, "
+        "expire, subnet_id, pref_lifetime, "
+        "lease_type, iaid, prefix_len, fqdn_fwd, fqdn_rev, hostname, "
+        "hwaddr, hwtype, hwaddr_source, state "
+      "FROM lease6 "
+      "WHERE TOKEN(address) > TOKEN(?) "
+      "LIMIT ?" },
+
+    // GET_LEASE6_SUBID
+    { get_lease6_subid_params,
+      "get_lease6_subid",
+      "SELECT address, duid, valid_lifetime, "
+        "expire, subnet_id, pref_lifetime, "
+        "lease_type, iaid, prefix_len, fqdn_fwd, fqdn_rev, hostname, "
+        "hwaddr, hwtype, hwaddr_source, state "
+      "FROM lease6 "
+      "WHERE subnet_id = ? "
+      "ALLOW FILTERING" },
+
     // GET_VERSION
     { get_version_params,
       "get_version",
@@ -1131,14 +1235,120 @@ private:
     uint32_t        hwaddr_source_;     ///< Source of the hardware address
 };
 
+/// @brief Asynchronous CQL lease operation.
+///
+/// Holds the data bound to the statement of the operation and what the
+/// driver callback needs to process its result. The exchange objects are
+/// owned by the request, so the operations don't share any state and can
+/// complete concurrently on the threads of the driver.
+struct CqlAsyncRequest {
+    /// @brief Kind of the operation.
+    enum Operation {
+        ADD,
+        GET,
+        UPDATE,
+        DELETE
+    };
+
+    /// @brief Constructor.
+    ///
+    /// @param mgr lease manager which issues the operation
+    /// @param operation kind of the operation
+    /// @param stindex index of the statement of the operation
+    /// @param addr address of the lease
+    /// @param callback callback invoked with the result
+    CqlAsyncRequest(CqlLeaseMgr& mgr, const Operation operation,
+                    const CqlLeaseMgr::StatementIndex stindex,
+                    const isc::asiolink::IOAddress& addr,
+                    const AsyncLeaseCallback& callback)
+        : mgr_(mgr), operation_(operation), stindex_(stindex), addr_(addr),
+          lease_type_(Lease::TYPE_NA), callback_(callback), addr4_data_(0),
+          lease_type_data_(0) {
+        memset(addr6_buffer_, 0, sizeof(addr6_buffer_));
+    }
+
+    /// @brief Sets up the data bound to the statement of the operation.
+    ///
+    /// @throw isc::BadValue if the lease or the address can't be bound.
+    void createBindForSend() {
+        if (operation_ == ADD || operation_ == UPDATE) {
+            if (lease4_) {
+                exchange4_.reset(new CqlLease4Exchange());
+                exchange4_->createBindForSend(lease4_, data_);
+            } else {
+                exchange6_.reset(new CqlLease6Exchange());
+                exchange6_->createBindForSend(lease6_, data_);
+            }
+            if (operation_ == ADD) {
+                return;
+            }
+            // The address is moved to the WHERE clause.
+            data_.remove(0);
+        } else if (addr_.isV4()) {
+            exchange4_.reset(new CqlLease4Exchange());
+        } else {
+            exchange6_.reset(new CqlLease6Exchange());
+        }
+
+        if (addr_.isV4()) {
+            addr4_data_ = addr_.toUint32();
+            data_.add(&addr4_data_);
+        } else {
+            std::string text_buffer = addr_.toText();
+            uint32_t addr6_length = text_buffer.size();
+            if (addr6_length >= sizeof(addr6_buffer_)) {
+                isc_throw(BadValue, "address value is too large: "
+                          << text_buffer);
+            }
+            if (addr6_length) {
+                memcpy(addr6_buffer_, text_buffer.c_str(), addr6_length);
+            }
+            addr6_buffer_[addr6_length] = '\0';
+            data_.add(addr6_buffer_);
+            if (operation_ == GET) {
+                lease_type_data_ = lease_type_;
+                data_.add(&lease_type_data_);
+            }
+        }
+    }
+
+    /// @brief Returns the exchange object of the operation.
+    CqlLeaseExchange& exchange() {
+        if (exchange4_) {
+            return (*exchange4_);
+        }
+        return (*exchange6_);
+    }
+
+    CqlLeaseMgr& mgr_;                      ///< Issuing lease manager
+    Operation operation_;                   ///< Kind of the operation
+    CqlLeaseMgr::StatementIndex stindex_;   ///< Statement index
+    isc::asiolink::IOAddress addr_;         ///< Address of the lease
+    Lease::Type lease_type_;                ///< Lease type of a lookup
+    Lease4Ptr lease4_;                      ///< IPv4 lease to be written
+    Lease6Ptr lease6_;                      ///< IPv6 lease to be written
+    AsyncLeaseCallback callback_;           ///< Result callback
+    boost::scoped_ptr<CqlLease4Exchange> exchange4_; ///< IPv4 exchange
+    boost::scoped_ptr<CqlLease6Exchange> exchange6_; ///< IPv6 exchange
+    CqlDataArray data_;                     ///< Bound data
+    uint32_t addr4_data_;                   ///< Bound IPv4 address
+    char addr6_buffer_[ADDRESS6_TEXT_MAX_LEN + 1]; ///< Bound IPv6 address
+    uint32_t lease_type_data_;              ///< Bound lease type
+};
+
 CqlLeaseMgr::CqlLeaseMgr(const DatabaseConnection::ParameterMap& parameters)
     : LeaseMgr(), dbconn_(parameters), exchange4_(new CqlLease4Exchange()),
-    exchange6_(new CqlLease6Exchange()), versionExchange_(new CqlVersionExchange()) {
+    exchange6_(new CqlLease6Exchange()), versionExchange_(new CqlVersionExchange()),
+    async_pending_(0) {
     dbconn_.openDatabase();
     dbconn_.prepareStatements(CqlLeaseMgr::tagged_statements_);
 }
 
 CqlLeaseMgr::~CqlLeaseMgr() {
+    // The callbacks of the asynchronous operations use the session, so
+    // they must have returned before it is closed.
+    asyncWait();
+
     // There is no need to close the database in this destructor: it is
     // closed in the destructor of the dbconn_ member variable.
 }
@@ -1260,6 +1470,8 @@ CqlLeaseMgr::addLeaseCommon(StatementIndex stindex,
 
 bool
 CqlLeaseMgr::addLease(const Lease4Ptr& lease) {
+    StageTimer timer(ProcessingLatency::STAGE_LEASE_WRITE);
+
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_CQL_ADD_ADDR4).arg(lease->addr_.toText());
 
@@ -1270,6 +1482,8 @@ CqlLeaseMgr::addLease(const Lease4Ptr& lease) {
 
 bool
 CqlLeaseMgr::addLease(const Lease6Ptr& lease) {
+    StageTimer timer(ProcessingLatency::STAGE_LEASE_WRITE);
+
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_CQL_ADD_ADDR6).arg(lease->addr_.toText());
 
@@ -1492,6 +1706,74 @@ CqlLeaseMgr::getLease4(const ClientId& clientid, SubnetID subnet_id) const {
     return (result);
 }
 
+Lease4Collection
+CqlLeaseMgr::getLeases4(SubnetID subnet_id) const {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_CQL_GET_SUBID4)
+              .arg(subnet_id);
+
+    // Set up the WHERE clause value
+    CqlDataArray data;
+
+    uint32_t subnet_id_data = subnet_id;
+    data.add(&subnet_id_data);
+
+    // Get the data
+    Lease4Collection result;
+    getLeaseCollection(GET_LEASE4_SUBID, data, result);
+
+    return (result);
+}
+
+Lease4Collection
+CqlLeaseMgr::getLeases4() const {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_CQL_GET4);
+
+    // The query has no parameters.
+    CqlDataArray data;
+
+    // Get the data
+    Lease4Collection result;
+    getLeaseCollection(GET_LEASE4, data, result);
+
+    return (result);
+}
+
+Lease4Collection
+CqlLeaseMgr::getLeases4(const asiolink::IOAddress& lower_bound_address,
+                        const LeasePageSize& page_size) const {
+    // Expecting IPv4 address.
+    if (!lower_bound_address.isV4()) {
+        isc_throw(InvalidParameter, "expected IPv4 address while "
+                  "retrieving leases from the lease database, got "
+                  << lower_bound_address);
+    }
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_CQL_GET_PAGE4)
+        .arg(page_size.page_size_)
+        .arg(lower_bound_address.toText());
+
+    // Set up the WHERE clause value
+    CqlDataArray data;
+
+    // The first page begins with the lowest token, the next ones follow
+    // the token of the last address of the previous page.
+    StatementIndex stindex = GET_LEASE4_LIMIT;
+    uint32_t addr4_data = lower_bound_address.toUint32();
+    if (!lower_bound_address.isV4Zero()) {
+        data.add(&addr4_data);
+        stindex = GET_LEASE4_PAGE;
+    }
+
+    uint32_t limit_data = static_cast<uint32_t>(page_size.page_size_);
+    data.add(&limit_data);
+
+    // Get the data
+    Lease4Collection result;
+    getLeaseCollection(stindex, data, result);
+
+    return (result);
+}
+
 Lease6Ptr
 CqlLeaseMgr::getLease6(Lease::Type lease_type,
                          const isc::asiolink::IOAddress& addr) const {
@@ -1580,6 +1862,83 @@ CqlLeaseMgr::getLeases6(Lease::Type lease_type,
     return (result);
 }
 
+Lease6Collection
+CqlLeaseMgr::getLeases6(SubnetID subnet_id) const {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_CQL_GET_SUBID6)
+              .arg(subnet_id);
+
+    // Set up the WHERE clause value
+    CqlDataArray data;
+
+    uint32_t subnet_id_data = subnet_id;
+    data.add(&subnet_id_data);
+
+    // Get the data
+    Lease6Collection result;
+    getLeaseCollection(GET_LEASE6_SUBID, data, result);
+
+    return (result);
+}
+
+Lease6Collection
+CqlLeaseMgr::getLeases6() const {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_CQL_GET6);
+
+    // The query has no parameters.
+    CqlDataArray data;
+
+    // Get the data
+    Lease6Collection result;
+    getLeaseCollection(GET_LEASE6, data, result);
+
+    return (result);
+}
+
+Lease6Collection
+CqlLeaseMgr::getLeases6(const asiolink::IOAddress& lower_bound_address,
+                        const LeasePageSize& page_size) const {
+    // Expecting IPv6 address.
+    if (!lower_bound_address.isV6()) {
+        isc_throw(InvalidParameter, "expected IPv6 address while "
+                  "retrieving leases from the lease database, got "
+                  << lower_bound_address);
+    }
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_CQL_GET_PAGE6)
+        .arg(page_size.page_size_)
+        .arg(lower_bound_address.toText());
+
+    // Set up the WHERE clause value
+    CqlDataArray data;
+
+    // The first page begins with the lowest token, the next ones follow
+    // the token of the last address of the previous page.
+    StatementIndex stindex = GET_LEASE6_LIMIT;
+    std::string text_buffer = lower_bound_address.toText();
+    uint32_t addr6_length = text_buffer.size();
+    char addr6_buffer[ADDRESS6_TEXT_MAX_LEN + 1];
+    if (addr6_length >= sizeof(addr6_buffer)) {
+        isc_throw(BadValue, "address value is too large: " << text_buffer);
+    }
+    if (addr6_length) {
+        memcpy(addr6_buffer, text_buffer.c_str(), addr6_length);
+    }
+    addr6_buffer[addr6_length] = '\0';
+    if (!lower_bound_address.isV6Zero()) {
+        data.add(addr6_buffer);
+        stindex = GET_LEASE6_PAGE;
+    }
+
+    uint32_t limit_data = static_cast<uint32_t>(page_size.page_size_);
+    data.add(&limit_data);
+
+    // Get the data
+    Lease6Collection result;
+    getLeaseCollection(stindex, data, result);
+
+    return (result);
+}
+
 void
 CqlLeaseMgr::getExpiredLeases6(Lease6Collection& expired_leases,
                                  const size_t max_leases) const {
@@ -1696,6 +2055,8 @@ CqlLeaseMgr::updateLeaseCommon(StatementIndex stindex,
 
 void
 CqlLeaseMgr::updateLease4(const Lease4Ptr& lease) {
+    StageTimer timer(ProcessingLatency::STAGE_LEASE_WRITE);
+
     const StatementIndex stindex = UPDATE_LEASE4;
 
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
@@ -1716,6 +2077,8 @@ CqlLeaseMgr::updateLease4(const Lease4Ptr& lease) {
 
 void
 CqlLeaseMgr::updateLease6(const Lease6Ptr& lease) {
+    StageTimer timer(ProcessingLatency::STAGE_LEASE_WRITE);
+
     const StatementIndex stindex = UPDATE_LEASE6;
 
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
@@ -1798,6 +2161,8 @@ CqlLeaseMgr::deleteLeaseCommon(StatementIndex stindex,
 
 bool
 CqlLeaseMgr::deleteLease(const isc::asiolink::IOAddress& addr) {
+    StageTimer timer(ProcessingLatency::STAGE_LEASE_WRITE);
+
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_CQL_DELETE_ADDR).arg(addr.toText());
 
@@ -1885,6 +2250,239 @@ CqlLeaseMgr::deleteExpiredReclaimedLeasesCommon(const uint32_t secs,
     return (result);
 }
 
+void
+CqlLeaseMgr::asyncAddLease(const Lease4Ptr& lease,
+                           const AsyncLeaseCallback& callback) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_CQL_ADD_ADDR4).arg(lease->addr_.toText());
+
+    CqlAsyncRequest* request =
+        new CqlAsyncRequest(*this, CqlAsyncRequest::ADD, INSERT_LEASE4,
+                            lease->addr_, callback);
+    request->lease4_ = lease;
+    asyncExecute(request);
+}
+
+void
+CqlLeaseMgr::asyncAddLease(const Lease6Ptr& lease,
+                           const AsyncLeaseCallback& callback) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_CQL_ADD_ADDR6).arg(lease->addr_.toText());
+
+    CqlAsyncRequest* request =
+        new CqlAsyncRequest(*this, CqlAsyncRequest::ADD, INSERT_LEASE6,
+                            lease->addr_, callback);
+    request->lease6_ = lease;
+    asyncExecute(request);
+}
+
+void
+CqlLeaseMgr::asyncGetLease4(const isc::asiolink::IOAddress& addr,
+                            const AsyncLeaseCallback& callback) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_CQL_GET_ADDR4).arg(addr.toText());
+
+    asyncExecute(new CqlAsyncRequest(*this, CqlAsyncRequest::GET,
+                                     GET_LEASE4_ADDR, addr, callback));
+}
+
+void
+CqlLeaseMgr::asyncGetLease6(Lease::Type lease_type,
+                            const isc::asiolink::IOAddress& addr,
+                            const AsyncLeaseCallback& callback) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_CQL_GET_ADDR6).arg(addr.toText())
+              .arg(lease_type);
+
+    CqlAsyncRequest* request =
+        new CqlAsyncRequest(*this, CqlAsyncRequest::GET, GET_LEASE6_ADDR,
+                            addr, callback);
+    request->lease_type_ = lease_type;
+    asyncExecute(request);
+}
+
+void
+CqlLeaseMgr::asyncUpdateLease4(const Lease4Ptr& lease,
+                               const AsyncLeaseCallback& callback) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_CQL_UPDATE_ADDR4).arg(lease->addr_.toText());
+
+    CqlAsyncRequest* request =
+        new CqlAsyncRequest(*this, CqlAsyncRequest::UPDATE, UPDATE_LEASE4,
+                            lease->addr_, callback);
+    request->lease4_ = lease;
+    asyncExecute(request);
+}
+
+void
+CqlLeaseMgr::asyncUpdateLease6(const Lease6Ptr& lease,
+                               const AsyncLeaseCallback& callback) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_CQL_UPDATE_ADDR6).arg(lease->addr_.toText());
+
+    CqlAsyncRequest* request =
+        new CqlAsyncRequest(*this, CqlAsyncRequest::UPDATE, UPDATE_LEASE6,
+                            lease->addr_, callback);
+    request->lease6_ = lease;
+    asyncExecute(request);
+}
+
+void
+CqlLeaseMgr::asyncDeleteLease(const isc::asiolink::IOAddress& addr,
+                              const AsyncLeaseCallback& callback) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_CQL_DELETE_ADDR).arg(addr.toText());
+
+    asyncExecute(new CqlAsyncRequest(*this, CqlAsyncRequest::DELETE,
+                                     addr.isV4() ? DELETE_LEASE4 :
+                                     DELETE_LEASE6, addr, callback));
+}
+
+void
+CqlLeaseMgr::asyncWait() {
+    Mutex::Locker lock(async_mutex_);
+    while (async_pending_ > 0) {
+        async_cond_.wait(async_mutex_);
+    }
+}
+
+void
+CqlLeaseMgr::asyncExecute(CqlAsyncRequest* request) {
+    {
+        Mutex::Locker lock(async_mutex_);
+        ++async_pending_;
+    }
+
+    CassStatement* statement = NULL;
+    try {
+        request->createBindForSend();
+
+        statement = cass_prepared_bind(dbconn_.statements_[request->stindex_]);
+        if (NULL == statement) {
+            isc_throw(DbOperationError, "unable to bind statement");
+        }
+
+        CqlLeaseMgr::bindData(statement, request->stindex_, request->data_,
+                              request->exchange());
+
+        // The driver copies the statement, so it is freed right away.
+        CassFuture* future = cass_session_execute(dbconn_.session_, statement);
+        cass_statement_free(statement);
+        statement = NULL;
+        if (NULL == future) {
+            isc_throw(DbOperationError, "unable to execute statement");
+        }
+
+        // The callback holds a reference to the future until it returns.
+        // It is invoked by this thread if the future is already set.
+        CassError rc = cass_future_set_callback(future,
+                                                &CqlLeaseMgr::asyncResult,
+                                                request);
+        cass_future_free(future);
+        if (rc != CASS_OK) {
+            isc_throw(DbOperationError, "unable to set the callback of "
+                      << dbconn_.tagged_statements_[request->stindex_].name_);
+        }
+
+    } catch (const std::exception& ex) {
+        if (statement) {
+            cass_statement_free(statement);
+        }
+        AsyncLeaseResult result;
+        result.error_ = ex.what();
+        asyncComplete(request, result);
+    }
+}
+
+void
+CqlLeaseMgr::asyncResult(CassFuture* future, void* arg) {
+    CqlAsyncRequest* request = static_cast<CqlAsyncRequest*>(arg);
+    AsyncLeaseResult result;
+    const CassResult* resultCollection = NULL;
+    CassIterator* rows = NULL;
+
+    try {
+        std::string error;
+        request->mgr_.dbconn_.checkStatementError(error, future,
+                                                  request->stindex_,
+                                                  "unable to execute");
+        if (cass_future_error_code(future) != CASS_OK) {
+            isc_throw(DbOperationError, error);
+        }
+
+        resultCollection = cass_future_get_result(future);
+        rows = cass_iterator_from_result(resultCollection);
+
+        if (request->operation_ == CqlAsyncRequest::GET) {
+            int rowCount = 0;
+            while (cass_iterator_next(rows)) {
+                if (++rowCount > 1) {
+                    isc_throw(MultipleRecords, "multiple records were found "
+                              "in the database where only one was expected "
+                              "for query " << request->mgr_.dbconn_.
+                              tagged_statements_[request->stindex_].name_);
+                }
+                const CassRow* row = cass_iterator_get_row(rows);
+                if (request->exchange4_) {
+                    result.lease4_ = request->exchange4_->createBindForReceive(row);
+                } else {
+                    result.lease6_ = request->exchange6_->createBindForReceive(row);
+                }
+            }
+            result.success_ = true;
+
+        } else {
+            // Check if statement has been applied.
+            CqlLeaseExchange& exchange = request->exchange();
+            CqlDataArray appliedData;
+            CqlDataArray appliedSize;
+            bool applied = false;
+            while (cass_iterator_next(rows)) {
+                const CassRow* row = cass_iterator_get_row(rows);
+                // [applied]: bool
+                appliedData.add(reinterpret_cast<void*>(&applied));
+                appliedSize.add(NULL);
+                CqlLeaseMgr::getData(row, exchange.parameters_.size() - 1,
+                                     appliedData, appliedSize, 0, exchange);
+            }
+            if (!applied && (request->operation_ == CqlAsyncRequest::UPDATE)) {
+                isc_throw(NoSuchLease, "Statement has not been applied.");
+            }
+            result.success_ = applied;
+        }
+
+    } catch (const std::exception& ex) {
+        result = AsyncLeaseResult();
+        result.error_ = ex.what();
+    }
+
+    // Free resources.
+    if (rows) {
+        cass_iterator_free(rows);
+    }
+    if (resultCollection) {
+        cass_result_free(resultCollection);
+    }
+
+    request->mgr_.asyncComplete(request, result);
+}
+
+void
+CqlLeaseMgr::asyncComplete(CqlAsyncRequest* request,
+                           const AsyncLeaseResult& result) {
+    try {
+        request->callback_(result);
+    } catch (const std::exception& ex) {
+        LOG_ERROR(dhcpsrv_logger, DHCPSRV_CQL_ASYNC_CALLBACK_FAILED)
+            .arg(ex.what());
+    }
+    delete request;
+
+    Mutex::Locker lock(async_mutex_);
+    --async_pending_;
+    async_cond_.broadcast();
+}
+
 size_t
 CqlLeaseMgr::wipeLeases4(const SubnetID& /*subnet_id*/) {
     isc_throw(NotImplemented, "wipeLeases4 is not implemented for Cassandra backend");
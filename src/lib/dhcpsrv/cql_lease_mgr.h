@@ -20,6 +20,7 @@
 #include <dhcp/hwaddr.h>
 #include <dhcpsrv/lease_mgr.h>
 #include <dhcpsrv/cql_connection.h>
+#include <util/threads/sync.h>
 #include <boost/scoped_ptr.hpp>
 #include <boost/utility.hpp>
 #include <cassandra.h>
@@ -61,6 +62,7 @@ class CqlVersionExchange;
 class CqlLeaseExchange;
 class CqlLease4Exchange;
 class CqlLease6Exchange;
+struct CqlAsyncRequest;
 
 /// @brief Cassandra Exchange
 ///
@@ -245,6 +247,45 @@ public:
     virtual Lease4Ptr getLease4(const ClientId& clientid,
                                 SubnetID subnet_id) const;
 
+    /// @brief Returns all IPv4 leases for the particular subnet identifier.
+    ///
+    /// @param subnet_id subnet identifier.
+    ///
+    /// @return Lease collection (may be empty if no IPv4 lease found).
+    ///
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease4Collection getLeases4(SubnetID subnet_id) const;
+
+    /// @brief Returns all IPv4 leases.
+    ///
+    /// @return Lease collection (may be empty if no IPv4 lease found).
+    ///
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease4Collection getLeases4() const;
+
+    /// @brief Returns range of IPv4 leases using paging.
+    ///
+    /// Cassandra doesn't order the rows by the partition key, so the leases
+    /// are returned in the order of the tokens of their addresses. The page
+    /// holds the leases whose tokens follow the token of the lower bound
+    /// address, so the last address of a page is the lower bound of the
+    /// next page as with the other backends. The zero address selects
+    /// the first page.
+    ///
+    /// @param lower_bound_address IPv4 address used as lower bound for the
+    /// returned range.
+    /// @param page_size maximum size of the page returned.
+    ///
+    /// @return Lease collection (may be empty if no IPv4 lease found).
+    /// @throw InvalidParameter if the lower bound is not an IPv4 address.
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease4Collection
+    getLeases4(const asiolink::IOAddress& lower_bound_address,
+               const LeasePageSize& page_size) const;
+
     /// @brief Returns existing IPv6 lease for a given IPv6 address.
     ///
     /// For a given address, we assume that there will be only one lease.
@@ -298,6 +339,42 @@ public:
     ///        failed.
     virtual Lease6Collection getLeases6(Lease::Type type, const DUID& duid,
                                         uint32_t iaid, SubnetID subnet_id) const;
+    /// @brief Returns all IPv6 leases for the particular subnet identifier.
+    ///
+    /// @param subnet_id subnet identifier.
+    ///
+    /// @return Lease collection (may be empty if no IPv6 lease found).
+    ///
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease6Collection getLeases6(SubnetID subnet_id) const;
+
+    /// @brief Returns all IPv6 leases.
+    ///
+    /// @return Lease collection (may be empty if no IPv6 lease found).
+    ///
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease6Collection getLeases6() const;
+
+    /// @brief Returns range of IPv6 leases using paging.
+    ///
+    /// The leases are returned in the order of the tokens of their
+    /// addresses.
+    /// @see getLeases4(const asiolink::IOAddress&, const LeasePageSize&).
+    ///
+    /// @param lower_bound_address IPv6 address used as lower bound for the
+    /// returned range.
+    /// @param page_size maximum size of the page returned.
+    ///
+    /// @return Lease collection (may be empty if no IPv6 lease found).
+    /// @throw InvalidParameter if the lower bound is not an IPv6 address.
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease6Collection
+    getLeases6(const asiolink::IOAddress& lower_bound_address,
+               const LeasePageSize& page_size) const;
+
     /// @brief Returns a collection of expired DHCPv6 leases.
     ///
     /// This method returns at most @c max_leases expired leases. The leases
@@ -439,6 +516,74 @@ public:
     /// This is a no-op for Cassandra.
     virtual void rollback();
 
+    /// @name Asynchronous lease operations.
+    ///
+    /// The statements are executed by the driver without waiting for
+    /// their futures: the callbacks are set on the futures and invoked by
+    /// the threads of the driver when the results arrive, so they may
+    /// complete in a different order than the operations were issued.
+    ///
+    /// The callbacks must not call @ref asyncWait. A failure to bind or
+    /// execute the statement is reported to the callback before the
+    /// operation returns.
+    //@{
+
+    /// @brief Adds an IPv4 lease asynchronously.
+    ///
+    /// @param lease lease to be added
+    /// @param callback callback invoked with the result
+    virtual void asyncAddLease(const Lease4Ptr& lease,
+                               const AsyncLeaseCallback& callback);
+
+    /// @brief Adds an IPv6 lease asynchronously.
+    ///
+    /// @param lease lease to be added
+    /// @param callback callback invoked with the result
+    virtual void asyncAddLease(const Lease6Ptr& lease,
+                               const AsyncLeaseCallback& callback);
+
+    /// @brief Returns an IPv4 lease for specified IPv4 address asynchronously.
+    ///
+    /// @param addr address of the searched lease
+    /// @param callback callback invoked with the result
+    virtual void asyncGetLease4(const isc::asiolink::IOAddress& addr,
+                                const AsyncLeaseCallback& callback);
+
+    /// @brief Returns an IPv6 lease for a given address asynchronously.
+    ///
+    /// @param type specifies lease type: (NA, TA or PD)
+    /// @param addr address of the searched lease
+    /// @param callback callback invoked with the result
+    virtual void asyncGetLease6(Lease::Type type,
+                                const isc::asiolink::IOAddress& addr,
+                                const AsyncLeaseCallback& callback);
+
+    /// @brief Updates an IPv4 lease asynchronously.
+    ///
+    /// @param lease lease to be updated
+    /// @param callback callback invoked with the result
+    virtual void asyncUpdateLease4(const Lease4Ptr& lease,
+                                   const AsyncLeaseCallback& callback);
+
+    /// @brief Updates an IPv6 lease asynchronously.
+    ///
+    /// @param lease lease to be updated
+    /// @param callback callback invoked with the result
+    virtual void asyncUpdateLease6(const Lease6Ptr& lease,
+                                   const AsyncLeaseCallback& callback);
+
+    /// @brief Deletes a lease asynchronously.
+    ///
+    /// @param addr address of the lease to be deleted
+    /// @param callback callback invoked with the result
+    virtual void asyncDeleteLease(const isc::asiolink::IOAddress& addr,
+                                  const AsyncLeaseCallback& callback);
+
+    /// @brief Waits for the completion of the asynchronous operations.
+    virtual void asyncWait();
+
+    //@}
+
     /// @brief Statement Tags
     ///
     /// The contents of the enum are indexes into the list of compiled SQL
@@ -448,16 +593,24 @@ public:
         DELETE_LEASE4_STATE_EXPIRED,// Delete expired lease4s in certain state
         DELETE_LEASE6,              // Delete from lease6 by address
         DELETE_LEASE6_STATE_EXPIRED,// Delete expired lease6s in certain state
+        GET_LEASE4,                 // Get all lease4
         GET_LEASE4_ADDR,            // Get lease4 by address
         GET_LEASE4_CLIENTID,        // Get lease4 by client ID
         GET_LEASE4_CLIENTID_SUBID,  // Get lease4 by client ID & subnet ID
         GET_LEASE4_HWADDR,          // Get lease4 by HW address
         GET_LEASE4_HWADDR_SUBID,    // Get lease4 by HW address & subnet ID
         GET_LEASE4_EXPIRE,          // Get expired lease4
+        GET_LEASE4_LIMIT,           // Get first page of lease4
+        GET_LEASE4_PAGE,            // Get page of lease4 following a token
+        GET_LEASE4_SUBID,           // Get lease4 by subnet ID
+        GET_LEASE6,                 // Get all lease6
         GET_LEASE6_ADDR,            // Get lease6 by address
         GET_LEASE6_DUID_IAID,       // Get lease6 by DUID and IAID
         GET_LEASE6_DUID_IAID_SUBID, // Get lease6 by DUID, IAID and subnet ID
         GET_LEASE6_EXPIRE,          // Get expired lease6
+        GET_LEASE6_LIMIT,           // Get first page of lease6
+        GET_LEASE6_PAGE,            // Get page of lease6 following a token
+        GET_LEASE6_SUBID,           // Get lease6 by subnet ID
         GET_VERSION,                // Obtain version number
         INSERT_LEASE4,              // Add entry to lease4 table
         INSERT_LEASE6,              // Add entry to lease6 table
@@ -681,6 +834,35 @@ private:
     uint64_t deleteExpiredReclaimedLeasesCommon(const uint32_t secs,
                                                 StatementIndex statement_index);
 
+    /// @brief Executes an asynchronous operation.
+    ///
+    /// Binds the data of the operation to its prepared statement and
+    /// executes it, setting @ref asyncResult as the callback of the
+    /// future. A failure is reported to the callback of the operation.
+    ///
+    /// @param request operation to be executed, owned by the lease manager
+    ///        until its callback has returned
+    void asyncExecute(CqlAsyncRequest* request);
+
+    /// @brief Processes the result of an asynchronous operation.
+    ///
+    /// Invoked by a thread of the driver when the future of the
+    /// operation is set.
+    ///
+    /// @param future future of the executed statement
+    /// @param arg operation which the future belongs to
+    static void asyncResult(CassFuture* future, void* arg);
+
+    /// @brief Completes an asynchronous operation.
+    ///
+    /// Invokes the callback of the operation with the result, releases
+    /// the operation and wakes up @ref asyncWait.
+    ///
+    /// @param request completed operation
+    /// @param result result of the operation
+    void asyncComplete(CqlAsyncRequest* request,
+                       const AsyncLeaseResult& result);
+
     /// CQL queries used by CQL backend
     static CqlTaggedStatement tagged_statements_[];
     /// Database connection object
@@ -693,6 +875,15 @@ private:
     boost::scoped_ptr<CqlLease4Exchange> exchange4_; ///< Exchange object
     boost::scoped_ptr<CqlLease6Exchange> exchange6_; ///< Exchange object
     boost::scoped_ptr<CqlVersionExchange> versionExchange_; ///< Exchange object
+
+    /// @brief Number of the asynchronous operations not completed yet.
+    size_t async_pending_;
+
+    /// @brief Mutex protecting the number of pending operations.
+    isc::util::thread::Mutex async_mutex_;
+
+    /// @brief Condition variable signaled when an operation completes.
+    isc::util::thread::CondVar async_cond_;
 };
 
 }; // end of isc::dhcp namespace
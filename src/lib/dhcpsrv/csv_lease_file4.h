@@ -80,6 +80,20 @@ public:
     /// ticket http://kea.isc.org/ticket/2405 is implemented.
     bool next(Lease4Ptr& lease);
 
+    /// @brief Creates the lease from the row read from the CSV file.
+    ///
+    /// This method is used by @c next to create the lease from the row
+    /// after the row has been adapted to the current schema. It doesn't
+    /// modify the state of the file, so it can be called by multiple
+    /// threads parsing the rows of the file read into memory.
+    ///
+    /// @param row Row adapted to the current schema.
+    ///
+    /// @return Pointer to the lease.
+    /// @throw isc::Exception or std::exception if the row doesn't hold
+    /// a valid lease.
+    Lease4Ptr parse(const util::CSVRow& row) const;
+
 private:
 
     /// @brief Initializes columns of the CSV file holding leases.
@@ -105,52 +119,52 @@ private:
     /// @brief Reads lease address from the CSV file row.
     ///
     /// @param row CSV file row holding lease information.
-    asiolink::IOAddress readAddress(const util::CSVRow& row);
+    asiolink::IOAddress readAddress(const util::CSVRow& row) const;
 
     /// @brief Reads HW address from the CSV file row.
     ///
     /// @param row CSV file row holding lease information.
-    HWAddr readHWAddr(const util::CSVRow& row);
+    HWAddr readHWAddr(const util::CSVRow& row) const;
 
     /// @brief Reads client identifier from the CSV file row.
     ///
     /// @param row CSV file row holding lease information.
-    ClientIdPtr readClientId(const util::CSVRow& row);
+    ClientIdPtr readClientId(const util::CSVRow& row) const;
 
     /// @brief Reads valid lifetime from the CSV file row.
     ///
     /// @param row CSV file row holding lease information.
-    uint32_t readValid(const util::CSVRow& row);
+    uint32_t readValid(const util::CSVRow& row) const;
 
     /// @brief Reads cltt value from the CSV file row.
     ///
     /// @param row CSV file row holding lease information.
-    time_t readCltt(const util::CSVRow& row);
+    time_t readCltt(const util::CSVRow& row) const;
 
     /// @brief Reads subnet id from the CSV file row.
     ///
     /// @param row CSV file row holding lease information.
-    SubnetID readSubnetID(const util::CSVRow& row);
+    SubnetID readSubnetID(const util::CSVRow& row) const;
 
     /// @brief Reads the FQDN forward flag from the CSV file row.
     ///
     /// @param row CSV file row holding lease information.
-    bool readFqdnFwd(const util::CSVRow& row);
+    bool readFqdnFwd(const util::CSVRow& row) const;
 
     /// @brief Reads the FQDN reverse flag from the CSV file row.
     ///
     /// @param row CSV file row holding lease information.
-    bool readFqdnRev(const util::CSVRow& row);
+    bool readFqdnRev(const util::CSVRow& row) const;
 
     /// @brief Reads hostname from the CSV file row.
     ///
     /// @param row CSV file row holding lease information.
-    std::string readHostname(const util::CSVRow& row);
+    std::string readHostname(const util::CSVRow& row) const;
 
     /// @brief Reads lease state from the CSV file row.
     ///
     /// @param row CSV file row holding lease information.
-    uint32_t readState(const util::CSVRow& row);
+    uint32_t readState(const util::CSVRow& row) const;
     //@}
 
 };
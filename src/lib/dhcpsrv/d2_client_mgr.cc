@@ -286,6 +286,7 @@ D2ClientMgr::sendRequest(dhcp_ddns::NameChangeRequestPtr& ncr) {
         isc_throw(D2ClientError, "D2ClientMgr::sendRequest not in send mode");
     }
 
+    isc::util::thread::Mutex::Locker lock(mutex_);
     try {
         name_change_sender_->sendRequest(ncr);
     } catch (const std::exception& ex) {
@@ -380,6 +381,7 @@ D2ClientMgr::runReadyIO() {
                   " name_change_sender is null");
     }
 
+    isc::util::thread::Mutex::Locker lock(mutex_);
     name_change_sender_->runReadyIO();
 }
 
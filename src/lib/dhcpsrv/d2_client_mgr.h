@@ -15,6 +15,7 @@
 #include <dhcp_ddns/ncr_io.h>
 #include <dhcpsrv/d2_client_cfg.h>
 #include <exceptions/exceptions.h>
+#include <util/threads/sync.h>
 
 #include <boost/shared_ptr.hpp>
 #include <boost/noncopyable.hpp>
@@ -423,6 +424,12 @@ private:
 
     /// @brief Remembers the select-fd registered with IfaceMgr.
     int registered_select_fd_;
+
+    /// @brief Serializes access to the sender.
+    ///
+    /// Requests may be queued by the packet processing threads while the
+    /// sender's IO is carried out by the main thread.
+    isc::util::thread::Mutex mutex_;
 };
 
 template <class T>
@@ -11,6 +11,8 @@
 
 #include <boost/algorithm/string.hpp>
 #include <boost/foreach.hpp>
+#include <boost/lexical_cast.hpp>
+#include <limits>
 #include <vector>
 
 using namespace std;
@@ -58,6 +60,29 @@ DatabaseConnection::parse(const std::string& dbaccess) {
     return (mapped_tokens);
 }
 
+uint32_t
+DatabaseConnection::getUint32Parameter(const ParameterMap& parameters,
+                                       const std::string& name,
+                                       const uint32_t default_value) {
+    ParameterMap::const_iterator param = parameters.find(name);
+    if (param == parameters.end()) {
+        return (default_value);
+    }
+    int64_t value = 0;
+    try {
+        value = boost::lexical_cast<int64_t>(param->second);
+    } catch (const boost::bad_lexical_cast&) {
+        isc_throw(BadValue, "invalid value of the " << name
+                  << " parameter: " << param->second);
+    }
+    if ((value < 0) || (value > std::numeric_limits<uint32_t>::max())) {
+        isc_throw(BadValue, name << " value: " << value
+                  << " is out of range, expected value: 0.."
+                  << std::numeric_limits<uint32_t>::max());
+    }
+    return (static_cast<uint32_t>(value));
+}
+
 std::string
 DatabaseConnection::redactedAccessString(const ParameterMap& parameters) {
     // Reconstruct the access string: start of with an empty string, then
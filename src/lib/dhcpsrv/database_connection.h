@@ -7,10 +7,16 @@
 #ifndef DATABASE_CONNECTION_H
 #define DATABASE_CONNECTION_H
 
+#include <boost/function.hpp>
 #include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
 #include <exceptions/exceptions.h>
+#include <util/threads/sync.h>
 #include <map>
 #include <string>
+#include <vector>
+#include <stdint.h>
+#include <time.h>
 
 namespace isc {
 namespace dhcp {
@@ -91,7 +97,7 @@ public:
     /// @param parameters A data structure relating keywords and values
     ///        concerned with the database.
     DatabaseConnection(const ParameterMap& parameters)
-        :parameters_(parameters) {
+        :parameters_(parameters), recoverable_(false) {
     }
 
     /// @brief Returns value of a connection parameter.
@@ -121,6 +127,18 @@ public:
     /// @return Redacted database access string.
     static std::string redactedAccessString(const ParameterMap& parameters);
 
+    /// @brief Returns the value of an unsigned integer parameter.
+    ///
+    /// @param parameters Database access parameters (output of "parse").
+    /// @param name Name of the parameter.
+    /// @param default_value Value returned if the parameter is not specified.
+    ///
+    /// @return Value of the parameter.
+    /// @throw BadValue if the value is not a valid unsigned 32-bit integer.
+    static uint32_t getUint32Parameter(const ParameterMap& parameters,
+                                       const std::string& name,
+                                       const uint32_t default_value);
+
     /// @brief Convenience method checking if database should be opened with
     /// read only access.
     ///
@@ -129,6 +147,23 @@ public:
     /// and set to false.
     bool configuredReadOnly() const;
 
+    /// @brief Sets whether the loss of the connection is recoverable.
+    ///
+    /// By default, an error indicating that the connection to the database
+    /// is lost is fatal: the server exits so it can be restarted. The
+    /// connections of a @ref DatabaseConnectionPool are replaced instead,
+    /// so the error is reported with an exception.
+    ///
+    /// @param recoverable true if the loss of the connection is recoverable.
+    void setRecoverable(const bool recoverable) {
+        recoverable_ = recoverable;
+    }
+
+    /// @brief Indicates if the loss of the connection is recoverable.
+    bool isRecoverable() const {
+        return (recoverable_);
+    }
+
 private:
 
     /// @brief List of parameters passed in dbconfig
@@ -138,6 +173,234 @@ private:
     /// intended to keep any DHCP-related parameters.
     ParameterMap parameters_;
 
+    /// @brief Indicates if the loss of the connection is recoverable.
+    bool recoverable_;
+};
+
+/// @brief Pool of database connections.
+///
+/// The pool holds up to a configured number of contexts, each owning a
+/// connection to the database with its own set of prepared statements
+/// and the state of the backend bound to it (e.g. the exchange objects).
+/// A thread acquires a context for the duration of a database operation,
+/// so the threads use different connections concurrently. When all the
+/// contexts are in use, the thread waits until one is released.
+///
+/// The connection of an idle context is checked before the context is
+/// handed out, usually with a round trip to the database server, so a
+/// connection dropped while idle is detected: a context whose connection
+/// was lost (e.g. because the database server was restarted or failed
+/// over) is discarded and a new one is opened in its place. When the connection can't be opened, the
+/// next attempt is delayed by the reconnect wait time, doubled after each
+/// consecutive failure up to 64 times the configured value. In the
+/// meantime, the operations fail immediately with @c DbOpenError rather
+/// than blocking the threads.
+///
+/// @tparam Context type of the contexts, providing the
+/// <tt>bool isUsable() const</tt> method which checks the connection.
+template<typename Context>
+class DatabaseConnectionPool : public boost::noncopyable {
+public:
+
+    /// @brief Pointer to a context.
+    typedef boost::shared_ptr<Context> ContextPtr;
+
+    /// @brief Function opening a connection and returning its context.
+    typedef boost::function<ContextPtr ()> ContextFactory;
+
+    /// @brief Context acquired from a pool for the lifetime of the object.
+    class Holder : public boost::noncopyable {
+    public:
+
+        /// @brief Constructor.
+        ///
+        /// @param pool pool the context is acquired from.
+        /// @throw DbOpenError if a connection can't be opened.
+        explicit Holder(DatabaseConnectionPool& pool)
+            : pool_(pool), context_(pool.acquire()) {
+        }
+
+        /// @brief Destructor.
+        ///
+        /// Releases the context to the pool.
+        ~Holder() {
+            pool_.release(context_);
+        }
+
+        /// @brief Returns the acquired context.
+        Context& operator*() const {
+            return (*context_);
+        }
+
+        /// @brief Returns the acquired context.
+        Context* operator->() const {
+            return (context_.get());
+        }
+
+    private:
+
+        /// @brief Pool the context is acquired from.
+        DatabaseConnectionPool& pool_;
+
+        /// @brief Acquired context.
+        ContextPtr context_;
+    };
+
+    /// @brief Constructor.
+    ///
+    /// Opens the first connection, so the configuration errors are
+    /// reported by the constructor.
+    ///
+    /// @param factory function opening a connection.
+    /// @param max_size maximum number of connections.
+    /// @param reconnect_wait_time time to wait after a failure to open a
+    /// connection before the next attempt, in milliseconds.
+    /// @throw BadValue if the maximum number of connections is 0.
+    DatabaseConnectionPool(const ContextFactory& factory,
+                           const size_t max_size,
+                           const uint32_t reconnect_wait_time)
+        : factory_(factory), max_size_(max_size),
+          reconnect_wait_time_(reconnect_wait_time), size_(0), idle_(),
+          failures_(0), next_attempt_(0), mutex_(), cond_() {
+        if (max_size_ == 0) {
+            isc_throw(BadValue, "maximum number of the database connections"
+                      " must be greater than 0");
+        }
+        idle_.push_back(factory_());
+        size_ = 1;
+    }
+
+    /// @brief Destructor.
+    virtual ~DatabaseConnectionPool() {
+    }
+
+    /// @brief Acquires a context.
+    ///
+    /// Returns an idle context whose connection is usable, or opens a new
+    /// connection if the maximum number of connections is not reached.
+    /// Otherwise, waits until a context is released.
+    ///
+    /// @return acquired context, to be released with @ref release.
+    /// @throw DbOpenError if a connection can't be opened or the next
+    /// attempt to open it is delayed.
+    ContextPtr acquire() {
+        for (;;) {
+            ContextPtr context;
+            {
+                isc::util::thread::Mutex::Locker lock(mutex_);
+                while (idle_.empty() && (size_ >= max_size_)) {
+                    cond_.wait(mutex_);
+                }
+                if (idle_.empty()) {
+                    const int64_t now = getCurrentTime();
+                    if (now < next_attempt_) {
+                        isc_throw(DbOpenError, "unable to open a connection"
+                                  " to the database, next attempt in "
+                                  << (next_attempt_ - now) << " ms");
+                    }
+                    ++size_;
+                    break;
+                }
+                context = idle_.back();
+                idle_.pop_back();
+            }
+
+            // The connection is checked without holding the mutex, as the
+            // check may involve a round trip to the database server.
+            if (context->isUsable()) {
+                return (context);
+            }
+
+            // The connection was lost.
+            isc::util::thread::Mutex::Locker lock(mutex_);
+            --size_;
+            cond_.signal();
+        }
+
+        // The connection is opened without holding the mutex, so the
+        // other threads can use the other contexts in the meantime.
+        ContextPtr context;
+        try {
+            context = factory_();
+
+        } catch (...) {
+            isc::util::thread::Mutex::Locker lock(mutex_);
+            --size_;
+            if (failures_ < 7) {
+                ++failures_;
+            }
+            next_attempt_ = getCurrentTime() +
+                (static_cast<int64_t>(reconnect_wait_time_) << (failures_ - 1));
+            cond_.signal();
+            throw;
+        }
+
+        isc::util::thread::Mutex::Locker lock(mutex_);
+        failures_ = 0;
+        next_attempt_ = 0;
+        return (context);
+    }
+
+    /// @brief Releases a context acquired with @ref acquire.
+    ///
+    /// @param context released context.
+    void release(const ContextPtr& context) {
+        isc::util::thread::Mutex::Locker lock(mutex_);
+        idle_.push_back(context);
+        cond_.signal();
+    }
+
+    /// @brief Returns the maximum number of connections.
+    size_t getMaxSize() const {
+        return (max_size_);
+    }
+
+    /// @brief Returns the number of open connections.
+    size_t size() const {
+        isc::util::thread::Mutex::Locker lock(mutex_);
+        return (size_);
+    }
+
+protected:
+
+    /// @brief Returns the current time in milliseconds.
+    ///
+    /// This method is virtual so the tests can move the time forward.
+    virtual int64_t getCurrentTime() const {
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return (static_cast<int64_t>(now.tv_sec) * 1000 +
+                now.tv_nsec / 1000000);
+    }
+
+private:
+
+    /// @brief Function opening a connection.
+    ContextFactory factory_;
+
+    /// @brief Maximum number of connections.
+    size_t max_size_;
+
+    /// @brief Time to wait after a failure to open a connection.
+    uint32_t reconnect_wait_time_;
+
+    /// @brief Number of open connections, idle or in use.
+    size_t size_;
+
+    /// @brief Idle contexts.
+    std::vector<ContextPtr> idle_;
+
+    /// @brief Number of consecutive failures to open a connection.
+    int failures_;
+
+    /// @brief Time before which no connection is opened.
+    int64_t next_attempt_;
+
+    /// @brief Mutex protecting the contexts.
+    mutable isc::util::thread::Mutex mutex_;
+
+    /// @brief Condition variable signaled when a context is released.
+    isc::util::thread::CondVar cond_;
 };
 
 }; // end of isc::dhcp namespace
@@ -0,0 +1,217 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/group_commit_writer.h>
+#include <exceptions/exceptions.h>
+#include <boost/bind.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace isc::util;
+using namespace isc::util::thread;
+using namespace boost::posix_time;
+
+namespace isc {
+namespace dhcp {
+
+GroupCommitWriter::GroupCommitWriter(const size_t max_batch,
+                                     const uint32_t max_latency,
+                                     const bool sync)
+    : max_batch_(max_batch), max_latency_(max_latency), sync_(sync),
+      filename_(), fd_(-1), pending_(), pending_rows_(0), appended_(0),
+      durable_(0), batches_(0), running_(false), error_(), thread_(),
+      mutex_(), work_cond_(), durable_cond_() {
+    if (max_batch_ == 0) {
+        isc_throw(BadValue, "maximum number of rows written at once must"
+                  " be greater than 0");
+    }
+}
+
+GroupCommitWriter::~GroupCommitWriter() {
+    close();
+}
+
+void
+GroupCommitWriter::open(const std::string& filename) {
+    close();
+
+    int fd = ::open(filename.c_str(), O_WRONLY | O_APPEND | O_CREAT, 0644);
+    if (fd < 0) {
+        isc_throw(CSVFileError, "unable to open '" << filename
+                  << "' for group commit: " << strerror(errno));
+    }
+    // Don't leak the descriptor to the LFC process.
+    static_cast<void>(fcntl(fd, F_SETFD, FD_CLOEXEC));
+
+    Mutex::Locker lock(mutex_);
+    filename_ = filename;
+    fd_ = fd;
+    error_.clear();
+    running_ = true;
+    thread_.reset(new Thread(boost::bind(&GroupCommitWriter::run, this)));
+}
+
+void
+GroupCommitWriter::write(const std::string& text) {
+    Mutex::Locker lock(mutex_);
+    if (!error_.empty()) {
+        isc_throw(CSVFileError, "unable to write to '" << filename_
+                  << "' after previous error: " << error_);
+    }
+    if (!running_) {
+        isc_throw(CSVFileError, "group commit writer is not open");
+    }
+
+    pending_.append(text);
+    ++pending_rows_;
+    ++appended_;
+
+    // Wake up the writer thread when it has something to write and when
+    // the group is full.
+    if ((pending_rows_ == 1) || (pending_rows_ == max_batch_)) {
+        work_cond_.signal();
+    }
+}
+
+void
+GroupCommitWriter::close() {
+    {
+        Mutex::Locker lock(mutex_);
+        if (!thread_) {
+            return;
+        }
+        running_ = false;
+        work_cond_.signal();
+    }
+
+    // The thread writes out the pending rows before it terminates.
+    try {
+        thread_->wait();
+    } catch (...) {
+        // The thread doesn't throw on write errors. There is nothing
+        // sensible to do about other errors here.
+    }
+
+    Mutex::Locker lock(mutex_);
+    thread_.reset();
+    ::close(fd_);
+    fd_ = -1;
+    durable_cond_.broadcast();
+}
+
+uint64_t
+GroupCommitWriter::getLastSequence() const {
+    Mutex::Locker lock(mutex_);
+    return (appended_);
+}
+
+void
+GroupCommitWriter::waitDurable(const uint64_t sequence) {
+    Mutex::Locker lock(mutex_);
+    while ((durable_ < sequence) && error_.empty() && thread_) {
+        durable_cond_.wait(mutex_);
+    }
+    if (durable_ < sequence) {
+        isc_throw(CSVFileError, "unable to write to '" << filename_
+                  << "': " << (error_.empty() ? "writer closed" : error_));
+    }
+}
+
+uint64_t
+GroupCommitWriter::getBatchCount() const {
+    Mutex::Locker lock(mutex_);
+    return (batches_);
+}
+
+void
+GroupCommitWriter::run() {
+    for (;;) {
+        std::string group;
+        uint64_t last = 0;
+        {
+            Mutex::Locker lock(mutex_);
+            while (running_ && (pending_rows_ == 0)) {
+                work_cond_.wait(mutex_);
+            }
+            if (pending_rows_ == 0) {
+                // Stopped and there is nothing more to write.
+                return;
+            }
+            waitForGroup();
+            group.swap(pending_);
+            pending_rows_ = 0;
+            last = appended_;
+        }
+
+        // Write without holding the mutex so as the other threads can
+        // append rows to the next group in the meantime.
+        const std::string error = writeGroup(group);
+
+        Mutex::Locker lock(mutex_);
+        ++batches_;
+        if (error.empty()) {
+            durable_ = last;
+        } else if (error_.empty()) {
+            error_ = error;
+        }
+        durable_cond_.broadcast();
+    }
+}
+
+void
+GroupCommitWriter::waitForGroup() {
+    if ((max_latency_ == 0) || !running_) {
+        return;
+    }
+
+    const ptime deadline = microsec_clock::universal_time() +
+        milliseconds(max_latency_);
+    while (running_ && (pending_rows_ < max_batch_)) {
+        const time_duration left = deadline - microsec_clock::universal_time();
+        if (left.is_negative() || (left.total_milliseconds() == 0)) {
+            return;
+        }
+        if (!work_cond_.timedWait(mutex_, left.total_milliseconds())) {
+            return;
+        }
+    }
+}
+
+std::string
+GroupCommitWriter::writeGroup(const std::string& group) const {
+    size_t written = 0;
+    while (written < group.size()) {
+        ssize_t ret = ::write(fd_, group.data() + written,
+                              group.size() - written);
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return (strerror(errno));
+        }
+        written += static_cast<size_t>(ret);
+    }
+
+    if (sync_) {
+#ifdef OS_LINUX
+        const int ret = fdatasync(fd_);
+#else
+        const int ret = fsync(fd_);
+#endif
+        if (ret != 0) {
+            return (strerror(errno));
+        }
+    }
+    return ("");
+}
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
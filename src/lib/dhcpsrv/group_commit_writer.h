@@ -0,0 +1,193 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef GROUP_COMMIT_WRITER_H
+#define GROUP_COMMIT_WRITER_H
+
+#include <util/csv_file.h>
+#include <util/threads/sync.h>
+#include <util/threads/thread.h>
+#include <boost/noncopyable.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/shared_ptr.hpp>
+#include <string>
+#include <stdint.h>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Writer of the lease file rows which commits them in groups.
+///
+/// The Memfile backend appends a row to the lease file for each lease
+/// update. By default, each row is written into the file separately,
+/// which results in a system call per lease update. When the leases are
+/// updated by multiple threads, this writer collects the rows appended
+/// by these threads and writes them into the file with a single system
+/// call, optionally followed by the @c fdatasync, which makes sure that
+/// the rows reached the storage.
+///
+/// The rows are written by the dedicated thread, which is started when
+/// the writer is opened and stopped when it is closed. Each appended row
+/// is assigned a sequence number. The caller retrieves the sequence number
+/// of the last appended row with @c getLastSequence and then waits for
+/// the row to be written with @c waitDurable, typically after releasing
+/// the locks it held while appending the row. This allows other threads
+/// to append their rows to the same group in the meantime.
+///
+/// The group is written when the writer thread wakes up after the first
+/// row has been appended to it and, if the maximum latency is not zero,
+/// when the group contains the maximum number of rows or the maximum
+/// latency elapses, whichever comes first.
+///
+/// If writing the group fails, the writer enters the error state. The
+/// callers waiting for the rows of this group and all subsequent calls to
+/// @c write throw @c isc::util::CSVFileError until the writer is reopened,
+/// e.g. when the lease file is rotated.
+///
+/// This class is thread safe.
+class GroupCommitWriter : public util::CSVFileWriter,
+                          public boost::noncopyable {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param max_batch Maximum number of rows written at once.
+    /// @param max_latency Maximum time in milliseconds the writer waits
+    /// for more rows to be appended to the group. If it is 0, the group is
+    /// written as soon as the writer thread picks it up.
+    /// @param sync Indicates if the rows should be synchronized with the
+    /// storage after writing each group.
+    /// @throw BadValue if the maximum number of rows is 0.
+    GroupCommitWriter(const size_t max_batch, const uint32_t max_latency,
+                      const bool sync);
+
+    /// @brief Destructor.
+    ///
+    /// Writes out the pending rows and closes the file.
+    virtual ~GroupCommitWriter();
+
+    /// @brief Opens the file for appending and starts the writer thread.
+    ///
+    /// If the writer is already open, it is closed first. Opening the
+    /// writer clears the error state.
+    ///
+    /// @param filename Name of the file.
+    /// @throw isc::util::CSVFileError if the file can't be opened.
+    virtual void open(const std::string& filename);
+
+    /// @brief Appends the row to the current group.
+    ///
+    /// @param text Text of the row.
+    /// @throw isc::util::CSVFileError if the writer is not open or it is
+    /// in the error state.
+    virtual void write(const std::string& text);
+
+    /// @brief Writes out the pending rows, stops the writer thread and
+    /// closes the file.
+    virtual void close();
+
+    /// @brief Returns the sequence number of the last appended row.
+    uint64_t getLastSequence() const;
+
+    /// @brief Waits until the row has been written.
+    ///
+    /// @param sequence Sequence number of the row.
+    /// @throw isc::util::CSVFileError if writing the group containing the
+    /// row has failed.
+    void waitDurable(const uint64_t sequence);
+
+    /// @brief Returns the number of groups written so far.
+    uint64_t getBatchCount() const;
+
+    /// @brief Returns the maximum number of rows written at once.
+    size_t getMaxBatch() const {
+        return (max_batch_);
+    }
+
+    /// @brief Returns the maximum latency in milliseconds.
+    uint32_t getMaxLatency() const {
+        return (max_latency_);
+    }
+
+    /// @brief Checks if the groups are synchronized with the storage.
+    bool getSync() const {
+        return (sync_);
+    }
+
+private:
+
+    /// @brief Main function of the writer thread.
+    void run();
+
+    /// @brief Waits for more rows to be appended to the group.
+    ///
+    /// The mutex must be locked by the caller.
+    void waitForGroup();
+
+    /// @brief Writes the group into the file.
+    ///
+    /// @param group Rows to be written.
+    /// @return Empty string on success, error message on failure.
+    std::string writeGroup(const std::string& group) const;
+
+    /// @brief Maximum number of rows written at once.
+    size_t max_batch_;
+
+    /// @brief Maximum latency in milliseconds.
+    uint32_t max_latency_;
+
+    /// @brief Indicates if the groups are synchronized with the storage.
+    bool sync_;
+
+    /// @brief Name of the open file.
+    std::string filename_;
+
+    /// @brief Descriptor of the open file or -1.
+    int fd_;
+
+    /// @brief Rows waiting to be written.
+    std::string pending_;
+
+    /// @brief Number of rows waiting to be written.
+    size_t pending_rows_;
+
+    /// @brief Sequence number of the last appended row.
+    uint64_t appended_;
+
+    /// @brief Sequence number of the last written row.
+    uint64_t durable_;
+
+    /// @brief Number of groups written.
+    uint64_t batches_;
+
+    /// @brief Indicates if the writer thread should keep running.
+    bool running_;
+
+    /// @brief Holds the error message when the writer is in the error
+    /// state.
+    std::string error_;
+
+    /// @brief Writer thread.
+    boost::scoped_ptr<util::thread::Thread> thread_;
+
+    /// @brief Mutex protecting the writer state.
+    mutable util::thread::Mutex mutex_;
+
+    /// @brief Signals the writer thread when rows are appended or when it
+    /// should stop.
+    util::thread::CondVar work_cond_;
+
+    /// @brief Signals the callers waiting for their rows to be written.
+    util::thread::CondVar durable_cond_;
+};
+
+/// @brief Pointer to the @c GroupCommitWriter.
+typedef boost::shared_ptr<GroupCommitWriter> GroupCommitWriterPtr;
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
+
+#endif // GROUP_COMMIT_WRITER_H
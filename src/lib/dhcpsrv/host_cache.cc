@@ -0,0 +1,140 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/host_cache.h>
+
+using namespace isc::stats;
+using namespace isc::util::thread;
+
+namespace isc {
+namespace dhcp {
+
+HostCache::Key::Key(const char* lookup)
+    : key_(lookup) {
+    key_.push_back('\0');
+}
+
+HostCache::Key&
+HostCache::Key::add(const uint32_t value) {
+    key_.push_back(static_cast<char>(value >> 24));
+    key_.push_back(static_cast<char>(value >> 16));
+    key_.push_back(static_cast<char>(value >> 8));
+    key_.push_back(static_cast<char>(value));
+    return (*this);
+}
+
+HostCache::Key&
+HostCache::Key::add(const Host::IdentifierType& identifier_type,
+                    const uint8_t* identifier_begin,
+                    const size_t identifier_len) {
+    key_.push_back(static_cast<char>(identifier_type));
+    append(identifier_begin, identifier_len);
+    return (*this);
+}
+
+HostCache::Key&
+HostCache::Key::add(const std::vector<uint8_t>& data) {
+    append(data.empty() ? 0 : &data[0], data.size());
+    return (*this);
+}
+
+void
+HostCache::Key::append(const uint8_t* data, const size_t len) {
+    // The length prefix keeps the keys of different parameters distinct.
+    add(static_cast<uint32_t>(len));
+    if (len > 0) {
+        key_.append(reinterpret_cast<const char*>(data), len);
+    }
+}
+
+HostCache::HostCache(const size_t max_size, const uint32_t ttl,
+                     const uint32_t negative_ttl)
+    : max_size_(max_size), ttl_(ttl), negative_ttl_(negative_ttl),
+      entries_(), hits_(StatsMgr::instance().getHandle("host-cache-hits")),
+      misses_(StatsMgr::instance().getHandle("host-cache-misses")),
+      mutex_() {
+    if (max_size_ == 0) {
+        isc_throw(BadValue, "maximum size of the host cache must be greater"
+                  " than 0");
+    }
+    updateSize();
+}
+
+bool
+HostCache::get(const Key& key, ConstHostCollection& hosts) {
+    const time_t now = getCurrentTime();
+    {
+        Mutex::Locker lock(mutex_);
+        EntryContainer::nth_index<1>::type& idx = entries_.get<1>();
+        EntryContainer::nth_index<1>::type::iterator it = idx.find(key.str());
+        if (it != idx.end()) {
+            if (it->expire_ > now) {
+                hosts = it->hosts_;
+                // Move the entry to the front of the recently used ones.
+                entries_.relocate(entries_.begin(), entries_.project<0>(it));
+                StatsMgr::instance().addValue(hits_, static_cast<int64_t>(1));
+                return (true);
+            }
+            idx.erase(it);
+            updateSize();
+        }
+    }
+    StatsMgr::instance().addValue(misses_, static_cast<int64_t>(1));
+    return (false);
+}
+
+void
+HostCache::insert(const Key& key, const ConstHostCollection& hosts) {
+    Entry entry;
+    entry.key_ = key.str();
+    entry.hosts_ = hosts;
+    entry.expire_ = getCurrentTime() + (hosts.empty() ? negative_ttl_ : ttl_);
+
+    Mutex::Locker lock(mutex_);
+    // Another thread may have cached the same lookup in the meantime,
+    // in which case its entry is replaced.
+    EntryContainer::nth_index<1>::type& idx = entries_.get<1>();
+    EntryContainer::nth_index<1>::type::iterator it = idx.find(entry.key_);
+    if (it != idx.end()) {
+        idx.erase(it);
+    }
+    while (entries_.size() >= max_size_) {
+        entries_.pop_back();
+    }
+    entries_.push_front(entry);
+    updateSize();
+}
+
+size_t
+HostCache::flush() {
+    Mutex::Locker lock(mutex_);
+    const size_t count = entries_.size();
+    entries_.clear();
+    updateSize();
+    return (count);
+}
+
+size_t
+HostCache::size() const {
+    Mutex::Locker lock(mutex_);
+    return (entries_.size());
+}
+
+time_t
+HostCache::getCurrentTime() const {
+    return (time(NULL));
+}
+
+void
+HostCache::updateSize() {
+    StatsMgr::instance().setValue("host-cache-size",
+                                  static_cast<int64_t>(entries_.size()));
+}
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
@@ -0,0 +1,232 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef HOST_CACHE_H
+#define HOST_CACHE_H
+
+#include <dhcpsrv/host.h>
+#include <exceptions/exceptions.h>
+#include <stats/stats_mgr.h>
+#include <util/threads/sync.h>
+#include <boost/multi_index_container.hpp>
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include <time.h>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief No host cache exception
+///
+/// Thrown if an attempt is made to use the host cache when it is not
+/// enabled.
+class NoHostCache : public Exception {
+public:
+    NoHostCache(const char* file, size_t line, const char* what) :
+        isc::Exception(file, line, what) {}
+};
+
+/// @brief Cache of the results of the host lookups in a host data source.
+///
+/// The SQL host data sources run a query for each host lookup, i.e. for
+/// most of the received packets. This cache holds the hosts returned by
+/// recent lookups, keyed by the lookup parameters (see @ref HostCache::Key).
+/// A lookup which returned no host is cached too (negative entry), so the
+/// clients without reservation don't cause a query for each packet either.
+///
+/// An entry expires after a configurable time to live, which bounds the
+/// delay after which the changes made in the database by other servers
+/// are seen. The negative entries have their own time to live. When the
+/// cache is full, the least recently used entry is evicted.
+///
+/// The cache updates the following statistics:
+/// - host-cache-hits: number of lookups answered from the cache,
+/// - host-cache-misses: number of lookups sent to the data source,
+/// - host-cache-size: number of cached entries.
+///
+/// The cache is shared by the packet processing threads and protected by
+/// a mutex.
+class HostCache : public boost::noncopyable {
+public:
+
+    /// @brief Key of a cache entry.
+    ///
+    /// The key is an opaque byte string built by @ref Key methods from the
+    /// type and parameters of a lookup.
+    class Key {
+    public:
+
+        /// @brief Constructor.
+        ///
+        /// @param lookup name of the lookup, distinguishing the lookups
+        /// with the same parameters
+        explicit Key(const char* lookup);
+
+        /// @brief Appends a subnet identifier or another integer.
+        ///
+        /// @param value integer value
+        /// @return reference to this key
+        Key& add(const uint32_t value);
+
+        /// @brief Appends an identifier.
+        ///
+        /// @param identifier_type identifier type
+        /// @param identifier_begin pointer to the first byte of the identifier
+        /// @param identifier_len identifier length
+        /// @return reference to this key
+        Key& add(const Host::IdentifierType& identifier_type,
+                 const uint8_t* identifier_begin,
+                 const size_t identifier_len);
+
+        /// @brief Appends a byte string, e.g. an address.
+        ///
+        /// @param data byte string
+        /// @return reference to this key
+        Key& add(const std::vector<uint8_t>& data);
+
+        /// @brief Returns the key as a string.
+        const std::string& str() const {
+            return (key_);
+        }
+
+    private:
+
+        /// @brief Appends a byte string prefixed by its length.
+        ///
+        /// @param data pointer to the first byte
+        /// @param len length of the byte string
+        void append(const uint8_t* data, const size_t len);
+
+        /// @brief The key.
+        std::string key_;
+    };
+
+    /// @brief Constructor.
+    ///
+    /// @param max_size maximum number of entries
+    /// @param ttl time to live of the entries holding hosts, in seconds
+    /// @param negative_ttl time to live of the entries holding no host,
+    /// in seconds
+    /// @throw BadValue if the maximum size is 0
+    HostCache(const size_t max_size, const uint32_t ttl,
+              const uint32_t negative_ttl);
+
+    /// @brief Destructor.
+    virtual ~HostCache() { }
+
+    /// @brief Returns the hosts cached for a lookup.
+    ///
+    /// An expired entry is removed and reported as not found.
+    ///
+    /// @param key key of the lookup
+    /// @param [out] hosts cached hosts, possibly none
+    /// @return true if an entry was found, false if the lookup must be
+    /// sent to the host data source
+    bool get(const Key& key, ConstHostCollection& hosts);
+
+    /// @brief Caches the hosts returned by a lookup.
+    ///
+    /// @param key key of the lookup
+    /// @param hosts hosts returned by the lookup, possibly none
+    void insert(const Key& key, const ConstHostCollection& hosts);
+
+    /// @brief Removes all entries.
+    ///
+    /// @return number of removed entries
+    size_t flush();
+
+    /// @brief Returns the number of entries.
+    size_t size() const;
+
+    /// @brief Returns the maximum number of entries.
+    size_t getMaxSize() const {
+        return (max_size_);
+    }
+
+    /// @brief Returns the time to live of the entries holding hosts.
+    uint32_t getTTL() const {
+        return (ttl_);
+    }
+
+    /// @brief Returns the time to live of the entries holding no host.
+    uint32_t getNegativeTTL() const {
+        return (negative_ttl_);
+    }
+
+protected:
+
+    /// @brief Returns the current time.
+    ///
+    /// This method is virtual so the tests can move the time forward.
+    virtual time_t getCurrentTime() const;
+
+private:
+
+    /// @brief Cache entry.
+    struct Entry {
+        /// @brief Key of the lookup.
+        std::string key_;
+
+        /// @brief Hosts returned by the lookup.
+        ConstHostCollection hosts_;
+
+        /// @brief Time after which the entry is expired.
+        time_t expire_;
+    };
+
+    /// @brief Entries, by recent use and by key.
+    ///
+    /// The sequenced index holds the most recently used entry first.
+    typedef boost::multi_index_container<
+        Entry,
+        boost::multi_index::indexed_by<
+            boost::multi_index::sequenced<>,
+            boost::multi_index::hashed_unique<
+                boost::multi_index::member<Entry, std::string, &Entry::key_>
+            >
+        >
+    > EntryContainer;
+
+    /// @brief Sets the size statistic.
+    ///
+    /// Must be called with the mutex held.
+    void updateSize();
+
+    /// @brief Maximum number of entries.
+    size_t max_size_;
+
+    /// @brief Time to live of the entries holding hosts.
+    uint32_t ttl_;
+
+    /// @brief Time to live of the entries holding no host.
+    uint32_t negative_ttl_;
+
+    /// @brief Cached entries.
+    EntryContainer entries_;
+
+    /// @brief Handle of the "host-cache-hits" statistic.
+    isc::stats::StatHandle hits_;
+
+    /// @brief Handle of the "host-cache-misses" statistic.
+    isc::stats::StatHandle misses_;
+
+    /// @brief Mutex protecting the entries.
+    mutable isc::util::thread::Mutex mutex_;
+};
+
+/// @brief Pointer to a @c HostCache.
+typedef boost::shared_ptr<HostCache> HostCachePtr;
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
+
+#endif // HOST_CACHE_H
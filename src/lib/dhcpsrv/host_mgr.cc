@@ -10,6 +10,7 @@
 #include <dhcpsrv/host_mgr.h>
 #include <dhcpsrv/hosts_log.h>
 #include <dhcpsrv/host_data_source_factory.h>
+#include <dhcpsrv/database_connection.h>
 
 namespace {
 
@@ -23,6 +24,15 @@ isc::dhcp::ConstCfgHostsPtr getCfgHosts() {
     return (isc::dhcp::CfgMgr::instance().getCurrentCfg()->getCfgHosts());
 }
 
+/// @brief Returns the first host of a collection.
+///
+/// @param hosts collection of hosts
+/// @return the first host or null if the collection is empty
+isc::dhcp::ConstHostPtr
+firstHost(const isc::dhcp::ConstHostCollection& hosts) {
+    return (hosts.empty() ? isc::dhcp::ConstHostPtr() : hosts.front());
+}
+
 } // end of anonymous namespace
 
 namespace isc {
@@ -55,6 +65,27 @@ HostMgr::create(const std::string& access) {
     // NULL value indicates that there's no host data source configured.
     getHostMgrPtr()->alternate_source_ =
         HostDataSourceFactory::getHostDataSourcePtr();
+
+    // Create the cache of the lookups in the alternate source if enabled.
+    if (getHostMgrPtr()->alternate_source_) {
+        DatabaseConnection::ParameterMap parameters =
+            DatabaseConnection::parse(access);
+        const uint32_t cache_size =
+            DatabaseConnection::getUint32Parameter(parameters, "cache-size", 0);
+        if (cache_size > 0) {
+            HostCachePtr cache(new HostCache(cache_size,
+                DatabaseConnection::getUint32Parameter(parameters,
+                                                       "cache-ttl", 60),
+                DatabaseConnection::getUint32Parameter(parameters,
+                                                       "cache-negative-ttl",
+                                                       10)));
+            LOG_INFO(hosts_logger, HOSTS_MGR_CACHE_ENABLED)
+                .arg(cache->getMaxSize())
+                .arg(cache->getTTL())
+                .arg(cache->getNegativeTTL());
+            getHostMgrPtr()->cache_ = cache;
+        }
+    }
 }
 
 HostMgr&
@@ -70,7 +101,17 @@ ConstHostCollection
 HostMgr::getAll(const HWAddrPtr& hwaddr, const DuidPtr& duid) const {
     ConstHostCollection hosts = getCfgHosts()->getAll(hwaddr, duid);
     if (alternate_source_) {
-        ConstHostCollection hosts_plus = alternate_source_->getAll(hwaddr, duid);
+        HostCache::Key key("getAll-hwaddr-duid");
+        ConstHostCollection hosts_plus;
+        if (cache_) {
+            key.add(hwaddr ? hwaddr->htype_ : 0)
+                .add(hwaddr ? hwaddr->hwaddr_ : std::vector<uint8_t>())
+                .add(duid ? duid->getDuid() : std::vector<uint8_t>());
+        }
+        if (!getCached(key, hosts_plus)) {
+            hosts_plus = alternate_source_->getAll(hwaddr, duid);
+            cacheResult(key, hosts_plus);
+        }
         hosts.insert(hosts.end(), hosts_plus.begin(), hosts_plus.end());
     }
     return (hosts);
@@ -84,9 +125,17 @@ HostMgr::getAll(const Host::IdentifierType& identifier_type,
                                                       identifier_begin,
                                                       identifier_len);
     if (alternate_source_) {
-        ConstHostCollection hosts_plus =
-            alternate_source_->getAll(identifier_type, identifier_begin,
-                                      identifier_len);
+        HostCache::Key key("getAll-identifier");
+        ConstHostCollection hosts_plus;
+        if (cache_) {
+            key.add(identifier_type, identifier_begin, identifier_len);
+        }
+        if (!getCached(key, hosts_plus)) {
+            hosts_plus = alternate_source_->getAll(identifier_type,
+                                                   identifier_begin,
+                                                   identifier_len);
+            cacheResult(key, hosts_plus);
+        }
         hosts.insert(hosts.end(), hosts_plus.begin(), hosts_plus.end());
     }
     return (hosts);
@@ -97,7 +146,15 @@ ConstHostCollection
 HostMgr::getAll4(const IOAddress& address) const {
     ConstHostCollection hosts = getCfgHosts()->getAll4(address);
     if (alternate_source_) {
-        ConstHostCollection hosts_plus = alternate_source_->getAll4(address);
+        HostCache::Key key("getAll4-address");
+        ConstHostCollection hosts_plus;
+        if (cache_) {
+            key.add(address.toBytes());
+        }
+        if (!getCached(key, hosts_plus)) {
+            hosts_plus = alternate_source_->getAll4(address);
+            cacheResult(key, hosts_plus);
+        }
         hosts.insert(hosts.end(), hosts_plus.begin(), hosts_plus.end());
     }
     return (hosts);
@@ -113,12 +170,23 @@ HostMgr::get4(const SubnetID& subnet_id, const HWAddrPtr& hwaddr,
             .arg(subnet_id)
             .arg(hwaddr ? hwaddr->toText() : "(no-hwaddr)")
             .arg(duid ? duid->toText() : "(duid)");
+        HostCache::Key key("get4-hwaddr-duid");
+        if (cache_) {
+            key.add(subnet_id)
+                .add(hwaddr ? hwaddr->htype_ : 0)
+                .add(hwaddr ? hwaddr->hwaddr_ : std::vector<uint8_t>())
+                .add(duid ? duid->getDuid() : std::vector<uint8_t>());
+            if (getCached(key, host)) {
+                return (host);
+            }
+        }
         if (duid) {
             host = alternate_source_->get4(subnet_id, HWAddrPtr(), duid);
         }
         if (!host && hwaddr) {
             host = alternate_source_->get4(subnet_id, hwaddr, DuidPtr());
         }
+        cacheResult(key, host);
     }
     return (host);
 }
@@ -138,8 +206,16 @@ HostMgr::get4(const SubnetID& subnet_id,
             .arg(Host::getIdentifierAsText(identifier_type, identifier_begin,
                                            identifier_len));
 
-        host = alternate_source_->get4(subnet_id, identifier_type,
-                                       identifier_begin, identifier_len);
+        HostCache::Key key("get4-identifier");
+        if (cache_) {
+            key.add(subnet_id)
+                .add(identifier_type, identifier_begin, identifier_len);
+        }
+        if (!getCached(key, host)) {
+            host = alternate_source_->get4(subnet_id, identifier_type,
+                                           identifier_begin, identifier_len);
+            cacheResult(key, host);
+        }
 
         if (host) {
             LOG_DEBUG(hosts_logger, HOSTS_DBG_RESULTS,
@@ -170,7 +246,14 @@ HostMgr::get4(const SubnetID& subnet_id,
                   HOSTS_MGR_ALTERNATE_GET4_SUBNET_ID_ADDRESS4)
             .arg(subnet_id)
             .arg(address.toText());
-        host = alternate_source_->get4(subnet_id, address);
+        HostCache::Key key("get4-address");
+        if (cache_) {
+            key.add(subnet_id).add(address.toBytes());
+        }
+        if (!getCached(key, host)) {
+            host = alternate_source_->get4(subnet_id, address);
+            cacheResult(key, host);
+        }
     }
     return (host);
 }
@@ -186,12 +269,23 @@ HostMgr::get6(const SubnetID& subnet_id, const DuidPtr& duid,
             .arg(subnet_id)
             .arg(duid ? duid->toText() : "(duid)")
             .arg(hwaddr ? hwaddr->toText() : "(no-hwaddr)");
+        HostCache::Key key("get6-duid-hwaddr");
+        if (cache_) {
+            key.add(subnet_id)
+                .add(duid ? duid->getDuid() : std::vector<uint8_t>())
+                .add(hwaddr ? hwaddr->htype_ : 0)
+                .add(hwaddr ? hwaddr->hwaddr_ : std::vector<uint8_t>());
+            if (getCached(key, host)) {
+                return (host);
+            }
+        }
         if (duid) {
             host = alternate_source_->get6(subnet_id, duid, HWAddrPtr());
         }
         if (!host && hwaddr) {
             host = alternate_source_->get6(subnet_id, DuidPtr(), hwaddr);
         }
+        cacheResult(key, host);
     }
     return (host);
 }
@@ -204,7 +298,14 @@ HostMgr::get6(const IOAddress& prefix, const uint8_t prefix_len) const {
                   HOSTS_MGR_ALTERNATE_GET6_PREFIX)
             .arg(prefix.toText())
             .arg(static_cast<int>(prefix_len));
-        host = alternate_source_->get6(prefix, prefix_len);
+        HostCache::Key key("get6-prefix");
+        if (cache_) {
+            key.add(prefix.toBytes()).add(prefix_len);
+        }
+        if (!getCached(key, host)) {
+            host = alternate_source_->get6(prefix, prefix_len);
+            cacheResult(key, host);
+        }
     }
     return (host);
 }
@@ -225,8 +326,16 @@ HostMgr::get6(const SubnetID& subnet_id,
                                            identifier_len));
 
 
-        host = alternate_source_->get6(subnet_id, identifier_type,
-                                       identifier_begin, identifier_len);
+        HostCache::Key key("get6-identifier");
+        if (cache_) {
+            key.add(subnet_id)
+                .add(identifier_type, identifier_begin, identifier_len);
+        }
+        if (!getCached(key, host)) {
+            host = alternate_source_->get6(subnet_id, identifier_type,
+                                           identifier_begin, identifier_len);
+            cacheResult(key, host);
+        }
 
         if (host) {
             LOG_DEBUG(hosts_logger, HOSTS_DBG_RESULTS,
@@ -257,7 +366,14 @@ HostMgr::get6(const SubnetID& subnet_id,
                   HOSTS_MGR_ALTERNATE_GET6_SUBNET_ID_ADDRESS6)
             .arg(subnet_id)
             .arg(addr.toText());
-        host = alternate_source_->get6(subnet_id, addr);
+        HostCache::Key key("get6-address");
+        if (cache_) {
+            key.add(subnet_id).add(addr.toBytes());
+        }
+        if (!getCached(key, host)) {
+            host = alternate_source_->get6(subnet_id, addr);
+            cacheResult(key, host);
+        }
     }
     return (host);
 }
@@ -269,6 +385,7 @@ HostMgr::add(const HostPtr& host) {
                   "no hosts-database configured.");
     }
     alternate_source_->add(host);
+    invalidateCache();
 }
 
 bool
@@ -278,7 +395,9 @@ HostMgr::del(const SubnetID& subnet_id, const asiolink::IOAddress& addr) {
                   "no hosts-database configured.");
     }
 
-    return (alternate_source_->del(subnet_id, addr));
+    const bool deleted = alternate_source_->del(subnet_id, addr);
+    invalidateCache();
+    return (deleted);
 }
 
 bool
@@ -289,8 +408,11 @@ HostMgr::del4(const SubnetID& subnet_id, const Host::IdentifierType& identifier_
                   "no hosts-database configured.");
     }
 
-    return (alternate_source_->del4(subnet_id, identifier_type,
-                                    identifier_begin, identifier_len));
+    const bool deleted = alternate_source_->del4(subnet_id, identifier_type,
+                                                 identifier_begin,
+                                                 identifier_len);
+    invalidateCache();
+    return (deleted);
 }
 
 bool
@@ -301,8 +423,65 @@ HostMgr::del6(const SubnetID& subnet_id, const Host::IdentifierType& identifier_
                   "no alternate host data source present");
     }
 
-    return (alternate_source_->del6(subnet_id, identifier_type,
-                                    identifier_begin, identifier_len));
+    const bool deleted = alternate_source_->del6(subnet_id, identifier_type,
+                                                 identifier_begin,
+                                                 identifier_len);
+    invalidateCache();
+    return (deleted);
+}
+
+bool
+HostMgr::getCached(const HostCache::Key& key, ConstHostPtr& host) const {
+    ConstHostCollection hosts;
+    if (!getCached(key, hosts)) {
+        return (false);
+    }
+    host = firstHost(hosts);
+    return (true);
+}
+
+bool
+HostMgr::getCached(const HostCache::Key& key,
+                   ConstHostCollection& hosts) const {
+    return (cache_ && cache_->get(key, hosts));
+}
+
+void
+HostMgr::cacheResult(const HostCache::Key& key,
+                     const ConstHostPtr& host) const {
+    if (cache_) {
+        ConstHostCollection hosts;
+        if (host) {
+            hosts.push_back(host);
+        }
+        cache_->insert(key, hosts);
+    }
+}
+
+void
+HostMgr::cacheResult(const HostCache::Key& key,
+                     const ConstHostCollection& hosts) const {
+    if (cache_) {
+        cache_->insert(key, hosts);
+    }
+}
+
+size_t
+HostMgr::flushCache() {
+    if (!cache_) {
+        isc_throw(NoHostCache, "unable to flush the host cache because"
+                  " the host cache is not enabled");
+    }
+    const size_t count = cache_->flush();
+    LOG_INFO(hosts_logger, HOSTS_MGR_CACHE_FLUSHED).arg(count);
+    return (count);
+}
+
+void
+HostMgr::invalidateCache() {
+    if (cache_) {
+        cache_->flush();
+    }
 }
 
 } // end of isc::dhcp namespace
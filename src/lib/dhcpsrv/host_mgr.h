@@ -11,6 +11,7 @@
 #include <dhcp/hwaddr.h>
 #include <dhcpsrv/base_host_data_source.h>
 #include <dhcpsrv/host.h>
+#include <dhcpsrv/host_cache.h>
 #include <dhcpsrv/subnet_id.h>
 #include <boost/noncopyable.hpp>
 #include <boost/scoped_ptr.hpp>
@@ -52,6 +53,11 @@ namespace dhcp {
 /// reconfiguration. However, the use of the primary host data source (i.e.
 /// reservations specified in the configuration file) can't be disabled.
 ///
+/// The results of the lookups in the alternate host data source may be
+/// cached in a @c HostCache, enabled by the "cache-size" parameter of the
+/// host data source access string. The cache is flushed when a host is
+/// added or deleted through the @c HostMgr.
+///
 /// @todo Implement alternate host data sources: MySQL, PostgreSQL, etc.
 class HostMgr : public boost::noncopyable, public BaseHostDataSource {
 public:
@@ -68,6 +74,13 @@ public:
     /// However, the "type" parameter will be common and it will specify which
     /// data source is to be used. Currently, no parameters are supported
     /// and the parameter is ignored.
+    /// The following parameters configure the cache of the lookups in the
+    /// alternate host data source and are not interpreted by the data source:
+    /// - cache-size: maximum number of cached lookups, 0 (the default)
+    ///   disables the cache,
+    /// - cache-ttl: time to live of the cached hosts in seconds (default 60),
+    /// - cache-negative-ttl: time to live of the lookups which returned no
+    ///   host in seconds (default 10).
     static void create(const std::string& access = "");
 
     /// @brief Returns a sole instance of the @c HostMgr.
@@ -283,8 +296,35 @@ public:
     /// @param source new source to be set (may be NULL)
     void setTestHostDataSource(const HostDataSourcePtr& source) {
         alternate_source_ = source;
+        if (cache_) {
+            cache_->flush();
+        }
+    }
+
+    /// @brief Returns the cache of the alternate host data source lookups.
+    ///
+    /// @return pointer to the cache or null if the cache is disabled
+    HostCachePtr getHostCache() const {
+        return (cache_);
+    }
+
+    /// @brief Sets the cache of the alternate host data source lookups.
+    ///
+    /// @param cache new cache, null to disable the cache
+    void setHostCache(const HostCachePtr& cache) {
+        cache_ = cache;
     }
 
+    /// @brief Removes all entries of the cache of the alternate host data
+    /// source lookups.
+    ///
+    /// This method is called to make the changes made in the database
+    /// by other means visible before the cached entries expire.
+    ///
+    /// @return number of removed entries
+    /// @throw NoHostCache if the cache is disabled
+    size_t flushCache();
+
     /// @brief Attempts to delete a host by address.
     ///
     /// This method supports both v4 and v6.
@@ -327,11 +367,50 @@ private:
     /// @brief Private default constructor.
     HostMgr() { }
 
+    /// @brief Returns the hosts cached for a lookup returning one host.
+    ///
+    /// @param key key of the lookup
+    /// @param [out] host cached host, possibly null
+    /// @return true if the lookup was cached
+    bool getCached(const HostCache::Key& key, ConstHostPtr& host) const;
+
+    /// @brief Returns the hosts cached for a lookup returning several hosts.
+    ///
+    /// @param key key of the lookup
+    /// @param [out] hosts cached hosts, possibly none
+    /// @return true if the lookup was cached
+    bool getCached(const HostCache::Key& key, ConstHostCollection& hosts) const;
+
+    /// @brief Caches the result of a lookup returning one host.
+    ///
+    /// Does nothing when the cache is disabled.
+    ///
+    /// @param key key of the lookup
+    /// @param host host returned by the lookup, possibly null
+    void cacheResult(const HostCache::Key& key, const ConstHostPtr& host) const;
+
+    /// @brief Caches the result of a lookup returning several hosts.
+    ///
+    /// Does nothing when the cache is disabled.
+    ///
+    /// @param key key of the lookup
+    /// @param hosts hosts returned by the lookup, possibly none
+    void cacheResult(const HostCache::Key& key,
+                     const ConstHostCollection& hosts) const;
+
+    /// @brief Flushes the cache after the hosts were modified.
+    void invalidateCache();
+
     /// @brief Pointer to an alternate host data source.
     ///
     /// If this pointer is NULL, the source is not in use.
     HostDataSourcePtr alternate_source_;
 
+    /// @brief Cache of the lookups in the alternate host data source.
+    ///
+    /// If this pointer is NULL, the lookups are not cached.
+    HostCachePtr cache_;
+
     /// @brief Returns a pointer to the currently used instance of the
     /// @c HostMgr.
     static boost::scoped_ptr<HostMgr>& getHostMgrPtr();
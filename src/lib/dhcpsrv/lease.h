@@ -410,6 +410,9 @@ struct Lease4 : public Lease {
 /// @brief Pointer to a Lease4 structure.
 typedef boost::shared_ptr<Lease4> Lease4Ptr;
 
+/// @brief Pointer to a const Lease4 structure.
+typedef boost::shared_ptr<const Lease4> ConstLease4Ptr;
+
 /// @brief A collection of IPv4 leases.
 typedef std::vector<Lease4Ptr> Lease4Collection;
 
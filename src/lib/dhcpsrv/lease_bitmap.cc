@@ -0,0 +1,218 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/lease_bitmap.h>
+#include <exceptions/exceptions.h>
+
+#include <algorithm>
+
+using namespace isc::util::thread;
+
+namespace {
+
+/// @brief Number of bits in a word.
+const uint64_t WORD_BITS = 64;
+
+/// @brief Word with all bits set.
+const uint64_t ALL_BITS = ~static_cast<uint64_t>(0);
+
+/// @brief Returns the position of the least significant bit set.
+///
+/// @param word Non-zero word.
+unsigned
+lowestBit(const uint64_t word) {
+#if defined(__GNUC__)
+    return (static_cast<unsigned>(__builtin_ctzll(word)));
+#else
+    unsigned bit = 0;
+    while ((word & (static_cast<uint64_t>(1) << bit)) == 0) {
+        ++bit;
+    }
+    return (bit);
+#endif
+}
+
+/// @brief Returns the number of words needed to hold the bits.
+///
+/// @param bits Number of bits.
+uint64_t
+wordsFor(const uint64_t bits) {
+    return ((bits + WORD_BITS - 1) / WORD_BITS);
+}
+
+/// @brief Sets the bits at and beyond the specified position.
+///
+/// @param words Words to be updated.
+/// @param bits Number of significant bits.
+void
+setPadding(std::vector<uint64_t>& words, const uint64_t bits) {
+    if ((bits % WORD_BITS) != 0) {
+        words.back() |= (ALL_BITS << (bits % WORD_BITS));
+    }
+}
+
+}
+
+namespace isc {
+namespace dhcp {
+
+const uint64_t LeaseBitmap::MAX_CAPACITY = static_cast<uint64_t>(1) << 24;
+
+LeaseBitmap::LeaseBitmap(const uint64_t capacity)
+    : capacity_(capacity), free_(capacity), words_(), full_words_(),
+      seeding_(false), seeded_(false), mutex_() {
+    if ((capacity_ == 0) || (capacity_ > MAX_CAPACITY)) {
+        isc_throw(BadValue, "invalid lease bitmap capacity " << capacity_
+                  << ", it must be in the range of 1 to " << MAX_CAPACITY);
+    }
+
+    words_.resize(wordsFor(capacity_), 0);
+    setPadding(words_, capacity_);
+
+    full_words_.resize(wordsFor(words_.size()), 0);
+    setPadding(full_words_, words_.size());
+}
+
+uint64_t
+LeaseBitmap::getFreeCount() const {
+    Mutex::Locker lock(mutex_);
+    return (free_);
+}
+
+bool
+LeaseBitmap::isUsed(const uint64_t index) const {
+    if (index >= capacity_) {
+        isc_throw(OutOfRange, "lease bitmap index " << index << " is out of range");
+    }
+    Mutex::Locker lock(mutex_);
+    return ((words_[index / WORD_BITS] &
+             (static_cast<uint64_t>(1) << (index % WORD_BITS))) != 0);
+}
+
+void
+LeaseBitmap::setUsed(const uint64_t index) {
+    if (index >= capacity_) {
+        isc_throw(OutOfRange, "lease bitmap index " << index << " is out of range");
+    }
+    Mutex::Locker lock(mutex_);
+    setBit(index, true);
+}
+
+void
+LeaseBitmap::setFree(const uint64_t index) {
+    if (index >= capacity_) {
+        isc_throw(OutOfRange, "lease bitmap index " << index << " is out of range");
+    }
+    Mutex::Locker lock(mutex_);
+    setBit(index, false);
+}
+
+void
+LeaseBitmap::setBit(const uint64_t index, const bool used) {
+    const uint64_t word = index / WORD_BITS;
+    const uint64_t bit = static_cast<uint64_t>(1) << (index % WORD_BITS);
+    const uint64_t full_bit = static_cast<uint64_t>(1) << (word % WORD_BITS);
+
+    if (used) {
+        if ((words_[word] & bit) == 0) {
+            words_[word] |= bit;
+            --free_;
+            if (words_[word] == ALL_BITS) {
+                full_words_[word / WORD_BITS] |= full_bit;
+            }
+        }
+
+    } else if ((words_[word] & bit) != 0) {
+        words_[word] &= ~bit;
+        ++free_;
+        full_words_[word / WORD_BITS] &= ~full_bit;
+    }
+}
+
+bool
+LeaseBitmap::findNonFullWord(const uint64_t start, uint64_t& word) const {
+    for (uint64_t summary = start / WORD_BITS; summary < full_words_.size();
+         ++summary) {
+        uint64_t not_full = ~full_words_[summary];
+        // Ignore the words before the start in the first summary word.
+        if (summary == start / WORD_BITS) {
+            not_full &= (ALL_BITS << (start % WORD_BITS));
+        }
+        if (not_full != 0) {
+            word = summary * WORD_BITS + lowestBit(not_full);
+            return (true);
+        }
+    }
+    return (false);
+}
+
+bool
+LeaseBitmap::findFree(const uint64_t start, uint64_t& index) const {
+    Mutex::Locker lock(mutex_);
+
+    if (free_ == 0) {
+        return (false);
+    }
+
+    const uint64_t first = (start < capacity_ ? start : start % capacity_);
+
+    // Check the bits following the start position in the first word.
+    uint64_t word = first / WORD_BITS;
+    const uint64_t free_bits = ~words_[word] & (ALL_BITS << (first % WORD_BITS));
+    if (free_bits != 0) {
+        index = word * WORD_BITS + lowestBit(free_bits);
+        return (true);
+    }
+
+    // Use the summary to find the next word with a free bit, wrapping
+    // around to the beginning of the pool if necessary. The free bit
+    // must exist because the free counter is not zero.
+    if (!findNonFullWord(word + 1, word) && !findNonFullWord(0, word)) {
+        isc_throw(Unexpected, "lease bitmap has no free bits while the"
+                  " free counter is " << free_);
+    }
+    index = word * WORD_BITS + lowestBit(~words_[word]);
+    return (true);
+}
+
+bool
+LeaseBitmap::beginSeeding() {
+    Mutex::Locker lock(mutex_);
+    if (seeding_) {
+        return (false);
+    }
+    seeding_ = true;
+    return (true);
+}
+
+void
+LeaseBitmap::endSeeding() {
+    Mutex::Locker lock(mutex_);
+    seeded_ = true;
+}
+
+void
+LeaseBitmap::abortSeeding() {
+    Mutex::Locker lock(mutex_);
+    free_ = capacity_;
+    std::fill(words_.begin(), words_.end(), 0);
+    setPadding(words_, capacity_);
+    std::fill(full_words_.begin(), full_words_.end(), 0);
+    setPadding(full_words_, words_.size());
+    seeding_ = false;
+    seeded_ = false;
+}
+
+bool
+LeaseBitmap::isSeeded() const {
+    Mutex::Locker lock(mutex_);
+    return (seeded_);
+}
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
@@ -0,0 +1,168 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef LEASE_BITMAP_H
+#define LEASE_BITMAP_H
+
+#include <util/threads/sync.h>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <vector>
+#include <stdint.h>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Bitmap of used addresses or prefixes in a pool.
+///
+/// The allocation engine uses this bitmap to find a free address or
+/// prefix in a pool without querying the lease database for each
+/// candidate. Each address or prefix in a pool is represented by a
+/// single bit, identified by its position (index) within the pool.
+/// The bit is set when there is an active lease for the address and
+/// it is cleared when the lease is released or reclaimed.
+///
+/// The bitmap is a hint rather than an authoritative source of
+/// information. The engine always confirms that the address selected
+/// with the help of the bitmap is really free by checking the lease
+/// database before allocating a lease for it. Hence, the bitmap may
+/// temporarily get out of sync with the database, e.g. when a lease is
+/// deleted with a control command, without causing allocation errors.
+///
+/// In addition to the bit per address, the bitmap maintains a summary
+/// with a bit per 64 bit word, which is set when the word is full.
+/// This allows for finding the free address by inspecting a small
+/// number of words, even when the pool is highly utilized.
+///
+/// The bitmap is populated with the existing leases (seeded) when it
+/// is used for the first time. The @c beginSeeding and @c endSeeding
+/// methods are used to make sure that only one thread seeds the bitmap
+/// and that the bitmap is not used until it has been seeded.
+///
+/// This class is thread safe.
+class LeaseBitmap : public boost::noncopyable {
+public:
+
+    /// @brief Maximum number of addresses or prefixes in the bitmap.
+    ///
+    /// The bitmap of this size takes 2MB of memory. The allocation engine
+    /// doesn't use bitmaps for larger pools.
+    static const uint64_t MAX_CAPACITY;
+
+    /// @brief Constructor.
+    ///
+    /// All addresses are initially marked as free.
+    ///
+    /// @param capacity Number of addresses or prefixes in the pool.
+    /// @throw BadValue if the capacity is 0 or greater than
+    /// @c MAX_CAPACITY.
+    explicit LeaseBitmap(const uint64_t capacity);
+
+    /// @brief Returns the number of addresses or prefixes in the bitmap.
+    uint64_t getCapacity() const {
+        return (capacity_);
+    }
+
+    /// @brief Returns the number of addresses or prefixes marked as free.
+    uint64_t getFreeCount() const;
+
+    /// @brief Checks if the address or prefix is marked as used.
+    ///
+    /// @param index Position of the address or prefix in the pool.
+    /// @throw OutOfRange if the index is out of range.
+    bool isUsed(const uint64_t index) const;
+
+    /// @brief Marks the address or prefix as used.
+    ///
+    /// @param index Position of the address or prefix in the pool.
+    /// @throw OutOfRange if the index is out of range.
+    void setUsed(const uint64_t index);
+
+    /// @brief Marks the address or prefix as free.
+    ///
+    /// @param index Position of the address or prefix in the pool.
+    /// @throw OutOfRange if the index is out of range.
+    void setFree(const uint64_t index);
+
+    /// @brief Finds the first free address or prefix.
+    ///
+    /// The search starts at the specified position and wraps around at
+    /// the end of the pool.
+    ///
+    /// @param start Position at which the search starts. It is adjusted
+    /// to the size of the pool if it is out of range.
+    /// @param [out] index Position of the free address or prefix.
+    /// @return true if the free address or prefix has been found, false
+    /// if all addresses are marked as used.
+    bool findFree(const uint64_t start, uint64_t& index) const;
+
+    /// @brief Indicates that the caller is going to seed the bitmap.
+    ///
+    /// @return true if the caller should seed the bitmap, false if the
+    /// bitmap has already been seeded or is being seeded by someone else.
+    bool beginSeeding();
+
+    /// @brief Indicates that the bitmap has been seeded and can be used.
+    void endSeeding();
+
+    /// @brief Indicates that seeding the bitmap has failed.
+    ///
+    /// All addresses are marked as free and the next call to
+    /// @c beginSeeding allows the caller to seed the bitmap again.
+    void abortSeeding();
+
+    /// @brief Checks if the bitmap has been seeded.
+    bool isSeeded() const;
+
+private:
+
+    /// @brief Sets or clears the bit without locking the mutex.
+    ///
+    /// @param index Position of the address or prefix in the pool.
+    /// @param used Indicates if the bit should be set or cleared.
+    void setBit(const uint64_t index, const bool used);
+
+    /// @brief Finds the first word which is not full.
+    ///
+    /// @param start Index of the word at which the search starts.
+    /// @param [out] word Index of the word found.
+    /// @return true if the word has been found, false otherwise.
+    bool findNonFullWord(const uint64_t start, uint64_t& word) const;
+
+    /// @brief Number of addresses or prefixes in the bitmap.
+    uint64_t capacity_;
+
+    /// @brief Number of addresses or prefixes marked as free.
+    uint64_t free_;
+
+    /// @brief Bits representing addresses or prefixes.
+    ///
+    /// The bits beyond the capacity are set, i.e. they are never
+    /// returned as free.
+    std::vector<uint64_t> words_;
+
+    /// @brief Bits indicating which words are full.
+    ///
+    /// The bits beyond the number of words are set.
+    std::vector<uint64_t> full_words_;
+
+    /// @brief Indicates if someone has started seeding the bitmap.
+    bool seeding_;
+
+    /// @brief Indicates if the bitmap has been seeded.
+    bool seeded_;
+
+    /// @brief Protects the members above.
+    mutable isc::util::thread::Mutex mutex_;
+};
+
+/// @brief Pointer to the @c LeaseBitmap.
+typedef boost::shared_ptr<LeaseBitmap> LeaseBitmapPtr;
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
+
+#endif // LEASE_BITMAP_H
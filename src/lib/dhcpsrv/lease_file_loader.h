@@ -7,11 +7,21 @@
 #ifndef LEASE_FILE_LOADER_H
 #define LEASE_FILE_LOADER_H
 
+#include <asiolink/io_address.h>
 #include <dhcpsrv/dhcpsrv_log.h>
+#include <dhcpsrv/mapped_lease_file.h>
 #include <dhcpsrv/memfile_lease_storage.h>
+#include <util/threads/thread.h>
 #include <util/versioned_csv_file.h>
 
+#include <boost/bind.hpp>
 #include <boost/shared_ptr.hpp>
+#include <boost/unordered_map.hpp>
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace isc {
 namespace dhcp {
@@ -122,27 +132,7 @@ public:
                           DHCPSRV_MEMFILE_LEASE_LOAD)
                     .arg(lease->toText());
 
-                // Check if this lease exists.
-                typename StorageType::iterator lease_it =
-                    storage.find(lease->addr_);
-                // The lease doesn't exist yet. Insert the lease if
-                // it has a positive valid lifetime.
-                if (lease_it == storage.end()) {
-                    if (lease->valid_lft_ > 0) {
-                        storage.insert(lease);
-                    }
-                } else {
-                    // The lease exists. If the new entry has a valid
-                    // lifetime of 0 it is an indication to remove the
-                    // existing entry. Otherwise, we update the lease.
-                    if (lease->valid_lft_ == 0) {
-                        storage.erase(lease_it);
-
-                    } else {
-                        // Use replace to re-index leases on update.
-                        storage.replace(lease_it, lease);
-                    }
-                }
+                storeLease(storage, lease);
 
             } else {
                 // Being here means that we hit the end of file.
@@ -166,6 +156,138 @@ public:
         }
     }
 
+    /// @brief Load leases from the lease file using multiple threads.
+    ///
+    /// This method produces the same result as @c load, but it maps the
+    /// lease file into memory and splits its rows into chunks parsed by
+    /// separate threads. Each thread keeps only the last entry for each
+    /// address found in its chunk. When all threads are done, the entries
+    /// from the chunks are applied to the storage in the order of chunks,
+    /// so the entries further in the lease file override the previous
+    /// entries as in @c load.
+    ///
+    /// The file is split into at most as many chunks as threads, but the
+    /// chunk is never smaller than the specified minimum size. Hence, the
+    /// small files are parsed by the calling thread only.
+    ///
+    /// @param lease_file A reference to the @c CSVLeaseFile4 or
+    /// @c CSVLeaseFile6 object representing the lease file. The file
+    /// doesn't need to be open because the method re-opens the file.
+    /// @param storage A reference to the container to which leases
+    /// should be inserted.
+    /// @param max_errors Maximum number of corrupted leases in the
+    /// lease file.
+    /// @param close_file_on_exit A boolean flag which indicates if
+    /// the file should be closed after it has been successfully parsed.
+    /// @param threads Maximum number of threads parsing the file,
+    /// including the calling thread.
+    /// @param min_chunk_size Minimum number of bytes parsed by a thread.
+    /// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
+    /// @tparam LeaseFileType A @c CSVLeaseFile4 or @c CSVLeaseFile6.
+    /// @tparam StorageType A @c Lease4Storage or @c Lease6Storage.
+    ///
+    /// @throw isc::util::CSVFileError when the maximum number of errors
+    /// has been exceeded or the file can't be read.
+    template<typename LeaseObjectType, typename LeaseFileType,
+             typename StorageType>
+    static void loadParallel(LeaseFileType& lease_file, StorageType& storage,
+                             const uint32_t max_errors = 0xFFFFFFFF,
+                             const bool close_file_on_exit = true,
+                             const size_t threads = 1,
+                             const size_t min_chunk_size = 1048576) {
+        LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_LEASE_FILE_LOAD)
+            .arg(lease_file.getFilename());
+
+        // Open the file to create it if it doesn't exist and to validate
+        // its header. The rows are read from the memory.
+        lease_file.close();
+        lease_file.open();
+
+        typedef ChunkResult<LeaseObjectType> Result;
+        std::vector<Result> results;
+        try {
+            MappedLeaseFile mapped_file(lease_file.getFilename());
+            std::vector<MappedLeaseFile::Chunk> chunks =
+                mapped_file.split(threads, min_chunk_size);
+            results.resize(chunks.size());
+
+            // The calling thread parses the first chunk.
+            std::vector<boost::shared_ptr<util::thread::Thread> > workers;
+            for (size_t i = 1; i < chunks.size(); ++i) {
+                workers.push_back(boost::shared_ptr<util::thread::Thread>
+                    (new util::thread::Thread(boost::bind(&parseChunk<LeaseObjectType,
+                                                                      LeaseFileType>,
+                                                          boost::cref(lease_file),
+                                                          chunks[i],
+                                                          &results[i]))));
+            }
+            if (!chunks.empty()) {
+                parseChunk<LeaseObjectType>(lease_file, chunks[0], &results[0]);
+            }
+            for (size_t i = 0; i < workers.size(); ++i) {
+                workers[i]->wait();
+            }
+
+        } catch (const std::exception& ex) {
+            lease_file.close();
+            isc_throw(util::CSVFileError, "failed to read leases from the"
+                      " lease file " << lease_file.getFilename() << ": "
+                      << ex.what());
+        }
+
+        // Apply the leases in the order of chunks.
+        uint32_t reads = 0;
+        uint32_t read_leases = 0;
+        uint32_t errcnt = 0;
+        for (typename std::vector<Result>::const_iterator result = results.begin();
+             result != results.end(); ++result) {
+            for (std::vector<std::pair<uint32_t, std::string> >::const_iterator
+                     error = result->errors_.begin();
+                 error != result->errors_.end(); ++error) {
+                LOG_ERROR(dhcpsrv_logger, DHCPSRV_MEMFILE_LEASE_LOAD_ROW_ERROR)
+                    .arg(reads + error->first)
+                    .arg(error->second);
+                if (++errcnt > max_errors) {
+                    lease_file.close();
+                    isc_throw(util::CSVFileError, "exceeded maximum number of"
+                              " failures " << max_errors << " to read a lease"
+                              " from the lease file "
+                              << lease_file.getFilename());
+                }
+            }
+
+            for (typename std::vector<boost::shared_ptr<LeaseObjectType> >::const_iterator
+                     lease = result->leases_.begin();
+                 lease != result->leases_.end(); ++lease) {
+                LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL_DATA,
+                          DHCPSRV_MEMFILE_LEASE_LOAD)
+                    .arg((*lease)->toText());
+                storeLease(storage, *lease);
+            }
+
+            reads += result->rows_;
+            read_leases += result->read_leases_;
+        }
+
+        // The sequential load counts the final read hitting the end of
+        // file too.
+        lease_file.addReadStatistics(reads + 1, read_leases, errcnt);
+
+        if (lease_file.needsConversion()) {
+            LOG_WARN(dhcpsrv_logger,
+                     (lease_file.getInputSchemaState()
+                      == util::VersionedCSVFile::NEEDS_UPGRADE
+                      ?  DHCPSRV_MEMFILE_NEEDS_UPGRADING
+                      : DHCPSRV_MEMFILE_NEEDS_DOWNGRADING))
+                     .arg(lease_file.getFilename())
+                     .arg(lease_file.getSchemaVersion());
+        }
+
+        if (close_file_on_exit) {
+            lease_file.close();
+        }
+    }
+
     /// @brief Write leases from the storage into a lease file
     ///
     /// This method iterates over the @c Lease4 or @c Lease6 object in the
@@ -175,9 +297,10 @@ public:
     /// This method writes all entries in the storage to the file, it does
     /// not perform any checks for expiration or duplication.
     ///
-    /// The order in which the entries will be written to the file depends
-    /// on the first index in the multi-index container.  Currently that
-    /// is the v4 or v6 IP address and they are written from lowest to highest.
+    /// The entries are written to the file in the order of the v4 or v6
+    /// IP addresses, from lowest to highest. The first index in the
+    /// multi-index container is hashed, so the leases are sorted before
+    /// they are written.
     ///
     /// Before writing the method will close the file if it is open
     /// and reopen it for writing.  After completion it will close
@@ -200,10 +323,15 @@ public:
         lease_file.close();
         lease_file.open();
 
-        // Iterate over the storage area writing out the leases
-        for (typename StorageType::const_iterator lease = storage.begin();
-             lease != storage.end();
-             ++lease) {
+        // Sort the leases by address. The order of the leases in the
+        // hashed index is not defined.
+        std::vector<boost::shared_ptr<LeaseObjectType> > leases(storage.begin(),
+                                                                storage.end());
+        std::sort(leases.begin(), leases.end(), lessByAddress<LeaseObjectType>);
+
+        // Iterate over the sorted leases writing them out
+        for (typename std::vector<boost::shared_ptr<LeaseObjectType> >::const_iterator
+                 lease = leases.begin(); lease != leases.end(); ++lease) {
             try {
                 lease_file.append(**lease);
             } catch (const isc::Exception&) {
@@ -216,6 +344,133 @@ public:
         // Close the file
         lease_file.close();
     }
+
+private:
+
+    /// @brief Result of parsing a chunk of the lease file.
+    ///
+    /// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
+    template<typename LeaseObjectType>
+    struct ChunkResult {
+
+        /// @brief Constructor.
+        ChunkResult()
+            : leases_(), errors_(), rows_(0), read_leases_(0) {
+        }
+
+        /// @brief Last entry for each address found in the chunk.
+        std::vector<boost::shared_ptr<LeaseObjectType> > leases_;
+
+        /// @brief Numbers of the rows within the chunk which couldn't be
+        /// parsed with the error messages.
+        std::vector<std::pair<uint32_t, std::string> > errors_;
+
+        /// @brief Number of rows in the chunk.
+        uint32_t rows_;
+
+        /// @brief Number of leases parsed.
+        uint32_t read_leases_;
+    };
+
+    /// @brief Parses the rows of the lease file chunk.
+    ///
+    /// This method is called by multiple threads for different chunks.
+    /// It only calls the methods of the lease file which don't modify
+    /// its state.
+    ///
+    /// @param lease_file Open lease file.
+    /// @param chunk Chunk of the rows to be parsed.
+    /// @param [out] result Result of parsing.
+    /// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
+    /// @tparam LeaseFileType A @c CSVLeaseFile4 or @c CSVLeaseFile6.
+    template<typename LeaseObjectType, typename LeaseFileType>
+    static void parseChunk(const LeaseFileType& lease_file,
+                           const MappedLeaseFile::Chunk chunk,
+                           ChunkResult<LeaseObjectType>* result) {
+        typedef boost::unordered_map<asiolink::IOAddress, size_t> PositionMap;
+        // Positions of the leases in the result by address.
+        PositionMap positions;
+        // The row is reused for all lines to avoid allocations.
+        util::CSVRow row;
+        std::string reason;
+        for (const char* line = chunk.begin_; line != chunk.end_; ) {
+            const char* line_end = std::find(line, chunk.end_, '\n');
+            ++result->rows_;
+            row.parse(line, line_end);
+            line = (line_end == chunk.end_ ? line_end : line_end + 1);
+
+            // As in the CSVLeaseFile4::next and CSVLeaseFile6::next, the
+            // row failing the column count validation is still parsed.
+            // Parsing fails when the row lacks any of the values.
+            static_cast<void>(lease_file.adaptRow(row, reason));
+            boost::shared_ptr<LeaseObjectType> lease;
+            try {
+                lease = lease_file.parse(row);
+            } catch (const std::exception& ex) {
+                result->errors_.push_back(std::make_pair(result->rows_,
+                                                         std::string(ex.what())));
+                continue;
+            }
+            ++result->read_leases_;
+
+            std::pair<typename PositionMap::iterator, bool> position =
+                positions.insert(std::make_pair(lease->addr_,
+                                                result->leases_.size()));
+            if (position.second) {
+                result->leases_.push_back(lease);
+            } else {
+                result->leases_[position.first->second] = lease;
+            }
+        }
+    }
+
+    /// @brief Inserts, updates or removes the lease read from the file.
+    ///
+    /// The lease is inserted if it doesn't exist in the storage and its
+    /// valid lifetime is positive. The existing lease is removed if the
+    /// new entry has a valid lifetime of 0 and it is updated otherwise.
+    ///
+    /// @param storage A reference to the container holding leases.
+    /// @param lease Lease read from the file.
+    /// @tparam StorageType A @c Lease4Storage or @c Lease6Storage.
+    /// @tparam LeasePtrType A pointer to @c Lease4 or @c Lease6.
+    template<typename StorageType, typename LeasePtrType>
+    static void storeLease(StorageType& storage, const LeasePtrType& lease) {
+        // Check if this lease exists.
+        typename StorageType::iterator lease_it = storage.find(lease->addr_);
+        // The lease doesn't exist yet. Insert the lease if
+        // it has a positive valid lifetime.
+        if (lease_it == storage.end()) {
+            if (lease->valid_lft_ > 0) {
+                storage.insert(lease);
+            }
+        } else {
+            // The lease exists. If the new entry has a valid
+            // lifetime of 0 it is an indication to remove the
+            // existing entry. Otherwise, we update the lease.
+            if (lease->valid_lft_ == 0) {
+                storage.erase(lease_it);
+
+            } else {
+                // Use replace to re-index leases on update.
+                storage.replace(lease_it, lease);
+            }
+        }
+    }
+
+    /// @brief Compares the leases by address.
+    ///
+    /// @param first First lease.
+    /// @param second Second lease.
+    /// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
+    ///
+    /// @return true if the address of the first lease is lower than the
+    /// address of the second lease.
+    template<typename LeaseObjectType>
+    static bool lessByAddress(const boost::shared_ptr<LeaseObjectType>& first,
+                              const boost::shared_ptr<LeaseObjectType>& second) {
+        return (first->addr_ < second->addr_);
+    }
 };
 
 }  // namespace dhcp
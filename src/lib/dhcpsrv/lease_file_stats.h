@@ -58,6 +58,19 @@ public:
         return (write_errs_);
     }
 
+    /// @brief Adds the statistics of the rows read outside of the lease
+    /// file object.
+    ///
+    /// @param reads Number of read attempts.
+    /// @param read_leases Number of leases read.
+    /// @param read_errs Number of errors when reading leases.
+    void addReadStatistics(const uint32_t reads, const uint32_t read_leases,
+                           const uint32_t read_errs) {
+        reads_ += reads;
+        read_leases_ += read_leases;
+        read_errs_ += read_errs;
+    }
+
     /// @brief Clears the statistics
     void clearStatistics() {
         reads_        = 0;
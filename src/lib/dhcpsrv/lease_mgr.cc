@@ -18,6 +18,7 @@
 #include <algorithm>
 #include <iostream>
 #include <iterator>
+#include <limits>
 #include <map>
 #include <sstream>
 #include <string>
@@ -30,6 +31,257 @@ using namespace std;
 namespace isc {
 namespace dhcp {
 
+namespace {
+
+/// @brief Lease stats query returning the rows of selected subnets.
+///
+/// It wraps a query returning the rows of all subnets and skips the
+/// rows of the subnets which have not been selected.
+class FilteredLeaseStatsQuery : public LeaseStatsQuery {
+public:
+    /// @brief Constructor.
+    ///
+    /// @param query Query returning the rows of all subnets.
+    /// @param subnet_ids Identifiers of the selected subnets.
+    FilteredLeaseStatsQuery(const LeaseStatsQueryPtr& query,
+                            const SubnetIDSet& subnet_ids)
+        : query_(query), subnet_ids_(subnet_ids) {
+    }
+
+    /// @brief Fetches the next row of the selected subnets.
+    ///
+    /// @param[out] row Storage into which the row is fetched
+    ///
+    /// @return True if a row was fetched, false if there are no
+    /// more rows.
+    virtual bool getNextRow(LeaseStatsRow& row) {
+        while (query_->getNextRow(row)) {
+            if (subnet_ids_.count(row.subnet_id_) > 0) {
+                return (true);
+            }
+        }
+        return (false);
+    }
+
+private:
+    /// @brief Query returning the rows of all subnets.
+    LeaseStatsQueryPtr query_;
+
+    /// @brief Identifiers of the selected subnets.
+    SubnetIDSet subnet_ids_;
+};
+
+/// @brief Removes declined addresses of a subnet from the global statistic.
+///
+/// @param subnet_id Identifier of the subnet.
+void
+subtractDeclinedAddresses(const SubnetID& subnet_id) {
+    using namespace stats;
+
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    ObservationPtr declined =
+        stats_mgr.getObservation(StatsMgr::generateName("subnet", subnet_id,
+                                                        "declined-addresses"));
+    if (declined && stats_mgr.getObservation("declined-addresses")) {
+        stats_mgr.addValue("declined-addresses",
+                           -declined->getInteger().first);
+    }
+}
+
+/// @brief Zeroes the IPv4 lease statistics of a subnet.
+///
+/// @param subnet_id Identifier of the subnet.
+void
+clearSubnetLeaseStats4(const SubnetID& subnet_id) {
+    using namespace stats;
+
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    int64_t zero = 0;
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                              "assigned-addresses"),
+                       zero);
+
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                              "declined-addresses"),
+                       zero);
+
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                              "reclaimed-declined-addresses"),
+                       zero);
+
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                              "reclaimed-leases"),
+                       zero);
+}
+
+/// @brief Sets the IPv4 lease statistics from the lease stats query rows.
+///
+/// @param query Query returning the lease counts.
+void
+applyLeaseStats4(LeaseStatsQuery& query) {
+    using namespace stats;
+
+    StatsMgr& stats_mgr = StatsMgr::instance();
+
+    // Get counts per state per subnet. Iterate over the result set
+    // updating the subnet and global values.
+    LeaseStatsRow row;
+    while (query.getNextRow(row)) {
+        if (row.lease_state_ == Lease::STATE_DEFAULT) {
+            // Set subnet level value.
+            stats_mgr.setValue(StatsMgr::generateName("subnet", row.subnet_id_,
+                                                      "assigned-addresses"),
+                               row.state_count_);
+        } else if (row.lease_state_ == Lease::STATE_DECLINED) {
+            // Set subnet level value.
+            stats_mgr.setValue(StatsMgr::generateName("subnet", row.subnet_id_,
+                                                      "declined-addresses"),
+                               row.state_count_);
+
+            // Add to the global value.
+            stats_mgr.addValue("declined-addresses", row.state_count_);
+        }
+    }
+}
+
+/// @brief Zeroes the IPv6 lease statistics of a subnet.
+///
+/// @param subnet_id Identifier of the subnet.
+void
+clearSubnetLeaseStats6(const SubnetID& subnet_id) {
+    using namespace stats;
+
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    int64_t zero = 0;
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                              "assigned-nas"),
+                       zero);
+
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                              "declined-addresses"),
+                       zero);
+
+    stats_mgr.setValue(StatsMgr::
+                       generateName("subnet", subnet_id,
+                                    "reclaimed-declined-addresses"),
+                       zero);
+
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                              "assigned-pds"),
+                       zero);
+
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                              "reclaimed-leases"),
+                       zero);
+}
+
+/// @brief Sets the IPv6 lease statistics from the lease stats query rows.
+///
+/// @param query Query returning the lease counts.
+void
+applyLeaseStats6(LeaseStatsQuery& query) {
+    using namespace stats;
+
+    StatsMgr& stats_mgr = StatsMgr::instance();
+
+    // Get counts per state per subnet. Iterate over the result set
+    // updating the subnet and global values.
+    LeaseStatsRow row;
+    while (query.getNextRow(row)) {
+        switch(row.lease_type_) {
+            case Lease::TYPE_NA:
+                if (row.lease_state_ == Lease::STATE_DEFAULT) {
+                    // Set subnet level value.
+                    stats_mgr.setValue(StatsMgr::
+                                       generateName("subnet", row.subnet_id_,
+                                                    "assigned-nas"),
+                                       row.state_count_);
+                } if (row.lease_state_ == Lease::STATE_DECLINED) {
+                    // Set subnet level value.
+                    stats_mgr.setValue(StatsMgr::
+                                       generateName("subnet", row.subnet_id_,
+                                                    "declined-addresses"),
+                                       row.state_count_);
+
+                    // Add to the global value.
+                    stats_mgr.addValue("declined-addresses", row.state_count_);
+                }
+                break;
+
+            case Lease::TYPE_PD:
+                if (row.lease_state_ == Lease::STATE_DEFAULT) {
+                    // Set subnet level value.
+                    stats_mgr.setValue(StatsMgr::
+                                       generateName("subnet", row.subnet_id_,
+                                                    "assigned-pds"),
+                                        row.state_count_);
+                }
+                break;
+
+            default:
+                // We dont' support TYPE_TAs yet
+                break;
+        }
+    }
+}
+
+/// @brief Compares the leases by address.
+struct LeaseAddressLess {
+    template<typename LeasePtrType>
+    bool operator()(const LeasePtrType& a, const LeasePtrType& b) const {
+        return (a->addr_ < b->addr_);
+    }
+};
+
+/// @brief Returns the page of leases following the lower bound address.
+///
+/// @param leases All leases, sorted by this function.
+/// @param lower_bound_address Address preceding the page.
+/// @param page_size Maximum number of leases returned.
+template<typename LeaseCollection>
+LeaseCollection
+selectLeasePage(LeaseCollection& leases,
+                const asiolink::IOAddress& lower_bound_address,
+                const LeasePageSize& page_size) {
+    std::sort(leases.begin(), leases.end(), LeaseAddressLess());
+
+    LeaseCollection page;
+    for (typename LeaseCollection::const_iterator lease = leases.begin();
+         (lease != leases.end()) && (page.size() < page_size.page_size_);
+         ++lease) {
+        if (lower_bound_address < (*lease)->addr_) {
+            page.push_back(*lease);
+        }
+    }
+    return (page);
+}
+
+} // end of anonymous namespace
+
+LeasePageSize::LeasePageSize(const size_t page_size)
+    : page_size_(page_size) {
+
+    if (page_size_ == 0) {
+        isc_throw(OutOfRange, "page size of retrieved leases must not be 0");
+    }
+
+    if (page_size_ > std::numeric_limits<uint32_t>::max()) {
+        isc_throw(OutOfRange, "page size of retrieved leases must not be greater than "
+                  << std::numeric_limits<uint32_t>::max());
+    }
+}
+
+ConstLease4Ptr
+LeaseMgr::getConstLease4(const isc::asiolink::IOAddress& addr) const {
+    return (getLease4(addr));
+}
+
+ConstLease6Ptr
+LeaseMgr::getConstLease6(Lease::Type type,
+                         const isc::asiolink::IOAddress& addr) const {
+    return (getLease6(type, addr));
+}
+
 Lease6Ptr
 LeaseMgr::getLease6(Lease::Type type, const DUID& duid,
                     uint32_t iaid, SubnetID subnet_id) const {
@@ -47,6 +299,185 @@ LeaseMgr::getLease6(Lease::Type type, const DUID& duid,
     return (*col.begin());
 }
 
+Lease4Collection
+LeaseMgr::getLeases4(SubnetID) const {
+    isc_throw(NotImplemented, "getLeases4(subnet_id) is not supported by the "
+              << getType() << " lease database backend");
+}
+
+Lease6Collection
+LeaseMgr::getLeases6(SubnetID) const {
+    isc_throw(NotImplemented, "getLeases6(subnet_id) is not supported by the "
+              << getType() << " lease database backend");
+}
+
+Lease4Collection
+LeaseMgr::getLeases4() const {
+    isc_throw(NotImplemented, "getLeases4() is not supported by the "
+              << getType() << " lease database backend");
+}
+
+Lease4Collection
+LeaseMgr::getLeases4(const asiolink::IOAddress& lower_bound_address,
+                     const LeasePageSize& page_size) const {
+    if (!lower_bound_address.isV4()) {
+        isc_throw(InvalidParameter, "expected IPv4 address while "
+                  "retrieving leases from the lease database, got "
+                  << lower_bound_address);
+    }
+
+    Lease4Collection leases = getLeases4();
+    return (selectLeasePage(leases, lower_bound_address, page_size));
+}
+
+Lease6Collection
+LeaseMgr::getLeases6() const {
+    isc_throw(NotImplemented, "getLeases6() is not supported by the "
+              << getType() << " lease database backend");
+}
+
+Lease6Collection
+LeaseMgr::getLeases6(const asiolink::IOAddress& lower_bound_address,
+                     const LeasePageSize& page_size) const {
+    if (!lower_bound_address.isV6()) {
+        isc_throw(InvalidParameter, "expected IPv6 address while "
+                  "retrieving leases from the lease database, got "
+                  << lower_bound_address);
+    }
+
+    Lease6Collection leases = getLeases6();
+    return (selectLeasePage(leases, lower_bound_address, page_size));
+}
+
+void
+LeaseMgr::asyncAddLease(const Lease4Ptr& lease,
+                        const AsyncLeaseCallback& callback) {
+    AsyncLeaseResult result;
+    try {
+        result.success_ = addLease(lease);
+    } catch (const std::exception& ex) {
+        result.error_ = ex.what();
+    }
+    callback(result);
+}
+
+void
+LeaseMgr::asyncAddLease(const Lease6Ptr& lease,
+                        const AsyncLeaseCallback& callback) {
+    AsyncLeaseResult result;
+    try {
+        result.success_ = addLease(lease);
+    } catch (const std::exception& ex) {
+        result.error_ = ex.what();
+    }
+    callback(result);
+}
+
+void
+LeaseMgr::asyncGetLease4(const isc::asiolink::IOAddress& addr,
+                         const AsyncLeaseCallback& callback) {
+    AsyncLeaseResult result;
+    try {
+        result.lease4_ = getLease4(addr);
+        result.success_ = true;
+    } catch (const std::exception& ex) {
+        result.error_ = ex.what();
+    }
+    callback(result);
+}
+
+void
+LeaseMgr::asyncGetLease6(Lease::Type type,
+                         const isc::asiolink::IOAddress& addr,
+                         const AsyncLeaseCallback& callback) {
+    AsyncLeaseResult result;
+    try {
+        result.lease6_ = getLease6(type, addr);
+        result.success_ = true;
+    } catch (const std::exception& ex) {
+        result.error_ = ex.what();
+    }
+    callback(result);
+}
+
+void
+LeaseMgr::asyncUpdateLease4(const Lease4Ptr& lease,
+                            const AsyncLeaseCallback& callback) {
+    AsyncLeaseResult result;
+    try {
+        updateLease4(lease);
+        result.success_ = true;
+    } catch (const std::exception& ex) {
+        result.error_ = ex.what();
+    }
+    callback(result);
+}
+
+void
+LeaseMgr::asyncUpdateLease6(const Lease6Ptr& lease,
+                            const AsyncLeaseCallback& callback) {
+    AsyncLeaseResult result;
+    try {
+        updateLease6(lease);
+        result.success_ = true;
+    } catch (const std::exception& ex) {
+        result.error_ = ex.what();
+    }
+    callback(result);
+}
+
+void
+LeaseMgr::asyncDeleteLease(const isc::asiolink::IOAddress& addr,
+                           const AsyncLeaseCallback& callback) {
+    AsyncLeaseResult result;
+    try {
+        result.success_ = deleteLease(addr);
+    } catch (const std::exception& ex) {
+        result.error_ = ex.what();
+    }
+    callback(result);
+}
+
+void
+LeaseMgr::reclaimLeases4(const Lease4Collection& updated,
+                         const Lease4Collection& removed) {
+    BOOST_FOREACH(const Lease4Ptr& lease, updated) {
+        updateLease4(lease);
+    }
+    BOOST_FOREACH(const Lease4Ptr& lease, removed) {
+        deleteLease(lease->addr_);
+    }
+}
+
+void
+LeaseMgr::reclaimLeases6(const Lease6Collection& updated,
+                         const Lease6Collection& removed) {
+    BOOST_FOREACH(const Lease6Ptr& lease, updated) {
+        updateLease6(lease);
+    }
+    BOOST_FOREACH(const Lease6Ptr& lease, removed) {
+        deleteLease(lease->addr_);
+    }
+}
+
+void
+LeaseMgr::applyLeases4(const Lease4Collection& leases) {
+    BOOST_FOREACH(const Lease4Ptr& lease, leases) {
+        if (!addLease(lease)) {
+            updateLease4(lease);
+        }
+    }
+}
+
+void
+LeaseMgr::applyLeases6(const Lease6Collection& leases) {
+    BOOST_FOREACH(const Lease6Ptr& lease, leases) {
+        if (!addLease(lease)) {
+            updateLease6(lease);
+        }
+    }
+}
+
 void
 LeaseMgr::recountLeaseStats4() {
     using namespace stats;
@@ -72,43 +503,30 @@ LeaseMgr::recountLeaseStats4() {
 
     for (Subnet4Collection::const_iterator subnet = subnets->begin();
          subnet != subnets->end(); ++subnet) {
-        SubnetID subnet_id = (*subnet)->getID();
-        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
-                                                  "assigned-addresses"),
-                           zero);
-
-        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
-                                                  "declined-addresses"),
-                           zero);
+        clearSubnetLeaseStats4((*subnet)->getID());
+    }
 
-        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
-                                                  "reclaimed-declined-addresses"),
-                           zero);
+    applyLeaseStats4(*query);
+}
 
-        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
-                                                  "reclaimed-leases"),
-                           zero);
+void
+LeaseMgr::recountLeaseStats4(const SubnetIDSet& subnet_ids) {
+    LeaseStatsQueryPtr query = startSubnetLeaseStatsQuery4(subnet_ids);
+    if (!query) {
+        /// NULL means not backend does not support recounting.
+        return;
     }
 
-    // Get counts per state per subnet. Iterate over the result set
-    // updating the subnet and global values.
-    LeaseStatsRow row;
-    while (query->getNextRow(row)) {
-        if (row.lease_state_ == Lease::STATE_DEFAULT) {
-            // Set subnet level value.
-            stats_mgr.setValue(StatsMgr::generateName("subnet", row.subnet_id_,
-                                                      "assigned-addresses"),
-                               row.state_count_);
-        } else if (row.lease_state_ == Lease::STATE_DECLINED) {
-            // Set subnet level value.
-            stats_mgr.setValue(StatsMgr::generateName("subnet", row.subnet_id_,
-                                                      "declined-addresses"),
-                               row.state_count_);
-
-            // Add to the global value.
-            stats_mgr.addValue("declined-addresses", row.state_count_);
-        }
+    // The declined addresses of these subnets are removed from the global
+    // value before the subnet stats are cleared. They are added back when
+    // the subnets are recounted.
+    for (SubnetIDSet::const_iterator subnet_id = subnet_ids.begin();
+         subnet_id != subnet_ids.end(); ++subnet_id) {
+        subtractDeclinedAddresses(*subnet_id);
+        clearSubnetLeaseStats4(*subnet_id);
     }
+
+    applyLeaseStats4(*query);
 }
 
 LeaseStatsQueryPtr
@@ -116,6 +534,16 @@ LeaseMgr::startLeaseStatsQuery4() {
     return(LeaseStatsQueryPtr());
 }
 
+LeaseStatsQueryPtr
+LeaseMgr::startSubnetLeaseStatsQuery4(const SubnetIDSet& subnet_ids) {
+    LeaseStatsQueryPtr query = startLeaseStatsQuery4();
+    if (!query) {
+        return (query);
+    }
+    return (LeaseStatsQueryPtr(new FilteredLeaseStatsQuery(query,
+                                                           subnet_ids)));
+}
+
 bool
 LeaseStatsQuery::getNextRow(LeaseStatsRow& /*row*/) {
     return (false);
@@ -149,68 +577,27 @@ LeaseMgr::recountLeaseStats6() {
 
     for (Subnet6Collection::const_iterator subnet = subnets->begin();
          subnet != subnets->end(); ++subnet) {
-        SubnetID subnet_id = (*subnet)->getID();
-        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
-                                                  "assigned-nas"),
-                           zero);
-
-        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
-                                                  "declined-addresses"),
-                           zero);
-
-        stats_mgr.setValue(StatsMgr::
-                           generateName("subnet", subnet_id,
-                                        "reclaimed-declined-addresses"),
-                           zero);
-
-        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
-                                                  "assigned-pds"),
-                           zero);
-
-        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
-                                                  "reclaimed-leases"),
-                           zero);
+        clearSubnetLeaseStats6((*subnet)->getID());
     }
 
-    // Get counts per state per subnet. Iterate over the result set
-    // updating the subnet and global values.
-    LeaseStatsRow row;
-    while (query->getNextRow(row)) {
-        switch(row.lease_type_) {
-            case Lease::TYPE_NA:
-                if (row.lease_state_ == Lease::STATE_DEFAULT) {
-                    // Set subnet level value.
-                    stats_mgr.setValue(StatsMgr::
-                                       generateName("subnet", row.subnet_id_,
-                                                    "assigned-nas"),
-                                       row.state_count_);
-                } if (row.lease_state_ == Lease::STATE_DECLINED) {
-                    // Set subnet level value.
-                    stats_mgr.setValue(StatsMgr::
-                                       generateName("subnet", row.subnet_id_,
-                                                    "declined-addresses"),
-                                       row.state_count_);
-
-                    // Add to the global value.
-                    stats_mgr.addValue("declined-addresses", row.state_count_);
-                }
-                break;
+    applyLeaseStats6(*query);
+}
 
-            case Lease::TYPE_PD:
-                if (row.lease_state_ == Lease::STATE_DEFAULT) {
-                    // Set subnet level value.
-                    stats_mgr.setValue(StatsMgr::
-                                       generateName("subnet", row.subnet_id_,
-                                                    "assigned-pds"),
-                                        row.state_count_);
-                }
-                break;
+void
+LeaseMgr::recountLeaseStats6(const SubnetIDSet& subnet_ids) {
+    LeaseStatsQueryPtr query = startSubnetLeaseStatsQuery6(subnet_ids);
+    if (!query) {
+        /// NULL means not backend does not support recounting.
+        return;
+    }
 
-            default:
-                // We dont' support TYPE_TAs yet
-                break;
-        }
+    for (SubnetIDSet::const_iterator subnet_id = subnet_ids.begin();
+         subnet_id != subnet_ids.end(); ++subnet_id) {
+        subtractDeclinedAddresses(*subnet_id);
+        clearSubnetLeaseStats6(*subnet_id);
     }
+
+    applyLeaseStats6(*query);
 }
 
 LeaseStatsQueryPtr
@@ -218,6 +605,16 @@ LeaseMgr::startLeaseStatsQuery6() {
     return(LeaseStatsQueryPtr());
 }
 
+LeaseStatsQueryPtr
+LeaseMgr::startSubnetLeaseStatsQuery6(const SubnetIDSet& subnet_ids) {
+    LeaseStatsQueryPtr query = startLeaseStatsQuery6();
+    if (!query) {
+        return (query);
+    }
+    return (LeaseStatsQueryPtr(new FilteredLeaseStatsQuery(query,
+                                                           subnet_ids)));
+}
+
 std::string
 LeaseMgr::getDBVersion() {
     isc_throw(NotImplemented, "LeaseMgr::getDBVersion() called");
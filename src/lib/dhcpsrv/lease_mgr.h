@@ -16,6 +16,7 @@
 #include <dhcpsrv/subnet.h>
 #include <dhcpsrv/db_exceptions.h>
 
+#include <boost/function.hpp>
 #include <boost/noncopyable.hpp>
 #include <boost/shared_ptr.hpp>
 
@@ -226,6 +227,54 @@ public:
 /// @brief Defines a pointer to an LeaseStatsQuery.
 typedef boost::shared_ptr<LeaseStatsQuery> LeaseStatsQueryPtr;
 
+/// @brief Result of an asynchronous lease operation.
+///
+/// @see LeaseMgr::asyncAddLease and the other asynchronous operations.
+struct AsyncLeaseResult {
+
+    /// @brief Constructor.
+    AsyncLeaseResult()
+        : success_(false), error_(), lease4_(), lease6_() {
+    }
+
+    /// @brief Indicates if the operation succeeded.
+    ///
+    /// It is false when a lease could not be added because it exists,
+    /// when a lease to be deleted doesn't exist, or when an error occurred.
+    /// A lookup which found no lease succeeds.
+    bool success_;
+
+    /// @brief Error message, empty when no error occurred.
+    std::string error_;
+
+    /// @brief IPv4 lease found by a lookup, possibly null.
+    Lease4Ptr lease4_;
+
+    /// @brief IPv6 lease found by a lookup, possibly null.
+    Lease6Ptr lease6_;
+};
+
+/// @brief Callback invoked when an asynchronous lease operation completes.
+typedef boost::function<void (const AsyncLeaseResult&)> AsyncLeaseCallback;
+
+/// @brief Wraps value holding size of the page with leases.
+///
+/// It is used by the methods returning the leases page by page, e.g.
+/// @ref LeaseMgr::getLeases4(const asiolink::IOAddress&, const LeasePageSize&).
+class LeasePageSize {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param page_size page size value.
+    /// @throw OutOfRange if page size is 0 or greater than uint32_t numeric
+    /// limit.
+    explicit LeasePageSize(const size_t page_size);
+
+    /// @brief Holds page size.
+    const size_t page_size_;
+};
+
 /// @brief Abstract Lease Manager
 ///
 /// This is an abstract API for lease database backends. It provides unified
@@ -281,6 +330,20 @@ public:
     /// @return smart pointer to the lease (or NULL if a lease is not found)
     virtual Lease4Ptr getLease4(const isc::asiolink::IOAddress& addr) const = 0;
 
+    /// @brief Returns an IPv4 lease for specified IPv4 address for reading
+    ///
+    /// The returned lease must not be modified by the caller. It allows
+    /// the backends holding leases in memory to return the stored lease
+    /// instance rather than its copy, which is useful when the caller
+    /// merely checks whether the address is in use. The default
+    /// implementation returns the lease returned by @c getLease4.
+    ///
+    /// @param addr address of the searched lease
+    ///
+    /// @return smart pointer to the lease (or NULL if a lease is not found)
+    virtual ConstLease4Ptr
+    getConstLease4(const isc::asiolink::IOAddress& addr) const;
+
     /// @brief Returns existing IPv4 leases for specified hardware address.
     ///
     /// Although in the usual case there will be only one lease, for mobile
@@ -344,6 +407,57 @@ public:
     virtual Lease4Ptr getLease4(const ClientId& clientid,
                                 SubnetID subnet_id) const = 0;
 
+    /// @brief Returns all IPv4 leases for the particular subnet identifier.
+    ///
+    /// The allocation engine uses this method to learn which addresses
+    /// in the subnet are in use. The default implementation throws, in
+    /// which case the engine checks the addresses one by one.
+    ///
+    /// @param subnet_id subnet identifier.
+    ///
+    /// @return Lease collection (may be empty if no IPv4 lease found).
+    /// @throw isc::NotImplemented if the backend doesn't support it.
+    virtual Lease4Collection getLeases4(SubnetID subnet_id) const;
+
+    /// @brief Returns all IPv4 leases.
+    ///
+    /// @return Lease collection (may be empty if no IPv4 lease found).
+    /// @throw isc::NotImplemented if the backend doesn't support it.
+    virtual Lease4Collection getLeases4() const;
+
+    /// @brief Returns range of IPv4 leases using paging.
+    ///
+    /// This method implements paged browsing of the lease database. The first
+    /// parameter specifies a page size. The second parameter is optional and
+    /// specifies the starting address of the range. This address is excluded
+    /// from the returned range. The IPv4 zero address (default) denotes that
+    /// the first page should be returned. There is no guarantee about the
+    /// order of returned leases.
+    ///
+    /// The typical usage of this method is as follows:
+    /// - Get the first page of leases by specifying IPv4 zero address as the
+    ///   beginning of the range.
+    /// - Last address of the returned range should be used as a starting
+    ///   address for the next page in the subsequent call.
+    /// - If the number of leases returned is lower than the page size, it
+    ///   indicates that the last page has been retrieved.
+    /// - If there are no leases returned it indicates that the previous page
+    ///   was the last page.
+    ///
+    /// The default implementation sorts the leases returned by
+    /// @ref getLeases4() by address and picks the requested range. The
+    /// backends override it to fetch only the requested range.
+    ///
+    /// @param lower_bound_address IPv4 address used as lower bound for the
+    /// returned range.
+    /// @param page_size maximum size of the page returned.
+    ///
+    /// @return Lease collection (may be empty if no IPv4 lease found).
+    /// @throw InvalidParameter if the lower bound is not an IPv4 address.
+    virtual Lease4Collection
+    getLeases4(const asiolink::IOAddress& lower_bound_address,
+               const LeasePageSize& page_size) const;
+
     /// @brief Returns existing IPv6 lease for a given IPv6 address.
     ///
     /// For a given address, we assume that there will be only one lease.
@@ -357,6 +471,20 @@ public:
     virtual Lease6Ptr getLease6(Lease::Type type,
                                 const isc::asiolink::IOAddress& addr) const = 0;
 
+    /// @brief Returns existing IPv6 lease for a given IPv6 address for reading
+    ///
+    /// The returned lease must not be modified by the caller. See
+    /// @c getConstLease4 for details. The default implementation returns
+    /// the lease returned by @c getLease6.
+    ///
+    /// @param type specifies lease type: (NA, TA or PD)
+    /// @param addr address of the searched lease
+    ///
+    /// @return smart pointer to the lease (or NULL if a lease is not found)
+    virtual ConstLease6Ptr
+    getConstLease6(Lease::Type type,
+                   const isc::asiolink::IOAddress& addr) const;
+
     /// @brief Returns existing IPv6 leases for a given DUID+IA combination
     ///
     /// Although in the usual case there will be only one lease, for mobile
@@ -386,6 +514,48 @@ public:
     virtual Lease6Collection getLeases6(Lease::Type type, const DUID& duid,
                                         uint32_t iaid, SubnetID subnet_id) const = 0;
 
+    /// @brief Returns all IPv6 leases for the particular subnet identifier.
+    ///
+    /// The allocation engine uses this method to learn which addresses
+    /// and prefixes in the subnet are in use. The default implementation
+    /// throws, in which case the engine checks them one by one.
+    ///
+    /// @param subnet_id subnet identifier.
+    ///
+    /// @return Lease collection (may be empty if no IPv6 lease found).
+    /// @throw isc::NotImplemented if the backend doesn't support it.
+    virtual Lease6Collection getLeases6(SubnetID subnet_id) const;
+
+    /// @brief Returns all IPv6 leases.
+    ///
+    /// @return Lease collection (may be empty if no IPv6 lease found).
+    /// @throw isc::NotImplemented if the backend doesn't support it.
+    virtual Lease6Collection getLeases6() const;
+
+    /// @brief Returns range of IPv6 leases using paging.
+    ///
+    /// This method implements paged browsing of the lease database. The first
+    /// parameter specifies a page size. The second parameter is optional and
+    /// specifies the starting address of the range. This address is excluded
+    /// from the returned range. The IPv6 zero address (default) denotes that
+    /// the first page should be returned.
+    ///
+    /// The order of the leases is specific to the backend, e.g. the SQL
+    /// backends hold IPv6 addresses as text and use the text order. The
+    /// last address of the returned page is the lower bound for the next
+    /// page. See @ref getLeases4(const asiolink::IOAddress&, const LeasePageSize&)
+    /// for the usage of this method.
+    ///
+    /// @param lower_bound_address IPv6 address used as lower bound for the
+    /// returned range.
+    /// @param page_size maximum size of the page returned.
+    ///
+    /// @return Lease collection (may be empty if no IPv6 lease found).
+    /// @throw InvalidParameter if the lower bound is not an IPv6 address.
+    virtual Lease6Collection
+    getLeases6(const asiolink::IOAddress& lower_bound_address,
+               const LeasePageSize& page_size) const;
+
     /// @brief returns zero or one IPv6 lease for a given duid+iaid+subnet_id
     ///
     /// This function is mostly intended to be used in unit-tests during the
@@ -459,6 +629,59 @@ public:
     /// @return true if deletion was successful, false if no such lease exists
     virtual bool deleteLease(const isc::asiolink::IOAddress& addr) = 0;
 
+    /// @brief Reclaims a batch of expired IPv4 leases.
+    ///
+    /// This method is used by the lease reclamation routine to apply the
+    /// state transitions of all leases reclaimed in a pass at once. The
+    /// leases in @c updated have already been moved to the
+    /// "expired-reclaimed" state by the caller and are written to the
+    /// database. The leases in @c removed are deleted from the database.
+    /// The default implementation calls @ref updateLease4 and
+    /// @ref deleteLease for each lease. The backends override it to apply
+    /// the batch in a single transaction or journal write.
+    ///
+    /// @param updated Leases to be updated.
+    /// @param removed Leases to be deleted.
+    ///
+    /// @throw NoSuchLease or DbOperationError if the batch can't be applied.
+    /// Part of the batch may have been applied in this case, so the caller
+    /// should reclaim the leases one by one.
+    virtual void reclaimLeases4(const Lease4Collection& updated,
+                                const Lease4Collection& removed);
+
+    /// @brief Reclaims a batch of expired IPv6 leases.
+    ///
+    /// @param updated Leases to be updated.
+    /// @param removed Leases to be deleted.
+    ///
+    /// @throw NoSuchLease or DbOperationError if the batch can't be applied.
+    /// @see reclaimLeases4.
+    virtual void reclaimLeases6(const Lease6Collection& updated,
+                                const Lease6Collection& removed);
+
+    /// @brief Adds or updates a batch of IPv4 leases.
+    ///
+    /// Each lease is added if there is no lease for its address, otherwise
+    /// the existing lease is replaced. This method is used to import many
+    /// leases at once. The default implementation calls @ref addLease and
+    /// @ref updateLease4 for each lease. The backends override it to apply
+    /// the batch in a single transaction or journal write.
+    ///
+    /// @param leases Leases to be applied.
+    ///
+    /// @throw DbOperationError if the batch can't be applied. Part of the
+    /// batch may have been applied in this case, unless the backend applies
+    /// it in a transaction.
+    virtual void applyLeases4(const Lease4Collection& leases);
+
+    /// @brief Adds or updates a batch of IPv6 leases.
+    ///
+    /// @param leases Leases to be applied.
+    ///
+    /// @throw DbOperationError if the batch can't be applied.
+    /// @see applyLeases4.
+    virtual void applyLeases6(const Lease6Collection& leases);
+
     /// @brief Deletes all expired and reclaimed DHCPv4 leases.
     ///
     /// @param secs Number of seconds since expiration of leases before
@@ -477,6 +700,86 @@ public:
     /// @return Number of leases deleted.
     virtual uint64_t deleteExpiredReclaimedLeases6(const uint32_t secs) = 0;
 
+    /// @brief Adds an IPv4 lease asynchronously.
+    ///
+    /// The asynchronous operations let the caller issue many operations
+    /// without waiting for the database to process each of them. A backend
+    /// able to issue the operations without waiting for their results
+    /// overrides them: the callback is then invoked by a thread of the
+    /// backend, in an order which depends on the backend. The default
+    /// implementations run the synchronous operation and invoke the
+    /// callback before returning.
+    ///
+    /// The operations are not part of the transactions controlled by
+    /// @ref commit and @ref rollback, and they are not ordered with
+    /// respect to the synchronous operations: use @ref asyncWait before
+    /// reading the leases updated asynchronously with a synchronous
+    /// operation.
+    ///
+    /// @param lease lease to be added
+    /// @param callback callback invoked with the result, which is not
+    /// successful if the lease exists
+    virtual void asyncAddLease(const Lease4Ptr& lease,
+                               const AsyncLeaseCallback& callback);
+
+    /// @brief Adds an IPv6 lease asynchronously.
+    ///
+    /// @param lease lease to be added
+    /// @param callback callback invoked with the result, which is not
+    /// successful if the lease exists
+    virtual void asyncAddLease(const Lease6Ptr& lease,
+                               const AsyncLeaseCallback& callback);
+
+    /// @brief Returns an IPv4 lease for specified IPv4 address asynchronously.
+    ///
+    /// @param addr address of the searched lease
+    /// @param callback callback invoked with the result holding the lease
+    /// or a null pointer
+    virtual void asyncGetLease4(const isc::asiolink::IOAddress& addr,
+                                const AsyncLeaseCallback& callback);
+
+    /// @brief Returns an IPv6 lease for a given address asynchronously.
+    ///
+    /// @param type specifies lease type: (NA, TA or PD)
+    /// @param addr address of the searched lease
+    /// @param callback callback invoked with the result holding the lease
+    /// or a null pointer
+    virtual void asyncGetLease6(Lease::Type type,
+                                const isc::asiolink::IOAddress& addr,
+                                const AsyncLeaseCallback& callback);
+
+    /// @brief Updates an IPv4 lease asynchronously.
+    ///
+    /// @param lease lease to be updated
+    /// @param callback callback invoked with the result, holding an error
+    /// if the lease doesn't exist
+    virtual void asyncUpdateLease4(const Lease4Ptr& lease,
+                                   const AsyncLeaseCallback& callback);
+
+    /// @brief Updates an IPv6 lease asynchronously.
+    ///
+    /// @param lease lease to be updated
+    /// @param callback callback invoked with the result, holding an error
+    /// if the lease doesn't exist
+    virtual void asyncUpdateLease6(const Lease6Ptr& lease,
+                                   const AsyncLeaseCallback& callback);
+
+    /// @brief Deletes a lease asynchronously.
+    ///
+    /// @param addr address of the lease to be deleted
+    /// @param callback callback invoked with the result, which is not
+    /// successful if the lease doesn't exist
+    virtual void asyncDeleteLease(const isc::asiolink::IOAddress& addr,
+                                  const AsyncLeaseCallback& callback);
+
+    /// @brief Waits for the completion of the asynchronous operations.
+    ///
+    /// Returns when the callbacks of all operations issued before the call
+    /// have returned. The default implementation does nothing as the
+    /// default operations complete before they return.
+    virtual void asyncWait() {
+    }
+
     /// @brief Recalculates per-subnet and global stats for IPv4 leases
     ///
     /// This method recalculates the following statistics:
@@ -508,6 +811,36 @@ public:
     /// @return A populated LeaseStatsQuery
     virtual LeaseStatsQueryPtr startLeaseStatsQuery4();
 
+    /// @brief Recalculates per-subnet stats for IPv4 leases in selected subnets
+    ///
+    /// This method is used when a new configuration is committed to recount
+    /// the statistics of the subnets which have been added or modified,
+    /// while the statistics of the other subnets are left untouched.
+    /// It recalculates the same per-subnet statistics as
+    /// @ref recountLeaseStats4 for the specified subnets only. The global
+    /// "declined-addresses" statistic is adjusted by the difference between
+    /// the old and the new number of declined addresses in these subnets.
+    /// Other global statistics are not modified.
+    ///
+    /// @param subnet_ids Identifiers of the subnets to be recounted.
+    void recountLeaseStats4(const SubnetIDSet& subnet_ids);
+
+    /// @brief Virtual method which creates and runs the IPv4 lease stats
+    /// query for selected subnets
+    ///
+    /// The returned query contains the rows of the specified subnets only.
+    /// The default implementation filters the result set returned by
+    /// @ref startLeaseStatsQuery4. The derivations should override it
+    /// if they are able to examine the leases of the selected subnets
+    /// without examining the entire lease database.
+    ///
+    /// @param subnet_ids Identifiers of the subnets to be examined.
+    ///
+    /// @return A populated LeaseStatsQuery or null if the backend does not
+    /// support recounting.
+    virtual LeaseStatsQueryPtr
+    startSubnetLeaseStatsQuery4(const SubnetIDSet& subnet_ids);
+
     /// @brief Recalculates per-subnet and global stats for IPv6 leases
     ///
     /// This method recalculates the following statistics:
@@ -539,6 +872,28 @@ public:
     /// @return A populated LeaseStatsQuery
     virtual LeaseStatsQueryPtr startLeaseStatsQuery6();
 
+    /// @brief Recalculates per-subnet stats for IPv6 leases in selected subnets
+    ///
+    /// This is the IPv6 counterpart of @ref recountLeaseStats4(const SubnetIDSet&).
+    /// It recalculates the same per-subnet statistics as
+    /// @ref recountLeaseStats6 for the specified subnets only.
+    ///
+    /// @param subnet_ids Identifiers of the subnets to be recounted.
+    void recountLeaseStats6(const SubnetIDSet& subnet_ids);
+
+    /// @brief Virtual method which creates and runs the IPv6 lease stats
+    /// query for selected subnets
+    ///
+    /// The default implementation filters the result set returned by
+    /// @ref startLeaseStatsQuery6.
+    ///
+    /// @param subnet_ids Identifiers of the subnets to be examined.
+    ///
+    /// @return A populated LeaseStatsQuery or null if the backend does not
+    /// support recounting.
+    virtual LeaseStatsQueryPtr
+    startSubnetLeaseStatsQuery6(const SubnetIDSet& subnet_ids);
+
     /// @brief Virtual method which removes specified leases.
     ///
     /// This rather dangerous method is able to remove all leases from specified
@@ -579,6 +934,16 @@ public:
     /// @return Description of the backend.
     virtual std::string getDescription() const = 0;
 
+    /// @brief Indicates if the backend can be used concurrently.
+    ///
+    /// The packet processing threads are started only if the lease
+    /// backend is safe to be used by several threads at the same time.
+    ///
+    /// @return false by default.
+    virtual bool isThreadSafe() const {
+        return (false);
+    }
+
     /// @brief Returns backend version.
     ///
     /// @return Version number as a pair of unsigned integers.  "first" is the
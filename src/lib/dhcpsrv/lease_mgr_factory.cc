@@ -101,6 +101,12 @@ LeaseMgrFactory::destroy() {
     getLeaseMgrPtr().reset();
 }
 
+void
+LeaseMgrFactory::setInstance(LeaseMgr* lease_mgr) {
+    destroy();
+    getLeaseMgrPtr().reset(lease_mgr);
+}
+
 bool 
 LeaseMgrFactory::haveInstance() {
     return (getLeaseMgrPtr().get());
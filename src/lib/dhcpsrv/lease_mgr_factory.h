@@ -76,6 +76,16 @@ public:
     /// lease manager is available.
     static void destroy();
 
+    /// @brief Replaces the current lease manager object.
+    ///
+    /// The current lease manager is destroyed and the specified one
+    /// becomes the current lease manager. This is mainly used by the unit
+    /// tests to install lease managers with a customized behavior.
+    ///
+    /// @param lease_mgr Pointer to the new lease manager. The factory
+    ///        takes ownership of the object.
+    static void setInstance(LeaseMgr* lease_mgr);
+
     /// @brief Return current lease manager
     ///
     /// Returns an instance of the "current" lease manager.  An exception
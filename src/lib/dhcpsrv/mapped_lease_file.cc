@@ -0,0 +1,121 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/mapped_lease_file.h>
+#include <util/csv_file.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace isc::util;
+
+namespace isc {
+namespace dhcp {
+
+MappedLeaseFile::MappedLeaseFile(const std::string& filename)
+    : data_(NULL), size_(0) {
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        isc_throw(CSVFileError, "unable to open '" << filename
+                  << "' for reading: " << strerror(errno));
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        int err = errno;
+        close(fd);
+        isc_throw(CSVFileError, "unable to get the size of '" << filename
+                  << "': " << strerror(err));
+    }
+
+    // The empty file can't be mapped and has no rows anyway.
+    if (st.st_size > 0) {
+        void* data = mmap(NULL, static_cast<size_t>(st.st_size), PROT_READ,
+                          MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            int err = errno;
+            close(fd);
+            isc_throw(CSVFileError, "unable to map '" << filename
+                      << "' into memory: " << strerror(err));
+        }
+        // The file is read from the beginning to the end.
+        static_cast<void>(madvise(data, static_cast<size_t>(st.st_size),
+                                  MADV_SEQUENTIAL));
+        data_ = static_cast<const char*>(data);
+        size_ = static_cast<size_t>(st.st_size);
+    }
+
+    // The mapping remains valid after closing the file.
+    close(fd);
+}
+
+MappedLeaseFile::~MappedLeaseFile() {
+    if (data_) {
+        munmap(const_cast<char*>(data_), size_);
+    }
+}
+
+std::vector<MappedLeaseFile::Chunk>
+MappedLeaseFile::split(const size_t max_chunks,
+                       const size_t min_chunk_size) const {
+    std::vector<Chunk> chunks;
+    if (size_ == 0) {
+        return (chunks);
+    }
+
+    const char* const end_of_file = data_ + size_;
+
+    // Skip the header.
+    const char* begin = std::find(data_, end_of_file, '\n');
+    if (begin == end_of_file) {
+        return (chunks);
+    }
+    ++begin;
+
+    // Exclude the incomplete row at the end of the file.
+    const char* end = end_of_file;
+    while ((end != begin) && (*(end - 1) != '\n')) {
+        --end;
+    }
+    if (begin == end) {
+        return (chunks);
+    }
+
+    const size_t data_size = static_cast<size_t>(end - begin);
+    size_t count = std::max(max_chunks, static_cast<size_t>(1));
+    if (min_chunk_size > 0) {
+        count = std::min(count, std::max(data_size / min_chunk_size,
+                                         static_cast<size_t>(1)));
+    }
+    // There can't be more chunks than characters.
+    count = std::min(count, data_size);
+    const size_t chunk_size = data_size / count;
+
+    // Move the end of each chunk to the end of the row.
+    while (begin != end) {
+        const char* chunk_end = end;
+        if ((chunks.size() + 1 < count) &&
+            (static_cast<size_t>(end - begin) > chunk_size)) {
+            chunk_end = std::find(begin + chunk_size - 1, end, '\n');
+            if (chunk_end != end) {
+                ++chunk_end;
+            }
+        }
+        chunks.push_back(Chunk(begin, chunk_end));
+        begin = chunk_end;
+    }
+
+    return (chunks);
+}
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
@@ -0,0 +1,94 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef MAPPED_LEASE_FILE_H
+#define MAPPED_LEASE_FILE_H
+
+#include <boost/noncopyable.hpp>
+#include <string>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Lease file mapped into memory for reading.
+///
+/// This class is used to parse the lease file by multiple threads. The
+/// file is mapped into memory read-only and its data rows are split into
+/// chunks, each holding a number of complete rows. Each chunk can be
+/// parsed independently from others.
+///
+/// The first row of the file is the header, which is not included in
+/// any chunk. The header is parsed by the @c util::VersionedCSVFile when
+/// the file is opened. The last row of the file which is not terminated
+/// with the end of line character is not included in any chunk either.
+/// Such row is a result of an interrupted write and it is not returned
+/// by the @c util::CSVFile::next.
+class MappedLeaseFile : public boost::noncopyable {
+public:
+
+    /// @brief Chunk of rows.
+    struct Chunk {
+
+        /// @brief Constructor.
+        ///
+        /// @param begin Pointer to the first character of the first row.
+        /// @param end Pointer past the end of line character of the last
+        /// row.
+        Chunk(const char* begin, const char* end)
+            : begin_(begin), end_(end) {
+        }
+
+        /// @brief Pointer to the first character of the first row.
+        const char* begin_;
+
+        /// @brief Pointer past the end of line character of the last row.
+        const char* end_;
+    };
+
+    /// @brief Constructor.
+    ///
+    /// Maps the file into memory.
+    ///
+    /// @param filename Name of the file.
+    /// @throw isc::util::CSVFileError if the file can't be mapped.
+    explicit MappedLeaseFile(const std::string& filename);
+
+    /// @brief Destructor.
+    ///
+    /// Unmaps the file.
+    ~MappedLeaseFile();
+
+    /// @brief Returns the size of the file.
+    size_t getSize() const {
+        return (size_);
+    }
+
+    /// @brief Splits the data rows of the file into chunks.
+    ///
+    /// The chunks are returned in the order in which they appear in the
+    /// file. They hold roughly equal number of bytes, but not less than
+    /// the specified minimum size, except the last chunk.
+    ///
+    /// @param max_chunks Maximum number of chunks.
+    /// @param min_chunk_size Minimum size of the chunk in bytes.
+    /// @return Chunks of rows. It is empty if the file has no data rows.
+    std::vector<Chunk> split(const size_t max_chunks,
+                             const size_t min_chunk_size) const;
+
+private:
+
+    /// @brief Pointer to the mapped contents of the file.
+    const char* data_;
+
+    /// @brief Size of the file.
+    size_t size_;
+};
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
+
+#endif // MAPPED_LEASE_FILE_H
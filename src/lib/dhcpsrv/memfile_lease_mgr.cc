@@ -9,18 +9,21 @@
 #include <dhcpsrv/dhcpsrv_log.h>
 #include <dhcpsrv/lease_file_loader.h>
 #include <dhcpsrv/memfile_lease_mgr.h>
+#include <dhcpsrv/processing_latency.h>
 #include <dhcpsrv/timer_mgr.h>
 #include <dhcpsrv/database_connection.h>
 #include <exceptions/exceptions.h>
 #include <util/pid_file.h>
 #include <util/process_spawn.h>
 #include <util/signal_set.h>
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
 #include <errno.h>
 #include <iostream>
 #include <limits>
 #include <sstream>
+#include <unistd.h>
 
 namespace {
 
@@ -36,9 +39,111 @@ const uint32_t MAX_LEASE_ERRORS = 100;
 /// Kea installation directory.
 const char* KEA_LFC_EXECUTABLE_ENV_NAME = "KEA_LFC_EXECUTABLE";
 
+/// @brief Returns the lease with the lowest address within the range.
+///
+/// The order of the leases having equal keys in the hashed indexes is
+/// not defined. This function is used to consistently return the same
+/// lease when several leases match the search criteria.
+///
+/// @param range Pair of iterators delimiting the leases.
+/// @tparam IteratorType Type of the index iterator.
+///
+/// @return Pointer to the lease or NULL if the range is empty.
+template<typename IteratorType>
+isc::dhcp::Lease4Ptr
+lowestAddressLease(const std::pair<IteratorType, IteratorType>& range) {
+    isc::dhcp::Lease4Ptr lowest;
+    for (IteratorType lease = range.first; lease != range.second; ++lease) {
+        if (!lowest || ((*lease)->addr_ < lowest->addr_)) {
+            lowest = *lease;
+        }
+    }
+    return (lowest);
+}
+
+/// @brief Returns the copies of the leases with the lowest addresses above
+/// the lower bound.
+///
+/// The leases are walked in the ascending order of addresses from the
+/// first address above the lower bound, so only the returned leases are
+/// visited.
+///
+/// @param storage Lease storage.
+/// @param lower_bound_address Address preceding the returned leases.
+/// @param page_size Maximum number of leases returned.
+/// @tparam LeaseObjectType @c Lease4 or @c Lease6.
+/// @tparam StorageType Type of the lease storage.
+///
+/// @return Leases in the ascending order of addresses.
+template<typename LeaseObjectType, typename StorageType>
+std::vector<boost::shared_ptr<LeaseObjectType> >
+getLeasePage(const StorageType& storage,
+             const isc::asiolink::IOAddress& lower_bound_address,
+             const size_t page_size) {
+    typedef boost::shared_ptr<LeaseObjectType> LeasePtrType;
+    typedef typename StorageType::template
+        index<isc::dhcp::OrderedAddressIndexTag>::type OrderedAddressIndex;
+
+    const OrderedAddressIndex& idx =
+        storage.template get<isc::dhcp::OrderedAddressIndexTag>();
+    std::vector<LeasePtrType> page;
+    for (typename OrderedAddressIndex::const_iterator lease =
+             idx.upper_bound(lower_bound_address);
+         (lease != idx.end()) && (page.size() < page_size); ++lease) {
+        page.push_back(LeasePtrType(new LeaseObjectType(**lease)));
+    }
+    return (page);
+}
+
+/// @brief Loads leases from the lease file.
+///
+/// @param lease_file Lease file.
+/// @param storage Storage for the leases read from the lease file.
+/// @param threads Number of threads parsing the lease file. If it is
+/// greater than 1, the file is parsed in chunks by multiple threads.
+/// @param close_file_on_exit Indicates if the file should be closed after
+/// it has been parsed.
+/// @tparam LeaseObjectType @c Lease4 or @c Lease6.
+/// @tparam LeaseFileType @c CSVLeaseFile4 or @c CSVLeaseFile6.
+/// @tparam StorageType Type of the lease storage.
+template<typename LeaseObjectType, typename LeaseFileType, typename StorageType>
+void
+loadLeaseFile(LeaseFileType& lease_file, StorageType& storage,
+              const size_t threads, const bool close_file_on_exit = true) {
+    if (threads > 1) {
+        isc::dhcp::LeaseFileLoader::loadParallel<LeaseObjectType>(lease_file,
+                                                                   storage,
+                                                                   MAX_LEASE_ERRORS,
+                                                                   close_file_on_exit,
+                                                                   threads);
+    } else {
+        isc::dhcp::LeaseFileLoader::load<LeaseObjectType>(lease_file, storage,
+                                                          MAX_LEASE_ERRORS,
+                                                          close_file_on_exit);
+    }
+}
+
+/// @brief Checks if two lease pointers hold the same lease.
+///
+/// @param first First lease, may be null.
+/// @param second Second lease, may be null.
+/// @return true if both are null or both hold equal leases.
+/// @tparam LeasePtrType @c Lease4Ptr or @c Lease6Ptr.
+template<typename LeasePtrType>
+bool
+sameLease(const LeasePtrType& first, const LeasePtrType& second) {
+    if (!first || !second) {
+        return (!first && !second);
+    }
+    return (*first == *second);
+}
+
 } // end of anonymous namespace
 
+using namespace isc::asiolink;
 using namespace isc::util;
+using isc::util::thread::Mutex;
+using isc::util::thread::Thread;
 
 namespace isc {
 namespace dhcp {
@@ -85,14 +190,23 @@ public:
     /// @param run_once_now A flag that causes LFC to be invoked immediately,
     /// regardless of the value of lfc_interval.  This is primarily used to
     /// cause lease file schema upgrades upon startup.
+    /// @param in_process A flag indicating that the cleanup is performed
+    /// by the backend, in which case the kea-lfc process is not prepared.
     void setup(const uint32_t lfc_interval,
                const boost::shared_ptr<CSVLeaseFile4>& lease_file4,
                const boost::shared_ptr<CSVLeaseFile6>& lease_file6,
-               bool run_once_now = false);
+               bool run_once_now = false, bool in_process = false);
 
     /// @brief Spawns a new process.
     void execute();
 
+    /// @brief Prepares the command line of the kea-lfc process.
+    ///
+    /// @param lease_file4 A pointer to the DHCPv4 lease file or NULL.
+    /// @param lease_file6 A pointer to the DHCPv6 lease file or NULL.
+    void prepareProcess(const boost::shared_ptr<CSVLeaseFile4>& lease_file4,
+                        const boost::shared_ptr<CSVLeaseFile6>& lease_file6);
+
     /// @brief Checks if the lease file cleanup is in progress.
     ///
     /// @return true if the lease file cleanup is being executed.
@@ -152,13 +266,40 @@ void
 LFCSetup::setup(const uint32_t lfc_interval,
                 const boost::shared_ptr<CSVLeaseFile4>& lease_file4,
                 const boost::shared_ptr<CSVLeaseFile6>& lease_file6,
-                bool run_once_now) {
+                bool run_once_now, bool in_process) {
 
     // If to nothing to do, punt
     if (lfc_interval == 0 && !run_once_now) {
         return;
     }
 
+    // The in-process cleanup doesn't need the kea-lfc.
+    if (!in_process) {
+        prepareProcess(lease_file4, lease_file6);
+    }
+
+    // If we've been told to run it once now, invoke the callback directly.
+    if (run_once_now) {
+        callback_();
+    }
+
+    // If it's supposed to run periodically, setup that now.
+    if (lfc_interval > 0) {
+        // Set the timer to call callback function periodically.
+        LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_LFC_SETUP).arg(lfc_interval);
+
+        // Multiple the lfc_interval value by 1000 as this value specifies
+        // a timeout in seconds, whereas the setup() method expects the
+        // timeout in milliseconds.
+        timer_mgr_->registerTimer("memfile-lfc", callback_, lfc_interval * 1000,
+                                  asiolink::IntervalTimer::REPEATING);
+        timer_mgr_->setup("memfile-lfc");
+    }
+}
+
+void
+LFCSetup::prepareProcess(const boost::shared_ptr<CSVLeaseFile4>& lease_file4,
+                         const boost::shared_ptr<CSVLeaseFile6>& lease_file6) {
     // Start preparing the command line for kea-lfc.
     std::string executable;
     char* c_executable = getenv(KEA_LFC_EXECUTABLE_ENV_NAME);
@@ -204,24 +345,6 @@ LFCSetup::setup(const uint32_t lfc_interval,
 
     // Create the process (do not start it yet).
     process_.reset(new util::ProcessSpawn(executable, args));
-
-    // If we've been told to run it once now, invoke the callback directly.
-    if (run_once_now) {
-        callback_();
-    }
-
-    // If it's supposed to run periodically, setup that now.
-    if (lfc_interval > 0) {
-        // Set the timer to call callback function periodically.
-        LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_LFC_SETUP).arg(lfc_interval);
-
-        // Multiple the lfc_interval value by 1000 as this value specifies
-        // a timeout in seconds, whereas the setup() method expects the
-        // timeout in milliseconds.
-        timer_mgr_->registerTimer("memfile-lfc", callback_, lfc_interval * 1000,
-                                  asiolink::IntervalTimer::REPEATING);
-        timer_mgr_->setup("memfile-lfc");
-    }
 }
 
 void
@@ -260,8 +383,11 @@ class MemfileLeaseStatsQuery : public LeaseStatsQuery {
 public:
     /// @brief Constructor
     ///
-    MemfileLeaseStatsQuery()
-    : rows_(0), next_pos_(rows_.end()) {
+    /// @param subnet_ids Pointer to the identifiers of the subnets to be
+    /// examined. If it is null, all subnets are examined.
+    MemfileLeaseStatsQuery(const SubnetIDSet* subnet_ids = 0)
+    : rows_(0), next_pos_(rows_.end()), select_subnets_(subnet_ids != 0),
+      subnet_ids_(subnet_ids ? *subnet_ids : SubnetIDSet()) {
     };
 
     /// @brief Destructor
@@ -298,6 +424,12 @@ protected:
 
     /// @brief An iterator for accessing the next row within the result set
     std::vector<LeaseStatsRow>::iterator next_pos_;
+
+    /// @brief Indicates if only the selected subnets are examined.
+    bool select_subnets_;
+
+    /// @brief Identifiers of the selected subnets.
+    SubnetIDSet subnet_ids_;
 };
 
 /// @brief Memfile derivation of the IPv4 statistical lease data query
@@ -314,8 +446,15 @@ public:
     /// @brief Constructor
     ///
     /// @param storage4 A pointer to the v4 lease storage to be counted
-    MemfileLeaseStatsQuery4(Lease4Storage& storage4)
-    : MemfileLeaseStatsQuery(), storage4_(storage4) {
+    /// @param packed4 A pointer to the packed v4 lease storage. If it is
+    /// non-null, it is counted instead of the @c storage4.
+    /// @param subnet_ids Pointer to the identifiers of the subnets to be
+    /// counted. If it is null, all subnets are counted.
+    MemfileLeaseStatsQuery4(Lease4Storage& storage4,
+                            const PackedLease4Storage* packed4 = 0,
+                            const SubnetIDSet* subnet_ids = 0)
+    : MemfileLeaseStatsQuery(subnet_ids), storage4_(storage4),
+      packed4_(packed4) {
     };
 
     /// @brief Destructor
@@ -335,18 +474,61 @@ public:
     ///
     /// - Lease::STATE_DEFAULT (i.e. assigned)
     /// - Lease::STATE_DECLINED
+    ///
+    /// If the subnets have been selected, only the leases of these subnets
+    /// are examined.
     void start() {
+        if (packed4_) {
+            rows_ = packed4_->getLeaseStats();
+            if (select_subnets_) {
+                std::vector<LeaseStatsRow> selected;
+                for (std::vector<LeaseStatsRow>::const_iterator row =
+                         rows_.begin(); row != rows_.end(); ++row) {
+                    if (subnet_ids_.count(row->subnet_id_) > 0) {
+                        selected.push_back(*row);
+                    }
+                }
+                rows_.swap(selected);
+            }
+            next_pos_ = rows_.begin();
+            return;
+        }
+
         const Lease4StorageSubnetIdIndex& idx
             = storage4_.get<SubnetIdIndexTag>();
 
+        if (!select_subnets_) {
+            countLeases(idx.begin(), idx.end());
+
+        } else {
+            for (SubnetIDSet::const_iterator subnet_id = subnet_ids_.begin();
+                 subnet_id != subnet_ids_.end(); ++subnet_id) {
+                std::pair<Lease4StorageSubnetIdIndex::const_iterator,
+                          Lease4StorageSubnetIdIndex::const_iterator> range =
+                    idx.equal_range(*subnet_id);
+                countLeases(range.first, range.second);
+            }
+        }
+
+        // Set the next row position to the beginning of the rows.
+        next_pos_ = rows_.begin();
+    }
+
+private:
+    /// @brief Appends the rows for the leases in the specified range.
+    ///
+    /// @param first Iterator pointing to the first lease in the range.
+    /// @param last Iterator pointing past the last lease in the range.
+    void countLeases(Lease4StorageSubnetIdIndex::const_iterator first,
+                     Lease4StorageSubnetIdIndex::const_iterator last) {
         // Iterate over the leases in order by subnet, accumulating per
         // subnet counts for each state of interest.  As we finish each
         // subnet, add the appropriate rows to our result set.
         SubnetID cur_id = 0;
         int64_t assigned = 0;
         int64_t declined = 0;
-        for(Lease4StorageSubnetIdIndex::const_iterator lease = idx.begin();
-            lease != idx.end(); ++lease) {
+        for(Lease4StorageSubnetIdIndex::const_iterator lease = first;
+            lease != last; ++lease) {
             // If we've hit the next subnet, add rows for the current subnet
             // and wipe the accumulators
             if ((*lease)->subnet_id_ != cur_id) {
@@ -372,20 +554,19 @@ public:
         }
 
         // Make the rows for last subnet, unless there were no rows
-        if (idx.begin() != idx.end()) {
+        if (first != last) {
             rows_.push_back(LeaseStatsRow(cur_id, Lease::STATE_DEFAULT,
                                           assigned));
             rows_.push_back(LeaseStatsRow(cur_id, Lease::STATE_DECLINED,
                                           declined));
         }
-
-        // Set the next row position to the beginning of the rows.
-        next_pos_ = rows_.begin();
     }
 
-private:
     /// @brief The Memfile storage containing the IPv4 leases to analyze
     Lease4Storage& storage4_;
+
+    /// @brief The packed storage containing the IPv4 leases to analyze
+    const PackedLease4Storage* packed4_;
 };
 
 
@@ -403,8 +584,11 @@ public:
     /// @brief Constructor
     ///
     /// @param storage6 A pointer to the v6 lease storage to be counted
-    MemfileLeaseStatsQuery6(Lease6Storage& storage6)
-        : MemfileLeaseStatsQuery(), storage6_(storage6) {
+    /// @param subnet_ids Pointer to the identifiers of the subnets to be
+    /// counted. If it is null, all subnets are counted.
+    MemfileLeaseStatsQuery6(Lease6Storage& storage6,
+                            const SubnetIDSet* subnet_ids = 0)
+        : MemfileLeaseStatsQuery(subnet_ids), storage6_(storage6) {
     };
 
     /// @brief Destructor
@@ -423,11 +607,38 @@ public:
     ///
     /// - Lease::STATE_DEFAULT (i.e. assigned)
     /// - Lease::STATE_DECLINED
+    ///
+    /// If the subnets have been selected, only the leases of these subnets
+    /// are examined.
     virtual void start() {
         // Get the subnet_id index
         const Lease6StorageSubnetIdIndex& idx
             = storage6_.get<SubnetIdIndexTag>();
 
+        if (!select_subnets_) {
+            countLeases(idx.begin(), idx.end());
+
+        } else {
+            for (SubnetIDSet::const_iterator subnet_id = subnet_ids_.begin();
+                 subnet_id != subnet_ids_.end(); ++subnet_id) {
+                std::pair<Lease6StorageSubnetIdIndex::const_iterator,
+                          Lease6StorageSubnetIdIndex::const_iterator> range =
+                    idx.equal_range(*subnet_id);
+                countLeases(range.first, range.second);
+            }
+        }
+
+        // Set the next row position to the beginning of the rows.
+        next_pos_ = rows_.begin();
+    }
+
+private:
+    /// @brief Appends the rows for the leases in the specified range.
+    ///
+    /// @param first Iterator pointing to the first lease in the range.
+    /// @param last Iterator pointing past the last lease in the range.
+    void countLeases(Lease6StorageSubnetIdIndex::const_iterator first,
+                     Lease6StorageSubnetIdIndex::const_iterator last) {
         // Iterate over the leases in order by subnet, accumulating per
         // subnet counts for each state of interest.  As we finish each
         // subnet, add the appropriate rows to our result set.
@@ -436,8 +647,8 @@ public:
         int64_t declined = 0;
         int64_t assigned_pds = 0;
 
-        for(Lease6StorageSubnetIdIndex::const_iterator lease = idx.begin();
-            lease != idx.end(); ++lease) {
+        for(Lease6StorageSubnetIdIndex::const_iterator lease = first;
+            lease != last; ++lease) {
 
             // If we've hit the next subnet, add rows for the current subnet
             // and wipe the accumulators
@@ -482,7 +693,7 @@ public:
         }
 
         // Make the rows for last subnet, unless there were no rows
-        if (idx.begin() != idx.end()) {
+        if (first != last) {
             rows_.push_back(LeaseStatsRow(cur_id, Lease::TYPE_NA,
                                           Lease::STATE_DEFAULT,
                                           assigned));
@@ -493,12 +704,8 @@ public:
                                           Lease::STATE_DEFAULT,
                                           assigned_pds));
         }
-
-        // Set the next row position to the beginning of the rows.
-        next_pos_ = rows_.begin();
     }
 
-private:
     /// @brief The Memfile storage containing the IPv6 leases to analyze
     Lease6Storage& storage6_;
 };
@@ -509,30 +716,54 @@ const int Memfile_LeaseMgr::MAJOR_VERSION;
 const int Memfile_LeaseMgr::MINOR_VERSION;
 
 Memfile_LeaseMgr::Memfile_LeaseMgr(const DatabaseConnection::ParameterMap& parameters)
-    : LeaseMgr(), lfc_setup_(), conn_(parameters)
+    : LeaseMgr(), lfc_setup_(), lfc_in_process_(false), lfc_batch_size_(1000),
+      lfc_batch_interval_(0), lfc_snapshot_binary_(false), lfc_thread_(), lfc_running_(false),
+      lfc_stop_(false), lfc_exit_status_(0), conn_(parameters)
     {
     bool conversion_needed = false;
 
     // Check the universe and use v4 file or v6 file.
     std::string universe = conn_.getParameter("universe");
+    bool packed = usePackedStorage();
     if (universe == "4") {
         std::string file4 = initLeaseFilePath(V4);
-        if (!file4.empty()) {
-            conversion_needed = loadLeasesFromFiles<Lease4,
-                                                 CSVLeaseFile4>(file4,
+        if (packed) {
+            packed4_.reset(new PackedLease4Storage());
+            if (!file4.empty()) {
+                conversion_needed = loadLeasesFromFiles<Lease4, CSVLeaseFile4,
+                                                     BinaryLeaseFile4>(file4,
+                                                                    lease_file4_,
+                                                                    *packed4_);
+            }
+
+        } else if (!file4.empty()) {
+            conversion_needed = loadLeasesFromFiles<Lease4, CSVLeaseFile4,
+                                                 BinaryLeaseFile4>(file4,
                                                                 lease_file4_,
                                                                 storage4_);
         }
     } else {
         std::string file6 = initLeaseFilePath(V6);
         if (!file6.empty()) {
-            conversion_needed = loadLeasesFromFiles<Lease6,
-                                                 CSVLeaseFile6>(file6,
+            conversion_needed = loadLeasesFromFiles<Lease6, CSVLeaseFile6,
+                                                 BinaryLeaseFile6>(file6,
                                                                 lease_file6_,
                                                                 storage6_);
         }
     }
 
+    // Let the writer take over writing the rows appended to the lease
+    // file.
+    GroupCommitWriterPtr group_commit = createGroupCommitWriter();
+    if (group_commit && lease_file4_) {
+        lease_file4_->setWriter(group_commit);
+        group_commit_ = group_commit;
+
+    } else if (group_commit && lease_file6_) {
+        lease_file6_->setWriter(group_commit);
+        group_commit_ = group_commit;
+    }
+
     // If lease persistence have been disabled for both v4 and v6,
     // issue a warning. It is ok not to write leases to disk when
     // doing testing, but it should not be done in normal server
@@ -550,6 +781,8 @@ Memfile_LeaseMgr::Memfile_LeaseMgr(const DatabaseConnection::ParameterMap& param
 }
 
 Memfile_LeaseMgr::~Memfile_LeaseMgr() {
+    // The cleanup thread uses the lease storage.
+    lfcStopInProcess();
     if (lease_file4_) {
         lease_file4_->close();
         lease_file4_.reset();
@@ -570,43 +803,103 @@ Memfile_LeaseMgr::getDBVersion() {
 
 bool
 Memfile_LeaseMgr::addLease(const Lease4Ptr& lease) {
+    StageTimer timer(ProcessingLatency::STAGE_LEASE_WRITE);
+
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_ADD_ADDR4).arg(lease->addr_.toText());
 
-    if (getLease4(lease->addr_)) {
+    bool added = false;
+    GroupCommitWriterPtr writer;
+    uint64_t sequence = 0;
+    LeaseChanges changes;
+    {
+        Mutex::Locker lock(mutex_);
+        added = addLeaseInternal(lease, recordChanges(changes));
+        writer = getGroupCommit(sequence);
+    }
+    waitGroupCommit(writer, sequence, changes);
+    return (added);
+}
+
+bool
+Memfile_LeaseMgr::addLeaseInternal(const Lease4Ptr& lease,
+                                   LeaseChanges* changes) {
+    if (packed4_ ? (packed4_->find(lease->addr_) != packed4_->end()) :
+        (storage4_.find(lease->addr_) != storage4_.end())) {
         // there is a lease with specified address already
         return (false);
     }
 
-    // Try to write a lease to disk first. If this fails, the lease will
-    // not be inserted to the memory and the disk and in-memory data will
-    // remain consistent.
+    // Write the lease to disk first. If this fails, the lease will not be
+    // inserted to the memory and the disk and in-memory data will remain
+    // consistent. With the group commit the row is only queued here and
+    // the caller undoes the change if the group can't be written.
     if (persistLeases(V4)) {
         lease_file4_->append(*lease);
     }
 
-    storage4_.insert(lease);
+    // Store a copy of the lease. The stored leases are never modified in
+    // place, which allows for returning them to the readers without
+    // copying.
+    Lease4Ptr stored(new Lease4(*lease));
+    if (changes) {
+        changes->push_back(LeaseChange(lease->addr_, Lease4Ptr(), stored));
+    }
+
+    if (packed4_) {
+        packed4_->insert(stored);
+    } else {
+        storage4_.insert(stored);
+    }
     return (true);
 }
 
 bool
 Memfile_LeaseMgr::addLease(const Lease6Ptr& lease) {
+    StageTimer timer(ProcessingLatency::STAGE_LEASE_WRITE);
+
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_ADD_ADDR6).arg(lease->addr_.toText());
 
-    if (getLease6(lease->type_, lease->addr_)) {
+    bool added = false;
+    GroupCommitWriterPtr writer;
+    uint64_t sequence = 0;
+    LeaseChanges changes;
+    {
+        Mutex::Locker lock(mutex_);
+        added = addLeaseInternal(lease, recordChanges(changes));
+        writer = getGroupCommit(sequence);
+    }
+    waitGroupCommit(writer, sequence, changes);
+    return (added);
+}
+
+bool
+Memfile_LeaseMgr::addLeaseInternal(const Lease6Ptr& lease,
+                                   LeaseChanges* changes) {
+    Lease6Storage::iterator existing = storage6_.find(lease->addr_);
+    if ((existing != storage6_.end()) && (*existing) &&
+        ((*existing)->type_ == lease->type_)) {
         // there is a lease with specified address already
         return (false);
     }
 
-    // Try to write a lease to disk first. If this fails, the lease will
-    // not be inserted to the memory and the disk and in-memory data will
-    // remain consistent.
+    // Write the lease to disk first. If this fails, the lease will not be
+    // inserted to the memory and the disk and in-memory data will remain
+    // consistent. With the group commit the row is only queued here and
+    // the caller undoes the change if the group can't be written.
     if (persistLeases(V6)) {
         lease_file6_->append(*lease);
     }
 
-    storage6_.insert(lease);
+    // Store a copy of the lease. The stored leases are never modified in
+    // place, which allows for returning them to the readers without
+    // copying.
+    Lease6Ptr stored(new Lease6(*lease));
+    if (changes) {
+        changes->push_back(LeaseChange(lease->addr_, Lease6Ptr(), stored));
+    }
+    storage6_.insert(stored);
     return (true);
 }
 
@@ -615,6 +908,12 @@ Memfile_LeaseMgr::getLease4(const isc::asiolink::IOAddress& addr) const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_GET_ADDR4).arg(addr.toText());
 
+    Mutex::Locker lock(mutex_);
+
+    if (packed4_) {
+        return (packed4_->get(addr));
+    }
+
     const Lease4StorageAddressIndex& idx = storage4_.get<AddressIndexTag>();
     Lease4StorageAddressIndex::iterator l = idx.find(addr);
     if (l == idx.end()) {
@@ -624,19 +923,44 @@ Memfile_LeaseMgr::getLease4(const isc::asiolink::IOAddress& addr) const {
     }
 }
 
+ConstLease4Ptr
+Memfile_LeaseMgr::getConstLease4(const isc::asiolink::IOAddress& addr) const {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_MEMFILE_GET_ADDR4).arg(addr.toText());
+
+    Mutex::Locker lock(mutex_);
+
+    // The packed leases have to be materialized anyway.
+    if (packed4_) {
+        return (packed4_->get(addr));
+    }
+
+    const Lease4StorageAddressIndex& idx = storage4_.get<AddressIndexTag>();
+    Lease4StorageAddressIndex::iterator l = idx.find(addr);
+    if (l == idx.end()) {
+        return (ConstLease4Ptr());
+    }
+    return (*l);
+}
+
 Lease4Collection
 Memfile_LeaseMgr::getLease4(const HWAddr& hwaddr) const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_GET_HWADDR).arg(hwaddr.toText());
+
+    Mutex::Locker lock(mutex_);
+
+    if (packed4_) {
+        return (packed4_->getByHWAddr(hwaddr));
+    }
+
     Lease4Collection collection;
 
-    // Using composite index by 'hw address' and 'subnet id'. It is
-    // ok to use it for searching by the 'hw address' only.
-    const Lease4StorageHWAddressSubnetIdIndex& idx =
-        storage4_.get<HWAddressSubnetIdIndexTag>();
-    std::pair<Lease4StorageHWAddressSubnetIdIndex::const_iterator,
-              Lease4StorageHWAddressSubnetIdIndex::const_iterator> l
-        = idx.equal_range(boost::make_tuple(hwaddr.hwaddr_));
+    // Get the index by HW address.
+    const Lease4StorageHWAddressIndex& idx = storage4_.get<HWAddressIndexTag>();
+    std::pair<Lease4StorageHWAddressIndex::const_iterator,
+              Lease4StorageHWAddressIndex::const_iterator> l
+        = idx.equal_range(hwaddr.hwaddr_);
 
     for(auto lease = l.first; lease != l.second; ++lease) {
         collection.push_back(Lease4Ptr(new Lease4(**lease)));
@@ -651,33 +975,46 @@ Memfile_LeaseMgr::getLease4(const HWAddr& hwaddr, SubnetID subnet_id) const {
               DHCPSRV_MEMFILE_GET_SUBID_HWADDR).arg(subnet_id)
         .arg(hwaddr.toText());
 
+    Mutex::Locker lock(mutex_);
+
+    if (packed4_) {
+        return (packed4_->getByHWAddr(hwaddr, subnet_id));
+    }
+
     // Get the index by HW Address and Subnet Identifier.
     const Lease4StorageHWAddressSubnetIdIndex& idx =
         storage4_.get<HWAddressSubnetIdIndexTag>();
     // Try to find the lease using HWAddr and subnet id.
-    Lease4StorageHWAddressSubnetIdIndex::const_iterator lease =
-        idx.find(boost::make_tuple(hwaddr.hwaddr_, subnet_id));
+    // The tuple holds a reference to the HW address to avoid copying it.
+    Lease4Ptr lease = lowestAddressLease(idx.equal_range(
+        boost::tuple<const std::vector<uint8_t>&, SubnetID>(hwaddr.hwaddr_,
+                                                             subnet_id)));
     // Lease was not found. Return empty pointer to the caller.
-    if (lease == idx.end()) {
+    if (!lease) {
         return (Lease4Ptr());
     }
 
     // Lease was found. Return it to the caller.
-    return (Lease4Ptr(new Lease4(**lease)));
+    return (Lease4Ptr(new Lease4(*lease)));
 }
 
 Lease4Collection
 Memfile_LeaseMgr::getLease4(const ClientId& client_id) const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_GET_CLIENTID).arg(client_id.toText());
+
+    Mutex::Locker lock(mutex_);
+
+    if (packed4_) {
+        return (packed4_->getByClientId(client_id));
+    }
+
     Lease4Collection collection;
-    // Using composite index by 'client id' and 'subnet id'. It is ok
-    // to use it to search by 'client id' only.
-    const Lease4StorageClientIdSubnetIdIndex& idx =
-        storage4_.get<ClientIdSubnetIdIndexTag>();
-    std::pair<Lease4StorageClientIdSubnetIdIndex::const_iterator,
-              Lease4StorageClientIdSubnetIdIndex::const_iterator> l
-        = idx.equal_range(boost::make_tuple(client_id.getClientId()));
+    // Get the index by client id.
+    const Lease4StorageClientIdIndex& idx = storage4_.get<ClientIdIndexTag>();
+    std::pair<Lease4StorageClientIdIndex::const_iterator,
+              Lease4StorageClientIdIndex::const_iterator> l
+        = idx.equal_range(client_id.getClientId());
 
     for(auto lease = l.first; lease != l.second; ++lease) {
         collection.push_back(Lease4Ptr(new Lease4(**lease)));
@@ -695,21 +1032,32 @@ Memfile_LeaseMgr::getLease4(const ClientId& client_id,
                                                         .arg(hwaddr.toText())
                                                         .arg(subnet_id);
 
-    // Get the index by client id, HW address and subnet id.
-    const Lease4StorageClientIdHWAddressSubnetIdIndex& idx =
-        storage4_.get<ClientIdHWAddressSubnetIdIndexTag>();
-    // Try to get the lease using client id, hardware address and subnet id.
-    Lease4StorageClientIdHWAddressSubnetIdIndex::const_iterator lease =
-        idx.find(boost::make_tuple(client_id.getClientId(), hwaddr.hwaddr_,
-                                   subnet_id));
+    Mutex::Locker lock(mutex_);
 
-    if (lease == idx.end()) {
-        // Lease was not found. Return empty pointer to the caller.
-        return (Lease4Ptr());
+    if (packed4_) {
+        return (packed4_->getByClientId(client_id, hwaddr, subnet_id));
     }
 
-    // Lease was found. Return it to the caller.
-    return (*lease);
+    // Get the index by client and subnet id. There is typically a single
+    // lease for the client in the subnet, so it is cheaper to check its
+    // HW address than to maintain a separate index for this lookup.
+    const Lease4StorageClientIdSubnetIdIndex& idx =
+        storage4_.get<ClientIdSubnetIdIndexTag>();
+    std::pair<Lease4StorageClientIdSubnetIdIndex::const_iterator,
+              Lease4StorageClientIdSubnetIdIndex::const_iterator> l =
+        idx.equal_range(boost::tuple<const std::vector<uint8_t>&, SubnetID>
+                        (client_id.getClientId(), subnet_id));
+
+    for (Lease4StorageClientIdSubnetIdIndex::const_iterator lease = l.first;
+         lease != l.second; ++lease) {
+        if ((*lease)->getHWAddrVector() == hwaddr.hwaddr_) {
+            // Lease was found. Return it to the caller.
+            return (Lease4Ptr(new Lease4(**lease)));
+        }
+    }
+
+    // Lease was not found. Return empty pointer to the caller.
+    return (Lease4Ptr());
 }
 
 Lease4Ptr
@@ -719,18 +1067,95 @@ Memfile_LeaseMgr::getLease4(const ClientId& client_id,
               DHCPSRV_MEMFILE_GET_SUBID_CLIENTID).arg(subnet_id)
               .arg(client_id.toText());
 
+    Mutex::Locker lock(mutex_);
+
+    if (packed4_) {
+        return (packed4_->getByClientId(client_id, subnet_id));
+    }
+
     // Get the index by client and subnet id.
     const Lease4StorageClientIdSubnetIdIndex& idx =
         storage4_.get<ClientIdSubnetIdIndexTag>();
     // Try to get the lease using client id and subnet id.
-    Lease4StorageClientIdSubnetIdIndex::const_iterator lease =
-        idx.find(boost::make_tuple(client_id.getClientId(), subnet_id));
+    Lease4Ptr lease = lowestAddressLease(idx.equal_range(
+        boost::tuple<const std::vector<uint8_t>&, SubnetID>(client_id.getClientId(),
+                                                             subnet_id)));
     // Lease was not found. Return empty pointer to the caller.
-    if (lease == idx.end()) {
+    if (!lease) {
         return (Lease4Ptr());
     }
     // Lease was found. Return it to the caller.
-    return (Lease4Ptr(new Lease4(**lease)));
+    return (Lease4Ptr(new Lease4(*lease)));
+}
+
+Lease4Collection
+Memfile_LeaseMgr::getLeases4(SubnetID subnet_id) const {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_MEMFILE_GET_SUBID4).arg(subnet_id);
+
+    Mutex::Locker lock(mutex_);
+
+    if (packed4_) {
+        return (packed4_->getBySubnetId(subnet_id));
+    }
+
+    // Get the index by subnet id.
+    const Lease4StorageSubnetIdIndex& idx = storage4_.get<SubnetIdIndexTag>();
+    std::pair<Lease4StorageSubnetIdIndex::const_iterator,
+              Lease4StorageSubnetIdIndex::const_iterator> l =
+        idx.equal_range(subnet_id);
+
+    Lease4Collection collection;
+    for (Lease4StorageSubnetIdIndex::const_iterator lease = l.first;
+         lease != l.second; ++lease) {
+        collection.push_back(Lease4Ptr(new Lease4(**lease)));
+    }
+
+    return (collection);
+}
+
+Lease4Collection
+Memfile_LeaseMgr::getLeases4() const {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MEMFILE_GET4);
+
+    Mutex::Locker lock(mutex_);
+
+    if (packed4_) {
+        return (packed4_->getAll());
+    }
+
+    Lease4Collection collection;
+    collection.reserve(storage4_.size());
+    for (Lease4Storage::const_iterator lease = storage4_.begin();
+         lease != storage4_.end(); ++lease) {
+        collection.push_back(Lease4Ptr(new Lease4(**lease)));
+    }
+
+    return (collection);
+}
+
+Lease4Collection
+Memfile_LeaseMgr::getLeases4(const asiolink::IOAddress& lower_bound_address,
+                             const LeasePageSize& page_size) const {
+    // Expecting IPv4 address.
+    if (!lower_bound_address.isV4()) {
+        isc_throw(InvalidParameter, "expected IPv4 address while "
+                  "retrieving leases from the lease database, got "
+                  << lower_bound_address);
+    }
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MEMFILE_GET_PAGE4)
+        .arg(page_size.page_size_)
+        .arg(lower_bound_address.toText());
+
+    Mutex::Locker lock(mutex_);
+
+    if (packed4_) {
+        return (packed4_->getPage(lower_bound_address, page_size.page_size_));
+    }
+
+    return (getLeasePage<Lease4>(storage4_, lower_bound_address,
+                                 page_size.page_size_));
 }
 
 Lease6Ptr
@@ -740,6 +1165,8 @@ Memfile_LeaseMgr::getLease6(Lease::Type type,
               DHCPSRV_MEMFILE_GET_ADDR6)
         .arg(addr.toText())
         .arg(Lease::typeToText(type));
+
+    Mutex::Locker lock(mutex_);
     Lease6Storage::iterator l = storage6_.find(addr);
     if (l == storage6_.end() || !(*l) || ((*l)->type_ != type)) {
         return (Lease6Ptr());
@@ -748,6 +1175,22 @@ Memfile_LeaseMgr::getLease6(Lease::Type type,
     }
 }
 
+ConstLease6Ptr
+Memfile_LeaseMgr::getConstLease6(Lease::Type type,
+                                 const isc::asiolink::IOAddress& addr) const {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_MEMFILE_GET_ADDR6)
+        .arg(addr.toText())
+        .arg(Lease::typeToText(type));
+
+    Mutex::Locker lock(mutex_);
+    Lease6Storage::iterator l = storage6_.find(addr);
+    if (l == storage6_.end() || !(*l) || ((*l)->type_ != type)) {
+        return (ConstLease6Ptr());
+    }
+    return (*l);
+}
+
 Lease6Collection
 Memfile_LeaseMgr::getLeases6(Lease::Type type,
                             const DUID& duid, uint32_t iaid) const {
@@ -757,12 +1200,15 @@ Memfile_LeaseMgr::getLeases6(Lease::Type type,
         .arg(duid.toText())
         .arg(Lease::typeToText(type));
 
+    Mutex::Locker lock(mutex_);
+
     // Get the index by DUID, IAID, lease type.
     const Lease6StorageDuidIaidTypeIndex& idx = storage6_.get<DuidIaidTypeIndexTag>();
     // Try to get the lease using the DUID, IAID and lease type.
     std::pair<Lease6StorageDuidIaidTypeIndex::const_iterator,
               Lease6StorageDuidIaidTypeIndex::const_iterator> l =
-        idx.equal_range(boost::make_tuple(duid.getDuid(), iaid, type));
+        idx.equal_range(boost::tuple<const std::vector<uint8_t>&, uint32_t,
+                                     Lease::Type>(duid.getDuid(), iaid, type));
     Lease6Collection collection;
     for(Lease6StorageDuidIaidTypeIndex::const_iterator lease =
             l.first; lease != l.second; ++lease) {
@@ -783,12 +1229,15 @@ Memfile_LeaseMgr::getLeases6(Lease::Type type,
         .arg(duid.toText())
         .arg(Lease::typeToText(type));
 
+    Mutex::Locker lock(mutex_);
+
     // Get the index by DUID, IAID, lease type.
     const Lease6StorageDuidIaidTypeIndex& idx = storage6_.get<DuidIaidTypeIndexTag>();
     // Try to get the lease using the DUID, IAID and lease type.
     std::pair<Lease6StorageDuidIaidTypeIndex::const_iterator,
               Lease6StorageDuidIaidTypeIndex::const_iterator> l =
-        idx.equal_range(boost::make_tuple(duid.getDuid(), iaid, type));
+        idx.equal_range(boost::tuple<const std::vector<uint8_t>&, uint32_t,
+                                     Lease::Type>(duid.getDuid(), iaid, type));
     Lease6Collection collection;
     for(Lease6StorageDuidIaidTypeIndex::const_iterator lease =
             l.first; lease != l.second; ++lease) {
@@ -801,37 +1250,104 @@ Memfile_LeaseMgr::getLeases6(Lease::Type type,
     return (collection);
 }
 
-void
-Memfile_LeaseMgr::getExpiredLeases6(Lease6Collection& expired_leases,
-                                    const size_t max_leases) const {
-    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MEMFILE_GET_EXPIRED6)
-        .arg(max_leases);
+Lease6Collection
+Memfile_LeaseMgr::getLeases6(SubnetID subnet_id) const {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_MEMFILE_GET_SUBID6).arg(subnet_id);
 
-    // Obtain the index which segragates leases by state and time.
-    const Lease6StorageExpirationIndex& index = storage6_.get<ExpirationIndexTag>();
+    Mutex::Locker lock(mutex_);
 
-    // Retrieve leases which are not reclaimed and which haven't expired. The
-    // 'less-than' operator will be used for both components of the index. So,
-    // for the 'state' 'false' is less than 'true'. Also the leases with
-    // expiration time lower than current time will be returned.
-    Lease6StorageExpirationIndex::const_iterator ub =
-        index.upper_bound(boost::make_tuple(false, time(NULL)));
+    // Get the index by subnet id.
+    const Lease6StorageSubnetIdIndex& idx = storage6_.get<SubnetIdIndexTag>();
+    std::pair<Lease6StorageSubnetIdIndex::const_iterator,
+              Lease6StorageSubnetIdIndex::const_iterator> l =
+        idx.equal_range(subnet_id);
 
-    // Copy only the number of leases indicated by the max_leases parameter.
-    for (Lease6StorageExpirationIndex::const_iterator lease = index.begin();
-         (lease != ub) && ((max_leases == 0) || (std::distance(index.begin(), lease) <
-                                                 max_leases));
-         ++lease) {
-        expired_leases.push_back(Lease6Ptr(new Lease6(**lease)));
+    Lease6Collection collection;
+    for (Lease6StorageSubnetIdIndex::const_iterator lease = l.first;
+         lease != l.second; ++lease) {
+        collection.push_back(Lease6Ptr(new Lease6(**lease)));
     }
+
+    return (collection);
 }
 
-void
-Memfile_LeaseMgr::getExpiredLeases4(Lease4Collection& expired_leases,
-                                    const size_t max_leases) const {
-    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MEMFILE_GET_EXPIRED4)
+Lease6Collection
+Memfile_LeaseMgr::getLeases6() const {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MEMFILE_GET6);
+
+    Mutex::Locker lock(mutex_);
+
+    Lease6Collection collection;
+    collection.reserve(storage6_.size());
+    for (Lease6Storage::const_iterator lease = storage6_.begin();
+         lease != storage6_.end(); ++lease) {
+        collection.push_back(Lease6Ptr(new Lease6(**lease)));
+    }
+
+    return (collection);
+}
+
+Lease6Collection
+Memfile_LeaseMgr::getLeases6(const asiolink::IOAddress& lower_bound_address,
+                             const LeasePageSize& page_size) const {
+    // Expecting IPv6 address.
+    if (!lower_bound_address.isV6()) {
+        isc_throw(InvalidParameter, "expected IPv6 address while "
+                  "retrieving leases from the lease database, got "
+                  << lower_bound_address);
+    }
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MEMFILE_GET_PAGE6)
+        .arg(page_size.page_size_)
+        .arg(lower_bound_address.toText());
+
+    Mutex::Locker lock(mutex_);
+
+    return (getLeasePage<Lease6>(storage6_, lower_bound_address,
+                                 page_size.page_size_));
+}
+
+void
+Memfile_LeaseMgr::getExpiredLeases6(Lease6Collection& expired_leases,
+                                    const size_t max_leases) const {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MEMFILE_GET_EXPIRED6)
+        .arg(max_leases);
+
+    Mutex::Locker lock(mutex_);
+
+    // Obtain the index which segragates leases by state and time.
+    const Lease6StorageExpirationIndex& index = storage6_.get<ExpirationIndexTag>();
+
+    // Retrieve leases which are not reclaimed and which haven't expired. The
+    // 'less-than' operator will be used for both components of the index. So,
+    // for the 'state' 'false' is less than 'true'. Also the leases with
+    // expiration time lower than current time will be returned.
+    Lease6StorageExpirationIndex::const_iterator ub =
+        index.upper_bound(boost::make_tuple(false, time(NULL)));
+
+    // Copy only the number of leases indicated by the max_leases parameter.
+    for (Lease6StorageExpirationIndex::const_iterator lease = index.begin();
+         (lease != ub) && ((max_leases == 0) || (std::distance(index.begin(), lease) <
+                                                 max_leases));
+         ++lease) {
+        expired_leases.push_back(Lease6Ptr(new Lease6(**lease)));
+    }
+}
+
+void
+Memfile_LeaseMgr::getExpiredLeases4(Lease4Collection& expired_leases,
+                                    const size_t max_leases) const {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MEMFILE_GET_EXPIRED4)
         .arg(max_leases);
 
+    Mutex::Locker lock(mutex_);
+
+    if (packed4_) {
+        packed4_->getExpired(expired_leases, max_leases);
+        return;
+    }
+
     // Obtain the index which segragates leases by state and time.
     const Lease4StorageExpirationIndex& index = storage4_.get<ExpirationIndexTag>();
 
@@ -853,9 +1369,43 @@ Memfile_LeaseMgr::getExpiredLeases4(Lease4Collection& expired_leases,
 
 void
 Memfile_LeaseMgr::updateLease4(const Lease4Ptr& lease) {
+    StageTimer timer(ProcessingLatency::STAGE_LEASE_WRITE);
+
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_UPDATE_ADDR4).arg(lease->addr_.toText());
 
+    GroupCommitWriterPtr writer;
+    uint64_t sequence = 0;
+    LeaseChanges changes;
+    {
+        Mutex::Locker lock(mutex_);
+        updateLease4Internal(lease, recordChanges(changes));
+        writer = getGroupCommit(sequence);
+    }
+    waitGroupCommit(writer, sequence, changes);
+}
+
+void
+Memfile_LeaseMgr::updateLease4Internal(const Lease4Ptr& lease,
+                                       LeaseChanges* changes) {
+    if (packed4_) {
+        PackedLease4Storage::iterator lease_it = packed4_->find(lease->addr_);
+        if (lease_it == packed4_->end()) {
+            isc_throw(NoSuchLease, "failed to update the lease with address "
+                      << lease->addr_ << " - no such lease");
+        }
+        if (persistLeases(V4)) {
+            lease_file4_->append(*lease);
+        }
+        if (changes) {
+            changes->push_back(LeaseChange(lease->addr_,
+                                           packed4_->materialize(*lease_it),
+                                           Lease4Ptr(new Lease4(*lease))));
+        }
+        packed4_->replace(lease_it, lease);
+        return;
+    }
+
     // Obtain 'by address' index.
     Lease4StorageAddressIndex& index = storage4_.get<AddressIndexTag>();
 
@@ -866,22 +1416,44 @@ Memfile_LeaseMgr::updateLease4(const Lease4Ptr& lease) {
                   << lease->addr_ << " - no such lease");
     }
 
-    // Try to write a lease to disk first. If this fails, the lease will
-    // not be inserted to the memory and the disk and in-memory data will
-    // remain consistent.
+    // Write the lease to disk first. If this fails, the lease will not be
+    // inserted to the memory and the disk and in-memory data will remain
+    // consistent. With the group commit the row is only queued here and
+    // the caller undoes the change if the group can't be written.
     if (persistLeases(V4)) {
         lease_file4_->append(*lease);
     }
 
+    Lease4Ptr stored(new Lease4(*lease));
+    if (changes) {
+        changes->push_back(LeaseChange(lease->addr_, *lease_it, stored));
+    }
+
     // Use replace() to re-index leases.
-    index.replace(lease_it, Lease4Ptr(new Lease4(*lease)));
+    index.replace(lease_it, stored);
 }
 
 void
 Memfile_LeaseMgr::updateLease6(const Lease6Ptr& lease) {
+    StageTimer timer(ProcessingLatency::STAGE_LEASE_WRITE);
+
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_UPDATE_ADDR6).arg(lease->addr_.toText());
 
+    GroupCommitWriterPtr writer;
+    uint64_t sequence = 0;
+    LeaseChanges changes;
+    {
+        Mutex::Locker lock(mutex_);
+        updateLease6Internal(lease, recordChanges(changes));
+        writer = getGroupCommit(sequence);
+    }
+    waitGroupCommit(writer, sequence, changes);
+}
+
+void
+Memfile_LeaseMgr::updateLease6Internal(const Lease6Ptr& lease,
+                                       LeaseChanges* changes) {
     // Obtain 'by address' index.
     Lease6StorageAddressIndex& index = storage6_.get<AddressIndexTag>();
 
@@ -892,22 +1464,276 @@ Memfile_LeaseMgr::updateLease6(const Lease6Ptr& lease) {
                   << lease->addr_ << " - no such lease");
     }
 
-    // Try to write a lease to disk first. If this fails, the lease will
-    // not be inserted to the memory and the disk and in-memory data will
-    // remain consistent.
+    // Write the lease to disk first. If this fails, the lease will not be
+    // inserted to the memory and the disk and in-memory data will remain
+    // consistent. With the group commit the row is only queued here and
+    // the caller undoes the change if the group can't be written.
     if (persistLeases(V6)) {
         lease_file6_->append(*lease);
     }
 
+    Lease6Ptr stored(new Lease6(*lease));
+    if (changes) {
+        changes->push_back(LeaseChange(lease->addr_, *lease_it, stored));
+    }
+
     // Use replace() to re-index leases.
-    index.replace(lease_it, Lease6Ptr(new Lease6(*lease)));
+    index.replace(lease_it, stored);
 }
 
 bool
 Memfile_LeaseMgr::deleteLease(const isc::asiolink::IOAddress& addr) {
+    StageTimer timer(ProcessingLatency::STAGE_LEASE_WRITE);
+
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_DELETE_ADDR).arg(addr.toText());
-    if (addr.isV4()) {
+
+    bool deleted = false;
+    GroupCommitWriterPtr writer;
+    uint64_t sequence = 0;
+    LeaseChanges changes;
+    {
+        Mutex::Locker lock(mutex_);
+        deleted = deleteLeaseInternal(addr, recordChanges(changes));
+        writer = getGroupCommit(sequence);
+    }
+    waitGroupCommit(writer, sequence, changes);
+    return (deleted);
+}
+
+void
+Memfile_LeaseMgr::reclaimLeases4(const Lease4Collection& updated,
+                                 const Lease4Collection& removed) {
+    StageTimer timer(ProcessingLatency::STAGE_LEASE_WRITE);
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_MEMFILE_RECLAIM_LEASES4)
+        .arg(updated.size())
+        .arg(removed.size());
+
+    GroupCommitWriterPtr writer;
+    uint64_t sequence = 0;
+    LeaseChanges changes;
+    {
+        Mutex::Locker lock(mutex_);
+        for (Lease4Collection::const_iterator lease = updated.begin();
+             lease != updated.end(); ++lease) {
+            updateLease4Internal(*lease, recordChanges(changes));
+        }
+        for (Lease4Collection::const_iterator lease = removed.begin();
+             lease != removed.end(); ++lease) {
+            deleteLeaseInternal((*lease)->addr_, recordChanges(changes));
+        }
+        writer = getGroupCommit(sequence);
+    }
+    waitGroupCommit(writer, sequence, changes);
+}
+
+void
+Memfile_LeaseMgr::reclaimLeases6(const Lease6Collection& updated,
+                                 const Lease6Collection& removed) {
+    StageTimer timer(ProcessingLatency::STAGE_LEASE_WRITE);
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_MEMFILE_RECLAIM_LEASES6)
+        .arg(updated.size())
+        .arg(removed.size());
+
+    GroupCommitWriterPtr writer;
+    uint64_t sequence = 0;
+    LeaseChanges changes;
+    {
+        Mutex::Locker lock(mutex_);
+        for (Lease6Collection::const_iterator lease = updated.begin();
+             lease != updated.end(); ++lease) {
+            updateLease6Internal(*lease, recordChanges(changes));
+        }
+        for (Lease6Collection::const_iterator lease = removed.begin();
+             lease != removed.end(); ++lease) {
+            deleteLeaseInternal((*lease)->addr_, recordChanges(changes));
+        }
+        writer = getGroupCommit(sequence);
+    }
+    waitGroupCommit(writer, sequence, changes);
+}
+
+void
+Memfile_LeaseMgr::applyLeases4(const Lease4Collection& leases) {
+    StageTimer timer(ProcessingLatency::STAGE_LEASE_WRITE);
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_MEMFILE_APPLY_LEASES4).arg(leases.size());
+
+    GroupCommitWriterPtr writer;
+    uint64_t sequence = 0;
+    LeaseChanges changes;
+    {
+        Mutex::Locker lock(mutex_);
+        for (Lease4Collection::const_iterator lease = leases.begin();
+             lease != leases.end(); ++lease) {
+            if (!addLeaseInternal(*lease, recordChanges(changes))) {
+                updateLease4Internal(*lease, recordChanges(changes));
+            }
+        }
+        writer = getGroupCommit(sequence);
+    }
+    waitGroupCommit(writer, sequence, changes);
+}
+
+void
+Memfile_LeaseMgr::applyLeases6(const Lease6Collection& leases) {
+    StageTimer timer(ProcessingLatency::STAGE_LEASE_WRITE);
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_MEMFILE_APPLY_LEASES6).arg(leases.size());
+
+    GroupCommitWriterPtr writer;
+    uint64_t sequence = 0;
+    LeaseChanges changes;
+    {
+        Mutex::Locker lock(mutex_);
+        for (Lease6Collection::const_iterator lease = leases.begin();
+             lease != leases.end(); ++lease) {
+            if (!addLeaseInternal(*lease, recordChanges(changes))) {
+                updateLease6Internal(*lease, recordChanges(changes));
+            }
+        }
+        writer = getGroupCommit(sequence);
+    }
+    waitGroupCommit(writer, sequence, changes);
+}
+
+GroupCommitWriterPtr
+Memfile_LeaseMgr::getGroupCommit(uint64_t& sequence) const {
+    if (group_commit_) {
+        sequence = group_commit_->getLastSequence();
+    }
+    return (group_commit_);
+}
+
+Memfile_LeaseMgr::LeaseChanges*
+Memfile_LeaseMgr::recordChanges(LeaseChanges& changes) const {
+    return (group_commit_ ? &changes : 0);
+}
+
+void
+Memfile_LeaseMgr::waitGroupCommit(const GroupCommitWriterPtr& writer,
+                                  const uint64_t sequence,
+                                  const LeaseChanges& changes) {
+    if (!writer) {
+        return;
+    }
+
+    try {
+        writer->waitDurable(sequence);
+
+    } catch (...) {
+        // The rows never reached the lease file, so the in-memory changes
+        // are undone to keep the memory consistent with the file.
+        Mutex::Locker lock(mutex_);
+        for (LeaseChanges::const_reverse_iterator change = changes.rbegin();
+             change != changes.rend(); ++change) {
+            if (change->addr_.isV4()) {
+                undoLease4Change(*change);
+            } else {
+                undoLease6Change(*change);
+            }
+        }
+        throw;
+    }
+}
+
+void
+Memfile_LeaseMgr::undoLease4Change(const LeaseChange& change) {
+    Lease4Ptr old_lease =
+        boost::dynamic_pointer_cast<Lease4>(change.old_lease_);
+    Lease4Ptr new_lease =
+        boost::dynamic_pointer_cast<Lease4>(change.new_lease_);
+
+    if (packed4_) {
+        PackedLease4Storage::iterator l = packed4_->find(change.addr_);
+        Lease4Ptr current;
+        if (l != packed4_->end()) {
+            current = packed4_->materialize(*l);
+        }
+        // Leave the lease alone if it has been changed again since.
+        if (!sameLease(current, new_lease)) {
+            return;
+        }
+        if (!old_lease) {
+            packed4_->erase(l);
+        } else if (current) {
+            packed4_->replace(l, old_lease);
+        } else {
+            packed4_->insert(old_lease);
+        }
+        return;
+    }
+
+    Lease4Storage::iterator l = storage4_.find(change.addr_);
+    Lease4Ptr current;
+    if (l != storage4_.end()) {
+        current = *l;
+    }
+    // Leave the lease alone if it has been changed again since.
+    if (!sameLease(current, new_lease)) {
+        return;
+    }
+    if (!old_lease) {
+        storage4_.erase(l);
+    } else if (current) {
+        storage4_.replace(l, old_lease);
+    } else {
+        storage4_.insert(old_lease);
+    }
+}
+
+void
+Memfile_LeaseMgr::undoLease6Change(const LeaseChange& change) {
+    Lease6Ptr old_lease =
+        boost::dynamic_pointer_cast<Lease6>(change.old_lease_);
+    Lease6Ptr new_lease =
+        boost::dynamic_pointer_cast<Lease6>(change.new_lease_);
+
+    Lease6Storage::iterator l = storage6_.find(change.addr_);
+    Lease6Ptr current;
+    if (l != storage6_.end()) {
+        current = *l;
+    }
+    // Leave the lease alone if it has been changed again since.
+    if (!sameLease(current, new_lease)) {
+        return;
+    }
+    if (!old_lease) {
+        storage6_.erase(l);
+    } else if (current) {
+        storage6_.replace(l, old_lease);
+    } else {
+        storage6_.insert(old_lease);
+    }
+}
+
+bool
+Memfile_LeaseMgr::deleteLeaseInternal(const isc::asiolink::IOAddress& addr,
+                                      LeaseChanges* changes) {
+    if (addr.isV4() && packed4_) {
+        PackedLease4Storage::iterator l = packed4_->find(addr);
+        if (l == packed4_->end()) {
+            return (false);
+        }
+        if (persistLeases(V4)) {
+            Lease4Ptr lease_copy = packed4_->materialize(*l);
+            lease_copy->valid_lft_ = 0;
+            lease_file4_->append(*lease_copy);
+        }
+        if (changes) {
+            changes->push_back(LeaseChange(addr, packed4_->materialize(*l),
+                                           Lease4Ptr()));
+        }
+        packed4_->erase(l);
+        return (true);
+
+    } else if (addr.isV4()) {
         // v4 lease
         Lease4Storage::iterator l = storage4_.find(addr);
         if (l == storage4_.end()) {
@@ -923,6 +1749,9 @@ Memfile_LeaseMgr::deleteLease(const isc::asiolink::IOAddress& addr) {
                 lease_copy.valid_lft_ = 0;
                 lease_file4_->append(lease_copy);
             }
+            if (changes) {
+                changes->push_back(LeaseChange(addr, *l, Lease4Ptr()));
+            }
             storage4_.erase(l);
             return (true);
         }
@@ -944,6 +1773,9 @@ Memfile_LeaseMgr::deleteLease(const isc::asiolink::IOAddress& addr) {
                 lease_file6_->append(lease_copy);
             }
 
+            if (changes) {
+                changes->push_back(LeaseChange(addr, *l, Lease6Ptr()));
+            }
             storage6_.erase(l);
             return (true);
         }
@@ -955,6 +1787,29 @@ Memfile_LeaseMgr::deleteExpiredReclaimedLeases4(const uint32_t secs) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_DELETE_EXPIRED_RECLAIMED4)
         .arg(secs);
+
+    Mutex::Locker lock(mutex_);
+
+    if (packed4_) {
+        Lease4Collection removed;
+        packed4_->eraseExpiredReclaimed(secs, removed);
+        if (!removed.empty()) {
+            LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+                      DHCPSRV_MEMFILE_DELETE_EXPIRED_RECLAIMED_START)
+                .arg(removed.size());
+        }
+        if (persistLeases(V4)) {
+            for (Lease4Collection::const_iterator lease = removed.begin();
+                 lease != removed.end(); ++lease) {
+                // Set the valid lifetime to 0 to indicate the removal
+                // of the lease.
+                (*lease)->valid_lft_ = 0;
+                lease_file4_->append(**lease);
+            }
+        }
+        return (static_cast<uint64_t>(removed.size()));
+    }
+
     return (deleteExpiredReclaimedLeases<
             Lease4StorageExpirationIndex, Lease4
             >(secs, V4, storage4_, lease_file4_));
@@ -965,6 +1820,8 @@ Memfile_LeaseMgr::deleteExpiredReclaimedLeases6(const uint32_t secs) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_DELETE_EXPIRED_RECLAIMED6)
         .arg(secs);
+
+    Mutex::Locker lock(mutex_);
     return (deleteExpiredReclaimedLeases<
             Lease6StorageExpirationIndex, Lease6
             >(secs, V6, storage6_, lease_file6_));
@@ -1107,6 +1964,124 @@ Memfile_LeaseMgr::persistLeases(Universe u) const {
     return (u == V6 && lease_file6_);
 }
 
+bool
+Memfile_LeaseMgr::usePackedStorage() const {
+    std::string packed_val;
+    try {
+        packed_val = conn_.getParameter("packed");
+    } catch (const Exception&) {
+        // The leases are not packed by default.
+        return (false);
+    }
+
+    if ((packed_val != "true") && (packed_val != "false")) {
+        isc_throw(isc::BadValue, "invalid value 'packed="
+                  << packed_val << "'");
+    }
+    return (packed_val == "true");
+}
+
+GroupCommitWriterPtr
+Memfile_LeaseMgr::createGroupCommitWriter() const {
+    std::string enabled = "false";
+    try {
+        enabled = conn_.getParameter("group-commit");
+    } catch (const Exception&) {
+        // The group commit is disabled by default.
+    }
+    if ((enabled != "true") && (enabled != "false")) {
+        isc_throw(isc::BadValue, "invalid value 'group-commit="
+                  << enabled << "'");
+    }
+    if (enabled == "false") {
+        return (GroupCommitWriterPtr());
+    }
+
+    std::string max_batch_str = "256";
+    try {
+        max_batch_str = conn_.getParameter("group-commit-max-batch");
+    } catch (const Exception&) {
+        // Ignore and use the default.
+    }
+    // The lexical_cast accepts negative values for unsigned types, so
+    // the values are converted to signed integers and checked.
+    int64_t max_batch = 0;
+    try {
+        max_batch = boost::lexical_cast<int64_t>(max_batch_str);
+    } catch (const boost::bad_lexical_cast&) {
+        isc_throw(isc::BadValue, "invalid value of the group-commit-max-batch "
+                  << max_batch_str << " specified");
+    }
+    if ((max_batch < 1) ||
+        (max_batch > std::numeric_limits<uint32_t>::max())) {
+        isc_throw(isc::BadValue, "group-commit-max-batch value "
+                  << max_batch << " is out of range");
+    }
+
+    std::string max_latency_str = "0";
+    try {
+        max_latency_str = conn_.getParameter("group-commit-max-latency");
+    } catch (const Exception&) {
+        // Ignore and use the default.
+    }
+    int64_t max_latency = 0;
+    try {
+        max_latency = boost::lexical_cast<int64_t>(max_latency_str);
+    } catch (const boost::bad_lexical_cast&) {
+        isc_throw(isc::BadValue, "invalid value of the group-commit-max-latency "
+                  << max_latency_str << " specified");
+    }
+    if ((max_latency < 0) ||
+        (max_latency > std::numeric_limits<uint32_t>::max())) {
+        isc_throw(isc::BadValue, "group-commit-max-latency value "
+                  << max_latency << " is out of range");
+    }
+
+    std::string sync = "false";
+    try {
+        sync = conn_.getParameter("group-commit-sync");
+    } catch (const Exception&) {
+        // The groups are not synchronized with the storage by default.
+    }
+    if ((sync != "true") && (sync != "false")) {
+        isc_throw(isc::BadValue, "invalid value 'group-commit-sync="
+                  << sync << "'");
+    }
+
+    return (GroupCommitWriterPtr(new GroupCommitWriter(static_cast<size_t>(max_batch),
+                                                       static_cast<uint32_t>(max_latency),
+                                                       sync == "true")));
+}
+
+size_t
+Memfile_LeaseMgr::getLoadThreads() const {
+    std::string threads_str = "0";
+    try {
+        threads_str = conn_.getParameter("load-threads");
+    } catch (const Exception&) {
+        // Ignore and use the default.
+    }
+    int64_t threads = 0;
+    try {
+        threads = boost::lexical_cast<int64_t>(threads_str);
+    } catch (const boost::bad_lexical_cast&) {
+        isc_throw(isc::BadValue, "invalid value of the load-threads "
+                  << threads_str << " specified");
+    }
+    if ((threads < 0) ||
+        (threads > std::numeric_limits<uint32_t>::max())) {
+        isc_throw(isc::BadValue, "load-threads value "
+                  << threads << " is out of range");
+    }
+
+    // Use all available processors by default.
+    if (threads == 0) {
+        const long processors = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (processors > 0 ? processors : 1);
+    }
+    return (static_cast<size_t>(threads));
+}
+
 std::string
 Memfile_LeaseMgr::initLeaseFilePath(Universe u) {
     std::string persist_val;
@@ -1136,7 +2111,8 @@ Memfile_LeaseMgr::initLeaseFilePath(Universe u) {
     return (lease_file);
 }
 
-template<typename LeaseObjectType, typename LeaseFileType, typename StorageType>
+template<typename LeaseObjectType, typename LeaseFileType,
+         typename SnapshotFileType, typename StorageType>
 bool Memfile_LeaseMgr::loadLeasesFromFiles(const std::string& filename,
                                            boost::shared_ptr<LeaseFileType>& lease_file,
                                            StorageType& storage) {
@@ -1154,27 +2130,38 @@ bool Memfile_LeaseMgr::loadLeasesFromFiles(const std::string& filename,
 
     storage.clear();
 
+    const size_t threads = getLoadThreads();
+
     // Load the leasefile.completed, if exists.
     bool conversion_needed = false;
-    lease_file.reset(new LeaseFileType(std::string(filename + ".completed")));
-    if (lease_file->exists()) {
-        LeaseFileLoader::load<LeaseObjectType>(*lease_file, storage,
+    const std::string finish = appendSuffix(filename, FILE_FINISH);
+    lease_file.reset(new LeaseFileType(finish));
+    if (BinaryLeaseFile::isBinary(finish)) {
+        SnapshotFileType snapshot_file(finish);
+        LeaseFileLoader::load<LeaseObjectType>(snapshot_file, storage,
                                                MAX_LEASE_ERRORS);
+
+    } else if (lease_file->exists()) {
+        loadLeaseFile<LeaseObjectType>(*lease_file, storage, threads);
         conversion_needed = conversion_needed || lease_file->needsConversion();
     } else {
         // If the leasefile.completed doesn't exist, let's load the leases
         // from leasefile.2 and leasefile.1, if they exist.
-        lease_file.reset(new LeaseFileType(appendSuffix(filename, FILE_PREVIOUS)));
-        if (lease_file->exists()) {
-            LeaseFileLoader::load<LeaseObjectType>(*lease_file, storage,
+        const std::string previous = appendSuffix(filename, FILE_PREVIOUS);
+        lease_file.reset(new LeaseFileType(previous));
+        if (BinaryLeaseFile::isBinary(previous)) {
+            SnapshotFileType snapshot_file(previous);
+            LeaseFileLoader::load<LeaseObjectType>(snapshot_file, storage,
                                                    MAX_LEASE_ERRORS);
+
+        } else if (lease_file->exists()) {
+            loadLeaseFile<LeaseObjectType>(*lease_file, storage, threads);
             conversion_needed =  conversion_needed || lease_file->needsConversion();
         }
 
         lease_file.reset(new LeaseFileType(appendSuffix(filename, FILE_INPUT)));
         if (lease_file->exists()) {
-            LeaseFileLoader::load<LeaseObjectType>(*lease_file, storage,
-                                                   MAX_LEASE_ERRORS);
+            loadLeaseFile<LeaseObjectType>(*lease_file, storage, threads);
             conversion_needed =  conversion_needed || lease_file->needsConversion();
         }
     }
@@ -1186,8 +2173,7 @@ bool Memfile_LeaseMgr::loadLeasesFromFiles(const std::string& filename,
     // it is parsed. This file will be used by the backend to record
     // future lease updates.
     lease_file.reset(new LeaseFileType(filename));
-    LeaseFileLoader::load<LeaseObjectType>(*lease_file, storage,
-                                           MAX_LEASE_ERRORS, false);
+    loadLeaseFile<LeaseObjectType>(*lease_file, storage, threads, false);
     conversion_needed =  conversion_needed || lease_file->needsConversion();
 
     return (conversion_needed);
@@ -1196,11 +2182,19 @@ bool Memfile_LeaseMgr::loadLeasesFromFiles(const std::string& filename,
 
 bool
 Memfile_LeaseMgr::isLFCRunning() const {
+    if (lfc_in_process_) {
+        Mutex::Locker lock(mutex_);
+        return (lfc_running_);
+    }
     return (lfc_setup_->isRunning());
 }
 
 int
 Memfile_LeaseMgr::getLFCExitStatus() const {
+    if (lfc_in_process_) {
+        Mutex::Locker lock(mutex_);
+        return (lfc_exit_status_);
+    }
     return (lfc_setup_->getExitStatus());
 }
 
@@ -1208,6 +2202,9 @@ void
 Memfile_LeaseMgr::lfcCallback() {
     LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_LFC_START);
 
+    // Lease file rotation must not interleave with lease updates.
+    Mutex::Locker lock(mutex_);
+
     // Check if we're in the v4 or v6 space and use the appropriate file.
     if (lease_file4_) {
         lfcExecute(lease_file4_);
@@ -1234,9 +2231,79 @@ Memfile_LeaseMgr::lfcSetup(bool conversion_needed) {
                   << lfc_interval_str << " specified");
     }
 
+    std::string in_process = "false";
+    try {
+        in_process = conn_.getParameter("lfc-in-process");
+    } catch (const std::exception&) {
+        // The kea-lfc is used by default.
+    }
+    if ((in_process != "true") && (in_process != "false")) {
+        isc_throw(isc::BadValue, "invalid value 'lfc-in-process="
+                  << in_process << "'");
+    }
+    lfc_in_process_ = (in_process == "true");
+
+    std::string batch_size_str = "1000";
+    try {
+        batch_size_str = conn_.getParameter("lfc-batch-size");
+    } catch (const std::exception&) {
+        // Ignore and use the default.
+    }
+    int64_t batch_size = 0;
+    try {
+        batch_size = boost::lexical_cast<int64_t>(batch_size_str);
+    } catch (const boost::bad_lexical_cast&) {
+        isc_throw(isc::BadValue, "invalid value of the lfc-batch-size "
+                  << batch_size_str << " specified");
+    }
+    if ((batch_size < 1) ||
+        (batch_size > std::numeric_limits<uint32_t>::max())) {
+        isc_throw(isc::BadValue, "lfc-batch-size value "
+                  << batch_size << " is out of range");
+    }
+    lfc_batch_size_ = static_cast<uint32_t>(batch_size);
+
+    std::string batch_interval_str = "0";
+    try {
+        batch_interval_str = conn_.getParameter("lfc-batch-interval");
+    } catch (const std::exception&) {
+        // Ignore and use the default.
+    }
+    int64_t batch_interval = 0;
+    try {
+        batch_interval = boost::lexical_cast<int64_t>(batch_interval_str);
+    } catch (const boost::bad_lexical_cast&) {
+        isc_throw(isc::BadValue, "invalid value of the lfc-batch-interval "
+                  << batch_interval_str << " specified");
+    }
+    if ((batch_interval < 0) ||
+        (batch_interval > std::numeric_limits<uint32_t>::max())) {
+        isc_throw(isc::BadValue, "lfc-batch-interval value "
+                  << batch_interval << " is out of range");
+    }
+    lfc_batch_interval_ = static_cast<uint32_t>(batch_interval);
+
+    std::string snapshot_format = "csv";
+    try {
+        snapshot_format = conn_.getParameter("lfc-snapshot-format");
+    } catch (const std::exception&) {
+        // The CSV format is used by default.
+    }
+    if ((snapshot_format != "csv") && (snapshot_format != "binary")) {
+        isc_throw(isc::BadValue, "invalid value 'lfc-snapshot-format="
+                  << snapshot_format << "'");
+    }
+    lfc_snapshot_binary_ = (snapshot_format == "binary");
+    // The kea-lfc can only read and write the CSV files.
+    if (lfc_snapshot_binary_ && !lfc_in_process_ && (lfc_interval > 0)) {
+        isc_throw(isc::BadValue, "lfc-snapshot-format=binary requires"
+                  " lfc-in-process=true");
+    }
+
     if (lfc_interval > 0 || conversion_needed) {
         lfc_setup_.reset(new LFCSetup(boost::bind(&Memfile_LeaseMgr::lfcCallback, this)));
-        lfc_setup_->setup(lfc_interval, lease_file4_, lease_file6_, conversion_needed);
+        lfc_setup_->setup(lfc_interval, lease_file4_, lease_file6_, conversion_needed,
+                          lfc_in_process_);
     }
 }
 
@@ -1296,45 +2363,301 @@ void Memfile_LeaseMgr::lfcExecute(boost::shared_ptr<LeaseFileType>& lease_file)
     // Once the files have been rotated, or untouched if another LFC had
     // not finished, a new process is started.
     if (do_lfc) {
-        lfc_setup_->execute();
+        if (lfc_in_process_ && lfc_running_) {
+            LOG_WARN(dhcpsrv_logger, DHCPSRV_MEMFILE_LFC_IN_PROCESS_BUSY);
+
+        } else if (lfc_in_process_) {
+            lfcStartInProcess(*lease_file);
+
+        } else {
+            lfc_setup_->execute();
+        }
+    }
+}
+
+void
+Memfile_LeaseMgr::lfcStartInProcess(const CSVLeaseFile4& lease_file) {
+    boost::shared_ptr<std::vector<IOAddress> >
+        addresses(new std::vector<IOAddress>());
+    if (packed4_) {
+        packed4_->getAddresses(*addresses);
+
+    } else {
+        addresses->reserve(storage4_.size());
+        for (Lease4Storage::const_iterator lease = storage4_.begin();
+             lease != storage4_.end(); ++lease) {
+            addresses->push_back((*lease)->addr_);
+        }
+    }
+    if (lfc_snapshot_binary_) {
+        lfcStartThread(boost::bind(&Memfile_LeaseMgr::lfcInProcess<Lease4,
+                                                                   BinaryLeaseFile4>,
+                                   this, lease_file.getFilename(), addresses));
+    } else {
+        lfcStartThread(boost::bind(&Memfile_LeaseMgr::lfcInProcess<Lease4,
+                                                                   CSVLeaseFile4>,
+                                   this, lease_file.getFilename(), addresses));
+    }
+}
+
+void
+Memfile_LeaseMgr::lfcStartInProcess(const CSVLeaseFile6& lease_file) {
+    boost::shared_ptr<std::vector<IOAddress> >
+        addresses(new std::vector<IOAddress>());
+    addresses->reserve(storage6_.size());
+    for (Lease6Storage::const_iterator lease = storage6_.begin();
+         lease != storage6_.end(); ++lease) {
+        addresses->push_back((*lease)->addr_);
+    }
+    if (lfc_snapshot_binary_) {
+        lfcStartThread(boost::bind(&Memfile_LeaseMgr::lfcInProcess<Lease6,
+                                                                   BinaryLeaseFile6>,
+                                   this, lease_file.getFilename(), addresses));
+    } else {
+        lfcStartThread(boost::bind(&Memfile_LeaseMgr::lfcInProcess<Lease6,
+                                                                   CSVLeaseFile6>,
+                                   this, lease_file.getFilename(), addresses));
     }
 }
 
+void
+Memfile_LeaseMgr::lfcStartThread(const boost::function<void()>& compaction) {
+    // The previous thread has finished, but it must be joined.
+    if (lfc_thread_) {
+        try {
+            lfc_thread_->wait();
+        } catch (...) {
+            // The errors are logged by the thread.
+        }
+        lfc_thread_.reset();
+    }
+
+    lfc_running_ = true;
+    lfc_stop_ = false;
+    try {
+        lfc_thread_.reset(new Thread(compaction));
+
+    } catch (const std::exception& ex) {
+        lfc_running_ = false;
+        lfc_exit_status_ = 1;
+        LOG_ERROR(dhcpsrv_logger, DHCPSRV_MEMFILE_LFC_IN_PROCESS_FAILED)
+            .arg(ex.what());
+    }
+}
+
+template<typename LeaseObjectType, typename LeaseFileType>
+void
+Memfile_LeaseMgr::lfcInProcess(const std::string& filename,
+                               const boost::shared_ptr<std::vector<IOAddress> >& addresses) {
+    // As with the kea-lfc, the PID file prevents loading the lease files
+    // while they are being modified.
+    PIDFile pid_file(appendSuffix(filename, FILE_PID));
+    int status = 0;
+    try {
+        pid_file.write();
+
+        const std::string previous = appendSuffix(filename, FILE_PREVIOUS);
+        const std::string copy = appendSuffix(filename, FILE_INPUT);
+        const std::string output = appendSuffix(filename, FILE_OUTPUT);
+        const std::string finish = appendSuffix(filename, FILE_FINISH);
+
+        // If the finish file exists, the previous cleanup has been
+        // interrupted after writing the leases and it only has to be
+        // completed.
+        if (!CSVFile(finish).exists()) {
+            LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_LFC_IN_PROCESS_START)
+                .arg(addresses->size())
+                .arg(output);
+
+            // Write the leases ordered by address as the kea-lfc does.
+            std::sort(addresses->begin(), addresses->end());
+
+            LeaseFileType output_file(output);
+            output_file.recreate();
+            for (size_t begin = 0; begin < addresses->size();
+                 begin += lfc_batch_size_) {
+                const size_t end = std::min(addresses->size(),
+                                            begin + lfc_batch_size_);
+                std::vector<boost::shared_ptr<LeaseObjectType> > leases;
+                {
+                    Mutex::Locker lock(mutex_);
+                    // Spread the writes over time.
+                    if ((begin > 0) && (lfc_batch_interval_ > 0) && !lfc_stop_) {
+                        static_cast<void>(lfc_cond_.timedWait(mutex_,
+                                                              lfc_batch_interval_));
+                    }
+                    if (lfc_stop_) {
+                        isc_throw(InvalidOperation, "lease file cleanup has"
+                                  " been interrupted");
+                    }
+                    lfcGetLeases(*addresses, begin, end, leases);
+                }
+
+                for (typename std::vector<boost::shared_ptr<LeaseObjectType> >::const_iterator
+                         lease = leases.begin(); lease != leases.end(); ++lease) {
+                    output_file.append(**lease);
+                }
+            }
+            output_file.close();
+
+            if (rename(output.c_str(), finish.c_str()) != 0) {
+                isc_throw(CSVFileError, "unable to rename " << output
+                          << " to " << finish << ": " << strerror(errno));
+            }
+        }
+
+        // The finish file holds all leases from the previous file and the
+        // copy file, so they can be removed.
+        if ((unlink(previous.c_str()) != 0) && (errno != ENOENT)) {
+            isc_throw(CSVFileError, "unable to remove " << previous
+                      << ": " << strerror(errno));
+        }
+        if ((unlink(copy.c_str()) != 0) && (errno != ENOENT)) {
+            isc_throw(CSVFileError, "unable to remove " << copy
+                      << ": " << strerror(errno));
+        }
+        if (rename(finish.c_str(), previous.c_str()) != 0) {
+            isc_throw(CSVFileError, "unable to rename " << finish
+                      << " to " << previous << ": " << strerror(errno));
+        }
+
+        LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_LFC_IN_PROCESS_COMPLETE)
+            .arg(filename);
+
+    } catch (const std::exception& ex) {
+        LOG_ERROR(dhcpsrv_logger, DHCPSRV_MEMFILE_LFC_IN_PROCESS_FAILED)
+            .arg(ex.what());
+        status = 1;
+    }
+
+    try {
+        pid_file.deleteFile();
+    } catch (const std::exception& ex) {
+        LOG_ERROR(dhcpsrv_logger, DHCPSRV_MEMFILE_LFC_IN_PROCESS_FAILED)
+            .arg(ex.what());
+        status = 1;
+    }
+
+    Mutex::Locker lock(mutex_);
+    lfc_exit_status_ = status;
+    lfc_running_ = false;
+}
+
+void
+Memfile_LeaseMgr::lfcGetLeases(const std::vector<IOAddress>& addresses,
+                               const size_t begin, const size_t end,
+                               Lease4Collection& leases) const {
+    leases.reserve(end - begin);
+    for (size_t i = begin; i < end; ++i) {
+        if (packed4_) {
+            Lease4Ptr lease = packed4_->get(addresses[i]);
+            if (lease) {
+                leases.push_back(lease);
+            }
+
+        } else {
+            Lease4Storage::const_iterator lease = storage4_.find(addresses[i]);
+            if (lease != storage4_.end()) {
+                leases.push_back(Lease4Ptr(new Lease4(**lease)));
+            }
+        }
+    }
+}
+
+void
+Memfile_LeaseMgr::lfcGetLeases(const std::vector<IOAddress>& addresses,
+                               const size_t begin, const size_t end,
+                               Lease6Collection& leases) const {
+    leases.reserve(end - begin);
+    for (size_t i = begin; i < end; ++i) {
+        Lease6Storage::const_iterator lease = storage6_.find(addresses[i]);
+        if (lease != storage6_.end()) {
+            leases.push_back(Lease6Ptr(new Lease6(**lease)));
+        }
+    }
+}
+
+void
+Memfile_LeaseMgr::lfcStopInProcess() {
+    {
+        Mutex::Locker lock(mutex_);
+        if (!lfc_thread_) {
+            return;
+        }
+        lfc_stop_ = true;
+        lfc_cond_.signal();
+    }
+
+    try {
+        lfc_thread_->wait();
+    } catch (...) {
+        // The errors are logged by the thread.
+    }
+    lfc_thread_.reset();
+}
+
 LeaseStatsQueryPtr
 Memfile_LeaseMgr::startLeaseStatsQuery4() {
-    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery4(storage4_));
+    Mutex::Locker lock(mutex_);
+    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery4(storage4_,
+                                                         packed4_.get()));
+    query->start();
+    return(query);
+}
+
+LeaseStatsQueryPtr
+Memfile_LeaseMgr::startSubnetLeaseStatsQuery4(const SubnetIDSet& subnet_ids) {
+    Mutex::Locker lock(mutex_);
+    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery4(storage4_,
+                                                         packed4_.get(),
+                                                         &subnet_ids));
     query->start();
     return(query);
 }
 
 LeaseStatsQueryPtr
 Memfile_LeaseMgr::startLeaseStatsQuery6() {
+    Mutex::Locker lock(mutex_);
     LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery6(storage6_));
     query->start();
     return(query);
 }
 
+LeaseStatsQueryPtr
+Memfile_LeaseMgr::startSubnetLeaseStatsQuery6(const SubnetIDSet& subnet_ids) {
+    Mutex::Locker lock(mutex_);
+    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery6(storage6_,
+                                                         &subnet_ids));
+    query->start();
+    return(query);
+}
+
 size_t Memfile_LeaseMgr::wipeLeases4(const SubnetID& subnet_id) {
     LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_WIPE_LEASES4)
         .arg(subnet_id);
 
-    // Get the index by DUID, IAID, lease type.
-    const Lease4StorageSubnetIdIndex& idx = storage4_.get<SubnetIdIndexTag>();
-
-    // Try to get the lease using the DUID, IAID and lease type.
-    std::pair<Lease4StorageSubnetIdIndex::const_iterator,
-              Lease4StorageSubnetIdIndex::const_iterator> l =
-        idx.equal_range(subnet_id);
+    Mutex::Locker lock(mutex_);
 
     // Let's collect all leases.
     Lease4Collection leases;
-    for(auto lease = l.first; lease != l.second; ++lease) {
-        leases.push_back(*lease);
+    if (packed4_) {
+        leases = packed4_->getBySubnetId(subnet_id);
+
+    } else {
+        // Get the index by subnet id.
+        const Lease4StorageSubnetIdIndex& idx =
+            storage4_.get<SubnetIdIndexTag>();
+        std::pair<Lease4StorageSubnetIdIndex::const_iterator,
+                  Lease4StorageSubnetIdIndex::const_iterator> l =
+            idx.equal_range(subnet_id);
+        for(auto lease = l.first; lease != l.second; ++lease) {
+            leases.push_back(*lease);
+        }
     }
 
     size_t num = leases.size();
     for (auto l = leases.begin(); l != leases.end(); ++l) {
-        deleteLease((*l)->addr_);
+        deleteLeaseInternal((*l)->addr_);
     }
     LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_WIPE_LEASES4_FINISHED)
         .arg(subnet_id).arg(num);
@@ -1346,6 +2669,8 @@ size_t Memfile_LeaseMgr::wipeLeases6(const SubnetID& subnet_id) {
     LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_WIPE_LEASES6)
         .arg(subnet_id);
 
+    Mutex::Locker lock(mutex_);
+
     // Get the index by DUID, IAID, lease type.
     const Lease6StorageSubnetIdIndex& idx = storage6_.get<SubnetIdIndexTag>();
 
@@ -1362,7 +2687,7 @@ size_t Memfile_LeaseMgr::wipeLeases6(const SubnetID& subnet_id) {
 
     size_t num = leases.size();
     for (auto l = leases.begin(); l != leases.end(); ++l) {
-        deleteLease((*l)->addr_);
+        deleteLeaseInternal((*l)->addr_);
     }
     LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_WIPE_LEASES6_FINISHED)
         .arg(subnet_id).arg(num);
@@ -9,16 +9,24 @@
 
 #include <asiolink/interval_timer.h>
 #include <dhcp/hwaddr.h>
+#include <dhcpsrv/binary_lease_file.h>
 #include <dhcpsrv/csv_lease_file4.h>
 #include <dhcpsrv/csv_lease_file6.h>
 #include <dhcpsrv/memfile_lease_storage.h>
+#include <dhcpsrv/memfile_packed_lease_storage.h>
 #include <dhcpsrv/database_connection.h>
+#include <dhcpsrv/group_commit_writer.h>
 #include <dhcpsrv/lease_mgr.h>
 #include <util/process_spawn.h>
+#include <util/threads/sync.h>
+#include <util/threads/thread.h>
 
+#include <boost/function.hpp>
 #include <boost/scoped_ptr.hpp>
 #include <boost/shared_ptr.hpp>
 
+#include <vector>
+
 namespace isc {
 namespace dhcp {
 
@@ -60,6 +68,9 @@ class LFCSetup;
 /// removal or addition of the lease is appended to the lease file
 /// synchronously.
 ///
+/// The public methods of this backend are serialized with a mutex, so the
+/// backend can be used by the multiple packet processing threads.
+///
 /// Originally, the Memfile backend didn't write leases to disk. This was
 /// particularly useful for testing server performance in non-disk bound
 /// conditions. In order to preserve this capability, the new parameter
@@ -73,6 +84,57 @@ class LFCSetup;
 /// is not specified, the default location in the installation
 /// directory is used: var/kea/kea-leases4.csv and
 /// var/kea/kea-leases6.csv.
+///
+/// The "packed=true|false" parameter selects the representation of the
+/// DHCPv4 leases in memory. By default, the leases are held as @c Lease4
+/// objects. When this parameter is set to "true" they are held in the
+/// @c PackedLease4Storage, which uses significantly less memory per lease
+/// at the cost of creating the @c Lease4 objects when they are returned by
+/// the backend. This is beneficial for deployments with a large number of
+/// leases. The DHCPv6 leases are always held as @c Lease6 objects.
+///
+/// The "group-commit=true|false" parameter enables writing the lease file
+/// rows with the @c GroupCommitWriter. The rows appended by the concurrent
+/// lease updates are then written into the file together, which reduces
+/// the number of system calls when the leases are updated by multiple
+/// threads. The lease update returns when its row has been written.
+/// The "group-commit-max-batch" parameter specifies the maximum number of
+/// rows written at once (default 256), "group-commit-max-latency" specifies
+/// how long (in milliseconds) the writer waits for more rows (default 0)
+/// and "group-commit-sync=true|false" enables synchronizing each group with
+/// the storage (default false). If writing the group fails, the lease
+/// update throws but the lease remains updated in memory.
+///
+/// The "load-threads" parameter specifies the number of threads parsing
+/// the lease files when the backend is started. The value of 1 disables
+/// parallel parsing. The default value of 0 means the number of available
+/// processors. The lease files smaller than 1MB are always parsed by a
+/// single thread.
+///
+/// By default, the %Lease File Cleanup is performed by the @c kea-lfc
+/// program, which reads the lease files and writes the leases found in
+/// them into a new file. The "lfc-in-process=true|false" parameter enables
+/// performing the cleanup by the backend itself. The backend then writes
+/// the leases held in memory into the new file in a background thread,
+/// without reading the lease files again. The leases are written in
+/// batches of "lfc-batch-size" leases (default 1000) and the thread
+/// pauses for "lfc-batch-interval" milliseconds (default 0) after each
+/// batch, which allows for spreading the writes over time. The files
+/// produced by the in-process cleanup are the same as the files produced
+/// by the @c kea-lfc. As with the @c kea-lfc, the lease files can't be
+/// loaded, e.g. when the server is reconfigured, while the cleanup is in
+/// progress.
+///
+/// The "lfc-snapshot-format=csv|binary" parameter selects the format of
+/// the file written by the in-process cleanup (the file with the ".2"
+/// suffix). The "binary" format is described in @c BinaryLeaseFile. It is
+/// smaller and faster to load than the CSV file, but can't be read by the
+/// @c kea-lfc, so it requires "lfc-in-process=true" when the cleanup is
+/// enabled. The lease updates are always appended to the CSV lease file,
+/// which serves as a journal of the changes made after the snapshot. The
+/// backend recognizes the format of the snapshot when loading it, so the
+/// existing CSV snapshot is converted to the binary one by the next
+/// cleanup, and vice versa.
 class Memfile_LeaseMgr : public LeaseMgr {
 public:
 
@@ -157,6 +219,21 @@ public:
     /// @return a collection of leases
     virtual Lease4Ptr getLease4(const isc::asiolink::IOAddress& addr) const;
 
+    /// @brief Returns existing IPv4 lease for specified IPv4 address for
+    /// reading.
+    ///
+    /// This function returns the instance held in the lease storage
+    /// without copying it. The leases in the storage are never modified
+    /// in place: they are replaced with copies on update. Therefore, the
+    /// returned lease remains valid and consistent even if the lease is
+    /// updated or deleted in the meantime.
+    ///
+    /// @param addr An address of the searched lease.
+    ///
+    /// @return smart pointer to the lease (or NULL if a lease is not found)
+    virtual ConstLease4Ptr
+    getConstLease4(const isc::asiolink::IOAddress& addr) const;
+
     /// @brief Returns existing IPv4 leases for specified hardware address.
     ///
     /// Although in the usual case there will be only one lease, for mobile
@@ -220,6 +297,39 @@ public:
     virtual Lease4Ptr getLease4(const ClientId& clientid,
                                 SubnetID subnet_id) const;
 
+    /// @brief Returns all IPv4 leases for the particular subnet identifier.
+    ///
+    /// This function returns copies of the leases.
+    ///
+    /// @param subnet_id subnet identifier.
+    ///
+    /// @return Lease collection (may be empty if no IPv4 lease found).
+    virtual Lease4Collection getLeases4(SubnetID subnet_id) const;
+
+    /// @brief Returns all IPv4 leases.
+    ///
+    /// This function returns copies of the leases.
+    ///
+    /// @return Lease collection (may be empty if no IPv4 lease found).
+    virtual Lease4Collection getLeases4() const;
+
+    /// @brief Returns range of IPv4 leases using paging.
+    ///
+    /// The leases are returned in the ascending order of addresses. The
+    /// method walks the index sorting the leases by address from the
+    /// first address above the lower bound, so its cost depends on the
+    /// page size rather than on the number of leases.
+    ///
+    /// @param lower_bound_address IPv4 address used as lower bound for the
+    /// returned range.
+    /// @param page_size maximum size of the page returned.
+    ///
+    /// @return Lease collection (may be empty if no IPv4 lease found).
+    /// @throw InvalidParameter if the lower bound is not an IPv4 address.
+    virtual Lease4Collection
+    getLeases4(const asiolink::IOAddress& lower_bound_address,
+               const LeasePageSize& page_size) const;
+
     /// @brief Returns existing IPv6 lease for a given IPv6 address.
     ///
     /// This function returns a copy of the lease. The modification in the
@@ -232,6 +342,20 @@ public:
     virtual Lease6Ptr getLease6(Lease::Type type,
                                 const isc::asiolink::IOAddress& addr) const;
 
+    /// @brief Returns existing IPv6 lease for a given IPv6 address for
+    /// reading.
+    ///
+    /// This function returns the instance held in the lease storage
+    /// without copying it. See @c getConstLease4 for details.
+    ///
+    /// @param type specifies lease type: (NA, TA or PD)
+    /// @param addr An address of the searched lease.
+    ///
+    /// @return smart pointer to the lease (or NULL if a lease is not found)
+    virtual ConstLease6Ptr
+    getConstLease6(Lease::Type type,
+                   const isc::asiolink::IOAddress& addr) const;
+
     /// @brief Returns existing IPv6 lease for a given DUID + IA + lease type
     /// combination
     ///
@@ -259,6 +383,37 @@ public:
                                         uint32_t iaid,
                                         SubnetID subnet_id) const;
 
+    /// @brief Returns all IPv6 leases for the particular subnet identifier.
+    ///
+    /// This function returns copies of the leases.
+    ///
+    /// @param subnet_id subnet identifier.
+    ///
+    /// @return Lease collection (may be empty if no IPv6 lease found).
+    virtual Lease6Collection getLeases6(SubnetID subnet_id) const;
+
+    /// @brief Returns all IPv6 leases.
+    ///
+    /// This function returns copies of the leases.
+    ///
+    /// @return Lease collection (may be empty if no IPv6 lease found).
+    virtual Lease6Collection getLeases6() const;
+
+    /// @brief Returns range of IPv6 leases using paging.
+    ///
+    /// The leases are returned in the ascending order of addresses.
+    /// @see getLeases4(const asiolink::IOAddress&, const LeasePageSize&).
+    ///
+    /// @param lower_bound_address IPv6 address used as lower bound for the
+    /// returned range.
+    /// @param page_size maximum size of the page returned.
+    ///
+    /// @return Lease collection (may be empty if no IPv6 lease found).
+    /// @throw InvalidParameter if the lower bound is not an IPv6 address.
+    virtual Lease6Collection
+    getLeases6(const asiolink::IOAddress& lower_bound_address,
+               const LeasePageSize& page_size) const;
+
     /// @brief Returns a collection of expired DHCPv6 leases.
     ///
     /// This method returns at most @c max_leases expired leases. The leases
@@ -314,6 +469,36 @@ public:
     /// @return true if deletion was successful, false if no such lease exists
     virtual bool deleteLease(const isc::asiolink::IOAddress& addr);
 
+    /// @brief Reclaims a batch of expired IPv4 leases.
+    ///
+    /// The leases are updated and deleted under a single lock and the
+    /// method waits once for the group commit of the lease file rows.
+    ///
+    /// @param updated Leases to be updated.
+    /// @param removed Leases to be deleted.
+    virtual void reclaimLeases4(const Lease4Collection& updated,
+                                const Lease4Collection& removed);
+
+    /// @brief Reclaims a batch of expired IPv6 leases.
+    ///
+    /// @param updated Leases to be updated.
+    /// @param removed Leases to be deleted.
+    virtual void reclaimLeases6(const Lease6Collection& updated,
+                                const Lease6Collection& removed);
+
+    /// @brief Adds or updates a batch of IPv4 leases.
+    ///
+    /// The leases are applied under a single lock and the method waits
+    /// once for the group commit of the lease file rows.
+    ///
+    /// @param leases Leases to be applied.
+    virtual void applyLeases4(const Lease4Collection& leases);
+
+    /// @brief Adds or updates a batch of IPv6 leases.
+    ///
+    /// @param leases Leases to be applied.
+    virtual void applyLeases6(const Lease6Collection& leases);
+
     /// @brief Deletes all expired-reclaimed DHCPv4 leases.
     ///
     /// @param secs Number of seconds since expiration of leases before
@@ -352,6 +537,130 @@ public:
 
 private:
 
+    /// @brief Change of a lease in the in-memory storage.
+    ///
+    /// When the group commit is enabled, the lease is stored in memory
+    /// before its row is written to the lease file. The changes are
+    /// recorded so as they can be undone if the row can't be written.
+    struct LeaseChange {
+
+        /// @brief Constructor.
+        ///
+        /// @param addr Address of the changed lease.
+        /// @param old_lease Lease stored before the change, null if none.
+        /// @param new_lease Lease stored by the change, null if deleted.
+        LeaseChange(const isc::asiolink::IOAddress& addr,
+                    const boost::shared_ptr<Lease>& old_lease,
+                    const boost::shared_ptr<Lease>& new_lease)
+            : addr_(addr), old_lease_(old_lease), new_lease_(new_lease) {
+        }
+
+        /// @brief Address of the changed lease.
+        isc::asiolink::IOAddress addr_;
+
+        /// @brief Lease stored before the change, null if none.
+        boost::shared_ptr<Lease> old_lease_;
+
+        /// @brief Lease stored by the change, null if deleted.
+        boost::shared_ptr<Lease> new_lease_;
+    };
+
+    /// @brief Collection of the lease changes.
+    typedef std::vector<LeaseChange> LeaseChanges;
+
+    /// @brief Deletes a lease without acquiring the mutex.
+    ///
+    /// This method is called by @c deleteLease and other methods which
+    /// already hold the @c mutex_.
+    ///
+    /// @param addr Address of the lease to be deleted. (This can be IPv4 or
+    ///        IPv6.)
+    /// @param changes Pointer to the collection where the change is
+    /// recorded or null if the change isn't recorded.
+    ///
+    /// @return true if deletion was successful, false if no such lease exists
+    bool deleteLeaseInternal(const isc::asiolink::IOAddress& addr,
+                             LeaseChanges* changes = 0);
+
+    /// @brief Adds an IPv4 lease without acquiring the mutex.
+    ///
+    /// @param lease lease to be added
+    /// @param changes Pointer to the collection where the change is
+    /// recorded or null if the change isn't recorded.
+    /// @return true if the lease has been added, false otherwise.
+    bool addLeaseInternal(const Lease4Ptr& lease, LeaseChanges* changes = 0);
+
+    /// @brief Adds an IPv6 lease without acquiring the mutex.
+    ///
+    /// @param lease lease to be added
+    /// @param changes Pointer to the collection where the change is
+    /// recorded or null if the change isn't recorded.
+    /// @return true if the lease has been added, false otherwise.
+    bool addLeaseInternal(const Lease6Ptr& lease, LeaseChanges* changes = 0);
+
+    /// @brief Updates an IPv4 lease without acquiring the mutex.
+    ///
+    /// @param lease4 The lease to be updated.
+    /// @param changes Pointer to the collection where the change is
+    /// recorded or null if the change isn't recorded.
+    void updateLease4Internal(const Lease4Ptr& lease4,
+                              LeaseChanges* changes = 0);
+
+    /// @brief Updates an IPv6 lease without acquiring the mutex.
+    ///
+    /// @param lease6 The lease to be updated.
+    /// @param changes Pointer to the collection where the change is
+    /// recorded or null if the change isn't recorded.
+    void updateLease6Internal(const Lease6Ptr& lease6,
+                              LeaseChanges* changes = 0);
+
+    /// @brief Returns the collection where the lease changes are recorded.
+    ///
+    /// @param changes Collection of the changes made by the caller.
+    /// @return Pointer to the collection if the group commit is enabled,
+    /// null pointer otherwise.
+    LeaseChanges* recordChanges(LeaseChanges& changes) const;
+
+    /// @brief Undoes a change of an IPv4 lease without acquiring the mutex.
+    ///
+    /// The lease is left alone if it has been changed again since.
+    ///
+    /// @param change Change to be undone.
+    void undoLease4Change(const LeaseChange& change);
+
+    /// @brief Undoes a change of an IPv6 lease without acquiring the mutex.
+    ///
+    /// The lease is left alone if it has been changed again since.
+    ///
+    /// @param change Change to be undone.
+    void undoLease6Change(const LeaseChange& change);
+
+    /// @brief Returns the group commit writer and the sequence number of
+    /// the last row appended to the lease file.
+    ///
+    /// This method must be called with the @c mutex_ held, after the row
+    /// has been appended to the lease file.
+    ///
+    /// @param [out] sequence Sequence number of the last appended row.
+    /// @return Pointer to the writer or null pointer if the group commit
+    /// is disabled.
+    GroupCommitWriterPtr getGroupCommit(uint64_t& sequence) const;
+
+    /// @brief Waits until the lease file row is written.
+    ///
+    /// This method must be called without the @c mutex_ held, so as the
+    /// other threads can append their rows to the same group. If writing
+    /// the row fails, the in-memory changes are undone before the
+    /// exception is rethrown.
+    ///
+    /// @param writer Pointer to the writer returned by @c getGroupCommit.
+    /// @param sequence Sequence number returned by @c getGroupCommit.
+    /// @param changes In-memory changes made by the caller.
+    /// @throw isc::util::CSVFileError if writing the row has failed.
+    void waitGroupCommit(const GroupCommitWriterPtr& writer,
+                         const uint64_t sequence,
+                         const LeaseChanges& changes);
+
     /// @brief Deletes all expired-reclaimed leases.
     ///
     /// This private method is called by both of the public methods:
@@ -412,6 +721,13 @@ public:
     /// @return Description of the backend.
     virtual std::string getDescription() const;
 
+    /// @brief Indicates if the backend can be used concurrently.
+    ///
+    /// @return true as the public methods are serialized with a mutex.
+    virtual bool isThreadSafe() const {
+        return (true);
+    }
+
     /// @brief Returns backend version.
     ///
     /// @return Version number as a pair of unsigned integers.  "first" is the
@@ -502,6 +818,22 @@ public:
     /// server shut down.
     bool persistLeases(Universe u) const;
 
+    /// @brief Checks if the DHCPv4 leases are held in the packed storage.
+    ///
+    /// @return true if the "packed" parameter has been set to "true" for
+    /// the DHCPv4 backend.
+    bool isPacked() const {
+        return (static_cast<bool>(packed4_));
+    }
+
+    /// @brief Returns the group commit writer.
+    ///
+    /// @return Pointer to the writer or null pointer if the group commit
+    /// is disabled or the leases are not persisted.
+    const GroupCommitWriterPtr& getGroupCommitWriter() const {
+        return (group_commit_);
+    }
+
     //@}
 
 private:
@@ -524,6 +856,28 @@ private:
     /// argument to this function.
     std::string initLeaseFilePath(Universe u);
 
+    /// @brief Checks if the packed storage should be used for the leases.
+    ///
+    /// @return true if the "packed" parameter is set to "true", false if
+    /// it is set to "false" or not specified.
+    /// @throw BadValue if the parameter has invalid value.
+    bool usePackedStorage() const;
+
+    /// @brief Creates the group commit writer for the lease file.
+    ///
+    /// @return Pointer to the writer if the "group-commit" parameter is
+    /// set to "true", null pointer otherwise.
+    /// @throw BadValue if any of the group commit parameters has invalid
+    /// value.
+    GroupCommitWriterPtr createGroupCommitWriter() const;
+
+    /// @brief Returns the number of threads loading the lease files.
+    ///
+    /// @return Value of the "load-threads" parameter or the number of
+    /// available processors if it is 0 or not specified.
+    /// @throw BadValue if the parameter has invalid value.
+    size_t getLoadThreads() const;
+
     /// @brief Load leases from the persistent storage.
     ///
     /// This method loads DHCPv4 or DHCPv6 leases from lease files in the
@@ -564,12 +918,16 @@ private:
     /// @todo Consider implementing delaying the lease files loading when
     /// the LFC is in progress by the specified amount of time.
     ///
+    /// The snapshot files, i.e. the files with the ".completed" and ".2"
+    /// suffixes, may hold leases in the binary format.
+    ///
     /// @param filename Name of the lease file.
     /// @param lease_file An object representing a lease file to which
     /// the server will store lease updates.
     /// @param storage A storage for leases read from the lease file.
     /// @tparam LeaseObjectType @c Lease4 or @c Lease6.
     /// @tparam LeaseFileType @c CSVLeaseFile4 or @c CSVLeaseFile6.
+    /// @tparam SnapshotFileType @c BinaryLeaseFile4 or @c BinaryLeaseFile6.
     /// @tparam StorageType @c Lease4Storage or @c Lease6Storage.
     ///
     /// @return Returns true if any of the files loaded need conversion from
@@ -578,7 +936,7 @@ private:
     /// @throw CSVFileError when parsing any of the lease files fails.
     /// @throw DbOpenError when it is found that the LFC is in progress.
     template<typename LeaseObjectType, typename LeaseFileType,
-             typename StorageType>
+             typename SnapshotFileType, typename StorageType>
     bool loadLeasesFromFiles(const std::string& filename,
                              boost::shared_ptr<LeaseFileType>& lease_file,
                              StorageType& storage);
@@ -589,12 +947,21 @@ private:
     /// @brief stores IPv6 leases
     Lease6Storage storage6_;
 
+    /// @brief Stores IPv4 leases in the packed form.
+    ///
+    /// If this pointer is set, it is used instead of @c storage4_.
+    boost::scoped_ptr<PackedLease4Storage> packed4_;
+
     /// @brief Holds the pointer to the DHCPv4 lease file IO.
     boost::shared_ptr<CSVLeaseFile4> lease_file4_;
 
     /// @brief Holds the pointer to the DHCPv6 lease file IO.
     boost::shared_ptr<CSVLeaseFile6> lease_file6_;
 
+    /// @brief Writer of the lease file rows used when the group commit
+    /// is enabled.
+    GroupCommitWriterPtr group_commit_;
+
 public:
 
     /// @name Public methods to retrieve information about the LFC process state.
@@ -605,11 +972,15 @@ public:
 
     /// @brief Checks if the process performing lease file cleanup is running.
     ///
-    /// @return true if the process performing lease file cleanup is running.
+    /// @return true if the process or the thread performing lease file
+    /// cleanup is running.
     bool isLFCRunning() const;
 
     /// @brief Returns the status code returned by the last executed
     /// LFC process.
+    ///
+    /// The status code of the in-process cleanup is 0 if it succeeded,
+    /// and 1 otherwise.
     int getLFCExitStatus() const;
     //@}
 
@@ -622,6 +993,18 @@ public:
     /// @return The populated query as a pointer to an LeaseStatsQuery
     virtual LeaseStatsQueryPtr startLeaseStatsQuery4();
 
+    /// @brief Creates and runs the IPv4 lease stats query for selected
+    /// subnets
+    ///
+    /// Only the leases of the selected subnets are examined, using the
+    /// subnet identifier index.
+    ///
+    /// @param subnet_ids Identifiers of the subnets to be examined.
+    ///
+    /// @return The populated query as a pointer to an LeaseStatsQuery
+    virtual LeaseStatsQueryPtr
+    startSubnetLeaseStatsQuery4(const SubnetIDSet& subnet_ids);
+
     /// @brief Creates and runs the IPv6 lease stats query
     ///
     /// It creates an instance of a MemfileLeaseStatsQuery6 and then
@@ -631,6 +1014,18 @@ public:
     /// @return The populated query as a pointer to an LeaseStatsQuery.
     virtual LeaseStatsQueryPtr startLeaseStatsQuery6();
 
+    /// @brief Creates and runs the IPv6 lease stats query for selected
+    /// subnets
+    ///
+    /// Only the leases of the selected subnets are examined, using the
+    /// subnet identifier index.
+    ///
+    /// @param subnet_ids Identifiers of the subnets to be examined.
+    ///
+    /// @return The populated query as a pointer to an LeaseStatsQuery.
+    virtual LeaseStatsQueryPtr
+    startSubnetLeaseStatsQuery6(const SubnetIDSet& subnet_ids);
+
     /// @name Protected methods used for %Lease File Cleanup.
     /// The following methods are protected so as they can be accessed and
     /// tested by unit tests.
@@ -700,9 +1095,118 @@ private:
     template<typename LeaseFileType>
     void lfcExecute(boost::shared_ptr<LeaseFileType>& lease_file);
 
+    /// @brief Starts the in-process cleanup of the DHCPv4 lease file.
+    ///
+    /// This method collects the addresses of the leases held in memory
+    /// and starts the thread writing these leases into a new file. The
+    /// mutex must be locked by the caller.
+    ///
+    /// @param lease_file Current lease file.
+    void lfcStartInProcess(const CSVLeaseFile4& lease_file);
+
+    /// @brief Starts the in-process cleanup of the DHCPv6 lease file.
+    ///
+    /// @param lease_file Current lease file.
+    void lfcStartInProcess(const CSVLeaseFile6& lease_file);
+
+    /// @brief Starts the thread performing the in-process cleanup.
+    ///
+    /// The previous cleanup must not be in progress. The mutex must be
+    /// locked by the caller.
+    ///
+    /// @param compaction Function performing the cleanup.
+    void lfcStartThread(const boost::function<void()>& compaction);
+
+    /// @brief Performs the in-process cleanup of the lease file.
+    ///
+    /// This method runs in the background thread. It writes the leases
+    /// with the specified addresses into the LFC Output File in batches,
+    /// taking the mutex only while copying the leases of each batch. Then
+    /// it moves the file to the LFC Finish File, removes the Previous
+    /// %Lease File and the %Lease File Copy and moves the LFC Finish File
+    /// to the Previous %Lease File, as the @c kea-lfc does. If the LFC
+    /// Finish File exists when the method is started, it only completes
+    /// the interrupted cleanup. The method also creates the PID file for
+    /// the duration of the cleanup, so as the lease files are not loaded
+    /// in the meantime.
+    ///
+    /// The leases may be updated while the batches are written, so the
+    /// leases are written in the state they have when their batch is
+    /// copied. Such updates are also recorded in the Current %Lease File,
+    /// which is read after the Previous %Lease File when the leases are
+    /// loaded, so the loaded leases are correct.
+    ///
+    /// @param filename Name of the Current %Lease File.
+    /// @param addresses Addresses of the leases to be written.
+    /// @tparam LeaseObjectType @c Lease4 or @c Lease6.
+    /// @tparam LeaseFileType Type of the file to which the leases are
+    /// written: @c CSVLeaseFile4, @c CSVLeaseFile6, @c BinaryLeaseFile4 or
+    /// @c BinaryLeaseFile6.
+    template<typename LeaseObjectType, typename LeaseFileType>
+    void lfcInProcess(const std::string& filename,
+                      const boost::shared_ptr<std::vector<asiolink::IOAddress> >& addresses);
+
+    /// @brief Copies the DHCPv4 leases with the specified addresses.
+    ///
+    /// The leases which no longer exist are skipped. The mutex must be
+    /// locked by the caller.
+    ///
+    /// @param addresses Addresses of the leases.
+    /// @param begin Index of the first address.
+    /// @param end Index past the last address.
+    /// @param [out] leases Copies of the leases.
+    void lfcGetLeases(const std::vector<asiolink::IOAddress>& addresses,
+                      const size_t begin, const size_t end,
+                      Lease4Collection& leases) const;
+
+    /// @brief Copies the DHCPv6 leases with the specified addresses.
+    ///
+    /// @param addresses Addresses of the leases.
+    /// @param begin Index of the first address.
+    /// @param end Index past the last address.
+    /// @param [out] leases Copies of the leases.
+    void lfcGetLeases(const std::vector<asiolink::IOAddress>& addresses,
+                      const size_t begin, const size_t end,
+                      Lease6Collection& leases) const;
+
+    /// @brief Stops the in-process cleanup and waits for the thread.
+    ///
+    /// The interrupted cleanup leaves the LFC Output File, which is
+    /// overwritten by the next cleanup.
+    void lfcStopInProcess();
+
     /// @brief A pointer to the Lease File Cleanup configuration.
     boost::scoped_ptr<LFCSetup> lfc_setup_;
 
+    /// @brief Indicates if the cleanup is performed by the backend.
+    bool lfc_in_process_;
+
+    /// @brief Number of leases written by the in-process cleanup at once.
+    uint32_t lfc_batch_size_;
+
+    /// @brief Pause in milliseconds after each batch of leases.
+    uint32_t lfc_batch_interval_;
+
+    /// @brief Indicates if the in-process cleanup writes the leases in
+    /// the binary format.
+    bool lfc_snapshot_binary_;
+
+    /// @brief Thread performing the in-process cleanup.
+    boost::scoped_ptr<util::thread::Thread> lfc_thread_;
+
+    /// @brief Indicates if the in-process cleanup is in progress.
+    bool lfc_running_;
+
+    /// @brief Indicates that the in-process cleanup should stop.
+    bool lfc_stop_;
+
+    /// @brief Status code of the last in-process cleanup.
+    int lfc_exit_status_;
+
+    /// @brief Wakes up the in-process cleanup pausing after a batch when
+    /// it should stop.
+    util::thread::CondVar lfc_cond_;
+
     /// @brief Parameters storage
     ///
     /// DatabaseConnection object is used only for storing, accessing and
@@ -710,6 +1214,9 @@ private:
     DatabaseConnection conn_;
 
     //@}
+
+    /// @brief Mutex serializing access to the lease storage and lease files.
+    mutable isc::util::thread::Mutex mutex_;
 };
 
 }; // end of isc::dhcp namespace
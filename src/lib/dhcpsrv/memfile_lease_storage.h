@@ -11,6 +11,7 @@
 #include <dhcpsrv/lease.h>
 #include <dhcpsrv/subnet_id.h>
 
+#include <boost/multi_index/hashed_index.hpp>
 #include <boost/multi_index/indexed_by.hpp>
 #include <boost/multi_index/member.hpp>
 #include <boost/multi_index/mem_fun.hpp>
@@ -27,21 +28,27 @@ namespace dhcp {
 /// @brief Tag for indexes by address.
 struct AddressIndexTag { };
 
+/// @brief Tag for indexes sorting the leases by address.
+struct OrderedAddressIndexTag { };
+
 /// @brief Tag for indexes by DUID, IAID, lease type tuple.
 struct DuidIaidTypeIndexTag { };
 
 /// @brief Tag for indexes by expiration time.
 struct ExpirationIndexTag { };
 
+/// @brief Tag for indexes by HW address.
+struct HWAddressIndexTag { };
+
 /// @brief Tag for indexes by HW address, subnet identifier tuple.
 struct HWAddressSubnetIdIndexTag { };
 
+/// @brief Tag for indexes by client identifier.
+struct ClientIdIndexTag { };
+
 /// @brief Tag for indexes by client and subnet identifiers.
 struct ClientIdSubnetIdIndexTag { };
 
-/// @brief Tag for indexes by client id, HW address and subnet id.
-struct ClientIdHWAddressSubnetIdIndexTag { };
-
 /// @brief Tag for indexs by subnet-id.
 struct SubnetIdIndexTag { };
 
@@ -56,8 +63,16 @@ struct SubnetIdIndexTag { };
 /// - using a composite index: DUID, IAID and lease type.
 /// - using a composite index: boolean flag indicating if the state is
 ///   "expired-reclaimed" and expiration time.
+/// - using a subnet identifier.
+/// - using an IPv6 address, in the ascending order of addresses.
+///
+/// The indexes used for the exact match lookups by address and by DUID,
+/// IAID and lease type are hashed indexes, which provide constant time
+/// lookups regardless of the number of leases in the container. The
+/// indexes used for range queries, including the pages of leases
+/// following an address, are ordered.
 ///
-/// Indexes can be accessed using the index number (from 0 to 2) or a
+/// Indexes can be accessed using the index number (from 0 to 4) or a
 /// name tag. It is recommended to use the tags to access indexes as
 /// they do not depend on the order of indexes in the container.
 typedef boost::multi_index_container<
@@ -65,15 +80,15 @@ typedef boost::multi_index_container<
     Lease6Ptr,
     boost::multi_index::indexed_by<
         // Specification of the first index starts here.
-        // This index sorts leases by IPv6 addresses represented as
+        // This index hashes leases by IPv6 addresses represented as
         // IOAddress objects.
-        boost::multi_index::ordered_unique<
+        boost::multi_index::hashed_unique<
             boost::multi_index::tag<AddressIndexTag>,
             boost::multi_index::member<Lease, isc::asiolink::IOAddress, &Lease::addr_>
         >,
 
         // Specification of the second index starts here.
-        boost::multi_index::ordered_non_unique<
+        boost::multi_index::hashed_non_unique<
             boost::multi_index::tag<DuidIaidTypeIndexTag>,
             // This is a composite index that will be used to search for
             // the lease using three attributes: DUID, IAID and lease type.
@@ -113,6 +128,13 @@ typedef boost::multi_index_container<
         boost::multi_index::ordered_non_unique<
             boost::multi_index::tag<SubnetIdIndexTag>,
             boost::multi_index::member<Lease, isc::dhcp::SubnetID, &Lease::subnet_id_>
+        >,
+
+        // Specification of the fifth index starts here.
+        // This index sorts leases by IPv6 addresses.
+        boost::multi_index::ordered_unique<
+            boost::multi_index::tag<OrderedAddressIndexTag>,
+            boost::multi_index::member<Lease, isc::asiolink::IOAddress, &Lease::addr_>
         >
      >
 > Lease6Storage; // Specify the type name of this container.
@@ -120,14 +142,25 @@ typedef boost::multi_index_container<
 /// @brief A multi index container holding DHCPv4 leases.
 ///
 /// The leases in the container may be accessed using different indexes:
-/// - IPv6 address,
+/// - IPv4 address,
 /// - composite index: HW address and subnet id,
+/// - HW address,
 /// - composite index: client id and subnet id,
-/// - composite index: HW address, client id and subnet id
+/// - client id,
 /// - using a composite index: boolean flag indicating if the state is
 ///   "expired-reclaimed" and expiration time.
+/// - subnet id,
+/// - IPv4 address, in the ascending order of addresses.
 ///
-/// Indexes can be accessed using the index number (from 0 to 4) or a
+/// The indexes used for the exact match lookups by address, HW address
+/// and client identifier are hashed indexes, which provide constant time
+/// lookups regardless of the number of leases in the container. Hashed
+/// composite keys can't be searched by a partial key, so the searches by
+/// HW address or client identifier alone use separate indexes. The
+/// indexes used for range queries, including the pages of leases
+/// following an address, are ordered.
+///
+/// Indexes can be accessed using the index number (from 0 to 7) or a
 /// name tag. It is recommended to use the tags to access indexes as
 /// they do not depend on the order of indexes in the container.
 typedef boost::multi_index_container<
@@ -136,9 +169,9 @@ typedef boost::multi_index_container<
     // Specification of search indexes starts here.
     boost::multi_index::indexed_by<
         // Specification of the first index starts here.
-        // This index sorts leases by IPv4 addresses represented as
+        // This index hashes leases by IPv4 addresses represented as
         // IOAddress objects.
-        boost::multi_index::ordered_unique<
+        boost::multi_index::hashed_unique<
             boost::multi_index::tag<AddressIndexTag>,
             // The IPv4 address are held in addr_ members that belong to
             // Lease class.
@@ -146,7 +179,7 @@ typedef boost::multi_index_container<
         >,
 
         // Specification of the second index starts here.
-        boost::multi_index::ordered_non_unique<
+        boost::multi_index::hashed_non_unique<
             boost::multi_index::tag<HWAddressSubnetIdIndexTag>,
             // This is a composite index that combines two attributes of the
             // Lease4 object: hardware address and subnet id.
@@ -167,7 +200,15 @@ typedef boost::multi_index_container<
         >,
 
         // Specification of the third index starts here.
-        boost::multi_index::ordered_non_unique<
+        // This index hashes leases by the hardware address only.
+        boost::multi_index::hashed_non_unique<
+            boost::multi_index::tag<HWAddressIndexTag>,
+            boost::multi_index::const_mem_fun<Lease, const std::vector<uint8_t>&,
+                                              &Lease::getHWAddrVector>
+        >,
+
+        // Specification of the fourth index starts here.
+        boost::multi_index::hashed_non_unique<
             boost::multi_index::tag<ClientIdSubnetIdIndexTag>,
             // This is a composite index that uses two values to search for a
             // lease: client id and subnet id.
@@ -182,29 +223,15 @@ typedef boost::multi_index_container<
             >
         >,
 
-        // Specification of the fourth index starts here.
-        boost::multi_index::ordered_non_unique<
-            boost::multi_index::tag<ClientIdHWAddressSubnetIdIndexTag>,
-            // This is a composite index that uses three values to search for a
-            // lease: client id, HW address and subnet id.
-            boost::multi_index::composite_key<
-                Lease4,
-                // The client id can be retrieved from the Lease4 object by
-                // calling getClientIdVector const function.
-                boost::multi_index::const_mem_fun<Lease4, const std::vector<uint8_t>&,
-                                                  &Lease4::getClientIdVector>,
-                // The hardware address is held in the hwaddr_ object. We can
-                // access the raw data using lease->hwaddr_->hwaddr_, but Boost
-                // doesn't seem to provide a way to use member of a member for this,
-                // so we need a simple key extractor method (getHWAddrVector).
-                boost::multi_index::const_mem_fun<Lease, const std::vector<uint8_t>&,
-                                                  &Lease::getHWAddrVector>,
-                // The subnet id is accessed through the subnet_id_ member.
-                boost::multi_index::member<Lease, SubnetID, &Lease::subnet_id_>
-            >
+        // Specification of the fifth index starts here.
+        // This index hashes leases by the client identifier only.
+        boost::multi_index::hashed_non_unique<
+            boost::multi_index::tag<ClientIdIndexTag>,
+            boost::multi_index::const_mem_fun<Lease4, const std::vector<uint8_t>&,
+                                              &Lease4::getClientIdVector>
         >,
 
-        // Specification of the fifth index starts here.
+        // Specification of the sixth index starts here.
         boost::multi_index::ordered_non_unique<
             boost::multi_index::tag<ExpirationIndexTag>,
             // This is a composite index that will be used to search for
@@ -222,13 +249,19 @@ typedef boost::multi_index_container<
             >
         >,
 
-        // Specification of the sixth index starts here.
+        // Specification of the seventh index starts here.
         // This index sorts leases by SubnetID.
         boost::multi_index::ordered_non_unique<
             boost::multi_index::tag<SubnetIdIndexTag>,
             boost::multi_index::member<Lease, isc::dhcp::SubnetID, &Lease::subnet_id_>
-        >
+        >,
 
+        // Specification of the eighth index starts here.
+        // This index sorts leases by IPv4 addresses.
+        boost::multi_index::ordered_unique<
+            boost::multi_index::tag<OrderedAddressIndexTag>,
+            boost::multi_index::member<Lease, isc::asiolink::IOAddress, &Lease::addr_>
+        >
     >
 > Lease4Storage; // Specify the type name for this container.
 
@@ -250,6 +283,10 @@ typedef Lease6Storage::index<ExpirationIndexTag>::type Lease6StorageExpirationIn
 /// @brief DHCPv6 lease storage index by Subnet-id.
 typedef Lease6Storage::index<SubnetIdIndexTag>::type Lease6StorageSubnetIdIndex;
 
+/// @brief DHCPv6 lease storage index sorted by address.
+typedef Lease6Storage::index<OrderedAddressIndexTag>::type
+Lease6StorageOrderedAddressIndex;
+
 /// @brief DHCPv4 lease storage index by address.
 typedef Lease4Storage::index<AddressIndexTag>::type Lease4StorageAddressIndex;
 
@@ -260,17 +297,23 @@ typedef Lease4Storage::index<ExpirationIndexTag>::type Lease4StorageExpirationIn
 typedef Lease4Storage::index<HWAddressSubnetIdIndexTag>::type
 Lease4StorageHWAddressSubnetIdIndex;
 
+/// @brief DHCPv4 lease storage index by HW address.
+typedef Lease4Storage::index<HWAddressIndexTag>::type Lease4StorageHWAddressIndex;
+
 /// @brief DHCPv4 lease storage index by client and subnet identifier.
 typedef Lease4Storage::index<ClientIdSubnetIdIndexTag>::type
 Lease4StorageClientIdSubnetIdIndex;
 
-/// @brief DHCPv4 lease storage index by client id, HW address and subnet id.
-typedef Lease4Storage::index<ClientIdHWAddressSubnetIdIndexTag>::type
-Lease4StorageClientIdHWAddressSubnetIdIndex;
+/// @brief DHCPv4 lease storage index by client identifier.
+typedef Lease4Storage::index<ClientIdIndexTag>::type Lease4StorageClientIdIndex;
 
-/// @brief DHCPv4 lease storage index by client id, HW address and subnet id.
+/// @brief DHCPv4 lease storage index by subnet identifier.
 typedef Lease4Storage::index<SubnetIdIndexTag>::type Lease4StorageSubnetIdIndex;
 
+/// @brief DHCPv4 lease storage index sorted by address.
+typedef Lease4Storage::index<OrderedAddressIndexTag>::type
+Lease4StorageOrderedAddressIndex;
+
 //@}
 } // end of isc::dhcp namespace
 } // end of isc namespace
@@ -0,0 +1,537 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/memfile_packed_lease_storage.h>
+#include <exceptions/exceptions.h>
+
+#include <boost/functional/hash.hpp>
+#include <boost/tuple/tuple.hpp>
+
+#include <cstring>
+#include <ctime>
+#include <limits>
+
+using namespace isc::asiolink;
+
+namespace {
+
+/// @brief Returns the packed lease with the lowest address in the range.
+///
+/// The hashed indexes don't order the leases having the same key. This
+/// function is used to return the same lease regardless of the order
+/// in which the leases have been inserted.
+///
+/// @param range Pair of iterators delimiting the range.
+/// @return Pointer to the packed lease or null pointer if the range is
+/// empty.
+template<typename IteratorType>
+const isc::dhcp::PackedLease4*
+lowestAddressLease(const std::pair<IteratorType, IteratorType>& range) {
+    const isc::dhcp::PackedLease4* lowest = 0;
+    for (IteratorType lease = range.first; lease != range.second; ++lease) {
+        if (!lowest || (lease->addr_ < lowest->addr_)) {
+            lowest = &(*lease);
+        }
+    }
+    return (lowest);
+}
+
+}
+
+namespace isc {
+namespace dhcp {
+
+const uint8_t PackedLease4::HAS_HWADDR;
+const uint8_t PackedLease4::FQDN_FWD;
+const uint8_t PackedLease4::FQDN_REV;
+
+size_t
+LeaseBlobPool::BlobHash::operator()(const std::string& data) const {
+    return (boost::hash_range(data.begin(), data.end()));
+}
+
+size_t
+LeaseBlobPool::BlobHash::operator()(const BlobKey& key) const {
+    const char* data = reinterpret_cast<const char*>(key.data_);
+    return (boost::hash_range(data, data + key.len_));
+}
+
+bool
+LeaseBlobPool::BlobEqual::operator()(const BlobKey& key,
+                                     const std::string& data) const {
+    return ((key.len_ == data.size()) &&
+            (memcmp(key.data_, data.data(), key.len_) == 0));
+}
+
+bool
+LeaseBlobPool::BlobEqual::operator()(const std::string& data,
+                                     const BlobKey& key) const {
+    return (operator()(key, data));
+}
+
+bool
+LeaseBlobPool::BlobEqual::operator()(const std::string& a,
+                                     const std::string& b) const {
+    return (a == b);
+}
+
+LeaseBlobPool::LeaseBlobPool()
+    : blobs_() {
+}
+
+const LeaseBlob*
+LeaseBlobPool::acquire(const uint8_t* data, const size_t len) {
+    if (len == 0) {
+        return (0);
+    }
+
+    const BlobKey key = { data, len };
+    BlobContainer::iterator blob = blobs_.find(key, BlobHash(), BlobEqual());
+    if (blob == blobs_.end()) {
+        blob = blobs_.insert(LeaseBlob(data, len)).first;
+    }
+    ++blob->refs_;
+    return (&(*blob));
+}
+
+const LeaseBlob*
+LeaseBlobPool::find(const uint8_t* data, const size_t len) const {
+    if (len == 0) {
+        return (0);
+    }
+
+    const BlobKey key = { data, len };
+    BlobContainer::const_iterator blob = blobs_.find(key, BlobHash(),
+                                                     BlobEqual());
+    return (blob == blobs_.end() ? 0 : &(*blob));
+}
+
+void
+LeaseBlobPool::release(const LeaseBlob* blob) {
+    if (!blob) {
+        return;
+    }
+
+    if (blob->refs_ == 0) {
+        isc_throw(Unexpected, "released lease blob which is not referenced");
+    }
+
+    if (--blob->refs_ == 0) {
+        blobs_.erase(blobs_.iterator_to(*blob));
+    }
+}
+
+size_t
+LeaseBlobPool::size() const {
+    return (blobs_.size());
+}
+
+void
+LeaseBlobPool::clear() {
+    blobs_.clear();
+}
+
+PackedLease4Storage::PackedLease4Storage()
+    : leases_(), blobs_() {
+}
+
+PackedLease4Storage::~PackedLease4Storage() {
+    // The leases must be removed before the values they refer to.
+    leases_.clear();
+}
+
+PackedLease4Storage::iterator
+PackedLease4Storage::find(const IOAddress& addr) {
+    return (leases_.find(addr.toUint32()));
+}
+
+PackedLease4Storage::iterator
+PackedLease4Storage::end() {
+    return (leases_.end());
+}
+
+bool
+PackedLease4Storage::insert(const Lease4Ptr& lease) {
+    if (leases_.find(lease->addr_.toUint32()) != leases_.end()) {
+        return (false);
+    }
+
+    PackedLease4 packed = pack(*lease);
+    if (!leases_.insert(packed).second) {
+        release(packed);
+        return (false);
+    }
+    return (true);
+}
+
+void
+PackedLease4Storage::erase(iterator it) {
+    const PackedLease4 packed = *it;
+    leases_.erase(it);
+    release(packed);
+}
+
+bool
+PackedLease4Storage::replace(iterator it, const Lease4Ptr& lease) {
+    const PackedLease4 old_packed = *it;
+    PackedLease4 new_packed = pack(*lease);
+    if (!leases_.replace(it, new_packed)) {
+        release(new_packed);
+        return (false);
+    }
+    release(old_packed);
+    return (true);
+}
+
+void
+PackedLease4Storage::clear() {
+    leases_.clear();
+    blobs_.clear();
+}
+
+size_t
+PackedLease4Storage::size() const {
+    return (leases_.size());
+}
+
+size_t
+PackedLease4Storage::getBlobCount() const {
+    return (blobs_.size());
+}
+
+void
+PackedLease4Storage::getAddresses(std::vector<IOAddress>& addresses) const {
+    addresses.reserve(addresses.size() + leases_.size());
+    for (PackedLease4Container::const_iterator lease = leases_.begin();
+         lease != leases_.end(); ++lease) {
+        addresses.push_back(IOAddress(lease->addr_));
+    }
+}
+
+PackedLease4
+PackedLease4Storage::pack(const Lease4& lease) {
+    if (!lease.addr_.isV4()) {
+        isc_throw(BadValue, "unable to store the lease for non IPv4 address "
+                  << lease.addr_);
+    }
+
+    PackedLease4 packed;
+    packed.cltt_ = static_cast<int64_t>(lease.cltt_);
+    packed.addr_ = lease.addr_.toUint32();
+    packed.subnet_id_ = lease.subnet_id_;
+    packed.t1_ = lease.t1_;
+    packed.t2_ = lease.t2_;
+    packed.valid_lft_ = lease.valid_lft_;
+    packed.state_ = lease.state_;
+    packed.hwaddr_source_ = 0;
+    packed.hwaddr_ = 0;
+    packed.client_id_ = 0;
+    packed.hostname_ = 0;
+    packed.htype_ = 0;
+    packed.flags_ = 0;
+
+    if (lease.fqdn_fwd_) {
+        packed.flags_ |= PackedLease4::FQDN_FWD;
+    }
+    if (lease.fqdn_rev_) {
+        packed.flags_ |= PackedLease4::FQDN_REV;
+    }
+
+    // Acquire the values one by one, releasing those already acquired if
+    // anything goes wrong.
+    try {
+        if (lease.hwaddr_) {
+            packed.flags_ |= PackedLease4::HAS_HWADDR;
+            packed.htype_ = lease.hwaddr_->htype_;
+            packed.hwaddr_source_ = lease.hwaddr_->source_;
+            const std::vector<uint8_t>& hwaddr = lease.hwaddr_->hwaddr_;
+            packed.hwaddr_ = blobs_.acquire(hwaddr.empty() ? 0 : &hwaddr[0],
+                                            hwaddr.size());
+        }
+
+        if (lease.client_id_) {
+            const std::vector<uint8_t>& client_id =
+                lease.client_id_->getClientId();
+            packed.client_id_ = blobs_.acquire(client_id.empty() ? 0 :
+                                               &client_id[0], client_id.size());
+        }
+
+        packed.hostname_ = blobs_.acquire(reinterpret_cast<const uint8_t*>
+                                          (lease.hostname_.data()),
+                                          lease.hostname_.size());
+    } catch (...) {
+        release(packed);
+        throw;
+    }
+
+    return (packed);
+}
+
+void
+PackedLease4Storage::release(const PackedLease4& packed) {
+    blobs_.release(packed.hwaddr_);
+    blobs_.release(packed.client_id_);
+    blobs_.release(packed.hostname_);
+}
+
+Lease4Ptr
+PackedLease4Storage::materialize(const PackedLease4& packed) const {
+    HWAddrPtr hwaddr;
+    if ((packed.flags_ & PackedLease4::HAS_HWADDR) != 0) {
+        if (packed.hwaddr_) {
+            hwaddr.reset(new HWAddr(packed.hwaddr_->getData(),
+                                    packed.hwaddr_->getLength(),
+                                    packed.htype_));
+        } else {
+            hwaddr.reset(new HWAddr(std::vector<uint8_t>(), packed.htype_));
+        }
+        hwaddr->source_ = packed.hwaddr_source_;
+    }
+
+    ClientIdPtr client_id;
+    if (packed.client_id_) {
+        client_id.reset(new ClientId(packed.client_id_->toVector()));
+    }
+
+    Lease4Ptr lease(new Lease4(IOAddress(packed.addr_), hwaddr, client_id,
+                               packed.valid_lft_, packed.t1_, packed.t2_,
+                               static_cast<time_t>(packed.cltt_),
+                               packed.subnet_id_,
+                               (packed.flags_ & PackedLease4::FQDN_FWD) != 0,
+                               (packed.flags_ & PackedLease4::FQDN_REV) != 0,
+                               packed.hostname_ ? packed.hostname_->data_ :
+                               std::string()));
+    lease->state_ = packed.state_;
+    return (lease);
+}
+
+bool
+PackedLease4Storage::findHWAddr(const HWAddr& hwaddr,
+                                const LeaseBlob*& blob) const {
+    const std::vector<uint8_t>& data = hwaddr.hwaddr_;
+    blob = blobs_.find(data.empty() ? 0 : &data[0], data.size());
+    return (blob || data.empty());
+}
+
+Lease4Ptr
+PackedLease4Storage::get(const IOAddress& addr) const {
+    PackedLease4Container::const_iterator lease =
+        leases_.find(addr.toUint32());
+    if (lease == leases_.end()) {
+        return (Lease4Ptr());
+    }
+    return (materialize(*lease));
+}
+
+Lease4Collection
+PackedLease4Storage::getByHWAddr(const HWAddr& hwaddr) const {
+    Lease4Collection collection;
+    const LeaseBlob* blob = 0;
+    if (!findHWAddr(hwaddr, blob)) {
+        return (collection);
+    }
+
+    const PackedLease4Container::index<HWAddressIndexTag>::type& idx =
+        leases_.get<HWAddressIndexTag>();
+    for (auto lease = idx.equal_range(blob); lease.first != lease.second;
+         ++lease.first) {
+        collection.push_back(materialize(*lease.first));
+    }
+    return (collection);
+}
+
+Lease4Ptr
+PackedLease4Storage::getByHWAddr(const HWAddr& hwaddr,
+                                 const SubnetID subnet_id) const {
+    const LeaseBlob* blob = 0;
+    if (!findHWAddr(hwaddr, blob)) {
+        return (Lease4Ptr());
+    }
+
+    const PackedLease4Container::index<HWAddressSubnetIdIndexTag>::type& idx =
+        leases_.get<HWAddressSubnetIdIndexTag>();
+    const PackedLease4* lease = lowestAddressLease(idx.equal_range(
+        boost::make_tuple(blob, subnet_id)));
+    return (lease ? materialize(*lease) : Lease4Ptr());
+}
+
+Lease4Collection
+PackedLease4Storage::getByClientId(const ClientId& client_id) const {
+    Lease4Collection collection;
+    const std::vector<uint8_t>& data = client_id.getClientId();
+    const LeaseBlob* blob = blobs_.find(data.empty() ? 0 : &data[0],
+                                        data.size());
+    if (!blob) {
+        return (collection);
+    }
+
+    const PackedLease4Container::index<ClientIdIndexTag>::type& idx =
+        leases_.get<ClientIdIndexTag>();
+    for (auto lease = idx.equal_range(blob); lease.first != lease.second;
+         ++lease.first) {
+        collection.push_back(materialize(*lease.first));
+    }
+    return (collection);
+}
+
+Lease4Ptr
+PackedLease4Storage::getByClientId(const ClientId& client_id,
+                                   const SubnetID subnet_id) const {
+    const std::vector<uint8_t>& data = client_id.getClientId();
+    const LeaseBlob* blob = blobs_.find(data.empty() ? 0 : &data[0],
+                                        data.size());
+    if (!blob) {
+        return (Lease4Ptr());
+    }
+
+    const PackedLease4Container::index<ClientIdSubnetIdIndexTag>::type& idx =
+        leases_.get<ClientIdSubnetIdIndexTag>();
+    const PackedLease4* lease = lowestAddressLease(idx.equal_range(
+        boost::make_tuple(blob, subnet_id)));
+    return (lease ? materialize(*lease) : Lease4Ptr());
+}
+
+Lease4Ptr
+PackedLease4Storage::getByClientId(const ClientId& client_id,
+                                   const HWAddr& hwaddr,
+                                   const SubnetID subnet_id) const {
+    const std::vector<uint8_t>& data = client_id.getClientId();
+    const LeaseBlob* blob = blobs_.find(data.empty() ? 0 : &data[0],
+                                        data.size());
+    const LeaseBlob* hwaddr_blob = 0;
+    if (!blob || !findHWAddr(hwaddr, hwaddr_blob)) {
+        return (Lease4Ptr());
+    }
+
+    const PackedLease4Container::index<ClientIdSubnetIdIndexTag>::type& idx =
+        leases_.get<ClientIdSubnetIdIndexTag>();
+    for (auto lease = idx.equal_range(boost::make_tuple(blob, subnet_id));
+         lease.first != lease.second; ++lease.first) {
+        if (lease.first->hwaddr_ == hwaddr_blob) {
+            return (materialize(*lease.first));
+        }
+    }
+    return (Lease4Ptr());
+}
+
+Lease4Collection
+PackedLease4Storage::getAll() const {
+    Lease4Collection collection;
+    collection.reserve(leases_.size());
+    for (auto lease = leases_.begin(); lease != leases_.end(); ++lease) {
+        collection.push_back(materialize(*lease));
+    }
+    return (collection);
+}
+
+Lease4Collection
+PackedLease4Storage::getPage(const IOAddress& lower_bound_address,
+                             const size_t page_size) const {
+    const PackedLease4Container::index<OrderedAddressIndexTag>::type& idx =
+        leases_.get<OrderedAddressIndexTag>();
+
+    Lease4Collection collection;
+    for (auto lease = idx.upper_bound(lower_bound_address.toUint32());
+         (lease != idx.end()) && (collection.size() < page_size); ++lease) {
+        collection.push_back(materialize(*lease));
+    }
+    return (collection);
+}
+
+Lease4Collection
+PackedLease4Storage::getBySubnetId(const SubnetID subnet_id) const {
+    Lease4Collection collection;
+    const PackedLease4Container::index<SubnetIdIndexTag>::type& idx =
+        leases_.get<SubnetIdIndexTag>();
+    for (auto lease = idx.equal_range(subnet_id); lease.first != lease.second;
+         ++lease.first) {
+        collection.push_back(materialize(*lease.first));
+    }
+    return (collection);
+}
+
+void
+PackedLease4Storage::getExpired(Lease4Collection& expired_leases,
+                                const size_t max_leases) const {
+    const PackedLease4Container::index<ExpirationIndexTag>::type& idx =
+        leases_.get<ExpirationIndexTag>();
+
+    // The leases which are not reclaimed and have expired precede the
+    // upper bound. See Memfile_LeaseMgr::getExpiredLeases4.
+    auto ub = idx.upper_bound(boost::make_tuple(false,
+                                                static_cast<int64_t>(time(NULL))));
+    size_t count = 0;
+    for (auto lease = idx.begin();
+         (lease != ub) && ((max_leases == 0) || (count < max_leases));
+         ++lease, ++count) {
+        expired_leases.push_back(materialize(*lease));
+    }
+}
+
+void
+PackedLease4Storage::eraseExpiredReclaimed(const uint32_t secs,
+                                           Lease4Collection& removed) {
+    PackedLease4Container::index<ExpirationIndexTag>::type& idx =
+        leases_.get<ExpirationIndexTag>();
+
+    // The reclaimed leases which expired more than secs ago lie between
+    // these bounds. See Memfile_LeaseMgr::deleteExpiredReclaimedLeases.
+    auto upper_limit = idx.upper_bound(boost::make_tuple(true,
+        static_cast<int64_t>(time(NULL)) - secs));
+    auto lower_limit = idx.upper_bound(boost::make_tuple(true,
+        std::numeric_limits<int64_t>::min()));
+
+    while (lower_limit != upper_limit) {
+        removed.push_back(materialize(*lower_limit));
+        const PackedLease4 packed = *lower_limit;
+        lower_limit = idx.erase(lower_limit);
+        release(packed);
+    }
+}
+
+std::vector<LeaseStatsRow>
+PackedLease4Storage::getLeaseStats() const {
+    std::vector<LeaseStatsRow> rows;
+    const PackedLease4Container::index<SubnetIdIndexTag>::type& idx =
+        leases_.get<SubnetIdIndexTag>();
+
+    // The leases are ordered by subnet id, so the counters are appended
+    // to the result when all leases of the subnet have been visited.
+    SubnetID cur_id = 0;
+    int64_t assigned = 0;
+    int64_t declined = 0;
+    for (auto lease = idx.begin(); lease != idx.end(); ++lease) {
+        if (lease->subnet_id_ != cur_id) {
+            if (cur_id > 0) {
+                rows.push_back(LeaseStatsRow(cur_id, Lease::STATE_DEFAULT,
+                                             assigned));
+                rows.push_back(LeaseStatsRow(cur_id, Lease::STATE_DECLINED,
+                                             declined));
+                assigned = 0;
+                declined = 0;
+            }
+            cur_id = lease->subnet_id_;
+        }
+
+        if (lease->state_ == Lease::STATE_DEFAULT) {
+            ++assigned;
+        } else if (lease->state_ == Lease::STATE_DECLINED) {
+            ++declined;
+        }
+    }
+
+    if (idx.begin() != idx.end()) {
+        rows.push_back(LeaseStatsRow(cur_id, Lease::STATE_DEFAULT, assigned));
+        rows.push_back(LeaseStatsRow(cur_id, Lease::STATE_DECLINED, declined));
+    }
+
+    return (rows);
+}
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
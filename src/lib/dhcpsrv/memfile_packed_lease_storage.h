@@ -0,0 +1,507 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef MEMFILE_PACKED_LEASE_STORAGE_H
+#define MEMFILE_PACKED_LEASE_STORAGE_H
+
+#include <asiolink/io_address.h>
+#include <dhcp/duid.h>
+#include <dhcp/hwaddr.h>
+#include <dhcpsrv/lease.h>
+#include <dhcpsrv/lease_mgr.h>
+#include <dhcpsrv/memfile_lease_storage.h>
+#include <dhcpsrv/subnet_id.h>
+
+#include <boost/multi_index/composite_key.hpp>
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/indexed_by.hpp>
+#include <boost/multi_index/mem_fun.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/ordered_index.hpp>
+#include <boost/multi_index_container.hpp>
+#include <boost/noncopyable.hpp>
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Binary value shared by the leases in the packed storage.
+///
+/// HW addresses, client identifiers and hostnames are stored once in the
+/// @c LeaseBlobPool and the leases refer to them by pointers. The value is
+/// held in a string, which keeps typical HW addresses and client identifiers
+/// within the string's internal buffer, i.e. without a separate allocation.
+struct LeaseBlob {
+
+    /// @brief Constructor.
+    ///
+    /// @param data Pointer to the value.
+    /// @param len Length of the value.
+    LeaseBlob(const uint8_t* data, const size_t len)
+        : data_(reinterpret_cast<const char*>(data), len), refs_(0) {
+    }
+
+    /// @brief Returns pointer to the value.
+    const uint8_t* getData() const {
+        return (reinterpret_cast<const uint8_t*>(data_.data()));
+    }
+
+    /// @brief Returns length of the value.
+    size_t getLength() const {
+        return (data_.size());
+    }
+
+    /// @brief Returns the value as a vector.
+    std::vector<uint8_t> toVector() const {
+        return (std::vector<uint8_t>(getData(), getData() + getLength()));
+    }
+
+    /// @brief Value.
+    std::string data_;
+
+    /// @brief Number of leases referring to the value.
+    mutable uint32_t refs_;
+};
+
+/// @brief Pool of binary values referred to by the packed leases.
+///
+/// Each distinct value is stored once, together with the number of
+/// references to it. The value is removed from the pool when the last
+/// reference is released. Empty values are never stored: the pool returns
+/// a null pointer for them.
+///
+/// This class is not thread safe. The caller must serialize access to it.
+class LeaseBlobPool : public boost::noncopyable {
+public:
+
+    /// @brief Constructor.
+    LeaseBlobPool();
+
+    /// @brief Returns the value from the pool, adding it if necessary.
+    ///
+    /// The reference counter of the returned value is increased.
+    ///
+    /// @param data Pointer to the value.
+    /// @param len Length of the value.
+    /// @return Pointer to the value in the pool or null pointer if the
+    /// value is empty.
+    const LeaseBlob* acquire(const uint8_t* data, const size_t len);
+
+    /// @brief Returns the value from the pool without adding it.
+    ///
+    /// @param data Pointer to the value.
+    /// @param len Length of the value.
+    /// @return Pointer to the value in the pool or null pointer if the
+    /// value is empty or there is no such value in the pool.
+    const LeaseBlob* find(const uint8_t* data, const size_t len) const;
+
+    /// @brief Releases the reference to the value.
+    ///
+    /// The value is removed from the pool when there are no more references
+    /// to it.
+    ///
+    /// @param blob Pointer to the value returned by @c acquire. It may be
+    /// null, in which case the method does nothing.
+    void release(const LeaseBlob* blob);
+
+    /// @brief Returns the number of distinct values in the pool.
+    size_t size() const;
+
+    /// @brief Removes all values from the pool.
+    void clear();
+
+private:
+
+    /// @brief Key used to look up the values without copying them.
+    struct BlobKey {
+        /// @brief Pointer to the value.
+        const uint8_t* data_;
+        /// @brief Length of the value.
+        size_t len_;
+    };
+
+    /// @brief Computes the hash of the value.
+    struct BlobHash {
+        size_t operator()(const std::string& data) const;
+        size_t operator()(const BlobKey& key) const;
+    };
+
+    /// @brief Compares the key with the stored value.
+    struct BlobEqual {
+        bool operator()(const BlobKey& key, const std::string& data) const;
+        bool operator()(const std::string& data, const BlobKey& key) const;
+        bool operator()(const std::string& a, const std::string& b) const;
+    };
+
+    /// @brief Container holding the values.
+    typedef boost::multi_index_container<
+        LeaseBlob,
+        boost::multi_index::indexed_by<
+            boost::multi_index::hashed_unique<
+                boost::multi_index::member<LeaseBlob, std::string,
+                                           &LeaseBlob::data_>,
+                BlobHash, BlobEqual
+            >
+        >
+    > BlobContainer;
+
+    /// @brief Values.
+    BlobContainer blobs_;
+};
+
+/// @brief Compact representation of the DHCPv4 lease.
+///
+/// The address is stored as a 32 bit integer and the variable length
+/// values are stored in the @c LeaseBlobPool.
+struct PackedLease4 {
+
+    /// @name Flags stored in the @c flags_ member.
+    //@{
+    /// @brief The lease has a HW address, possibly empty.
+    static const uint8_t HAS_HWADDR = 0x01;
+    /// @brief Forward DNS update was performed for the lease.
+    static const uint8_t FQDN_FWD = 0x02;
+    /// @brief Reverse DNS update was performed for the lease.
+    static const uint8_t FQDN_REV = 0x04;
+    //@}
+
+    /// @brief Returns true if the lease is in the "expired-reclaimed" state.
+    bool stateExpiredReclaimed() const {
+        return (state_ == Lease::STATE_EXPIRED_RECLAIMED);
+    }
+
+    /// @brief Returns the lease expiration time.
+    int64_t getExpirationTime() const {
+        return (cltt_ + valid_lft_);
+    }
+
+    /// @brief Client last transmission time.
+    int64_t cltt_;
+
+    /// @brief IPv4 address.
+    uint32_t addr_;
+
+    /// @brief Subnet identifier.
+    SubnetID subnet_id_;
+
+    /// @brief Renewal timer.
+    uint32_t t1_;
+
+    /// @brief Rebinding timer.
+    uint32_t t2_;
+
+    /// @brief Valid lifetime.
+    uint32_t valid_lft_;
+
+    /// @brief Lease state.
+    uint32_t state_;
+
+    /// @brief Source of the HW address.
+    uint32_t hwaddr_source_;
+
+    /// @brief HW address or null pointer if it is absent or empty.
+    const LeaseBlob* hwaddr_;
+
+    /// @brief Client identifier or null pointer if it is absent.
+    const LeaseBlob* client_id_;
+
+    /// @brief Hostname or null pointer if it is empty.
+    const LeaseBlob* hostname_;
+
+    /// @brief Hardware type.
+    uint16_t htype_;
+
+    /// @brief Combination of the flags defined above.
+    uint8_t flags_;
+};
+
+/// @brief A multi index container holding packed DHCPv4 leases.
+///
+/// It provides the same indexes as the @c Lease4Storage. The indexes by
+/// HW address and client identifier use the pointers to the values in
+/// the @c LeaseBlobPool as keys, which is possible because each distinct
+/// value is stored in the pool once.
+typedef boost::multi_index_container<
+    PackedLease4,
+    boost::multi_index::indexed_by<
+        // The first index hashes leases by address.
+        boost::multi_index::hashed_unique<
+            boost::multi_index::tag<AddressIndexTag>,
+            boost::multi_index::member<PackedLease4, uint32_t,
+                                       &PackedLease4::addr_>
+        >,
+
+        // The second index hashes leases by HW address and subnet id.
+        boost::multi_index::hashed_non_unique<
+            boost::multi_index::tag<HWAddressSubnetIdIndexTag>,
+            boost::multi_index::composite_key<
+                PackedLease4,
+                boost::multi_index::member<PackedLease4, const LeaseBlob*,
+                                           &PackedLease4::hwaddr_>,
+                boost::multi_index::member<PackedLease4, SubnetID,
+                                           &PackedLease4::subnet_id_>
+            >
+        >,
+
+        // The third index hashes leases by HW address.
+        boost::multi_index::hashed_non_unique<
+            boost::multi_index::tag<HWAddressIndexTag>,
+            boost::multi_index::member<PackedLease4, const LeaseBlob*,
+                                       &PackedLease4::hwaddr_>
+        >,
+
+        // The fourth index hashes leases by client id and subnet id.
+        boost::multi_index::hashed_non_unique<
+            boost::multi_index::tag<ClientIdSubnetIdIndexTag>,
+            boost::multi_index::composite_key<
+                PackedLease4,
+                boost::multi_index::member<PackedLease4, const LeaseBlob*,
+                                           &PackedLease4::client_id_>,
+                boost::multi_index::member<PackedLease4, SubnetID,
+                                           &PackedLease4::subnet_id_>
+            >
+        >,
+
+        // The fifth index hashes leases by client id.
+        boost::multi_index::hashed_non_unique<
+            boost::multi_index::tag<ClientIdIndexTag>,
+            boost::multi_index::member<PackedLease4, const LeaseBlob*,
+                                       &PackedLease4::client_id_>
+        >,
+
+        // The sixth index sorts leases by the "expired-reclaimed" state
+        // flag and expiration time.
+        boost::multi_index::ordered_non_unique<
+            boost::multi_index::tag<ExpirationIndexTag>,
+            boost::multi_index::composite_key<
+                PackedLease4,
+                boost::multi_index::const_mem_fun<
+                    PackedLease4, bool, &PackedLease4::stateExpiredReclaimed
+                >,
+                boost::multi_index::const_mem_fun<
+                    PackedLease4, int64_t, &PackedLease4::getExpirationTime
+                >
+            >
+        >,
+
+        // The seventh index sorts leases by subnet id.
+        boost::multi_index::ordered_non_unique<
+            boost::multi_index::tag<SubnetIdIndexTag>,
+            boost::multi_index::member<PackedLease4, SubnetID,
+                                       &PackedLease4::subnet_id_>
+        >,
+
+        // The eighth index sorts leases by address.
+        boost::multi_index::ordered_unique<
+            boost::multi_index::tag<OrderedAddressIndexTag>,
+            boost::multi_index::member<PackedLease4, uint32_t,
+                                       &PackedLease4::addr_>
+        >
+    >
+> PackedLease4Container;
+
+/// @brief Compact storage of the DHCPv4 leases for the Memfile backend.
+///
+/// This is an alternative to the @c Lease4Storage, which holds the leases
+/// as @c Lease4 objects. The packed storage holds them as @c PackedLease4
+/// structures, and the HW addresses, client identifiers and hostnames are
+/// shared between the leases. This significantly reduces the memory used
+/// per lease, which matters for deployments with millions of leases, and
+/// makes the lookups more cache friendly. The @c Lease4 objects are created
+/// (materialized) only when the leases are returned to the caller.
+///
+/// The storage provides @c find, @c end, @c insert, @c erase, @c replace
+/// and @c clear methods compatible with the @c Lease4Storage, so it can be
+/// populated by the @c LeaseFileLoader.
+///
+/// This class is not thread safe. The caller must serialize access to it.
+class PackedLease4Storage : public boost::noncopyable {
+public:
+
+    /// @brief Iterator over the leases in the storage.
+    typedef PackedLease4Container::iterator iterator;
+
+    /// @brief Constructor.
+    PackedLease4Storage();
+
+    /// @brief Destructor.
+    ~PackedLease4Storage();
+
+    /// @name Methods used by the @c LeaseFileLoader.
+    //@{
+
+    /// @brief Finds the lease by address.
+    ///
+    /// @param addr IPv4 address.
+    /// @return Iterator pointing to the lease or @c end().
+    iterator find(const asiolink::IOAddress& addr);
+
+    /// @brief Returns the iterator past the last lease.
+    iterator end();
+
+    /// @brief Inserts the lease.
+    ///
+    /// @param lease Lease to be inserted.
+    /// @return true if the lease has been inserted, false if there is
+    /// another lease for the same address.
+    bool insert(const Lease4Ptr& lease);
+
+    /// @brief Removes the lease.
+    ///
+    /// @param it Iterator pointing to the lease.
+    void erase(iterator it);
+
+    /// @brief Replaces the lease.
+    ///
+    /// @param it Iterator pointing to the lease.
+    /// @param lease New lease for the same address.
+    /// @return true if the lease has been replaced.
+    bool replace(iterator it, const Lease4Ptr& lease);
+
+    /// @brief Removes all leases.
+    void clear();
+
+    //@}
+
+    /// @brief Returns the number of leases.
+    size_t size() const;
+
+    /// @brief Returns the number of distinct HW addresses, client
+    /// identifiers and hostnames held in the storage.
+    size_t getBlobCount() const;
+
+    /// @brief Returns the addresses of all leases.
+    ///
+    /// @param [out] addresses Vector to which the addresses are appended.
+    void getAddresses(std::vector<asiolink::IOAddress>& addresses) const;
+
+    /// @brief Creates the @c Lease4 object from the packed lease.
+    ///
+    /// @param packed Packed lease.
+    Lease4Ptr materialize(const PackedLease4& packed) const;
+
+    /// @name Lookups returning materialized leases.
+    //@{
+
+    /// @brief Returns the lease for the address.
+    ///
+    /// @param addr IPv4 address.
+    Lease4Ptr get(const asiolink::IOAddress& addr) const;
+
+    /// @brief Returns all leases for the HW address.
+    ///
+    /// @param hwaddr HW address.
+    Lease4Collection getByHWAddr(const HWAddr& hwaddr) const;
+
+    /// @brief Returns the lease for the HW address in the subnet.
+    ///
+    /// If there are multiple such leases the one with the lowest address
+    /// is returned.
+    ///
+    /// @param hwaddr HW address.
+    /// @param subnet_id Subnet identifier.
+    Lease4Ptr getByHWAddr(const HWAddr& hwaddr, const SubnetID subnet_id) const;
+
+    /// @brief Returns all leases for the client identifier.
+    ///
+    /// @param client_id Client identifier.
+    Lease4Collection getByClientId(const ClientId& client_id) const;
+
+    /// @brief Returns the lease for the client identifier in the subnet.
+    ///
+    /// If there are multiple such leases the one with the lowest address
+    /// is returned.
+    ///
+    /// @param client_id Client identifier.
+    /// @param subnet_id Subnet identifier.
+    Lease4Ptr getByClientId(const ClientId& client_id,
+                            const SubnetID subnet_id) const;
+
+    /// @brief Returns the lease for the client identifier and HW address in
+    /// the subnet.
+    ///
+    /// @param client_id Client identifier.
+    /// @param hwaddr HW address.
+    /// @param subnet_id Subnet identifier.
+    Lease4Ptr getByClientId(const ClientId& client_id, const HWAddr& hwaddr,
+                            const SubnetID subnet_id) const;
+
+    /// @brief Returns all leases.
+    Lease4Collection getAll() const;
+
+    /// @brief Returns the leases with the lowest addresses above the lower
+    /// bound, in the ascending order of addresses.
+    ///
+    /// @param lower_bound_address Address preceding the returned leases.
+    /// @param page_size Maximum number of leases returned.
+    Lease4Collection getPage(const asiolink::IOAddress& lower_bound_address,
+                             const size_t page_size) const;
+
+    /// @brief Returns all leases in the subnet.
+    ///
+    /// @param subnet_id Subnet identifier.
+    Lease4Collection getBySubnetId(const SubnetID subnet_id) const;
+
+    /// @brief Returns the expired leases which haven't been reclaimed.
+    ///
+    /// @param [out] expired_leases Collection to which the leases are
+    /// appended.
+    /// @param max_leases Maximum number of leases to be returned or 0 for
+    /// no limit.
+    void getExpired(Lease4Collection& expired_leases,
+                    const size_t max_leases) const;
+
+    //@}
+
+    /// @brief Removes the reclaimed leases which expired long enough ago.
+    ///
+    /// @param secs Number of seconds since the expiration after which the
+    /// reclaimed lease is removed.
+    /// @param [out] removed Collection to which the removed leases are
+    /// appended.
+    void eraseExpiredReclaimed(const uint32_t secs, Lease4Collection& removed);
+
+    /// @brief Counts the assigned and declined leases in each subnet.
+    ///
+    /// @return One row per subnet for each of the assigned and declined
+    /// states, ordered by subnet identifier.
+    std::vector<LeaseStatsRow> getLeaseStats() const;
+
+private:
+
+    /// @brief Creates the packed lease, acquiring the values from the pool.
+    ///
+    /// @param lease Lease to be packed.
+    PackedLease4 pack(const Lease4& lease);
+
+    /// @brief Releases the values referred to by the packed lease.
+    ///
+    /// @param packed Packed lease.
+    void release(const PackedLease4& packed);
+
+    /// @brief Looks up the HW address in the pool.
+    ///
+    /// @param hwaddr HW address.
+    /// @param [out] blob Pointer to the value in the pool or null pointer
+    /// if the HW address is empty.
+    /// @return false if the non-empty HW address is not in the pool, i.e.
+    /// no lease has it.
+    bool findHWAddr(const HWAddr& hwaddr, const LeaseBlob*& blob) const;
+
+    /// @brief Packed leases.
+    PackedLease4Container leases_;
+
+    /// @brief HW addresses, client identifiers and hostnames.
+    LeaseBlobPool blobs_;
+};
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
+
+#endif // MEMFILE_PACKED_LEASE_STORAGE_H
@@ -8,6 +8,7 @@
 #include <dhcpsrv/dhcpsrv_log.h>
 #include <dhcpsrv/mysql_connection.h>
 #include <exceptions/exceptions.h>
+#include <util/threads/sync.h>
 
 #include <boost/lexical_cast.hpp>
 
@@ -20,6 +21,16 @@ using namespace isc;
 using namespace isc::dhcp;
 using namespace std;
 
+namespace {
+
+/// @brief Mutex serializing the initialization of the MySQL library.
+isc::util::thread::Mutex library_mutex;
+
+/// @brief Number of the open MySQL handles.
+size_t library_users = 0;
+
+}
+
 namespace isc {
 namespace dhcp {
 
@@ -31,6 +42,26 @@ const int MLM_MYSQL_FETCH_FAILURE = 1;
 /// @todo: Migrate this default value to src/bin/dhcpX/simple_parserX.cc
 const int MYSQL_DEFAULT_CONNECTION_TIMEOUT = 5; // seconds
 
+MySqlHolder::MySqlHolder() : mysql_(NULL) {
+    // The library is initialized by the first call to mysql_init(),
+    // which is not thread safe.
+    isc::util::thread::Mutex::Locker lock(library_mutex);
+    mysql_ = mysql_init(NULL);
+    if (mysql_ == NULL) {
+        isc_throw(DbOpenError, "unable to initialize MySQL");
+    }
+    ++library_users;
+}
+
+MySqlHolder::~MySqlHolder() {
+    isc::util::thread::Mutex::Locker lock(library_mutex);
+    mysql_close(mysql_);
+    // The library itself shouldn't be needed anymore
+    if (--library_users == 0) {
+        mysql_library_end();
+    }
+}
+
 MySqlTransaction::MySqlTransaction(MySqlConnection& conn)
     : conn_(conn), committed_(false) {
     conn_.startTransaction();
@@ -366,6 +397,36 @@ MySqlConnection::convertFromDatabaseTime(const MYSQL_TIME& expire,
     cltt = mktime(&expire_tm) - valid_lifetime;
 }
 
+void
+MySqlConnection::initThread() {
+    isc::util::thread::Mutex::Locker lock(library_mutex);
+    // The library must be initialized before the thread, which counts as
+    // a user so the library is not released before the thread ends.
+    if (mysql_library_init(0, NULL, NULL) == 0) {
+        mysql_thread_init();
+    }
+    ++library_users;
+}
+
+void
+MySqlConnection::endThread() {
+    isc::util::thread::Mutex::Locker lock(library_mutex);
+    mysql_thread_end();
+    if (--library_users == 0) {
+        mysql_library_end();
+    }
+}
+
+bool
+MySqlConnection::isUsable() const {
+    // The server may have closed the connection while it was idle, e.g.
+    // after its wait_timeout or upon a failover.
+    if (!unusable_ && (mysql_ping(mysql_) != 0)) {
+        unusable_ = true;
+    }
+    return (!unusable_);
+}
+
 void
 MySqlConnection::startTransaction() {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
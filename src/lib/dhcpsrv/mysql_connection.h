@@ -115,22 +115,14 @@ public:
     /// Initialize MySql and store the associated context object.
     ///
     /// @throw DbOpenError Unable to initialize MySql handle.
-    MySqlHolder() : mysql_(mysql_init(NULL)) {
-        if (mysql_ == NULL) {
-            isc_throw(DbOpenError, "unable to initialize MySQL");
-        }
-    }
+    MySqlHolder();
 
     /// @brief Destructor
     ///
-    /// Frees up resources allocated by the initialization of MySql.
-    ~MySqlHolder() {
-        if (mysql_ != NULL) {
-            mysql_close(mysql_);
-        }
-        // The library itself shouldn't be needed anymore
-        mysql_library_end();
-    }
+    /// Frees up resources allocated by the initialization of MySql. The
+    /// library itself is released with the last handle, as the handles
+    /// of a pool of connections are closed independently.
+    ~MySqlHolder();
 
     /// @brief Conversion Operator
     ///
@@ -215,7 +207,7 @@ public:
     ///
     /// Initialize MySqlConnection object with parameters needed for connection.
     MySqlConnection(const ParameterMap& parameters)
-        : DatabaseConnection(parameters) {
+        : DatabaseConnection(parameters), unusable_(false) {
     }
 
     /// @brief Destructor
@@ -357,13 +349,14 @@ public:
     ///
     /// If the error is recoverable, the method will throw a DbOperationError.
     /// In the error is deemed unrecoverable, such as a loss of connectivity
-    /// with the server, this method will log the error and call exit(-1);
+    /// with the server, this method will log the error and call exit(-1),
+    /// unless the loss of the connection is recoverable (see
+    /// @ref DatabaseConnection::setRecoverable). In this case, the connection
+    /// is marked unusable and a DbOperationError is thrown.
     ///
     /// @todo Calling exit() is viewed as a short term solution for Kea 1.0.
-    /// Two tickets are likely to alter this behavior, first is #3639, which
-    /// calls for the ability to attempt to reconnect to the database. The
-    /// second ticket, #4087 which calls for the implementation of a generic,
-    /// FatalException class which will propagate outward.
+    /// Ticket #4087 calls for a generic FatalException class which would
+    /// propagate outward instead.
     ///
     /// @param status Status code: non-zero implies an error
     /// @param index Index of statement that caused the error
@@ -389,6 +382,18 @@ public:
             case CR_SERVER_LOST:
             case CR_OUT_OF_MEMORY:
             case CR_CONNECTION_ERROR:
+                if (isRecoverable()) {
+                    LOG_ERROR(dhcpsrv_logger, DHCPSRV_MYSQL_CONNECTION_LOST)
+                        .arg(what)
+                        .arg(text_statements_[static_cast<int>(index)])
+                        .arg(mysql_error(mysql_))
+                        .arg(mysql_errno(mysql_));
+                    unusable_ = true;
+                    isc_throw(DbOperationError, "connection to the database"
+                              " lost: " << what << " for <"
+                              << text_statements_[static_cast<int>(index)]
+                              << ">, reason: " << mysql_error(mysql_));
+                }
                 // We're exiting on fatal
                 LOG_ERROR(dhcpsrv_logger, DHCPSRV_MYSQL_FATAL_ERROR)
                          .arg(what)
@@ -408,6 +413,28 @@ public:
         }
     }
 
+    /// @brief Checks if the connection can be used.
+    ///
+    /// Checks the connection with @c mysql_ping(), so a connection which
+    /// was dropped by the server while idle is detected.
+    ///
+    /// @return false if the connection was lost or failed with an
+    /// unrecoverable error, true otherwise.
+    bool isUsable() const;
+
+    /// @brief Initializes the MySQL client library for the calling thread.
+    ///
+    /// The threads other than the one which opened the connections must
+    /// call this function before they use a connection, e.g. when a packet
+    /// processing thread starts, and @ref endThread before they exit.
+    static void initThread();
+
+    /// @brief Releases the MySQL client library for the calling thread.
+    ///
+    /// The library itself is released if it isn't used by any connection
+    /// or thread anymore.
+    static void endThread();
+
     /// @brief Prepared statements
     ///
     /// This field is public, because it is used heavily from MySqlConnection
@@ -425,6 +452,12 @@ public:
     /// This field is public, because it is used heavily from MySqlConnection
     /// and will be from MySqlHostDataSource.
     MySqlHolder mysql_;
+
+private:
+
+    /// @brief Indicates if the connection failed with an unrecoverable
+    /// error.
+    mutable bool unusable_;
 };
 
 }; // end of isc::dhcp namespace
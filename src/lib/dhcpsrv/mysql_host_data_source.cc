@@ -21,6 +21,7 @@
 #include <boost/algorithm/string/split.hpp>
 #include <boost/algorithm/string/classification.hpp>
 #include <boost/array.hpp>
+#include <boost/bind.hpp>
 #include <boost/pointer_cast.hpp>
 #include <boost/static_assert.hpp>
 
@@ -1785,6 +1786,11 @@ public:
     /// @brief Destructor.
     ~MySqlHostDataSourceImpl();
 
+    /// @brief Checks if the connection can be used.
+    bool isUsable() const {
+        return (conn_.isUsable());
+    }
+
     /// @brief Executes statements which inserts a row into one of the tables.
     ///
     /// @param stindex Index of a statement being executed.
@@ -2140,6 +2146,9 @@ MySqlHostDataSourceImpl(const MySqlConnection::ParameterMap& parameters)
       conn_(parameters),
       is_readonly_(false) {
 
+    // A lost connection is replaced by the pool of the host data source.
+    conn_.setRecoverable(true);
+
     // Open the database.
     conn_.openDatabase();
 
@@ -2402,45 +2411,59 @@ MySqlHostDataSourceImpl::checkReadOnly() const {
 
 MySqlHostDataSource::
 MySqlHostDataSource(const MySqlConnection::ParameterMap& parameters)
-    : impl_(new MySqlHostDataSourceImpl(parameters)) {
+    : parameters_(parameters), pool_() {
+    // The pool opens the first connection.
+    pool_.reset(new MySqlHostContextPool(
+        boost::bind(&MySqlHostDataSource::createContext, this),
+        DatabaseConnection::getUint32Parameter(parameters,
+                                               "connection-pool-size", 1),
+        DatabaseConnection::getUint32Parameter(parameters,
+                                               "reconnect-wait-time", 1000)));
 }
 
 MySqlHostDataSource::~MySqlHostDataSource() {
-    delete impl_;
+}
+
+boost::shared_ptr<MySqlHostDataSourceImpl>
+MySqlHostDataSource::createContext() const {
+    return (boost::shared_ptr<MySqlHostDataSourceImpl>
+            (new MySqlHostDataSourceImpl(parameters_)));
 }
 
 void
 MySqlHostDataSource::add(const HostPtr& host) {
+    MySqlHostContextPool::Holder impl(*pool_);
+
     // If operating in read-only mode, throw exception.
-    impl_->checkReadOnly();
+    impl->checkReadOnly();
 
     // Initiate MySQL transaction as we will have to make multiple queries
     // to insert host information into multiple tables. If that fails on
     // any stage, the transaction will be rolled back by the destructor of
     // the MySqlTransaction class.
-    MySqlTransaction transaction(impl_->conn_);
+    MySqlTransaction transaction(impl->conn_);
 
     // Create the MYSQL_BIND array for the host
-    std::vector<MYSQL_BIND> bind = impl_->host_exchange_->createBindForSend(host);
+    std::vector<MYSQL_BIND> bind = impl->host_exchange_->createBindForSend(host);
 
     // ... and insert the host.
-    impl_->addStatement(MySqlHostDataSourceImpl::INSERT_HOST, bind);
+    impl->addStatement(MySqlHostDataSourceImpl::INSERT_HOST, bind);
 
     // Gets the last inserted hosts id
-    uint64_t host_id = mysql_insert_id(impl_->conn_.mysql_);
+    uint64_t host_id = mysql_insert_id(impl->conn_.mysql_);
 
     // Insert DHCPv4 options.
     ConstCfgOptionPtr cfg_option4 = host->getCfgOption4();
     if (cfg_option4) {
-        impl_->addOptions(MySqlHostDataSourceImpl::INSERT_V4_OPTION,
-                          cfg_option4, host_id);
+        impl->addOptions(MySqlHostDataSourceImpl::INSERT_V4_OPTION,
+                         cfg_option4, host_id);
     }
 
     // Insert DHCPv6 options.
     ConstCfgOptionPtr cfg_option6 = host->getCfgOption6();
     if (cfg_option6) {
-        impl_->addOptions(MySqlHostDataSourceImpl::INSERT_V6_OPTION,
-                          cfg_option6, host_id);
+        impl->addOptions(MySqlHostDataSourceImpl::INSERT_V6_OPTION,
+                         cfg_option6, host_id);
     }
 
     // Insert IPv6 reservations.
@@ -2448,7 +2471,7 @@ MySqlHostDataSource::add(const HostPtr& host) {
     if (std::distance(v6resv.first, v6resv.second) > 0) {
         for (IPv6ResrvIterator resv = v6resv.first; resv != v6resv.second;
              ++resv) {
-            impl_->addResv(resv->second, host_id);
+            impl->addResv(resv->second, host_id);
         }
     }
 
@@ -2458,8 +2481,10 @@ MySqlHostDataSource::add(const HostPtr& host) {
 
 bool
 MySqlHostDataSource::del(const SubnetID& subnet_id, const asiolink::IOAddress& addr) {
+    MySqlHostContextPool::Holder impl(*pool_);
+
     // If operating in read-only mode, throw exception.
-    impl_->checkReadOnly();
+    impl->checkReadOnly();
 
     if (addr.isV4()) {
         // Set up the WHERE clause value
@@ -2477,7 +2502,7 @@ MySqlHostDataSource::del(const SubnetID& subnet_id, const asiolink::IOAddress& a
         inbind[1].is_unsigned = MLM_TRUE;
 
         ConstHostCollection collection;
-        return (impl_->delStatement(MySqlHostDataSourceImpl::DEL_HOST_ADDR4, inbind));
+        return (impl->delStatement(MySqlHostDataSourceImpl::DEL_HOST_ADDR4, inbind));
     }
 
     // v6
@@ -2495,8 +2520,10 @@ bool
 MySqlHostDataSource::del4(const SubnetID& subnet_id,
                           const Host::IdentifierType& identifier_type,
                           const uint8_t* identifier_begin, const size_t identifier_len) {
+    MySqlHostContextPool::Holder impl(*pool_);
+
     // If operating in read-only mode, throw exception.
-    impl_->checkReadOnly();
+    impl->checkReadOnly();
 
     // Set up the WHERE clause value
     MYSQL_BIND inbind[3];
@@ -2524,15 +2551,17 @@ MySqlHostDataSource::del4(const SubnetID& subnet_id,
     inbind[2].length = &length;
 
     ConstHostCollection collection;
-    return (impl_->delStatement(MySqlHostDataSourceImpl::DEL_HOST_SUBID4_ID, inbind));
+    return (impl->delStatement(MySqlHostDataSourceImpl::DEL_HOST_SUBID4_ID, inbind));
 }
 
 bool
 MySqlHostDataSource::del6(const SubnetID& subnet_id,
                           const Host::IdentifierType& identifier_type,
                           const uint8_t* identifier_begin, const size_t identifier_len) {
+    MySqlHostContextPool::Holder impl(*pool_);
+
     // If operating in read-only mode, throw exception.
-    impl_->checkReadOnly();
+    impl->checkReadOnly();
 
     // Set up the WHERE clause value
     MYSQL_BIND inbind[3];
@@ -2560,7 +2589,7 @@ MySqlHostDataSource::del6(const SubnetID& subnet_id,
     inbind[2].length = &length;
 
     ConstHostCollection collection;
-    return (impl_->delStatement(MySqlHostDataSourceImpl::DEL_HOST_SUBID6_ID, inbind));
+    return (impl->delStatement(MySqlHostDataSourceImpl::DEL_HOST_SUBID6_ID, inbind));
 }
 
 ConstHostCollection
@@ -2584,6 +2613,8 @@ ConstHostCollection
 MySqlHostDataSource::getAll(const Host::IdentifierType& identifier_type,
                             const uint8_t* identifier_begin,
                             const size_t identifier_len) const {
+    MySqlHostContextPool::Holder impl(*pool_);
+
     // Set up the WHERE clause value
     MYSQL_BIND inbind[2];
     memset(inbind, 0, sizeof(inbind));
@@ -2604,14 +2635,15 @@ MySqlHostDataSource::getAll(const Host::IdentifierType& identifier_type,
     inbind[0].length = &length;
 
     ConstHostCollection result;
-    impl_->getHostCollection(MySqlHostDataSourceImpl::GET_HOST_DHCPID, inbind,
-                             impl_->host_ipv46_exchange_,
+    impl->getHostCollection(MySqlHostDataSourceImpl::GET_HOST_DHCPID, inbind,
+                            impl->host_ipv46_exchange_,
                              result, false);
     return (result);
 }
 
 ConstHostCollection
 MySqlHostDataSource::getAll4(const asiolink::IOAddress& address) const {
+    MySqlHostContextPool::Holder impl(*pool_);
 
     // Set up the WHERE clause value
     MYSQL_BIND inbind[1];
@@ -2623,8 +2655,8 @@ MySqlHostDataSource::getAll4(const asiolink::IOAddress& address) const {
     inbind[0].is_unsigned = MLM_TRUE;
 
     ConstHostCollection result;
-    impl_->getHostCollection(MySqlHostDataSourceImpl::GET_HOST_ADDR, inbind,
-                             impl_->host_exchange_, result, false);
+    impl->getHostCollection(MySqlHostDataSourceImpl::GET_HOST_ADDR, inbind,
+                            impl->host_exchange_, result, false);
 
     return (result);
 }
@@ -2661,15 +2693,18 @@ MySqlHostDataSource::get4(const SubnetID& subnet_id,
                           const Host::IdentifierType& identifier_type,
                           const uint8_t* identifier_begin,
                           const size_t identifier_len) const {
+    MySqlHostContextPool::Holder impl(*pool_);
 
-    return (impl_->getHost(subnet_id, identifier_type, identifier_begin,
+    return (impl->getHost(subnet_id, identifier_type, identifier_begin,
                    identifier_len, MySqlHostDataSourceImpl::GET_HOST_SUBID4_DHCPID,
-                   impl_->host_exchange_));
+                   impl->host_exchange_));
 }
 
 ConstHostPtr
 MySqlHostDataSource::get4(const SubnetID& subnet_id,
                           const asiolink::IOAddress& address) const {
+    MySqlHostContextPool::Holder impl(*pool_);
+
     /// @todo: check that address is really v4, not v6.
 
     // Set up the WHERE clause value
@@ -2686,8 +2721,8 @@ MySqlHostDataSource::get4(const SubnetID& subnet_id,
     inbind[1].is_unsigned = MLM_TRUE;
 
     ConstHostCollection collection;
-    impl_->getHostCollection(MySqlHostDataSourceImpl::GET_HOST_SUBID_ADDR,
-                             inbind, impl_->host_exchange_, collection, true);
+    impl->getHostCollection(MySqlHostDataSourceImpl::GET_HOST_SUBID_ADDR,
+                            inbind, impl->host_exchange_, collection, true);
 
     // Return single record if present, else clear the host.
     ConstHostPtr result;
@@ -2728,15 +2763,18 @@ MySqlHostDataSource::get6(const SubnetID& subnet_id,
                           const Host::IdentifierType& identifier_type,
                           const uint8_t* identifier_begin,
                           const size_t identifier_len) const {
+    MySqlHostContextPool::Holder impl(*pool_);
 
-    return (impl_->getHost(subnet_id, identifier_type, identifier_begin,
+    return (impl->getHost(subnet_id, identifier_type, identifier_begin,
                    identifier_len, MySqlHostDataSourceImpl::GET_HOST_SUBID6_DHCPID,
-                   impl_->host_ipv6_exchange_));
+                   impl->host_ipv6_exchange_));
 }
 
 ConstHostPtr
 MySqlHostDataSource::get6(const asiolink::IOAddress& prefix,
                           const uint8_t prefix_len) const {
+    MySqlHostContextPool::Holder impl(*pool_);
+
     /// @todo: Check that prefix is v6 address, not v4.
 
     // Set up the WHERE clause value
@@ -2760,8 +2798,8 @@ MySqlHostDataSource::get6(const asiolink::IOAddress& prefix,
 
 
     ConstHostCollection collection;
-    impl_->getHostCollection(MySqlHostDataSourceImpl::GET_HOST_PREFIX,
-                             inbind, impl_->host_ipv6_exchange_,
+    impl->getHostCollection(MySqlHostDataSourceImpl::GET_HOST_PREFIX,
+                            inbind, impl->host_ipv6_exchange_,
                              collection, true);
 
     // Return single record if present, else clear the host.
@@ -2776,6 +2814,8 @@ MySqlHostDataSource::get6(const asiolink::IOAddress& prefix,
 ConstHostPtr
 MySqlHostDataSource::get6(const SubnetID& subnet_id,
                           const asiolink::IOAddress& address) const {
+    MySqlHostContextPool::Holder impl(*pool_);
+
     // Set up the WHERE clause value
     MYSQL_BIND inbind[2];
     memset(inbind, 0, sizeof(inbind));
@@ -2795,8 +2835,8 @@ MySqlHostDataSource::get6(const SubnetID& subnet_id,
     inbind[1].buffer_length = addr6_length;
 
     ConstHostCollection collection;
-    impl_->getHostCollection(MySqlHostDataSourceImpl::GET_HOST_SUBID6_ADDR,
-                             inbind, impl_->host_ipv6_exchange_,
+    impl->getHostCollection(MySqlHostDataSourceImpl::GET_HOST_SUBID6_ADDR,
+                            inbind, impl->host_ipv6_exchange_,
                              collection, true);
 
     // Return single record if present, else clear the host.
@@ -2812,13 +2852,10 @@ MySqlHostDataSource::get6(const SubnetID& subnet_id,
 // Miscellaneous database methods.
 
 std::string MySqlHostDataSource::getName() const {
-    std::string name = "";
-    try {
-        name = impl_->conn_.getParameter("name");
-    } catch (...) {
-        // Return an empty name
-    }
-    return (name);
+    // Return an empty name if it is not specified.
+    DatabaseConnection::ParameterMap::const_iterator param =
+        parameters_.find("name");
+    return (param != parameters_.end() ? param->second : std::string(""));
 }
 
 std::string MySqlHostDataSource::getDescription() const {
@@ -2827,6 +2864,8 @@ std::string MySqlHostDataSource::getDescription() const {
 }
 
 std::pair<uint32_t, uint32_t> MySqlHostDataSource::getVersion() const {
+    MySqlHostContextPool::Holder impl(*pool_);
+
     const MySqlHostDataSourceImpl::StatementIndex stindex =
         MySqlHostDataSourceImpl::GET_VERSION;
 
@@ -2837,11 +2876,11 @@ std::pair<uint32_t, uint32_t> MySqlHostDataSource::getVersion() const {
     uint32_t minor;      // Minor version number
 
     // Execute the prepared statement
-    int status = mysql_stmt_execute(impl_->conn_.statements_[stindex]);
+    int status = mysql_stmt_execute(impl->conn_.statements_[stindex]);
     if (status != 0) {
         isc_throw(DbOperationError, "unable to execute <"
-                  << impl_->conn_.text_statements_[stindex]
-                  << "> - reason: " << mysql_error(impl_->conn_.mysql_));
+                  << impl->conn_.text_statements_[stindex]
+                  << "> - reason: " << mysql_error(impl->conn_.mysql_));
     }
 
     // Bind the output of the statement to the appropriate variables.
@@ -2858,20 +2897,20 @@ std::pair<uint32_t, uint32_t> MySqlHostDataSource::getVersion() const {
     bind[1].buffer = &minor;
     bind[1].buffer_length = sizeof(minor);
 
-    status = mysql_stmt_bind_result(impl_->conn_.statements_[stindex], bind);
+    status = mysql_stmt_bind_result(impl->conn_.statements_[stindex], bind);
     if (status != 0) {
         isc_throw(DbOperationError, "unable to bind result set: "
-                  << mysql_error(impl_->conn_.mysql_));
+                  << mysql_error(impl->conn_.mysql_));
     }
 
     // Fetch the data and set up the "release" object to release associated
     // resources when this method exits then retrieve the data.
     // mysql_stmt_fetch return value other than 0 means error occurrence.
-    MySqlFreeResult fetch_release(impl_->conn_.statements_[stindex]);
-    status = mysql_stmt_fetch(impl_->conn_.statements_[stindex]);
+    MySqlFreeResult fetch_release(impl->conn_.statements_[stindex]);
+    status = mysql_stmt_fetch(impl->conn_.statements_[stindex]);
     if (status != 0) {
         isc_throw(DbOperationError, "unable to obtain result set: "
-                  << mysql_error(impl_->conn_.mysql_));
+                  << mysql_error(impl->conn_.mysql_));
     }
 
     return (std::make_pair(major, minor));
@@ -2879,17 +2918,21 @@ std::pair<uint32_t, uint32_t> MySqlHostDataSource::getVersion() const {
 
 void
 MySqlHostDataSource::commit() {
+    MySqlHostContextPool::Holder impl(*pool_);
+
     // If operating in read-only mode, throw exception.
-    impl_->checkReadOnly();
-    impl_->conn_.commit();
+    impl->checkReadOnly();
+    impl->conn_.commit();
 }
 
 
 void
 MySqlHostDataSource::rollback() {
+    MySqlHostContextPool::Holder impl(*pool_);
+
     // If operating in read-only mode, throw exception.
-    impl_->checkReadOnly();
-    impl_->conn_.rollback();
+    impl->checkReadOnly();
+    impl->conn_.rollback();
 }
 
 
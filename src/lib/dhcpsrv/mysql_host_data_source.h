@@ -8,8 +8,11 @@
 #define MYSQL_HOST_DATA_SOURCE_H
 
 #include <dhcpsrv/base_host_data_source.h>
+#include <dhcpsrv/database_connection.h>
 #include <dhcpsrv/db_exceptions.h>
 #include <dhcpsrv/mysql_connection.h>
+#include <boost/scoped_ptr.hpp>
+#include <boost/shared_ptr.hpp>
 
 namespace isc {
 namespace dhcp {
@@ -17,6 +20,12 @@ namespace dhcp {
 /// Forward declaration to the implementation of the @ref MySqlHostDataSource.
 class MySqlHostDataSourceImpl;
 
+/// @brief Pool of the connections of the MySQL host data source.
+///
+/// Each connection has its own implementation object holding the prepared
+/// statements and the exchange objects.
+typedef DatabaseConnectionPool<MySqlHostDataSourceImpl> MySqlHostContextPool;
+
 /// @brief MySQL Host Data Source
 ///
 /// This class implements the @ref isc::dhcp::BaseHostDataSource interface to
@@ -33,12 +42,21 @@ public:
     /// - host - Host to which to connect (optional, defaults to "localhost")
     /// - user - Username under which to connect (optional)
     /// - password - Password for "user" on the database (optional)
+    /// - connection-pool-size - Maximum number of connections to the
+    ///   database, used concurrently by the threads (optional, defaults
+    ///   to 1)
+    /// - reconnect-wait-time - Time in milliseconds to wait after a failure
+    ///   to open a connection before the next attempt, doubled after each
+    ///   consecutive failure (optional, defaults to 1000)
     ///
     /// If the database is successfully opened, the version number in the
     /// schema_version table will be checked against hard-coded value in
     /// the implementation file.
     ///
-    /// Finally, all the SQL commands are pre-compiled.
+    /// Finally, all the SQL commands are pre-compiled. The other connections
+    /// of the pool are opened when needed, with their own prepared
+    /// statements. A lost connection is replaced by a new one rather than
+    /// being fatal.
     ///
     /// @param parameters A data structure relating keywords and values
     ///        concerned with the database.
@@ -271,6 +289,13 @@ public:
         return (std::string("mysql"));
     }
 
+    /// @brief Indicates if the backend can be used concurrently.
+    ///
+    /// @return true as each thread uses a connection of the pool.
+    virtual bool isThreadSafe() const {
+        return (true);
+    }
+
     /// @brief Returns backend name.
     ///
     /// Each backend have specific name.
@@ -307,8 +332,19 @@ public:
 
 private:
 
-    /// @brief Pointer to the implementation of the @ref MySqlHostDataSource.
-    MySqlHostDataSourceImpl* impl_;
+    /// @brief Opens a connection to the database.
+    ///
+    /// Used by the pool to open its connections.
+    ///
+    /// @return implementation object owning the new connection.
+    boost::shared_ptr<MySqlHostDataSourceImpl> createContext() const;
+
+    /// @brief Database access parameters.
+    DatabaseConnection::ParameterMap parameters_;
+
+    /// @brief Pool of connections to the database, each with its own
+    /// implementation of the @ref MySqlHostDataSource.
+    boost::scoped_ptr<MySqlHostContextPool> pool_;
 };
 
 }
@@ -12,11 +12,14 @@
 #include <dhcpsrv/dhcpsrv_log.h>
 #include <dhcpsrv/mysql_lease_mgr.h>
 #include <dhcpsrv/mysql_connection.h>
+#include <dhcpsrv/processing_latency.h>
 
 #include <boost/array.hpp>
+#include <boost/bind.hpp>
 #include <boost/static_assert.hpp>
 #include <mysqld_error.h>
 
+#include <algorithm>
 #include <iostream>
 #include <iomanip>
 #include <limits.h>
@@ -84,18 +87,44 @@ const size_t HOSTNAME_MAX_LEN = 255;
 /// colon separators.
 const size_t ADDRESS6_TEXT_MAX_LEN = 39;
 
+/// @brief Number of addresses taken by the statements deleting a batch
+/// of leases.
+///
+/// MySQL has no array parameters, so the statements have a fixed number
+/// of placeholders. The unused placeholders repeat the last address.
+const size_t DELETE_BATCH_SIZE = 16;
+
+/// @brief Number of subnets taken by the statements fetching the lease
+/// statistics of selected subnets.
+///
+/// As for the deletion of leases, the unused placeholders repeat the
+/// last subnet.
+const size_t SUBNET_STATS_BATCH_SIZE = 32;
+
 boost::array<TaggedStatement, MySqlLeaseMgr::NUM_STATEMENTS>
 tagged_statements = { {
     {MySqlLeaseMgr::DELETE_LEASE4,
                     "DELETE FROM lease4 WHERE address = ?"},
+    {MySqlLeaseMgr::DELETE_LEASE4_BATCH,
+                    "DELETE FROM lease4 WHERE address IN "
+                        "(?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)"},
     {MySqlLeaseMgr::DELETE_LEASE4_STATE_EXPIRED,
                     "DELETE FROM lease4 "
                         "WHERE state = ? AND expire < ?"},
     {MySqlLeaseMgr::DELETE_LEASE6,
                     "DELETE FROM lease6 WHERE address = ?"},
+    {MySqlLeaseMgr::DELETE_LEASE6_BATCH,
+                    "DELETE FROM lease6 WHERE address IN "
+                        "(?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)"},
     {MySqlLeaseMgr::DELETE_LEASE6_STATE_EXPIRED,
                     "DELETE FROM lease6 "
                         "WHERE state = ? AND expire < ?"},
+    {MySqlLeaseMgr::GET_LEASE4,
+                    "SELECT address, hwaddr, client_id, "
+                        "valid_lifetime, expire, subnet_id, "
+                        "fqdn_fwd, fqdn_rev, hostname, "
+                        "state "
+                            "FROM lease4"},
     {MySqlLeaseMgr::GET_LEASE4_ADDR,
                     "SELECT address, hwaddr, client_id, "
                         "valid_lifetime, expire, subnet_id, "
@@ -140,6 +169,30 @@ tagged_statements = { {
                             "WHERE state != ? AND expire < ? "
                             "ORDER BY expire ASC "
                             "LIMIT ?"},
+    {MySqlLeaseMgr::GET_LEASE4_PAGE,
+                    "SELECT address, hwaddr, client_id, "
+                        "valid_lifetime, expire, subnet_id, "
+                        "fqdn_fwd, fqdn_rev, hostname, "
+                        "state "
+                            "FROM lease4 "
+                            "WHERE address > ? "
+                            "ORDER BY address "
+                            "LIMIT ?"},
+    {MySqlLeaseMgr::GET_LEASE4_SUBID,
+                    "SELECT address, hwaddr, client_id, "
+                        "valid_lifetime, expire, subnet_id, "
+                        "fqdn_fwd, fqdn_rev, hostname, "
+                        "state "
+                            "FROM lease4 "
+                            "WHERE subnet_id = ?"},
+    {MySqlLeaseMgr::GET_LEASE6,
+                    "SELECT address, duid, valid_lifetime, "
+                        "expire, subnet_id, pref_lifetime, "
+                        "lease_type, iaid, prefix_len, "
+                        "fqdn_fwd, fqdn_rev, hostname, "
+                        "hwaddr, hwtype, hwaddr_source, "
+                        "state "
+                            "FROM lease6"},
     {MySqlLeaseMgr::GET_LEASE6_ADDR,
                     "SELECT address, duid, valid_lifetime, "
                         "expire, subnet_id, pref_lifetime, "
@@ -179,6 +232,26 @@ tagged_statements = { {
                             "WHERE state != ? AND expire < ? "
                             "ORDER BY expire ASC "
                             "LIMIT ?"},
+    {MySqlLeaseMgr::GET_LEASE6_PAGE,
+                    "SELECT address, duid, valid_lifetime, "
+                        "expire, subnet_id, pref_lifetime, "
+                        "lease_type, iaid, prefix_len, "
+                        "fqdn_fwd, fqdn_rev, hostname, "
+                        "hwaddr, hwtype, hwaddr_source, "
+                        "state "
+                            "FROM lease6 "
+                            "WHERE address > ? "
+                            "ORDER BY address "
+                            "LIMIT ?"},
+    {MySqlLeaseMgr::GET_LEASE6_SUBID,
+                    "SELECT address, duid, valid_lifetime, "
+                        "expire, subnet_id, pref_lifetime, "
+                        "lease_type, iaid, prefix_len, "
+                        "fqdn_fwd, fqdn_rev, hostname, "
+                        "hwaddr, hwtype, hwaddr_source, "
+                        "state "
+                            "FROM lease6 "
+                            "WHERE subnet_id = ?"},
     {MySqlLeaseMgr::GET_VERSION,
                     "SELECT version, minor FROM schema_version"},
     {MySqlLeaseMgr::INSERT_LEASE4,
@@ -214,6 +287,19 @@ tagged_statements = { {
     {MySqlLeaseMgr::RECOUNT_LEASE6_STATS,
      "SELECT subnet_id, lease_type, state, count(state) as state_count"
      "  FROM lease6 GROUP BY subnet_id, lease_type, state "
+     "  ORDER BY subnet_id" },
+    {MySqlLeaseMgr::SUBNET_LEASE4_STATS,
+     "SELECT subnet_id, state, count(state) as state_count "
+     "  FROM lease4 WHERE subnet_id IN "
+     "    (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, "
+     "     ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?) "
+     "  GROUP BY subnet_id, state ORDER BY subnet_id"},
+    {MySqlLeaseMgr::SUBNET_LEASE6_STATS,
+     "SELECT subnet_id, lease_type, state, count(state) as state_count"
+     "  FROM lease6 WHERE subnet_id IN "
+     "    (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, "
+     "     ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?) "
+     "  GROUP BY subnet_id, lease_type, state "
      "  ORDER BY subnet_id" }
     }
 };
@@ -1223,6 +1309,35 @@ private:
     uint32_t        state_;             ///< Lease state.
 };
 
+/// @brief Connection to the database with the exchange objects using it.
+///
+/// The contexts are held by the pool of connections of @c MySqlLeaseMgr.
+class MySqlLeaseContext : public boost::noncopyable {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param parameters database access parameters
+    MySqlLeaseContext(const DatabaseConnection::ParameterMap& parameters)
+        : conn_(parameters), exchange4_(new MySqlLease4Exchange()),
+          exchange6_(new MySqlLease6Exchange()) {
+    }
+
+    /// @brief Checks if the connection can be used.
+    bool isUsable() const {
+        return (conn_.isUsable());
+    }
+
+    /// @brief MySQL connection.
+    MySqlConnection conn_;
+
+    /// The exchange objects are used for transfer of data to/from the
+    /// database. They are pointed-to objects as the contents may change in
+    /// "const" calls.
+    boost::scoped_ptr<MySqlLease4Exchange> exchange4_; ///< Exchange object
+    boost::scoped_ptr<MySqlLease6Exchange> exchange6_; ///< Exchange object
+};
+
 /// @brief MySql derivation of the statistical lease data query
 ///
 /// This class is used to recalculate lease statistics for MySQL
@@ -1234,23 +1349,36 @@ class MySqlLeaseStatsQuery : public LeaseStatsQuery {
 public:
     /// @brief Constructor
     ///
-    /// @param conn A open connection to the database housing the lease data
+    /// The connection used by the query is held until the query is
+    /// destroyed, as the rows are fetched from the server.
+    ///
+    /// @param pool Pool of the connections to the database housing the
+    /// lease data
     /// @param statement_index Index of the query's prepared statement
     /// @param fetch_type Indicates if query supplies lease type
-    MySqlLeaseStatsQuery(MySqlConnection& conn, const size_t statement_index,
-                         const bool fetch_type)
-        : conn_(conn), statement_index_(statement_index), statement_(NULL),
+    /// @param subnet_ids Identifiers of the subnets to be examined. They
+    /// are passed to the statement in batches of
+    /// @c SUBNET_STATS_BATCH_SIZE, the statement being executed again
+    /// for each batch. The statement takes no parameters if this is empty.
+    MySqlLeaseStatsQuery(MySqlLeaseContextPool& pool,
+                         const size_t statement_index, const bool fetch_type,
+                         const SubnetIDSet& subnet_ids = SubnetIDSet())
+        : ctx_(pool), conn_(ctx_->conn_), statement_index_(statement_index),
+          statement_(NULL),
           fetch_type_(fetch_type),
           // Set the number of columns in the bind array based on fetch_type
           // This is the number of columns expected in the result set
           bind_(fetch_type_ ? 4 : 3),
+          subnet_ids_(subnet_ids.begin(), subnet_ids.end()), next_subnet_(0),
+          params_(subnet_ids.empty() ? 0 : SUBNET_STATS_BATCH_SIZE),
+          batch_(params_.size(), 0),
           subnet_id_(0), lease_type_(0), lease_state_(0), state_count_(0) {
         if (statement_index_ >= MySqlLeaseMgr::NUM_STATEMENTS) {
             isc_throw(BadValue, "MySqlLeaseStatsQuery"
                       " - invalid statement index" << statement_index_);
         }
 
-        statement_ = conn.statements_[statement_index_];
+        statement_ = conn_.statements_[statement_index_];
     }
 
     /// @brief Destructor
@@ -1300,14 +1428,15 @@ public:
         int status = mysql_stmt_bind_result(statement_, &bind_[0]);
         conn_.checkError(status, statement_index_, "outbound binding failed");
 
-        // Execute the statement
-        status = mysql_stmt_execute(statement_);
-        conn_.checkError(status, statement_index_, "unable to execute");
+        // The subnets of a batch are copied to the buffers bound here.
+        for (size_t i = 0; i < params_.size(); ++i) {
+            memset(&params_[i], 0, sizeof(params_[i]));
+            params_[i].buffer_type = MYSQL_TYPE_LONG;
+            params_[i].buffer = reinterpret_cast<char*>(&batch_[i]);
+            params_[i].is_unsigned = MLM_TRUE;
+        }
 
-        // Ensure that all the lease information is retrieved in one go to avoid
-        // overhead of going back and forth between client and server.
-        status = mysql_stmt_store_result(statement_);
-        conn_.checkError(status, statement_index_, "results storage failed");
+        execute();
     }
 
 
@@ -1325,6 +1454,14 @@ public:
     bool getNextRow(LeaseStatsRow& row) {
         bool have_row = false;
         int status = mysql_stmt_fetch(statement_);
+        // The subnets are sorted, so the rows of the next batch follow
+        // the rows of this one in the order of the subnets.
+        while ((status == MYSQL_NO_DATA) &&
+               (next_subnet_ < subnet_ids_.size())) {
+            (void) mysql_stmt_free_result(statement_);
+            execute();
+            status = mysql_stmt_fetch(statement_);
+        }
         if (status == MLM_MYSQL_FETCH_SUCCESS) {
             row.subnet_id_ = static_cast<SubnetID>(subnet_id_);
             row.lease_type_ = static_cast<Lease::Type>(lease_type_);
@@ -1339,6 +1476,35 @@ public:
     }
 
 private:
+    /// @brief Executes the statement and stores its result set.
+    ///
+    /// If the query examines selected subnets, the statement is given
+    /// the next batch of them.
+    void execute() {
+        int status = 0;
+        if (!subnet_ids_.empty()) {
+            for (size_t i = 0; i < batch_.size(); ++i) {
+                batch_[i] = subnet_ids_[std::min(next_subnet_ + i,
+                                                 subnet_ids_.size() - 1)];
+            }
+            next_subnet_ += batch_.size();
+            status = mysql_stmt_bind_param(statement_, &params_[0]);
+            conn_.checkError(status, statement_index_, "unable to bind");
+        }
+
+        // Execute the statement
+        status = mysql_stmt_execute(statement_);
+        conn_.checkError(status, statement_index_, "unable to execute");
+
+        // Ensure that all the lease information is retrieved in one go to avoid
+        // overhead of going back and forth between client and server.
+        status = mysql_stmt_store_result(statement_);
+        conn_.checkError(status, statement_index_, "results storage failed");
+    }
+
+    /// @brief Context of the connection acquired for the query
+    MySqlLeaseContextPool::Holder ctx_;
+
     /// @brief Database connection to use to execute the query
     MySqlConnection& conn_;
 
@@ -1354,6 +1520,18 @@ private:
     /// @brief Bind array used to store the query result set;
     std::vector<MYSQL_BIND> bind_;
 
+    /// @brief Identifiers of the subnets to be examined, sorted.
+    std::vector<uint32_t> subnet_ids_;
+
+    /// @brief Index of the first subnet of the next batch.
+    size_t next_subnet_;
+
+    /// @brief Bind array used to pass a batch of subnets.
+    std::vector<MYSQL_BIND> params_;
+
+    /// @brief Subnets of the current batch.
+    std::vector<uint32_t> batch_;
+
     /// @brief Receives subnet ID when fetching a row
     uint32_t subnet_id_;
     /// @brief Receives the lease type when fetching a row
@@ -1367,34 +1545,46 @@ private:
 // MySqlLeaseMgr Constructor and Destructor
 
 MySqlLeaseMgr::MySqlLeaseMgr(const MySqlConnection::ParameterMap& parameters)
-    : conn_(parameters) {
+    : parameters_(parameters), pool_() {
+    // The pool opens the first connection.
+    pool_.reset(new MySqlLeaseContextPool(
+        boost::bind(&MySqlLeaseMgr::createContext, this),
+        DatabaseConnection::getUint32Parameter(parameters,
+                                               "connection-pool-size", 1),
+        DatabaseConnection::getUint32Parameter(parameters,
+                                               "reconnect-wait-time", 1000)));
+}
+
+
+MySqlLeaseMgr::~MySqlLeaseMgr() {
+    // There is no need to close the database in this destructor: it is
+    // closed in the destructor of the mysql_ member variable.
+}
+
+MySqlLeaseContextPtr
+MySqlLeaseMgr::createContext() const {
+    MySqlLeaseContextPtr ctx(new MySqlLeaseContext(parameters_));
+
+    // A lost connection is replaced by the pool.
+    ctx->conn_.setRecoverable(true);
 
     // Open the database.
-    conn_.openDatabase();
+    ctx->conn_.openDatabase();
 
     // Enable autocommit.  To avoid a flush to disk on every commit, the global
     // parameter innodb_flush_log_at_trx_commit should be set to 2.  This will
     // cause the changes to be written to the log, but flushed to disk in the
     // background every second.  Setting the parameter to that value will speed
     // up the system, but at the risk of losing data if the system crashes.
-    my_bool result = mysql_autocommit(conn_.mysql_, 1);
+    my_bool result = mysql_autocommit(ctx->conn_.mysql_, 1);
     if (result != 0) {
-        isc_throw(DbOperationError, mysql_error(conn_.mysql_));
+        isc_throw(DbOperationError, mysql_error(ctx->conn_.mysql_));
     }
 
     // Prepare all statements likely to be used.
-    conn_.prepareStatements(tagged_statements.begin(), tagged_statements.end());
-
-    // Create the exchange objects for use in exchanging data between the
-    // program and the database.
-    exchange4_.reset(new MySqlLease4Exchange());
-    exchange6_.reset(new MySqlLease6Exchange());
-}
-
-
-MySqlLeaseMgr::~MySqlLeaseMgr() {
-    // There is no need to close the database in this destructor: it is
-    // closed in the destructor of the mysql_ member variable.
+    ctx->conn_.prepareStatements(tagged_statements.begin(),
+                                 tagged_statements.end());
+    return (ctx);
 }
 
 std::string
@@ -1411,24 +1601,25 @@ MySqlLeaseMgr::getDBVersion() {
 // statement, then call common code to execute the statement.
 
 bool
-MySqlLeaseMgr::addLeaseCommon(StatementIndex stindex,
+MySqlLeaseMgr::addLeaseCommon(MySqlLeaseContext& ctx,
+                              StatementIndex stindex,
                               std::vector<MYSQL_BIND>& bind) {
 
     // Bind the parameters to the statement
-    int status = mysql_stmt_bind_param(conn_.statements_[stindex], &bind[0]);
-    checkError(status, stindex, "unable to bind parameters");
+    int status = mysql_stmt_bind_param(ctx.conn_.statements_[stindex], &bind[0]);
+    checkError(ctx, status, stindex, "unable to bind parameters");
 
     // Execute the statement
-    status = mysql_stmt_execute(conn_.statements_[stindex]);
+    status = mysql_stmt_execute(ctx.conn_.statements_[stindex]);
     if (status != 0) {
 
         // Failure: check for the special case of duplicate entry.  If this is
         // the case, we return false to indicate that the row was not added.
         // Otherwise we throw an exception.
-        if (mysql_errno(conn_.mysql_) == ER_DUP_ENTRY) {
+        if (mysql_errno(ctx.conn_.mysql_) == ER_DUP_ENTRY) {
             return (false);
         }
-        checkError(status, stindex, "unable to execute");
+        checkError(ctx, status, stindex, "unable to execute");
     }
 
     // Insert succeeded
@@ -1437,27 +1628,33 @@ MySqlLeaseMgr::addLeaseCommon(StatementIndex stindex,
 
 bool
 MySqlLeaseMgr::addLease(const Lease4Ptr& lease) {
+    StageTimer timer(ProcessingLatency::STAGE_LEASE_WRITE);
+
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MYSQL_ADD_ADDR4).arg(lease->addr_.toText());
 
     // Create the MYSQL_BIND array for the lease
-    std::vector<MYSQL_BIND> bind = exchange4_->createBindForSend(lease);
+    MySqlLeaseContextPool::Holder ctx(*pool_);
+    std::vector<MYSQL_BIND> bind = ctx->exchange4_->createBindForSend(lease);
 
     // ... and drop to common code.
-    return (addLeaseCommon(INSERT_LEASE4, bind));
+    return (addLeaseCommon(*ctx, INSERT_LEASE4, bind));
 }
 
 bool
 MySqlLeaseMgr::addLease(const Lease6Ptr& lease) {
+    StageTimer timer(ProcessingLatency::STAGE_LEASE_WRITE);
+
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MYSQL_ADD_ADDR6).arg(lease->addr_.toText())
               .arg(lease->type_);
 
     // Create the MYSQL_BIND array for the lease
-    std::vector<MYSQL_BIND> bind = exchange6_->createBindForSend(lease);
+    MySqlLeaseContextPool::Holder ctx(*pool_);
+    std::vector<MYSQL_BIND> bind = ctx->exchange6_->createBindForSend(lease);
 
     // ... and drop to common code.
-    return (addLeaseCommon(INSERT_LEASE6, bind));
+    return (addLeaseCommon(*ctx, INSERT_LEASE6, bind));
 }
 
 // Extraction of leases from the database.
@@ -1486,75 +1683,77 @@ MySqlLeaseMgr::addLease(const Lease6Ptr& lease) {
 // holding zero or one leases into an appropriate Lease object.
 
 template <typename Exchange, typename LeaseCollection>
-void MySqlLeaseMgr::getLeaseCollection(StatementIndex stindex,
+void MySqlLeaseMgr::getLeaseCollection(MySqlLeaseContext& ctx,
+                                       StatementIndex stindex,
                                        MYSQL_BIND* bind,
                                        Exchange& exchange,
                                        LeaseCollection& result,
                                        bool single) const {
 
     // Bind the selection parameters to the statement
-    int status = mysql_stmt_bind_param(conn_.statements_[stindex], bind);
-    checkError(status, stindex, "unable to bind WHERE clause parameter");
+    int status = mysql_stmt_bind_param(ctx.conn_.statements_[stindex], bind);
+    checkError(ctx, status, stindex, "unable to bind WHERE clause parameter");
 
     // Set up the MYSQL_BIND array for the data being returned and bind it to
     // the statement.
     std::vector<MYSQL_BIND> outbind = exchange->createBindForReceive();
-    status = mysql_stmt_bind_result(conn_.statements_[stindex], &outbind[0]);
-    checkError(status, stindex, "unable to bind SELECT clause parameters");
+    status = mysql_stmt_bind_result(ctx.conn_.statements_[stindex], &outbind[0]);
+    checkError(ctx, status, stindex, "unable to bind SELECT clause parameters");
 
     // Execute the statement
-    status = mysql_stmt_execute(conn_.statements_[stindex]);
-    checkError(status, stindex, "unable to execute");
+    status = mysql_stmt_execute(ctx.conn_.statements_[stindex]);
+    checkError(ctx, status, stindex, "unable to execute");
 
     // Ensure that all the lease information is retrieved in one go to avoid
     // overhead of going back and forth between client and server.
-    status = mysql_stmt_store_result(conn_.statements_[stindex]);
-    checkError(status, stindex, "unable to set up for storing all results");
+    status = mysql_stmt_store_result(ctx.conn_.statements_[stindex]);
+    checkError(ctx, status, stindex, "unable to set up for storing all results");
 
     // Set up the fetch "release" object to release resources associated
     // with the call to mysql_stmt_fetch when this method exits, then
     // retrieve the data.
-    MySqlFreeResult fetch_release(conn_.statements_[stindex]);
+    MySqlFreeResult fetch_release(ctx.conn_.statements_[stindex]);
     int count = 0;
-    while ((status = mysql_stmt_fetch(conn_.statements_[stindex])) == 0) {
+    while ((status = mysql_stmt_fetch(ctx.conn_.statements_[stindex])) == 0) {
         try {
             result.push_back(exchange->getLeaseData());
 
         } catch (const isc::BadValue& ex) {
             // Rethrow the exception with a bit more data.
             isc_throw(BadValue, ex.what() << ". Statement is <" <<
-                      conn_.text_statements_[stindex] << ">");
+                      ctx.conn_.text_statements_[stindex] << ">");
         }
 
         if (single && (++count > 1)) {
             isc_throw(MultipleRecords, "multiple records were found in the "
                       "database where only one was expected for query "
-                      << conn_.text_statements_[stindex]);
+                      << ctx.conn_.text_statements_[stindex]);
         }
     }
 
     // How did the fetch end?
     if (status == 1) {
         // Error - unable to fetch results
-        checkError(status, stindex, "unable to fetch results");
+        checkError(ctx, status, stindex, "unable to fetch results");
     } else if (status == MYSQL_DATA_TRUNCATED) {
         // Data truncated - throw an exception indicating what was at fault
-        isc_throw(DataTruncated, conn_.text_statements_[stindex]
+        isc_throw(DataTruncated, ctx.conn_.text_statements_[stindex]
                   << " returned truncated data: columns affected are "
                   << exchange->getErrorColumns());
     }
 }
 
 
-void MySqlLeaseMgr::getLease(StatementIndex stindex, MYSQL_BIND* bind,
-                             Lease4Ptr& result) const {
+void MySqlLeaseMgr::getLease(MySqlLeaseContext& ctx, StatementIndex stindex,
+                             MYSQL_BIND* bind, Lease4Ptr& result) const {
     // Create appropriate collection object and get all leases matching
     // the selection criteria.  The "single" parameter is true to indicate
     // that the called method should throw an exception if multiple
     // matching records are found: this particular method is called when only
     // one or zero matches is expected.
     Lease4Collection collection;
-    getLeaseCollection(stindex, bind, exchange4_, collection, true);
+    getLeaseCollection(ctx, stindex, bind, ctx.exchange4_, collection,
+                       true);
 
     // Return single record if present, else clear the lease.
     if (collection.empty()) {
@@ -1565,15 +1764,16 @@ void MySqlLeaseMgr::getLease(StatementIndex stindex, MYSQL_BIND* bind,
 }
 
 
-void MySqlLeaseMgr::getLease(StatementIndex stindex, MYSQL_BIND* bind,
-                             Lease6Ptr& result) const {
+void MySqlLeaseMgr::getLease(MySqlLeaseContext& ctx, StatementIndex stindex,
+                             MYSQL_BIND* bind, Lease6Ptr& result) const {
     // Create appropriate collection object and get all leases matching
     // the selection criteria.  The "single" parameter is true to indicate
     // that the called method should throw an exception if multiple
     // matching records are found: this particular method is called when only
     // one or zero matches is expected.
     Lease6Collection collection;
-    getLeaseCollection(stindex, bind, exchange6_, collection, true);
+    getLeaseCollection(ctx, stindex, bind, ctx.exchange6_, collection,
+                       true);
 
     // Return single record if present, else clear the lease.
     if (collection.empty()) {
@@ -1584,6 +1784,21 @@ void MySqlLeaseMgr::getLease(StatementIndex stindex, MYSQL_BIND* bind,
 }
 
 
+void
+MySqlLeaseMgr::getLeaseCollection(MySqlLeaseContext& ctx,
+                                  StatementIndex stindex, MYSQL_BIND* bind,
+                                  Lease4Collection& result) const {
+    getLeaseCollection(ctx, stindex, bind, ctx.exchange4_, result);
+}
+
+void
+MySqlLeaseMgr::getLeaseCollection(MySqlLeaseContext& ctx,
+                                  StatementIndex stindex, MYSQL_BIND* bind,
+                                  Lease6Collection& result) const {
+    getLeaseCollection(ctx, stindex, bind, ctx.exchange6_, result);
+}
+
+
 // Basic lease access methods.  Obtain leases from the database using various
 // criteria.
 
@@ -1603,7 +1818,8 @@ MySqlLeaseMgr::getLease4(const isc::asiolink::IOAddress& addr) const {
 
     // Get the data
     Lease4Ptr result;
-    getLease(GET_LEASE4_ADDR, inbind, result);
+    MySqlLeaseContextPool::Holder ctx(*pool_);
+    getLease(*ctx, GET_LEASE4_ADDR, inbind, result);
 
     return (result);
 }
@@ -1633,7 +1849,8 @@ MySqlLeaseMgr::getLease4(const HWAddr& hwaddr) const {
 
     // Get the data
     Lease4Collection result;
-    getLeaseCollection(GET_LEASE4_HWADDR, inbind, result);
+    MySqlLeaseContextPool::Holder ctx(*pool_);
+    getLeaseCollection(*ctx, GET_LEASE4_HWADDR, inbind, result);
 
     return (result);
 }
@@ -1668,7 +1885,8 @@ MySqlLeaseMgr::getLease4(const HWAddr& hwaddr, SubnetID subnet_id) const {
 
     // Get the data
     Lease4Ptr result;
-    getLease(GET_LEASE4_HWADDR_SUBID, inbind, result);
+    MySqlLeaseContextPool::Holder ctx(*pool_);
+    getLease(*ctx, GET_LEASE4_HWADDR_SUBID, inbind, result);
 
     return (result);
 }
@@ -1692,7 +1910,8 @@ MySqlLeaseMgr::getLease4(const ClientId& clientid) const {
 
     // Get the data
     Lease4Collection result;
-    getLeaseCollection(GET_LEASE4_CLIENTID, inbind, result);
+    MySqlLeaseContextPool::Holder ctx(*pool_);
+    getLeaseCollection(*ctx, GET_LEASE4_CLIENTID, inbind, result);
 
     return (result);
 }
@@ -1730,12 +1949,88 @@ MySqlLeaseMgr::getLease4(const ClientId& clientid, SubnetID subnet_id) const {
 
     // Get the data
     Lease4Ptr result;
-    getLease(GET_LEASE4_CLIENTID_SUBID, inbind, result);
+    MySqlLeaseContextPool::Holder ctx(*pool_);
+    getLease(*ctx, GET_LEASE4_CLIENTID_SUBID, inbind, result);
 
     return (result);
 }
 
 
+Lease4Collection
+MySqlLeaseMgr::getLeases4(SubnetID subnet_id) const {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MYSQL_GET_SUBID4)
+        .arg(subnet_id);
+
+    // Set up the WHERE clause value
+    MYSQL_BIND inbind[1];
+    memset(inbind, 0, sizeof(inbind));
+
+    // Subnet ID
+    inbind[0].buffer_type = MYSQL_TYPE_LONG;
+    inbind[0].buffer = reinterpret_cast<char*>(&subnet_id);
+    inbind[0].is_unsigned = MLM_TRUE;
+
+    // ... and get the data
+    Lease4Collection result;
+    MySqlLeaseContextPool::Holder ctx(*pool_);
+    getLeaseCollection(*ctx, GET_LEASE4_SUBID, inbind, result);
+
+    return (result);
+}
+
+Lease4Collection
+MySqlLeaseMgr::getLeases4() const {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MYSQL_GET4);
+
+    // The query has no parameters, so the binding array is not used.
+    MYSQL_BIND inbind[1];
+    memset(inbind, 0, sizeof(inbind));
+
+    Lease4Collection result;
+    MySqlLeaseContextPool::Holder ctx(*pool_);
+    getLeaseCollection(*ctx, GET_LEASE4, inbind, result);
+
+    return (result);
+}
+
+Lease4Collection
+MySqlLeaseMgr::getLeases4(const asiolink::IOAddress& lower_bound_address,
+                          const LeasePageSize& page_size) const {
+    // Expecting IPv4 address.
+    if (!lower_bound_address.isV4()) {
+        isc_throw(InvalidParameter, "expected IPv4 address while "
+                  "retrieving leases from the lease database, got "
+                  << lower_bound_address);
+    }
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MYSQL_GET_PAGE4)
+        .arg(page_size.page_size_)
+        .arg(lower_bound_address.toText());
+
+    // Prepare WHERE clause
+    MYSQL_BIND inbind[2];
+    memset(inbind, 0, sizeof(inbind));
+
+    // Bind lower bound address
+    uint32_t lb_address_data = lower_bound_address.toUint32();
+    inbind[0].buffer_type = MYSQL_TYPE_LONG;
+    inbind[0].buffer = reinterpret_cast<char*>(&lb_address_data);
+    inbind[0].is_unsigned = MLM_TRUE;
+
+    // Bind page size value
+    uint32_t ps = static_cast<uint32_t>(page_size.page_size_);
+    inbind[1].buffer_type = MYSQL_TYPE_LONG;
+    inbind[1].buffer = reinterpret_cast<char*>(&ps);
+    inbind[1].is_unsigned = MLM_TRUE;
+
+    // Get the leases
+    Lease4Collection result;
+    MySqlLeaseContextPool::Holder ctx(*pool_);
+    getLeaseCollection(*ctx, GET_LEASE4_PAGE, inbind, result);
+
+    return (result);
+}
+
 Lease6Ptr
 MySqlLeaseMgr::getLease6(Lease::Type lease_type,
                          const isc::asiolink::IOAddress& addr) const {
@@ -1763,7 +2058,8 @@ MySqlLeaseMgr::getLease6(Lease::Type lease_type,
     inbind[1].is_unsigned = MLM_TRUE;
 
     Lease6Ptr result;
-    getLease(GET_LEASE6_ADDR, inbind, result);
+    MySqlLeaseContextPool::Holder ctx(*pool_);
+    getLease(*ctx, GET_LEASE6_ADDR, inbind, result);
 
     return (result);
 }
@@ -1812,7 +2108,8 @@ MySqlLeaseMgr::getLeases6(Lease::Type lease_type,
 
     // ... and get the data
     Lease6Collection result;
-    getLeaseCollection(GET_LEASE6_DUID_IAID, inbind, result);
+    MySqlLeaseContextPool::Holder ctx(*pool_);
+    getLeaseCollection(*ctx, GET_LEASE6_DUID_IAID, inbind, result);
 
     return (result);
 }
@@ -1857,7 +2154,93 @@ MySqlLeaseMgr::getLeases6(Lease::Type lease_type,
 
     // ... and get the data
     Lease6Collection result;
-    getLeaseCollection(GET_LEASE6_DUID_IAID_SUBID, inbind, result);
+    MySqlLeaseContextPool::Holder ctx(*pool_);
+    getLeaseCollection(*ctx, GET_LEASE6_DUID_IAID_SUBID, inbind, result);
+
+    return (result);
+}
+
+Lease6Collection
+MySqlLeaseMgr::getLeases6(SubnetID subnet_id) const {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MYSQL_GET_SUBID6)
+        .arg(subnet_id);
+
+    // Set up the WHERE clause value
+    MYSQL_BIND inbind[1];
+    memset(inbind, 0, sizeof(inbind));
+
+    // Subnet ID
+    inbind[0].buffer_type = MYSQL_TYPE_LONG;
+    inbind[0].buffer = reinterpret_cast<char*>(&subnet_id);
+    inbind[0].is_unsigned = MLM_TRUE;
+
+    // ... and get the data
+    Lease6Collection result;
+    MySqlLeaseContextPool::Holder ctx(*pool_);
+    getLeaseCollection(*ctx, GET_LEASE6_SUBID, inbind, result);
+
+    return (result);
+}
+
+Lease6Collection
+MySqlLeaseMgr::getLeases6() const {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MYSQL_GET6);
+
+    // The query has no parameters, so the binding array is not used.
+    MYSQL_BIND inbind[1];
+    memset(inbind, 0, sizeof(inbind));
+
+    Lease6Collection result;
+    MySqlLeaseContextPool::Holder ctx(*pool_);
+    getLeaseCollection(*ctx, GET_LEASE6, inbind, result);
+
+    return (result);
+}
+
+Lease6Collection
+MySqlLeaseMgr::getLeases6(const asiolink::IOAddress& lower_bound_address,
+                          const LeasePageSize& page_size) const {
+    // Expecting IPv6 address.
+    if (!lower_bound_address.isV6()) {
+        isc_throw(InvalidParameter, "expected IPv6 address while "
+                  "retrieving leases from the lease database, got "
+                  << lower_bound_address);
+    }
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MYSQL_GET_PAGE6)
+        .arg(page_size.page_size_)
+        .arg(lower_bound_address.toText());
+
+    // Prepare WHERE clause
+    MYSQL_BIND inbind[2];
+    memset(inbind, 0, sizeof(inbind));
+
+    // Bind lower bound address. The addresses are compared as text, so
+    // the zero address is replaced with the empty string which precedes
+    // all addresses.
+    std::string lb_address_data;
+    if (!lower_bound_address.isV6Zero()) {
+        lb_address_data = lower_bound_address.toText();
+    }
+    unsigned long lb_address_data_size = lb_address_data.size();
+
+    // See the earlier description of the use of "const_cast" when accessing
+    // the address for an explanation of the reason.
+    inbind[0].buffer_type = MYSQL_TYPE_STRING;
+    inbind[0].buffer = const_cast<char*>(lb_address_data.c_str());
+    inbind[0].buffer_length = lb_address_data_size;
+    inbind[0].length = &lb_address_data_size;
+
+    // Bind page size value
+    uint32_t ps = static_cast<uint32_t>(page_size.page_size_);
+    inbind[1].buffer_type = MYSQL_TYPE_LONG;
+    inbind[1].buffer = reinterpret_cast<char*>(&ps);
+    inbind[1].is_unsigned = MLM_TRUE;
+
+    // Get the leases
+    Lease6Collection result;
+    MySqlLeaseContextPool::Holder ctx(*pool_);
+    getLeaseCollection(*ctx, GET_LEASE6_PAGE, inbind, result);
 
     return (result);
 }
@@ -1895,7 +2278,7 @@ MySqlLeaseMgr::getExpiredLeasesCommon(LeaseCollection& expired_leases,
 
     // Expiration timestamp.
     MYSQL_TIME expire_time;
-    conn_.convertToDatabaseTime(time(NULL), expire_time);
+    MySqlConnection::convertToDatabaseTime(time(NULL), expire_time);
     inbind[1].buffer_type = MYSQL_TYPE_TIMESTAMP;
     inbind[1].buffer = reinterpret_cast<char*>(&expire_time);
     inbind[1].buffer_length = sizeof(expire_time);
@@ -1909,7 +2292,8 @@ MySqlLeaseMgr::getExpiredLeasesCommon(LeaseCollection& expired_leases,
     inbind[2].is_unsigned = MLM_TRUE;
 
     // Get the data
-    getLeaseCollection(statement_index, inbind, expired_leases);
+    MySqlLeaseContextPool::Holder ctx(*pool_);
+    getLeaseCollection(*ctx, statement_index, inbind, expired_leases);
 }
 
 
@@ -1920,20 +2304,22 @@ MySqlLeaseMgr::getExpiredLeasesCommon(LeaseCollection& expired_leases,
 
 template <typename LeasePtr>
 void
-MySqlLeaseMgr::updateLeaseCommon(StatementIndex stindex, MYSQL_BIND* bind,
+MySqlLeaseMgr::updateLeaseCommon(MySqlLeaseContext& ctx,
+                                 StatementIndex stindex, MYSQL_BIND* bind,
                                  const LeasePtr& lease) {
 
     // Bind the parameters to the statement
-    int status = mysql_stmt_bind_param(conn_.statements_[stindex], bind);
-    checkError(status, stindex, "unable to bind parameters");
+    int status = mysql_stmt_bind_param(ctx.conn_.statements_[stindex], bind);
+    checkError(ctx, status, stindex, "unable to bind parameters");
 
     // Execute
-    status = mysql_stmt_execute(conn_.statements_[stindex]);
-    checkError(status, stindex, "unable to execute");
+    status = mysql_stmt_execute(ctx.conn_.statements_[stindex]);
+    checkError(ctx, status, stindex, "unable to execute");
 
     // See how many rows were affected.  The statement should only update a
     // single row.
-    int affected_rows = mysql_stmt_affected_rows(conn_.statements_[stindex]);
+    int affected_rows =
+        mysql_stmt_affected_rows(ctx.conn_.statements_[stindex]);
     if (affected_rows == 0) {
         isc_throw(NoSuchLease, "unable to update lease for address " <<
                   lease->addr_ << " as it does not exist");
@@ -1948,13 +2334,16 @@ MySqlLeaseMgr::updateLeaseCommon(StatementIndex stindex, MYSQL_BIND* bind,
 
 void
 MySqlLeaseMgr::updateLease4(const Lease4Ptr& lease) {
+    StageTimer timer(ProcessingLatency::STAGE_LEASE_WRITE);
+
     const StatementIndex stindex = UPDATE_LEASE4;
 
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MYSQL_UPDATE_ADDR4).arg(lease->addr_.toText());
 
     // Create the MYSQL_BIND array for the data being updated
-    std::vector<MYSQL_BIND> bind = exchange4_->createBindForSend(lease);
+    MySqlLeaseContextPool::Holder ctx(*pool_);
+    std::vector<MYSQL_BIND> bind = ctx->exchange4_->createBindForSend(lease);
 
     // Set up the WHERE clause and append it to the MYSQL_BIND array
     MYSQL_BIND where;
@@ -1967,12 +2356,14 @@ MySqlLeaseMgr::updateLease4(const Lease4Ptr& lease) {
     bind.push_back(where);
 
     // Drop to common update code
-    updateLeaseCommon(stindex, &bind[0], lease);
+    updateLeaseCommon(*ctx, stindex, &bind[0], lease);
 }
 
 
 void
 MySqlLeaseMgr::updateLease6(const Lease6Ptr& lease) {
+    StageTimer timer(ProcessingLatency::STAGE_LEASE_WRITE);
+
     const StatementIndex stindex = UPDATE_LEASE6;
 
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
@@ -1980,7 +2371,8 @@ MySqlLeaseMgr::updateLease6(const Lease6Ptr& lease) {
               .arg(lease->type_);
 
     // Create the MYSQL_BIND array for the data being updated
-    std::vector<MYSQL_BIND> bind = exchange6_->createBindForSend(lease);
+    MySqlLeaseContextPool::Holder ctx(*pool_);
+    std::vector<MYSQL_BIND> bind = ctx->exchange6_->createBindForSend(lease);
 
     // Set up the WHERE clause value
     MYSQL_BIND where;
@@ -1998,7 +2390,99 @@ MySqlLeaseMgr::updateLease6(const Lease6Ptr& lease) {
     bind.push_back(where);
 
     // Drop to common update code
-    updateLeaseCommon(stindex, &bind[0], lease);
+    updateLeaseCommon(*ctx, stindex, &bind[0], lease);
+}
+
+void
+MySqlLeaseMgr::applyLeases4(const Lease4Collection& leases) {
+    StageTimer timer(ProcessingLatency::STAGE_LEASE_WRITE);
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_MYSQL_APPLY_LEASES4).arg(leases.size());
+
+    // The MySqlTransaction is not used because its destructor would throw
+    // if the rollback failed after the connection was lost.
+    MySqlLeaseContextPool::Holder ctx(*pool_);
+    ctx->conn_.startTransaction();
+    try {
+        for (Lease4Collection::const_iterator lease = leases.begin();
+             lease != leases.end(); ++lease) {
+            // A duplicate entry doesn't abort the transaction, so the lease
+            // is inserted first and updated if it already exists.
+            std::vector<MYSQL_BIND> bind =
+                ctx->exchange4_->createBindForSend(*lease);
+            if (addLeaseCommon(*ctx, INSERT_LEASE4, bind)) {
+                continue;
+            }
+
+            MYSQL_BIND where;
+            memset(&where, 0, sizeof(where));
+
+            uint32_t addr4 = (*lease)->addr_.toUint32();
+            where.buffer_type = MYSQL_TYPE_LONG;
+            where.buffer = reinterpret_cast<char*>(&addr4);
+            where.is_unsigned = MLM_TRUE;
+            bind.push_back(where);
+
+            updateLeaseCommon(*ctx, UPDATE_LEASE4, &bind[0], *lease);
+        }
+
+        ctx->conn_.commit();
+
+    } catch (...) {
+        try {
+            ctx->conn_.rollback();
+        } catch (...) {
+            // Report the original error.
+        }
+        throw;
+    }
+}
+
+void
+MySqlLeaseMgr::applyLeases6(const Lease6Collection& leases) {
+    StageTimer timer(ProcessingLatency::STAGE_LEASE_WRITE);
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_MYSQL_APPLY_LEASES6).arg(leases.size());
+
+    MySqlLeaseContextPool::Holder ctx(*pool_);
+    ctx->conn_.startTransaction();
+    try {
+        for (Lease6Collection::const_iterator lease = leases.begin();
+             lease != leases.end(); ++lease) {
+            // A duplicate entry doesn't abort the transaction, so the lease
+            // is inserted first and updated if it already exists.
+            std::vector<MYSQL_BIND> bind =
+                ctx->exchange6_->createBindForSend(*lease);
+            if (addLeaseCommon(*ctx, INSERT_LEASE6, bind)) {
+                continue;
+            }
+
+            MYSQL_BIND where;
+            memset(&where, 0, sizeof(where));
+
+            std::string addr6 = (*lease)->addr_.toText();
+            unsigned long addr6_length = addr6.size();
+            where.buffer_type = MYSQL_TYPE_STRING;
+            where.buffer = const_cast<char*>(addr6.c_str());
+            where.buffer_length = addr6_length;
+            where.length = &addr6_length;
+            bind.push_back(where);
+
+            updateLeaseCommon(*ctx, UPDATE_LEASE6, &bind[0], *lease);
+        }
+
+        ctx->conn_.commit();
+
+    } catch (...) {
+        try {
+            ctx->conn_.rollback();
+        } catch (...) {
+            // Report the original error.
+        }
+        throw;
+    }
 }
 
 // Delete lease methods.  Similar to other groups of methods, these comprise
@@ -2007,23 +2491,27 @@ MySqlLeaseMgr::updateLease6(const Lease6Ptr& lease) {
 // handles the common processing.
 
 uint64_t
-MySqlLeaseMgr::deleteLeaseCommon(StatementIndex stindex, MYSQL_BIND* bind) {
+MySqlLeaseMgr::deleteLeaseCommon(MySqlLeaseContext& ctx,
+                                 StatementIndex stindex, MYSQL_BIND* bind) {
 
     // Bind the input parameters to the statement
-    int status = mysql_stmt_bind_param(conn_.statements_[stindex], bind);
-    checkError(status, stindex, "unable to bind WHERE clause parameter");
+    int status = mysql_stmt_bind_param(ctx.conn_.statements_[stindex], bind);
+    checkError(ctx, status, stindex, "unable to bind WHERE clause parameter");
 
     // Execute
-    status = mysql_stmt_execute(conn_.statements_[stindex]);
-    checkError(status, stindex, "unable to execute");
+    status = mysql_stmt_execute(ctx.conn_.statements_[stindex]);
+    checkError(ctx, status, stindex, "unable to execute");
 
     // See how many rows were affected.  Note that the statement may delete
     // multiple rows.
-    return (static_cast<uint64_t>(mysql_stmt_affected_rows(conn_.statements_[stindex])));
+    return (static_cast<uint64_t>
+            (mysql_stmt_affected_rows(ctx.conn_.statements_[stindex])));
 }
 
 bool
 MySqlLeaseMgr::deleteLease(const isc::asiolink::IOAddress& addr) {
+    StageTimer timer(ProcessingLatency::STAGE_LEASE_WRITE);
+
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MYSQL_DELETE_ADDR).arg(addr.toText());
 
@@ -2038,7 +2526,8 @@ MySqlLeaseMgr::deleteLease(const isc::asiolink::IOAddress& addr) {
         inbind[0].buffer = reinterpret_cast<char*>(&addr4);
         inbind[0].is_unsigned = MLM_TRUE;
 
-        return (deleteLeaseCommon(DELETE_LEASE4, inbind) > 0);
+        MySqlLeaseContextPool::Holder ctx(*pool_);
+        return (deleteLeaseCommon(*ctx, DELETE_LEASE4, inbind) > 0);
 
     } else {
         std::string addr6 = addr.toText();
@@ -2051,7 +2540,135 @@ MySqlLeaseMgr::deleteLease(const isc::asiolink::IOAddress& addr) {
         inbind[0].buffer_length = addr6_length;
         inbind[0].length = &addr6_length;
 
-        return (deleteLeaseCommon(DELETE_LEASE6, inbind) > 0);
+        MySqlLeaseContextPool::Holder ctx(*pool_);
+        return (deleteLeaseCommon(*ctx, DELETE_LEASE6, inbind) > 0);
+    }
+}
+
+void
+MySqlLeaseMgr::reclaimLeases4(const Lease4Collection& updated,
+                              const Lease4Collection& removed) {
+    StageTimer timer(ProcessingLatency::STAGE_LEASE_WRITE);
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_MYSQL_RECLAIM_LEASES4)
+        .arg(updated.size())
+        .arg(removed.size());
+
+    // The MySqlTransaction is not used because its destructor would throw
+    // if the rollback failed after the connection was lost.
+    MySqlLeaseContextPool::Holder ctx(*pool_);
+    ctx->conn_.startTransaction();
+    try {
+        for (Lease4Collection::const_iterator lease = updated.begin();
+             lease != updated.end(); ++lease) {
+            std::vector<MYSQL_BIND> bind =
+                ctx->exchange4_->createBindForSend(*lease);
+
+            MYSQL_BIND where;
+            memset(&where, 0, sizeof(where));
+
+            uint32_t addr4 = (*lease)->addr_.toUint32();
+            where.buffer_type = MYSQL_TYPE_LONG;
+            where.buffer = reinterpret_cast<char*>(&addr4);
+            where.is_unsigned = MLM_TRUE;
+            bind.push_back(where);
+
+            updateLeaseCommon(*ctx, UPDATE_LEASE4, &bind[0], *lease);
+        }
+
+        // Delete the leases with one statement per DELETE_BATCH_SIZE
+        // addresses.
+        for (size_t first = 0; first < removed.size();
+             first += DELETE_BATCH_SIZE) {
+            MYSQL_BIND inbind[DELETE_BATCH_SIZE];
+            memset(inbind, 0, sizeof(inbind));
+
+            uint32_t addr4[DELETE_BATCH_SIZE];
+            for (size_t i = 0; i < DELETE_BATCH_SIZE; ++i) {
+                const size_t index = std::min(first + i, removed.size() - 1);
+                addr4[i] = removed[index]->addr_.toUint32();
+                inbind[i].buffer_type = MYSQL_TYPE_LONG;
+                inbind[i].buffer = reinterpret_cast<char*>(&addr4[i]);
+                inbind[i].is_unsigned = MLM_TRUE;
+            }
+
+            deleteLeaseCommon(*ctx, DELETE_LEASE4_BATCH, inbind);
+        }
+
+        ctx->conn_.commit();
+
+    } catch (...) {
+        try {
+            ctx->conn_.rollback();
+        } catch (...) {
+            // Report the original error.
+        }
+        throw;
+    }
+}
+
+void
+MySqlLeaseMgr::reclaimLeases6(const Lease6Collection& updated,
+                              const Lease6Collection& removed) {
+    StageTimer timer(ProcessingLatency::STAGE_LEASE_WRITE);
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_MYSQL_RECLAIM_LEASES6)
+        .arg(updated.size())
+        .arg(removed.size());
+
+    MySqlLeaseContextPool::Holder ctx(*pool_);
+    ctx->conn_.startTransaction();
+    try {
+        for (Lease6Collection::const_iterator lease = updated.begin();
+             lease != updated.end(); ++lease) {
+            std::vector<MYSQL_BIND> bind =
+                ctx->exchange6_->createBindForSend(*lease);
+
+            MYSQL_BIND where;
+            memset(&where, 0, sizeof(where));
+
+            std::string addr6 = (*lease)->addr_.toText();
+            unsigned long addr6_length = addr6.size();
+            where.buffer_type = MYSQL_TYPE_STRING;
+            where.buffer = const_cast<char*>(addr6.c_str());
+            where.buffer_length = addr6_length;
+            where.length = &addr6_length;
+            bind.push_back(where);
+
+            updateLeaseCommon(*ctx, UPDATE_LEASE6, &bind[0], *lease);
+        }
+
+        for (size_t first = 0; first < removed.size();
+             first += DELETE_BATCH_SIZE) {
+            MYSQL_BIND inbind[DELETE_BATCH_SIZE];
+            memset(inbind, 0, sizeof(inbind));
+
+            std::string addr6[DELETE_BATCH_SIZE];
+            unsigned long addr6_length[DELETE_BATCH_SIZE];
+            for (size_t i = 0; i < DELETE_BATCH_SIZE; ++i) {
+                const size_t index = std::min(first + i, removed.size() - 1);
+                addr6[i] = removed[index]->addr_.toText();
+                addr6_length[i] = addr6[i].size();
+                inbind[i].buffer_type = MYSQL_TYPE_STRING;
+                inbind[i].buffer = const_cast<char*>(addr6[i].c_str());
+                inbind[i].buffer_length = addr6_length[i];
+                inbind[i].length = &addr6_length[i];
+            }
+
+            deleteLeaseCommon(*ctx, DELETE_LEASE6_BATCH, inbind);
+        }
+
+        ctx->conn_.commit();
+
+    } catch (...) {
+        try {
+            ctx->conn_.rollback();
+        } catch (...) {
+            // Report the original error.
+        }
+        throw;
     }
 }
 
@@ -2086,13 +2703,14 @@ MySqlLeaseMgr::deleteExpiredReclaimedLeasesCommon(const uint32_t secs,
 
     // Expiration timestamp.
     MYSQL_TIME expire_time;
-    conn_.convertToDatabaseTime(time(NULL) - static_cast<time_t>(secs), expire_time);
+    MySqlConnection::convertToDatabaseTime(time(NULL) - static_cast<time_t>(secs), expire_time);
     inbind[1].buffer_type = MYSQL_TYPE_TIMESTAMP;
     inbind[1].buffer = reinterpret_cast<char*>(&expire_time);
     inbind[1].buffer_length = sizeof(expire_time);
 
     // Get the number of deleted leases and log it.
-    uint64_t deleted_leases = deleteLeaseCommon(statement_index, inbind);
+    MySqlLeaseContextPool::Holder ctx(*pool_);
+    uint64_t deleted_leases = deleteLeaseCommon(*ctx, statement_index, inbind);
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MYSQL_DELETED_EXPIRED_RECLAIMED)
         .arg(deleted_leases);
@@ -2114,13 +2732,10 @@ MySqlLeaseMgr::wipeLeases6(const SubnetID& /*subnet_id*/) {
 
 std::string
 MySqlLeaseMgr::getName() const {
-    std::string name = "";
-    try {
-        name = conn_.getParameter("name");
-    } catch (...) {
-        // Return an empty name
-    }
-    return (name);
+    // Return an empty name if it is not specified.
+    DatabaseConnection::ParameterMap::const_iterator param =
+        parameters_.find("name");
+    return (param != parameters_.end() ? param->second : std::string(""));
 }
 
 
@@ -2141,11 +2756,12 @@ MySqlLeaseMgr::getVersion() const {
     uint32_t    minor;      // Minor version number
 
     // Execute the prepared statement
-    int status = mysql_stmt_execute(conn_.statements_[stindex]);
+    MySqlLeaseContextPool::Holder ctx(*pool_);
+    int status = mysql_stmt_execute(ctx->conn_.statements_[stindex]);
     if (status != 0) {
         isc_throw(DbOperationError, "unable to execute <"
-                  << conn_.text_statements_[stindex] << "> - reason: " <<
-                  mysql_error(conn_.mysql_));
+                  << ctx->conn_.text_statements_[stindex] << "> - reason: " <<
+                  mysql_error(ctx->conn_.mysql_));
     }
 
     // Bind the output of the statement to the appropriate variables.
@@ -2162,19 +2778,19 @@ MySqlLeaseMgr::getVersion() const {
     bind[1].buffer = &minor;
     bind[1].buffer_length = sizeof(minor);
 
-    status = mysql_stmt_bind_result(conn_.statements_[stindex], bind);
+    status = mysql_stmt_bind_result(ctx->conn_.statements_[stindex], bind);
     if (status != 0) {
         isc_throw(DbOperationError, "unable to bind result set: " <<
-                  mysql_error(conn_.mysql_));
+                  mysql_error(ctx->conn_.mysql_));
     }
 
     // Fetch the data and set up the "release" object to release associated
     // resources when this method exits then retrieve the data.
-    MySqlFreeResult fetch_release(conn_.statements_[stindex]);
-    status = mysql_stmt_fetch(conn_.statements_[stindex]);
+    MySqlFreeResult fetch_release(ctx->conn_.statements_[stindex]);
+    status = mysql_stmt_fetch(ctx->conn_.statements_[stindex]);
     if (status != 0) {
         isc_throw(DbOperationError, "unable to obtain result set: " <<
-                  mysql_error(conn_.mysql_));
+                  mysql_error(ctx->conn_.mysql_));
     }
 
     return (std::make_pair(major, minor));
@@ -2182,27 +2798,53 @@ MySqlLeaseMgr::getVersion() const {
 
 LeaseStatsQueryPtr
 MySqlLeaseMgr::startLeaseStatsQuery4() {
-    LeaseStatsQueryPtr query(new MySqlLeaseStatsQuery(conn_,
+    LeaseStatsQueryPtr query(new MySqlLeaseStatsQuery(*pool_,
                                                       RECOUNT_LEASE4_STATS,
                                                       false));
     query->start();
     return(query);
 }
 
+LeaseStatsQueryPtr
+MySqlLeaseMgr::startSubnetLeaseStatsQuery4(const SubnetIDSet& subnet_ids) {
+    if (subnet_ids.empty()) {
+        return (LeaseStatsQueryPtr(new LeaseStatsQuery()));
+    }
+    LeaseStatsQueryPtr query(new MySqlLeaseStatsQuery(*pool_,
+                                                      SUBNET_LEASE4_STATS,
+                                                      false, subnet_ids));
+    query->start();
+    return(query);
+}
+
 LeaseStatsQueryPtr
 MySqlLeaseMgr::startLeaseStatsQuery6() {
-    LeaseStatsQueryPtr query(new MySqlLeaseStatsQuery(conn_,
+    LeaseStatsQueryPtr query(new MySqlLeaseStatsQuery(*pool_,
                                                       RECOUNT_LEASE6_STATS,
                                                       true));
     query->start();
     return(query);
 }
 
+LeaseStatsQueryPtr
+MySqlLeaseMgr::startSubnetLeaseStatsQuery6(const SubnetIDSet& subnet_ids) {
+    if (subnet_ids.empty()) {
+        return (LeaseStatsQueryPtr(new LeaseStatsQuery()));
+    }
+    LeaseStatsQueryPtr query(new MySqlLeaseStatsQuery(*pool_,
+                                                      SUBNET_LEASE6_STATS,
+                                                      true, subnet_ids));
+    query->start();
+    return(query);
+}
+
 void
 MySqlLeaseMgr::commit() {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MYSQL_COMMIT);
-    if (mysql_commit(conn_.mysql_) != 0) {
-        isc_throw(DbOperationError, "commit failed: " << mysql_error(conn_.mysql_));
+    checkSingleConnection("commit");
+    MySqlLeaseContextPool::Holder ctx(*pool_);
+    if (mysql_commit(ctx->conn_.mysql_) != 0) {
+        isc_throw(DbOperationError, "commit failed: " << mysql_error(ctx->conn_.mysql_));
     }
 }
 
@@ -2210,15 +2852,25 @@ MySqlLeaseMgr::commit() {
 void
 MySqlLeaseMgr::rollback() {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MYSQL_ROLLBACK);
-    if (mysql_rollback(conn_.mysql_) != 0) {
-        isc_throw(DbOperationError, "rollback failed: " << mysql_error(conn_.mysql_));
+    checkSingleConnection("rollback");
+    MySqlLeaseContextPool::Holder ctx(*pool_);
+    if (mysql_rollback(ctx->conn_.mysql_) != 0) {
+        isc_throw(DbOperationError, "rollback failed: " << mysql_error(ctx->conn_.mysql_));
+    }
+}
+
+void
+MySqlLeaseMgr::checkSingleConnection(const char* what) const {
+    if (pool_->getMaxSize() > 1) {
+        isc_throw(InvalidOperation, what << " is not supported with a pool"
+                  " of " << pool_->getMaxSize() << " connections");
     }
 }
 
 void
-MySqlLeaseMgr::checkError(int status, StatementIndex index,
-                           const char* what) const {
-    conn_.checkError(status, index, what);
+MySqlLeaseMgr::checkError(MySqlLeaseContext& ctx, int status,
+                          StatementIndex index, const char* what) const {
+    ctx.conn_.checkError(status, index, what);
 }
 
 }; // end of isc::dhcp namespace
@@ -24,6 +24,13 @@ namespace dhcp {
 // in the .cc file.
 class MySqlLease4Exchange;
 class MySqlLease6Exchange;
+class MySqlLeaseContext;
+
+/// @brief Pointer to a @c MySqlLeaseContext.
+typedef boost::shared_ptr<MySqlLeaseContext> MySqlLeaseContextPtr;
+
+/// @brief Pool of the connections of the MySQL lease manager.
+typedef DatabaseConnectionPool<MySqlLeaseContext> MySqlLeaseContextPool;
 
 /// @brief MySQL Lease Manager
 ///
@@ -42,12 +49,21 @@ public:
     /// - host - Host to which to connect (optional, defaults to "localhost")
     /// - user - Username under which to connect (optional)
     /// - password - Password for "user" on the database (optional)
+    /// - connection-pool-size - Maximum number of connections to the
+    ///   database, used concurrently by the threads (optional, defaults
+    ///   to 1)
+    /// - reconnect-wait-time - Time in milliseconds to wait after a failure
+    ///   to open a connection before the next attempt, doubled after each
+    ///   consecutive failure (optional, defaults to 1000)
     ///
     /// If the database is successfully opened, the version number in the
     /// schema_version table will be checked against hard-coded value in
     /// the implementation file.
     ///
-    /// Finally, all the SQL commands are pre-compiled.
+    /// Finally, all the SQL commands are pre-compiled. The other connections
+    /// of the pool are opened when needed, with their own prepared
+    /// statements. A lost connection is replaced by a new one rather than
+    /// being fatal.
     ///
     /// @param parameters A data structure relating keywords and values
     ///        concerned with the database.
@@ -193,6 +209,51 @@ public:
     virtual Lease4Ptr getLease4(const ClientId& clientid,
                                 SubnetID subnet_id) const;
 
+    /// @brief Returns all IPv4 leases for the particular subnet identifier.
+    ///
+    /// @param subnet_id subnet identifier.
+    ///
+    /// @return Lease collection (may be empty if no IPv4 lease found).
+    ///
+    /// @throw isc::dhcp::DataTruncation Data was truncated on retrieval to
+    ///        fit into the space allocated for the result.  This indicates a
+    ///        programming error.
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease4Collection getLeases4(SubnetID subnet_id) const;
+
+    /// @brief Returns all IPv4 leases.
+    ///
+    /// @return Lease collection (may be empty if no IPv4 lease found).
+    ///
+    /// @throw isc::dhcp::DataTruncation Data was truncated on retrieval to
+    ///        fit into the space allocated for the result.  This indicates a
+    ///        programming error.
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease4Collection getLeases4() const;
+
+    /// @brief Returns range of IPv4 leases using paging.
+    ///
+    /// The leases are returned in the ascending order of addresses by a
+    /// query using the primary key index.
+    ///
+    /// @param lower_bound_address IPv4 address used as lower bound for the
+    /// returned range.
+    /// @param page_size maximum size of the page returned.
+    ///
+    /// @return Lease collection (may be empty if no IPv4 lease found).
+    ///
+    /// @throw InvalidParameter if the lower bound is not an IPv4 address.
+    /// @throw isc::dhcp::DataTruncation Data was truncated on retrieval to
+    ///        fit into the space allocated for the result.  This indicates a
+    ///        programming error.
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease4Collection
+    getLeases4(const asiolink::IOAddress& lower_bound_address,
+               const LeasePageSize& page_size) const;
+
     /// @brief Returns existing IPv6 lease for a given IPv6 address.
     ///
     /// For a given address, we assume that there will be only one lease.
@@ -256,6 +317,52 @@ public:
     virtual Lease6Collection getLeases6(Lease::Type type, const DUID& duid,
                                         uint32_t iaid, SubnetID subnet_id) const;
 
+    /// @brief Returns all IPv6 leases for the particular subnet identifier.
+    ///
+    /// @param subnet_id subnet identifier.
+    ///
+    /// @return Lease collection (may be empty if no IPv6 lease found).
+    ///
+    /// @throw isc::dhcp::DataTruncation Data was truncated on retrieval to
+    ///        fit into the space allocated for the result.  This indicates a
+    ///        programming error.
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease6Collection getLeases6(SubnetID subnet_id) const;
+
+    /// @brief Returns all IPv6 leases.
+    ///
+    /// @return Lease collection (may be empty if no IPv6 lease found).
+    ///
+    /// @throw isc::dhcp::DataTruncation Data was truncated on retrieval to
+    ///        fit into the space allocated for the result.  This indicates a
+    ///        programming error.
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease6Collection getLeases6() const;
+
+    /// @brief Returns range of IPv6 leases using paging.
+    ///
+    /// The addresses are held in a text column, so the leases are returned
+    /// in the text order of addresses by a query using the primary key
+    /// index. The IPv6 zero address denotes the first page.
+    ///
+    /// @param lower_bound_address IPv6 address used as lower bound for the
+    /// returned range.
+    /// @param page_size maximum size of the page returned.
+    ///
+    /// @return Lease collection (may be empty if no IPv6 lease found).
+    ///
+    /// @throw InvalidParameter if the lower bound is not an IPv6 address.
+    /// @throw isc::dhcp::DataTruncation Data was truncated on retrieval to
+    ///        fit into the space allocated for the result.  This indicates a
+    ///        programming error.
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease6Collection
+    getLeases6(const asiolink::IOAddress& lower_bound_address,
+               const LeasePageSize& page_size) const;
+
     /// @brief Returns a collection of expired DHCPv6 leases.
     ///
     /// This method returns at most @c max_leases expired leases. The leases
@@ -309,6 +416,53 @@ public:
     ///        failed.
     virtual void updateLease6(const Lease6Ptr& lease6);
 
+    /// @brief Reclaims a batch of expired IPv4 leases.
+    ///
+    /// The batch is applied in a single transaction. The updated leases
+    /// are written with the prepared update statement and the removed
+    /// leases are deleted with a statement taking up to 16 addresses.
+    ///
+    /// @param updated Leases to be updated.
+    /// @param removed Leases to be deleted.
+    ///
+    /// @throw isc::dhcp::NoSuchLease One of the updated leases does not
+    ///        exist. No part of the batch is applied in this case.
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual void reclaimLeases4(const Lease4Collection& updated,
+                                const Lease4Collection& removed);
+
+    /// @brief Reclaims a batch of expired IPv6 leases.
+    ///
+    /// @param updated Leases to be updated.
+    /// @param removed Leases to be deleted.
+    ///
+    /// @throw isc::dhcp::NoSuchLease One of the updated leases does not
+    ///        exist. No part of the batch is applied in this case.
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual void reclaimLeases6(const Lease6Collection& updated,
+                                const Lease6Collection& removed);
+
+    /// @brief Adds or updates a batch of IPv4 leases.
+    ///
+    /// The batch is applied in a single transaction. Each lease is inserted
+    /// and updated if the insert found a duplicate entry.
+    ///
+    /// @param leases Leases to be applied.
+    ///
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed. No part of the batch is applied in this case.
+    virtual void applyLeases4(const Lease4Collection& leases);
+
+    /// @brief Adds or updates a batch of IPv6 leases.
+    ///
+    /// @param leases Leases to be applied.
+    ///
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed. No part of the batch is applied in this case.
+    virtual void applyLeases6(const Lease6Collection& leases);
+
     /// @brief Deletes a lease.
     ///
     /// @param addr Address of the lease to be deleted.  This can be an IPv4
@@ -383,6 +537,13 @@ public:
     /// @return Description of the backend.
     virtual std::string getDescription() const;
 
+    /// @brief Indicates if the backend can be used concurrently.
+    ///
+    /// @return true as each thread uses a connection of the pool.
+    virtual bool isThreadSafe() const {
+        return (true);
+    }
+
     /// @brief Returns backend version.
     ///
     /// @return Version number as a pair of unsigned integers.  "first" is the
@@ -397,7 +558,14 @@ public:
     /// Commits all pending database operations.  On databases that don't
     /// support transactions, this is a no-op.
     ///
+    /// The lease operations are committed on the connection which
+    /// executed them, so this method is only supported when the
+    /// connection pool holds a single connection: with more connections
+    /// it wouldn't know which connection to commit.
+    ///
     /// @throw DbOperationError If the commit failed.
+    /// @throw InvalidOperation If the connection pool can hold more than
+    /// one connection.
     virtual void commit();
 
     /// @brief Rollback Transactions
@@ -405,7 +573,12 @@ public:
     /// Rolls back all pending database operations.  On databases that don't
     /// support transactions, this is a no-op.
     ///
+    /// This method is only supported when the connection pool holds a
+    /// single connection, see @ref commit.
+    ///
     /// @throw DbOperationError If the rollback failed.
+    /// @throw InvalidOperation If the connection pool can hold more than
+    /// one connection.
     virtual void rollback();
 
     /// @brief Statement Tags
@@ -413,19 +586,27 @@ public:
     /// The contents of the enum are indexes into the list of SQL statements
     enum StatementIndex {
         DELETE_LEASE4,               // Delete from lease4 by address
+        DELETE_LEASE4_BATCH,         // Delete from lease4 by 16 addresses
         DELETE_LEASE4_STATE_EXPIRED, // Delete expired lease4 in a given state
         DELETE_LEASE6,               // Delete from lease6 by address
+        DELETE_LEASE6_BATCH,         // Delete from lease6 by 16 addresses
         DELETE_LEASE6_STATE_EXPIRED, // Delete expired lease6 in a given state
+        GET_LEASE4,                  // Get all lease4
         GET_LEASE4_ADDR,             // Get lease4 by address
         GET_LEASE4_CLIENTID,         // Get lease4 by client ID
         GET_LEASE4_CLIENTID_SUBID,   // Get lease4 by client ID & subnet ID
         GET_LEASE4_HWADDR,           // Get lease4 by HW address
         GET_LEASE4_HWADDR_SUBID,     // Get lease4 by HW address & subnet ID
         GET_LEASE4_EXPIRE,           // Get lease4 by expiration.
+        GET_LEASE4_PAGE,             // Get page of lease4
+        GET_LEASE4_SUBID,            // Get lease4 by subnet ID
+        GET_LEASE6,                  // Get all lease6
         GET_LEASE6_ADDR,             // Get lease6 by address
         GET_LEASE6_DUID_IAID,        // Get lease6 by DUID and IAID
         GET_LEASE6_DUID_IAID_SUBID,  // Get lease6 by DUID, IAID and subnet ID
         GET_LEASE6_EXPIRE,           // Get lease6 by expiration.
+        GET_LEASE6_PAGE,             // Get page of lease6
+        GET_LEASE6_SUBID,            // Get lease6 by subnet ID
         GET_VERSION,                 // Obtain version number
         INSERT_LEASE4,               // Add entry to lease4 table
         INSERT_LEASE6,               // Add entry to lease6 table
@@ -433,6 +614,8 @@ public:
         UPDATE_LEASE6,               // Update a Lease6 entry
         RECOUNT_LEASE4_STATS,        // Fetches IPv4 address statistics
         RECOUNT_LEASE6_STATS,        // Fetches IPv6 address statistics
+        SUBNET_LEASE4_STATS,         // Fetches IPv4 statistics of subnets
+        SUBNET_LEASE6_STATS,         // Fetches IPv6 statistics of subnets
         NUM_STATEMENTS               // Number of statements
     };
 
@@ -443,6 +626,7 @@ private:
     /// of the addLease method.  It binds the contents of the lease object to
     /// the prepared statement and adds it to the database.
     ///
+    /// @param ctx Context of the connection executing the statement
     /// @param stindex Index of statement being executed
     /// @param bind MYSQL_BIND array that has been created for the type
     ///        of lease in question.
@@ -452,13 +636,15 @@ private:
     ///
     /// @throw isc::dhcp::DbOperationError An operation on the open database has
     ///        failed.
-    bool addLeaseCommon(StatementIndex stindex, std::vector<MYSQL_BIND>& bind);
+    bool addLeaseCommon(MySqlLeaseContext& ctx, StatementIndex stindex,
+                        std::vector<MYSQL_BIND>& bind);
 
     /// @brief Get Lease Collection Common Code
     ///
     /// This method performs the common actions for obtaining multiple leases
     /// from the database.
     ///
+    /// @param ctx Context of the connection executing the statement
     /// @param stindex Index of statement being executed
     /// @param bind MYSQL_BIND array for input parameters
     /// @param exchange Exchange object to use
@@ -475,8 +661,9 @@ private:
     /// @throw isc::dhcp::MultipleRecords Multiple records were retrieved
     ///        from the database where only one was expected.
     template <typename Exchange, typename LeaseCollection>
-    void getLeaseCollection(StatementIndex stindex, MYSQL_BIND* bind,
-                            Exchange& exchange, LeaseCollection& result,
+    void getLeaseCollection(MySqlLeaseContext& ctx, StatementIndex stindex,
+                            MYSQL_BIND* bind, Exchange& exchange,
+                            LeaseCollection& result,
                             bool single = false) const;
 
     /// @brief Get Lease Collection
@@ -484,6 +671,7 @@ private:
     /// Gets a collection of Lease4 objects.  This is just an interface to
     /// the get lease collection common code.
     ///
+    /// @param ctx Context of the connection executing the statement
     /// @param stindex Index of statement being executed
     /// @param bind MYSQL_BIND array for input parameters
     /// @param lease LeaseCollection object returned.  Note that any leases in
@@ -495,16 +683,15 @@ private:
     ///        failed.
     /// @throw isc::dhcp::MultipleRecords Multiple records were retrieved
     ///        from the database where only one was expected.
-    void getLeaseCollection(StatementIndex stindex, MYSQL_BIND* bind,
-                            Lease4Collection& result) const {
-        getLeaseCollection(stindex, bind, exchange4_, result);
-    }
+    void getLeaseCollection(MySqlLeaseContext& ctx, StatementIndex stindex,
+                            MYSQL_BIND* bind, Lease4Collection& result) const;
 
     /// @brief Get Lease Collection
     ///
     /// Gets a collection of Lease6 objects.  This is just an interface to
     /// the get lease collection common code.
     ///
+    /// @param ctx Context of the connection executing the statement
     /// @param stindex Index of statement being executed
     /// @param bind MYSQL_BIND array for input parameters
     /// @param lease LeaseCollection object returned.  Note that any existing
@@ -515,10 +702,8 @@ private:
     ///        failed.
     /// @throw isc::dhcp::MultipleRecords Multiple records were retrieved
     ///        from the database where only one was expected.
-    void getLeaseCollection(StatementIndex stindex, MYSQL_BIND* bind,
-                            Lease6Collection& result) const {
-        getLeaseCollection(stindex, bind, exchange6_, result);
-    }
+    void getLeaseCollection(MySqlLeaseContext& ctx, StatementIndex stindex,
+                            MYSQL_BIND* bind, Lease6Collection& result) const;
 
     /// @brief Get Lease4 Common Code
     ///
@@ -526,11 +711,12 @@ private:
     /// methods.  It acts as an interface to the getLeaseCollection() method,
     /// but retrieving only a single lease.
     ///
+    /// @param ctx Context of the connection executing the statement
     /// @param stindex Index of statement being executed
     /// @param bind MYSQL_BIND array for input parameters
     /// @param lease Lease4 object returned
-    void getLease(StatementIndex stindex, MYSQL_BIND* bind,
-                  Lease4Ptr& result) const;
+    void getLease(MySqlLeaseContext& ctx, StatementIndex stindex,
+                  MYSQL_BIND* bind, Lease4Ptr& result) const;
 
     /// @brief Get Lease6 Common Code
     ///
@@ -538,11 +724,12 @@ private:
     /// methods.  It acts as an interface to the getLeaseCollection() method,
     /// but retrieving only a single lease.
     ///
+    /// @param ctx Context of the connection executing the statement
     /// @param stindex Index of statement being executed
     /// @param bind MYSQL_BIND array for input parameters
     /// @param lease Lease6 object returned
-    void getLease(StatementIndex stindex, MYSQL_BIND* bind,
-                   Lease6Ptr& result) const;
+    void getLease(MySqlLeaseContext& ctx, StatementIndex stindex,
+                  MYSQL_BIND* bind, Lease6Ptr& result) const;
 
 
     /// @brief Get expired leases common code.
@@ -570,6 +757,7 @@ private:
     /// to the prepared statement, executes it, then checks how many rows
     /// were affected.
     ///
+    /// @param ctx Context of the connection executing the statement
     /// @param stindex Index of prepared statement to be executed
     /// @param bind Array of MYSQL_BIND objects representing the parameters.
     ///        (Note that the number is determined by the number of parameters
@@ -581,8 +769,8 @@ private:
     /// @throw isc::dhcp::DbOperationError An operation on the open database has
     ///        failed.
     template <typename LeasePtr>
-    void updateLeaseCommon(StatementIndex stindex, MYSQL_BIND* bind,
-                           const LeasePtr& lease);
+    void updateLeaseCommon(MySqlLeaseContext& ctx, StatementIndex stindex,
+                           MYSQL_BIND* bind, const LeasePtr& lease);
 
     /// @brief Delete lease common code
     ///
@@ -590,6 +778,7 @@ private:
     /// to the prepared statement, executes the statement and checks to
     /// see how many rows were deleted.
     ///
+    /// @param ctx Context of the connection executing the statement
     /// @param stindex Index of prepared statement to be executed
     /// @param bind Array of MYSQL_BIND objects representing the parameters.
     ///        (Note that the number is determined by the number of parameters
@@ -599,7 +788,8 @@ private:
     ///
     /// @throw isc::dhcp::DbOperationError An operation on the open database has
     ///        failed.
-    uint64_t deleteLeaseCommon(StatementIndex stindex, MYSQL_BIND* bind);
+    uint64_t deleteLeaseCommon(MySqlLeaseContext& ctx, StatementIndex stindex,
+                               MYSQL_BIND* bind);
 
     /// @brief Delete expired-reclaimed leases.
     ///
@@ -623,6 +813,19 @@ private:
     /// @return The populated query as a pointer to an LeaseStatsQuery
     virtual LeaseStatsQueryPtr startLeaseStatsQuery4();
 
+    /// @brief Creates and runs the IPv4 lease stats query for selected
+    /// subnets
+    ///
+    /// It executes the SUBNET_LEASE4_STATS query, which examines the
+    /// leases of the selected subnets only. MySQL has no array parameters,
+    /// so the query is executed for each batch of subnets.
+    ///
+    /// @param subnet_ids Identifiers of the subnets to be examined.
+    ///
+    /// @return The populated query as a pointer to an LeaseStatsQuery
+    virtual LeaseStatsQueryPtr
+    startSubnetLeaseStatsQuery4(const SubnetIDSet& subnet_ids);
+
     /// @brief Creates and runs the IPv6 lease stats query
     ///
     /// It creates an instance of a MySqlLeaseStatsQuery6 and then
@@ -633,30 +836,59 @@ private:
     /// @return The populated query as a pointer to an LeaseStatsQuery
     virtual LeaseStatsQueryPtr startLeaseStatsQuery6();
 
+    /// @brief Creates and runs the IPv6 lease stats query for selected
+    /// subnets
+    ///
+    /// It executes the SUBNET_LEASE6_STATS query, which examines the
+    /// leases of the selected subnets only. MySQL has no array parameters,
+    /// so the query is executed for each batch of subnets.
+    ///
+    /// @param subnet_ids Identifiers of the subnets to be examined.
+    ///
+    /// @return The populated query as a pointer to an LeaseStatsQuery
+    virtual LeaseStatsQueryPtr
+    startSubnetLeaseStatsQuery6(const SubnetIDSet& subnet_ids);
+
+    /// @brief Checks that the connection pool holds a single connection.
+    ///
+    /// @param what name of the operation requiring a single connection
+    ///
+    /// @throw InvalidOperation If the connection pool can hold more than
+    /// one connection.
+    void checkSingleConnection(const char* what) const;
+
     /// @brief Check Error and Throw Exception
     ///
     /// This method invokes @ref MySqlConnection::checkError.
     ///
+    /// @param ctx Context of the connection executing the statement
     /// @param status Status code: non-zero implies an error
     /// @param index Index of statement that caused the error
     /// @param what High-level description of the error
     ///
     /// @throw isc::dhcp::DbOperationError An operation on the open database has
     ///        failed.
-    void checkError(int status, StatementIndex index,
+    void checkError(MySqlLeaseContext& ctx, int status, StatementIndex index,
                     const char* what) const;
 
+    /// @brief Opens a connection to the database.
+    ///
+    /// Used by the pool to open its connections: the connection has its
+    /// own prepared statements and exchange objects.
+    ///
+    /// @return context of the new connection.
+    /// @throw isc::dhcp::DbOpenError Error opening the database
+    /// @throw isc::dhcp::DbOperationError An operation on the open database
+    ///        has failed.
+    MySqlLeaseContextPtr createContext() const;
+
     // Members
 
-    /// The exchange objects are used for transfer of data to/from the database.
-    /// They are pointed-to objects as the contents may change in "const" calls,
-    /// while the rest of this object does not.  (At alternative would be to
-    /// declare them as "mutable".)
-    boost::scoped_ptr<MySqlLease4Exchange> exchange4_; ///< Exchange object
-    boost::scoped_ptr<MySqlLease6Exchange> exchange6_; ///< Exchange object
+    /// @brief Database access parameters.
+    DatabaseConnection::ParameterMap parameters_;
 
-    /// @brief MySQL connection
-    MySqlConnection conn_;
+    /// @brief Pool of connections to the database.
+    boost::scoped_ptr<MySqlLeaseContextPool> pool_;
 };
 
 }; // end of isc::dhcp namespace
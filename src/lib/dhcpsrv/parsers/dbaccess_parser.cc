@@ -56,10 +56,24 @@ DbAccessParser::parse(CfgDbAccessPtr& cfg_db,
     int64_t lfc_interval = 0;
     int64_t timeout = 0;
     int64_t port = 0;
+    int64_t max_batch = 1;
+    int64_t max_latency = 0;
+    int64_t load_threads = 0;
+    int64_t lfc_batch_size = 1;
+    int64_t lfc_batch_interval = 0;
+    int64_t cache_size = 0;
+    int64_t cache_ttl = 0;
+    int64_t cache_negative_ttl = 0;
+    int64_t pool_size = 1;
+    int64_t reconnect_wait_time = 0;
     // 2. Update the copy with the passed keywords.
     BOOST_FOREACH(ConfigPair param, database_config->mapValue()) {
         try {
-            if ((param.first == "persist") || (param.first == "readonly")) {
+            if ((param.first == "persist") || (param.first == "readonly") ||
+                (param.first == "packed") ||
+                (param.first == "group-commit") ||
+                (param.first == "group-commit-sync") ||
+                (param.first == "lfc-in-process")) {
                 values_copy[param.first] = (param.second->boolValue() ?
                                             "true" : "false");
 
@@ -78,6 +92,56 @@ DbAccessParser::parse(CfgDbAccessPtr& cfg_db,
                 values_copy[param.first] =
                     boost::lexical_cast<std::string>(port);
 
+            } else if (param.first == "group-commit-max-batch") {
+                max_batch = param.second->intValue();
+                values_copy[param.first] =
+                    boost::lexical_cast<std::string>(max_batch);
+
+            } else if (param.first == "group-commit-max-latency") {
+                max_latency = param.second->intValue();
+                values_copy[param.first] =
+                    boost::lexical_cast<std::string>(max_latency);
+
+            } else if (param.first == "load-threads") {
+                load_threads = param.second->intValue();
+                values_copy[param.first] =
+                    boost::lexical_cast<std::string>(load_threads);
+
+            } else if (param.first == "lfc-batch-size") {
+                lfc_batch_size = param.second->intValue();
+                values_copy[param.first] =
+                    boost::lexical_cast<std::string>(lfc_batch_size);
+
+            } else if (param.first == "lfc-batch-interval") {
+                lfc_batch_interval = param.second->intValue();
+                values_copy[param.first] =
+                    boost::lexical_cast<std::string>(lfc_batch_interval);
+
+            } else if (param.first == "cache-size") {
+                cache_size = param.second->intValue();
+                values_copy[param.first] =
+                    boost::lexical_cast<std::string>(cache_size);
+
+            } else if (param.first == "cache-ttl") {
+                cache_ttl = param.second->intValue();
+                values_copy[param.first] =
+                    boost::lexical_cast<std::string>(cache_ttl);
+
+            } else if (param.first == "cache-negative-ttl") {
+                cache_negative_ttl = param.second->intValue();
+                values_copy[param.first] =
+                    boost::lexical_cast<std::string>(cache_negative_ttl);
+
+            } else if (param.first == "connection-pool-size") {
+                pool_size = param.second->intValue();
+                values_copy[param.first] =
+                    boost::lexical_cast<std::string>(pool_size);
+
+            } else if (param.first == "reconnect-wait-time") {
+                reconnect_wait_time = param.second->intValue();
+                values_copy[param.first] =
+                    boost::lexical_cast<std::string>(reconnect_wait_time);
+
             } else {
                 values_copy[param.first] = param.second->stringValue();
             }
@@ -144,6 +208,97 @@ DbAccessParser::parse(CfgDbAccessPtr& cfg_db,
                   << " (" << value->getPosition() << ")");
     }
 
+    // f. Check that the group commit batch size is within a reasonable range.
+    if ((max_batch < 1) ||
+        (max_batch > std::numeric_limits<uint32_t>::max())) {
+        ConstElementPtr value = database_config->get("group-commit-max-batch");
+        isc_throw(DhcpConfigError, "group-commit-max-batch value: " << max_batch
+                  << " is out of range, expected value: 1.."
+                  << std::numeric_limits<uint32_t>::max()
+                  << " (" << value->getPosition() << ")");
+    }
+
+    // g. Check that the group commit latency is within a reasonable range.
+    if ((max_latency < 0) ||
+        (max_latency > std::numeric_limits<uint32_t>::max())) {
+        ConstElementPtr value = database_config->get("group-commit-max-latency");
+        isc_throw(DhcpConfigError, "group-commit-max-latency value: "
+                  << max_latency << " is out of range, expected value: 0.."
+                  << std::numeric_limits<uint32_t>::max()
+                  << " (" << value->getPosition() << ")");
+    }
+
+    // h. Check that the number of threads loading leases is within a
+    // reasonable range.
+    if ((load_threads < 0) ||
+        (load_threads > std::numeric_limits<uint32_t>::max())) {
+        ConstElementPtr value = database_config->get("load-threads");
+        isc_throw(DhcpConfigError, "load-threads value: " << load_threads
+                  << " is out of range, expected value: 0.."
+                  << std::numeric_limits<uint32_t>::max()
+                  << " (" << value->getPosition() << ")");
+    }
+
+    // i. Check that the number of leases written at once by the in-process
+    // lease file cleanup is within a reasonable range.
+    if ((lfc_batch_size < 1) ||
+        (lfc_batch_size > std::numeric_limits<uint32_t>::max())) {
+        ConstElementPtr value = database_config->get("lfc-batch-size");
+        isc_throw(DhcpConfigError, "lfc-batch-size value: " << lfc_batch_size
+                  << " is out of range, expected value: 1.."
+                  << std::numeric_limits<uint32_t>::max()
+                  << " (" << value->getPosition() << ")");
+    }
+
+    // j. Check that the pause between the batches is within a reasonable
+    // range.
+    if ((lfc_batch_interval < 0) ||
+        (lfc_batch_interval > std::numeric_limits<uint32_t>::max())) {
+        ConstElementPtr value = database_config->get("lfc-batch-interval");
+        isc_throw(DhcpConfigError, "lfc-batch-interval value: "
+                  << lfc_batch_interval << " is out of range, expected value: 0.."
+                  << std::numeric_limits<uint32_t>::max()
+                  << " (" << value->getPosition() << ")");
+    }
+
+    // k. Check that the host cache size and times to live are within
+    // a reasonable range.
+    const std::pair<const char*, int64_t> cache_params[] = {
+        std::make_pair("cache-size", cache_size),
+        std::make_pair("cache-ttl", cache_ttl),
+        std::make_pair("cache-negative-ttl", cache_negative_ttl)
+    };
+    for (size_t i = 0; i < sizeof(cache_params) / sizeof(cache_params[0]); ++i) {
+        if ((cache_params[i].second < 0) ||
+            (cache_params[i].second > std::numeric_limits<uint32_t>::max())) {
+            ConstElementPtr value = database_config->get(cache_params[i].first);
+            isc_throw(DhcpConfigError, cache_params[i].first << " value: "
+                      << cache_params[i].second
+                      << " is out of range, expected value: 0.."
+                      << std::numeric_limits<uint32_t>::max()
+                      << " (" << value->getPosition() << ")");
+        }
+    }
+
+    // l. Check that the size of the pool of connections is within
+    // a reasonable range.
+    if ((pool_size < 1) || (pool_size > 1024)) {
+        ConstElementPtr value = database_config->get("connection-pool-size");
+        isc_throw(DhcpConfigError, "connection-pool-size value: " << pool_size
+                  << " is out of range, expected value: 1..1024"
+                  << " (" << value->getPosition() << ")");
+    }
+
+    // m. Check that the reconnect wait time is within a reasonable range.
+    if ((reconnect_wait_time < 0) ||
+        (reconnect_wait_time > std::numeric_limits<uint32_t>::max())) {
+        ConstElementPtr value = database_config->get("reconnect-wait-time");
+        isc_throw(DhcpConfigError, "reconnect-wait-time value: "
+                  << reconnect_wait_time << " is out of range, expected value: 0.."
+                  << std::numeric_limits<uint32_t>::max()
+                  << " (" << value->getPosition() << ")");
+    }
+
     // 4. If all is OK, update the stored keyword/value pairs.  We do this by
     // swapping contents - values_copy is destroyed immediately after the
     // operation (when the method exits), so we are not interested in its new
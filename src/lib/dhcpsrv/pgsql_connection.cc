@@ -295,6 +295,16 @@ PgSqlConnection::checkStatementError(const PgSqlResult& r,
              (memcmp(sqlstate, "54", 2) == 0) ||  // Program Limit exceeded
              (memcmp(sqlstate, "57", 2) == 0) ||  // Operator intervention
              (memcmp(sqlstate, "58", 2) == 0))) { // System error
+            if (isRecoverable()) {
+                LOG_ERROR(dhcpsrv_logger, DHCPSRV_PGSQL_CONNECTION_LOST)
+                    .arg(statement.name)
+                    .arg(PQerrorMessage(conn_))
+                    .arg(sqlstate);
+                unusable_ = true;
+                isc_throw(DbOperationError, "connection to the database lost"
+                          " executing: " << statement.name << ", reason: "
+                          << PQerrorMessage(conn_));
+            }
             LOG_ERROR(dhcpsrv_logger, DHCPSRV_PGSQL_FATAL_ERROR)
                          .arg(statement.name)
                          .arg(PQerrorMessage(conn_))
@@ -309,6 +319,23 @@ PgSqlConnection::checkStatementError(const PgSqlResult& r,
     }
 }
 
+bool
+PgSqlConnection::isUsable() const {
+    if (!conn_ || unusable_ || (PQstatus(conn_) != CONNECTION_OK)) {
+        return (false);
+    }
+
+    // The status is only updated by the operations on the connection, so
+    // a connection dropped by the server while idle is detected with an
+    // empty query, which the server answers without doing any work.
+    PGresult* r = PQexec(conn_, "");
+    if (!r || (PQresultStatus(r) != PGRES_EMPTY_QUERY)) {
+        unusable_ = true;
+    }
+    PQclear(r);
+    return (!unusable_);
+}
+
 void
 PgSqlConnection::startTransaction() {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
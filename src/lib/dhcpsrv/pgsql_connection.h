@@ -300,7 +300,7 @@ public:
     ///
     /// Initialize PgSqlConnection object with parameters needed for connection.
     PgSqlConnection(const ParameterMap& parameters)
-        : DatabaseConnection(parameters) {
+        : DatabaseConnection(parameters), unusable_(false) {
     }
 
     /// @brief Destructor
@@ -379,13 +379,14 @@ public:
     ///
     /// If the error is recoverable, the method will throw a DbOperationError.
     /// In the error is deemed unrecoverable, such as a loss of connectivity
-    /// with the server, this method will log the error and call exit(-1);
+    /// with the server, this method will log the error and call exit(-1),
+    /// unless the loss of the connection is recoverable (see
+    /// @ref DatabaseConnection::setRecoverable). In this case, the connection
+    /// is marked unusable and a DbOperationError is thrown.
     ///
     /// @todo Calling exit() is viewed as a short term solution for Kea 1.0.
-    /// Two tickets are likely to alter this behavior, first is #3639, which
-    /// calls for the ability to attempt to reconnect to the database. The
-    /// second ticket, #4087 which calls for the implementation of a generic,
-    /// FatalException class which will propagate outward.
+    /// Ticket #4087 calls for a generic FatalException class which would
+    /// propagate outward instead.
     ///
     /// @param r result of the last PostgreSQL operation
     /// @param statement - tagged statement that was executed
@@ -394,6 +395,15 @@ public:
     void checkStatementError(const PgSqlResult& r,
                              PgSqlTaggedStatement& statement) const;
 
+    /// @brief Checks if the connection can be used.
+    ///
+    /// Sends an empty query to the server, so a connection which was
+    /// dropped by the server while idle is detected.
+    ///
+    /// @return false if the connection is not open, was lost or failed
+    /// with an unrecoverable error, true otherwise.
+    bool isUsable() const;
+
     /// @brief PgSql connection handle
     ///
     /// This field is public, because it is used heavily from PgSqlLeaseMgr
@@ -415,6 +425,11 @@ public:
         return (conn_);
     }
 
+private:
+
+    /// @brief Indicates if the connection failed with an unrecoverable
+    /// error.
+    mutable bool unusable_;
 };
 
 }; // end of isc::dhcp namespace
@@ -21,6 +21,7 @@
 #include <boost/algorithm/string/split.hpp>
 #include <boost/algorithm/string/classification.hpp>
 #include <boost/array.hpp>
+#include <boost/bind.hpp>
 #include <boost/pointer_cast.hpp>
 #include <boost/static_assert.hpp>
 
@@ -1200,6 +1201,11 @@ public:
     /// @brief Destructor.
     ~PgSqlHostDataSourceImpl();
 
+    /// @brief Checks if the connection can be used.
+    bool isUsable() const {
+        return (conn_.isUsable());
+    }
+
     /// @brief Executes statements which insert a row into one of the tables.
     ///
     /// @param stindex Index of a statement being executed.
@@ -1615,6 +1621,9 @@ PgSqlHostDataSourceImpl(const PgSqlConnection::ParameterMap& parameters)
       conn_(parameters),
       is_readonly_(false) {
 
+    // A lost connection is replaced by the pool of the host data source.
+    conn_.setRecoverable(true);
+
     // Open the database.
     conn_.openDatabase();
 
@@ -1833,43 +1842,57 @@ PgSqlHostDataSourceImpl::checkReadOnly() const {
 
 PgSqlHostDataSource::
 PgSqlHostDataSource(const PgSqlConnection::ParameterMap& parameters)
-    : impl_(new PgSqlHostDataSourceImpl(parameters)) {
+    : parameters_(parameters), pool_() {
+    // The pool opens the first connection.
+    pool_.reset(new PgSqlHostContextPool(
+        boost::bind(&PgSqlHostDataSource::createContext, this),
+        DatabaseConnection::getUint32Parameter(parameters,
+                                               "connection-pool-size", 1),
+        DatabaseConnection::getUint32Parameter(parameters,
+                                               "reconnect-wait-time", 1000)));
 }
 
 PgSqlHostDataSource::~PgSqlHostDataSource() {
-    delete impl_;
+}
+
+boost::shared_ptr<PgSqlHostDataSourceImpl>
+PgSqlHostDataSource::createContext() const {
+    return (boost::shared_ptr<PgSqlHostDataSourceImpl>
+            (new PgSqlHostDataSourceImpl(parameters_)));
 }
 
 void
 PgSqlHostDataSource::add(const HostPtr& host) {
+    PgSqlHostContextPool::Holder impl(*pool_);
+
     // If operating in read-only mode, throw exception.
-    impl_->checkReadOnly();
+    impl->checkReadOnly();
 
     // Initiate PostgreSQL transaction as we will have to make multiple queries
     // to insert host information into multiple tables. If that fails on
     // any stage, the transaction will be rolled back by the destructor of
     // the PgSqlTransaction class.
-    PgSqlTransaction transaction(impl_->conn_);
+    PgSqlTransaction transaction(impl->conn_);
 
     // Create the PgSQL Bind array for the host
-    PsqlBindArrayPtr bind_array = impl_->host_exchange_->createBindForSend(host);
+    PsqlBindArrayPtr bind_array = impl->host_exchange_->createBindForSend(host);
 
     // ... and insert the host.
-    uint32_t host_id = impl_->addStatement(PgSqlHostDataSourceImpl::INSERT_HOST,
-                                           bind_array, true);
+    uint32_t host_id = impl->addStatement(PgSqlHostDataSourceImpl::INSERT_HOST,
+                                          bind_array, true);
 
     // Insert DHCPv4 options.
     ConstCfgOptionPtr cfg_option4 = host->getCfgOption4();
     if (cfg_option4) {
-        impl_->addOptions(PgSqlHostDataSourceImpl::INSERT_V4_HOST_OPTION,
-                          cfg_option4, host_id);
+        impl->addOptions(PgSqlHostDataSourceImpl::INSERT_V4_HOST_OPTION,
+                         cfg_option4, host_id);
     }
 
     // Insert DHCPv6 options.
     ConstCfgOptionPtr cfg_option6 = host->getCfgOption6();
     if (cfg_option6) {
-        impl_->addOptions(PgSqlHostDataSourceImpl::INSERT_V6_HOST_OPTION,
-                          cfg_option6, host_id);
+        impl->addOptions(PgSqlHostDataSourceImpl::INSERT_V6_HOST_OPTION,
+                         cfg_option6, host_id);
     }
 
     // Insert IPv6 reservations.
@@ -1877,7 +1900,7 @@ PgSqlHostDataSource::add(const HostPtr& host) {
     if (std::distance(v6resv.first, v6resv.second) > 0) {
         for (IPv6ResrvIterator resv = v6resv.first; resv != v6resv.second;
              ++resv) {
-            impl_->addResv(resv->second, host_id);
+            impl->addResv(resv->second, host_id);
         }
     }
 
@@ -1887,15 +1910,17 @@ PgSqlHostDataSource::add(const HostPtr& host) {
 
 bool
 PgSqlHostDataSource::del(const SubnetID& subnet_id, const asiolink::IOAddress& addr) {
+    PgSqlHostContextPool::Holder impl(*pool_);
+
     // If operating in read-only mode, throw exception.
-    impl_->checkReadOnly();
+    impl->checkReadOnly();
 
     if (addr.isV4()) {
         PsqlBindArrayPtr bind_array(new PsqlBindArray());
         bind_array->add(subnet_id);
         bind_array->add(addr);
-        return (impl_->delStatement(PgSqlHostDataSourceImpl::DEL_HOST_ADDR4,
-                                    bind_array));
+        return (impl->delStatement(PgSqlHostDataSourceImpl::DEL_HOST_ADDR4,
+                                   bind_array));
     }
 
     ConstHostPtr host = get6(subnet_id, addr);
@@ -1912,6 +1937,7 @@ PgSqlHostDataSource::del4(const SubnetID& subnet_id,
                           const Host::IdentifierType& identifier_type,
                           const uint8_t* identifier_begin,
                           const size_t identifier_len) {
+    PgSqlHostContextPool::Holder impl(*pool_);
 
     PsqlBindArrayPtr bind_array(new PsqlBindArray());
 
@@ -1924,8 +1950,8 @@ PgSqlHostDataSource::del4(const SubnetID& subnet_id,
     // identifier
     bind_array->add(identifier_begin, identifier_len);
 
-    return (impl_->delStatement(PgSqlHostDataSourceImpl::DEL_HOST_SUBID4_ID,
-                                bind_array));
+    return (impl->delStatement(PgSqlHostDataSourceImpl::DEL_HOST_SUBID4_ID,
+                               bind_array));
 
 }
 
@@ -1934,6 +1960,8 @@ PgSqlHostDataSource::del6(const SubnetID& subnet_id,
                           const Host::IdentifierType& identifier_type,
                           const uint8_t* identifier_begin,
                           const size_t identifier_len) {
+    PgSqlHostContextPool::Holder impl(*pool_);
+
     PsqlBindArrayPtr bind_array(new PsqlBindArray());
 
     // Subnet-id
@@ -1945,8 +1973,8 @@ PgSqlHostDataSource::del6(const SubnetID& subnet_id,
     // identifier
     bind_array->add(identifier_begin, identifier_len);
 
-    return (impl_->delStatement(PgSqlHostDataSourceImpl::DEL_HOST_SUBID6_ID,
-                                bind_array));
+    return (impl->delStatement(PgSqlHostDataSourceImpl::DEL_HOST_SUBID6_ID,
+                               bind_array));
 
 }
 
@@ -1971,6 +1999,8 @@ ConstHostCollection
 PgSqlHostDataSource::getAll(const Host::IdentifierType& identifier_type,
                             const uint8_t* identifier_begin,
                             const size_t identifier_len) const {
+    PgSqlHostContextPool::Holder impl(*pool_);
+
     // Set up the WHERE clause value
     PsqlBindArrayPtr bind_array(new PsqlBindArray());
 
@@ -1981,14 +2011,15 @@ PgSqlHostDataSource::getAll(const Host::IdentifierType& identifier_type,
     bind_array->add(static_cast<uint8_t>(identifier_type));
 
     ConstHostCollection result;
-    impl_->getHostCollection(PgSqlHostDataSourceImpl::GET_HOST_DHCPID,
-                             bind_array, impl_->host_ipv46_exchange_,
+    impl->getHostCollection(PgSqlHostDataSourceImpl::GET_HOST_DHCPID,
+                            bind_array, impl->host_ipv46_exchange_,
                              result, false);
     return (result);
 }
 
 ConstHostCollection
 PgSqlHostDataSource::getAll4(const asiolink::IOAddress& address) const {
+    PgSqlHostContextPool::Holder impl(*pool_);
 
     // Set up the WHERE clause value
     PsqlBindArrayPtr bind_array(new PsqlBindArray());
@@ -1997,8 +2028,8 @@ PgSqlHostDataSource::getAll4(const asiolink::IOAddress& address) const {
     bind_array->add(address);
 
     ConstHostCollection result;
-    impl_->getHostCollection(PgSqlHostDataSourceImpl::GET_HOST_ADDR, bind_array,
-                             impl_->host_exchange_, result, false);
+    impl->getHostCollection(PgSqlHostDataSourceImpl::GET_HOST_ADDR, bind_array,
+                            impl->host_exchange_, result, false);
 
     return (result);
 }
@@ -2035,16 +2066,19 @@ PgSqlHostDataSource::get4(const SubnetID& subnet_id,
                           const Host::IdentifierType& identifier_type,
                           const uint8_t* identifier_begin,
                           const size_t identifier_len) const {
+    PgSqlHostContextPool::Holder impl(*pool_);
 
-    return (impl_->getHost(subnet_id, identifier_type, identifier_begin,
-                           identifier_len,
-                           PgSqlHostDataSourceImpl::GET_HOST_SUBID4_DHCPID,
-                           impl_->host_exchange_));
+    return (impl->getHost(subnet_id, identifier_type, identifier_begin,
+                          identifier_len,
+                          PgSqlHostDataSourceImpl::GET_HOST_SUBID4_DHCPID,
+                          impl->host_exchange_));
 }
 
 ConstHostPtr
 PgSqlHostDataSource::get4(const SubnetID& subnet_id,
                           const asiolink::IOAddress& address) const {
+    PgSqlHostContextPool::Holder impl(*pool_);
+
     if (!address.isV4()) {
         isc_throw(BadValue, "PgSqlHostDataSource::get4(id, address) - "
                   " wrong address type, address supplied is an IPv6 address");
@@ -2060,8 +2094,8 @@ PgSqlHostDataSource::get4(const SubnetID& subnet_id,
     bind_array->add(address);
 
     ConstHostCollection collection;
-    impl_->getHostCollection(PgSqlHostDataSourceImpl::GET_HOST_SUBID_ADDR,
-                             bind_array, impl_->host_exchange_, collection,
+    impl->getHostCollection(PgSqlHostDataSourceImpl::GET_HOST_SUBID_ADDR,
+                            bind_array, impl->host_exchange_, collection,
                              true);
 
     // Return single record if present, else clear the host.
@@ -2103,15 +2137,18 @@ PgSqlHostDataSource::get6(const SubnetID& subnet_id,
                           const Host::IdentifierType& identifier_type,
                           const uint8_t* identifier_begin,
                           const size_t identifier_len) const {
+    PgSqlHostContextPool::Holder impl(*pool_);
 
-    return (impl_->getHost(subnet_id, identifier_type, identifier_begin,
+    return (impl->getHost(subnet_id, identifier_type, identifier_begin,
                    identifier_len, PgSqlHostDataSourceImpl::GET_HOST_SUBID6_DHCPID,
-                   impl_->host_ipv6_exchange_));
+                   impl->host_ipv6_exchange_));
 }
 
 ConstHostPtr
 PgSqlHostDataSource::get6(const asiolink::IOAddress& prefix,
                           const uint8_t prefix_len) const {
+    PgSqlHostContextPool::Holder impl(*pool_);
+
     /// @todo: Check that prefix is v6 address, not v4.
 
     // Set up the WHERE clause value
@@ -2124,8 +2161,8 @@ PgSqlHostDataSource::get6(const asiolink::IOAddress& prefix,
     bind_array->add(prefix_len);
 
     ConstHostCollection collection;
-    impl_->getHostCollection(PgSqlHostDataSourceImpl::GET_HOST_PREFIX,
-                             bind_array, impl_->host_ipv6_exchange_,
+    impl->getHostCollection(PgSqlHostDataSourceImpl::GET_HOST_PREFIX,
+                            bind_array, impl->host_ipv6_exchange_,
                              collection, true);
 
     // Return single record if present, else clear the host.
@@ -2140,6 +2177,8 @@ PgSqlHostDataSource::get6(const asiolink::IOAddress& prefix,
 ConstHostPtr
 PgSqlHostDataSource::get6(const SubnetID& subnet_id,
                           const asiolink::IOAddress& address) const {
+    PgSqlHostContextPool::Holder impl(*pool_);
+
     /// @todo: Check that prefix is v6 address, not v4.
 
     // Set up the WHERE clause value
@@ -2152,8 +2191,8 @@ PgSqlHostDataSource::get6(const SubnetID& subnet_id,
     bind_array->add(address);
 
     ConstHostCollection collection;
-    impl_->getHostCollection(PgSqlHostDataSourceImpl::GET_HOST_SUBID6_ADDR,
-                             bind_array, impl_->host_ipv6_exchange_,
+    impl->getHostCollection(PgSqlHostDataSourceImpl::GET_HOST_SUBID6_ADDR,
+                            bind_array, impl->host_ipv6_exchange_,
                              collection, true);
 
     // Return single record if present, else clear the host.
@@ -2168,13 +2207,10 @@ PgSqlHostDataSource::get6(const SubnetID& subnet_id,
 // Miscellaneous database methods.
 
 std::string PgSqlHostDataSource::getName() const {
-    std::string name = "";
-    try {
-        name = impl_->conn_.getParameter("name");
-    } catch (...) {
-        // Return an empty name
-    }
-    return (name);
+    // Return an empty name if it is not specified.
+    DatabaseConnection::ParameterMap::const_iterator param =
+        parameters_.find("name");
+    return (param != parameters_.end() ? param->second : std::string(""));
 }
 
 std::string PgSqlHostDataSource::getDescription() const {
@@ -2183,22 +2219,28 @@ std::string PgSqlHostDataSource::getDescription() const {
 }
 
 std::pair<uint32_t, uint32_t> PgSqlHostDataSource::getVersion() const {
-    return(impl_->getVersion());
+    PgSqlHostContextPool::Holder impl(*pool_);
+
+    return(impl->getVersion());
 }
 
 void
 PgSqlHostDataSource::commit() {
+    PgSqlHostContextPool::Holder impl(*pool_);
+
     // If operating in read-only mode, throw exception.
-    impl_->checkReadOnly();
-    impl_->conn_.commit();
+    impl->checkReadOnly();
+    impl->conn_.commit();
 }
 
 
 void
 PgSqlHostDataSource::rollback() {
+    PgSqlHostContextPool::Holder impl(*pool_);
+
     // If operating in read-only mode, throw exception.
-    impl_->checkReadOnly();
-    impl_->conn_.rollback();
+    impl->checkReadOnly();
+    impl->conn_.rollback();
 }
 
 }; // end of isc::dhcp namespace
@@ -8,8 +8,11 @@
 #define PGSQL_HOST_DATA_SOURCE_H
 
 #include <dhcpsrv/base_host_data_source.h>
+#include <dhcpsrv/database_connection.h>
 #include <dhcpsrv/pgsql_connection.h>
 #include <dhcpsrv/pgsql_exchange.h>
+#include <boost/scoped_ptr.hpp>
+#include <boost/shared_ptr.hpp>
 
 namespace isc {
 namespace dhcp {
@@ -17,6 +20,12 @@ namespace dhcp {
 /// Forward declaration to the implementation of the @ref PgSqlHostDataSource.
 class PgSqlHostDataSourceImpl;
 
+/// @brief Pool of the connections of the PostgreSQL host data source.
+///
+/// Each connection has its own implementation object holding the prepared
+/// statements and the exchange objects.
+typedef DatabaseConnectionPool<PgSqlHostDataSourceImpl> PgSqlHostContextPool;
+
 /// @brief PostgreSQL Host Data Source
 ///
 /// This class implements the @ref isc::dhcp::BaseHostDataSource interface to
@@ -43,12 +52,21 @@ public:
     /// - host - Host to which to connect (optional, defaults to "localhost")
     /// - user - Username under which to connect (optional)
     /// - password - Password for "user" on the database (optional)
+    /// - connection-pool-size - Maximum number of connections to the
+    ///   database, used concurrently by the threads (optional, defaults
+    ///   to 1)
+    /// - reconnect-wait-time - Time in milliseconds to wait after a failure
+    ///   to open a connection before the next attempt, doubled after each
+    ///   consecutive failure (optional, defaults to 1000)
     ///
     /// If the database is successfully opened, the version number in the
     /// schema_version table will be checked against hard-coded value in
     /// the implementation file.
     ///
-    /// Finally, all the SQL commands are pre-compiled.
+    /// Finally, all the SQL commands are pre-compiled. The other connections
+    /// of the pool are opened when needed, with their own prepared
+    /// statements. A lost connection is replaced by a new one rather than
+    /// being fatal.
     ///
     /// @param parameters A data structure relating keywords and values
     ///        concerned with the database.
@@ -61,7 +79,7 @@ public:
 
     /// @brief Virtual destructor.
     /// Frees database resources and closes the database connection through
-    /// the destruction of member impl_.
+    /// the destruction of the pool of connections.
     virtual ~PgSqlHostDataSource();
 
     /// @brief Return all hosts for the specified HW address or DUID.
@@ -303,6 +321,13 @@ public:
         return (std::string("postgresql"));
     }
 
+    /// @brief Indicates if the backend can be used concurrently.
+    ///
+    /// @return true as each thread uses a connection of the pool.
+    virtual bool isThreadSafe() const {
+        return (true);
+    }
+
     /// @brief Returns the name of the open database
     ///
     /// @return String containing the name of the database
@@ -337,8 +362,19 @@ public:
 
 private:
 
-    /// @brief Pointer to the implementation of the @ref PgSqlHostDataSource.
-    PgSqlHostDataSourceImpl* impl_;
+    /// @brief Opens a connection to the database.
+    ///
+    /// Used by the pool to open its connections.
+    ///
+    /// @return implementation object owning the new connection.
+    boost::shared_ptr<PgSqlHostDataSourceImpl> createContext() const;
+
+    /// @brief Database access parameters.
+    DatabaseConnection::ParameterMap parameters_;
+
+    /// @brief Pool of connections to the database, each with its own
+    /// implementation of the @ref PgSqlHostDataSource.
+    boost::scoped_ptr<PgSqlHostContextPool> pool_;
 };
 
 }
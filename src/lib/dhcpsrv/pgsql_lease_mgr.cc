@@ -11,17 +11,25 @@
 #include <dhcp/hwaddr.h>
 #include <dhcpsrv/dhcpsrv_log.h>
 #include <dhcpsrv/pgsql_lease_mgr.h>
+#include <dhcpsrv/processing_latency.h>
+#include <util/encode/hex.h>
+#include <util/threads/thread.h>
 
+#include <boost/bind.hpp>
 #include <boost/static_assert.hpp>
 
+#include <deque>
 #include <iomanip>
 #include <limits>
 #include <sstream>
 #include <string>
+#include <poll.h>
 #include <time.h>
 
 using namespace isc;
+using namespace isc::asiolink;
 using namespace isc::dhcp;
+using namespace isc::util::thread;
 using namespace std;
 
 namespace {
@@ -38,6 +46,11 @@ PgSqlTaggedStatement tagged_statements[] = {
       "delete_lease4",
       "DELETE FROM lease4 WHERE address = $1"},
 
+    // DELETE_LEASE4_BATCH
+    { 1, { OID_TEXT },
+      "delete_lease4_batch",
+      "DELETE FROM lease4 WHERE address = ANY($1::bigint[])"},
+
     // DELETE_LEASE4_STATE_EXPIRED
     { 2, { OID_INT8, OID_TIMESTAMP },
       "delete_lease4_state_expired",
@@ -49,12 +62,25 @@ PgSqlTaggedStatement tagged_statements[] = {
       "delete_lease6",
       "DELETE FROM lease6 WHERE address = $1"},
 
+    // DELETE_LEASE6_BATCH
+    { 1, { OID_TEXT },
+      "delete_lease6_batch",
+      "DELETE FROM lease6 WHERE address = ANY($1::varchar[])"},
+
     // DELETE_LEASE6_STATE_EXPIRED
     { 2, { OID_INT8, OID_TIMESTAMP },
       "delete_lease6_state_expired",
       "DELETE FROM lease6 "
           "WHERE state = $1 AND expire < $2"},
 
+    // GET_LEASE4
+    { 0, { OID_NONE },
+      "get_lease4",
+      "SELECT address, hwaddr, client_id, "
+        "valid_lifetime, extract(epoch from expire)::bigint, subnet_id, "
+        "fqdn_fwd, fqdn_rev, hostname, state "
+      "FROM lease4"},
+
     // GET_LEASE4_ADDR
     { 1, { OID_INT8 },
       "get_lease4_addr",
@@ -111,6 +137,35 @@ PgSqlTaggedStatement tagged_statements[] = {
               "ORDER BY expire "
               "LIMIT $3"},
 
+    // GET_LEASE4_PAGE
+    { 2, { OID_INT8, OID_INT8 },
+      "get_lease4_page",
+      "SELECT address, hwaddr, client_id, "
+        "valid_lifetime, extract(epoch from expire)::bigint, subnet_id, "
+        "fqdn_fwd, fqdn_rev, hostname, state "
+      "FROM lease4 "
+      "WHERE address > $1 "
+      "ORDER BY address "
+      "LIMIT $2"},
+
+    // GET_LEASE4_SUBID
+    { 1, { OID_INT8 },
+      "get_lease4_subid",
+      "SELECT address, hwaddr, client_id, "
+        "valid_lifetime, extract(epoch from expire)::bigint, subnet_id, "
+        "fqdn_fwd, fqdn_rev, hostname, state "
+      "FROM lease4 "
+      "WHERE subnet_id = $1"},
+
+    // GET_LEASE6
+    { 0, { OID_NONE },
+      "get_lease6",
+      "SELECT address, duid, valid_lifetime, "
+        "extract(epoch from expire)::bigint, subnet_id, pref_lifetime, "
+        "lease_type, iaid, prefix_len, fqdn_fwd, fqdn_rev, hostname, "
+        "state "
+      "FROM lease6"},
+
     // GET_LEASE6_ADDR
     { 2, { OID_VARCHAR, OID_INT2 },
       "get_lease6_addr",
@@ -155,6 +210,28 @@ PgSqlTaggedStatement tagged_statements[] = {
               "ORDER BY expire "
               "LIMIT $3"},
 
+    // GET_LEASE6_PAGE
+    { 2, { OID_VARCHAR, OID_INT8 },
+      "get_lease6_page",
+      "SELECT address, duid, valid_lifetime, "
+        "extract(epoch from expire)::bigint, subnet_id, pref_lifetime, "
+        "lease_type, iaid, prefix_len, fqdn_fwd, fqdn_rev, hostname, "
+        "state "
+      "FROM lease6 "
+      "WHERE address > $1 "
+      "ORDER BY address "
+      "LIMIT $2"},
+
+    // GET_LEASE6_SUBID
+    { 1, { OID_INT8 },
+      "get_lease6_subid",
+      "SELECT address, duid, valid_lifetime, "
+        "extract(epoch from expire)::bigint, subnet_id, pref_lifetime, "
+        "lease_type, iaid, prefix_len, fqdn_fwd, fqdn_rev, hostname, "
+        "state "
+      "FROM lease6 "
+      "WHERE subnet_id = $1"},
+
     // GET_VERSION
     { 0, { OID_NONE },
       "get_version",
@@ -189,6 +266,22 @@ PgSqlTaggedStatement tagged_statements[] = {
         "state = $10"
       "WHERE address = $11"},
 
+    // UPDATE_LEASE4_BATCH
+    { 10, { OID_TEXT, OID_TEXT, OID_TEXT, OID_TEXT, OID_TEXT, OID_TEXT,
+            OID_TEXT, OID_TEXT, OID_TEXT, OID_TEXT },
+      "update_lease4_batch",
+      "UPDATE lease4 SET hwaddr = decode(u.hwaddr, 'hex'), "
+        "client_id = decode(u.client_id, 'hex'), "
+        "valid_lifetime = u.valid_lifetime, expire = u.expire, "
+        "subnet_id = u.subnet_id, fqdn_fwd = u.fqdn_fwd, "
+        "fqdn_rev = u.fqdn_rev, hostname = u.hostname, state = u.state "
+      "FROM unnest($1::bigint[], $2::varchar[], $3::varchar[], "
+        "$4::bigint[], $5::timestamp[], $6::bigint[], $7::boolean[], "
+        "$8::boolean[], $9::varchar[], $10::bigint[]) "
+        "AS u(address, hwaddr, client_id, valid_lifetime, expire, "
+        "subnet_id, fqdn_fwd, fqdn_rev, hostname, state) "
+      "WHERE lease4.address = u.address"},
+
     // UPDATE_LEASE6
     { 14, { OID_VARCHAR, OID_BYTEA, OID_INT8, OID_TIMESTAMP, OID_INT8, OID_INT8,
             OID_INT2, OID_INT8, OID_INT2, OID_BOOL, OID_BOOL, OID_VARCHAR,
@@ -201,6 +294,26 @@ PgSqlTaggedStatement tagged_statements[] = {
         "state = $13 "
       "WHERE address = $14"},
 
+    // UPDATE_LEASE6_BATCH
+    { 13, { OID_TEXT, OID_TEXT, OID_TEXT, OID_TEXT, OID_TEXT, OID_TEXT,
+            OID_TEXT, OID_TEXT, OID_TEXT, OID_TEXT, OID_TEXT, OID_TEXT,
+            OID_TEXT },
+      "update_lease6_batch",
+      "UPDATE lease6 SET duid = decode(u.duid, 'hex'), "
+        "valid_lifetime = u.valid_lifetime, expire = u.expire, "
+        "subnet_id = u.subnet_id, pref_lifetime = u.pref_lifetime, "
+        "lease_type = u.lease_type, iaid = u.iaid, "
+        "prefix_len = u.prefix_len, fqdn_fwd = u.fqdn_fwd, "
+        "fqdn_rev = u.fqdn_rev, hostname = u.hostname, state = u.state "
+      "FROM unnest($1::varchar[], $2::varchar[], $3::bigint[], "
+        "$4::timestamp[], $5::bigint[], $6::bigint[], $7::smallint[], "
+        "$8::bigint[], $9::smallint[], $10::boolean[], $11::boolean[], "
+        "$12::varchar[], $13::bigint[]) "
+        "AS u(address, duid, valid_lifetime, expire, subnet_id, "
+        "pref_lifetime, lease_type, iaid, prefix_len, fqdn_fwd, fqdn_rev, "
+        "hostname, state) "
+      "WHERE lease6.address = u.address"},
+
     // RECOUNT_LEASE4_STATS,
     { 0, { OID_NONE },
       "recount_lease4_stats",
@@ -214,10 +327,92 @@ PgSqlTaggedStatement tagged_statements[] = {
       "FROM lease6 GROUP BY subnet_id, lease_type, state "
       "ORDER BY subnet_id"},
 
+    // SUBNET_LEASE4_STATS,
+    { 1, { OID_TEXT },
+      "subnet_lease4_stats",
+      "SELECT subnet_id, state, count(state) as state_count "
+      "FROM lease4 WHERE subnet_id = ANY($1::bigint[]) "
+      "GROUP BY subnet_id, state ORDER BY subnet_id"},
+
+    // SUBNET_LEASE6_STATS,
+    { 1, { OID_TEXT },
+      "subnet_lease6_stats",
+      "SELECT subnet_id, lease_type, state, count(state) as state_count "
+      "FROM lease6 WHERE subnet_id = ANY($1::bigint[]) "
+      "GROUP BY subnet_id, lease_type, state "
+      "ORDER BY subnet_id"},
+
     // End of list sentinel
     { 0,  { 0 }, NULL, NULL}
 };
 
+/// @brief Collects the bound values of a batch of leases in array literals.
+///
+/// The values bound for each lease are appended to one array literal per
+/// column, e.g. {"3232235777","3232235778"}, so that a single statement
+/// can unnest the arrays and process the whole batch. Binary values are
+/// hex encoded, so the statement must decode them.
+class PgSqlBatchArrays {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param columns Number of leading bound values collected per lease.
+    explicit PgSqlBatchArrays(const size_t columns)
+        : arrays_(columns) {
+    }
+
+    /// @brief Appends the values bound for a lease.
+    ///
+    /// @param bind_array Values bound for the lease. Only the leading
+    /// columns are used.
+    void add(const PsqlBindArray& bind_array) {
+        if (bind_array.size() < arrays_.size()) {
+            isc_throw(DbOperationError, "unable to add " << bind_array.size()
+                      << " values to a batch of " << arrays_.size()
+                      << " columns");
+        }
+
+        for (size_t i = 0; i < arrays_.size(); ++i) {
+            std::string value;
+            if (bind_array.formats_[i] == PsqlBindArray::BINARY_FMT) {
+                const uint8_t* data = reinterpret_cast<const uint8_t*>
+                                      (bind_array.values_[i]);
+                std::vector<uint8_t> binary(data, data + bind_array.lengths_[i]);
+                value = util::encode::encodeHex(binary);
+            } else {
+                value.assign(bind_array.values_[i], bind_array.lengths_[i]);
+            }
+
+            std::string& array = arrays_[i];
+            array += (array.empty() ? "{\"" : ",\"");
+            for (std::string::const_iterator c = value.begin();
+                 c != value.end(); ++c) {
+                if ((*c == '"') || (*c == '\\')) {
+                    array += '\\';
+                }
+                array += *c;
+            }
+            array += '"';
+        }
+    }
+
+    /// @brief Binds the array literals.
+    ///
+    /// @param [out] bind_array Bind array to which the literals are added.
+    void createBind(PsqlBindArray& bind_array) const {
+        for (std::vector<std::string>::const_iterator array =
+                 arrays_.begin(); array != arrays_.end(); ++array) {
+            bind_array.addTempString(array->empty() ? "{}" : *array + "}");
+        }
+    }
+
+private:
+
+    /// @brief Array literals, without the closing brace, by column.
+    std::vector<std::string> arrays_;
+};
+
 };
 
 namespace isc {
@@ -715,10 +910,13 @@ public:
     /// @param statement The lease data SQL prepared statement to execute
     /// @param fetch_type Indicates whether or not lease_type should be
     /// fetched from the result set
+    /// @param subnet_ids Identifiers of the subnets to be examined. They
+    /// are passed to the statements having a parameter.
     PgSqlLeaseStatsQuery(PgSqlConnection& conn, PgSqlTaggedStatement& statement,
-                         const bool fetch_type)
+                         const bool fetch_type,
+                         const SubnetIDSet& subnet_ids = SubnetIDSet())
         : conn_(conn), statement_(statement), result_set_(), next_row_(0),
-         fetch_type_(fetch_type) {
+         fetch_type_(fetch_type), subnet_ids_(subnet_ids) {
     }
 
     /// @brief Destructor
@@ -730,9 +928,32 @@ public:
     /// against the database which sums the leases per lease state per
     /// subnet id.
     void start() {
-        // The query has no parameters, so we only need it's name.
-        result_set_.reset(new PgSqlResult(PQexecPrepared(conn_, statement_.name,
-                                          0, NULL, NULL, NULL, 0)));
+        if (statement_.nbparams == 0) {
+            // The query has no parameters, so we only need it's name.
+            result_set_.reset(new PgSqlResult(PQexecPrepared(conn_, statement_.name,
+                                              0, NULL, NULL, NULL, 0)));
+
+        } else {
+            // The subnet identifiers are passed as an array literal.
+            std::ostringstream subnet_ids;
+            subnet_ids << "{";
+            for (SubnetIDSet::const_iterator subnet_id = subnet_ids_.begin();
+                 subnet_id != subnet_ids_.end(); ++subnet_id) {
+                if (subnet_id != subnet_ids_.begin()) {
+                    subnet_ids << ",";
+                }
+                subnet_ids << *subnet_id;
+            }
+            subnet_ids << "}";
+
+            PsqlBindArray bind_array;
+            bind_array.addTempString(subnet_ids.str());
+            result_set_.reset(new PgSqlResult(PQexecPrepared(conn_, statement_.name,
+                                              statement_.nbparams,
+                                              &bind_array.values_[0],
+                                              &bind_array.lengths_[0],
+                                              &bind_array.formats_[0], 0)));
+        }
 
         conn_.checkStatementError(*result_set_, statement_);
     }
@@ -801,23 +1022,526 @@ protected:
 
     /// @brief Indicates if query supplies lease type
     bool fetch_type_;
+
+    /// @brief Identifiers of the subnets to be examined
+    SubnetIDSet subnet_ids_;
 };
 
-PgSqlLeaseMgr::PgSqlLeaseMgr(const DatabaseConnection::ParameterMap& parameters)
-    : LeaseMgr(), exchange4_(new PgSqlLease4Exchange()),
-    exchange6_(new PgSqlLease6Exchange()), conn_(parameters) {
-    conn_.openDatabase();
-    int i = 0;
-    for( ; tagged_statements[i].text != NULL ; ++i) {
-        conn_.prepareStatement(tagged_statements[i]);
+/// @brief Connection to the database with the exchange objects using it.
+///
+/// The contexts are held by the pool of connections of @c PgSqlLeaseMgr.
+class PgSqlLeaseContext : public boost::noncopyable {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param parameters database access parameters
+    PgSqlLeaseContext(const DatabaseConnection::ParameterMap& parameters)
+        : conn_(parameters), exchange4_(new PgSqlLease4Exchange()),
+          exchange6_(new PgSqlLease6Exchange()) {
     }
 
-    // Just in case somebody foo-barred things
-    if (i != NUM_STATEMENTS) {
-        isc_throw(DbOpenError, "Number of statements prepared: " << i
-                  << " does not match expected count:" << NUM_STATEMENTS);
+    /// @brief Checks if the connection can be used.
+    bool isUsable() const {
+        return (conn_.isUsable());
+    }
+
+    /// @brief PostgreSQL connection handle.
+    PgSqlConnection conn_;
+
+    /// The exchange objects are used for transfer of data to/from the
+    /// database. They are pointed-to objects as the contents may change in
+    /// "const" calls.
+    boost::scoped_ptr<PgSqlLease4Exchange> exchange4_; ///< Exchange object
+    boost::scoped_ptr<PgSqlLease6Exchange> exchange6_; ///< Exchange object
+};
+
+#ifdef LIBPQ_HAS_PIPELINING
+
+/// @brief Pipeline of the asynchronous lease operations.
+///
+/// Owns a dedicated connection to the database in pipeline mode, and a
+/// thread reading the results of the operations and invoking their
+/// callbacks. The queries are sent by the threads issuing the operations,
+/// so many operations may be in flight at the same time.
+///
+/// Each query is followed by a synchronization point, so the results of
+/// an operation are: the query result, a null result, and the result of
+/// the synchronization point. When the connection fails, the pending
+/// operations complete with an error and the connection is opened again
+/// by the next operation.
+class PgSqlLeasePipeline : public boost::noncopyable {
+public:
+
+    /// @brief Asynchronous operation types.
+    enum Operation {
+        ADD,
+        GET,
+        UPDATE,
+        DELETE
+    };
+
+    /// @brief Asynchronous operation request.
+    struct Request {
+
+        /// @brief Constructor.
+        ///
+        /// @param operation operation type
+        /// @param addr address of the lease
+        /// @param callback callback invoked with the result
+        Request(const Operation operation, const IOAddress& addr,
+                const AsyncLeaseCallback& callback)
+            : operation_(operation), addr_(addr), type_(Lease::TYPE_NA),
+              lease4_(), lease6_(), callback_(callback) {
+        }
+
+        /// @brief Operation type.
+        Operation operation_;
+
+        /// @brief Address of the lease.
+        IOAddress addr_;
+
+        /// @brief Type of the searched IPv6 lease.
+        Lease::Type type_;
+
+        /// @brief IPv4 lease to be added or updated.
+        Lease4Ptr lease4_;
+
+        /// @brief IPv6 lease to be added or updated.
+        Lease6Ptr lease6_;
+
+        /// @brief Callback invoked with the result.
+        AsyncLeaseCallback callback_;
+    };
+
+    /// @brief Constructor.
+    ///
+    /// Starts the thread reading the results. The connection is opened
+    /// by the first operation.
+    ///
+    /// @param parameters database access parameters
+    PgSqlLeasePipeline(const DatabaseConnection::ParameterMap& parameters)
+        : parameters_(parameters), conn_(), exchange4_(), exchange6_(),
+          pending_(), completing_(0), stopping_(false), open_mutex_(),
+          mutex_(), cond_(), thread_() {
+        thread_.reset(new isc::util::thread::Thread(
+                          boost::bind(&PgSqlLeasePipeline::run, this)));
+    }
+
+    /// @brief Destructor.
+    ///
+    /// Waits for the completion of the pending operations and stops the
+    /// thread.
+    ~PgSqlLeasePipeline() {
+        {
+            Mutex::Locker lock(mutex_);
+            stopping_ = true;
+            cond_.broadcast();
+        }
+        thread_->wait();
+    }
+
+    /// @brief Sends the query of an operation.
+    ///
+    /// @param request operation request
+    /// @throw DbOpenError if the connection can't be opened
+    /// @throw DbOperationError if the query can't be sent
+    void send(const Request& request) {
+        open();
+
+        Mutex::Locker lock(mutex_);
+        // The connection may have been closed by the thread meanwhile.
+        if (!conn_) {
+            isc_throw(DbOperationError, "connection to the database lost");
+        }
+
+        // The bound values may be held by the exchange objects, which
+        // are protected by the mutex until the query is sent.
+        PsqlBindArray bind_array;
+        std::string addr_str;
+        std::string type_str;
+        PgSqlLeaseMgr::StatementIndex stindex;
+        if (request.addr_.isV4()) {
+            addr_str = boost::lexical_cast<std::string>
+                (request.addr_.toUint32());
+        } else {
+            addr_str = request.addr_.toText();
+        }
+        switch (request.operation_) {
+        case ADD:
+            if (request.lease4_) {
+                exchange4_.createBindForSend(request.lease4_, bind_array);
+                stindex = PgSqlLeaseMgr::INSERT_LEASE4;
+            } else {
+                exchange6_.createBindForSend(request.lease6_, bind_array);
+                stindex = PgSqlLeaseMgr::INSERT_LEASE6;
+            }
+            break;
+
+        case GET:
+            bind_array.add(addr_str);
+            if (request.addr_.isV4()) {
+                stindex = PgSqlLeaseMgr::GET_LEASE4_ADDR;
+            } else {
+                type_str = boost::lexical_cast<std::string>(request.type_);
+                bind_array.add(type_str);
+                stindex = PgSqlLeaseMgr::GET_LEASE6_ADDR;
+            }
+            break;
+
+        case UPDATE:
+            if (request.lease4_) {
+                exchange4_.createBindForSend(request.lease4_, bind_array);
+                stindex = PgSqlLeaseMgr::UPDATE_LEASE4;
+            } else {
+                exchange6_.createBindForSend(request.lease6_, bind_array);
+                stindex = PgSqlLeaseMgr::UPDATE_LEASE6;
+            }
+            bind_array.add(addr_str);
+            break;
+
+        default:
+            bind_array.add(addr_str);
+            stindex = (request.addr_.isV4() ? PgSqlLeaseMgr::DELETE_LEASE4 :
+                       PgSqlLeaseMgr::DELETE_LEASE6);
+        }
+
+        if (!PQsendQueryPrepared(*conn_, tagged_statements[stindex].name,
+                                 tagged_statements[stindex].nbparams,
+                                 &bind_array.values_[0],
+                                 &bind_array.lengths_[0],
+                                 &bind_array.formats_[0], 0) ||
+            !PQpipelineSync(*conn_)) {
+            const std::string error = PQerrorMessage(*conn_);
+            // A broken connection is closed by the thread when operations
+            // are pending, otherwise here so the next operation reopens it.
+            if ((PQstatus(*conn_) != CONNECTION_OK) && pending_.empty()) {
+                conn_.reset();
+            }
+            isc_throw(DbOperationError, "unable to send statement "
+                      << tagged_statements[stindex].name << ": " << error);
+        }
+        // The queries which are not flushed now are flushed by the thread.
+        static_cast<void>(PQflush(*conn_));
+
+        pending_.push_back(Pending(request, stindex));
+        cond_.broadcast();
+    }
+
+    /// @brief Waits for the completion of the pending operations.
+    void wait() {
+        Mutex::Locker lock(mutex_);
+        while (!pending_.empty() || (completing_ > 0)) {
+            cond_.wait(mutex_);
+        }
+    }
+
+private:
+
+    /// @brief Pending operation.
+    struct Pending {
+
+        /// @brief Constructor.
+        ///
+        /// @param request operation request
+        /// @param stindex index of the statement of the query
+        Pending(const Request& request,
+                const PgSqlLeaseMgr::StatementIndex stindex)
+            : request_(request), stindex_(stindex), stage_(QUERY_RESULT),
+              result_() {
+        }
+
+        /// @brief Operation request.
+        Request request_;
+
+        /// @brief Index of the statement of the query.
+        PgSqlLeaseMgr::StatementIndex stindex_;
+
+        /// @brief Next expected result.
+        enum {
+            QUERY_RESULT,
+            END_OF_QUERY,
+            SYNC_RESULT
+        } stage_;
+
+        /// @brief Result of the operation.
+        AsyncLeaseResult result_;
+    };
+
+    /// @brief Completed operations, whose callbacks are to be invoked.
+    typedef std::vector<std::pair<AsyncLeaseCallback, AsyncLeaseResult> >
+        Completed;
+
+    /// @brief Opens the connection in pipeline mode if it isn't open.
+    ///
+    /// The connection is opened without holding the mutex, so the thread
+    /// isn't blocked while the database server is being contacted. The
+    /// concurrent callers wait for the connection opened by the first one.
+    ///
+    /// @throw DbOpenError if the connection can't be opened
+    void open() {
+        Mutex::Locker open_lock(open_mutex_);
+        {
+            Mutex::Locker lock(mutex_);
+            if (conn_) {
+                return;
+            }
+        }
+
+        LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE, DHCPSRV_PGSQL_PIPELINE_OPEN);
+        boost::scoped_ptr<PgSqlConnection> conn(new PgSqlConnection(parameters_));
+        conn->openDatabase();
+        for (int i = 0; tagged_statements[i].text != NULL; ++i) {
+            conn->prepareStatement(tagged_statements[i]);
+        }
+        if (!PQenterPipelineMode(*conn) || (PQsetnonblocking(*conn, 1) != 0)) {
+            isc_throw(DbOpenError, "unable to enter the pipeline mode: "
+                      << PQerrorMessage(*conn));
+        }
+
+        Mutex::Locker lock(mutex_);
+        conn_.swap(conn);
+    }
+
+    /// @brief Thread reading the results and invoking the callbacks.
+    void run() {
+        for (;;) {
+            Completed completed;
+            int socket = -1;
+            bool flushing = false;
+            {
+                Mutex::Locker lock(mutex_);
+                if (pending_.empty()) {
+                    if (stopping_) {
+                        return;
+                    }
+                    static_cast<void>(cond_.timedWait(mutex_, 100));
+                    continue;
+                }
+                const int flush = PQflush(*conn_);
+                if ((flush < 0) || !PQconsumeInput(*conn_)) {
+                    fail(PQerrorMessage(*conn_), completed);
+                } else {
+                    readResults(completed);
+                    flushing = (flush > 0);
+                    socket = PQsocket(*conn_);
+                }
+                completing_ += completed.size();
+            }
+
+            if (completed.empty()) {
+                // Wait for the results or for the room to send the queries.
+                struct pollfd pfd;
+                pfd.fd = socket;
+                pfd.events = POLLIN | (flushing ? POLLOUT : 0);
+                pfd.revents = 0;
+                static_cast<void>(poll(&pfd, 1, 100));
+                continue;
+            }
+
+            for (Completed::const_iterator c = completed.begin();
+                 c != completed.end(); ++c) {
+                try {
+                    c->first(c->second);
+                } catch (const std::exception& ex) {
+                    LOG_ERROR(dhcpsrv_logger,
+                              DHCPSRV_PGSQL_ASYNC_CALLBACK_FAILED)
+                        .arg(ex.what());
+                }
+            }
+
+            Mutex::Locker lock(mutex_);
+            completing_ -= completed.size();
+            cond_.broadcast();
+        }
+    }
+
+    /// @brief Reads the available results of the pending operations.
+    ///
+    /// Must be called with the mutex held.
+    ///
+    /// @param [out] completed completed operations
+    void readResults(Completed& completed) {
+        while (!pending_.empty() && !PQisBusy(*conn_)) {
+            Pending& pending = pending_.front();
+            PGresult* result = PQgetResult(*conn_);
+            switch (pending.stage_) {
+            case Pending::QUERY_RESULT:
+                if (result == NULL) {
+                    pending.result_.error_ = "no result returned for "
+                        "statement " +
+                        std::string(tagged_statements[pending.stindex_].name);
+                    pending.stage_ = Pending::SYNC_RESULT;
+                } else {
+                    PgSqlResult r(result);
+                    processResult(pending, r);
+                    pending.stage_ = Pending::END_OF_QUERY;
+                }
+                break;
+
+            case Pending::END_OF_QUERY:
+                if (result == NULL) {
+                    pending.stage_ = Pending::SYNC_RESULT;
+                } else {
+                    PQclear(result);
+                }
+                break;
+
+            default:
+                if (result != NULL) {
+                    PQclear(result);
+                }
+                completed.push_back(std::make_pair(pending.request_.callback_,
+                                                   pending.result_));
+                pending_.pop_front();
+            }
+        }
     }
 
+    /// @brief Sets the result of an operation from its query result.
+    ///
+    /// @param pending pending operation
+    /// @param r query result
+    void processResult(Pending& pending, const PgSqlResult& r) {
+        AsyncLeaseResult& result = pending.result_;
+        const Request& request = pending.request_;
+        const ExecStatusType status = PQresultStatus(r);
+        if ((request.operation_ == ADD) && (status != PGRES_COMMAND_OK) &&
+            conn_->compareError(r, PgSqlConnection::DUPLICATE_KEY)) {
+            // The lease exists.
+            return;
+        }
+        if ((status != PGRES_COMMAND_OK) && (status != PGRES_TUPLES_OK)) {
+            const char* error_message = PQresultErrorMessage(r);
+            result.error_ = "Statement exec failed: for: " +
+                std::string(tagged_statements[pending.stindex_].name) +
+                ", reason: " + std::string(error_message ? error_message : "");
+            return;
+        }
+
+        try {
+            switch (request.operation_) {
+            case ADD:
+                result.success_ = true;
+                break;
+
+            case GET:
+                if (r.getRows() > 1) {
+                    isc_throw(MultipleRecords, "multiple records were found in"
+                              " the database where only one was expected for"
+                              " query " << tagged_statements[pending.stindex_].name);
+                } else if (r.getRows() == 1) {
+                    if (request.addr_.isV4()) {
+                        result.lease4_ = exchange4_.convertFromDatabase(r, 0);
+                    } else {
+                        result.lease6_ = exchange6_.convertFromDatabase(r, 0);
+                    }
+                }
+                result.success_ = true;
+                break;
+
+            case UPDATE:
+            {
+                const int affected_rows =
+                    boost::lexical_cast<int>(PQcmdTuples(r));
+                if (affected_rows == 0) {
+                    isc_throw(NoSuchLease, "unable to update lease for"
+                              " address " << request.addr_.toText()
+                              << " as it does not exist");
+                } else if (affected_rows > 1) {
+                    isc_throw(DbOperationError, "apparently updated more than"
+                              " one lease that had the address "
+                              << request.addr_.toText());
+                }
+                result.success_ = true;
+                break;
+            }
+
+            default:
+                result.success_ = (boost::lexical_cast<int>(PQcmdTuples(r)) > 0);
+            }
+        } catch (const std::exception& ex) {
+            result.error_ = ex.what();
+        }
+    }
+
+    /// @brief Completes the pending operations with an error and closes
+    /// the connection.
+    ///
+    /// Must be called with the mutex held.
+    ///
+    /// @param error error message
+    /// @param [out] completed completed operations
+    void fail(const std::string& error, Completed& completed) {
+        LOG_ERROR(dhcpsrv_logger, DHCPSRV_PGSQL_PIPELINE_ERROR).arg(error);
+        while (!pending_.empty()) {
+            Pending& pending = pending_.front();
+            pending.result_.success_ = false;
+            pending.result_.error_ = error;
+            completed.push_back(std::make_pair(pending.request_.callback_,
+                                               pending.result_));
+            pending_.pop_front();
+        }
+        conn_.reset();
+    }
+
+    /// @brief Database access parameters.
+    DatabaseConnection::ParameterMap parameters_;
+
+    /// @brief Connection in pipeline mode, null when it isn't open.
+    boost::scoped_ptr<PgSqlConnection> conn_;
+
+    /// @brief Exchange object of the IPv4 leases.
+    PgSqlLease4Exchange exchange4_;
+
+    /// @brief Exchange object of the IPv6 leases.
+    PgSqlLease6Exchange exchange6_;
+
+    /// @brief Operations sent and not completed, in the order of sending.
+    std::deque<Pending> pending_;
+
+    /// @brief Number of completed operations whose callbacks are being
+    /// invoked.
+    size_t completing_;
+
+    /// @brief Indicates if the thread is to be stopped.
+    bool stopping_;
+
+    /// @brief Mutex serializing the opening of the connection.
+    Mutex open_mutex_;
+
+    /// @brief Mutex protecting the connection and the pending operations.
+    Mutex mutex_;
+
+    /// @brief Condition variable signaled when an operation is sent or
+    /// completed.
+    CondVar cond_;
+
+    /// @brief Thread reading the results.
+    boost::scoped_ptr<isc::util::thread::Thread> thread_;
+};
+
+#else
+
+/// @brief Pipeline of the asynchronous lease operations.
+///
+/// The pipeline mode is not supported by this version of libpq.
+class PgSqlLeasePipeline {
+};
+
+#endif
+
+PgSqlLeaseMgr::PgSqlLeaseMgr(const DatabaseConnection::ParameterMap& parameters)
+    : LeaseMgr(), parameters_(parameters), pool_(), pipeline_(),
+    pipeline_mutex_() {
+    // The pool opens the first connection.
+    pool_.reset(new PgSqlLeaseContextPool(
+        boost::bind(&PgSqlLeaseMgr::createContext, this),
+        DatabaseConnection::getUint32Parameter(parameters,
+                                               "connection-pool-size", 1),
+        DatabaseConnection::getUint32Parameter(parameters,
+                                               "reconnect-wait-time", 1000)));
+
     pair<uint32_t, uint32_t> code_version(PG_SCHEMA_VERSION_MAJOR, PG_SCHEMA_VERSION_MINOR);
     pair<uint32_t, uint32_t> db_version = getVersion();
     if (code_version != db_version) {
@@ -832,6 +1556,156 @@ PgSqlLeaseMgr::PgSqlLeaseMgr(const DatabaseConnection::ParameterMap& parameters)
 PgSqlLeaseMgr::~PgSqlLeaseMgr() {
 }
 
+PgSqlLeaseContextPtr
+PgSqlLeaseMgr::createContext() const {
+    PgSqlLeaseContextPtr ctx(new PgSqlLeaseContext(parameters_));
+
+    // A lost connection is replaced by the pool.
+    ctx->conn_.setRecoverable(true);
+    ctx->conn_.openDatabase();
+    int i = 0;
+    for( ; tagged_statements[i].text != NULL ; ++i) {
+        ctx->conn_.prepareStatement(tagged_statements[i]);
+    }
+
+    // Just in case somebody foo-barred things
+    if (i != NUM_STATEMENTS) {
+        isc_throw(DbOpenError, "Number of statements prepared: " << i
+                  << " does not match expected count:" << NUM_STATEMENTS);
+    }
+    return (ctx);
+}
+
+#ifdef LIBPQ_HAS_PIPELINING
+
+PgSqlLeasePipeline&
+PgSqlLeaseMgr::getPipeline() {
+    Mutex::Locker lock(pipeline_mutex_);
+    if (!pipeline_) {
+        pipeline_.reset(new PgSqlLeasePipeline(parameters_));
+    }
+    return (*pipeline_);
+}
+
+namespace {
+
+/// @brief Sends an asynchronous operation, reporting a failure to send it
+/// to its callback.
+///
+/// @param pipeline pipeline of the asynchronous operations
+/// @param request operation request
+void
+sendAsync(PgSqlLeasePipeline& pipeline,
+          const PgSqlLeasePipeline::Request& request) {
+    AsyncLeaseResult result;
+    try {
+        pipeline.send(request);
+        return;
+    } catch (const std::exception& ex) {
+        result.error_ = ex.what();
+    }
+    request.callback_(result);
+}
+
+}
+
+void
+PgSqlLeaseMgr::asyncAddLease(const Lease4Ptr& lease,
+                             const AsyncLeaseCallback& callback) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_PGSQL_ADD_ADDR4).arg(lease->addr_.toText());
+
+    PgSqlLeasePipeline::Request request(PgSqlLeasePipeline::ADD,
+                                        lease->addr_, callback);
+    request.lease4_ = lease;
+    sendAsync(getPipeline(), request);
+}
+
+void
+PgSqlLeaseMgr::asyncAddLease(const Lease6Ptr& lease,
+                             const AsyncLeaseCallback& callback) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_PGSQL_ADD_ADDR6).arg(lease->addr_.toText());
+
+    PgSqlLeasePipeline::Request request(PgSqlLeasePipeline::ADD,
+                                        lease->addr_, callback);
+    request.lease6_ = lease;
+    sendAsync(getPipeline(), request);
+}
+
+void
+PgSqlLeaseMgr::asyncGetLease4(const isc::asiolink::IOAddress& addr,
+                              const AsyncLeaseCallback& callback) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_PGSQL_GET_ADDR4).arg(addr.toText());
+
+    sendAsync(getPipeline(),
+              PgSqlLeasePipeline::Request(PgSqlLeasePipeline::GET, addr,
+                                          callback));
+}
+
+void
+PgSqlLeaseMgr::asyncGetLease6(Lease::Type lease_type,
+                              const isc::asiolink::IOAddress& addr,
+                              const AsyncLeaseCallback& callback) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_PGSQL_GET_ADDR6)
+              .arg(addr.toText()).arg(lease_type);
+
+    PgSqlLeasePipeline::Request request(PgSqlLeasePipeline::GET, addr,
+                                        callback);
+    request.type_ = lease_type;
+    sendAsync(getPipeline(), request);
+}
+
+void
+PgSqlLeaseMgr::asyncUpdateLease4(const Lease4Ptr& lease,
+                                 const AsyncLeaseCallback& callback) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_PGSQL_UPDATE_ADDR4).arg(lease->addr_.toText());
+
+    PgSqlLeasePipeline::Request request(PgSqlLeasePipeline::UPDATE,
+                                        lease->addr_, callback);
+    request.lease4_ = lease;
+    sendAsync(getPipeline(), request);
+}
+
+void
+PgSqlLeaseMgr::asyncUpdateLease6(const Lease6Ptr& lease,
+                                 const AsyncLeaseCallback& callback) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_PGSQL_UPDATE_ADDR6).arg(lease->addr_.toText());
+
+    PgSqlLeasePipeline::Request request(PgSqlLeasePipeline::UPDATE,
+                                        lease->addr_, callback);
+    request.lease6_ = lease;
+    sendAsync(getPipeline(), request);
+}
+
+void
+PgSqlLeaseMgr::asyncDeleteLease(const isc::asiolink::IOAddress& addr,
+                                const AsyncLeaseCallback& callback) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_PGSQL_DELETE_ADDR).arg(addr.toText());
+
+    sendAsync(getPipeline(),
+              PgSqlLeasePipeline::Request(PgSqlLeasePipeline::DELETE, addr,
+                                          callback));
+}
+
+void
+PgSqlLeaseMgr::asyncWait() {
+    PgSqlLeasePipeline* pipeline = 0;
+    {
+        Mutex::Locker lock(pipeline_mutex_);
+        pipeline = pipeline_.get();
+    }
+    if (pipeline) {
+        pipeline->wait();
+    }
+}
+
+#endif
+
 std::string
 PgSqlLeaseMgr::getDBVersion() {
     std::stringstream tmp;
@@ -842,9 +1716,10 @@ PgSqlLeaseMgr::getDBVersion() {
 }
 
 bool
-PgSqlLeaseMgr::addLeaseCommon(StatementIndex stindex,
+PgSqlLeaseMgr::addLeaseCommon(PgSqlLeaseContext& ctx,
+                              StatementIndex stindex,
                               PsqlBindArray& bind_array) {
-    PgSqlResult r(PQexecPrepared(conn_, tagged_statements[stindex].name,
+    PgSqlResult r(PQexecPrepared(ctx.conn_, tagged_statements[stindex].name,
                                  tagged_statements[stindex].nbparams,
                                  &bind_array.values_[0],
                                  &bind_array.lengths_[0],
@@ -856,11 +1731,11 @@ PgSqlLeaseMgr::addLeaseCommon(StatementIndex stindex,
         // Failure: check for the special case of duplicate entry.  If this is
         // the case, we return false to indicate that the row was not added.
         // Otherwise we throw an exception.
-        if (conn_.compareError(r, PgSqlConnection::DUPLICATE_KEY)) {
+        if (ctx.conn_.compareError(r, PgSqlConnection::DUPLICATE_KEY)) {
             return (false);
         }
 
-        conn_.checkStatementError(r, tagged_statements[stindex]);
+        ctx.conn_.checkStatementError(r, tagged_statements[stindex]);
     }
 
     return (true);
@@ -868,37 +1743,44 @@ PgSqlLeaseMgr::addLeaseCommon(StatementIndex stindex,
 
 bool
 PgSqlLeaseMgr::addLease(const Lease4Ptr& lease) {
+    StageTimer timer(ProcessingLatency::STAGE_LEASE_WRITE);
+
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_PGSQL_ADD_ADDR4).arg(lease->addr_.toText());
 
     PsqlBindArray bind_array;
-    exchange4_->createBindForSend(lease, bind_array);
-    return (addLeaseCommon(INSERT_LEASE4, bind_array));
+    PgSqlLeaseContextPool::Holder ctx(*pool_);
+    ctx->exchange4_->createBindForSend(lease, bind_array);
+    return (addLeaseCommon(*ctx, INSERT_LEASE4, bind_array));
 }
 
 bool
 PgSqlLeaseMgr::addLease(const Lease6Ptr& lease) {
+    StageTimer timer(ProcessingLatency::STAGE_LEASE_WRITE);
+
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_PGSQL_ADD_ADDR6).arg(lease->addr_.toText());
     PsqlBindArray bind_array;
-    exchange6_->createBindForSend(lease, bind_array);
+    PgSqlLeaseContextPool::Holder ctx(*pool_);
+    ctx->exchange6_->createBindForSend(lease, bind_array);
 
-    return (addLeaseCommon(INSERT_LEASE6, bind_array));
+    return (addLeaseCommon(*ctx, INSERT_LEASE6, bind_array));
 }
 
 template <typename Exchange, typename LeaseCollection>
-void PgSqlLeaseMgr::getLeaseCollection(StatementIndex stindex,
+void PgSqlLeaseMgr::getLeaseCollection(PgSqlLeaseContext& ctx,
+                                       StatementIndex stindex,
                                        PsqlBindArray& bind_array,
                                        Exchange& exchange,
                                        LeaseCollection& result,
                                        bool single) const {
-    PgSqlResult r(PQexecPrepared(conn_, tagged_statements[stindex].name,
+    PgSqlResult r(PQexecPrepared(ctx.conn_, tagged_statements[stindex].name,
                                  tagged_statements[stindex].nbparams,
                                  &bind_array.values_[0],
                                  &bind_array.lengths_[0],
                                  &bind_array.formats_[0], 0));
 
-    conn_.checkStatementError(r, tagged_statements[stindex]);
+    ctx.conn_.checkStatementError(r, tagged_statements[stindex]);
 
     int rows = PQntuples(r);
     if (single && rows > 1) {
@@ -912,17 +1794,34 @@ void PgSqlLeaseMgr::getLeaseCollection(StatementIndex stindex,
     }
 }
 
+void
+PgSqlLeaseMgr::getLeaseCollection(PgSqlLeaseContext& ctx,
+                                  StatementIndex stindex,
+                                  PsqlBindArray& bind_array,
+                                  Lease4Collection& result) const {
+    getLeaseCollection(ctx, stindex, bind_array, ctx.exchange4_, result);
+}
+
+void
+PgSqlLeaseMgr::getLeaseCollection(PgSqlLeaseContext& ctx,
+                                  StatementIndex stindex,
+                                  PsqlBindArray& bind_array,
+                                  Lease6Collection& result) const {
+    getLeaseCollection(ctx, stindex, bind_array, ctx.exchange6_, result);
+}
+
 
 void
-PgSqlLeaseMgr::getLease(StatementIndex stindex, PsqlBindArray& bind_array,
-                             Lease4Ptr& result) const {
+PgSqlLeaseMgr::getLease(PgSqlLeaseContext& ctx, StatementIndex stindex,
+                        PsqlBindArray& bind_array, Lease4Ptr& result) const {
     // Create appropriate collection object and get all leases matching
     // the selection criteria.  The "single" parameter is true to indicate
     // that the called method should throw an exception if multiple
     // matching records are found: this particular method is called when only
     // one or zero matches is expected.
     Lease4Collection collection;
-    getLeaseCollection(stindex, bind_array, exchange4_, collection, true);
+    getLeaseCollection(ctx, stindex, bind_array, ctx.exchange4_, collection,
+                       true);
 
     // Return single record if present, else clear the lease.
     if (collection.empty()) {
@@ -934,15 +1833,16 @@ PgSqlLeaseMgr::getLease(StatementIndex stindex, PsqlBindArray& bind_array,
 
 
 void
-PgSqlLeaseMgr::getLease(StatementIndex stindex, PsqlBindArray& bind_array,
-                             Lease6Ptr& result) const {
+PgSqlLeaseMgr::getLease(PgSqlLeaseContext& ctx, StatementIndex stindex,
+                        PsqlBindArray& bind_array, Lease6Ptr& result) const {
     // Create appropriate collection object and get all leases matching
     // the selection criteria.  The "single" parameter is true to indicate
     // that the called method should throw an exception if multiple
     // matching records are found: this particular method is called when only
     // one or zero matches is expected.
     Lease6Collection collection;
-    getLeaseCollection(stindex, bind_array, exchange6_, collection, true);
+    getLeaseCollection(ctx, stindex, bind_array, ctx.exchange6_, collection,
+                       true);
 
     // Return single record if present, else clear the lease.
     if (collection.empty()) {
@@ -967,7 +1867,8 @@ PgSqlLeaseMgr::getLease4(const isc::asiolink::IOAddress& addr) const {
 
     // Get the data
     Lease4Ptr result;
-    getLease(GET_LEASE4_ADDR, bind_array, result);
+    PgSqlLeaseContextPool::Holder ctx(*pool_);
+    getLease(*ctx, GET_LEASE4_ADDR, bind_array, result);
 
     return (result);
 }
@@ -989,7 +1890,8 @@ PgSqlLeaseMgr::getLease4(const HWAddr& hwaddr) const {
 
     // Get the data
     Lease4Collection result;
-    getLeaseCollection(GET_LEASE4_HWADDR, bind_array, result);
+    PgSqlLeaseContextPool::Holder ctx(*pool_);
+    getLeaseCollection(*ctx, GET_LEASE4_HWADDR, bind_array, result);
 
     return (result);
 }
@@ -1016,7 +1918,8 @@ PgSqlLeaseMgr::getLease4(const HWAddr& hwaddr, SubnetID subnet_id) const {
 
     // Get the data
     Lease4Ptr result;
-    getLease(GET_LEASE4_HWADDR_SUBID, bind_array, result);
+    PgSqlLeaseContextPool::Holder ctx(*pool_);
+    getLease(*ctx, GET_LEASE4_HWADDR_SUBID, bind_array, result);
 
     return (result);
 }
@@ -1034,7 +1937,8 @@ PgSqlLeaseMgr::getLease4(const ClientId& clientid) const {
 
     // Get the data
     Lease4Collection result;
-    getLeaseCollection(GET_LEASE4_CLIENTID, bind_array, result);
+    PgSqlLeaseContextPool::Holder ctx(*pool_);
+    getLeaseCollection(*ctx, GET_LEASE4_CLIENTID, bind_array, result);
 
     return (result);
 }
@@ -1057,7 +1961,8 @@ PgSqlLeaseMgr::getLease4(const ClientId& clientid, SubnetID subnet_id) const {
 
     // Get the data
     Lease4Ptr result;
-    getLease(GET_LEASE4_CLIENTID_SUBID, bind_array, result);
+    PgSqlLeaseContextPool::Holder ctx(*pool_);
+    getLease(*ctx, GET_LEASE4_CLIENTID_SUBID, bind_array, result);
 
     return (result);
 }
@@ -1072,6 +1977,75 @@ PgSqlLeaseMgr::getLease4(const ClientId&, const HWAddr&, SubnetID) const {
               " called, but it is not implemented");
 }
 
+Lease4Collection
+PgSqlLeaseMgr::getLeases4(SubnetID subnet_id) const {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_PGSQL_GET_SUBID4)
+        .arg(subnet_id);
+
+    // Set up the WHERE clause value
+    PsqlBindArray bind_array;
+
+    // SUBNET_ID
+    std::string subnet_id_str = boost::lexical_cast<std::string>(subnet_id);
+    bind_array.add(subnet_id_str);
+
+    // ... and get the data
+    Lease4Collection result;
+    PgSqlLeaseContextPool::Holder ctx(*pool_);
+    getLeaseCollection(*ctx, GET_LEASE4_SUBID, bind_array, result);
+
+    return (result);
+}
+
+Lease4Collection
+PgSqlLeaseMgr::getLeases4() const {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_PGSQL_GET4);
+
+    // Provide empty binding array because our query has no parameters in
+    // WHERE clause.
+    PsqlBindArray bind_array;
+    Lease4Collection result;
+    PgSqlLeaseContextPool::Holder ctx(*pool_);
+    getLeaseCollection(*ctx, GET_LEASE4, bind_array, result);
+
+    return (result);
+}
+
+Lease4Collection
+PgSqlLeaseMgr::getLeases4(const asiolink::IOAddress& lower_bound_address,
+                          const LeasePageSize& page_size) const {
+    // Expecting IPv4 address.
+    if (!lower_bound_address.isV4()) {
+        isc_throw(InvalidParameter, "expected IPv4 address while "
+                  "retrieving leases from the lease database, got "
+                  << lower_bound_address);
+    }
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_PGSQL_GET_PAGE4)
+        .arg(page_size.page_size_)
+        .arg(lower_bound_address.toText());
+
+    // Prepare WHERE clause
+    PsqlBindArray bind_array;
+
+    // Bind lower bound address
+    std::string lb_address_data = boost::lexical_cast<std::string>
+                                  (lower_bound_address.toUint32());
+    bind_array.add(lb_address_data);
+
+    // Bind page size value
+    std::string page_size_data = boost::lexical_cast<std::string>
+                                 (page_size.page_size_);
+    bind_array.add(page_size_data);
+
+    // Get the leases
+    Lease4Collection result;
+    PgSqlLeaseContextPool::Holder ctx(*pool_);
+    getLeaseCollection(*ctx, GET_LEASE4_PAGE, bind_array, result);
+
+    return (result);
+}
+
 Lease6Ptr
 PgSqlLeaseMgr::getLease6(Lease::Type lease_type,
                          const isc::asiolink::IOAddress& addr) const {
@@ -1091,7 +2065,8 @@ PgSqlLeaseMgr::getLease6(Lease::Type lease_type,
 
     // ... and get the data
     Lease6Ptr result;
-    getLease(GET_LEASE6_ADDR, bind_array, result);
+    PgSqlLeaseContextPool::Holder ctx(*pool_);
+    getLease(*ctx, GET_LEASE6_ADDR, bind_array, result);
 
     return (result);
 }
@@ -1119,7 +2094,8 @@ PgSqlLeaseMgr::getLeases6(Lease::Type lease_type, const DUID& duid,
 
     // ... and get the data
     Lease6Collection result;
-    getLeaseCollection(GET_LEASE6_DUID_IAID, bind_array, result);
+    PgSqlLeaseContextPool::Holder ctx(*pool_);
+    getLeaseCollection(*ctx, GET_LEASE6_DUID_IAID, bind_array, result);
 
     return (result);
 }
@@ -1151,7 +2127,81 @@ PgSqlLeaseMgr::getLeases6(Lease::Type lease_type, const DUID& duid,
 
     // ... and get the data
     Lease6Collection result;
-    getLeaseCollection(GET_LEASE6_DUID_IAID_SUBID, bind_array, result);
+    PgSqlLeaseContextPool::Holder ctx(*pool_);
+    getLeaseCollection(*ctx, GET_LEASE6_DUID_IAID_SUBID, bind_array, result);
+
+    return (result);
+}
+
+Lease6Collection
+PgSqlLeaseMgr::getLeases6(SubnetID subnet_id) const {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_PGSQL_GET_SUBID6)
+        .arg(subnet_id);
+
+    // Set up the WHERE clause value
+    PsqlBindArray bind_array;
+
+    // SUBNET_ID
+    std::string subnet_id_str = boost::lexical_cast<std::string>(subnet_id);
+    bind_array.add(subnet_id_str);
+
+    // ... and get the data
+    Lease6Collection result;
+    PgSqlLeaseContextPool::Holder ctx(*pool_);
+    getLeaseCollection(*ctx, GET_LEASE6_SUBID, bind_array, result);
+
+    return (result);
+}
+
+Lease6Collection
+PgSqlLeaseMgr::getLeases6() const {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_PGSQL_GET6);
+
+    // Provide empty binding array because our query has no parameters in
+    // WHERE clause.
+    PsqlBindArray bind_array;
+    Lease6Collection result;
+    PgSqlLeaseContextPool::Holder ctx(*pool_);
+    getLeaseCollection(*ctx, GET_LEASE6, bind_array, result);
+
+    return (result);
+}
+
+Lease6Collection
+PgSqlLeaseMgr::getLeases6(const asiolink::IOAddress& lower_bound_address,
+                          const LeasePageSize& page_size) const {
+    // Expecting IPv6 address.
+    if (!lower_bound_address.isV6()) {
+        isc_throw(InvalidParameter, "expected IPv6 address while "
+                  "retrieving leases from the lease database, got "
+                  << lower_bound_address);
+    }
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_PGSQL_GET_PAGE6)
+        .arg(page_size.page_size_)
+        .arg(lower_bound_address.toText());
+
+    // Prepare WHERE clause
+    PsqlBindArray bind_array;
+
+    // Bind lower bound address. The addresses are compared as text, so
+    // the zero address is replaced with the empty string which precedes
+    // all addresses.
+    std::string lb_address_data;
+    if (!lower_bound_address.isV6Zero()) {
+        lb_address_data = lower_bound_address.toText();
+    }
+    bind_array.add(lb_address_data);
+
+    // Bind page size value
+    std::string page_size_data = boost::lexical_cast<std::string>
+                                 (page_size.page_size_);
+    bind_array.add(page_size_data);
+
+    // Get the leases
+    Lease6Collection result;
+    PgSqlLeaseContextPool::Holder ctx(*pool_);
+    getLeaseCollection(*ctx, GET_LEASE6_PAGE, bind_array, result);
 
     return (result);
 }
@@ -1195,25 +2245,27 @@ PgSqlLeaseMgr::getExpiredLeasesCommon(LeaseCollection& expired_leases,
     bind_array.add(limit_str);
 
     // Retrieve leases from the database.
-    getLeaseCollection(statement_index, bind_array, expired_leases);
+    PgSqlLeaseContextPool::Holder ctx(*pool_);
+    getLeaseCollection(*ctx, statement_index, bind_array, expired_leases);
 }
 
 
 template<typename LeasePtr>
 void
-PgSqlLeaseMgr::updateLeaseCommon(StatementIndex stindex,
+PgSqlLeaseMgr::updateLeaseCommon(PgSqlLeaseContext& ctx,
+                                 StatementIndex stindex,
                                  PsqlBindArray& bind_array,
                                  const LeasePtr& lease) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_PGSQL_ADD_ADDR4).arg(tagged_statements[stindex].name);
 
-    PgSqlResult r(PQexecPrepared(conn_, tagged_statements[stindex].name,
+    PgSqlResult r(PQexecPrepared(ctx.conn_, tagged_statements[stindex].name,
                                  tagged_statements[stindex].nbparams,
                                  &bind_array.values_[0],
                                  &bind_array.lengths_[0],
                                  &bind_array.formats_[0], 0));
 
-    conn_.checkStatementError(r, tagged_statements[stindex]);
+    ctx.conn_.checkStatementError(r, tagged_statements[stindex]);
 
     int affected_rows = boost::lexical_cast<int>(PQcmdTuples(r));
 
@@ -1234,9 +2286,35 @@ PgSqlLeaseMgr::updateLeaseCommon(StatementIndex stindex,
                   "that had the address " << lease->addr_.toText());
 }
 
+void
+PgSqlLeaseMgr::updateLeasesCommon(PgSqlLeaseContext& ctx,
+                                  StatementIndex stindex,
+                                  PsqlBindArray& bind_array,
+                                  const size_t count) {
+    PgSqlResult r(PQexecPrepared(ctx.conn_, tagged_statements[stindex].name,
+                                 tagged_statements[stindex].nbparams,
+                                 &bind_array.values_[0],
+                                 &bind_array.lengths_[0],
+                                 &bind_array.formats_[0], 0));
+
+    ctx.conn_.checkStatementError(r, tagged_statements[stindex]);
+
+    size_t affected_rows = boost::lexical_cast<size_t>(PQcmdTuples(r));
+    if (affected_rows < count) {
+        isc_throw(NoSuchLease, "unable to update " << (count - affected_rows)
+                  << " of " << count << " leases as they do not exist");
+
+    } else if (affected_rows > count) {
+        isc_throw(DbOperationError, "apparently updated " << affected_rows
+                  << " leases instead of " << count);
+    }
+}
+
 
 void
 PgSqlLeaseMgr::updateLease4(const Lease4Ptr& lease) {
+    StageTimer timer(ProcessingLatency::STAGE_LEASE_WRITE);
+
     const StatementIndex stindex = UPDATE_LEASE4;
 
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
@@ -1244,7 +2322,8 @@ PgSqlLeaseMgr::updateLease4(const Lease4Ptr& lease) {
 
     // Create the BIND array for the data being updated
     PsqlBindArray bind_array;
-    exchange4_->createBindForSend(lease, bind_array);
+    PgSqlLeaseContextPool::Holder ctx(*pool_);
+    ctx->exchange4_->createBindForSend(lease, bind_array);
 
     // Set up the WHERE clause and append it to the SQL_BIND array
     std::string addr4_ = boost::lexical_cast<std::string>
@@ -1252,11 +2331,13 @@ PgSqlLeaseMgr::updateLease4(const Lease4Ptr& lease) {
     bind_array.add(addr4_);
 
     // Drop to common update code
-    updateLeaseCommon(stindex, bind_array, lease);
+    updateLeaseCommon(*ctx, stindex, bind_array, lease);
 }
 
 void
 PgSqlLeaseMgr::updateLease6(const Lease6Ptr& lease) {
+    StageTimer timer(ProcessingLatency::STAGE_LEASE_WRITE);
+
     const StatementIndex stindex = UPDATE_LEASE6;
 
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
@@ -1264,26 +2345,28 @@ PgSqlLeaseMgr::updateLease6(const Lease6Ptr& lease) {
 
     // Create the BIND array for the data being updated
     PsqlBindArray bind_array;
-    exchange6_->createBindForSend(lease, bind_array);
+    PgSqlLeaseContextPool::Holder ctx(*pool_);
+    ctx->exchange6_->createBindForSend(lease, bind_array);
 
     // Set up the WHERE clause and append it to the BIND array
     std::string addr_str = lease->addr_.toText();
     bind_array.add(addr_str);
 
     // Drop to common update code
-    updateLeaseCommon(stindex, bind_array, lease);
+    updateLeaseCommon(*ctx, stindex, bind_array, lease);
 }
 
 uint64_t
-PgSqlLeaseMgr::deleteLeaseCommon(StatementIndex stindex,
+PgSqlLeaseMgr::deleteLeaseCommon(PgSqlLeaseContext& ctx,
+                                 StatementIndex stindex,
                                  PsqlBindArray& bind_array) {
-    PgSqlResult r(PQexecPrepared(conn_, tagged_statements[stindex].name,
+    PgSqlResult r(PQexecPrepared(ctx.conn_, tagged_statements[stindex].name,
                                  tagged_statements[stindex].nbparams,
                                  &bind_array.values_[0],
                                  &bind_array.lengths_[0],
                                  &bind_array.formats_[0], 0));
 
-    conn_.checkStatementError(r, tagged_statements[stindex]);
+    ctx.conn_.checkStatementError(r, tagged_statements[stindex]);
     int affected_rows = boost::lexical_cast<int>(PQcmdTuples(r));
 
     return (affected_rows);
@@ -1291,22 +2374,229 @@ PgSqlLeaseMgr::deleteLeaseCommon(StatementIndex stindex,
 
 bool
 PgSqlLeaseMgr::deleteLease(const isc::asiolink::IOAddress& addr) {
+    StageTimer timer(ProcessingLatency::STAGE_LEASE_WRITE);
+
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_PGSQL_DELETE_ADDR).arg(addr.toText());
 
     // Set up the WHERE clause value
     PsqlBindArray bind_array;
+    PgSqlLeaseContextPool::Holder ctx(*pool_);
 
     if (addr.isV4()) {
         std::string addr4_str = boost::lexical_cast<std::string>
                                  (addr.toUint32());
         bind_array.add(addr4_str);
-        return (deleteLeaseCommon(DELETE_LEASE4, bind_array) > 0);
+        return (deleteLeaseCommon(*ctx, DELETE_LEASE4, bind_array) > 0);
     }
 
     std::string addr6_str = addr.toText();
     bind_array.add(addr6_str);
-    return (deleteLeaseCommon(DELETE_LEASE6, bind_array) > 0);
+    return (deleteLeaseCommon(*ctx, DELETE_LEASE6, bind_array) > 0);
+}
+
+void
+PgSqlLeaseMgr::reclaimLeases4(const Lease4Collection& updated,
+                              const Lease4Collection& removed) {
+    StageTimer timer(ProcessingLatency::STAGE_LEASE_WRITE);
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_PGSQL_RECLAIM_LEASES4)
+        .arg(updated.size())
+        .arg(removed.size());
+
+    // The PgSqlTransaction is not used because its destructor would throw
+    // if the rollback failed after the connection was lost.
+    PgSqlLeaseContextPool::Holder ctx(*pool_);
+    ctx->conn_.startTransaction();
+    try {
+        if (!updated.empty()) {
+            // Update all leases with one statement which unnests the
+            // columns of the leases passed as arrays.
+            PgSqlBatchArrays arrays(10);
+            for (Lease4Collection::const_iterator lease = updated.begin();
+                 lease != updated.end(); ++lease) {
+                PsqlBindArray lease_bind;
+                ctx->exchange4_->createBindForSend(*lease, lease_bind);
+                arrays.add(lease_bind);
+            }
+
+            PsqlBindArray bind_array;
+            arrays.createBind(bind_array);
+            updateLeasesCommon(*ctx, UPDATE_LEASE4_BATCH, bind_array,
+                               updated.size());
+        }
+
+        if (!removed.empty()) {
+            // Delete all leases with one statement.
+            PgSqlBatchArrays addresses(1);
+            for (Lease4Collection::const_iterator lease = removed.begin();
+                 lease != removed.end(); ++lease) {
+                PsqlBindArray lease_bind;
+                lease_bind.add((*lease)->addr_);
+                addresses.add(lease_bind);
+            }
+
+            PsqlBindArray bind_array;
+            addresses.createBind(bind_array);
+            deleteLeaseCommon(*ctx, DELETE_LEASE4_BATCH, bind_array);
+        }
+
+        ctx->conn_.commit();
+
+    } catch (...) {
+        try {
+            ctx->conn_.rollback();
+        } catch (...) {
+            // Report the original error.
+        }
+        throw;
+    }
+}
+
+void
+PgSqlLeaseMgr::reclaimLeases6(const Lease6Collection& updated,
+                              const Lease6Collection& removed) {
+    StageTimer timer(ProcessingLatency::STAGE_LEASE_WRITE);
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_PGSQL_RECLAIM_LEASES6)
+        .arg(updated.size())
+        .arg(removed.size());
+
+    // The PgSqlTransaction is not used because its destructor would throw
+    // if the rollback failed after the connection was lost.
+    PgSqlLeaseContextPool::Holder ctx(*pool_);
+    ctx->conn_.startTransaction();
+    try {
+        if (!updated.empty()) {
+            PgSqlBatchArrays arrays(13);
+            for (Lease6Collection::const_iterator lease = updated.begin();
+                 lease != updated.end(); ++lease) {
+                PsqlBindArray lease_bind;
+                ctx->exchange6_->createBindForSend(*lease, lease_bind);
+                arrays.add(lease_bind);
+            }
+
+            PsqlBindArray bind_array;
+            arrays.createBind(bind_array);
+            updateLeasesCommon(*ctx, UPDATE_LEASE6_BATCH, bind_array,
+                               updated.size());
+        }
+
+        if (!removed.empty()) {
+            PgSqlBatchArrays addresses(1);
+            for (Lease6Collection::const_iterator lease = removed.begin();
+                 lease != removed.end(); ++lease) {
+                PsqlBindArray lease_bind;
+                lease_bind.add((*lease)->addr_);
+                addresses.add(lease_bind);
+            }
+
+            PsqlBindArray bind_array;
+            addresses.createBind(bind_array);
+            deleteLeaseCommon(*ctx, DELETE_LEASE6_BATCH, bind_array);
+        }
+
+        ctx->conn_.commit();
+
+    } catch (...) {
+        try {
+            ctx->conn_.rollback();
+        } catch (...) {
+            // Report the original error.
+        }
+        throw;
+    }
+}
+
+void
+PgSqlLeaseMgr::applyLeases4(const Lease4Collection& leases) {
+    StageTimer timer(ProcessingLatency::STAGE_LEASE_WRITE);
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_PGSQL_APPLY_LEASES4).arg(leases.size());
+
+    // The PgSqlTransaction is not used because its destructor would throw
+    // if the rollback failed after the connection was lost.
+    PgSqlLeaseContextPool::Holder ctx(*pool_);
+    ctx->conn_.startTransaction();
+    try {
+        for (Lease4Collection::const_iterator lease = leases.begin();
+             lease != leases.end(); ++lease) {
+            // A failed insert would abort the transaction, so the lease
+            // is updated first and inserted if it doesn't exist.
+            try {
+                PsqlBindArray bind_array;
+                ctx->exchange4_->createBindForSend(*lease, bind_array);
+                std::string addr4_str = boost::lexical_cast<std::string>
+                                        ((*lease)->addr_.toUint32());
+                bind_array.add(addr4_str);
+                updateLeaseCommon(*ctx, UPDATE_LEASE4, bind_array, *lease);
+
+            } catch (const NoSuchLease&) {
+                PsqlBindArray bind_array;
+                ctx->exchange4_->createBindForSend(*lease, bind_array);
+                if (!addLeaseCommon(*ctx, INSERT_LEASE4, bind_array)) {
+                    isc_throw(DbOperationError, "unable to add lease for "
+                              "address " << (*lease)->addr_);
+                }
+            }
+        }
+
+        ctx->conn_.commit();
+
+    } catch (...) {
+        try {
+            ctx->conn_.rollback();
+        } catch (...) {
+            // Report the original error.
+        }
+        throw;
+    }
+}
+
+void
+PgSqlLeaseMgr::applyLeases6(const Lease6Collection& leases) {
+    StageTimer timer(ProcessingLatency::STAGE_LEASE_WRITE);
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_PGSQL_APPLY_LEASES6).arg(leases.size());
+
+    PgSqlLeaseContextPool::Holder ctx(*pool_);
+    ctx->conn_.startTransaction();
+    try {
+        for (Lease6Collection::const_iterator lease = leases.begin();
+             lease != leases.end(); ++lease) {
+            // A failed insert would abort the transaction, so the lease
+            // is updated first and inserted if it doesn't exist.
+            try {
+                PsqlBindArray bind_array;
+                ctx->exchange6_->createBindForSend(*lease, bind_array);
+                std::string addr_str = (*lease)->addr_.toText();
+                bind_array.add(addr_str);
+                updateLeaseCommon(*ctx, UPDATE_LEASE6, bind_array, *lease);
+
+            } catch (const NoSuchLease&) {
+                PsqlBindArray bind_array;
+                ctx->exchange6_->createBindForSend(*lease, bind_array);
+                if (!addLeaseCommon(*ctx, INSERT_LEASE6, bind_array)) {
+                    isc_throw(DbOperationError, "unable to add lease for "
+                              "address " << (*lease)->addr_);
+                }
+            }
+        }
+
+        ctx->conn_.commit();
+
+    } catch (...) {
+        try {
+            ctx->conn_.rollback();
+        } catch (...) {
+            // Report the original error.
+        }
+        throw;
+    }
 }
 
 uint64_t
@@ -1340,29 +2630,54 @@ PgSqlLeaseMgr::deleteExpiredReclaimedLeasesCommon(const uint32_t secs,
     bind_array.add(expiration_str);
 
     // Delete leases.
-    return (deleteLeaseCommon(statement_index, bind_array));
+    PgSqlLeaseContextPool::Holder ctx(*pool_);
+    return (deleteLeaseCommon(*ctx, statement_index, bind_array));
 }
 
 LeaseStatsQueryPtr
 PgSqlLeaseMgr::startLeaseStatsQuery4() {
+    PgSqlLeaseContextPool::Holder ctx(*pool_);
     LeaseStatsQueryPtr query(
-        new PgSqlLeaseStatsQuery(conn_,
+        new PgSqlLeaseStatsQuery(ctx->conn_,
                                  tagged_statements[RECOUNT_LEASE4_STATS],
                                  false));
     query->start();
     return(query);
 }
 
+LeaseStatsQueryPtr
+PgSqlLeaseMgr::startSubnetLeaseStatsQuery4(const SubnetIDSet& subnet_ids) {
+    PgSqlLeaseContextPool::Holder ctx(*pool_);
+    LeaseStatsQueryPtr query(
+        new PgSqlLeaseStatsQuery(ctx->conn_,
+                                 tagged_statements[SUBNET_LEASE4_STATS],
+                                 false, subnet_ids));
+    query->start();
+    return(query);
+}
+
 LeaseStatsQueryPtr
 PgSqlLeaseMgr::startLeaseStatsQuery6() {
+    PgSqlLeaseContextPool::Holder ctx(*pool_);
     LeaseStatsQueryPtr query(
-        new PgSqlLeaseStatsQuery(conn_,
+        new PgSqlLeaseStatsQuery(ctx->conn_,
                                  tagged_statements[RECOUNT_LEASE6_STATS],
                                  true));
     query->start();
     return(query);
 }
 
+LeaseStatsQueryPtr
+PgSqlLeaseMgr::startSubnetLeaseStatsQuery6(const SubnetIDSet& subnet_ids) {
+    PgSqlLeaseContextPool::Holder ctx(*pool_);
+    LeaseStatsQueryPtr query(
+        new PgSqlLeaseStatsQuery(ctx->conn_,
+                                 tagged_statements[SUBNET_LEASE6_STATS],
+                                 true, subnet_ids));
+    query->start();
+    return(query);
+}
+
 size_t
 PgSqlLeaseMgr::wipeLeases4(const SubnetID& /*subnet_id*/) {
     isc_throw(NotImplemented, "wipeLeases4 is not implemented for PgSQL backend");
@@ -1375,13 +2690,10 @@ PgSqlLeaseMgr::wipeLeases6(const SubnetID& /*subnet_id*/) {
 
 string
 PgSqlLeaseMgr::getName() const {
-    string name = "";
-    try {
-        name = conn_.getParameter("name");
-    } catch (...) {
-        // Return an empty name
-    }
-    return (name);
+    // Return an empty name if it is not specified.
+    DatabaseConnection::ParameterMap::const_iterator param =
+        parameters_.find("name");
+    return (param != parameters_.end() ? param->second : string(""));
 }
 
 string
@@ -1394,8 +2706,10 @@ PgSqlLeaseMgr::getVersion() const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_PGSQL_GET_VERSION);
 
-    PgSqlResult r(PQexecPrepared(conn_, "get_version", 0, NULL, NULL, NULL, 0));
-    conn_.checkStatementError(r, tagged_statements[GET_VERSION]);
+    PgSqlLeaseContextPool::Holder ctx(*pool_);
+    PgSqlResult r(PQexecPrepared(ctx->conn_, "get_version", 0, NULL, NULL, NULL,
+                                 0));
+    ctx->conn_.checkStatementError(r, tagged_statements[GET_VERSION]);
 
     istringstream tmp;
     uint32_t version;
@@ -1413,12 +2727,24 @@ PgSqlLeaseMgr::getVersion() const {
 
 void
 PgSqlLeaseMgr::commit() {
-    conn_.commit();
+    checkSingleConnection("commit");
+    PgSqlLeaseContextPool::Holder ctx(*pool_);
+    ctx->conn_.commit();
 }
 
 void
 PgSqlLeaseMgr::rollback() {
-    conn_.rollback();
+    checkSingleConnection("rollback");
+    PgSqlLeaseContextPool::Holder ctx(*pool_);
+    ctx->conn_.rollback();
+}
+
+void
+PgSqlLeaseMgr::checkSingleConnection(const char* what) const {
+    if (pool_->getMaxSize() > 1) {
+        isc_throw(InvalidOperation, what << " is not supported with a pool"
+                  " of " << pool_->getMaxSize() << " connections");
+    }
 }
 
 }; // end of isc::dhcp namespace
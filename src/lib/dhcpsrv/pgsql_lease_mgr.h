@@ -11,6 +11,7 @@
 #include <dhcpsrv/lease_mgr.h>
 #include <dhcpsrv/pgsql_connection.h>
 #include <dhcpsrv/pgsql_exchange.h>
+#include <util/threads/sync.h>
 
 #include <boost/scoped_ptr.hpp>
 #include <boost/utility.hpp>
@@ -24,6 +25,14 @@ namespace dhcp {
 // See pgsql_lease_mgr.cc file for actual class definitions
 class PgSqlLease4Exchange;
 class PgSqlLease6Exchange;
+class PgSqlLeasePipeline;
+class PgSqlLeaseContext;
+
+/// @brief Pointer to a @c PgSqlLeaseContext.
+typedef boost::shared_ptr<PgSqlLeaseContext> PgSqlLeaseContextPtr;
+
+/// @brief Pool of the connections of the PostgreSQL lease manager.
+typedef DatabaseConnectionPool<PgSqlLeaseContext> PgSqlLeaseContextPool;
 
 /// @brief PostgreSQL Lease Manager
 ///
@@ -41,12 +50,21 @@ public:
     /// - host - Host to which to connect (optional, defaults to "localhost")
     /// - user - Username under which to connect (optional)
     /// - password - Password for "user" on the database (optional)
+    /// - connection-pool-size - Maximum number of connections to the
+    ///   database, used concurrently by the threads (optional, defaults
+    ///   to 1)
+    /// - reconnect-wait-time - Time in milliseconds to wait after a failure
+    ///   to open a connection before the next attempt, doubled after each
+    ///   consecutive failure (optional, defaults to 1000)
     ///
     /// If the database is successfully opened, the version number in the
     /// schema_version table will be checked against hard-coded value in
     /// the implementation file.
     ///
-    /// Finally, all the SQL commands are pre-compiled.
+    /// Finally, all the SQL commands are pre-compiled. The other connections
+    /// of the pool are opened when needed, with their own prepared
+    /// statements. A lost connection is replaced by a new one rather than
+    /// being fatal.
     ///
     /// @param parameters A data structure relating keywords and values
     ///        concerned with the database.
@@ -177,6 +195,42 @@ public:
     virtual Lease4Ptr getLease4(const ClientId& clientid,
                                 SubnetID subnet_id) const;
 
+    /// @brief Returns all IPv4 leases for the particular subnet identifier.
+    ///
+    /// @param subnet_id subnet identifier.
+    ///
+    /// @return Lease collection (may be empty if no IPv4 lease found).
+    ///
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease4Collection getLeases4(SubnetID subnet_id) const;
+
+    /// @brief Returns all IPv4 leases.
+    ///
+    /// @return Lease collection (may be empty if no IPv4 lease found).
+    ///
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease4Collection getLeases4() const;
+
+    /// @brief Returns range of IPv4 leases using paging.
+    ///
+    /// The leases are returned in the ascending order of addresses by a
+    /// query using the primary key index.
+    ///
+    /// @param lower_bound_address IPv4 address used as lower bound for the
+    /// returned range.
+    /// @param page_size maximum size of the page returned.
+    ///
+    /// @return Lease collection (may be empty if no IPv4 lease found).
+    ///
+    /// @throw InvalidParameter if the lower bound is not an IPv4 address.
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease4Collection
+    getLeases4(const asiolink::IOAddress& lower_bound_address,
+               const LeasePageSize& page_size) const;
+
     /// @brief Returns existing IPv6 lease for a given IPv6 address.
     ///
     /// For a given address, we assume that there will be only one lease.
@@ -231,6 +285,43 @@ public:
     virtual Lease6Collection getLeases6(Lease::Type type, const DUID& duid,
                                         uint32_t iaid, SubnetID subnet_id) const;
 
+    /// @brief Returns all IPv6 leases for the particular subnet identifier.
+    ///
+    /// @param subnet_id subnet identifier.
+    ///
+    /// @return Lease collection (may be empty if no IPv6 lease found).
+    ///
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease6Collection getLeases6(SubnetID subnet_id) const;
+
+    /// @brief Returns all IPv6 leases.
+    ///
+    /// @return Lease collection (may be empty if no IPv6 lease found).
+    ///
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease6Collection getLeases6() const;
+
+    /// @brief Returns range of IPv6 leases using paging.
+    ///
+    /// The addresses are held in a text column, so the leases are returned
+    /// in the text order of addresses by a query using the primary key
+    /// index. The IPv6 zero address denotes the first page.
+    ///
+    /// @param lower_bound_address IPv6 address used as lower bound for the
+    /// returned range.
+    /// @param page_size maximum size of the page returned.
+    ///
+    /// @return Lease collection (may be empty if no IPv6 lease found).
+    ///
+    /// @throw InvalidParameter if the lower bound is not an IPv6 address.
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease6Collection
+    getLeases6(const asiolink::IOAddress& lower_bound_address,
+               const LeasePageSize& page_size) const;
+
     /// @brief Returns a collection of expired DHCPv6 leases.
     ///
     /// This method returns at most @c max_leases expired leases. The leases
@@ -295,6 +386,55 @@ public:
     ///        failed.
     virtual bool deleteLease(const isc::asiolink::IOAddress& addr);
 
+    /// @brief Reclaims a batch of expired IPv4 leases.
+    ///
+    /// The batch is applied in a single transaction. The updated leases
+    /// are written with a single statement which unnests the arrays of
+    /// their columns and the removed leases are deleted with a single
+    /// statement taking the array of their addresses.
+    ///
+    /// @param updated Leases to be updated.
+    /// @param removed Leases to be deleted.
+    ///
+    /// @throw isc::dhcp::NoSuchLease One of the updated leases does not
+    ///        exist. No part of the batch is applied in this case.
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual void reclaimLeases4(const Lease4Collection& updated,
+                                const Lease4Collection& removed);
+
+    /// @brief Reclaims a batch of expired IPv6 leases.
+    ///
+    /// @param updated Leases to be updated.
+    /// @param removed Leases to be deleted.
+    ///
+    /// @throw isc::dhcp::NoSuchLease One of the updated leases does not
+    ///        exist. No part of the batch is applied in this case.
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual void reclaimLeases6(const Lease6Collection& updated,
+                                const Lease6Collection& removed);
+
+    /// @brief Adds or updates a batch of IPv4 leases.
+    ///
+    /// The batch is applied in a single transaction. Each lease is updated
+    /// and inserted if the update didn't find it. The update is attempted
+    /// first because a failed insert would abort the transaction.
+    ///
+    /// @param leases Leases to be applied.
+    ///
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed. No part of the batch is applied in this case.
+    virtual void applyLeases4(const Lease4Collection& leases);
+
+    /// @brief Adds or updates a batch of IPv6 leases.
+    ///
+    /// @param leases Leases to be applied.
+    ///
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed. No part of the batch is applied in this case.
+    virtual void applyLeases6(const Lease6Collection& leases);
+
     /// @brief Deletes all expired-reclaimed DHCPv4 leases.
     ///
     /// @param secs Number of seconds since expiration of leases before
@@ -313,6 +453,81 @@ public:
     /// @return Number of leases deleted.
     virtual uint64_t deleteExpiredReclaimedLeases6(const uint32_t secs);
 
+#ifdef LIBPQ_HAS_PIPELINING
+    /// @name Asynchronous lease operations.
+    ///
+    /// The operations are sent over a dedicated connection to the
+    /// database in pipeline mode: the queries are sent without waiting
+    /// for the results of the previous ones, which are read by a thread
+    /// invoking the callbacks in the order of the operations. The
+    /// connection and the thread are created upon the first operation.
+    /// Each operation is followed by a synchronization point, so a failed
+    /// operation doesn't abort the subsequent ones.
+    ///
+    /// The callbacks must not call @ref asyncWait. A failure to open the
+    /// connection is reported to the callback of the operation.
+    ///
+    /// These operations require libpq 14 or later. The synchronous
+    /// implementations of @ref LeaseMgr are used with an older libpq.
+    //@{
+
+    /// @brief Adds an IPv4 lease asynchronously.
+    ///
+    /// @param lease lease to be added
+    /// @param callback callback invoked with the result
+    virtual void asyncAddLease(const Lease4Ptr& lease,
+                               const AsyncLeaseCallback& callback);
+
+    /// @brief Adds an IPv6 lease asynchronously.
+    ///
+    /// @param lease lease to be added
+    /// @param callback callback invoked with the result
+    virtual void asyncAddLease(const Lease6Ptr& lease,
+                               const AsyncLeaseCallback& callback);
+
+    /// @brief Returns an IPv4 lease for specified IPv4 address asynchronously.
+    ///
+    /// @param addr address of the searched lease
+    /// @param callback callback invoked with the result
+    virtual void asyncGetLease4(const isc::asiolink::IOAddress& addr,
+                                const AsyncLeaseCallback& callback);
+
+    /// @brief Returns an IPv6 lease for a given address asynchronously.
+    ///
+    /// @param type specifies lease type: (NA, TA or PD)
+    /// @param addr address of the searched lease
+    /// @param callback callback invoked with the result
+    virtual void asyncGetLease6(Lease::Type type,
+                                const isc::asiolink::IOAddress& addr,
+                                const AsyncLeaseCallback& callback);
+
+    /// @brief Updates an IPv4 lease asynchronously.
+    ///
+    /// @param lease lease to be updated
+    /// @param callback callback invoked with the result
+    virtual void asyncUpdateLease4(const Lease4Ptr& lease,
+                                   const AsyncLeaseCallback& callback);
+
+    /// @brief Updates an IPv6 lease asynchronously.
+    ///
+    /// @param lease lease to be updated
+    /// @param callback callback invoked with the result
+    virtual void asyncUpdateLease6(const Lease6Ptr& lease,
+                                   const AsyncLeaseCallback& callback);
+
+    /// @brief Deletes a lease asynchronously.
+    ///
+    /// @param addr address of the lease to be deleted
+    /// @param callback callback invoked with the result
+    virtual void asyncDeleteLease(const isc::asiolink::IOAddress& addr,
+                                  const AsyncLeaseCallback& callback);
+
+    /// @brief Waits for the completion of the asynchronous operations.
+    virtual void asyncWait();
+
+    //@}
+#endif
+
     /// @brief Creates and runs the IPv4 lease stats query
     ///
     /// It creates an instance of a PgSqlLeaseStatsQuery4 and then
@@ -323,6 +538,18 @@ public:
     /// @return The populated query as a pointer to an LeaseStatsQuery
     virtual LeaseStatsQueryPtr startLeaseStatsQuery4();
 
+    /// @brief Creates and runs the IPv4 lease stats query for selected
+    /// subnets
+    ///
+    /// It executes the SUBNET_LEASE4_STATS query, which examines the
+    /// leases of the selected subnets only.
+    ///
+    /// @param subnet_ids Identifiers of the subnets to be examined.
+    ///
+    /// @return The populated query as a pointer to an LeaseStatsQuery
+    virtual LeaseStatsQueryPtr
+    startSubnetLeaseStatsQuery4(const SubnetIDSet& subnet_ids);
+
     /// @brief Creates and runs the IPv6 lease stats query
     ///
     /// It creates an instance of a PgSqlLeaseStatsQuery and then
@@ -333,6 +560,18 @@ public:
     /// @return The populated query as a pointer to an LeaseStatsQuery
     virtual LeaseStatsQueryPtr startLeaseStatsQuery6();
 
+    /// @brief Creates and runs the IPv6 lease stats query for selected
+    /// subnets
+    ///
+    /// It executes the SUBNET_LEASE6_STATS query, which examines the
+    /// leases of the selected subnets only.
+    ///
+    /// @param subnet_ids Identifiers of the subnets to be examined.
+    ///
+    /// @return The populated query as a pointer to an LeaseStatsQuery
+    virtual LeaseStatsQueryPtr
+    startSubnetLeaseStatsQuery6(const SubnetIDSet& subnet_ids);
+
     /// @brief Removes specified IPv4 leases.
     ///
     /// This rather dangerous method is able to remove all leases from specified
@@ -376,6 +615,13 @@ public:
     /// @return Description of the backend.
     virtual std::string getDescription() const;
 
+    /// @brief Indicates if the backend can be used concurrently.
+    ///
+    /// @return true as each thread uses a connection of the pool.
+    virtual bool isThreadSafe() const {
+        return (true);
+    }
+
     /// @brief Returns backend version.
     ///
     /// @return Version number as a pair of unsigned integers.  "first" is the
@@ -389,14 +635,26 @@ public:
     ///
     /// Commits all pending database operations.
     ///
+    /// The lease operations are committed on the connection which
+    /// executed them, so this method is only supported when the
+    /// connection pool holds a single connection: with more connections
+    /// it wouldn't know which connection to commit.
+    ///
     /// @throw DbOperationError If the commit failed.
+    /// @throw InvalidOperation If the connection pool can hold more than
+    /// one connection.
     virtual void commit();
 
     /// @brief Rollback Transactions
     ///
     /// Rolls back all pending database operations.
     ///
+    /// This method is only supported when the connection pool holds a
+    /// single connection, see @ref commit.
+    ///
     /// @throw DbOperationError If the rollback failed.
+    /// @throw InvalidOperation If the connection pool can hold more than
+    /// one connection.
     virtual void rollback();
 
     /// @brief Statement Tags
@@ -405,37 +663,58 @@ public:
     /// statements
     enum StatementIndex {
         DELETE_LEASE4,              // Delete from lease4 by address
+        DELETE_LEASE4_BATCH,        // Delete from lease4 by addresses array
         DELETE_LEASE4_STATE_EXPIRED,// Delete expired lease4s in certain state.
         DELETE_LEASE6,              // Delete from lease6 by address
+        DELETE_LEASE6_BATCH,        // Delete from lease6 by addresses array
         DELETE_LEASE6_STATE_EXPIRED,// Delete expired lease6s in certain state.
+        GET_LEASE4,                 // Get all lease4
         GET_LEASE4_ADDR,            // Get lease4 by address
         GET_LEASE4_CLIENTID,        // Get lease4 by client ID
         GET_LEASE4_CLIENTID_SUBID,  // Get lease4 by client ID & subnet ID
         GET_LEASE4_HWADDR,          // Get lease4 by HW address
         GET_LEASE4_HWADDR_SUBID,    // Get lease4 by HW address & subnet ID
         GET_LEASE4_EXPIRE,          // Get expired lease4
+        GET_LEASE4_PAGE,            // Get page of lease4
+        GET_LEASE4_SUBID,           // Get lease4 by subnet ID
+        GET_LEASE6,                 // Get all lease6
         GET_LEASE6_ADDR,            // Get lease6 by address
         GET_LEASE6_DUID_IAID,       // Get lease6 by DUID and IAID
         GET_LEASE6_DUID_IAID_SUBID, // Get lease6 by DUID, IAID and subnet ID
         GET_LEASE6_EXPIRE,          // Get expired lease6
+        GET_LEASE6_PAGE,            // Get page of lease6
+        GET_LEASE6_SUBID,           // Get lease6 by subnet ID
         GET_VERSION,                // Obtain version number
         INSERT_LEASE4,              // Add entry to lease4 table
         INSERT_LEASE6,              // Add entry to lease6 table
         UPDATE_LEASE4,              // Update a Lease4 entry
+        UPDATE_LEASE4_BATCH,        // Update lease4 entries from arrays
         UPDATE_LEASE6,              // Update a Lease6 entry
+        UPDATE_LEASE6_BATCH,        // Update lease6 entries from arrays
         RECOUNT_LEASE4_STATS,       // Fetch IPv4 lease statistical data
         RECOUNT_LEASE6_STATS,       // Fetch IPv4 lease statistical data
+        SUBNET_LEASE4_STATS,        // Fetch IPv4 lease stats for subnets
+        SUBNET_LEASE6_STATS,        // Fetch IPv6 lease stats for subnets
         NUM_STATEMENTS              // Number of statements
     };
 
 private:
 
+    /// @brief Checks that the connection pool holds a single connection.
+    ///
+    /// @param what name of the operation requiring a single connection
+    ///
+    /// @throw InvalidOperation If the connection pool can hold more than
+    /// one connection.
+    void checkSingleConnection(const char* what) const;
+
     /// @brief Add Lease Common Code
     ///
     /// This method performs the common actions for both flavours (V4 and V6)
     /// of the addLease method.  It binds the contents of the lease object to
     /// the prepared statement and adds it to the database.
     ///
+    /// @param ctx Context of the connection executing the statement
     /// @param stindex Index of statement being executed
     /// @param bind_array array that has been created for the type
     ///        of lease in question.
@@ -445,13 +724,15 @@ private:
     ///
     /// @throw isc::dhcp::DbOperationError An operation on the open database has
     ///        failed.
-    bool addLeaseCommon(StatementIndex stindex, PsqlBindArray& bind_array);
+    bool addLeaseCommon(PgSqlLeaseContext& ctx, StatementIndex stindex,
+                        PsqlBindArray& bind_array);
 
     /// @brief Get Lease Collection Common Code
     ///
     /// This method performs the common actions for obtaining multiple leases
     /// from the database.
     ///
+    /// @param ctx Context of the connection executing the statement
     /// @param stindex Index of statement being executed
     /// @param bind_array array containing the where clause input parameters
     /// @param exchange Exchange object to use
@@ -468,8 +749,9 @@ private:
     /// @throw isc::dhcp::MultipleRecords Multiple records were retrieved
     ///        from the database where only one was expected.
     template <typename Exchange, typename LeaseCollection>
-    void getLeaseCollection(StatementIndex stindex, PsqlBindArray& bind_array,
-                            Exchange& exchange, LeaseCollection& result,
+    void getLeaseCollection(PgSqlLeaseContext& ctx, StatementIndex stindex,
+                            PsqlBindArray& bind_array, Exchange& exchange,
+                            LeaseCollection& result,
                             bool single = false) const;
 
     /// @brief Gets Lease4 Collection
@@ -477,6 +759,7 @@ private:
     /// Gets a collection of Lease4 objects.  This is just an interface to
     /// the get lease collection common code.
     ///
+    /// @param ctx Context of the connection executing the statement
     /// @param stindex Index of statement being executed
     /// @param bind_array array containing the where clause input parameters
     /// @param lease LeaseCollection object returned.  Note that any leases in
@@ -488,16 +771,16 @@ private:
     ///        failed.
     /// @throw isc::dhcp::MultipleRecords Multiple records were retrieved
     ///        from the database where only one was expected.
-    void getLeaseCollection(StatementIndex stindex, PsqlBindArray& bind_array,
-                            Lease4Collection& result) const {
-        getLeaseCollection(stindex, bind_array, exchange4_, result);
-    }
+    void getLeaseCollection(PgSqlLeaseContext& ctx, StatementIndex stindex,
+                            PsqlBindArray& bind_array,
+                            Lease4Collection& result) const;
 
     /// @brief Get Lease6 Collection
     ///
     /// Gets a collection of Lease6 objects.  This is just an interface to
     /// the get lease collection common code.
     ///
+    /// @param ctx Context of the connection executing the statement
     /// @param stindex Index of statement being executed
     /// @param bind_array array containing input parameters for the query
     /// @param lease LeaseCollection object returned.  Note that any existing
@@ -508,10 +791,9 @@ private:
     ///        failed.
     /// @throw isc::dhcp::MultipleRecords Multiple records were retrieved
     ///        from the database where only one was expected.
-    void getLeaseCollection(StatementIndex stindex, PsqlBindArray& bind_array,
-                            Lease6Collection& result) const {
-        getLeaseCollection(stindex, bind_array, exchange6_, result);
-    }
+    void getLeaseCollection(PgSqlLeaseContext& ctx, StatementIndex stindex,
+                            PsqlBindArray& bind_array,
+                            Lease6Collection& result) const;
 
     /// @brief Get Lease4 Common Code
     ///
@@ -519,11 +801,12 @@ private:
     /// methods.  It acts as an interface to the getLeaseCollection() method,
     /// but retrieving only a single lease.
     ///
+    /// @param ctx Context of the connection executing the statement
     /// @param stindex Index of statement being executed
     /// @param bind_array array containing input parameters for the query
     /// @param lease Lease4 object returned
-    void getLease(StatementIndex stindex, PsqlBindArray& bind_array,
-                  Lease4Ptr& result) const;
+    void getLease(PgSqlLeaseContext& ctx, StatementIndex stindex,
+                  PsqlBindArray& bind_array, Lease4Ptr& result) const;
 
     /// @brief Get Lease6 Common Code
     ///
@@ -531,11 +814,12 @@ private:
     /// methods.  It acts as an interface to the getLeaseCollection() method,
     /// but retrieving only a single lease.
     ///
+    /// @param ctx Context of the connection executing the statement
     /// @param stindex Index of statement being executed
     /// @param bind_array array containing input parameters for the query
     /// @param lease Lease6 object returned
-    void getLease(StatementIndex stindex, PsqlBindArray& bind_array,
-                  Lease6Ptr& result) const;
+    void getLease(PgSqlLeaseContext& ctx, StatementIndex stindex,
+                  PsqlBindArray& bind_array, Lease6Ptr& result) const;
 
     /// @brief Get expired leases common code.
     ///
@@ -562,6 +846,7 @@ private:
     /// to the prepared statement, executes it, then checks how many rows
     /// were affected.
     ///
+    /// @param ctx Context of the connection executing the statement
     /// @param stindex Index of prepared statement to be executed
     /// @param bind_array array containing lease values and where clause
     /// parameters for the update.
@@ -572,8 +857,24 @@ private:
     /// @throw isc::dhcp::DbOperationError An operation on the open database has
     ///        failed.
     template <typename LeasePtr>
-    void updateLeaseCommon(StatementIndex stindex, PsqlBindArray& bind_array,
-                           const LeasePtr& lease);
+    void updateLeaseCommon(PgSqlLeaseContext& ctx, StatementIndex stindex,
+                           PsqlBindArray& bind_array, const LeasePtr& lease);
+
+    /// @brief Update leases common code
+    ///
+    /// Executes a statement updating a batch of leases and checks that
+    /// it updated each lease of the batch.
+    ///
+    /// @param ctx Context of the connection executing the statement
+    /// @param stindex Index of prepared statement to be executed
+    /// @param bind_array array containing the values of the leases.
+    /// @param count Number of leases in the batch.
+    ///
+    /// @throw NoSuchLease Some of the leases did not exist.
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    void updateLeasesCommon(PgSqlLeaseContext& ctx, StatementIndex stindex,
+                            PsqlBindArray& bind_array, const size_t count);
 
     /// @brief Delete lease common code
     ///
@@ -581,6 +882,7 @@ private:
     /// to the prepared statement, executes the statement and checks to
     /// see how many rows were deleted.
     ///
+    /// @param ctx Context of the connection executing the statement
     /// @param stindex Index of prepared statement to be executed
     /// @param bind_array array containing lease values and where clause
     /// parameters for the delete
@@ -589,7 +891,7 @@ private:
     ///
     /// @throw isc::dhcp::DbOperationError An operation on the open database has
     ///        failed.
-    uint64_t deleteLeaseCommon(StatementIndex stindex,
+    uint64_t deleteLeaseCommon(PgSqlLeaseContext& ctx, StatementIndex stindex,
                                PsqlBindArray& bind_array);
 
     /// @brief Delete expired-reclaimed leases.
@@ -604,15 +906,34 @@ private:
     uint64_t deleteExpiredReclaimedLeasesCommon(const uint32_t secs,
                                                 StatementIndex statement_index);
 
-    /// The exchange objects are used for transfer of data to/from the database.
-    /// They are pointed-to objects as the contents may change in "const" calls,
-    /// while the rest of this object does not.  (At alternative would be to
-    /// declare them as "mutable".)
-    boost::scoped_ptr<PgSqlLease4Exchange> exchange4_; ///< Exchange object
-    boost::scoped_ptr<PgSqlLease6Exchange> exchange6_; ///< Exchange object
+    /// @brief Opens a connection to the database.
+    ///
+    /// @return context of the connection, with the prepared statements
+    /// and exchange objects.
+    PgSqlLeaseContextPtr createContext() const;
+
+    /// @brief Database access parameters.
+    DatabaseConnection::ParameterMap parameters_;
+
+    /// @brief Pool of connections to the database.
+    ///
+    /// Each context holds a connection with the exchange objects used for
+    /// transfer of data to/from the database through it, so the threads
+    /// acquiring different contexts execute statements concurrently.
+    boost::scoped_ptr<PgSqlLeaseContextPool> pool_;
+
+#ifdef LIBPQ_HAS_PIPELINING
+    /// @brief Returns the pipeline of the asynchronous operations.
+    ///
+    /// The pipeline is created upon the first call.
+    PgSqlLeasePipeline& getPipeline();
+#endif
+
+    /// @brief Pipeline of the asynchronous operations.
+    boost::scoped_ptr<PgSqlLeasePipeline> pipeline_;
 
-    /// PostgreSQL connection handle
-    PgSqlConnection conn_;
+    /// @brief Mutex protecting the creation of the pipeline.
+    isc::util::thread::Mutex pipeline_mutex_;
 };
 
 }; // end of isc::dhcp namespace
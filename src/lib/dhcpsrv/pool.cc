@@ -25,6 +25,40 @@ bool Pool::inRange(const isc::asiolink::IOAddress& addr) const {
     return (first_.smallerEqual(addr) && addr.smallerEqual(last_));
 }
 
+uint64_t
+Pool::getLeaseIndex(const isc::asiolink::IOAddress& addr) const {
+    if (!inRange(addr)) {
+        isc_throw(BadValue, addr << " does not belong to the pool " << toText());
+    }
+    return (addressOffset(first_, addr));
+}
+
+IOAddress
+Pool::getLeaseAddress(const uint64_t index) const {
+    return (offsetAddress(first_, index));
+}
+
+void
+Pool::markLeaseUsed(const isc::asiolink::IOAddress& addr) const {
+    if (lease_bitmap_ && inRange(addr)) {
+        lease_bitmap_->setUsed(getLeaseIndex(addr));
+    }
+}
+
+void
+Pool::markLeaseFree(const isc::asiolink::IOAddress& addr) const {
+    if (lease_bitmap_ && inRange(addr)) {
+        lease_bitmap_->setFree(getLeaseIndex(addr));
+    }
+}
+
+void
+Pool::initLeaseBitmap() {
+    if ((capacity_ > 0) && (capacity_ <= LeaseBitmap::MAX_CAPACITY)) {
+        lease_bitmap_.reset(new LeaseBitmap(capacity_));
+    }
+}
+
 std::string
 Pool::toText() const {
     std::stringstream tmp;
@@ -50,6 +84,7 @@ Pool4::Pool4(const isc::asiolink::IOAddress& first,
     // possible IPv4 addresses, we'll be able to accurately store that
     // info.
     capacity_ = addrsInRange(first, last);
+    initLeaseBitmap();
 }
 
 Pool4::Pool4( const isc::asiolink::IOAddress& prefix, uint8_t prefix_len)
@@ -73,6 +108,7 @@ Pool4::Pool4( const isc::asiolink::IOAddress& prefix, uint8_t prefix_len)
     // possible IPv4 addresses, we'll be able to accurately store that
     // info.
     capacity_ = addrsInRange(prefix, last_);
+    initLeaseBitmap();
 }
 
 data::ElementPtr
@@ -155,6 +191,20 @@ Pool6::Pool6(Lease::Type type, const isc::asiolink::IOAddress& first,
     // If the pool is extremely large (i.e. contains more than 2^64 addresses,
     // we'll just cap it at max value of uint64_t).
     capacity_ = addrsInRange(first, last);
+    initLeaseBitmap();
+}
+
+uint64_t
+Pool6::getLeaseIndex(const isc::asiolink::IOAddress& addr) const {
+    if (!inRange(addr)) {
+        isc_throw(BadValue, addr << " does not belong to the pool " << toText());
+    }
+    return (addressOffset(first_, addr, prefix_len_));
+}
+
+IOAddress
+Pool6::getLeaseAddress(const uint64_t index) const {
+    return (offsetAddress(first_, index, prefix_len_));
 }
 
 Pool6::Pool6(Lease::Type type, const isc::asiolink::IOAddress& prefix,
@@ -266,6 +316,7 @@ Pool6::init(const Lease::Type& type,
     // For addresses, we could use addrsInRange(prefix, last_), but it's
     // much faster to do calculations on prefix lengths.
     capacity_ = prefixesInRange(prefix_len, delegated_len);
+    initLeaseBitmap();
 
     // If user specified an excluded prefix, create an option that will
     // be sent to clients obtaining prefixes from this pool.
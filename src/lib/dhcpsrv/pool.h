@@ -13,6 +13,7 @@
 #include <cc/data.h>
 #include <dhcpsrv/cfg_option.h>
 #include <dhcpsrv/lease.h>
+#include <dhcpsrv/lease_bitmap.h>
 #include <boost/shared_ptr.hpp>
 
 #include <vector>
@@ -84,6 +85,43 @@ public:
         return (capacity_);
     }
 
+    /// @brief Returns the bitmap of used addresses or prefixes.
+    ///
+    /// @return Pointer to the bitmap or null if the pool is too large to
+    /// be tracked with a bitmap.
+    const LeaseBitmapPtr& getLeaseBitmap() const {
+        return (lease_bitmap_);
+    }
+
+    /// @brief Returns the position of the address or prefix in the pool.
+    ///
+    /// @param addr Address or prefix belonging to the pool.
+    /// @return Position of the address or prefix, 0 for the first address.
+    /// @throw BadValue if the address is out of the pool.
+    virtual uint64_t getLeaseIndex(const isc::asiolink::IOAddress& addr) const;
+
+    /// @brief Returns the address or prefix at the specified position.
+    ///
+    /// @param index Position of the address or prefix in the pool.
+    /// @return Address or prefix.
+    virtual isc::asiolink::IOAddress getLeaseAddress(const uint64_t index) const;
+
+    /// @brief Marks the address or prefix as used in the lease bitmap.
+    ///
+    /// This is no-op if the pool has no lease bitmap or the address
+    /// doesn't belong to the pool.
+    ///
+    /// @param addr Address or prefix.
+    void markLeaseUsed(const isc::asiolink::IOAddress& addr) const;
+
+    /// @brief Marks the address or prefix as free in the lease bitmap.
+    ///
+    /// This is no-op if the pool has no lease bitmap or the address
+    /// doesn't belong to the pool.
+    ///
+    /// @param addr Address or prefix.
+    void markLeaseFree(const isc::asiolink::IOAddress& addr) const;
+
     /// @brief Returns pointer to the option data configuration for this pool.
     CfgOptionPtr getCfgOption() {
         return (cfg_option_);
@@ -126,6 +164,12 @@ protected:
          const isc::asiolink::IOAddress& first,
          const isc::asiolink::IOAddress& last);
 
+    /// @brief Creates the lease bitmap if the pool is small enough.
+    ///
+    /// This should be called by the derived class constructors once
+    /// the pool capacity is known.
+    void initLeaseBitmap();
+
     /// @brief returns the next unique Pool-ID
     ///
     /// @return the next unique Pool-ID
@@ -166,6 +210,9 @@ protected:
 
     /// @brief Pointer to the user context (may be NULL)
     data::ConstElementPtr user_context_;
+
+    /// @brief Bitmap of used addresses or prefixes (may be NULL)
+    LeaseBitmapPtr lease_bitmap_;
 };
 
 /// @brief Pool information for IPv4 addresses
@@ -285,6 +332,22 @@ public:
         return (pd_exclude_option_);
     }
 
+    /// @brief Returns the position of the address or prefix in the pool.
+    ///
+    /// For prefix pools the position is the number of delegated prefixes
+    /// preceding the prefix.
+    ///
+    /// @param addr Address or prefix belonging to the pool.
+    /// @return Position of the address or prefix, 0 for the first one.
+    /// @throw BadValue if the address is out of the pool.
+    virtual uint64_t getLeaseIndex(const isc::asiolink::IOAddress& addr) const;
+
+    /// @brief Returns the address or prefix at the specified position.
+    ///
+    /// @param index Position of the address or prefix in the pool.
+    /// @return Address or prefix.
+    virtual isc::asiolink::IOAddress getLeaseAddress(const uint64_t index) const;
+
     /// @brief Unparse a Pool6 object.
     ///
     /// @return A pointer to unparsed Pool6 configuration.
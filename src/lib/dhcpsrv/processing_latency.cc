@@ -0,0 +1,229 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <dhcpsrv/processing_latency.h>
+#include <stats/stats_mgr.h>
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+using namespace isc::data;
+using namespace isc::stats;
+using namespace boost::posix_time;
+
+namespace {
+
+/// @brief Measurement in progress in the current thread.
+thread_local isc::dhcp::LatencyMeasurement* current_measurement = 0;
+
+/// @brief Returns the number of microseconds of a duration.
+///
+/// @param duration the duration
+/// @return microseconds, 0 if the duration is negative
+uint64_t
+toMicroseconds(const time_duration& duration) {
+    const int64_t usecs = duration.total_microseconds();
+    return (usecs > 0 ? static_cast<uint64_t>(usecs) : 0);
+}
+
+}
+
+namespace isc {
+namespace dhcp {
+
+std::string
+ProcessingLatency::stageToText(const Stage stage) {
+    switch (stage) {
+    case STAGE_RECEIVE:
+        return ("receive");
+    case STAGE_UNPACK:
+        return ("unpack");
+    case STAGE_CLASSIFICATION:
+        return ("classification");
+    case STAGE_SUBNET_SELECTION:
+        return ("subnet-selection");
+    case STAGE_HOST_LOOKUP:
+        return ("host-lookup");
+    case STAGE_ALLOCATION:
+        return ("allocation");
+    case STAGE_LEASE_WRITE:
+        return ("lease-write");
+    case STAGE_PACK:
+        return ("pack");
+    case STAGE_SEND:
+        return ("send");
+    case STAGE_OTHER:
+        return ("other");
+    case STAGE_TOTAL:
+        return ("total");
+    default:
+        ;
+    }
+    return ("unknown");
+}
+
+ProcessingLatency::ProcessingLatency(const std::string& prefix)
+    : prefix_(prefix), message_types_(), last_update_(0) {
+    MessageTypePtr unknown(new MessageType());
+    unknown->name_ = "unknown";
+    message_types_.push_back(unknown);
+    for (size_t i = 0; i < sizeof(by_type_) / sizeof(by_type_[0]); ++i) {
+        by_type_[i] = unknown.get();
+    }
+}
+
+void
+ProcessingLatency::addMessageType(const uint8_t type,
+                                  const std::string& name) {
+    MessageTypePtr message_type(new MessageType());
+    message_type->name_ = name;
+    message_types_.push_back(message_type);
+    by_type_[type] = message_type.get();
+}
+
+void
+ProcessingLatency::record(const uint8_t type,
+                          const uint64_t (&durations)[NUM_STAGES],
+                          const bool (&entered)[NUM_STAGES]) {
+    MessageType& message_type = *by_type_[type];
+    for (int stage = 0; stage < NUM_STAGES; ++stage) {
+        if (entered[stage]) {
+            message_type.histograms_[stage].record(durations[stage]);
+        }
+    }
+}
+
+const LatencyHistogram&
+ProcessingLatency::getHistogram(const uint8_t type, const Stage stage) const {
+    if ((stage < 0) || (stage >= NUM_STAGES)) {
+        isc_throw(BadValue, "invalid packet processing stage " << stage);
+    }
+    return (by_type_[type]->histograms_[stage]);
+}
+
+ElementPtr
+ProcessingLatency::toElement() const {
+    ElementPtr map = Element::createMap();
+    for (std::vector<MessageTypePtr>::const_iterator it =
+             message_types_.begin(); it != message_types_.end(); ++it) {
+        ElementPtr stages = Element::createMap();
+        for (int stage = 0; stage < NUM_STAGES; ++stage) {
+            const LatencyHistogram& histogram = (*it)->histograms_[stage];
+            if (histogram.getCount() > 0) {
+                stages->set(stageToText(static_cast<Stage>(stage)),
+                            histogram.toElement());
+            }
+        }
+        if (!stages->mapValue().empty()) {
+            map->set((*it)->name_, stages);
+        }
+    }
+    return (map);
+}
+
+void
+ProcessingLatency::updateStatistics() const {
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    for (std::vector<MessageTypePtr>::const_iterator it =
+             message_types_.begin(); it != message_types_.end(); ++it) {
+        for (int stage = 0; stage < NUM_STAGES; ++stage) {
+            const LatencyHistogram& histogram = (*it)->histograms_[stage];
+            if (histogram.getCount() == 0) {
+                continue;
+            }
+            const std::string name = prefix_ + "-" + (*it)->name_ +
+                "-latency-" + stageToText(static_cast<Stage>(stage));
+            stats_mgr.setValue(name + "-p50", static_cast<int64_t>
+                               (histogram.getPercentile(50.0)));
+            stats_mgr.setValue(name + "-p99", static_cast<int64_t>
+                               (histogram.getPercentile(99.0)));
+            stats_mgr.setValue(name + "-max", static_cast<int64_t>
+                               (histogram.getMax()));
+        }
+    }
+}
+
+void
+ProcessingLatency::updateStatisticsPeriodically(const ptime& now) {
+    const int64_t usecs = (now - ptime(boost::gregorian::date(1970, 1, 1)))
+        .total_microseconds();
+    int64_t last = last_update_.load(std::memory_order_relaxed);
+    if ((usecs - last < 1000000) && (usecs >= last)) {
+        return;
+    }
+    // Only one thread publishes the statistics.
+    if (last_update_.compare_exchange_strong(last, usecs,
+                                             std::memory_order_relaxed)) {
+        updateStatistics();
+    }
+}
+
+void
+ProcessingLatency::reset() {
+    for (std::vector<MessageTypePtr>::const_iterator it =
+             message_types_.begin(); it != message_types_.end(); ++it) {
+        for (int stage = 0; stage < NUM_STAGES; ++stage) {
+            (*it)->histograms_[stage].reset();
+        }
+    }
+}
+
+LatencyMeasurement::LatencyMeasurement(ProcessingLatency& latency,
+                                       const PktPtr& query)
+    : latency_(latency), query_(query), start_(),
+      stage_(ProcessingLatency::STAGE_OTHER), stage_start_(),
+      previous_(current_measurement) {
+    for (int stage = 0; stage < ProcessingLatency::NUM_STAGES; ++stage) {
+        durations_[stage] = 0;
+        entered_[stage] = false;
+    }
+
+    stage_start_ = microsec_clock::universal_time();
+    start_ = stage_start_;
+    if (query_ && !query_->getTimestamp().is_special() &&
+        (query_->getTimestamp() <= stage_start_)) {
+        start_ = query_->getTimestamp();
+        durations_[ProcessingLatency::STAGE_RECEIVE] =
+            toMicroseconds(stage_start_ - start_);
+        entered_[ProcessingLatency::STAGE_RECEIVE] = true;
+    }
+    entered_[ProcessingLatency::STAGE_OTHER] = true;
+    current_measurement = this;
+}
+
+LatencyMeasurement::~LatencyMeasurement() {
+    current_measurement = previous_;
+
+    const ptime now = microsec_clock::universal_time();
+    durations_[stage_] += toMicroseconds(now - stage_start_);
+    durations_[ProcessingLatency::STAGE_TOTAL] = toMicroseconds(now - start_);
+    entered_[ProcessingLatency::STAGE_TOTAL] = true;
+
+    try {
+        latency_.record(query_ ? query_->getType() : 0, durations_, entered_);
+        latency_.updateStatisticsPeriodically(now);
+    } catch (...) {
+        // Measuring the latency must not disrupt the processing.
+    }
+}
+
+ProcessingLatency::Stage
+LatencyMeasurement::enter(const ProcessingLatency::Stage stage) {
+    const ptime now = microsec_clock::universal_time();
+    durations_[stage_] += toMicroseconds(now - stage_start_);
+    const ProcessingLatency::Stage previous = stage_;
+    stage_ = stage;
+    stage_start_ = now;
+    entered_[stage] = true;
+    return (previous);
+}
+
+LatencyMeasurement*
+LatencyMeasurement::current() {
+    return (current_measurement);
+}
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
@@ -0,0 +1,249 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef PROCESSING_LATENCY_H
+#define PROCESSING_LATENCY_H
+
+#include <cc/data.h>
+#include <dhcp/pkt.h>
+#include <stats/latency_histogram.h>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <atomic>
+#include <string>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Latency of the packet processing stages.
+///
+/// The server holds one latency histogram per message type and per stage
+/// of the processing of a packet. The time spent in each stage is measured
+/// by @ref LatencyMeasurement and @ref StageTimer and recorded when the
+/// processing of the packet completes.
+///
+/// The histograms are returned by the latency-get command and their
+/// percentiles are published as statistics, e.g.
+/// "pkt4-discover-latency-allocation-p99", at most once per second. The
+/// durations are in microseconds.
+class ProcessingLatency : public boost::noncopyable {
+public:
+
+    /// @brief Stages of the packet processing.
+    ///
+    /// The time of a stage doesn't include the time of the stages entered
+    /// within it, e.g. the allocation doesn't include the lease database
+    /// writes.
+    enum Stage {
+        STAGE_RECEIVE,          ///< From the reception to the processing.
+        STAGE_UNPACK,           ///< Parsing the query.
+        STAGE_CLASSIFICATION,   ///< Client classification.
+        STAGE_SUBNET_SELECTION, ///< Subnet selection.
+        STAGE_HOST_LOOKUP,      ///< Host reservation lookup.
+        STAGE_ALLOCATION,       ///< Lease allocation.
+        STAGE_LEASE_WRITE,      ///< Lease database writes.
+        STAGE_PACK,             ///< Building the response.
+        STAGE_SEND,             ///< Sending the response.
+        STAGE_OTHER,            ///< Everything else, e.g. hooks callouts.
+        STAGE_TOTAL,            ///< From the reception to the end.
+        NUM_STAGES
+    };
+
+    /// @brief Returns the name of a stage.
+    ///
+    /// @param stage the stage
+    /// @return name used in the commands and statistics, e.g. "allocation"
+    static std::string stageToText(const Stage stage);
+
+    /// @brief Constructor.
+    ///
+    /// @param prefix prefix of the statistics, e.g. "pkt4"
+    explicit ProcessingLatency(const std::string& prefix);
+
+    /// @brief Adds a message type.
+    ///
+    /// The messages of types which were not added are accounted as
+    /// "unknown".
+    ///
+    /// @param type message type
+    /// @param name name used in the commands and statistics, e.g.
+    /// "discover"
+    void addMessageType(const uint8_t type, const std::string& name);
+
+    /// @brief Records the durations of the stages of a packet.
+    ///
+    /// @param type message type of the packet
+    /// @param durations durations of the stages in microseconds
+    /// @param entered indicates which stages were entered
+    void record(const uint8_t type, const uint64_t (&durations)[NUM_STAGES],
+                const bool (&entered)[NUM_STAGES]);
+
+    /// @brief Returns a histogram.
+    ///
+    /// @param type message type
+    /// @param stage stage
+    const isc::stats::LatencyHistogram& getHistogram(const uint8_t type,
+                                                     const Stage stage) const;
+
+    /// @brief Returns the summaries of the histograms.
+    ///
+    /// Only the message types and stages with recorded values are
+    /// returned.
+    ///
+    /// @return map of maps of summaries, e.g. { "discover": {
+    /// "allocation": { "count": 10, "p50": 120, ... }, ... }, ... }
+    isc::data::ElementPtr toElement() const;
+
+    /// @brief Publishes the percentiles as statistics.
+    ///
+    /// The p50, p99 and max statistics of the message types and stages
+    /// with recorded values are set.
+    void updateStatistics() const;
+
+    /// @brief Publishes the statistics if they were not published
+    /// during the last second.
+    ///
+    /// @param now current time
+    void updateStatisticsPeriodically(const boost::posix_time::ptime& now);
+
+    /// @brief Discards the recorded values.
+    void reset();
+
+private:
+
+    /// @brief Histograms of a message type.
+    struct MessageType {
+        /// @brief Name of the message type.
+        std::string name_;
+
+        /// @brief Histograms by stage.
+        isc::stats::LatencyHistogram histograms_[NUM_STAGES];
+    };
+
+    /// @brief Pointer to the histograms of a message type.
+    typedef boost::shared_ptr<MessageType> MessageTypePtr;
+
+    /// @brief Prefix of the statistics.
+    std::string prefix_;
+
+    /// @brief Histograms of all message types, the unknown ones first.
+    std::vector<MessageTypePtr> message_types_;
+
+    /// @brief Histograms by message type.
+    MessageType* by_type_[256];
+
+    /// @brief Time of the last update of the statistics in microseconds.
+    std::atomic<int64_t> last_update_;
+};
+
+/// @brief Pointer to the latency of the packet processing stages.
+typedef boost::shared_ptr<ProcessingLatency> ProcessingLatencyPtr;
+
+/// @brief Measures the time spent in the stages of the processing of a
+/// packet.
+///
+/// An object is created by the server when it starts processing a packet
+/// and destroyed when the processing completes. It measures the time spent
+/// in the stages entered with @ref StageTimer by the code processing the
+/// packet in the same thread, and records it in @ref ProcessingLatency when
+/// destroyed.
+class LatencyMeasurement : public boost::noncopyable {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Starts the measurement in the current thread. The receive stage
+    /// lasts from the timestamp of the packet to the construction.
+    ///
+    /// @param latency histograms recording the measurement
+    /// @param query the packet, its message type is read when the
+    /// measurement is recorded
+    LatencyMeasurement(ProcessingLatency& latency, const PktPtr& query);
+
+    /// @brief Destructor.
+    ///
+    /// Records the measurement.
+    ~LatencyMeasurement();
+
+    /// @brief Enters a stage.
+    ///
+    /// @param stage the stage
+    /// @return the stage left
+    ProcessingLatency::Stage enter(const ProcessingLatency::Stage stage);
+
+    /// @brief Returns the measurement in progress in the current thread.
+    ///
+    /// @return the measurement or null
+    static LatencyMeasurement* current();
+
+private:
+
+    /// @brief Histograms recording the measurement.
+    ProcessingLatency& latency_;
+
+    /// @brief The packet.
+    PktPtr query_;
+
+    /// @brief Start time of the measurement.
+    boost::posix_time::ptime start_;
+
+    /// @brief Stage in progress.
+    ProcessingLatency::Stage stage_;
+
+    /// @brief Start time of the stage in progress.
+    boost::posix_time::ptime stage_start_;
+
+    /// @brief Durations of the stages in microseconds.
+    uint64_t durations_[ProcessingLatency::NUM_STAGES];
+
+    /// @brief Indicates which stages were entered.
+    bool entered_[ProcessingLatency::NUM_STAGES];
+
+    /// @brief Measurement in progress when this one was created.
+    LatencyMeasurement* previous_;
+};
+
+/// @brief Accounts the time of the scope to a stage of the packet
+/// processing.
+///
+/// The time is accounted to the measurement in progress in the current
+/// thread, if any. The stage entered before is restored on exit.
+class StageTimer : public boost::noncopyable {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param stage the stage
+    explicit StageTimer(const ProcessingLatency::Stage stage)
+        : measurement_(LatencyMeasurement::current()),
+          previous_(ProcessingLatency::STAGE_OTHER) {
+        if (measurement_) {
+            previous_ = measurement_->enter(stage);
+        }
+    }
+
+    /// @brief Destructor.
+    ~StageTimer() {
+        if (measurement_) {
+            measurement_->enter(previous_);
+        }
+    }
+
+private:
+
+    /// @brief The measurement in progress.
+    LatencyMeasurement* measurement_;
+
+    /// @brief The stage entered before.
+    ProcessingLatency::Stage previous_;
+};
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
+
+#endif // PROCESSING_LATENCY_H
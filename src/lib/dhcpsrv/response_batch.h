@@ -0,0 +1,108 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef RESPONSE_BATCH_H
+#define RESPONSE_BATCH_H
+
+#include <util/threads/sync.h>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Responses to the queries received in one reception cycle.
+///
+/// The queries returned by the @c IfaceMgr until its queue of received
+/// packets is empty form a reception cycle. Their responses are collected
+/// by an instance of this class and sent together, so as the packet filter
+/// may send them with a single system call.
+///
+/// The queries of a cycle may be processed by many threads. The responses
+/// are handed over to the caller which processes the last query of a
+/// closed cycle, or to the caller closing a cycle whose queries have all
+/// been processed.
+///
+/// @tparam PktPtrType Type of the pointer to the response, i.e. @c Pkt4Ptr
+/// or @c Pkt6Ptr.
+template<typename PktPtrType>
+class ResponseBatch : public boost::noncopyable {
+public:
+
+    /// @brief Constructor.
+    ResponseBatch()
+        : mutex_(), pending_(0), closed_(false), responses_() {
+    }
+
+    /// @brief Records a query of the cycle to be processed.
+    void add() {
+        isc::util::thread::Mutex::Locker lock(mutex_);
+        ++pending_;
+    }
+
+    /// @brief Records that a query of the cycle has been processed.
+    ///
+    /// @param response Response to the query, null if there is none.
+    /// @param [out] ready Responses to be sent by the caller, set only if
+    /// the cycle is complete.
+    ///
+    /// @return true if the caller must send the responses.
+    bool done(const PktPtrType& response, std::vector<PktPtrType>& ready) {
+        isc::util::thread::Mutex::Locker lock(mutex_);
+        if (response) {
+            responses_.push_back(response);
+        }
+        --pending_;
+        return (take(ready));
+    }
+
+    /// @brief Closes the cycle, no more queries will be added.
+    ///
+    /// @param [out] ready Responses to be sent by the caller, set only if
+    /// all the queries of the cycle have been processed.
+    ///
+    /// @return true if the caller must send the responses.
+    bool close(std::vector<PktPtrType>& ready) {
+        isc::util::thread::Mutex::Locker lock(mutex_);
+        closed_ = true;
+        return (take(ready));
+    }
+
+private:
+
+    /// @brief Hands the responses over if the cycle is complete.
+    ///
+    /// It must be called with the mutex locked.
+    ///
+    /// @param [out] ready Responses to be sent.
+    ///
+    /// @return true if the cycle is complete and has responses.
+    bool take(std::vector<PktPtrType>& ready) {
+        if (!closed_ || (pending_ > 0) || responses_.empty()) {
+            return (false);
+        }
+        ready.swap(responses_);
+        return (true);
+    }
+
+    /// @brief Mutex protecting the members below.
+    isc::util::thread::Mutex mutex_;
+
+    /// @brief Number of queries of the cycle not processed yet.
+    size_t pending_;
+
+    /// @brief Indicates if the cycle is over.
+    bool closed_;
+
+    /// @brief Responses collected so far.
+    std::vector<PktPtrType> responses_;
+};
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
+
+#endif // RESPONSE_BATCH_H
@@ -24,6 +24,7 @@ namespace dhcp {
 SrvConfig::SrvConfig()
     : sequence_(0), cfg_iface_(new CfgIface()),
       cfg_option_def_(new CfgOptionDef()), cfg_option_(new CfgOption()),
+      cfg_option_set_cache_(new CfgOptionSetCache()),
       cfg_subnets4_(new CfgSubnets4()), cfg_subnets6_(new CfgSubnets6()),
       cfg_shared_networks4_(new CfgSharedNetworks4()),
       cfg_shared_networks6_(new CfgSharedNetworks6()),
@@ -40,6 +41,7 @@ SrvConfig::SrvConfig()
 SrvConfig::SrvConfig(const uint32_t sequence)
     : sequence_(sequence), cfg_iface_(new CfgIface()),
       cfg_option_def_(new CfgOptionDef()), cfg_option_(new CfgOption()),
+      cfg_option_set_cache_(new CfgOptionSetCache()),
       cfg_subnets4_(new CfgSubnets4()), cfg_subnets6_(new CfgSubnets6()),
       cfg_shared_networks4_(new CfgSharedNetworks4()),
       cfg_shared_networks6_(new CfgSharedNetworks6()),
@@ -183,26 +185,38 @@ SrvConfig::equals(const SrvConfig& other) const {
 }
 
 void
-SrvConfig::removeStatistics() {
+SrvConfig::removeStatistics(const ConstSrvConfigPtr& next) {
 
     // Removes statistics for v4 and v6 subnets
-    getCfgSubnets4()->removeStatistics();
+    getCfgSubnets4()->removeStatistics(next ? next->getCfgSubnets4() :
+                                       ConstCfgSubnets4Ptr());
 
-    getCfgSubnets6()->removeStatistics();
+    getCfgSubnets6()->removeStatistics(next ? next->getCfgSubnets6() :
+                                       ConstCfgSubnets6Ptr());
 }
 
 void
-SrvConfig::updateStatistics() {
+SrvConfig::updateStatistics(const ConstSrvConfigPtr& previous) {
     // Updating subnet statistics involves updating lease statistics, which
     // is done by the LeaseMgr.  Since servers with subnets, must have a
     // LeaseMgr, we do not bother updating subnet stats for servers without
     // a lease manager, such as D2. @todo We should probably examine why
     // "SrvConfig" is being used by D2.
     if (LeaseMgrFactory::haveInstance()) {
+        // The lease statistics of the previous configuration are only
+        // valid for the leases in the same lease database.
+        bool same_leases = previous &&
+            (previous->getCfgDbAccess()->getLeaseDbAccessString() ==
+             getCfgDbAccess()->getLeaseDbAccessString());
+
         // Updates  statistics for v4 and v6 subnets
-        getCfgSubnets4()->updateStatistics();
+        getCfgSubnets4()->updateStatistics(same_leases ?
+                                           previous->getCfgSubnets4() :
+                                           ConstCfgSubnets4Ptr());
 
-        getCfgSubnets6()->updateStatistics();
+        getCfgSubnets6()->updateStatistics(same_leases ?
+                                           previous->getCfgSubnets6() :
+                                           ConstCfgSubnets6Ptr());
     }
 }
 
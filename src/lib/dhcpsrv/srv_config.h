@@ -16,6 +16,7 @@
 #include <dhcpsrv/cfg_iface.h>
 #include <dhcpsrv/cfg_option.h>
 #include <dhcpsrv/cfg_option_def.h>
+#include <dhcpsrv/cfg_option_set.h>
 #include <dhcpsrv/cfg_rsoo.h>
 #include <dhcpsrv/cfg_shared_networks.h>
 #include <dhcpsrv/cfg_subnets4.h>
@@ -194,6 +195,17 @@ public:
         return (cfg_option_);
     }
 
+    /// @brief Returns pointer to the cache of resolved option sets.
+    ///
+    /// The cache holds the options resolved from the option configurations
+    /// of this configuration. It is created empty with the configuration,
+    /// so the sets resolved with a previous configuration are not used.
+    ///
+    /// @return Pointer to the cache of resolved option sets.
+    CfgOptionSetCachePtr getCfgOptionSetCache() const {
+        return (cfg_option_set_cache_);
+    }
+
     /// @brief Returns pointer to non-const object holding subnets configuration
     /// for DHCPv4.
     ///
@@ -478,14 +490,27 @@ public:
     /// This method calls appropriate methods in child objects that update
     /// related statistics. See @ref CfgSubnets4::updateStatistics and
     /// @ref CfgSubnets6::updateStatistics for details.
-    void updateStatistics();
+    ///
+    /// The lease statistics of the subnets which haven't changed since the
+    /// previous configuration are kept, unless the leases are stored in
+    /// a different lease database than before.
+    ///
+    /// @param previous Pointer to the previous configuration. If it is
+    /// null, the lease statistics of all subnets are recounted.
+    void updateStatistics(const boost::shared_ptr<const SrvConfig>& previous =
+                          boost::shared_ptr<const SrvConfig>());
 
     /// @brief Removes statistics.
     ///
     /// This method calls appropriate methods in child objects that remove
     /// related statistics. See @ref CfgSubnets4::removeStatistics and
     /// @ref CfgSubnets6::removeStatistics for details.
-    void removeStatistics();
+    ///
+    /// @param next Pointer to the new configuration. The statistics of the
+    /// subnets present in the new configuration are not removed. If it is
+    /// null, all statistics are removed.
+    void removeStatistics(const boost::shared_ptr<const SrvConfig>& next =
+                          boost::shared_ptr<const SrvConfig>());
 
     /// @brief Sets decline probation-period
     ///
@@ -586,6 +611,9 @@ private:
     /// connected to any subnet.
     CfgOptionPtr cfg_option_;
 
+    /// @brief Pointer to the cache of resolved option sets.
+    CfgOptionSetCachePtr cfg_option_set_cache_;
+
     /// @brief Pointer to subnets configuration for IPv4.
     CfgSubnets4Ptr cfg_subnets4_;
 
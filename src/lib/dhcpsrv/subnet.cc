@@ -76,6 +76,7 @@ isc::asiolink::IOAddress Subnet::getLastAllocated(Lease::Type type) const {
     // check if the type is valid (and throw if it isn't)
     checkType(type);
 
+    isc::util::thread::Mutex::Locker lock(last_allocated_mutex_);
     switch (type) {
     case Lease::TYPE_V4:
     case Lease::TYPE_NA:
@@ -95,6 +96,7 @@ void Subnet::setLastAllocated(Lease::Type type,
     // check if the type is valid (and throw if it isn't)
     checkType(type);
 
+    isc::util::thread::Mutex::Locker lock(last_allocated_mutex_);
     switch (type) {
     case Lease::TYPE_V4:
     case Lease::TYPE_NA:
@@ -134,6 +136,24 @@ Subnet::getPoolCapacity(Lease::Type type) const {
     }
 }
 
+bool
+Subnet::hasSamePools(const Subnet& other, Lease::Type type) const {
+    const PoolCollection& pools = getPools(type);
+    const PoolCollection& other_pools = other.getPools(type);
+    if (pools.size() != other_pools.size()) {
+        return (false);
+    }
+
+    for (size_t i = 0; i < pools.size(); ++i) {
+        if ((pools[i]->getFirstAddress() != other_pools[i]->getFirstAddress()) ||
+            (pools[i]->getLastAddress() != other_pools[i]->getLastAddress()) ||
+            (pools[i]->getCapacity() != other_pools[i]->getCapacity())) {
+            return (false);
+        }
+    }
+    return (true);
+}
+
 uint64_t
 Subnet::sumPoolCapacity(const PoolCollection& pools) const {
     uint64_t sum = 0;
@@ -329,6 +349,22 @@ const PoolPtr Subnet::getPool(Lease::Type type, const isc::asiolink::IOAddress&
     return (candidate);
 }
 
+void
+Subnet::markLeaseUsed(Lease::Type type, const isc::asiolink::IOAddress& addr) const {
+    PoolPtr pool = getPool(type, addr, false);
+    if (pool) {
+        pool->markLeaseUsed(addr);
+    }
+}
+
+void
+Subnet::markLeaseFree(Lease::Type type, const isc::asiolink::IOAddress& addr) const {
+    PoolPtr pool = getPool(type, addr, false);
+    if (pool) {
+        pool->markLeaseFree(addr);
+    }
+}
+
 void
 Subnet::addPool(const PoolPtr& pool) {
     // check if the type is valid (and throw if it isn't)
@@ -15,6 +15,7 @@
 #include <dhcpsrv/pool.h>
 #include <dhcpsrv/subnet_id.h>
 #include <dhcpsrv/triplet.h>
+#include <util/threads/sync.h>
 
 #include <boost/multi_index/mem_fun.hpp>
 #include <boost/multi_index/indexed_by.hpp>
@@ -169,6 +170,39 @@ public:
     /// @param type type of the lease
     uint64_t getPoolCapacity(Lease::Type type) const;
 
+    /// @brief Checks if the pools of the specified type are the same as
+    /// in another subnet
+    ///
+    /// The pools are the same if they cover the same ranges of addresses
+    /// or prefixes, in the same order, and have the same capacity.
+    ///
+    /// @param other subnet to compare the pools with
+    /// @param type type of the pools
+    /// @return true if the pools are the same, false otherwise
+    bool hasSamePools(const Subnet& other, Lease::Type type) const;
+
+    /// @brief Marks the address or prefix as used in the lease bitmap of
+    /// the pool it belongs to.
+    ///
+    /// This is no-op if the address doesn't belong to any pool or the
+    /// pool has no lease bitmap.
+    ///
+    /// @param type type of the lease
+    /// @param addr leased address or prefix
+    void markLeaseUsed(Lease::Type type,
+                       const isc::asiolink::IOAddress& addr) const;
+
+    /// @brief Marks the address or prefix as free in the lease bitmap of
+    /// the pool it belongs to.
+    ///
+    /// This is no-op if the address doesn't belong to any pool or the
+    /// pool has no lease bitmap.
+    ///
+    /// @param type type of the lease
+    /// @param addr released address or prefix
+    void markLeaseFree(Lease::Type type,
+                       const isc::asiolink::IOAddress& addr) const;
+
     /// @brief Returns textual representation of the subnet (e.g.
     /// "2001:db8::/64")
     ///
@@ -357,6 +391,12 @@ protected:
     /// See @ref last_allocated_ia_ for details.
     isc::asiolink::IOAddress last_allocated_pd_;
 
+    /// @brief Mutex protecting last allocated addresses.
+    ///
+    /// The allocation engine may be used by multiple packet processing
+    /// threads which update the last allocated addresses concurrently.
+    mutable isc::util::thread::Mutex last_allocated_mutex_;
+
     /// @brief Name of the network interface (if connected directly)
     std::string iface_;
 
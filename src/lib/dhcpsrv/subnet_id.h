@@ -8,6 +8,7 @@
 #define SUBNET_ID_H
 
 #include <exceptions/exceptions.h>
+#include <set>
 #include <stdint.h>
 
 namespace isc {
@@ -21,6 +22,9 @@ namespace dhcp {
 /// type.
 typedef uint32_t SubnetID;
 
+/// @brief Ordered collection of unique subnet identifiers.
+typedef std::set<SubnetID> SubnetIDSet;
+
 /// @brief Exception thrown upon attempt to add subnet with an ID that belongs
 /// to the subnet that already exists.
 class DuplicateSubnetID : public Exception {
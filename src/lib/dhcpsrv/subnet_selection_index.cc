@@ -0,0 +1,28 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <dhcpsrv/addr_utilities.h>
+#include <dhcpsrv/subnet_selection_index.h>
+
+using namespace isc::asiolink;
+
+namespace isc {
+namespace dhcp {
+
+void
+PrefixSelectionIndex::add(const IOAddress& prefix, const uint8_t prefix_len,
+                          const size_t position) {
+    lengths_[prefix_len].add(mask(prefix, prefix_len), position);
+}
+
+IOAddress
+PrefixSelectionIndex::mask(const IOAddress& address, const uint8_t prefix_len) {
+    return (firstAddrInPrefix(address, prefix_len));
+}
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
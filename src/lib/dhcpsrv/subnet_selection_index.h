@@ -0,0 +1,264 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef SUBNET_SELECTION_INDEX_H
+#define SUBNET_SELECTION_INDEX_H
+
+#include <asiolink/io_address.h>
+#include <dhcp/classify.h>
+#include <boost/unordered_map.hpp>
+#include <functional>
+#include <limits>
+#include <map>
+#include <stdint.h>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Positions of the subnets sharing a key, in ascending order.
+typedef std::vector<size_t> SubnetPositions;
+
+/// @brief Value returned by the selection indexes when no subnet matches.
+const size_t NO_SUBNET_POSITION = std::numeric_limits<size_t>::max();
+
+/// @brief Returns the position of the first subnet matching the predicate.
+///
+/// @param positions Positions of the subnets in ascending order.
+/// @param predicate Function object taking the position of the subnet and
+/// returning true if the subnet can be selected.
+/// @param limit Position at which the search stops.
+/// @return Position of the first matching subnet or @c NO_SUBNET_POSITION.
+template<typename Predicate>
+size_t
+findFirstPosition(const SubnetPositions& positions, Predicate predicate,
+                  const size_t limit = NO_SUBNET_POSITION) {
+    for (SubnetPositions::const_iterator position = positions.begin();
+         (position != positions.end()) && (*position < limit); ++position) {
+        if (predicate(*position)) {
+            return (*position);
+        }
+    }
+    return (NO_SUBNET_POSITION);
+}
+
+/// @brief Accepts the subnets which the client is allowed to use.
+///
+/// @tparam SubnetPtrType Pointer to the @c Subnet4 or @c Subnet6.
+template<typename SubnetPtrType>
+class ClientSupportedSubnet {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param subnets Subnets by position held in the selection indexes.
+    /// @param client_classes Classes that the client belongs to.
+    ClientSupportedSubnet(const std::vector<SubnetPtrType>& subnets,
+                          const ClientClasses& client_classes)
+        : subnets_(subnets), client_classes_(client_classes) {
+    }
+
+    /// @brief Checks if the client is allowed to use the subnet.
+    ///
+    /// @param position Position of the subnet.
+    bool operator()(const size_t position) const {
+        return (subnets_[position]->clientSupported(client_classes_));
+    }
+
+private:
+
+    /// @brief Subnets by position.
+    const std::vector<SubnetPtrType>& subnets_;
+
+    /// @brief Classes that the client belongs to.
+    const ClientClasses& client_classes_;
+};
+
+/// @brief Accepts any subnet.
+struct AnySubnet {
+
+    /// @brief Accepts the subnet.
+    bool operator()(const size_t) const {
+        return (true);
+    }
+};
+
+/// @brief Index of the subnets by an exact key.
+///
+/// The subnets are identified by their positions in the configuration.
+/// This index is used to find the subnets by the relay address, interface
+/// name and similar parameters, which previously required iterating over
+/// all subnets. Many subnets may share the same key and the first subnet
+/// (having the lowest position) accepted by the caller is returned, which
+/// preserves the order in which the subnets are configured.
+///
+/// @tparam KeyType Type of the key.
+template<typename KeyType>
+class KeySelectionIndex {
+public:
+
+    /// @brief Adds the subnet to the index.
+    ///
+    /// The subnets must be added in the ascending order of positions.
+    ///
+    /// @param key Key of the subnet.
+    /// @param position Position of the subnet.
+    void add(const KeyType& key, const size_t position) {
+        index_[key].push_back(position);
+    }
+
+    /// @brief Removes all subnets from the index.
+    void clear() {
+        index_.clear();
+    }
+
+    /// @brief Returns the position of the first subnet with the key.
+    ///
+    /// @param key Key of the subnet.
+    /// @param predicate Function object taking the position of the subnet
+    /// and returning true if the subnet can be selected.
+    /// @return Position of the subnet or @c NO_SUBNET_POSITION.
+    template<typename Predicate>
+    size_t find(const KeyType& key, Predicate predicate) const {
+        typename IndexType::const_iterator it = index_.find(key);
+        if (it == index_.end()) {
+            return (NO_SUBNET_POSITION);
+        }
+        return (findFirstPosition(it->second, predicate));
+    }
+
+private:
+
+    /// @brief Type of the container holding the positions by key.
+    typedef boost::unordered_map<KeyType, SubnetPositions> IndexType;
+
+    /// @brief Positions of the subnets by key.
+    IndexType index_;
+};
+
+/// @brief Index of the subnets by prefix.
+///
+/// This index is used to find the subnets to which the address belongs.
+/// The prefixes are held in a hash table per prefix length, so finding
+/// the subnets requires one lookup for each distinct prefix length used
+/// in the configuration, rather than checking all subnets. The subnets
+/// configured in a typical deployment use few distinct prefix lengths.
+///
+/// The subnet prefixes may overlap, in which case the first subnet
+/// (having the lowest position) accepted by the caller is returned,
+/// regardless of the length of its prefix.
+class PrefixSelectionIndex {
+public:
+
+    /// @brief Adds the subnet to the index.
+    ///
+    /// The subnets must be added in the ascending order of positions.
+    ///
+    /// @param prefix Prefix of the subnet.
+    /// @param prefix_len Length of the prefix.
+    /// @param position Position of the subnet.
+    void add(const asiolink::IOAddress& prefix, const uint8_t prefix_len,
+             const size_t position);
+
+    /// @brief Removes all subnets from the index.
+    void clear() {
+        lengths_.clear();
+    }
+
+    /// @brief Returns the position of the first subnet holding the address.
+    ///
+    /// @param address Address to be matched with the prefixes.
+    /// @param predicate Function object taking the position of the subnet
+    /// and returning true if the subnet can be selected.
+    /// @return Position of the subnet or @c NO_SUBNET_POSITION.
+    template<typename Predicate>
+    size_t find(const asiolink::IOAddress& address, Predicate predicate) const {
+        size_t found = NO_SUBNET_POSITION;
+        for (LengthsType::const_iterator length = lengths_.begin();
+             length != lengths_.end(); ++length) {
+            if (!canMatch(address, length->first)) {
+                continue;
+            }
+            const size_t position = length->second.find(mask(address,
+                                                             length->first),
+                                                        predicate, found);
+            if (position < found) {
+                found = position;
+            }
+        }
+        return (found);
+    }
+
+private:
+
+    /// @brief Index of the subnets having prefixes of the same length.
+    class PrefixLengthIndex {
+    public:
+
+        /// @brief Adds the subnet to the index.
+        ///
+        /// @param prefix Prefix of the subnet with the host bits cleared.
+        /// @param position Position of the subnet.
+        void add(const asiolink::IOAddress& prefix, const size_t position) {
+            index_[prefix].push_back(position);
+        }
+
+        /// @brief Returns the position of the first subnet with the prefix.
+        ///
+        /// @param prefix Prefix with the host bits cleared.
+        /// @param predicate Function object accepting the subnet.
+        /// @param limit Position at which the search stops.
+        template<typename Predicate>
+        size_t find(const asiolink::IOAddress& prefix, Predicate predicate,
+                    const size_t limit) const {
+            IndexType::const_iterator it = index_.find(prefix);
+            if (it == index_.end()) {
+                return (NO_SUBNET_POSITION);
+            }
+            return (findFirstPosition(it->second, predicate, limit));
+        }
+
+    private:
+
+        /// @brief Type of the container holding the positions by prefix.
+        typedef boost::unordered_map<asiolink::IOAddress,
+                                     SubnetPositions> IndexType;
+
+        /// @brief Positions of the subnets by prefix.
+        IndexType index_;
+    };
+
+    /// @brief Checks if the address can belong to the prefix of the length.
+    ///
+    /// @param address Address to be matched.
+    /// @param prefix_len Length of the prefix.
+    /// @return true if the address and the prefix are of the same family.
+    static bool canMatch(const asiolink::IOAddress& address,
+                         const uint8_t prefix_len) {
+        return (address.isV4() ? (prefix_len <= 32) : (prefix_len <= 128));
+    }
+
+    /// @brief Clears the host bits of the address.
+    ///
+    /// @param address Address.
+    /// @param prefix_len Length of the prefix.
+    static asiolink::IOAddress mask(const asiolink::IOAddress& address,
+                                    const uint8_t prefix_len);
+
+    /// @brief Type of the container holding the indexes by prefix length.
+    ///
+    /// The longer prefixes are checked first.
+    typedef std::map<uint8_t, PrefixLengthIndex,
+                     std::greater<uint8_t> > LengthsType;
+
+    /// @brief Indexes by prefix length.
+    LengthsType lengths_;
+};
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
+
+#endif // SUBNET_SELECTION_INDEX_H
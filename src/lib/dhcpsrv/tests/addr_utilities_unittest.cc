@@ -11,6 +11,7 @@
 
 #include <gtest/gtest.h>
 
+#include <limits>
 #include <vector>
 
 #include <stdint.h>
@@ -358,4 +359,68 @@ TEST(AddrUtilitiesTest, prefixesInRange) {
 
 }
 
+// Checks if offsetAddress returns the correct addresses and prefixes.
+TEST(AddrUtilitiesTest, offsetAddress) {
+    // IPv4 addresses.
+    EXPECT_EQ("192.0.2.11", offsetAddress(IOAddress("192.0.2.1"), 10).toText());
+    EXPECT_EQ("192.0.3.0", offsetAddress(IOAddress("192.0.2.255"), 1).toText());
+    EXPECT_EQ("0.0.0.0", offsetAddress(IOAddress("255.255.255.255"), 1).toText());
+
+    // IPv6 addresses.
+    EXPECT_EQ("2001:db8::1", offsetAddress(IOAddress("2001:db8::"), 1).toText());
+    EXPECT_EQ("2001:db8::1:0", offsetAddress(IOAddress("2001:db8::ffff"), 1).toText());
+    EXPECT_EQ("2001:db8:0:1::",
+              offsetAddress(IOAddress("2001:db8::ffff:ffff:ffff:ffff"), 1).toText());
+    EXPECT_EQ("2001:db8::ffff:ffff:ffff:ffff",
+              offsetAddress(IOAddress("2001:db8::"),
+                            std::numeric_limits<uint64_t>::max()).toText());
+
+    // IPv6 prefixes.
+    EXPECT_EQ("2001:db8:0:3::", offsetAddress(IOAddress("2001:db8::"), 3, 64).toText());
+    EXPECT_EQ("2001:db8:0:30::", offsetAddress(IOAddress("2001:db8::"), 3, 60).toText());
+    EXPECT_EQ("2001:db9::", offsetAddress(IOAddress("2001:db8:ffff::"), 1, 48).toText());
+    EXPECT_EQ("2001:db8:8000::", offsetAddress(IOAddress("2001:db8::"),
+                                                0x8000ull, 48).toText());
+    EXPECT_EQ("2001:db8:0:1::",
+              offsetAddress(IOAddress("2001:db8::"), 0x1000000ull, 88).toText());
+
+    // Invalid prefix length.
+    EXPECT_THROW(offsetAddress(IOAddress("2001:db8::"), 1, 0), isc::BadValue);
+    EXPECT_THROW(offsetAddress(IOAddress("2001:db8::"), 1, 129), isc::BadValue);
+}
+
+// Checks if addressOffset returns the correct offsets.
+TEST(AddrUtilitiesTest, addressOffset) {
+    // IPv4 addresses.
+    EXPECT_EQ(10, addressOffset(IOAddress("192.0.2.1"), IOAddress("192.0.2.11")));
+    EXPECT_EQ(0, addressOffset(IOAddress("192.0.2.1"), IOAddress("192.0.2.1")));
+    EXPECT_EQ(0xffffffff, addressOffset(IOAddress("0.0.0.0"),
+                                        IOAddress("255.255.255.255")));
+
+    // IPv6 addresses.
+    EXPECT_EQ(0x10000, addressOffset(IOAddress("2001:db8::ffff"),
+                                     IOAddress("2001:db8::1:ffff")));
+    EXPECT_EQ(1, addressOffset(IOAddress("2001:db8::ffff:ffff:ffff:ffff"),
+                               IOAddress("2001:db8:0:1::")));
+    EXPECT_EQ(std::numeric_limits<uint64_t>::max(),
+              addressOffset(IOAddress("2001:db8::"), IOAddress("2001:db9::")));
+
+    // IPv6 prefixes.
+    EXPECT_EQ(3, addressOffset(IOAddress("2001:db8::"), IOAddress("2001:db8:0:3::"), 64));
+    EXPECT_EQ(0x10000, addressOffset(IOAddress("2001:db8::"), IOAddress("2001:db9::"), 48));
+    EXPECT_EQ(1, addressOffset(IOAddress("::"), IOAddress("8000::"), 1));
+
+    // The offset is the reverse of offsetAddress.
+    IOAddress base("2001:db8:1::");
+    EXPECT_EQ(12345, addressOffset(base, offsetAddress(base, 12345, 56), 56));
+
+    // Invalid arguments.
+    EXPECT_THROW(addressOffset(IOAddress("192.0.2.2"), IOAddress("192.0.2.1")),
+                 isc::BadValue);
+    EXPECT_THROW(addressOffset(IOAddress("192.0.2.1"), IOAddress("2001:db8::1")),
+                 isc::BadValue);
+    EXPECT_THROW(addressOffset(IOAddress("2001:db8::"), IOAddress("2001:db8::1"), 0),
+                 isc::BadValue);
+}
+
 }; // end of anonymous namespace
@@ -6,6 +6,7 @@
 
 #include <config.h>
 #include <dhcp/pkt4.h>
+#include <dhcpsrv/memfile_lease_mgr.h>
 #include <dhcpsrv/shared_network.h>
 #include <dhcpsrv/tests/alloc_engine_utils.h>
 #include <dhcpsrv/tests/test_utils.h>
@@ -25,11 +26,11 @@ namespace test {
 TEST_F(AllocEngine4Test, constructor) {
     boost::scoped_ptr<AllocEngine> x;
 
-    // Hashed and random allocators are not supported yet
-    ASSERT_THROW(x.reset(new AllocEngine(AllocEngine::ALLOC_HASHED, 5, false)),
-                 NotImplemented);
-    ASSERT_THROW(x.reset(new AllocEngine(AllocEngine::ALLOC_RANDOM, 5, false)),
-                 NotImplemented);
+    // Hashed and random allocators are supported too.
+    ASSERT_NO_THROW(x.reset(new AllocEngine(AllocEngine::ALLOC_HASHED, 5, false)));
+    EXPECT_TRUE(x->getAllocator(Lease::TYPE_V4));
+    ASSERT_NO_THROW(x.reset(new AllocEngine(AllocEngine::ALLOC_RANDOM, 5, false)));
+    EXPECT_TRUE(x->getAllocator(Lease::TYPE_V4));
 
     // Create V4 (ipv6=false) Allocation Engine that will try at most
     // 100 attempts to pick up a lease
@@ -389,6 +390,196 @@ TEST_F(AllocEngine4Test, IterativeAllocator_manyPools4) {
 }
 
 
+// This test verifies that the random allocator picks each address in
+// the pools once before it starts picking the same addresses again.
+TEST_F(AllocEngine4Test, RandomAllocator) {
+    NakedAllocEngine::RandomAllocator alloc(Lease::TYPE_V4);
+
+    subnet_->addPool(Pool4Ptr(new Pool4(IOAddress("192.0.2.200"),
+                                        IOAddress("192.0.2.204"))));
+
+    // The default pool .100 - .109 has 10 addresses.
+    const size_t total = 15;
+    for (int cycle = 0; cycle < 2; ++cycle) {
+        std::set<IOAddress> generated_addrs;
+        for (size_t i = 0; i < total; ++i) {
+            IOAddress candidate = alloc.pickAddress(subnet_, clientid_,
+                                                    IOAddress("0.0.0.0"));
+            EXPECT_TRUE(subnet_->inPool(Lease::TYPE_V4, candidate));
+            EXPECT_TRUE(generated_addrs.insert(candidate).second)
+                << "address " << candidate << " picked twice";
+        }
+    }
+}
+
+// This test verifies that the hashed allocator returns the same address
+// for the same client and that the subsequent attempts visit all addresses.
+TEST_F(AllocEngine4Test, HashedAllocator) {
+    NakedAllocEngine::HashedAllocator alloc(Lease::TYPE_V4);
+
+    IOAddress home = alloc.pickAddress(subnet_, clientid_, IOAddress("0.0.0.0"));
+    EXPECT_TRUE(subnet_->inPool(Lease::TYPE_V4, home));
+
+    std::set<IOAddress> generated_addrs;
+    for (uint64_t attempt = 0; attempt < 10; ++attempt) {
+        IOAddress candidate = alloc.pickAddress(subnet_, clientid_,
+                                                IOAddress("0.0.0.0"), attempt);
+        EXPECT_TRUE(subnet_->inPool(Lease::TYPE_V4, candidate));
+        EXPECT_TRUE(generated_addrs.insert(candidate).second)
+            << "address " << candidate << " picked twice";
+    }
+    EXPECT_EQ(1, generated_addrs.count(home));
+
+    // Different clients should be spread over the pool.
+    std::set<IOAddress> homes;
+    for (uint8_t i = 0; i < 20; ++i) {
+        std::vector<uint8_t> id(8, i);
+        ClientIdPtr client_id(new ClientId(id));
+        homes.insert(alloc.pickAddress(subnet_, client_id, IOAddress("0.0.0.0")));
+    }
+    EXPECT_GT(homes.size(), 1);
+}
+
+// This test checks that the allocation engine using the random allocator
+// allocates all addresses from the pool.
+TEST_F(AllocEngine4Test, randomAllocatorFullPool) {
+    boost::scoped_ptr<AllocEngine> engine;
+    ASSERT_NO_THROW(engine.reset(new AllocEngine(AllocEngine::ALLOC_RANDOM,
+                                                 0, false)));
+
+    // The pool has 10 addresses. Allocate all of them.
+    std::set<IOAddress> allocated;
+    for (uint8_t i = 0; i < 10; ++i) {
+        std::vector<uint8_t> hwaddr_vec(6, i + 1);
+        HWAddrPtr hwaddr(new HWAddr(hwaddr_vec, HTYPE_ETHER));
+        AllocEngine::ClientContext4 ctx(subnet_, ClientIdPtr(), hwaddr,
+                                        IOAddress("0.0.0.0"), false, false,
+                                        "host.example.com.", false);
+        ctx.query_.reset(new Pkt4(DHCPREQUEST, 1234 + i));
+        Lease4Ptr lease = engine->allocateLease4(ctx);
+        ASSERT_TRUE(lease);
+        EXPECT_TRUE(allocated.insert(lease->addr_).second);
+    }
+    EXPECT_EQ(10, allocated.size());
+}
+
+// This test checks that the allocation engine uses the pool's lease bitmap
+// to skip the addresses which are in use.
+TEST_F(AllocEngine4Test, leaseBitmapSkipsUsedAddresses) {
+    boost::scoped_ptr<AllocEngine> engine;
+    ASSERT_NO_THROW(engine.reset(new AllocEngine(AllocEngine::ALLOC_ITERATIVE,
+                                                 0, false)));
+
+    // Use all addresses in the pool but 192.0.2.107.
+    uint8_t clientid2[] = { 8, 7, 6, 5, 4, 3, 2, 1 };
+    time_t now = time(NULL);
+    for (int i = 100; i < 110; ++i) {
+        if (i == 107) {
+            continue;
+        }
+        std::vector<uint8_t> hwaddr_vec(6, static_cast<uint8_t>(i));
+        HWAddrPtr hwaddr(new HWAddr(hwaddr_vec, HTYPE_ETHER));
+        Lease4Ptr lease(new Lease4(IOAddress(0xC0000200 + i), hwaddr, clientid2,
+                                   sizeof(clientid2), 1, 2, 3, now,
+                                   subnet_->getID()));
+        ASSERT_TRUE(LeaseMgrFactory::instance().addLease(lease));
+    }
+
+    LeaseBitmapPtr bitmap = pool_->getLeaseBitmap();
+    ASSERT_TRUE(bitmap);
+    EXPECT_FALSE(bitmap->isSeeded());
+
+    AllocEngine::ClientContext4 ctx(subnet_, clientid_, hwaddr_,
+                                    IOAddress("0.0.0.0"), false, false,
+                                    "host.example.com.", false);
+    ctx.query_.reset(new Pkt4(DHCPREQUEST, 1234));
+    Lease4Ptr lease = engine->allocateLease4(ctx);
+    ASSERT_TRUE(lease);
+    EXPECT_EQ("192.0.2.107", lease->addr_.toText());
+
+    // The bitmap should have been seeded with the existing leases and
+    // the new lease.
+    EXPECT_TRUE(bitmap->isSeeded());
+    EXPECT_EQ(0, bitmap->getFreeCount());
+
+    // Releasing the lease makes the address free again.
+    subnet_->markLeaseFree(Lease::TYPE_V4, lease->addr_);
+    EXPECT_EQ(1, bitmap->getFreeCount());
+    EXPECT_FALSE(bitmap->isUsed(pool_->getLeaseIndex(lease->addr_)));
+}
+
+/// @brief Memfile lease manager failing to fetch the leases in a subnet.
+class FailingLeaseMgr : public Memfile_LeaseMgr {
+public:
+    /// @brief Constructor.
+    FailingLeaseMgr(const DatabaseConnection::ParameterMap& parameters)
+        : Memfile_LeaseMgr(parameters) {
+    }
+
+    /// @brief Throws DbOperationError.
+    virtual Lease4Collection getLeases4(SubnetID) const {
+        isc_throw(DbOperationError, "unable to fetch leases");
+    }
+};
+
+// This test checks that the allocation engine allocates leases without the
+// lease bitmap when the bitmap can't be seeded because of a database error,
+// and that seeding is retried at the next allocation.
+TEST_F(AllocEngine4Test, leaseBitmapSeedingFailure) {
+    DatabaseConnection::ParameterMap parameters;
+    parameters["type"] = "memfile";
+    parameters["universe"] = "4";
+    parameters["persist"] = "false";
+    LeaseMgrFactory::setInstance(new FailingLeaseMgr(parameters));
+
+    boost::scoped_ptr<AllocEngine> engine;
+    ASSERT_NO_THROW(engine.reset(new AllocEngine(AllocEngine::ALLOC_ITERATIVE,
+                                                 0, false)));
+
+    // The first candidate is in use, so the engine tries to seed the
+    // bitmap to find the next one.
+    uint8_t clientid2[] = { 8, 7, 6, 5, 4, 3, 2, 1 };
+    std::vector<uint8_t> hwaddr_vec(6, 1);
+    HWAddrPtr hwaddr(new HWAddr(hwaddr_vec, HTYPE_ETHER));
+    Lease4Ptr used(new Lease4(IOAddress("192.0.2.100"), hwaddr, clientid2,
+                              sizeof(clientid2), 1, 2, 3, time(NULL),
+                              subnet_->getID()));
+    ASSERT_TRUE(LeaseMgrFactory::instance().addLease(used));
+
+    LeaseBitmapPtr bitmap = pool_->getLeaseBitmap();
+    ASSERT_TRUE(bitmap);
+
+    AllocEngine::ClientContext4 ctx(subnet_, clientid_, hwaddr_,
+                                    IOAddress("0.0.0.0"), false, false,
+                                    "host.example.com.", false);
+    ctx.query_.reset(new Pkt4(DHCPREQUEST, 1234));
+    Lease4Ptr lease = engine->allocateLease4(ctx);
+    ASSERT_TRUE(lease);
+    EXPECT_EQ("192.0.2.101", lease->addr_.toText());
+
+    // The bitmap is not used until it can be seeded.
+    EXPECT_FALSE(bitmap->isSeeded());
+
+    // Once the database works again, the bitmap is seeded when the engine
+    // needs it again.
+    LeaseMgrFactory::create("type=memfile universe=4 persist=false");
+    ASSERT_TRUE(LeaseMgrFactory::instance().addLease(used));
+    ASSERT_TRUE(LeaseMgrFactory::instance().addLease(lease));
+    Lease4Ptr used2(new Lease4(*used));
+    used2->addr_ = IOAddress("192.0.2.102");
+    ASSERT_TRUE(LeaseMgrFactory::instance().addLease(used2));
+
+    AllocEngine::ClientContext4 ctx2(subnet_, clientid2_, hwaddr2_,
+                                     IOAddress("0.0.0.0"), false, false,
+                                     "host.example.com.", false);
+    ctx2.query_.reset(new Pkt4(DHCPREQUEST, 1235));
+    Lease4Ptr lease2 = engine->allocateLease4(ctx2);
+    ASSERT_TRUE(lease2);
+    EXPECT_EQ("192.0.2.103", lease2->addr_.toText());
+    EXPECT_TRUE(bitmap->isSeeded());
+    EXPECT_EQ(bitmap->getCapacity() - 4, bitmap->getFreeCount());
+}
+
 // This test checks if really small pools are working
 TEST_F(AllocEngine4Test, smallPool4) {
     boost::scoped_ptr<AllocEngine> engine;
@@ -48,9 +48,11 @@ TEST(ClientContext6Test, addAllocatedResource) {
 TEST_F(AllocEngine6Test, constructor) {
     boost::scoped_ptr<AllocEngine> x;
 
-    // Hashed and random allocators are not supported yet
-    ASSERT_THROW(x.reset(new AllocEngine(AllocEngine::ALLOC_HASHED, 5)), NotImplemented);
-    ASSERT_THROW(x.reset(new AllocEngine(AllocEngine::ALLOC_RANDOM, 5)), NotImplemented);
+    // Hashed and random allocators are supported for all lease types.
+    ASSERT_NO_THROW(x.reset(new AllocEngine(AllocEngine::ALLOC_HASHED, 5)));
+    EXPECT_TRUE(x->getAllocator(Lease::TYPE_PD));
+    ASSERT_NO_THROW(x.reset(new AllocEngine(AllocEngine::ALLOC_RANDOM, 5)));
+    EXPECT_TRUE(x->getAllocator(Lease::TYPE_PD));
 
     ASSERT_NO_THROW(x.reset(new AllocEngine(AllocEngine::ALLOC_ITERATIVE, 100, true)));
 
@@ -194,6 +196,102 @@ TEST_F(AllocEngine6Test, IterativeAllocator) {
     }
 }
 
+// This test verifies that the random allocator picks each address in
+// the pools once before it starts picking the same addresses again.
+TEST_F(AllocEngine6Test, RandomAllocator) {
+    NakedAllocEngine::RandomAllocator alloc(Lease::TYPE_NA);
+
+    subnet_->delPools(Lease::TYPE_NA);
+    subnet_->addPool(Pool6Ptr(new Pool6(Lease::TYPE_NA, IOAddress("2001:db8:1::1"),
+                                        IOAddress("2001:db8:1::5"))));
+    subnet_->addPool(Pool6Ptr(new Pool6(Lease::TYPE_NA, IOAddress("2001:db8:1::100"),
+                                        IOAddress("2001:db8:1::100"))));
+    subnet_->addPool(Pool6Ptr(new Pool6(Lease::TYPE_NA, IOAddress("2001:db8:1::105"),
+                                        IOAddress("2001:db8:1::106"))));
+
+    // Two full cycles.
+    for (int cycle = 0; cycle < 2; ++cycle) {
+        std::set<IOAddress> generated_addrs;
+        for (int i = 0; i < 8; ++i) {
+            IOAddress candidate = alloc.pickAddress(subnet_, duid_, IOAddress("::"));
+            EXPECT_TRUE(subnet_->inPool(Lease::TYPE_NA, candidate));
+            EXPECT_TRUE(generated_addrs.insert(candidate).second)
+                << "address " << candidate << " picked twice";
+        }
+    }
+}
+
+// This test verifies that the random allocator picks prefixes which
+// belong to the pools.
+TEST_F(AllocEngine6Test, RandomAllocatorPrefix) {
+    NakedAllocEngine::RandomAllocator alloc(Lease::TYPE_PD);
+
+    subnet_.reset(new Subnet6(IOAddress("2001:db8::"), 32, 1, 2, 3, 4));
+    subnet_->addPool(Pool6Ptr(new Pool6(Lease::TYPE_PD, IOAddress("2001:db8::"), 56, 60)));
+    subnet_->addPool(Pool6Ptr(new Pool6(Lease::TYPE_PD, IOAddress("2001:db8:1::"), 48, 48)));
+
+    // 16 prefixes in the first pool and one in the second.
+    std::set<IOAddress> generated_prefixes;
+    for (int i = 0; i < 17; ++i) {
+        IOAddress candidate = alloc.pickAddress(subnet_, duid_, IOAddress("::"));
+        EXPECT_TRUE(subnet_->inPool(Lease::TYPE_PD, candidate));
+        EXPECT_TRUE(generated_prefixes.insert(candidate).second)
+            << "prefix " << candidate << " picked twice";
+    }
+    EXPECT_EQ(1, generated_prefixes.count(IOAddress("2001:db8:1::")));
+}
+
+// This test verifies that the hashed allocator returns the same address
+// for the same client and that subsequent attempts visit all addresses.
+TEST_F(AllocEngine6Test, HashedAllocator) {
+    NakedAllocEngine::HashedAllocator alloc(Lease::TYPE_NA);
+
+    // The default pool has 17 addresses.
+    IOAddress home = alloc.pickAddress(subnet_, duid_, IOAddress("::"));
+    EXPECT_TRUE(subnet_->inPool(Lease::TYPE_NA, home));
+    EXPECT_EQ(home, alloc.pickAddress(subnet_, duid_, IOAddress("::"), 0));
+
+    // A new allocator instance (e.g. after restart) returns the same address.
+    NakedAllocEngine::HashedAllocator alloc2(Lease::TYPE_NA);
+    EXPECT_EQ(home, alloc2.pickAddress(subnet_, duid_, IOAddress("::")));
+
+    std::set<IOAddress> generated_addrs;
+    for (uint64_t attempt = 0; attempt < 17; ++attempt) {
+        IOAddress candidate = alloc.pickAddress(subnet_, duid_, IOAddress("::"),
+                                                attempt);
+        EXPECT_TRUE(subnet_->inPool(Lease::TYPE_NA, candidate));
+        EXPECT_TRUE(generated_addrs.insert(candidate).second)
+            << "address " << candidate << " picked twice";
+    }
+
+    // Wrap around.
+    EXPECT_EQ(home, alloc.pickAddress(subnet_, duid_, IOAddress("::"), 17));
+}
+
+// This test checks that the allocation engine using the hashed allocator
+// assigns the same address to a client after its lease has been removed.
+TEST_F(AllocEngine6Test, hashedAllocatorStableAddress) {
+    boost::scoped_ptr<AllocEngine> engine;
+    ASSERT_NO_THROW(engine.reset(new AllocEngine(AllocEngine::ALLOC_HASHED, 0)));
+
+    Lease6Ptr lease;
+    AllocEngine::ClientContext6 ctx(subnet_, duid_, false, false, "", false,
+                                    Pkt6Ptr(new Pkt6(DHCPV6_REQUEST, 1234)));
+    ctx.currentIA().iaid_ = iaid_;
+    ASSERT_NO_THROW(lease = expectOneLease(engine->allocateLeases6(ctx)));
+    ASSERT_TRUE(lease);
+    IOAddress addr = lease->addr_;
+
+    ASSERT_TRUE(LeaseMgrFactory::instance().deleteLease(addr));
+
+    AllocEngine::ClientContext6 ctx2(subnet_, duid_, false, false, "", false,
+                                     Pkt6Ptr(new Pkt6(DHCPV6_REQUEST, 1235)));
+    ctx2.currentIA().iaid_ = iaid_;
+    ASSERT_NO_THROW(lease = expectOneLease(engine->allocateLeases6(ctx2)));
+    ASSERT_TRUE(lease);
+    EXPECT_EQ(addr, lease->addr_);
+}
+
 TEST_F(AllocEngine6Test, IterativeAllocatorAddrStep) {
     NakedAllocEngine::NakedIterativeAllocator alloc(Lease::TYPE_NA);
 
@@ -531,6 +531,24 @@ public:
         return (0);
     }
 
+    /// @brief Implements "lease{4,6}_expire callout, which deletes the first
+    /// lease it is called for from the lease database.
+    ///
+    /// The update of this lease by the reclamation routine fails, so the
+    /// reclamation of the batch of leases fails too.
+    ///
+    /// @param callout_handle Callout handle.
+    /// @return Zero.
+    static int leaseExpireWithDeleteCallout(CalloutHandle& callout_handle) {
+        if (callouts_.empty()) {
+            LeasePtrType lease;
+            callout_handle.getArgument(callout_argument_name, lease);
+            LeaseMgrFactory::instance().deleteLease(lease->addr_);
+        }
+
+        return (leaseExpireCallout(callout_handle));
+    }
+
     /// @brief Implements "lease{4,6}_expire callout, which lasts at least
     /// 40ms.
     ///
@@ -897,6 +915,47 @@ public:
         EXPECT_TRUE(testLeases(&leaseNotReclaimed, &allLeaseIndexes));
     }
 
+    /// @brief This test verifies that the expired leases are reclaimed one
+    /// by one when the reclamation of the whole batch fails.
+    void testReclaimExpiredLeasesBatchFailure() {
+        for (unsigned int i = 0; i < TEST_LEASES_NUM; ++i) {
+            if (evenLeaseIndex(i)) {
+                expire(i, 1000 - i);
+            }
+        }
+
+        HookLibsCollection libraries; // no libraries at this time
+        HooksManager::loadLibraries(libraries);
+
+        // Install a callout deleting one of the leases being reclaimed.
+        std::ostringstream callout_name;
+        callout_name << callout_argument_name << "_expire";
+        EXPECT_NO_THROW(HooksManager::preCalloutsLibraryHandle().registerCallout(
+                        callout_name.str(), leaseExpireWithDeleteCallout));
+
+        ASSERT_NO_THROW(reclaimExpiredLeases(0, 0, false));
+
+        // Callouts should be executed for leases with even indexes.
+        ASSERT_EQ(TEST_LEASES_NUM / 2, callouts_.size());
+
+        // All leases with even indexes but the deleted one should be
+        // reclaimed.
+        for (unsigned int i = 0; i < TEST_LEASES_NUM; i += 2) {
+            LeasePtrType lease = getLease(i);
+            if (leases_[i]->addr_ == callouts_.front()) {
+                EXPECT_FALSE(lease);
+
+            } else {
+                EXPECT_TRUE(leaseReclaimed(lease))
+                    << "lease " << leases_[i]->addr_ << " not reclaimed";
+            }
+        }
+        EXPECT_TRUE(testLeases(&leaseNotReclaimed, &oddLeaseIndex));
+
+        // The deleted lease should not be counted as reclaimed.
+        EXPECT_TRUE(testStatistics("reclaimed-leases", TEST_LEASES_NUM / 2 - 1));
+    }
+
     /// @brief This test verifies that it is possible to set the timeout for
     /// the execution of the lease reclamation routine.
     void testReclaimExpiredLeasesTimeout(const uint16_t timeout) {
@@ -1539,6 +1598,12 @@ TEST_F(ExpirationAllocEngine6Test, reclaimExpiredLeasesHooksWithSkip) {
     testReclaimExpiredLeasesHooksWithSkip();
 }
 
+// This test verifies that the expired leases are reclaimed one by one
+// when the reclamation of the batch fails.
+TEST_F(ExpirationAllocEngine6Test, reclaimExpiredLeasesBatchFailure) {
+    testReclaimExpiredLeasesBatchFailure();
+}
+
 // This test verifies that it is possible to set the timeout for the
 // execution of the lease reclamation routine.
 TEST_F(ExpirationAllocEngine6Test, reclaimExpiredLeasesTimeout) {
@@ -2203,6 +2268,12 @@ TEST_F(ExpirationAllocEngine4Test, reclaimExpiredLeasesHooksWithSkip) {
     testReclaimExpiredLeasesHooksWithSkip();
 }
 
+// This test verifies that the expired leases are reclaimed one by one
+// when the reclamation of the batch fails.
+TEST_F(ExpirationAllocEngine4Test, reclaimExpiredLeasesBatchFailure) {
+    testReclaimExpiredLeasesBatchFailure();
+}
+
 // This test verifies that it is possible to set the timeout for the
 // execution of the lease reclamation routine.
 TEST_F(ExpirationAllocEngine4Test, reclaimExpiredLeasesTimeout) {
@@ -0,0 +1,237 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <asiolink/io_address.h>
+#include <dhcp/duid.h>
+#include <dhcpsrv/binary_lease_file.h>
+#include <dhcpsrv/lease.h>
+#include <dhcpsrv/tests/lease_file_io.h>
+#include <util/csv_file.h>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+using namespace isc::dhcp::test;
+using namespace isc::util;
+
+namespace {
+
+// Values used by unit tests.
+const uint8_t HWADDR0[] = { 0, 1, 2, 3, 4, 5 };
+const uint8_t CLIENTID0[] = { 1, 2, 3, 4 };
+const uint8_t DUID0[] = { 0, 1, 2, 3, 4, 5, 6, 0xa, 0xb, 0xc, 0xd, 0xe, 0xf };
+
+/// @brief Test fixture class for the binary lease files.
+class BinaryLeaseFileTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Removes the test file.
+    BinaryLeaseFileTest()
+        : filename_(absolutePath("leases.bin")), io_(filename_) {
+    }
+
+    /// @brief Returns the absolute path to the file in the test directory.
+    ///
+    /// @param filename Name of the file.
+    static std::string absolutePath(const std::string& filename) {
+        std::ostringstream s;
+        s << TEST_DATA_BUILDDIR << "/" << filename;
+        return (s.str());
+    }
+
+    /// @brief Creates the DHCPv4 lease used by the tests.
+    ///
+    /// @param address Address of the lease.
+    Lease4Ptr createLease4(const std::string& address) const {
+        HWAddrPtr hwaddr(new HWAddr(HWADDR0, sizeof(HWADDR0), HTYPE_ETHER));
+        Lease4Ptr lease(new Lease4(IOAddress(address), hwaddr, CLIENTID0,
+                                   sizeof(CLIENTID0), 200, 0, 0, 1500000000,
+                                   8, true, false, "host.example.org"));
+        lease->state_ = Lease::STATE_EXPIRED_RECLAIMED;
+        return (lease);
+    }
+
+    /// @brief Creates the DHCPv6 lease used by the tests.
+    ///
+    /// @param address Address of the lease.
+    Lease6Ptr createLease6(const std::string& address) const {
+        Lease6Ptr lease(new Lease6(Lease::TYPE_PD, IOAddress(address),
+                                   DuidPtr(new DUID(DUID0, sizeof(DUID0))),
+                                   7, 150, 300, 0, 0, 6, HWAddrPtr(), 56));
+        lease->cltt_ = 1500000000;
+        lease->fqdn_rev_ = true;
+        lease->hostname_ = "host.example.org";
+        return (lease);
+    }
+
+    /// @brief Name of the test file.
+    std::string filename_;
+
+    /// @brief Object providing access to the test file.
+    LeaseFileIO io_;
+};
+
+// Checks that the DHCPv4 leases are written and read back.
+TEST_F(BinaryLeaseFileTest, writeRead4) {
+    BinaryLeaseFile4 lease_file(filename_);
+    ASSERT_NO_THROW(lease_file.recreate());
+
+    Lease4Ptr lease1 = createLease4("192.0.2.1");
+    // Lease without client identifier and hostname.
+    Lease4Ptr lease2 = createLease4("192.0.2.2");
+    lease2->client_id_.reset();
+    lease2->hostname_.clear();
+    // Declined lease has no hardware address.
+    Lease4Ptr lease3 = createLease4("192.0.2.3");
+    lease3->hwaddr_.reset(new HWAddr());
+    lease3->state_ = Lease::STATE_DECLINED;
+
+    ASSERT_NO_THROW(lease_file.append(*lease1));
+    ASSERT_NO_THROW(lease_file.append(*lease2));
+    ASSERT_NO_THROW(lease_file.append(*lease3));
+    // The lease must have the hardware address.
+    Lease4Ptr lease4 = createLease4("192.0.2.4");
+    lease4->hwaddr_.reset();
+    EXPECT_THROW(lease_file.append(*lease4), BadValue);
+    EXPECT_EQ(4, lease_file.getWrites());
+    EXPECT_EQ(3, lease_file.getWriteLeases());
+    EXPECT_EQ(1, lease_file.getWriteErrs());
+    lease_file.close();
+
+    EXPECT_TRUE(BinaryLeaseFile::isBinary(filename_));
+
+    ASSERT_NO_THROW(lease_file.open());
+    Lease4Ptr lease;
+    ASSERT_TRUE(lease_file.next(lease));
+    ASSERT_TRUE(lease);
+    EXPECT_TRUE(*lease == *lease1);
+
+    ASSERT_TRUE(lease_file.next(lease));
+    ASSERT_TRUE(lease);
+    EXPECT_TRUE(*lease == *lease2);
+
+    ASSERT_TRUE(lease_file.next(lease));
+    ASSERT_TRUE(lease);
+    EXPECT_FALSE(lease->hwaddr_);
+    EXPECT_EQ(Lease::STATE_DECLINED, lease->state_);
+
+    ASSERT_TRUE(lease_file.next(lease));
+    EXPECT_FALSE(lease);
+    EXPECT_EQ(4, lease_file.getReads());
+    EXPECT_EQ(3, lease_file.getReadLeases());
+    EXPECT_EQ(0, lease_file.getReadErrs());
+}
+
+// Checks that the DHCPv6 leases are written and read back.
+TEST_F(BinaryLeaseFileTest, writeRead6) {
+    BinaryLeaseFile6 lease_file(filename_);
+    ASSERT_NO_THROW(lease_file.recreate());
+
+    Lease6Ptr lease1 = createLease6("2001:db8:1::");
+    Lease6Ptr lease2 = createLease6("2001:db8::1");
+    lease2->type_ = Lease::TYPE_NA;
+    lease2->prefixlen_ = 128;
+    lease2->hwaddr_.reset(new HWAddr(HWADDR0, sizeof(HWADDR0),
+                                     HTYPE_ETHER));
+
+    ASSERT_NO_THROW(lease_file.append(*lease1));
+    ASSERT_NO_THROW(lease_file.append(*lease2));
+    lease_file.close();
+
+    ASSERT_NO_THROW(lease_file.open());
+    Lease6Ptr lease;
+    ASSERT_TRUE(lease_file.next(lease));
+    ASSERT_TRUE(lease);
+    EXPECT_TRUE(*lease == *lease1);
+
+    ASSERT_TRUE(lease_file.next(lease));
+    ASSERT_TRUE(lease);
+    EXPECT_TRUE(*lease == *lease2);
+
+    ASSERT_TRUE(lease_file.next(lease));
+    EXPECT_FALSE(lease);
+}
+
+// Checks that the file is recognized as binary and that the file with the
+// invalid header is rejected.
+TEST_F(BinaryLeaseFileTest, header) {
+    // Non existing file.
+    EXPECT_FALSE(BinaryLeaseFile::isBinary(filename_));
+    BinaryLeaseFile4 lease_file(filename_);
+    EXPECT_FALSE(lease_file.exists());
+    EXPECT_THROW(lease_file.open(), CSVFileError);
+
+    // CSV file.
+    io_.writeFile("address,hwaddr,client_id,valid_lifetime,expire,"
+                  "subnet_id,fqdn_fwd,fqdn_rev,hostname,state\n");
+    EXPECT_FALSE(BinaryLeaseFile::isBinary(filename_));
+    EXPECT_THROW(lease_file.open(), CSVFileError);
+
+    // File holding leases of the other universe.
+    ASSERT_NO_THROW(lease_file.recreate());
+    lease_file.close();
+    EXPECT_TRUE(BinaryLeaseFile::isBinary(filename_));
+    EXPECT_EQ("1.0", lease_file.getSchemaVersion());
+    BinaryLeaseFile6 lease_file6(filename_);
+    EXPECT_THROW(lease_file6.open(), CSVFileError);
+
+    // Corrupted header.
+    std::string contents = io_.readFile();
+    ASSERT_EQ(16, contents.size());
+    contents[9] = 5;
+    io_.writeFile(contents);
+    EXPECT_THROW(lease_file.open(), CSVFileError);
+}
+
+// Checks that the record with the invalid checksum is skipped and the
+// truncated record ends reading the file.
+TEST_F(BinaryLeaseFileTest, corruptedRecords) {
+    BinaryLeaseFile4 lease_file(filename_);
+    ASSERT_NO_THROW(lease_file.recreate());
+    ASSERT_NO_THROW(lease_file.append(*createLease4("192.0.2.1")));
+    lease_file.close();
+    const size_t first_end = io_.readFile().size();
+
+    ASSERT_NO_THROW(lease_file.recreate());
+    ASSERT_NO_THROW(lease_file.append(*createLease4("192.0.2.1")));
+    ASSERT_NO_THROW(lease_file.append(*createLease4("192.0.2.2")));
+    ASSERT_NO_THROW(lease_file.append(*createLease4("192.0.2.3")));
+    lease_file.close();
+
+    // Modify the address of the second lease.
+    std::string contents = io_.readFile();
+    contents[first_end + 7] ^= 0x01;
+    // Remove the last byte of the third lease.
+    contents.resize(contents.size() - 1);
+    io_.writeFile(contents);
+
+    ASSERT_NO_THROW(lease_file.open());
+    Lease4Ptr lease;
+    ASSERT_TRUE(lease_file.next(lease));
+    ASSERT_TRUE(lease);
+    EXPECT_EQ("192.0.2.1", lease->addr_.toText());
+
+    EXPECT_FALSE(lease_file.next(lease));
+    EXPECT_FALSE(lease);
+    EXPECT_EQ("invalid checksum of the lease record", lease_file.getReadMsg());
+
+    EXPECT_FALSE(lease_file.next(lease));
+    EXPECT_EQ("truncated lease record", lease_file.getReadMsg());
+
+    // Nothing more can be read.
+    ASSERT_TRUE(lease_file.next(lease));
+    EXPECT_FALSE(lease);
+    EXPECT_EQ(1, lease_file.getReadLeases());
+    EXPECT_EQ(2, lease_file.getReadErrs());
+}
+
+} // end of anonymous namespace
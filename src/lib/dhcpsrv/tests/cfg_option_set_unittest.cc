@@ -0,0 +1,146 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/option.h>
+#include <dhcp/option_space.h>
+#include <dhcpsrv/cfg_option_set.h>
+#include <dhcpsrv/srv_config.h>
+#include <gtest/gtest.h>
+
+using namespace isc;
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief Test fixture class for @c CfgOptionSet and @c CfgOptionSetCache.
+class CfgOptionSetTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Creates the subnet and global option configurations:
+    /// - subnet: option 3 (persistent) and option 6,
+    /// - global: option 3, option 15 and option 42 (persistent),
+    /// and the list holding them by decreasing priority.
+    CfgOptionSetTest()
+        : subnet_(new CfgOption()), global_(new CfgOption()) {
+        subnet_->add(createOption(DHO_ROUTERS, 1), true, DHCP4_OPTION_SPACE);
+        subnet_->add(createOption(DHO_DOMAIN_NAME_SERVERS, 1), false,
+                     DHCP4_OPTION_SPACE);
+        global_->add(createOption(DHO_ROUTERS, 2), false, DHCP4_OPTION_SPACE);
+        global_->add(createOption(DHO_DOMAIN_NAME, 2), false,
+                     DHCP4_OPTION_SPACE);
+        global_->add(createOption(DHO_NTP_SERVERS, 2), true,
+                     DHCP4_OPTION_SPACE);
+        co_list_.push_back(subnet_);
+        co_list_.push_back(global_);
+    }
+
+    /// @brief Creates an option.
+    ///
+    /// @param code option code
+    /// @param value value of the single byte of data, identifying the
+    /// configuration the option belongs to
+    OptionPtr createOption(const uint16_t code, const uint8_t value) {
+        return (OptionPtr(new Option(Option::V4, code,
+                                     OptionBuffer(1, value))));
+    }
+
+    /// @brief Returns the value identifying the configuration of an option.
+    ///
+    /// @param option the option
+    uint8_t getValue(const OptionPtr& option) {
+        return (option->getData()[0]);
+    }
+
+    /// @brief Subnet options.
+    CfgOptionPtr subnet_;
+
+    /// @brief Global options.
+    CfgOptionPtr global_;
+
+    /// @brief List of the option configurations.
+    CfgOptionList co_list_;
+};
+
+// This test verifies that the options configured with the highest priority
+// are returned.
+TEST_F(CfgOptionSetTest, get) {
+    CfgOptionSet set(co_list_, DHCP4_OPTION_SPACE);
+
+    OptionPtr option = set.get(DHO_ROUTERS);
+    ASSERT_TRUE(option);
+    EXPECT_EQ(1, getValue(option));
+
+    option = set.get(DHO_DOMAIN_NAME_SERVERS);
+    ASSERT_TRUE(option);
+    EXPECT_EQ(1, getValue(option));
+
+    option = set.get(DHO_DOMAIN_NAME);
+    ASSERT_TRUE(option);
+    EXPECT_EQ(2, getValue(option));
+
+    EXPECT_FALSE(set.get(DHO_HOST_NAME));
+
+    // Other option spaces are ignored.
+    CfgOptionSet empty(co_list_, "isc");
+    EXPECT_FALSE(empty.get(DHO_ROUTERS));
+    EXPECT_TRUE(empty.getPersistentCodes().empty());
+}
+
+// This test verifies that the codes of the persistent options of all
+// configurations are returned.
+TEST_F(CfgOptionSetTest, persistentCodes) {
+    // The routers option is persistent in the global configuration too.
+    global_->add(createOption(DHO_ROUTERS, 3), true, DHCP4_OPTION_SPACE);
+    CfgOptionSet set(co_list_, DHCP4_OPTION_SPACE);
+
+    const std::vector<uint16_t>& codes = set.getPersistentCodes();
+    ASSERT_EQ(2, codes.size());
+    EXPECT_EQ(DHO_ROUTERS, codes[0]);
+    EXPECT_EQ(DHO_NTP_SERVERS, codes[1]);
+}
+
+// This test verifies that the cache returns the same set for the same
+// configurations and option space.
+TEST_F(CfgOptionSetTest, cache) {
+    CfgOptionSetCache cache;
+    ConstCfgOptionSetPtr set = cache.get(co_list_, DHCP4_OPTION_SPACE);
+    ASSERT_TRUE(set);
+    EXPECT_EQ(1, cache.size());
+    EXPECT_EQ(set, cache.get(co_list_, DHCP4_OPTION_SPACE));
+    EXPECT_EQ(1, cache.size());
+
+    // Another option space.
+    EXPECT_NE(set, cache.get(co_list_, "isc"));
+
+    // Other configurations.
+    CfgOptionList global_only;
+    global_only.push_back(global_);
+    ConstCfgOptionSetPtr global_set = cache.get(global_only,
+                                                DHCP4_OPTION_SPACE);
+    EXPECT_NE(set, global_set);
+    ASSERT_TRUE(global_set->get(DHO_ROUTERS));
+    EXPECT_EQ(2, getValue(global_set->get(DHO_ROUTERS)));
+    EXPECT_EQ(3, cache.size());
+
+    cache.clear();
+    EXPECT_EQ(0, cache.size());
+    EXPECT_NE(set, cache.get(co_list_, DHCP4_OPTION_SPACE));
+}
+
+// This test verifies that each server configuration has its own cache.
+TEST_F(CfgOptionSetTest, srvConfig) {
+    SrvConfig config1;
+    SrvConfig config2;
+    ASSERT_TRUE(config1.getCfgOptionSetCache());
+    ASSERT_TRUE(config2.getCfgOptionSetCache());
+    EXPECT_NE(config1.getCfgOptionSetCache(), config2.getCfgOptionSetCache());
+}
+
+} // end of anonymous namespace
@@ -727,6 +727,167 @@ TEST(CfgSubnets4Test, 4o6subnetMatchByInterfaceName) {
     EXPECT_EQ(subnet2, cfg.selectSubnet4o6(selector));
 }
 
+// This test verifies that the subnets are selected using the selection
+// indexes in the same way as without them.
+TEST(CfgSubnets4Test, selectSubnetIndexed) {
+    CfgSubnets4 cfg;
+
+    // The second subnet overlaps with the first one and the third subnet
+    // overlaps with both.
+    Subnet4Ptr subnet1(new Subnet4(IOAddress("192.0.2.0"), 26, 1, 2, 3));
+    Subnet4Ptr subnet2(new Subnet4(IOAddress("192.0.2.0"), 24, 1, 2, 3));
+    Subnet4Ptr subnet3(new Subnet4(IOAddress("192.0.2.0"), 28, 1, 2, 3));
+    Subnet4Ptr subnet4(new Subnet4(IOAddress("10.0.0.0"), 8, 1, 2, 3));
+
+    // The first subnet is only available for the "foo" class.
+    subnet1->allowClientClass("foo");
+    subnet1->setIface("eth0");
+    subnet2->setIface("eth0");
+    subnet3->setIface("eth1");
+    subnet1->setRelayInfo(IOAddress("10.1.1.1"));
+    subnet3->setRelayInfo(IOAddress("10.1.1.1"));
+
+    // The relay information specified on the shared network level is used
+    // for the fourth subnet.
+    SharedNetwork4Ptr network(new SharedNetwork4("network"));
+    network->add(subnet4);
+    network->setRelayInfo(IOAddress("10.2.2.2"));
+
+    cfg.add(subnet1);
+    cfg.add(subnet2);
+    cfg.add(subnet3);
+    cfg.add(subnet4);
+    EXPECT_FALSE(cfg.hasSelectionIndexes());
+
+    for (int indexed = 0; indexed < 2; ++indexed) {
+        SCOPED_TRACE(indexed ? "indexed" : "not indexed");
+        if (indexed) {
+            ASSERT_NO_THROW(cfg.buildSelectionIndexes());
+            ASSERT_TRUE(cfg.hasSelectionIndexes());
+        }
+
+        ClientClasses classes;
+        SubnetSelector selector;
+        selector.client_classes_ = classes;
+
+        // By address. The first configured subnet wins, regardless of the
+        // prefix length.
+        selector.ciaddr_ = IOAddress("192.0.2.1");
+        EXPECT_EQ(subnet2, cfg.selectSubnet(selector));
+        selector.ciaddr_ = IOAddress("192.0.2.200");
+        EXPECT_EQ(subnet2, cfg.selectSubnet(selector));
+        selector.ciaddr_ = IOAddress("10.20.30.40");
+        EXPECT_EQ(subnet4, cfg.selectSubnet(selector));
+        selector.ciaddr_ = IOAddress("192.0.3.1");
+        EXPECT_FALSE(cfg.selectSubnet(selector));
+
+        EXPECT_EQ(subnet2, cfg.selectSubnet(IOAddress("192.0.2.1"), classes));
+        EXPECT_FALSE(cfg.selectSubnet(IOAddress("172.16.1.1"), classes));
+
+        // By interface.
+        EXPECT_EQ(subnet2, cfg.selectSubnet("eth0", classes));
+        EXPECT_EQ(subnet3, cfg.selectSubnet("eth1", classes));
+        EXPECT_FALSE(cfg.selectSubnet("eth2", classes));
+
+        // By relay address, including the one set for the shared network.
+        selector.ciaddr_ = IOAddress("0.0.0.0");
+        selector.giaddr_ = IOAddress("10.1.1.1");
+        EXPECT_EQ(subnet3, cfg.selectSubnet(selector));
+        selector.giaddr_ = IOAddress("10.2.2.2");
+        EXPECT_EQ(subnet4, cfg.selectSubnet(selector));
+        selector.giaddr_ = IOAddress("172.16.1.1");
+        EXPECT_FALSE(cfg.selectSubnet(selector));
+
+        // The client belonging to the "foo" class may use the first subnet.
+        classes.insert("foo");
+        selector.client_classes_ = classes;
+        selector.giaddr_ = IOAddress("10.1.1.1");
+        EXPECT_EQ(subnet1, cfg.selectSubnet(selector));
+        selector.giaddr_ = IOAddress("0.0.0.0");
+        selector.ciaddr_ = IOAddress("192.0.2.1");
+        EXPECT_EQ(subnet1, cfg.selectSubnet(selector));
+        EXPECT_EQ(subnet1, cfg.selectSubnet("eth0", classes));
+    }
+}
+
+// This test verifies that adding or removing a subnet invalidates the
+// selection indexes.
+TEST(CfgSubnets4Test, selectSubnetIndexInvalidated) {
+    CfgSubnets4 cfg;
+
+    Subnet4Ptr subnet1(new Subnet4(IOAddress("192.0.2.0"), 26, 1, 2, 3));
+    Subnet4Ptr subnet2(new Subnet4(IOAddress("192.0.2.64"), 26, 1, 2, 3));
+    cfg.add(subnet1);
+    cfg.buildSelectionIndexes();
+    ASSERT_TRUE(cfg.hasSelectionIndexes());
+
+    // The new subnet is selected after it has been added.
+    cfg.add(subnet2);
+    EXPECT_FALSE(cfg.hasSelectionIndexes());
+    EXPECT_EQ(subnet2, cfg.selectSubnet(IOAddress("192.0.2.65")));
+
+    cfg.buildSelectionIndexes();
+    ASSERT_TRUE(cfg.hasSelectionIndexes());
+    EXPECT_EQ(subnet2, cfg.selectSubnet(IOAddress("192.0.2.65")));
+
+    // The removed subnet is no longer selected.
+    cfg.del(subnet2);
+    EXPECT_FALSE(cfg.hasSelectionIndexes());
+    EXPECT_FALSE(cfg.selectSubnet(IOAddress("192.0.2.65")));
+}
+
+// This test verifies that the DHCPv4o6 subnets are selected using the
+// selection indexes in the same way as without them.
+TEST(CfgSubnets4Test, 4o6subnetMatchIndexed) {
+    CfgSubnets4 cfg;
+
+    Subnet4Ptr subnet1(new Subnet4(IOAddress("192.0.2.0"), 26, 1, 2, 3, 123));
+    Subnet4Ptr subnet2(new Subnet4(IOAddress("192.0.2.64"), 26, 1, 2, 3, 124));
+    Subnet4Ptr subnet3(new Subnet4(IOAddress("192.0.2.128"), 26, 1, 2, 3, 125));
+
+    const uint8_t payload[] = { 1, 2, 3, 4 };
+    OptionPtr interface_id(new Option(Option::V6, D6O_INTERFACE_ID,
+                                      OptionBuffer(payload, payload +
+                                                   sizeof(payload))));
+
+    subnet2->get4o6().setSubnet4o6(IOAddress("2001:db8:1::"), 48);
+    subnet3->get4o6().setSubnet4o6(IOAddress("2001:db8::"), 32);
+    subnet3->get4o6().setInterfaceId(interface_id);
+    subnet3->get4o6().setIface4o6("eth7");
+
+    cfg.add(subnet1);
+    cfg.add(subnet2);
+    cfg.add(subnet3);
+
+    for (int indexed = 0; indexed < 2; ++indexed) {
+        SCOPED_TRACE(indexed ? "indexed" : "not indexed");
+        if (indexed) {
+            ASSERT_NO_THROW(cfg.buildSelectionIndexes());
+        }
+
+        SubnetSelector selector;
+        selector.dhcp4o6_ = true;
+        selector.remote_address_ = IOAddress("2001:db8:1::dead:beef");
+        EXPECT_EQ(subnet2, cfg.selectSubnet4o6(selector));
+        selector.remote_address_ = IOAddress("2001:db8:2::dead:beef");
+        EXPECT_EQ(subnet3, cfg.selectSubnet4o6(selector));
+        selector.remote_address_ = IOAddress("2001:db9::1");
+        EXPECT_FALSE(cfg.selectSubnet4o6(selector));
+
+        // The interface id matches the third subnet, but the address
+        // matches the second one, which is configured first.
+        selector.remote_address_ = IOAddress("2001:db8:1::dead:beef");
+        selector.interface_id_ = interface_id;
+        EXPECT_EQ(subnet2, cfg.selectSubnet4o6(selector));
+        selector.remote_address_ = IOAddress("2001:db9::1");
+        EXPECT_EQ(subnet3, cfg.selectSubnet4o6(selector));
+
+        selector.interface_id_.reset();
+        selector.iface_name_ = "eth7";
+        EXPECT_EQ(subnet3, cfg.selectSubnet4o6(selector));
+    }
+}
+
 // This test check if IPv4 subnets can be unparsed in a predictable way,
 TEST(CfgSubnets4Test, unparseSubnet) {
     CfgSubnets4 cfg;
@@ -405,6 +405,114 @@ TEST(CfgSubnets6Test, selectSubnetByInterfaceIdAndClassify) {
     EXPECT_FALSE(cfg.selectSubnet(selector));
 }
 
+// This test verifies that the subnets are selected using the selection
+// indexes in the same way as without them.
+TEST(CfgSubnets6Test, selectSubnetIndexed) {
+    CfgSubnets6 cfg;
+
+    // The second subnet overlaps with the first one.
+    Subnet6Ptr subnet1(new Subnet6(IOAddress("2001:db8:1::"), 64, 1, 2, 3, 4));
+    Subnet6Ptr subnet2(new Subnet6(IOAddress("2001:db8::"), 32, 1, 2, 3, 4));
+    Subnet6Ptr subnet3(new Subnet6(IOAddress("3000::"), 48, 1, 2, 3, 4));
+
+    // The first subnet is only available for the "foo" class.
+    subnet1->allowClientClass("foo");
+    subnet1->setIface("eth0");
+    subnet2->setIface("eth0");
+    subnet3->setIface("eth1");
+    subnet1->setRelayInfo(IOAddress("2001:db8:ff::1"));
+    subnet3->setRelayInfo(IOAddress("2001:db8:ff::1"));
+    OptionPtr interface_id = generateInterfaceId("relay1");
+    subnet1->setInterfaceId(interface_id);
+    subnet3->setInterfaceId(interface_id);
+
+    cfg.add(subnet1);
+    cfg.add(subnet2);
+    cfg.add(subnet3);
+    EXPECT_FALSE(cfg.hasSelectionIndexes());
+
+    for (int indexed = 0; indexed < 2; ++indexed) {
+        SCOPED_TRACE(indexed ? "indexed" : "not indexed");
+        if (indexed) {
+            ASSERT_NO_THROW(cfg.buildSelectionIndexes());
+            ASSERT_TRUE(cfg.hasSelectionIndexes());
+        }
+
+        ClientClasses classes;
+
+        // By address. The first configured subnet wins, regardless of the
+        // prefix length.
+        EXPECT_EQ(subnet2, cfg.selectSubnet(IOAddress("2001:db8:1::1"),
+                                            classes));
+        EXPECT_EQ(subnet2, cfg.selectSubnet(IOAddress("2001:db8:2::1"),
+                                            classes));
+        EXPECT_EQ(subnet3, cfg.selectSubnet(IOAddress("3000::1"), classes));
+        EXPECT_FALSE(cfg.selectSubnet(IOAddress("3000:1::1"), classes));
+
+        // By relay address.
+        EXPECT_EQ(subnet3, cfg.selectSubnet(IOAddress("2001:db8:ff::1"),
+                                            classes, true));
+        EXPECT_FALSE(cfg.selectSubnet(IOAddress("3000:1::1"),
+                                      classes, true));
+
+        // By interface name and interface id.
+        SubnetSelector selector;
+        selector.iface_name_ = "eth0";
+        EXPECT_EQ(subnet2, cfg.selectSubnet(selector));
+        selector.iface_name_ = "eth1";
+        EXPECT_EQ(subnet3, cfg.selectSubnet(selector));
+        selector.iface_name_ = "eth2";
+        EXPECT_FALSE(cfg.selectSubnet(selector));
+
+        selector.iface_name_ = "";
+        selector.first_relay_linkaddr_ = IOAddress("3000:1::1");
+        selector.interface_id_ = interface_id;
+        EXPECT_EQ(subnet3, cfg.selectSubnet(selector));
+        selector.interface_id_ = generateInterfaceId("relay2");
+        EXPECT_FALSE(cfg.selectSubnet(selector));
+
+        // The client belonging to the "foo" class may use the first subnet.
+        classes.insert("foo");
+        EXPECT_EQ(subnet1, cfg.selectSubnet(IOAddress("2001:db8:1::1"),
+                                            classes));
+        EXPECT_EQ(subnet1, cfg.selectSubnet(IOAddress("2001:db8:ff::1"),
+                                            classes, true));
+        selector.client_classes_ = classes;
+        selector.interface_id_ = interface_id;
+        EXPECT_EQ(subnet1, cfg.selectSubnet(selector));
+        selector.first_relay_linkaddr_ = IOAddress("::");
+        selector.interface_id_.reset();
+        selector.iface_name_ = "eth0";
+        EXPECT_EQ(subnet1, cfg.selectSubnet(selector));
+    }
+}
+
+// This test verifies that adding or removing a subnet invalidates the
+// selection indexes.
+TEST(CfgSubnets6Test, selectSubnetIndexInvalidated) {
+    CfgSubnets6 cfg;
+
+    Subnet6Ptr subnet1(new Subnet6(IOAddress("2001:db8:1::"), 64, 1, 2, 3, 4));
+    Subnet6Ptr subnet2(new Subnet6(IOAddress("2001:db8:2::"), 64, 1, 2, 3, 4));
+    cfg.add(subnet1);
+    cfg.buildSelectionIndexes();
+    ASSERT_TRUE(cfg.hasSelectionIndexes());
+
+    // The new subnet is selected after it has been added.
+    cfg.add(subnet2);
+    EXPECT_FALSE(cfg.hasSelectionIndexes());
+    EXPECT_EQ(subnet2, cfg.selectSubnet(IOAddress("2001:db8:2::1")));
+
+    cfg.buildSelectionIndexes();
+    ASSERT_TRUE(cfg.hasSelectionIndexes());
+    EXPECT_EQ(subnet2, cfg.selectSubnet(IOAddress("2001:db8:2::1")));
+
+    // The removed subnet is no longer selected.
+    cfg.del(subnet2);
+    EXPECT_FALSE(cfg.hasSelectionIndexes());
+    EXPECT_FALSE(cfg.selectSubnet(IOAddress("2001:db8:2::1")));
+}
+
 // Checks that detection of duplicated subnet IDs works as expected. It should
 // not be possible to add two IPv6 subnets holding the same ID.
 TEST(CfgSubnets6Test, duplication) {
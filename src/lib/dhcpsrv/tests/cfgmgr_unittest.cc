@@ -673,6 +673,248 @@ TEST_F(CfgMgrTest, clearStats6) {
     EXPECT_FALSE(stats_mgr.getObservation("subnet[123].assigned-pds"));
 }
 
+// This test verifies that the lease statistics of the subnets which haven't
+// changed are kept when the new configuration is committed, while the
+// statistics of the modified subnets are recounted.
+TEST_F(CfgMgrTest, commitStatsUnchangedSubnets4) {
+    CfgMgr& cfg_mgr = CfgMgr::instance();
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    startBackend(AF_INET);
+
+    // Prepare the "old" configuration with three subnets.
+    CfgSubnets4Ptr subnets = cfg_mgr.getStagingCfg()->getCfgSubnets4();
+    for (SubnetID id = 1; id <= 3; ++id) {
+        std::ostringstream prefix;
+        prefix << "192.0." << id << ".0";
+        Subnet4Ptr subnet(new Subnet4(IOAddress(prefix.str()), 24, 1, 2, 3, id));
+        subnet->addPool(PoolPtr(new Pool4(IOAddress(prefix.str()), 25)));
+        subnets->add(subnet);
+    }
+    cfg_mgr.commit();
+
+    // Add a lease to each of the first two subnets and pretend that the
+    // server has counted a different number of leases, so as we can tell
+    // which subnets have been recounted.
+    HWAddrPtr hwaddr(new HWAddr(HWAddr::fromText("00:01:02:03:04:05")));
+    for (SubnetID id = 1; id <= 2; ++id) {
+        std::ostringstream address;
+        address << "192.0." << id << ".10";
+        Lease4Ptr lease(new Lease4(IOAddress(address.str()), hwaddr, 0, 0,
+                                   3600, 1200, 2400, time(NULL), id));
+        ASSERT_TRUE(LeaseMgrFactory::instance().addLease(lease));
+        stats_mgr.setValue(StatsMgr::generateName("subnet", id,
+                                                  "assigned-addresses"),
+                           static_cast<int64_t>(5));
+    }
+
+    // The new configuration contains the first subnet unchanged, the
+    // second subnet with a smaller pool and no third subnet.
+    subnets = cfg_mgr.getStagingCfg()->getCfgSubnets4();
+    Subnet4Ptr subnet(new Subnet4(IOAddress("192.0.1.0"), 24, 1, 2, 3, 1));
+    subnet->addPool(PoolPtr(new Pool4(IOAddress("192.0.1.0"), 25)));
+    subnets->add(subnet);
+    subnet.reset(new Subnet4(IOAddress("192.0.2.0"), 24, 1, 2, 3, 2));
+    subnet->addPool(PoolPtr(new Pool4(IOAddress("192.0.2.0"), 26)));
+    subnets->add(subnet);
+    cfg_mgr.commit();
+
+    // The statistics of the unchanged subnet are kept.
+    ObservationPtr assigned = stats_mgr.getObservation("subnet[1].assigned-addresses");
+    ASSERT_TRUE(assigned);
+    EXPECT_EQ(5, assigned->getInteger().first);
+
+    // The modified subnet is recounted.
+    assigned = stats_mgr.getObservation("subnet[2].assigned-addresses");
+    ASSERT_TRUE(assigned);
+    EXPECT_EQ(1, assigned->getInteger().first);
+
+    ObservationPtr total_addrs = stats_mgr.getObservation("subnet[2].total-addresses");
+    ASSERT_TRUE(total_addrs);
+    EXPECT_EQ(64, total_addrs->getInteger().first);
+
+    // The statistics of the removed subnet are gone.
+    EXPECT_FALSE(stats_mgr.getObservation("subnet[3].total-addresses"));
+    EXPECT_FALSE(stats_mgr.getObservation("subnet[3].assigned-addresses"));
+
+    // When the statistics have been removed, the subnet is recounted
+    // even if it hasn't changed.
+    stats_mgr.removeAll();
+    subnets = cfg_mgr.getStagingCfg()->getCfgSubnets4();
+    subnet.reset(new Subnet4(IOAddress("192.0.1.0"), 24, 1, 2, 3, 1));
+    subnet->addPool(PoolPtr(new Pool4(IOAddress("192.0.1.0"), 25)));
+    subnets->add(subnet);
+    cfg_mgr.commit();
+
+    assigned = stats_mgr.getObservation("subnet[1].assigned-addresses");
+    ASSERT_TRUE(assigned);
+    EXPECT_EQ(1, assigned->getInteger().first);
+}
+
+// This test verifies that the lease statistics of the IPv6 subnets which
+// haven't changed are kept when the new configuration is committed, while
+// the statistics of the modified subnets are recounted.
+TEST_F(CfgMgrTest, commitStatsUnchangedSubnets6) {
+    CfgMgr& cfg_mgr = CfgMgr::instance();
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    startBackend(AF_INET6);
+
+    // Prepare the "old" configuration with two subnets.
+    CfgSubnets6Ptr subnets = cfg_mgr.getStagingCfg()->getCfgSubnets6();
+    Subnet6Ptr subnet(new Subnet6(IOAddress("2001:db8:1::"), 64, 1, 2, 3, 4, 1));
+    subnet->addPool(PoolPtr(new Pool6(Lease::TYPE_NA, IOAddress("2001:db8:1::"), 120)));
+    subnets->add(subnet);
+    subnet.reset(new Subnet6(IOAddress("2001:db8:2::"), 64, 1, 2, 3, 4, 2));
+    subnet->addPool(PoolPtr(new Pool6(Lease::TYPE_NA, IOAddress("2001:db8:2::"), 120)));
+    subnets->add(subnet);
+    cfg_mgr.commit();
+
+    // Add a lease to each subnet and pretend that the server has counted
+    // a different number of leases.
+    DuidPtr duid(new DUID(DUID::fromText("01:02:03:04:05:06").getDuid()));
+    for (SubnetID id = 1; id <= 2; ++id) {
+        std::ostringstream address;
+        address << "2001:db8:" << id << "::10";
+        Lease6Ptr lease(new Lease6(Lease::TYPE_NA, IOAddress(address.str()),
+                                   duid, id, 1800, 3600, 900, 1200, id));
+        ASSERT_TRUE(LeaseMgrFactory::instance().addLease(lease));
+        stats_mgr.setValue(StatsMgr::generateName("subnet", id, "assigned-nas"),
+                           static_cast<int64_t>(5));
+    }
+
+    // The new configuration contains the first subnet unchanged and the
+    // second subnet with an additional prefix pool.
+    subnets = cfg_mgr.getStagingCfg()->getCfgSubnets6();
+    subnet.reset(new Subnet6(IOAddress("2001:db8:1::"), 64, 1, 2, 3, 4, 1));
+    subnet->addPool(PoolPtr(new Pool6(Lease::TYPE_NA, IOAddress("2001:db8:1::"), 120)));
+    subnets->add(subnet);
+    subnet.reset(new Subnet6(IOAddress("2001:db8:2::"), 64, 1, 2, 3, 4, 2));
+    subnet->addPool(PoolPtr(new Pool6(Lease::TYPE_NA, IOAddress("2001:db8:2::"), 120)));
+    subnet->addPool(PoolPtr(new Pool6(Lease::TYPE_PD, IOAddress("3000::"), 96, 112)));
+    subnets->add(subnet);
+    cfg_mgr.commit();
+
+    // The statistics of the unchanged subnet are kept.
+    ObservationPtr assigned = stats_mgr.getObservation("subnet[1].assigned-nas");
+    ASSERT_TRUE(assigned);
+    EXPECT_EQ(5, assigned->getInteger().first);
+
+    // The modified subnet is recounted.
+    assigned = stats_mgr.getObservation("subnet[2].assigned-nas");
+    ASSERT_TRUE(assigned);
+    EXPECT_EQ(1, assigned->getInteger().first);
+
+    ObservationPtr total_pds = stats_mgr.getObservation("subnet[2].total-pds");
+    ASSERT_TRUE(total_pds);
+    EXPECT_EQ(65536, total_pds->getInteger().first);
+}
+
+// This test verifies that the declined addresses of a removed IPv4 subnet
+// are subtracted from the global declined-addresses statistic, while the
+// declined addresses of the kept subnets still count.
+TEST_F(CfgMgrTest, commitStatsRemovedSubnetDeclined4) {
+    CfgMgr& cfg_mgr = CfgMgr::instance();
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    startBackend(AF_INET);
+
+    // Add a declined lease to each of the two subnets.
+    HWAddrPtr hwaddr(new HWAddr(HWAddr::fromText("00:01:02:03:04:05")));
+    for (SubnetID id = 1; id <= 2; ++id) {
+        std::ostringstream address;
+        address << "192.0." << id << ".10";
+        Lease4Ptr lease(new Lease4(IOAddress(address.str()), hwaddr, 0, 0,
+                                   3600, 1200, 2400, time(NULL), id));
+        lease->decline(3600);
+        ASSERT_TRUE(LeaseMgrFactory::instance().addLease(lease));
+    }
+
+    // Prepare the "old" configuration with both subnets.
+    CfgSubnets4Ptr subnets = cfg_mgr.getStagingCfg()->getCfgSubnets4();
+    for (SubnetID id = 1; id <= 2; ++id) {
+        std::ostringstream prefix;
+        prefix << "192.0." << id << ".0";
+        Subnet4Ptr subnet(new Subnet4(IOAddress(prefix.str()), 24, 1, 2, 3, id));
+        subnet->addPool(PoolPtr(new Pool4(IOAddress(prefix.str()), 25)));
+        subnets->add(subnet);
+    }
+    cfg_mgr.commit();
+
+    ObservationPtr declined = stats_mgr.getObservation("declined-addresses");
+    ASSERT_TRUE(declined);
+    EXPECT_EQ(2, declined->getInteger().first);
+
+    // The new configuration contains the first subnet unchanged, so it
+    // is not recounted, and no second subnet.
+    subnets = cfg_mgr.getStagingCfg()->getCfgSubnets4();
+    Subnet4Ptr subnet(new Subnet4(IOAddress("192.0.1.0"), 24, 1, 2, 3, 1));
+    subnet->addPool(PoolPtr(new Pool4(IOAddress("192.0.1.0"), 25)));
+    subnets->add(subnet);
+    cfg_mgr.commit();
+
+    EXPECT_FALSE(stats_mgr.getObservation("subnet[2].declined-addresses"));
+
+    declined = stats_mgr.getObservation("subnet[1].declined-addresses");
+    ASSERT_TRUE(declined);
+    EXPECT_EQ(1, declined->getInteger().first);
+
+    // Only the declined address of the kept subnet remains.
+    declined = stats_mgr.getObservation("declined-addresses");
+    ASSERT_TRUE(declined);
+    EXPECT_EQ(1, declined->getInteger().first);
+}
+
+// This test verifies that the declined addresses of a removed IPv6 subnet
+// are subtracted from the global declined-addresses statistic, while the
+// declined addresses of the kept subnets still count.
+TEST_F(CfgMgrTest, commitStatsRemovedSubnetDeclined6) {
+    CfgMgr& cfg_mgr = CfgMgr::instance();
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    startBackend(AF_INET6);
+
+    // Add a declined lease to each of the two subnets.
+    DuidPtr duid(new DUID(DUID::fromText("01:02:03:04:05:06").getDuid()));
+    for (SubnetID id = 1; id <= 2; ++id) {
+        std::ostringstream address;
+        address << "2001:db8:" << id << "::10";
+        Lease6Ptr lease(new Lease6(Lease::TYPE_NA, IOAddress(address.str()),
+                                   duid, id, 1800, 3600, 900, 1200, id));
+        lease->decline(3600);
+        ASSERT_TRUE(LeaseMgrFactory::instance().addLease(lease));
+    }
+
+    // Prepare the "old" configuration with both subnets.
+    CfgSubnets6Ptr subnets = cfg_mgr.getStagingCfg()->getCfgSubnets6();
+    Subnet6Ptr subnet(new Subnet6(IOAddress("2001:db8:1::"), 64, 1, 2, 3, 4, 1));
+    subnet->addPool(PoolPtr(new Pool6(Lease::TYPE_NA, IOAddress("2001:db8:1::"), 120)));
+    subnets->add(subnet);
+    subnet.reset(new Subnet6(IOAddress("2001:db8:2::"), 64, 1, 2, 3, 4, 2));
+    subnet->addPool(PoolPtr(new Pool6(Lease::TYPE_NA, IOAddress("2001:db8:2::"), 120)));
+    subnets->add(subnet);
+    cfg_mgr.commit();
+
+    ObservationPtr declined = stats_mgr.getObservation("declined-addresses");
+    ASSERT_TRUE(declined);
+    EXPECT_EQ(2, declined->getInteger().first);
+
+    // The new configuration contains the first subnet unchanged, so it
+    // is not recounted, and no second subnet.
+    subnets = cfg_mgr.getStagingCfg()->getCfgSubnets6();
+    subnet.reset(new Subnet6(IOAddress("2001:db8:1::"), 64, 1, 2, 3, 4, 1));
+    subnet->addPool(PoolPtr(new Pool6(Lease::TYPE_NA, IOAddress("2001:db8:1::"), 120)));
+    subnets->add(subnet);
+    cfg_mgr.commit();
+
+    EXPECT_FALSE(stats_mgr.getObservation("subnet[2].declined-addresses"));
+
+    declined = stats_mgr.getObservation("subnet[1].declined-addresses");
+    ASSERT_TRUE(declined);
+    EXPECT_EQ(1, declined->getInteger().first);
+
+    // Only the declined address of the kept subnet remains.
+    declined = stats_mgr.getObservation("declined-addresses");
+    ASSERT_TRUE(declined);
+    EXPECT_EQ(1, declined->getInteger().first);
+}
+
 /// @todo Add unit-tests for testing:
 /// - addActiveIface() with invalid interface name
 /// - addActiveIface() with the same interface twice
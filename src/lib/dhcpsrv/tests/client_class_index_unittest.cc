@@ -0,0 +1,157 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/option_string.h>
+#include <dhcp/pkt4.h>
+#include <dhcpsrv/client_class_def.h>
+#include <dhcpsrv/client_class_index.h>
+#include <eval/eval_context.h>
+
+#include <gtest/gtest.h>
+
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief Test fixture class for @c ClientClassIndex.
+class ClientClassIndexTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Creates the packet with the vendor class identifier "foo".
+    ClientClassIndexTest()
+        : pkt_(new Pkt4(DHCPDISCOVER, 1234)) {
+        pkt_->addOption(OptionPtr(new OptionString(Option::V4,
+                                                   DHO_VENDOR_CLASS_IDENTIFIER,
+                                                   "foo")));
+    }
+
+    /// @brief Adds a class to the dictionary.
+    ///
+    /// @param name Name of the class.
+    /// @param test Expression of the class or an empty string.
+    void addClass(const std::string& name, const std::string& test) {
+        ExpressionPtr expr;
+        if (!test.empty()) {
+            EvalContext eval(Option::V4);
+            ASSERT_TRUE(eval.parseString(test)) << test;
+            expr.reset(new Expression(eval.expression));
+        }
+        dictionary_.addClass(name, expr, test, CfgOptionPtr());
+    }
+
+    /// @brief Returns the names of the classes.
+    ///
+    /// @param classes Class definitions.
+    std::string names(const ClientClassDefList& classes) const {
+        std::string result;
+        for (ClientClassDefList::const_iterator it = classes.begin();
+             it != classes.end(); ++it) {
+            result += (result.empty() ? "" : " ") + (*it)->getName();
+        }
+        return (result);
+    }
+
+    /// @brief Dictionary holding the classes.
+    ClientClassDictionary dictionary_;
+
+    /// @brief Packet being classified.
+    Pkt4Ptr pkt_;
+
+    /// @brief Value stack used for the evaluation.
+    ValueStack values_;
+};
+
+// This test verifies that the classes comparing the same value with
+// constants are grouped and the others are evaluated one by one.
+TEST_F(ClientClassIndexTest, groups) {
+    addClass("a", "option[60].text == 'foo'");
+    addClass("b", "option[60].text == 'bar'");
+    addClass("c", "'foo' == option[60].text");
+    addClass("d", "substring(option[60].text,0,2) == 'fo'");
+    addClass("e", "option[60].hex == 'foo'");
+    addClass("f", "option[60].exists");
+    addClass("g", "");
+
+    const ClientClassIndex& index = dictionary_.getIndex();
+    EXPECT_EQ("f", names(index.getOthers()));
+
+    // The text and hex representations are different keys.
+    const ClientClassIndex::GroupMap& groups = index.getGroups();
+    ASSERT_EQ(3, groups.size());
+
+    // Check the classes matching the packet.
+    std::string matches;
+    for (ClientClassIndex::GroupMap::const_iterator group = groups.begin();
+         group != groups.end(); ++group) {
+        std::string group_matches = names(group->second->match(*pkt_, values_));
+        if (group_matches == "a c") {
+            EXPECT_EQ("a b c", names(group->second->getClasses()));
+        }
+        matches += "[" + group_matches + "]";
+    }
+    EXPECT_NE(std::string::npos, matches.find("[a c]"));
+    EXPECT_NE(std::string::npos, matches.find("[d]"));
+    EXPECT_NE(std::string::npos, matches.find("[e]"));
+
+    // No class matches another value.
+    pkt_->delOption(DHO_VENDOR_CLASS_IDENTIFIER);
+    for (ClientClassIndex::GroupMap::const_iterator group = groups.begin();
+         group != groups.end(); ++group) {
+        EXPECT_TRUE(group->second->match(*pkt_, values_).empty());
+    }
+}
+
+// This test verifies that the classes removed from the dictionary are
+// removed from the index.
+TEST_F(ClientClassIndexTest, remove) {
+    addClass("a", "option[60].text == 'foo'");
+    addClass("b", "option[60].text == 'foo'");
+    addClass("c", "substring(option[60].text,0,2) == 'fo'");
+    addClass("d", "option[60].exists");
+
+    const ClientClassIndex& index = dictionary_.getIndex();
+    ASSERT_EQ(2, index.getGroups().size());
+
+    dictionary_.removeClass("a");
+    dictionary_.removeClass("c");
+    dictionary_.removeClass("d");
+    EXPECT_TRUE(index.getOthers().empty());
+    ASSERT_EQ(1, index.getGroups().size());
+    const ClientClassIndex::GroupPtr& group = index.getGroups().begin()->second;
+    EXPECT_EQ("b", names(group->getClasses()));
+    EXPECT_EQ("b", names(group->match(*pkt_, values_)));
+
+    // The copy of the dictionary has its own index.
+    ClientClassDictionary copy(dictionary_);
+    dictionary_.removeClass("b");
+    EXPECT_TRUE(index.getGroups().empty());
+    EXPECT_EQ(1, copy.getIndex().getGroups().size());
+}
+
+// This test verifies that the errors in the evaluation of the key are
+// reported.
+TEST_F(ClientClassIndexTest, error) {
+    // substring(option[60].text,0,'foo') == 'fo'
+    ExpressionPtr expr(new Expression());
+    expr->push_back(TokenPtr(new TokenOption(DHO_VENDOR_CLASS_IDENTIFIER,
+                                             TokenOption::TEXTUAL)));
+    expr->push_back(TokenPtr(new TokenString("0")));
+    expr->push_back(TokenPtr(new TokenString("foo")));
+    expr->push_back(TokenPtr(new TokenSubstring()));
+    expr->push_back(TokenPtr(new TokenString("fo")));
+    expr->push_back(TokenPtr(new TokenEqual()));
+    dictionary_.addClass("a", expr, "", CfgOptionPtr());
+    const ClientClassIndex& index = dictionary_.getIndex();
+    ASSERT_EQ(1, index.getGroups().size());
+    EXPECT_THROW(index.getGroups().begin()->second->match(*pkt_, values_),
+                 EvalTypeError);
+}
+
+} // end of anonymous namespace
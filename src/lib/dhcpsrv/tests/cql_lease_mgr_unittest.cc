@@ -487,6 +487,23 @@ TEST_F(CqlLeaseMgrTest, getLease4ClientIdSubnetId) {
     testGetLease4ClientIdSubnetId();
 }
 
+/// @brief Checks that all IPv4 leases for a subnet can be retrieved.
+TEST_F(CqlLeaseMgrTest, getLeases4SubnetId) {
+    testGetLeases4SubnetId();
+}
+
+/// @brief Checks that all IPv4 leases can be retrieved.
+TEST_F(CqlLeaseMgrTest, getLeases4) {
+    testGetLeases4();
+}
+
+/// @brief Checks that IPv4 leases can be retrieved in pages.
+///
+/// The pages are ordered by the tokens of the addresses.
+TEST_F(CqlLeaseMgrTest, getLeases4Paged) {
+    testGetLeases4Paged(false);
+}
+
 /// @brief Basic Lease4 Checks
 ///
 /// Checks that the addLease, getLease4(by address), getLease4(hwaddr, subnet_id),
@@ -543,6 +560,21 @@ TEST_F(CqlLeaseMgrTest, getLeases6DuidIaid) {
     testGetLeases6DuidIaid();
 }
 
+/// @brief Checks that all IPv6 leases for a subnet can be retrieved.
+TEST_F(CqlLeaseMgrTest, getLeases6SubnetId) {
+    testGetLeases6SubnetId();
+}
+
+/// @brief Checks that all IPv6 leases can be retrieved.
+TEST_F(CqlLeaseMgrTest, getLeases6) {
+    testGetLeases6();
+}
+
+/// @brief Checks that IPv6 leases can be retrieved in pages.
+TEST_F(CqlLeaseMgrTest, getLeases6Paged) {
+    testGetLeases6Paged();
+}
+
 // Check that the system can cope with a DUID of allowed size.
 TEST_F(CqlLeaseMgrTest, getLeases6DuidSize) {
     testGetLeases6DuidSize();
@@ -653,4 +685,34 @@ TEST_F(CqlLeaseMgrTest, DISABLED_wipeLeases6) {
     testWipeLeases6();
 }
 
+// Tests the asynchronous IPv4 lease operations.
+TEST_F(CqlLeaseMgrTest, asyncLeases4) {
+    testAsyncLeases4();
+}
+
+// Tests the reclamation of a batch of IPv4 leases.
+TEST_F(CqlLeaseMgrTest, reclaimLeases4) {
+    testReclaimLeases4();
+}
+
+// Tests adding and updating a batch of IPv4 leases.
+TEST_F(CqlLeaseMgrTest, applyLeases4) {
+    testApplyLeases4();
+}
+
+// Tests the asynchronous IPv6 lease operations.
+TEST_F(CqlLeaseMgrTest, asyncLeases6) {
+    testAsyncLeases6();
+}
+
+// Tests the reclamation of a batch of IPv6 leases.
+TEST_F(CqlLeaseMgrTest, reclaimLeases6) {
+    testReclaimLeases6();
+}
+
+// Tests adding and updating a batch of IPv6 leases.
+TEST_F(CqlLeaseMgrTest, applyLeases6) {
+    testApplyLeases6();
+}
+
 }; // Of anonymous namespace
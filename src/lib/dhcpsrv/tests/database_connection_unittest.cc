@@ -7,6 +7,7 @@
 #include <config.h>
 #include <exceptions/exceptions.h>
 #include <dhcpsrv/database_connection.h>
+#include <boost/bind.hpp>
 #include <gtest/gtest.h>
 
 using namespace isc::dhcp;
@@ -159,3 +160,176 @@ TEST(DatabaseConnectionTest, redactAccessStringNoPassword) {
     EXPECT_EQ("kea", parameters["name"]);
     EXPECT_EQ("mysql", parameters["type"]);
 }
+
+// This test checks that the unsigned integer parameters are returned.
+TEST(DatabaseConnectionTest, getUint32Parameter) {
+    DatabaseConnection::ParameterMap parameters =
+        DatabaseConnection::parse("size=10 negative=-1 large=4294967296 "
+                                  "text=abc");
+    EXPECT_EQ(10, DatabaseConnection::getUint32Parameter(parameters, "size",
+                                                         1));
+    EXPECT_EQ(1, DatabaseConnection::getUint32Parameter(parameters, "other",
+                                                        1));
+    EXPECT_THROW(DatabaseConnection::getUint32Parameter(parameters,
+                                                        "negative", 1),
+                 isc::BadValue);
+    EXPECT_THROW(DatabaseConnection::getUint32Parameter(parameters,
+                                                        "large", 1),
+                 isc::BadValue);
+    EXPECT_THROW(DatabaseConnection::getUint32Parameter(parameters,
+                                                        "text", 1),
+                 isc::BadValue);
+}
+
+namespace {
+
+/// @brief Context of a connection used in the tests of the pool.
+struct TestContext {
+
+    /// @brief Constructor.
+    ///
+    /// @param id identifier of the connection
+    explicit TestContext(const int id)
+        : id_(id), usable_(true) {
+    }
+
+    /// @brief Checks if the connection can be used.
+    bool isUsable() const {
+        return (usable_);
+    }
+
+    /// @brief Identifier of the connection.
+    int id_;
+
+    /// @brief Indicates if the connection can be used.
+    bool usable_;
+};
+
+/// @brief Pointer to a @c TestContext.
+typedef boost::shared_ptr<TestContext> TestContextPtr;
+
+/// @brief Factory of the connections used in the tests of the pool.
+///
+/// It is a base class of @c TestPool so it is initialized before the pool
+/// opens the first connection.
+class TestFactory {
+public:
+
+    /// @brief Constructor.
+    TestFactory()
+        : opened_(0), fail_(false) {
+    }
+
+    /// @brief Opens a connection.
+    ///
+    /// @throw DbOpenError if the test requested a failure
+    TestContextPtr open() {
+        if (fail_) {
+            isc_throw(DbOpenError, "unable to connect");
+        }
+        return (TestContextPtr(new TestContext(++opened_)));
+    }
+
+    /// @brief Number of opened connections.
+    int opened_;
+
+    /// @brief Indicates if the connections fail to open.
+    bool fail_;
+};
+
+/// @brief Pool of connections with a time set by the tests and a factory
+/// which fails on demand.
+class TestPool : public TestFactory,
+                 public DatabaseConnectionPool<TestContext> {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param max_size maximum number of connections
+    /// @param reconnect_wait_time time to wait after a failure
+    TestPool(const size_t max_size, const uint32_t reconnect_wait_time)
+        : TestFactory(),
+          DatabaseConnectionPool<TestContext>(
+            boost::bind(&TestFactory::open, this), max_size,
+            reconnect_wait_time),
+          now_(1000) {
+    }
+
+    /// @brief Current time returned to the pool.
+    int64_t now_;
+
+protected:
+
+    /// @brief Returns the time set by the test.
+    virtual int64_t getCurrentTime() const {
+        return (now_);
+    }
+};
+
+}
+
+// This test checks that the pool reuses the released connections and
+// opens new ones up to the maximum.
+TEST(DatabaseConnectionPoolTest, acquire) {
+    // The first connection is opened by the constructor.
+    TestPool pool(2, 100);
+    EXPECT_EQ(1, pool.opened_);
+    EXPECT_EQ(1, pool.size());
+
+    TestContextPtr first = pool.acquire();
+    EXPECT_EQ(1, first->id_);
+    TestContextPtr second = pool.acquire();
+    EXPECT_EQ(2, second->id_);
+    EXPECT_EQ(2, pool.size());
+    pool.release(first);
+    pool.release(second);
+
+    {
+        // The released connections are reused.
+        TestPool::Holder holder(pool);
+        EXPECT_NE(3, holder->id_);
+        EXPECT_EQ(2, pool.opened_);
+    }
+    EXPECT_EQ(2, pool.size());
+
+    EXPECT_THROW(TestPool(0, 100), isc::BadValue);
+}
+
+// This test checks that a lost connection is replaced, and that the
+// attempts to open a connection are delayed after a failure.
+TEST(DatabaseConnectionPoolTest, reconnect) {
+    TestPool pool(1, 100);
+    TestContextPtr context = pool.acquire();
+    context->usable_ = false;
+    pool.release(context);
+
+    // The connection fails to open: the next attempt is delayed.
+    pool.fail_ = true;
+    EXPECT_THROW(pool.acquire(), DbOpenError);
+    EXPECT_EQ(0, pool.size());
+    pool.fail_ = false;
+    EXPECT_THROW(pool.acquire(), DbOpenError);
+
+    // The delay is doubled after each failure.
+    pool.now_ += 100;
+    pool.fail_ = true;
+    EXPECT_THROW(pool.acquire(), DbOpenError);
+    pool.now_ += 100;
+    pool.fail_ = false;
+    EXPECT_THROW(pool.acquire(), DbOpenError);
+    pool.now_ += 100;
+    context = pool.acquire();
+    EXPECT_EQ(2, context->id_);
+    pool.release(context);
+
+    // The delay is reset by the success.
+    context = pool.acquire();
+    context->usable_ = false;
+    pool.release(context);
+    pool.fail_ = true;
+    EXPECT_THROW(pool.acquire(), DbOpenError);
+    pool.now_ += 100;
+    pool.fail_ = false;
+    context = pool.acquire();
+    EXPECT_EQ(3, context->id_);
+}
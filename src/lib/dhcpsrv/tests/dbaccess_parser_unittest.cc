@@ -178,7 +178,21 @@ private:
          return ((parameter != "persist") && (parameter != "lfc-interval") &&
                  (parameter != "connect-timeout") &&
                  (parameter != "port") &&
-                 (parameter != "readonly"));
+                 (parameter != "readonly") &&
+                 (parameter != "packed") &&
+                 (parameter != "group-commit") &&
+                 (parameter != "group-commit-max-batch") &&
+                 (parameter != "group-commit-max-latency") &&
+                 (parameter != "load-threads") &&
+                 (parameter != "lfc-batch-size") &&
+                 (parameter != "lfc-batch-interval") &&
+                 (parameter != "lfc-in-process") &&
+                 (parameter != "cache-size") &&
+                 (parameter != "cache-ttl") &&
+                 (parameter != "cache-negative-ttl") &&
+                 (parameter != "connection-pool-size") &&
+                 (parameter != "reconnect-wait-time") &&
+                 (parameter != "group-commit-sync"));
     }
 
 };
@@ -316,6 +330,176 @@ TEST_F(DbAccessParserTest, persistV6Memfile) {
                       config);
 }
 
+// Check that the parser accepts the packed storage setting for memfile.
+TEST_F(DbAccessParserTest, packedMemfile) {
+    const char* config[] = {"type", "memfile",
+                            "persist", "true",
+                            "packed", "true",
+                            "name", "/opt/kea/var/kea-leases4.csv",
+                            NULL};
+
+    string json_config = toJson(config);
+    ConstElementPtr json_elements = Element::fromJSON(json_config);
+    EXPECT_TRUE(json_elements);
+
+    TestDbAccessParser parser(DbAccessParser::LEASE_DB);
+    EXPECT_NO_THROW(parser.parse(json_elements));
+
+    checkAccessString("Valid memfile", parser.getDbAccessParameters(),
+                      config);
+}
+
+// Check that the parser accepts the group commit settings for memfile.
+TEST_F(DbAccessParserTest, groupCommitMemfile) {
+    const char* config[] = {"type", "memfile",
+                            "name", "/opt/kea/var/kea-leases4.csv",
+                            "group-commit", "true",
+                            "group-commit-max-batch", "64",
+                            "group-commit-max-latency", "5",
+                            "group-commit-sync", "false",
+                            NULL};
+
+    string json_config = toJson(config);
+    ConstElementPtr json_elements = Element::fromJSON(json_config);
+    EXPECT_TRUE(json_elements);
+
+    TestDbAccessParser parser(DbAccessParser::LEASE_DB);
+    EXPECT_NO_THROW(parser.parse(json_elements));
+
+    checkAccessString("Valid group commit", parser.getDbAccessParameters(),
+                      config);
+}
+
+// This test checks that the parser rejects out of range values of the
+// group commit parameters.
+TEST_F(DbAccessParserTest, invalidGroupCommit) {
+    const char* zero_batch[] = {"type", "memfile",
+                                "group-commit", "true",
+                                "group-commit-max-batch", "0",
+                                NULL};
+    ConstElementPtr json_elements = Element::fromJSON(toJson(zero_batch));
+    TestDbAccessParser parser(DbAccessParser::LEASE_DB);
+    EXPECT_THROW(parser.parse(json_elements), DhcpConfigError);
+
+    const char* negative_latency[] = {"type", "memfile",
+                                      "group-commit", "true",
+                                      "group-commit-max-latency", "-1",
+                                      NULL};
+    json_elements = Element::fromJSON(toJson(negative_latency));
+    EXPECT_THROW(parser.parse(json_elements), DhcpConfigError);
+}
+
+// Check that the parser accepts the number of threads loading the leases
+// and rejects the negative value.
+TEST_F(DbAccessParserTest, loadThreads) {
+    const char* config[] = {"type", "memfile",
+                            "name", "/opt/kea/var/kea-leases4.csv",
+                            "load-threads", "4",
+                            NULL};
+
+    ConstElementPtr json_elements = Element::fromJSON(toJson(config));
+    TestDbAccessParser parser(DbAccessParser::LEASE_DB);
+    EXPECT_NO_THROW(parser.parse(json_elements));
+    checkAccessString("Valid load threads", parser.getDbAccessParameters(),
+                      config);
+
+    const char* negative[] = {"type", "memfile",
+                              "load-threads", "-1",
+                              NULL};
+    json_elements = Element::fromJSON(toJson(negative));
+    EXPECT_THROW(parser.parse(json_elements), DhcpConfigError);
+}
+
+// Check that the parser accepts the settings of the in-process lease file
+// cleanup and rejects the out of range values.
+TEST_F(DbAccessParserTest, lfcInProcess) {
+    const char* config[] = {"type", "memfile",
+                            "name", "/opt/kea/var/kea-leases4.csv",
+                            "lfc-interval", "3600",
+                            "lfc-in-process", "true",
+                            "lfc-batch-size", "500",
+                            "lfc-batch-interval", "10",
+                            "lfc-snapshot-format", "binary",
+                            NULL};
+
+    ConstElementPtr json_elements = Element::fromJSON(toJson(config));
+    TestDbAccessParser parser(DbAccessParser::LEASE_DB);
+    EXPECT_NO_THROW(parser.parse(json_elements));
+    checkAccessString("Valid in-process LFC", parser.getDbAccessParameters(),
+                      config);
+
+    const char* zero_batch[] = {"type", "memfile",
+                                "lfc-in-process", "true",
+                                "lfc-batch-size", "0",
+                                NULL};
+    json_elements = Element::fromJSON(toJson(zero_batch));
+    EXPECT_THROW(parser.parse(json_elements), DhcpConfigError);
+
+    const char* negative_interval[] = {"type", "memfile",
+                                       "lfc-in-process", "true",
+                                       "lfc-batch-interval", "-1",
+                                       NULL};
+    json_elements = Element::fromJSON(toJson(negative_interval));
+    EXPECT_THROW(parser.parse(json_elements), DhcpConfigError);
+}
+
+// Check that the parser accepts the settings of the host cache and rejects
+// the out of range values.
+TEST_F(DbAccessParserTest, hostCache) {
+    const char* config[] = {"type", "mysql",
+                            "name", "keatest",
+                            "cache-size", "100000",
+                            "cache-ttl", "300",
+                            "cache-negative-ttl", "30",
+                            NULL};
+
+    ConstElementPtr json_elements = Element::fromJSON(toJson(config));
+    TestDbAccessParser parser(DbAccessParser::HOSTS_DB);
+    EXPECT_NO_THROW(parser.parse(json_elements));
+    checkAccessString("Valid host cache", parser.getDbAccessParameters(),
+                      config);
+
+    const char* negative_size[] = {"type", "mysql",
+                                   "cache-size", "-1",
+                                   NULL};
+    json_elements = Element::fromJSON(toJson(negative_size));
+    EXPECT_THROW(parser.parse(json_elements), DhcpConfigError);
+
+    const char* large_ttl[] = {"type", "mysql",
+                               "cache-ttl", "4294967296",
+                               NULL};
+    json_elements = Element::fromJSON(toJson(large_ttl));
+    EXPECT_THROW(parser.parse(json_elements), DhcpConfigError);
+}
+
+// Check that the parser accepts the settings of the pool of connections
+// and rejects the out of range values.
+TEST_F(DbAccessParserTest, connectionPool) {
+    const char* config[] = {"type", "postgresql",
+                            "name", "keatest",
+                            "connection-pool-size", "8",
+                            "reconnect-wait-time", "500",
+                            NULL};
+
+    ConstElementPtr json_elements = Element::fromJSON(toJson(config));
+    TestDbAccessParser parser(DbAccessParser::LEASE_DB);
+    EXPECT_NO_THROW(parser.parse(json_elements));
+    checkAccessString("Valid connection pool", parser.getDbAccessParameters(),
+                      config);
+
+    const char* zero_size[] = {"type", "postgresql",
+                               "connection-pool-size", "0",
+                               NULL};
+    json_elements = Element::fromJSON(toJson(zero_size));
+    EXPECT_THROW(parser.parse(json_elements), DhcpConfigError);
+
+    const char* negative_wait[] = {"type", "postgresql",
+                                   "reconnect-wait-time", "-1",
+                                   NULL};
+    json_elements = Element::fromJSON(toJson(negative_wait));
+    EXPECT_THROW(parser.parse(json_elements), DhcpConfigError);
+}
+
 // This test checks that the parser accepts the valid value of the
 // lfc-interval parameter.
 TEST_F(DbAccessParserTest, validLFCInterval) {
@@ -12,11 +12,14 @@
 #include <dhcpsrv/tests/generic_lease_mgr_unittest.h>
 #include <dhcpsrv/tests/test_utils.h>
 #include <stats/stats_mgr.h>
+#include <util/threads/sync.h>
 
+#include <boost/bind.hpp>
 #include <boost/foreach.hpp>
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <sstream>
 
 using namespace std;
@@ -1219,6 +1222,225 @@ GenericLeaseMgrTest::testGetLease4ClientIdSubnetId() {
     EXPECT_FALSE(returned);
 }
 
+void
+GenericLeaseMgrTest::testGetLeases4SubnetId() {
+    // Get the leases to be used for the test and add to the database
+    vector<Lease4Ptr> leases = createLeases4();
+    for (size_t i = 0; i < leases.size(); ++i) {
+        EXPECT_TRUE(lmptr_->addLease(leases[i]));
+    }
+
+    // Get all leases in the subnet of lease 1 and compare them with
+    // the leases which have been added for this subnet.
+    const SubnetID subnet_id = leases[1]->subnet_id_;
+    vector<string> expected;
+    for (size_t i = 0; i < leases.size(); ++i) {
+        if (leases[i]->subnet_id_ == subnet_id) {
+            expected.push_back(leases[i]->addr_.toText());
+        }
+    }
+
+    Lease4Collection returned = lmptr_->getLeases4(subnet_id);
+    vector<string> addresses;
+    for (Lease4Collection::const_iterator i = returned.begin();
+         i != returned.end(); ++i) {
+        EXPECT_EQ(subnet_id, (*i)->subnet_id_);
+        addresses.push_back((*i)->addr_.toText());
+    }
+    sort(expected.begin(), expected.end());
+    sort(addresses.begin(), addresses.end());
+    EXPECT_TRUE(expected == addresses);
+
+    // There are no leases in the unknown subnet.
+    EXPECT_TRUE(lmptr_->getLeases4(12345).empty());
+}
+
+void
+GenericLeaseMgrTest::testGetLeases4() {
+    // Get the leases to be used for the test and add to the database
+    vector<Lease4Ptr> leases = createLeases4();
+    for (size_t i = 0; i < leases.size(); ++i) {
+        EXPECT_TRUE(lmptr_->addLease(leases[i]));
+    }
+
+    // All leases are returned.
+    Lease4Collection returned = lmptr_->getLeases4();
+    ASSERT_EQ(leases.size(), returned.size());
+
+    for (Lease4Collection::const_iterator i = returned.begin();
+         i != returned.end(); ++i) {
+        size_t index = std::distance(ioaddress4_.begin(),
+                                     std::find(ioaddress4_.begin(),
+                                               ioaddress4_.end(),
+                                               (*i)->addr_));
+        ASSERT_LT(index, leases.size());
+        detailCompareLease(leases[index], *i);
+    }
+}
+
+void
+GenericLeaseMgrTest::testGetLeases4Paged(const bool ordered) {
+    // Get the leases to be used for the test and add to the database
+    vector<Lease4Ptr> leases = createLeases4();
+    for (size_t i = 0; i < leases.size(); ++i) {
+        EXPECT_TRUE(lmptr_->addLease(leases[i]));
+    }
+
+    // Fetch the leases in pages of 3 beginning with the zero address.
+    Lease4Collection all_leases;
+    IOAddress last_address = IOAddress::IPV4_ZERO_ADDRESS();
+    for (size_t i = 0; i < 10; ++i) {
+        Lease4Collection page = lmptr_->getLeases4(last_address,
+                                                   LeasePageSize(3));
+        // Collect leases in a common structure. They may be out of order.
+        for (Lease4Collection::const_iterator lease = page.begin();
+             lease != page.end(); ++lease) {
+            // The addresses follow the lower bound in ascending order.
+            if (ordered) {
+                EXPECT_TRUE(last_address < (*lease)->addr_);
+            }
+            last_address = (*lease)->addr_;
+            all_leases.push_back(*lease);
+        }
+
+        // The last page is shorter than the page size.
+        if (page.size() < 3) {
+            break;
+        }
+    }
+
+    // Make sure that we got exactly the number of leases that we have
+    // stored in the database.
+    ASSERT_EQ(leases.size(), all_leases.size());
+
+    // Make sure that all leases that we stored in the lease database
+    // have been retrieved.
+    for (size_t i = 0; i < leases.size(); ++i) {
+        bool found = false;
+        for (Lease4Collection::const_iterator lease = all_leases.begin();
+             lease != all_leases.end(); ++lease) {
+            if ((*lease)->addr_ == leases[i]->addr_) {
+                found = true;
+                detailCompareLease(leases[i], *lease);
+            }
+        }
+        EXPECT_TRUE(found) << "lease for address " << leases[i]->addr_
+                           << " was not returned";
+    }
+
+    // Nothing follows the last address.
+    EXPECT_TRUE(lmptr_->getLeases4(last_address, LeasePageSize(3)).empty());
+
+    // Only IPv4 address can be used.
+    EXPECT_THROW(lmptr_->getLeases4(IOAddress("2001:db8::1"), LeasePageSize(3)),
+                 InvalidParameter);
+}
+
+void
+GenericLeaseMgrTest::testGetLeases6SubnetId() {
+    // Get the leases to be used for the test and add to the database
+    vector<Lease6Ptr> leases = createLeases6();
+    for (size_t i = 0; i < leases.size(); ++i) {
+        EXPECT_TRUE(lmptr_->addLease(leases[i]));
+    }
+
+    // Get all leases in the subnet of lease 1 and compare them with
+    // the leases which have been added for this subnet.
+    const SubnetID subnet_id = leases[1]->subnet_id_;
+    vector<string> expected;
+    for (size_t i = 0; i < leases.size(); ++i) {
+        if (leases[i]->subnet_id_ == subnet_id) {
+            expected.push_back(leases[i]->addr_.toText());
+        }
+    }
+
+    Lease6Collection returned = lmptr_->getLeases6(subnet_id);
+    vector<string> addresses;
+    for (Lease6Collection::const_iterator i = returned.begin();
+         i != returned.end(); ++i) {
+        EXPECT_EQ(subnet_id, (*i)->subnet_id_);
+        addresses.push_back((*i)->addr_.toText());
+    }
+    sort(expected.begin(), expected.end());
+    sort(addresses.begin(), addresses.end());
+    EXPECT_TRUE(expected == addresses);
+
+    // There are no leases in the unknown subnet.
+    EXPECT_TRUE(lmptr_->getLeases6(12345).empty());
+}
+
+void
+GenericLeaseMgrTest::testGetLeases6() {
+    // Get the leases to be used for the test and add to the database
+    vector<Lease6Ptr> leases = createLeases6();
+    for (size_t i = 0; i < leases.size(); ++i) {
+        EXPECT_TRUE(lmptr_->addLease(leases[i]));
+    }
+
+    // All leases are returned.
+    Lease6Collection returned = lmptr_->getLeases6();
+    ASSERT_EQ(leases.size(), returned.size());
+
+    for (Lease6Collection::const_iterator i = returned.begin();
+         i != returned.end(); ++i) {
+        size_t index = std::distance(ioaddress6_.begin(),
+                                     std::find(ioaddress6_.begin(),
+                                               ioaddress6_.end(),
+                                               (*i)->addr_));
+        ASSERT_LT(index, leases.size());
+        detailCompareLease(leases[index], *i);
+    }
+}
+
+void
+GenericLeaseMgrTest::testGetLeases6Paged() {
+    // Get the leases to be used for the test and add to the database
+    vector<Lease6Ptr> leases = createLeases6();
+    for (size_t i = 0; i < leases.size(); ++i) {
+        EXPECT_TRUE(lmptr_->addLease(leases[i]));
+    }
+
+    // Fetch the leases in pages of 3 beginning with the zero address.
+    // The order of the addresses is specific to the backend, so only
+    // the last address of each page is used as the lower bound.
+    Lease6Collection all_leases;
+    IOAddress last_address = IOAddress::IPV6_ZERO_ADDRESS();
+    for (size_t i = 0; i < 10; ++i) {
+        Lease6Collection page = lmptr_->getLeases6(last_address,
+                                                   LeasePageSize(3));
+        all_leases.insert(all_leases.end(), page.begin(), page.end());
+
+        // The last page is shorter than the page size.
+        if (page.size() < 3) {
+            break;
+        }
+        last_address = page.back()->addr_;
+    }
+
+    // Make sure that we got exactly the number of leases that we have
+    // stored in the database.
+    ASSERT_EQ(leases.size(), all_leases.size());
+
+    // Make sure that all leases that we stored in the lease database
+    // have been retrieved.
+    for (size_t i = 0; i < leases.size(); ++i) {
+        bool found = false;
+        for (Lease6Collection::const_iterator lease = all_leases.begin();
+             lease != all_leases.end(); ++lease) {
+            if ((*lease)->addr_ == leases[i]->addr_) {
+                found = true;
+                detailCompareLease(leases[i], *lease);
+            }
+        }
+        EXPECT_TRUE(found) << "lease for address " << leases[i]->addr_
+                           << " was not returned";
+    }
+
+    // Only IPv6 address can be used.
+    EXPECT_THROW(lmptr_->getLeases6(IOAddress("192.0.2.0"), LeasePageSize(3)),
+                 InvalidParameter);
+}
+
 void
 GenericLeaseMgrTest::testGetLeases6DuidIaid() {
     // Get the leases to be used for the test.
@@ -2684,6 +2906,156 @@ GenericLeaseMgrTest::testRecountLeaseStats6() {
     ASSERT_NO_FATAL_FAILURE(checkLeaseStats(expectedStats));
 }
 
+void
+GenericLeaseMgrTest::testRecountSubnetLeaseStats4() {
+    using namespace stats;
+
+    StatsMgr::instance().removeAll();
+
+    // Create two subnets.
+    int num_subnets = 2;
+    CfgSubnets4Ptr cfg = CfgMgr::instance().getStagingCfg()->getCfgSubnets4();
+    Subnet4Ptr subnet;
+    Pool4Ptr pool;
+
+    subnet.reset(new Subnet4(IOAddress("192.0.1.0"), 24, 1, 2, 3, 1));
+    pool.reset(new Pool4(IOAddress("192.0.1.0"), 24));
+    subnet->addPool(pool);
+    cfg->add(subnet);
+
+    subnet.reset(new Subnet4(IOAddress("192.0.2.0"), 24, 1, 2, 3, 2));
+    pool.reset(new Pool4(IOAddress("192.0.2.0"), 24));
+    subnet->addPool(pool);
+    cfg->add(subnet);
+
+    ASSERT_NO_THROW(CfgMgr::instance().commit());
+
+    StatValMapList expectedStats(num_subnets);
+    for (int i = 0; i < num_subnets; ++i) {
+        expectedStats[i]["total-addresses"] = 256;
+        expectedStats[i]["assigned-addresses"] = 0;
+        expectedStats[i]["declined-addresses"] = 0;
+    }
+    ASSERT_NO_FATAL_FAILURE(checkLeaseStats(expectedStats));
+
+    // Insert leases into both subnets.
+    makeLease4("192.0.1.1", 1);
+    makeLease4("192.0.1.2", 1, Lease::STATE_DECLINED);
+    makeLease4("192.0.2.1", 2);
+    makeLease4("192.0.2.2", 2);
+    makeLease4("192.0.2.3", 2, Lease::STATE_DECLINED);
+
+    // Recount the second subnet only. The stats of the first subnet
+    // should be left untouched.
+    SubnetIDSet subnet_ids;
+    subnet_ids.insert(2);
+    ASSERT_NO_THROW(lmptr_->recountLeaseStats4(subnet_ids));
+
+    expectedStats[1]["assigned-addresses"] = 2;
+    expectedStats[1]["declined-addresses"] = 1;
+    ASSERT_NO_FATAL_FAILURE(checkLeaseStats(expectedStats));
+
+    ObservationPtr declined = StatsMgr::instance().getObservation("declined-addresses");
+    ASSERT_TRUE(declined);
+    EXPECT_EQ(1, declined->getInteger().first);
+
+    // Recount both subnets.
+    subnet_ids.insert(1);
+    ASSERT_NO_THROW(lmptr_->recountLeaseStats4(subnet_ids));
+
+    expectedStats[0]["assigned-addresses"] = 1;
+    expectedStats[0]["declined-addresses"] = 1;
+    ASSERT_NO_FATAL_FAILURE(checkLeaseStats(expectedStats));
+
+    // The declined addresses of the second subnet must not be counted twice.
+    declined = StatsMgr::instance().getObservation("declined-addresses");
+    ASSERT_TRUE(declined);
+    EXPECT_EQ(2, declined->getInteger().first);
+
+    // Remove the declined lease from the first subnet and recount it.
+    EXPECT_TRUE(lmptr_->deleteLease(IOAddress("192.0.1.2")));
+    subnet_ids.erase(2);
+    ASSERT_NO_THROW(lmptr_->recountLeaseStats4(subnet_ids));
+
+    expectedStats[0]["declined-addresses"] = 0;
+    ASSERT_NO_FATAL_FAILURE(checkLeaseStats(expectedStats));
+
+    declined = StatsMgr::instance().getObservation("declined-addresses");
+    ASSERT_TRUE(declined);
+    EXPECT_EQ(1, declined->getInteger().first);
+}
+
+void
+GenericLeaseMgrTest::testRecountSubnetLeaseStats6() {
+    using namespace stats;
+
+    StatsMgr::instance().removeAll();
+
+    // Create two subnets.
+    int num_subnets = 2;
+    CfgSubnets6Ptr cfg = CfgMgr::instance().getStagingCfg()->getCfgSubnets6();
+    Subnet6Ptr subnet;
+    Pool6Ptr pool;
+
+    subnet.reset(new Subnet6(IOAddress("3001:1::"), 64, 1, 2, 3, 4, 1));
+    pool.reset(new Pool6(Lease::TYPE_NA, IOAddress("3001:1::"),
+                         IOAddress("3001:1::FF")));
+    subnet->addPool(pool);
+    pool.reset(new Pool6(Lease::TYPE_PD, IOAddress("3001:1:2::"), 96, 112));
+    subnet->addPool(pool);
+    cfg->add(subnet);
+
+    subnet.reset(new Subnet6(IOAddress("2001:db8:1::"), 64, 1, 2, 3, 4, 2));
+    pool.reset(new Pool6(Lease::TYPE_NA, IOAddress("2001:db8:1::"), 120));
+    subnet->addPool(pool);
+    cfg->add(subnet);
+
+    ASSERT_NO_THROW(CfgMgr::instance().commit());
+
+    StatValMapList expectedStats(num_subnets);
+    for (int i = 0; i < num_subnets; ++i) {
+        expectedStats[i]["assigned-nas"] = 0;
+        expectedStats[i]["declined-addresses"] = 0;
+        expectedStats[i]["assigned-pds"] = 0;
+    }
+    ASSERT_NO_FATAL_FAILURE(checkLeaseStats(expectedStats));
+
+    // Insert leases into both subnets.
+    makeLease6(Lease::TYPE_NA, "3001:1::1", 0, 1);
+    makeLease6(Lease::TYPE_NA, "3001:1::2", 0, 1, Lease::STATE_DECLINED);
+    makeLease6(Lease::TYPE_PD, "3001:1:2:0100::", 112, 1);
+    makeLease6(Lease::TYPE_NA, "2001:db8:1::1", 0, 2);
+    makeLease6(Lease::TYPE_NA, "2001:db8:1::2", 0, 2, Lease::STATE_DECLINED);
+
+    // Recount the first subnet only. The stats of the second subnet
+    // should be left untouched.
+    SubnetIDSet subnet_ids;
+    subnet_ids.insert(1);
+    ASSERT_NO_THROW(lmptr_->recountLeaseStats6(subnet_ids));
+
+    expectedStats[0]["assigned-nas"] = 1;
+    expectedStats[0]["declined-addresses"] = 1;
+    expectedStats[0]["assigned-pds"] = 1;
+    ASSERT_NO_FATAL_FAILURE(checkLeaseStats(expectedStats));
+
+    ObservationPtr declined = StatsMgr::instance().getObservation("declined-addresses");
+    ASSERT_TRUE(declined);
+    EXPECT_EQ(1, declined->getInteger().first);
+
+    // Recount both subnets.
+    subnet_ids.insert(2);
+    ASSERT_NO_THROW(lmptr_->recountLeaseStats6(subnet_ids));
+
+    expectedStats[1]["assigned-nas"] = 1;
+    expectedStats[1]["declined-addresses"] = 1;
+    ASSERT_NO_FATAL_FAILURE(checkLeaseStats(expectedStats));
+
+    // The declined addresses of the first subnet must not be counted twice.
+    declined = StatsMgr::instance().getObservation("declined-addresses");
+    ASSERT_TRUE(declined);
+    EXPECT_EQ(2, declined->getInteger().first);
+}
+
 void
 GenericLeaseMgrTest::testWipeLeases6() {
     // Get the leases to be used for the test and add to the database
@@ -2748,6 +3120,271 @@ GenericLeaseMgrTest::testWipeLeases4() {
     EXPECT_EQ(0, lmptr_->wipeLeases4(333));
 }
 
+namespace {
+
+/// @brief Results of asynchronous lease operations, in the order of their
+/// completion.
+class AsyncResults {
+public:
+
+    /// @brief Returns a callback appending the result of an operation.
+    AsyncLeaseCallback callback() {
+        return (boost::bind(&AsyncResults::add, this, _1));
+    }
+
+    /// @brief Appends the result of an operation.
+    ///
+    /// The callbacks may be invoked by a thread of the backend.
+    ///
+    /// @param result result of the operation
+    void add(const AsyncLeaseResult& result) {
+        isc::util::thread::Mutex::Locker lock(mutex_);
+        results_.push_back(result);
+    }
+
+    /// @brief Results of the operations.
+    std::vector<AsyncLeaseResult> results_;
+
+    /// @brief Mutex protecting the results.
+    isc::util::thread::Mutex mutex_;
+};
+
+}
+
+void
+GenericLeaseMgrTest::testAsyncLeases4() {
+    vector<Lease4Ptr> leases = createLeases4();
+    Lease4Ptr updated(new Lease4(*leases[1]));
+    updated->valid_lft_ += 100;
+
+    // Issue the operations without waiting for their completion.
+    AsyncResults results;
+    lmptr_->asyncAddLease(leases[1], results.callback());
+    lmptr_->asyncAddLease(leases[1], results.callback());
+    lmptr_->asyncGetLease4(ioaddress4_[1], results.callback());
+    lmptr_->asyncGetLease4(ioaddress4_[2], results.callback());
+    lmptr_->asyncUpdateLease4(updated, results.callback());
+    lmptr_->asyncUpdateLease4(leases[2], results.callback());
+    lmptr_->asyncGetLease4(ioaddress4_[1], results.callback());
+    lmptr_->asyncDeleteLease(ioaddress4_[1], results.callback());
+    lmptr_->asyncDeleteLease(ioaddress4_[1], results.callback());
+    lmptr_->asyncWait();
+
+    // The results are in the order of the operations.
+    ASSERT_EQ(9, results.results_.size());
+    EXPECT_TRUE(results.results_[0].success_);
+    // The lease exists.
+    EXPECT_FALSE(results.results_[1].success_);
+    EXPECT_TRUE(results.results_[1].error_.empty());
+    EXPECT_TRUE(results.results_[2].success_);
+    ASSERT_TRUE(results.results_[2].lease4_);
+    detailCompareLease(leases[1], results.results_[2].lease4_);
+    EXPECT_TRUE(results.results_[3].success_);
+    EXPECT_FALSE(results.results_[3].lease4_);
+    EXPECT_TRUE(results.results_[4].success_);
+    // The updated lease doesn't exist.
+    EXPECT_FALSE(results.results_[5].success_);
+    EXPECT_FALSE(results.results_[5].error_.empty());
+    ASSERT_TRUE(results.results_[6].lease4_);
+    detailCompareLease(updated, results.results_[6].lease4_);
+    EXPECT_TRUE(results.results_[7].success_);
+    // The deleted lease doesn't exist.
+    EXPECT_FALSE(results.results_[8].success_);
+    EXPECT_TRUE(results.results_[8].error_.empty());
+
+    EXPECT_FALSE(lmptr_->getLease4(ioaddress4_[1]));
+}
+
+void
+GenericLeaseMgrTest::testAsyncLeases6() {
+    vector<Lease6Ptr> leases = createLeases6();
+    Lease6Ptr updated(new Lease6(*leases[1]));
+    updated->valid_lft_ += 100;
+
+    // Issue the operations without waiting for their completion.
+    AsyncResults results;
+    lmptr_->asyncAddLease(leases[1], results.callback());
+    lmptr_->asyncAddLease(leases[1], results.callback());
+    lmptr_->asyncGetLease6(leases[1]->type_, ioaddress6_[1],
+                           results.callback());
+    lmptr_->asyncGetLease6(leases[2]->type_, ioaddress6_[2],
+                           results.callback());
+    lmptr_->asyncUpdateLease6(updated, results.callback());
+    lmptr_->asyncUpdateLease6(leases[2], results.callback());
+    lmptr_->asyncGetLease6(leases[1]->type_, ioaddress6_[1],
+                           results.callback());
+    lmptr_->asyncDeleteLease(ioaddress6_[1], results.callback());
+    lmptr_->asyncDeleteLease(ioaddress6_[1], results.callback());
+    lmptr_->asyncWait();
+
+    // The results are in the order of the operations.
+    ASSERT_EQ(9, results.results_.size());
+    EXPECT_TRUE(results.results_[0].success_);
+    // The lease exists.
+    EXPECT_FALSE(results.results_[1].success_);
+    EXPECT_TRUE(results.results_[1].error_.empty());
+    EXPECT_TRUE(results.results_[2].success_);
+    ASSERT_TRUE(results.results_[2].lease6_);
+    detailCompareLease(leases[1], results.results_[2].lease6_);
+    EXPECT_TRUE(results.results_[3].success_);
+    EXPECT_FALSE(results.results_[3].lease6_);
+    EXPECT_TRUE(results.results_[4].success_);
+    // The updated lease doesn't exist.
+    EXPECT_FALSE(results.results_[5].success_);
+    EXPECT_FALSE(results.results_[5].error_.empty());
+    ASSERT_TRUE(results.results_[6].lease6_);
+    detailCompareLease(updated, results.results_[6].lease6_);
+    EXPECT_TRUE(results.results_[7].success_);
+    // The deleted lease doesn't exist.
+    EXPECT_FALSE(results.results_[8].success_);
+    EXPECT_TRUE(results.results_[8].error_.empty());
+
+    EXPECT_FALSE(lmptr_->getLease6(leases[1]->type_, ioaddress6_[1]));
+}
+
+void
+GenericLeaseMgrTest::testReclaimLeases4() {
+    vector<Lease4Ptr> leases = createLeases4();
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(lmptr_->addLease(leases[i]));
+    }
+
+    // An empty batch is accepted.
+    ASSERT_NO_THROW(lmptr_->reclaimLeases4(Lease4Collection(),
+                                           Lease4Collection()));
+
+    // Reclaim two leases by updating their state and delete two others.
+    Lease4Collection updated;
+    Lease4Collection removed;
+    for (int i = 0; i < 2; ++i) {
+        leases[i]->hostname_.clear();
+        leases[i]->fqdn_fwd_ = false;
+        leases[i]->fqdn_rev_ = false;
+        leases[i]->state_ = Lease::STATE_EXPIRED_RECLAIMED;
+        updated.push_back(leases[i]);
+        removed.push_back(leases[i + 2]);
+    }
+    ASSERT_NO_THROW(lmptr_->reclaimLeases4(updated, removed));
+
+    for (int i = 0; i < 2; ++i) {
+        Lease4Ptr lease = lmptr_->getLease4(ioaddress4_[i]);
+        ASSERT_TRUE(lease);
+        detailCompareLease(leases[i], lease);
+        EXPECT_FALSE(lmptr_->getLease4(ioaddress4_[i + 2]));
+    }
+
+    // A batch with a lease which doesn't exist is rejected.
+    updated.clear();
+    updated.push_back(leases[2]);
+    EXPECT_THROW(lmptr_->reclaimLeases4(updated, Lease4Collection()),
+                 NoSuchLease);
+}
+
+void
+GenericLeaseMgrTest::testReclaimLeases6() {
+    vector<Lease6Ptr> leases = createLeases6();
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(lmptr_->addLease(leases[i]));
+    }
+
+    // An empty batch is accepted.
+    ASSERT_NO_THROW(lmptr_->reclaimLeases6(Lease6Collection(),
+                                           Lease6Collection()));
+
+    // Reclaim two leases by updating their state and delete two others.
+    Lease6Collection updated;
+    Lease6Collection removed;
+    for (int i = 0; i < 2; ++i) {
+        leases[i]->hostname_.clear();
+        leases[i]->fqdn_fwd_ = false;
+        leases[i]->fqdn_rev_ = false;
+        leases[i]->state_ = Lease::STATE_EXPIRED_RECLAIMED;
+        updated.push_back(leases[i]);
+        removed.push_back(leases[i + 2]);
+    }
+    ASSERT_NO_THROW(lmptr_->reclaimLeases6(updated, removed));
+
+    for (int i = 0; i < 2; ++i) {
+        Lease6Ptr lease = lmptr_->getLease6(leases[i]->type_, ioaddress6_[i]);
+        ASSERT_TRUE(lease);
+        detailCompareLease(leases[i], lease);
+        EXPECT_FALSE(lmptr_->getLease6(leases[i + 2]->type_,
+                                       ioaddress6_[i + 2]));
+    }
+
+    // A batch with a lease which doesn't exist is rejected.
+    updated.clear();
+    updated.push_back(leases[2]);
+    EXPECT_THROW(lmptr_->reclaimLeases6(updated, Lease6Collection()),
+                 NoSuchLease);
+}
+
+void
+GenericLeaseMgrTest::testApplyLeases4() {
+    vector<Lease4Ptr> leases = createLeases4();
+    for (int i = 0; i < 2; ++i) {
+        ASSERT_TRUE(lmptr_->addLease(leases[i]));
+    }
+
+    // An empty batch is accepted.
+    ASSERT_NO_THROW(lmptr_->applyLeases4(Lease4Collection()));
+
+    // Modify the two existing leases and add two new ones.
+    Lease4Collection batch;
+    for (int i = 0; i < 4; ++i) {
+        if (i < 2) {
+            leases[i]->hostname_ = "modified.example.com.";
+            leases[i]->valid_lft_ += 100;
+        }
+        batch.push_back(leases[i]);
+    }
+    ASSERT_NO_THROW(lmptr_->applyLeases4(batch));
+
+    for (int i = 0; i < 4; ++i) {
+        Lease4Ptr lease = lmptr_->getLease4(ioaddress4_[i]);
+        ASSERT_TRUE(lease) << "lease for address " << ioaddress4_[i]
+                           << " not found";
+        detailCompareLease(leases[i], lease);
+    }
+
+    // Applying the same batch again only updates the leases.
+    ASSERT_NO_THROW(lmptr_->applyLeases4(batch));
+    EXPECT_EQ(4, lmptr_->getLeases4().size());
+}
+
+void
+GenericLeaseMgrTest::testApplyLeases6() {
+    vector<Lease6Ptr> leases = createLeases6();
+    for (int i = 0; i < 2; ++i) {
+        ASSERT_TRUE(lmptr_->addLease(leases[i]));
+    }
+
+    // An empty batch is accepted.
+    ASSERT_NO_THROW(lmptr_->applyLeases6(Lease6Collection()));
+
+    // Modify the two existing leases and add two new ones.
+    Lease6Collection batch;
+    for (int i = 0; i < 4; ++i) {
+        if (i < 2) {
+            leases[i]->hostname_ = "modified.example.com.";
+            leases[i]->valid_lft_ += 100;
+        }
+        batch.push_back(leases[i]);
+    }
+    ASSERT_NO_THROW(lmptr_->applyLeases6(batch));
+
+    for (int i = 0; i < 4; ++i) {
+        Lease6Ptr lease = lmptr_->getLease6(leasetype6_[i], ioaddress6_[i]);
+        ASSERT_TRUE(lease) << "lease for address " << ioaddress6_[i]
+                           << " not found";
+        detailCompareLease(leases[i], lease);
+    }
+
+    // Applying the same batch again only updates the leases.
+    ASSERT_NO_THROW(lmptr_->applyLeases6(batch));
+    EXPECT_EQ(4, lmptr_->getLeases6().size());
+}
+
 }; // namespace test
 }; // namespace dhcp
 }; // namespace isc
@@ -200,6 +200,18 @@ public:
     /// a combination of client and subnet IDs.
     void testGetLease4ClientIdSubnetId();
 
+    /// @brief Test method which returns all IPv4 leases for a subnet.
+    void testGetLeases4SubnetId();
+
+    /// @brief Test method which returns all IPv4 leases.
+    void testGetLeases4();
+
+    /// @brief Test method which returns range of IPv4 leases with paging.
+    ///
+    /// @param ordered Indicates if the backend returns the leases in the
+    /// ascending order of addresses.
+    void testGetLeases4Paged(const bool ordered = true);
+
     /// @brief Basic Lease4 Checks
     ///
     /// Checks that the addLease, getLease4(by address), getLease4(hwaddr,subnet_id),
@@ -247,6 +259,15 @@ public:
     /// a combination of DUID and IAID.
     void testGetLeases6DuidIaid();
 
+    /// @brief Test method which returns all IPv6 leases for a subnet.
+    void testGetLeases6SubnetId();
+
+    /// @brief Test method which returns all IPv6 leases.
+    void testGetLeases6();
+
+    /// @brief Test method which returns range of IPv6 leases with paging.
+    void testGetLeases6Paged();
+
     /// @brief Check that the system can cope with a DUID of allowed size.
     void testGetLeases6DuidSize();
 
@@ -374,6 +395,22 @@ public:
     /// after altering the lease states in various ways.
     void testRecountLeaseStats6();
 
+    /// @brief Check that the IPv4 lease statistics can be recounted for
+    /// selected subnets
+    ///
+    /// This test verifies that only the statistics of the selected subnets
+    /// are recalculated and that the global number of declined addresses
+    /// is adjusted accordingly.
+    void testRecountSubnetLeaseStats4();
+
+    /// @brief Check that the IPv6 lease statistics can be recounted for
+    /// selected subnets
+    ///
+    /// This test verifies that only the statistics of the selected subnets
+    /// are recalculated and that the global number of declined addresses
+    /// is adjusted accordingly.
+    void testRecountSubnetLeaseStats6();
+
 
     /// @brief Check if wipeLeases4 works properly.
     ///
@@ -387,6 +424,44 @@ public:
     /// attempts to delete them, one subnet at a time.
     void testWipeLeases6();
 
+    /// @brief Checks the asynchronous IPv4 lease operations.
+    ///
+    /// Issues operations on a lease without waiting for their completion,
+    /// then verifies their results after @c LeaseMgr::asyncWait.
+    void testAsyncLeases4();
+
+    /// @brief Checks the asynchronous IPv6 lease operations.
+    ///
+    /// Issues operations on a lease without waiting for their completion,
+    /// then verifies their results after @c LeaseMgr::asyncWait.
+    void testAsyncLeases6();
+
+    /// @brief Checks the reclamation of a batch of IPv4 leases.
+    ///
+    /// Updates and deletes several leases with a single call to
+    /// @c LeaseMgr::reclaimLeases4 and checks that the batch including
+    /// a non-existing lease is rejected.
+    void testReclaimLeases4();
+
+    /// @brief Checks the reclamation of a batch of IPv6 leases.
+    ///
+    /// Updates and deletes several leases with a single call to
+    /// @c LeaseMgr::reclaimLeases6 and checks that the batch including
+    /// a non-existing lease is rejected.
+    void testReclaimLeases6();
+
+    /// @brief Checks adding and updating a batch of IPv4 leases.
+    ///
+    /// Applies a batch holding new leases and modified existing leases
+    /// with a single call to @c LeaseMgr::applyLeases4.
+    void testApplyLeases4();
+
+    /// @brief Checks adding and updating a batch of IPv6 leases.
+    ///
+    /// Applies a batch holding new leases and modified existing leases
+    /// with a single call to @c LeaseMgr::applyLeases6.
+    void testApplyLeases6();
+
     /// @brief String forms of IPv4 addresses
     std::vector<std::string>  straddress4_;
 
@@ -0,0 +1,201 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/group_commit_writer.h>
+#include <dhcpsrv/tests/lease_file_io.h>
+#include <exceptions/exceptions.h>
+#include <util/csv_file.h>
+#include <util/threads/thread.h>
+
+#include <boost/bind.hpp>
+#include <boost/shared_ptr.hpp>
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace isc;
+using namespace isc::dhcp;
+using namespace isc::dhcp::test;
+using namespace isc::util;
+
+namespace {
+
+/// @brief Test fixture class for the @c GroupCommitWriter.
+class GroupCommitWriterTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Removes the test file.
+    GroupCommitWriterTest()
+        : filename_(absolutePath("group-commit.csv")), io_(filename_) {
+        io_.removeFile();
+    }
+
+    /// @brief Destructor.
+    ///
+    /// Removes the test file.
+    virtual ~GroupCommitWriterTest() {
+        io_.removeFile();
+    }
+
+    /// @brief Returns the absolute path to the file in the test directory.
+    ///
+    /// @param filename Name of the file.
+    static std::string absolutePath(const std::string& filename) {
+        std::ostringstream s;
+        s << TEST_DATA_BUILDDIR << "/" << filename;
+        return (s.str());
+    }
+
+    /// @brief Name of the test file.
+    std::string filename_;
+
+    /// @brief Object providing access to the test file.
+    LeaseFileIO io_;
+};
+
+/// @brief Writes rows with the writer and waits for each of them.
+///
+/// @param writer Writer instance.
+/// @param id Identifier of the thread included in the rows.
+/// @param count Number of rows to be written.
+void writeRows(GroupCommitWriter* writer, const unsigned id,
+               const unsigned count) {
+    for (unsigned i = 0; i < count; ++i) {
+        std::ostringstream row;
+        row << id << "," << i << "\n";
+        // The rows are appended under a lock in the Memfile backend, which
+        // makes sure that the sequence number refers to this row.
+        writer->write(row.str());
+        writer->waitDurable(writer->getLastSequence());
+    }
+}
+
+// Checks that the writer can't be created with the zero batch size.
+TEST_F(GroupCommitWriterTest, constructor) {
+    EXPECT_THROW(GroupCommitWriter(0, 0, false), BadValue);
+
+    GroupCommitWriter writer(10, 5, true);
+    EXPECT_EQ(10, writer.getMaxBatch());
+    EXPECT_EQ(5, writer.getMaxLatency());
+    EXPECT_TRUE(writer.getSync());
+    EXPECT_EQ(0, writer.getLastSequence());
+    EXPECT_EQ(0, writer.getBatchCount());
+}
+
+// Checks that the rows are written when the caller waits for them and that
+// the pending rows are written when the writer is closed.
+TEST_F(GroupCommitWriterTest, writeAndClose) {
+    GroupCommitWriter writer(10, 0, true);
+
+    // The rows can't be written until the writer is open.
+    EXPECT_THROW(writer.write("a,b\n"), CSVFileError);
+
+    ASSERT_NO_THROW(writer.open(filename_));
+    ASSERT_NO_THROW(writer.write("a,b\n"));
+    ASSERT_NO_THROW(writer.waitDurable(writer.getLastSequence()));
+    EXPECT_EQ("a,b\n", io_.readFile());
+
+    // Waiting for the row which has already been written returns
+    // immediately.
+    ASSERT_NO_THROW(writer.waitDurable(1));
+
+    ASSERT_NO_THROW(writer.write("c,d\n"));
+    ASSERT_NO_THROW(writer.write("e,f\n"));
+    EXPECT_EQ(3, writer.getLastSequence());
+    writer.close();
+    EXPECT_EQ("a,b\nc,d\ne,f\n", io_.readFile());
+    ASSERT_NO_THROW(writer.waitDurable(3));
+
+    // Closing the writer twice is a no-op.
+    EXPECT_NO_THROW(writer.close());
+    EXPECT_THROW(writer.write("g,h\n"), CSVFileError);
+
+    // Reopening the writer appends to the file.
+    ASSERT_NO_THROW(writer.open(filename_));
+    ASSERT_NO_THROW(writer.write("g,h\n"));
+    ASSERT_NO_THROW(writer.waitDurable(writer.getLastSequence()));
+    EXPECT_EQ("a,b\nc,d\ne,f\ng,h\n", io_.readFile());
+}
+
+// Checks that the error is reported when the file can't be opened.
+TEST_F(GroupCommitWriterTest, openError) {
+    GroupCommitWriter writer(10, 0, false);
+    EXPECT_THROW(writer.open("/no/such/directory/file.csv"), CSVFileError);
+    EXPECT_THROW(writer.write("a,b\n"), CSVFileError);
+}
+
+// Checks that the rows written by multiple threads are written in groups.
+TEST_F(GroupCommitWriterTest, concurrentWrites) {
+    GroupCommitWriter writer(100, 2, false);
+    ASSERT_NO_THROW(writer.open(filename_));
+
+    const unsigned threads_num = 4;
+    const unsigned rows_num = 50;
+    std::vector<boost::shared_ptr<util::thread::Thread> > threads;
+    for (unsigned i = 0; i < threads_num; ++i) {
+        threads.push_back(boost::shared_ptr<util::thread::Thread>
+                          (new util::thread::Thread(boost::bind(&writeRows,
+                                                                &writer, i,
+                                                                rows_num))));
+    }
+    for (unsigned i = 0; i < threads_num; ++i) {
+        ASSERT_NO_THROW(threads[i]->wait());
+    }
+
+    EXPECT_EQ(threads_num * rows_num, writer.getLastSequence());
+    EXPECT_LT(writer.getBatchCount(), writer.getLastSequence());
+
+    // All rows must be in the file and the rows of each thread must be
+    // in order.
+    std::istringstream contents(io_.readFile());
+    std::vector<unsigned> next(threads_num, 0);
+    std::string line;
+    unsigned lines = 0;
+    while (std::getline(contents, line)) {
+        unsigned id = 0;
+        unsigned row = 0;
+        char comma = 0;
+        std::istringstream s(line);
+        s >> id >> comma >> row;
+        ASSERT_LT(id, threads_num);
+        EXPECT_EQ(next[id], row);
+        next[id] = row + 1;
+        ++lines;
+    }
+    EXPECT_EQ(threads_num * rows_num, lines);
+}
+
+// Checks that the writer takes over writing the rows appended to the
+// CSV file.
+TEST_F(GroupCommitWriterTest, csvFile) {
+    CSVFile csv(filename_);
+    csv.addColumn("animal");
+    csv.addColumn("age");
+
+    GroupCommitWriterPtr writer(new GroupCommitWriter(10, 0, false));
+    csv.setWriter(writer);
+    ASSERT_NO_THROW(csv.recreate());
+
+    CSVRow row(2);
+    row.writeAt(0, "dog");
+    row.writeAt(1, 3);
+    ASSERT_NO_THROW(csv.append(row));
+    ASSERT_NO_THROW(writer->waitDurable(writer->getLastSequence()));
+    EXPECT_EQ("animal,age\ndog,3\n", io_.readFile());
+
+    row.writeAt(0, "cat");
+    ASSERT_NO_THROW(csv.append(row));
+    csv.close();
+    EXPECT_EQ("animal,age\ndog,3\ncat,3\n", io_.readFile());
+}
+
+} // end of anonymous namespace
@@ -0,0 +1,248 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <asiolink/io_address.h>
+#include <dhcpsrv/cfg_hosts.h>
+#include <dhcpsrv/cfgmgr.h>
+#include <dhcpsrv/host.h>
+#include <dhcpsrv/host_cache.h>
+#include <dhcpsrv/host_mgr.h>
+#include <stats/stats_mgr.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+using namespace isc::stats;
+
+namespace {
+
+/// @brief Host cache with a time set by the tests.
+class TestHostCache : public HostCache {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param max_size maximum number of entries
+    /// @param ttl time to live of the entries holding hosts
+    /// @param negative_ttl time to live of the entries holding no host
+    TestHostCache(const size_t max_size, const uint32_t ttl,
+                  const uint32_t negative_ttl)
+        : HostCache(max_size, ttl, negative_ttl), now_(1000) {
+    }
+
+    /// @brief Current time returned to the cache.
+    time_t now_;
+
+protected:
+
+    /// @brief Returns the time set by the test.
+    virtual time_t getCurrentTime() const {
+        return (now_);
+    }
+};
+
+/// @brief Host data source counting the lookups by subnet and identifier.
+class CountingHostDataSource : public CfgHosts {
+public:
+
+    using CfgHosts::get4;
+
+    /// @brief Constructor.
+    CountingHostDataSource()
+        : lookups_(0) {
+    }
+
+    /// @brief Returns a host connected to the IPv4 subnet.
+    ///
+    /// Counts the lookups and forwards them to @c CfgHosts.
+    virtual ConstHostPtr
+    get4(const SubnetID& subnet_id, const Host::IdentifierType& identifier_type,
+         const uint8_t* identifier_begin, const size_t identifier_len) const {
+        ++lookups_;
+        return (CfgHosts::get4(subnet_id, identifier_type, identifier_begin,
+                               identifier_len));
+    }
+
+    /// @brief Number of lookups.
+    mutable int lookups_;
+};
+
+/// @brief Test fixture class for @c HostCache.
+class HostCacheTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Creates a host and removes the statistics.
+    HostCacheTest()
+        : host_(new Host("01:02:03:04:05:06", "hw-address", SubnetID(1),
+                         SubnetID(0), IOAddress("192.0.2.10"))) {
+        StatsMgr::instance().removeAll();
+        CfgMgr::instance().clear();
+        HostMgr::create();
+    }
+
+    /// @brief Destructor.
+    ///
+    /// Removes the statistics and the host data source.
+    ~HostCacheTest() {
+        StatsMgr::instance().removeAll();
+        HostMgr::create();
+    }
+
+    /// @brief Returns the value of an integer statistic.
+    ///
+    /// @param name name of the statistic
+    /// @return value of the statistic, -1 if it doesn't exist
+    int64_t getStatistic(const std::string& name) {
+        ObservationPtr observation = StatsMgr::instance().getObservation(name);
+        return (observation ? observation->getInteger().first : -1);
+    }
+
+    /// @brief Returns a cache key for a subnet and hardware address.
+    ///
+    /// @param subnet_id subnet identifier
+    /// @param hwaddr hardware address
+    HostCache::Key makeKey(const SubnetID& subnet_id,
+                           const std::vector<uint8_t>& hwaddr) {
+        HostCache::Key key("get4-identifier");
+        key.add(subnet_id).add(Host::IDENT_HWADDR, &hwaddr[0], hwaddr.size());
+        return (key);
+    }
+
+    /// @brief Host used in the tests.
+    HostPtr host_;
+};
+
+// This test verifies that the keys of different lookups are different.
+TEST_F(HostCacheTest, keys) {
+    const std::vector<uint8_t> id(6, 1);
+    EXPECT_EQ(makeKey(SubnetID(1), id).str(), makeKey(SubnetID(1), id).str());
+    EXPECT_NE(makeKey(SubnetID(1), id).str(), makeKey(SubnetID(2), id).str());
+
+    HostCache::Key duid("get4-identifier");
+    duid.add(SubnetID(1)).add(Host::IDENT_DUID, &id[0], id.size());
+    EXPECT_NE(makeKey(SubnetID(1), id).str(), duid.str());
+
+    HostCache::Key other("get6-identifier");
+    other.add(SubnetID(1)).add(Host::IDENT_HWADDR, &id[0], id.size());
+    EXPECT_NE(makeKey(SubnetID(1), id).str(), other.str());
+
+    // The byte strings are delimited by their length.
+    HostCache::Key split1("getAll");
+    split1.add(std::vector<uint8_t>(2, 1)).add(std::vector<uint8_t>(1, 1));
+    HostCache::Key split2("getAll");
+    split2.add(std::vector<uint8_t>(1, 1)).add(std::vector<uint8_t>(2, 1));
+    EXPECT_NE(split1.str(), split2.str());
+}
+
+// This test verifies that the positive and negative entries are returned
+// until they expire, and that the statistics are updated.
+TEST_F(HostCacheTest, expire) {
+    EXPECT_THROW(TestHostCache(0, 60, 10), BadValue);
+
+    TestHostCache cache(10, 60, 10);
+    const std::vector<uint8_t> id1(6, 1);
+    const std::vector<uint8_t> id2(6, 2);
+    ConstHostCollection hosts;
+    EXPECT_FALSE(cache.get(makeKey(SubnetID(1), id1), hosts));
+
+    cache.insert(makeKey(SubnetID(1), id1), ConstHostCollection(1, host_));
+    cache.insert(makeKey(SubnetID(1), id2), ConstHostCollection());
+    EXPECT_EQ(2, cache.size());
+    EXPECT_EQ(2, getStatistic("host-cache-size"));
+
+    ASSERT_TRUE(cache.get(makeKey(SubnetID(1), id1), hosts));
+    ASSERT_EQ(1, hosts.size());
+    EXPECT_EQ(host_, hosts[0]);
+    ASSERT_TRUE(cache.get(makeKey(SubnetID(1), id2), hosts));
+    EXPECT_TRUE(hosts.empty());
+
+    // The negative entry expires first.
+    cache.now_ += 10;
+    EXPECT_TRUE(cache.get(makeKey(SubnetID(1), id1), hosts));
+    EXPECT_FALSE(cache.get(makeKey(SubnetID(1), id2), hosts));
+    EXPECT_EQ(1, cache.size());
+
+    cache.now_ += 50;
+    EXPECT_FALSE(cache.get(makeKey(SubnetID(1), id1), hosts));
+    EXPECT_EQ(0, cache.size());
+
+    EXPECT_EQ(3, getStatistic("host-cache-hits"));
+    EXPECT_EQ(3, getStatistic("host-cache-misses"));
+    EXPECT_EQ(0, getStatistic("host-cache-size"));
+}
+
+// This test verifies that the least recently used entry is evicted when
+// the cache is full, and that the cache can be flushed.
+TEST_F(HostCacheTest, evict) {
+    TestHostCache cache(2, 60, 10);
+    const std::vector<uint8_t> id(6, 1);
+    ConstHostCollection hosts;
+    cache.insert(makeKey(SubnetID(1), id), ConstHostCollection(1, host_));
+    cache.insert(makeKey(SubnetID(2), id), ConstHostCollection());
+    // Use the first entry so the second one is the least recently used.
+    EXPECT_TRUE(cache.get(makeKey(SubnetID(1), id), hosts));
+
+    cache.insert(makeKey(SubnetID(3), id), ConstHostCollection());
+    EXPECT_EQ(2, cache.size());
+    EXPECT_TRUE(cache.get(makeKey(SubnetID(1), id), hosts));
+    EXPECT_FALSE(cache.get(makeKey(SubnetID(2), id), hosts));
+    EXPECT_TRUE(cache.get(makeKey(SubnetID(3), id), hosts));
+
+    // Inserting an existing key replaces the entry.
+    cache.insert(makeKey(SubnetID(3), id), ConstHostCollection(1, host_));
+    EXPECT_EQ(2, cache.size());
+    ASSERT_TRUE(cache.get(makeKey(SubnetID(3), id), hosts));
+    EXPECT_EQ(1, hosts.size());
+
+    EXPECT_EQ(2, cache.flush());
+    EXPECT_EQ(0, cache.size());
+    EXPECT_FALSE(cache.get(makeKey(SubnetID(1), id), hosts));
+}
+
+// This test verifies that the host manager caches the lookups in the
+// alternate host data source, and flushes the cache when hosts are added.
+TEST_F(HostCacheTest, hostMgr) {
+    boost::shared_ptr<CountingHostDataSource>
+        source(new CountingHostDataSource());
+    HostMgr& host_mgr = HostMgr::instance();
+    host_mgr.setTestHostDataSource(source);
+    EXPECT_THROW(host_mgr.flushCache(), NoHostCache);
+    host_mgr.setHostCache(HostCachePtr(new HostCache(100, 60, 10)));
+
+    const std::vector<uint8_t>& id = host_->getIdentifier();
+    EXPECT_FALSE(host_mgr.get4(SubnetID(1), Host::IDENT_HWADDR, &id[0],
+                               id.size()));
+    EXPECT_FALSE(host_mgr.get4(SubnetID(1), Host::IDENT_HWADDR, &id[0],
+                               id.size()));
+    EXPECT_EQ(1, source->lookups_);
+
+    // Adding a host flushes the negative entry.
+    host_mgr.add(host_);
+    EXPECT_TRUE(host_mgr.get4(SubnetID(1), Host::IDENT_HWADDR, &id[0],
+                              id.size()));
+    EXPECT_TRUE(host_mgr.get4(SubnetID(1), Host::IDENT_HWADDR, &id[0],
+                              id.size()));
+    EXPECT_EQ(2, source->lookups_);
+
+    // Another subnet is another lookup.
+    EXPECT_FALSE(host_mgr.get4(SubnetID(2), Host::IDENT_HWADDR, &id[0],
+                               id.size()));
+    EXPECT_EQ(3, source->lookups_);
+
+    EXPECT_EQ(2, host_mgr.flushCache());
+    EXPECT_TRUE(host_mgr.get4(SubnetID(1), Host::IDENT_HWADDR, &id[0],
+                              id.size()));
+    EXPECT_EQ(4, source->lookups_);
+}
+
+} // end of anonymous namespace
@@ -0,0 +1,162 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/lease_bitmap.h>
+#include <exceptions/exceptions.h>
+
+#include <gtest/gtest.h>
+
+#include <set>
+
+using namespace isc;
+using namespace isc::dhcp;
+
+namespace {
+
+// Checks that the bitmap can be created only with a valid capacity.
+TEST(LeaseBitmapTest, constructor) {
+    EXPECT_THROW(LeaseBitmap(0), BadValue);
+    EXPECT_THROW(LeaseBitmap(LeaseBitmap::MAX_CAPACITY + 1), BadValue);
+
+    LeaseBitmap bitmap(100);
+    EXPECT_EQ(100, bitmap.getCapacity());
+    EXPECT_EQ(100, bitmap.getFreeCount());
+    EXPECT_FALSE(bitmap.isSeeded());
+    for (uint64_t i = 0; i < 100; ++i) {
+        EXPECT_FALSE(bitmap.isUsed(i));
+    }
+}
+
+// Checks that the addresses can be marked as used and free.
+TEST(LeaseBitmapTest, setUsedAndFree) {
+    LeaseBitmap bitmap(100);
+
+    ASSERT_NO_THROW(bitmap.setUsed(0));
+    ASSERT_NO_THROW(bitmap.setUsed(63));
+    ASSERT_NO_THROW(bitmap.setUsed(64));
+    ASSERT_NO_THROW(bitmap.setUsed(99));
+    EXPECT_TRUE(bitmap.isUsed(0));
+    EXPECT_TRUE(bitmap.isUsed(63));
+    EXPECT_TRUE(bitmap.isUsed(64));
+    EXPECT_TRUE(bitmap.isUsed(99));
+    EXPECT_FALSE(bitmap.isUsed(1));
+    EXPECT_EQ(96, bitmap.getFreeCount());
+
+    // Marking the address as used twice doesn't change the counter.
+    ASSERT_NO_THROW(bitmap.setUsed(63));
+    EXPECT_EQ(96, bitmap.getFreeCount());
+
+    ASSERT_NO_THROW(bitmap.setFree(63));
+    EXPECT_FALSE(bitmap.isUsed(63));
+    EXPECT_EQ(97, bitmap.getFreeCount());
+
+    // The same applies to marking the address as free.
+    ASSERT_NO_THROW(bitmap.setFree(63));
+    EXPECT_EQ(97, bitmap.getFreeCount());
+
+    EXPECT_THROW(bitmap.setUsed(100), OutOfRange);
+    EXPECT_THROW(bitmap.setFree(100), OutOfRange);
+    EXPECT_THROW(bitmap.isUsed(100), OutOfRange);
+}
+
+// Checks that the free addresses are found starting at the specified
+// position and wrapping around at the end of the bitmap.
+TEST(LeaseBitmapTest, findFree) {
+    LeaseBitmap bitmap(200);
+    uint64_t index = 0;
+
+    ASSERT_TRUE(bitmap.findFree(10, index));
+    EXPECT_EQ(10, index);
+
+    // The start position is adjusted to the capacity.
+    ASSERT_TRUE(bitmap.findFree(210, index));
+    EXPECT_EQ(10, index);
+
+    // Use all addresses but a few.
+    for (uint64_t i = 0; i < 200; ++i) {
+        if ((i != 5) && (i != 150)) {
+            bitmap.setUsed(i);
+        }
+    }
+    EXPECT_EQ(2, bitmap.getFreeCount());
+
+    ASSERT_TRUE(bitmap.findFree(0, index));
+    EXPECT_EQ(5, index);
+    ASSERT_TRUE(bitmap.findFree(6, index));
+    EXPECT_EQ(150, index);
+    ASSERT_TRUE(bitmap.findFree(151, index));
+    EXPECT_EQ(5, index);
+
+    // Use the remaining addresses. No free address should be found.
+    bitmap.setUsed(5);
+    bitmap.setUsed(150);
+    EXPECT_EQ(0, bitmap.getFreeCount());
+    EXPECT_FALSE(bitmap.findFree(0, index));
+
+    // Free one address and make sure it is found.
+    bitmap.setFree(199);
+    ASSERT_TRUE(bitmap.findFree(0, index));
+    EXPECT_EQ(199, index);
+}
+
+// Checks that the search over a large bitmap returns all free addresses
+// and that the addresses beyond the capacity are never returned.
+TEST(LeaseBitmapTest, findFreeLarge) {
+    const uint64_t capacity = 64 * 64 * 3 + 17;
+    LeaseBitmap bitmap(capacity);
+
+    std::set<uint64_t> found;
+    uint64_t index = 0;
+    while (bitmap.findFree(0, index)) {
+        ASSERT_LT(index, capacity);
+        ASSERT_TRUE(found.insert(index).second);
+        bitmap.setUsed(index);
+    }
+    EXPECT_EQ(capacity, found.size());
+    EXPECT_EQ(0, bitmap.getFreeCount());
+
+    // Free an address at the end of the bitmap and search from the
+    // beginning.
+    bitmap.setFree(capacity - 1);
+    ASSERT_TRUE(bitmap.findFree(0, index));
+    EXPECT_EQ(capacity - 1, index);
+
+    // Free an address at the beginning and search from the end.
+    bitmap.setUsed(capacity - 1);
+    bitmap.setFree(3);
+    ASSERT_TRUE(bitmap.findFree(capacity - 1, index));
+    EXPECT_EQ(3, index);
+}
+
+// Checks that only one caller is allowed to seed the bitmap.
+TEST(LeaseBitmapTest, seeding) {
+    LeaseBitmap bitmap(10);
+    EXPECT_TRUE(bitmap.beginSeeding());
+    EXPECT_FALSE(bitmap.beginSeeding());
+    EXPECT_FALSE(bitmap.isSeeded());
+    bitmap.endSeeding();
+    EXPECT_TRUE(bitmap.isSeeded());
+    EXPECT_FALSE(bitmap.beginSeeding());
+}
+
+// Checks that the bitmap can be seeded again after seeding has failed.
+TEST(LeaseBitmapTest, abortSeeding) {
+    LeaseBitmap bitmap(10);
+    ASSERT_TRUE(bitmap.beginSeeding());
+    bitmap.setUsed(3);
+    bitmap.abortSeeding();
+    EXPECT_FALSE(bitmap.isSeeded());
+    EXPECT_FALSE(bitmap.isUsed(3));
+    EXPECT_EQ(10, bitmap.getFreeCount());
+
+    EXPECT_TRUE(bitmap.beginSeeding());
+    bitmap.endSeeding();
+    EXPECT_TRUE(bitmap.isSeeded());
+}
+
+} // end of anonymous namespace
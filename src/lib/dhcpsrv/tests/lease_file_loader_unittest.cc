@@ -130,6 +130,53 @@ public:
         EXPECT_EQ(write_errs, lease_file.getWriteErrs());
     }
 
+    /// @brief Checks that the leases are loaded by multiple threads as
+    /// they are loaded by a single thread.
+    ///
+    /// This method loads the leases from the lease file with the
+    /// @c LeaseFileLoader::load and then with the
+    /// @c LeaseFileLoader::loadParallel using different numbers of threads.
+    /// The minimum chunk size is set to 1 byte so as the file is split into
+    /// as many chunks as threads. The loaded leases and the read statistics
+    /// must be equal.
+    ///
+    /// @param max_errors Maximum number of errors.
+    /// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
+    /// @tparam LeaseFileType A @c CSVLeaseFile4 or @c CSVLeaseFile6.
+    /// @tparam StorageType A @c Lease4Storage or @c Lease6Storage.
+    template<typename LeaseObjectType, typename LeaseFileType,
+             typename StorageType>
+    void checkParallelLoad(const uint32_t max_errors) {
+        LeaseFileType lf(filename_);
+        StorageType expected;
+        ASSERT_NO_THROW(LeaseFileLoader::load<LeaseObjectType>(lf, expected,
+                                                               max_errors));
+
+        for (size_t threads = 1; threads <= 4; ++threads) {
+            std::ostringstream s;
+            s << "threads: " << threads;
+            SCOPED_TRACE(s.str());
+
+            LeaseFileType parallel_lf(filename_);
+            StorageType storage;
+            ASSERT_NO_THROW(LeaseFileLoader::loadParallel<LeaseObjectType>
+                            (parallel_lf, storage, max_errors, true,
+                             threads, 1));
+
+            checkStats(parallel_lf, lf.getReads(), lf.getReadLeases(),
+                       lf.getReadErrs(), 0, 0, 0);
+
+            ASSERT_EQ(expected.size(), storage.size());
+            for (typename StorageType::const_iterator lease = expected.begin();
+                 lease != expected.end(); ++lease) {
+                typename StorageType::const_iterator loaded =
+                    storage.find((*lease)->addr_);
+                ASSERT_TRUE(loaded != storage.end());
+                EXPECT_TRUE(**loaded == **lease);
+            }
+        }
+    }
+
     /// @brief Name of the test lease file.
     std::string filename_;
 
@@ -531,4 +578,103 @@ TEST_F(LeaseFileLoaderTest, loadWriteLeaseWithZeroLifetime) {
     checkStats(*lf, 0, 0, 0, 1, 1, 0);
     }
 }
+
+// This test verifies that the DHCPv4 leases loaded by multiple threads
+// are the same as the leases loaded by a single thread, including the
+// updates and removals of the leases found in different chunks.
+TEST_F(LeaseFileLoaderTest, loadParallel4) {
+    std::string a_1 = "192.0.2.1,06:07:08:09:0a:bc,,"
+                      "200,200,8,1,1,host.example.com,1\n";
+    std::string a_2 = "192.0.2.1,06:07:08:09:0a:bc,,"
+                      "200,500,8,1,1,host.example.com,1\n";
+    std::string a_3 = "192.0.2.1,06:07:08:09:0a:bc,,"
+                      "0,500,8,1,1,host.example.com,1\n";
+
+    std::string b_1 = "192.0.3.15,dd:de:ba:0d:1b:2e:3e:4f,0a:00:01:04,"
+                      "100,100,7,0,0,,1\n";
+    std::string b_2 = "192.0.3.15,dd:de:ba:0d:1b:2e:3e:4f,0a:00:01:04,"
+                      "100,135,7,0,0,,1\n";
+
+    std::string c_1 = "192.0.2.3,,a:11:01:04,"
+                      "200,200,8,1,1,host.example.com,0\n";
+
+    std::string d_1 = "192.0.2.10,01:02:03:04:05:06,,200,300,8,1,1,,1\n";
+    std::string d_2 = "192.0.2.10,01:02:03:04:05:06,,0,300,8,1,1,,1\n";
+    std::string d_3 = "192.0.2.10,01:02:03:04:05:06,,200,400,8,1,1,,1\n";
+
+    // The 192.0.2.1 lease is removed, the 192.0.2.10 lease is removed and
+    // added again, the 192.0.2.3 entries are invalid. The last row is not
+    // terminated and it should be ignored.
+    io_.writeFile(v4_hdr_ + a_1 + b_1 + d_1 + c_1 + a_2 + d_2 + b_2 + c_1 +
+                  a_3 + d_3 + "192.0.2.20,01:02:03");
+
+    checkParallelLoad<Lease4, CSVLeaseFile4, Lease4Storage>(10);
+}
+
+// This test verifies that the DHCPv6 leases loaded by multiple threads
+// are the same as the leases loaded by a single thread.
+TEST_F(LeaseFileLoaderTest, loadParallel6) {
+    std::string a_1 = "2001:db8:1::1,00:01:02:03:04:05:06:0a:0b:0c:0d:0e:0f,"
+                      "200,200,8,100,0,7,0,1,1,host.example.com,,1\n";
+    std::string a_2 = "2001:db8:1::1,,"
+                      "200,200,8,100,0,7,0,1,1,host.example.com,,1\n";
+    std::string a_3 = "2001:db8:1::1,00:01:02:03:04:05:06:0a:0b:0c:0d:0e:0f,"
+                      "200,400,8,100,0,7,0,1,1,host.example.com,,1\n";
+
+    std::string b_1 = "2001:db8:2::10,01:01:01:01:0a:01:02:03:04:05,"
+                      "300,300,6,150,0,8,0,0,0,,,1\n";
+    std::string b_2 = "2001:db8:2::10,01:01:01:01:0a:01:02:03:04:05,"
+                      "0,800,6,150,0,8,0,0,0,,,1\n";
+
+    std::string c_1 = "3000:1::,00:01:02:03:04:05:06:0a:0b:0c:0d:0e:0f,"
+                      "100,200,8,0,2,16,64,0,0,,,1\n";
+
+    io_.writeFile(v6_hdr_ + a_1 + a_2 + b_1 + c_1 + b_2 + a_3);
+
+    checkParallelLoad<Lease6, CSVLeaseFile6, Lease6Storage>(10);
+}
+
+// This test verifies that the exception is thrown when the number of
+// errors found by all threads exceeds the maximum number of errors.
+TEST_F(LeaseFileLoaderTest, loadParallelMaxErrors) {
+    std::string a_1 = "192.0.2.1,06:07:08:09:0a:bc,,"
+                      "200,200,8,1,1,host.example.com,1\n";
+    std::string b_1 = "192.0.2.3,,a:11:01:04,200,200,8,1,1,host.example.com,0\n";
+    std::string c_1 = "192.0.2.10,01:02:03:04:05:06,,200,300,8,1,1,,1\n";
+
+    io_.writeFile(v4_hdr_ + a_1 + b_1 + b_1 + c_1 + b_1 + b_1);
+
+    CSVLeaseFile4 lf(filename_);
+    Lease4Storage storage;
+    EXPECT_THROW(LeaseFileLoader::loadParallel<Lease4>(lf, storage, 3, true,
+                                                       3, 1),
+                 util::CSVFileError);
+
+    checkParallelLoad<Lease4, CSVLeaseFile4, Lease4Storage>(4);
+}
+
+// This test verifies that the leases can be loaded from the lease file
+// holding the header only and that the file is left open when requested.
+TEST_F(LeaseFileLoaderTest, loadParallelEmpty) {
+    io_.writeFile(v4_hdr_);
+
+    CSVLeaseFile4 lf(filename_);
+    Lease4Storage storage;
+    ASSERT_NO_THROW(LeaseFileLoader::loadParallel<Lease4>(lf, storage, 0,
+                                                          false, 4, 1));
+    EXPECT_TRUE(storage.empty());
+    checkStats(lf, 1, 0, 0, 0, 0, 0);
+
+    // The file should be open for writing.
+    Lease4Ptr lease(new Lease4(IOAddress("192.0.2.1"),
+                               HWAddrPtr(new HWAddr(HWAddr::fromText("01:02:03:04:05:06"))),
+                               ClientIdPtr(), 200, 50, 80, 0, 8));
+    ASSERT_NO_THROW(lf.append(*lease));
+    lf.close();
+
+    ASSERT_NO_THROW(LeaseFileLoader::loadParallel<Lease4>(lf, storage, 0,
+                                                          true, 4, 1));
+    ASSERT_EQ(1, storage.size());
+}
+
 } // end of anonymous namespace
@@ -15,6 +15,7 @@
 #include <gtest/gtest.h>
 
 #include <iostream>
+#include <limits>
 #include <sstream>
 
 #include <time.h>
@@ -336,6 +337,17 @@ TEST_F(LeaseMgrTest, getLease6) {
                  MultipleRecords);
 }
 
+// This test checks that the page size of the paged lease queries is
+// validated.
+TEST(LeasePageSizeTest, construction) {
+    EXPECT_THROW(LeasePageSize(0), OutOfRange);
+    EXPECT_THROW(LeasePageSize(std::numeric_limits<uint32_t>::max() + 1ull),
+                 OutOfRange);
+
+    LeasePageSize page_size(1000);
+    EXPECT_EQ(1000, page_size.page_size_);
+}
+
 // There's no point in calling any other methods in LeaseMgr, as they
 // are purely virtual, so we would only call ConcreteLeaseMgr methods.
 // Those methods are just stubs that do not return anything.
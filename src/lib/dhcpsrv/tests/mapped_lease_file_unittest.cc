@@ -0,0 +1,145 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/mapped_lease_file.h>
+#include <dhcpsrv/tests/lease_file_io.h>
+#include <util/csv_file.h>
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace isc;
+using namespace isc::dhcp;
+using namespace isc::dhcp::test;
+
+namespace {
+
+/// @brief Test fixture class for the @c MappedLeaseFile.
+class MappedLeaseFileTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Removes the test file.
+    MappedLeaseFileTest()
+        : filename_(absolutePath("mapped-leases.csv")), io_(filename_) {
+        io_.removeFile();
+    }
+
+    /// @brief Destructor.
+    ///
+    /// Removes the test file.
+    virtual ~MappedLeaseFileTest() {
+        io_.removeFile();
+    }
+
+    /// @brief Returns the absolute path to the file in the test directory.
+    ///
+    /// @param filename Name of the file.
+    static std::string absolutePath(const std::string& filename) {
+        std::ostringstream s;
+        s << TEST_DATA_BUILDDIR << "/" << filename;
+        return (s.str());
+    }
+
+    /// @brief Returns the text of the chunks.
+    ///
+    /// @param chunks Chunks returned by the @c MappedLeaseFile::split.
+    static std::vector<std::string>
+    toText(const std::vector<MappedLeaseFile::Chunk>& chunks) {
+        std::vector<std::string> text;
+        for (size_t i = 0; i < chunks.size(); ++i) {
+            text.push_back(std::string(chunks[i].begin_, chunks[i].end_));
+        }
+        return (text);
+    }
+
+    /// @brief Name of the test file.
+    std::string filename_;
+
+    /// @brief Object providing access to the test file.
+    LeaseFileIO io_;
+};
+
+// Checks that the error is reported when the file doesn't exist.
+TEST_F(MappedLeaseFileTest, nonExisting) {
+    EXPECT_THROW(MappedLeaseFile("/no/such/directory/leases.csv"),
+                 util::CSVFileError);
+}
+
+// Checks that there are no chunks when the file has no data rows.
+TEST_F(MappedLeaseFileTest, noRows) {
+    io_.writeFile("");
+    {
+        MappedLeaseFile file(filename_);
+        EXPECT_EQ(0, file.getSize());
+        EXPECT_TRUE(file.split(4, 1).empty());
+    }
+
+    io_.writeFile("address,state\n");
+    {
+        MappedLeaseFile file(filename_);
+        EXPECT_EQ(14, file.getSize());
+        EXPECT_TRUE(file.split(4, 1).empty());
+    }
+
+    // The unterminated row is not included.
+    io_.writeFile("address,state\n192.0.2.1");
+    {
+        MappedLeaseFile file(filename_);
+        EXPECT_TRUE(file.split(4, 1).empty());
+    }
+}
+
+// Checks that the rows are split into chunks holding complete rows.
+TEST_F(MappedLeaseFileTest, split) {
+    io_.writeFile("address,state\n"
+                  "192.0.2.1,0\n"
+                  "192.0.2.2,0\n"
+                  "192.0.2.3,0\n"
+                  "192.0.2.4,0\n"
+                  "192.0.2.5");
+    MappedLeaseFile file(filename_);
+
+    // Single chunk holds all complete rows.
+    std::vector<std::string> chunks = toText(file.split(1, 1));
+    ASSERT_EQ(1, chunks.size());
+    EXPECT_EQ("192.0.2.1,0\n192.0.2.2,0\n192.0.2.3,0\n192.0.2.4,0\n",
+              chunks[0]);
+
+    // Each chunk holds two rows.
+    chunks = toText(file.split(2, 1));
+    ASSERT_EQ(2, chunks.size());
+    EXPECT_EQ("192.0.2.1,0\n192.0.2.2,0\n", chunks[0]);
+    EXPECT_EQ("192.0.2.3,0\n192.0.2.4,0\n", chunks[1]);
+
+    // The chunk is extended to the end of the row, which may result in
+    // fewer chunks than requested.
+    chunks = toText(file.split(3, 1));
+    ASSERT_EQ(2, chunks.size());
+    EXPECT_EQ("192.0.2.1,0\n192.0.2.2,0\n", chunks[0]);
+    EXPECT_EQ("192.0.2.3,0\n192.0.2.4,0\n", chunks[1]);
+
+    // There are no empty chunks when there are more chunks than rows.
+    chunks = toText(file.split(10, 1));
+    ASSERT_EQ(4, chunks.size());
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        EXPECT_EQ(12, chunks[i].size());
+    }
+
+    // The minimum chunk size limits the number of chunks.
+    chunks = toText(file.split(4, 24));
+    ASSERT_EQ(2, chunks.size());
+    chunks = toText(file.split(4, 1024));
+    ASSERT_EQ(1, chunks.size());
+}
+
+} // end of anonymous namespace
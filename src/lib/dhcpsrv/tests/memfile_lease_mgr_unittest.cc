@@ -21,16 +21,20 @@
 #include <util/pid_file.h>
 #include <util/range_utilities.h>
 #include <util/stopwatch.h>
+#include <util/threads/thread.h>
 
 #include <boost/bind.hpp>
 #include <gtest/gtest.h>
 
+#include <csignal>
 #include <cstdlib>
 #include <iostream>
 #include <fstream>
 #include <queue>
 #include <sstream>
+#include <vector>
 #include <unistd.h>
+#include <sys/resource.h>
 
 using namespace std;
 using namespace isc;
@@ -104,7 +108,7 @@ public:
         io4_(getLeaseFilePath("leasefile4_0.csv")),
         io6_(getLeaseFilePath("leasefile6_0.csv")),
         io_service_(new IOService()),
-        timer_mgr_(TimerMgr::instance()) {
+        timer_mgr_(TimerMgr::instance()), packed_(false) {
 
         timer_mgr_->setIOService(io_service_);
 
@@ -198,7 +202,8 @@ public:
     /// @param u Universe (v4 or V6).
     void startBackend(Universe u) {
         try {
-            LeaseMgrFactory::create(getConfigString(u));
+            LeaseMgrFactory::create(getConfigString(u) +
+                                    (packed_ ? " packed=true" : ""));
         } catch (...) {
             std::cerr << "*** ERROR: unable to create instance of the Memfile\n"
                 " lease database backend.\n";
@@ -354,6 +359,21 @@ public:
 
     /// @brief Pointer to the instance of the @c TimerMgr.
     TimerMgrPtr timer_mgr_;
+
+    /// @brief Indicates if the DHCPv4 leases should be held in the packed
+    /// storage.
+    bool packed_;
+};
+
+/// @brief Test fixture class for @c Memfile_LeaseMgr using packed storage
+/// for the DHCPv4 leases.
+class MemfilePackedLeaseMgrTest : public MemfileLeaseMgrTest {
+public:
+
+    /// @brief Constructor.
+    MemfilePackedLeaseMgrTest() {
+        packed_ = true;
+    }
 };
 
 // This test checks if the LeaseMgr can be instantiated and that it
@@ -650,6 +670,285 @@ TEST_F(MemfileLeaseMgrTest, leaseFileCleanup6) {
     EXPECT_EQ(result_file_contents, input_file.readFile());
 }
 
+// This test checks that the in-process cleanup of the DHCPv4 lease file
+// produces the same files as the kea-lfc.
+TEST_F(MemfileLeaseMgrTest, leaseFileCleanupInProcess4) {
+    std::string new_file_contents =
+        "address,hwaddr,client_id,valid_lifetime,expire,"
+        "subnet_id,fqdn_fwd,fqdn_rev,hostname,state\n";
+
+    std::string current_file_contents = new_file_contents +
+        "192.0.2.2,02:02:02:02:02:02,,200,200,8,1,1,,1\n"
+        "192.0.2.2,02:02:02:02:02:02,,200,800,8,1,1,,1\n";
+    LeaseFileIO current_file(getLeaseFilePath("leasefile4_0.csv"));
+    current_file.writeFile(current_file_contents);
+
+    std::string previous_file_contents = new_file_contents +
+        "192.0.2.3,03:03:03:03:03:03,,200,200,8,1,1,,1\n"
+        "192.0.2.3,03:03:03:03:03:03,,200,800,8,1,1,,1\n";
+    LeaseFileIO previous_file(getLeaseFilePath("leasefile4_0.csv.2"));
+    previous_file.writeFile(previous_file_contents);
+
+    // Create the backend performing the cleanup with one lease per batch.
+    DatabaseConnection::ParameterMap pmap;
+    pmap["type"] = "memfile";
+    pmap["universe"] = "4";
+    pmap["name"] = getLeaseFilePath("leasefile4_0.csv");
+    pmap["lfc-interval"] = "1";
+    pmap["lfc-in-process"] = "true";
+    pmap["lfc-batch-size"] = "1";
+    boost::scoped_ptr<NakedMemfileLeaseMgr> lease_mgr(new NakedMemfileLeaseMgr(pmap));
+
+    ASSERT_NO_THROW(lease_mgr->lfcCallback());
+
+    // The new lease file should have been created and it should contain
+    // no leases.
+    ASSERT_TRUE(current_file.exists());
+    EXPECT_EQ(new_file_contents, current_file.readFile());
+
+    ASSERT_TRUE(waitForProcess(*lease_mgr, 2));
+    EXPECT_EQ(0, lease_mgr->getLFCExitStatus());
+
+    // The lease added after the cleanup has started goes to the new
+    // lease file only.
+    std::vector<uint8_t> hwaddr_vec(6);
+    HWAddrPtr hwaddr(new HWAddr(hwaddr_vec, HTYPE_ETHER));
+    Lease4Ptr new_lease(new Lease4(IOAddress("192.0.2.45"), hwaddr, 0, 0,
+                                   100, 50, 60, 0, 1));
+    ASSERT_NO_THROW(lease_mgr->addLease(new_lease));
+    EXPECT_EQ(new_file_contents +
+              "192.0.2.45,00:00:00:00:00:00,,100,100,1,0,0,,0\n",
+              current_file.readFile());
+
+    // The leases held in memory should have been written to the previous
+    // lease file and the other files should have been removed.
+    std::string result_file_contents = new_file_contents +
+        "192.0.2.2,02:02:02:02:02:02,,200,800,8,1,1,,1\n"
+        "192.0.2.3,03:03:03:03:03:03,,200,800,8,1,1,,1\n";
+    EXPECT_EQ(result_file_contents, previous_file.readFile());
+    EXPECT_FALSE(LeaseFileIO(getLeaseFilePath("leasefile4_0.csv.1"),
+                             false).exists());
+    EXPECT_FALSE(LeaseFileIO(getLeaseFilePath("leasefile4_0.csv.output"),
+                             false).exists());
+    EXPECT_FALSE(LeaseFileIO(getLeaseFilePath("leasefile4_0.csv.pid"),
+                             false).exists());
+}
+
+// This test checks that the in-process cleanup of the DHCPv6 lease file
+// produces the same files as the kea-lfc.
+TEST_F(MemfileLeaseMgrTest, leaseFileCleanupInProcess6) {
+    std::string new_file_contents =
+        "address,duid,valid_lifetime,expire,subnet_id,"
+        "pref_lifetime,lease_type,iaid,prefix_len,fqdn_fwd,"
+        "fqdn_rev,hostname,hwaddr,state\n";
+
+    std::string current_file_contents = new_file_contents +
+        "2001:db8:1::1,00:01:02:03:04:05:06:0a:0b:0c:0d:0e:0f,200,200,"
+        "8,100,0,7,0,1,1,,,1\n"
+        "2001:db8:1::1,00:01:02:03:04:05:06:0a:0b:0c:0d:0e:0f,200,800,"
+        "8,100,0,7,0,1,1,,,1\n";
+    LeaseFileIO current_file(getLeaseFilePath("leasefile6_0.csv"));
+    current_file.writeFile(current_file_contents);
+
+    std::string previous_file_contents = new_file_contents +
+        "2001:db8:1::2,01:01:01:01:01:01:01:01:01:01:01:01:01,200,200,"
+        "8,100,0,7,0,1,1,,,1\n"
+        "2001:db8:1::2,01:01:01:01:01:01:01:01:01:01:01:01:01,200,800,"
+        "8,100,0,7,0,1,1,,,1\n";
+    LeaseFileIO previous_file(getLeaseFilePath("leasefile6_0.csv.2"));
+    previous_file.writeFile(previous_file_contents);
+
+    DatabaseConnection::ParameterMap pmap;
+    pmap["type"] = "memfile";
+    pmap["universe"] = "6";
+    pmap["name"] = getLeaseFilePath("leasefile6_0.csv");
+    pmap["lfc-interval"] = "1";
+    pmap["lfc-in-process"] = "true";
+    boost::scoped_ptr<NakedMemfileLeaseMgr> lease_mgr(new NakedMemfileLeaseMgr(pmap));
+
+    ASSERT_NO_THROW(lease_mgr->lfcCallback());
+    ASSERT_TRUE(waitForProcess(*lease_mgr, 2));
+    EXPECT_EQ(0, lease_mgr->getLFCExitStatus());
+
+    EXPECT_EQ(new_file_contents, current_file.readFile());
+
+    std::string result_file_contents = new_file_contents +
+        "2001:db8:1::1,00:01:02:03:04:05:06:0a:0b:0c:0d:0e:0f,200,800,"
+        "8,100,0,7,0,1,1,,,1\n"
+        "2001:db8:1::2,01:01:01:01:01:01:01:01:01:01:01:01:01,200,800,"
+        "8,100,0,7,0,1,1,,,1\n";
+    EXPECT_EQ(result_file_contents, previous_file.readFile());
+    EXPECT_FALSE(LeaseFileIO(getLeaseFilePath("leasefile6_0.csv.1"),
+                             false).exists());
+}
+
+// This test checks that the leases updated while the in-process cleanup
+// writes the leases in batches are correctly loaded after the cleanup.
+TEST_F(MemfileLeaseMgrTest, leaseFileCleanupInProcessIncremental) {
+    std::string new_file_contents =
+        "address,hwaddr,client_id,valid_lifetime,expire,"
+        "subnet_id,fqdn_fwd,fqdn_rev,hostname,state\n";
+    LeaseFileIO current_file(getLeaseFilePath("leasefile4_0.csv"));
+    current_file.writeFile(new_file_contents +
+        "192.0.2.1,01:01:01:01:01:01,,200,200,8,1,1,,1\n"
+        "192.0.2.2,02:02:02:02:02:02,,200,200,8,1,1,,1\n"
+        "192.0.2.3,03:03:03:03:03:03,,200,200,8,1,1,,1\n"
+        "192.0.2.4,04:04:04:04:04:04,,200,200,8,1,1,,1\n");
+
+    // Pause after each lease, so as the leases can be updated while the
+    // cleanup is in progress.
+    DatabaseConnection::ParameterMap pmap;
+    pmap["type"] = "memfile";
+    pmap["universe"] = "4";
+    pmap["name"] = getLeaseFilePath("leasefile4_0.csv");
+    pmap["lfc-interval"] = "1";
+    pmap["lfc-in-process"] = "true";
+    pmap["lfc-batch-size"] = "1";
+    pmap["lfc-batch-interval"] = "100";
+    boost::scoped_ptr<NakedMemfileLeaseMgr> lease_mgr(new NakedMemfileLeaseMgr(pmap));
+
+    ASSERT_NO_THROW(lease_mgr->lfcCallback());
+    EXPECT_TRUE(lease_mgr->isLFCRunning());
+
+    // The cleanup in progress should not be started again.
+    ASSERT_NO_THROW(lease_mgr->lfcCallback());
+
+    // Update the last lease and remove the third lease.
+    Lease4Ptr lease = lease_mgr->getLease4(IOAddress("192.0.2.4"));
+    ASSERT_TRUE(lease);
+    lease->hostname_ = "updated.example.org";
+    ASSERT_NO_THROW(lease_mgr->updateLease4(lease));
+    ASSERT_TRUE(lease_mgr->deleteLease(IOAddress("192.0.2.3")));
+
+    ASSERT_TRUE(waitForProcess(*lease_mgr, 5));
+    EXPECT_EQ(0, lease_mgr->getLFCExitStatus());
+
+    // Reload the leases from the files.
+    lease_mgr.reset();
+    lease_mgr.reset(new NakedMemfileLeaseMgr(pmap));
+    EXPECT_TRUE(lease_mgr->getLease4(IOAddress("192.0.2.1")));
+    EXPECT_TRUE(lease_mgr->getLease4(IOAddress("192.0.2.2")));
+    EXPECT_FALSE(lease_mgr->getLease4(IOAddress("192.0.2.3")));
+    lease = lease_mgr->getLease4(IOAddress("192.0.2.4"));
+    ASSERT_TRUE(lease);
+    EXPECT_EQ("updated.example.org", lease->hostname_);
+}
+
+// This test checks that the in-process cleanup is interrupted when the
+// backend is destroyed and that invalid settings are rejected.
+TEST_F(MemfileLeaseMgrTest, leaseFileCleanupInProcessStop) {
+    std::string new_file_contents =
+        "address,hwaddr,client_id,valid_lifetime,expire,"
+        "subnet_id,fqdn_fwd,fqdn_rev,hostname,state\n";
+    LeaseFileIO current_file(getLeaseFilePath("leasefile4_0.csv"));
+    current_file.writeFile(new_file_contents +
+        "192.0.2.1,01:01:01:01:01:01,,200,200,8,1,1,,1\n"
+        "192.0.2.2,02:02:02:02:02:02,,200,200,8,1,1,,1\n");
+
+    DatabaseConnection::ParameterMap pmap;
+    pmap["type"] = "memfile";
+    pmap["universe"] = "4";
+    pmap["name"] = getLeaseFilePath("leasefile4_0.csv");
+    pmap["lfc-interval"] = "1";
+    pmap["lfc-in-process"] = "true";
+    pmap["lfc-batch-size"] = "0";
+    boost::scoped_ptr<NakedMemfileLeaseMgr> lease_mgr;
+    EXPECT_THROW(lease_mgr.reset(new NakedMemfileLeaseMgr(pmap)), BadValue);
+
+    pmap["lfc-batch-size"] = "1";
+    pmap["lfc-batch-interval"] = "-1";
+    EXPECT_THROW(lease_mgr.reset(new NakedMemfileLeaseMgr(pmap)), BadValue);
+
+    // The long pause after the first lease keeps the cleanup running until
+    // the backend is destroyed.
+    pmap["lfc-batch-interval"] = "60000";
+    ASSERT_NO_THROW(lease_mgr.reset(new NakedMemfileLeaseMgr(pmap)));
+    ASSERT_NO_THROW(lease_mgr->lfcCallback());
+    EXPECT_TRUE(lease_mgr->isLFCRunning());
+    lease_mgr.reset();
+
+    // The lease file copy remains and the leases are loaded from it.
+    EXPECT_TRUE(LeaseFileIO(getLeaseFilePath("leasefile4_0.csv.1"),
+                            false).exists());
+    EXPECT_FALSE(LeaseFileIO(getLeaseFilePath("leasefile4_0.csv.pid"),
+                             false).exists());
+    ASSERT_NO_THROW(lease_mgr.reset(new NakedMemfileLeaseMgr(pmap)));
+    EXPECT_TRUE(lease_mgr->getLease4(IOAddress("192.0.2.1")));
+    EXPECT_TRUE(lease_mgr->getLease4(IOAddress("192.0.2.2")));
+}
+
+// This test checks that the in-process cleanup converts the CSV lease
+// files into the binary snapshot and that the leases are loaded from it.
+TEST_F(MemfileLeaseMgrTest, leaseFileCleanupInProcessBinary) {
+    std::string new_file_contents =
+        "address,duid,valid_lifetime,expire,subnet_id,"
+        "pref_lifetime,lease_type,iaid,prefix_len,fqdn_fwd,"
+        "fqdn_rev,hostname,hwaddr,state\n";
+
+    LeaseFileIO current_file(getLeaseFilePath("leasefile6_0.csv"));
+    current_file.writeFile(new_file_contents +
+        "2001:db8:1::1,00:01:02:03:04:05:06:0a:0b:0c:0d:0e:0f,200,800,"
+        "8,100,0,7,0,1,1,host.example.org,,1\n");
+
+    LeaseFileIO previous_file(getLeaseFilePath("leasefile6_0.csv.2"));
+    previous_file.writeFile(new_file_contents +
+        "2001:db8:1::2,01:01:01:01:01:01:01:01:01:01:01:01:01,200,800,"
+        "8,100,0,7,0,1,1,,,1\n");
+
+    DatabaseConnection::ParameterMap pmap;
+    pmap["type"] = "memfile";
+    pmap["universe"] = "6";
+    pmap["name"] = getLeaseFilePath("leasefile6_0.csv");
+    pmap["lfc-interval"] = "1";
+    pmap["lfc-snapshot-format"] = "binary";
+
+    // The kea-lfc can't write the binary snapshot.
+    boost::scoped_ptr<NakedMemfileLeaseMgr> lease_mgr;
+    EXPECT_THROW(lease_mgr.reset(new NakedMemfileLeaseMgr(pmap)), BadValue);
+    pmap["lfc-snapshot-format"] = "text";
+    pmap["lfc-in-process"] = "true";
+    EXPECT_THROW(lease_mgr.reset(new NakedMemfileLeaseMgr(pmap)), BadValue);
+
+    pmap["lfc-snapshot-format"] = "binary";
+    ASSERT_NO_THROW(lease_mgr.reset(new NakedMemfileLeaseMgr(pmap)));
+    ASSERT_NO_THROW(lease_mgr->lfcCallback());
+    ASSERT_TRUE(waitForProcess(*lease_mgr, 2));
+    EXPECT_EQ(0, lease_mgr->getLFCExitStatus());
+    EXPECT_TRUE(BinaryLeaseFile::isBinary(getLeaseFilePath("leasefile6_0.csv.2")));
+    EXPECT_EQ(new_file_contents, current_file.readFile());
+
+    // Update the lease after the snapshot has been written.
+    Lease6Ptr lease = lease_mgr->getLease6(Lease::TYPE_NA,
+                                           IOAddress("2001:db8:1::2"));
+    ASSERT_TRUE(lease);
+    lease->hostname_ = "updated.example.org";
+    ASSERT_NO_THROW(lease_mgr->updateLease6(lease));
+
+    // The leases are loaded from the snapshot and the lease file.
+    lease_mgr.reset();
+    ASSERT_NO_THROW(lease_mgr.reset(new NakedMemfileLeaseMgr(pmap)));
+    lease = lease_mgr->getLease6(Lease::TYPE_NA, IOAddress("2001:db8:1::1"));
+    ASSERT_TRUE(lease);
+    EXPECT_EQ("host.example.org", lease->hostname_);
+    lease = lease_mgr->getLease6(Lease::TYPE_NA, IOAddress("2001:db8:1::2"));
+    ASSERT_TRUE(lease);
+    EXPECT_EQ("updated.example.org", lease->hostname_);
+
+    // Going back to the CSV format converts the snapshot to CSV.
+    lease_mgr.reset();
+    pmap["lfc-snapshot-format"] = "csv";
+    ASSERT_NO_THROW(lease_mgr.reset(new NakedMemfileLeaseMgr(pmap)));
+    ASSERT_NO_THROW(lease_mgr->lfcCallback());
+    ASSERT_TRUE(waitForProcess(*lease_mgr, 2));
+    EXPECT_EQ(0, lease_mgr->getLFCExitStatus());
+    EXPECT_EQ(new_file_contents +
+              "2001:db8:1::1,00:01:02:03:04:05:06:0a:0b:0c:0d:0e:0f,200,800,"
+              "8,100,0,7,0,1,1,host.example.org,,1\n"
+              "2001:db8:1::2,01:01:01:01:01:01:01:01:01:01:01:01:01,200,800,"
+              "8,100,0,7,0,1,1,updated.example.org,,1\n",
+              previous_file.readFile());
+}
+
 // This test verifies that EXIT_FAILURE status code is returned when
 // the LFC process fails to start.
 TEST_F(MemfileLeaseMgrTest, leaseFileCleanupStartFail) {
@@ -917,6 +1216,24 @@ TEST_F(MemfileLeaseMgrTest, getLease4ClientIdSubnetId) {
     testGetLease4ClientIdSubnetId();
 }
 
+/// @brief Checks that all IPv4 leases for a subnet can be retrieved.
+TEST_F(MemfileLeaseMgrTest, getLeases4SubnetId) {
+    startBackend(V4);
+    testGetLeases4SubnetId();
+}
+
+/// @brief Checks that all IPv4 leases can be retrieved.
+TEST_F(MemfileLeaseMgrTest, getLeases4) {
+    startBackend(V4);
+    testGetLeases4();
+}
+
+/// @brief Checks that IPv4 leases can be retrieved in pages.
+TEST_F(MemfileLeaseMgrTest, getLeases4Paged) {
+    startBackend(V4);
+    testGetLeases4Paged();
+}
+
 /// @brief Basic Lease6 Checks
 ///
 /// Checks that the addLease, getLease6 (by address) and deleteLease (with an
@@ -938,6 +1255,24 @@ TEST_F(MemfileLeaseMgrTest, getLeases6DuidIaid) {
     testGetLeases6DuidIaid();
 }
 
+/// @brief Checks that all IPv6 leases for a subnet can be retrieved.
+TEST_F(MemfileLeaseMgrTest, getLeases6SubnetId) {
+    startBackend(V6);
+    testGetLeases6SubnetId();
+}
+
+/// @brief Checks that all IPv6 leases can be retrieved.
+TEST_F(MemfileLeaseMgrTest, getLeases6) {
+    startBackend(V6);
+    testGetLeases6();
+}
+
+/// @brief Checks that IPv6 leases can be retrieved in pages.
+TEST_F(MemfileLeaseMgrTest, getLeases6Paged) {
+    startBackend(V6);
+    testGetLeases6Paged();
+}
+
 /// @brief Check that the system can cope with a DUID of allowed size.
 TEST_F(MemfileLeaseMgrTest, getLeases6DuidSize) {
     startBackend(V6);
@@ -1051,6 +1386,63 @@ TEST_F(MemfileLeaseMgrTest, testRecreateLease6) {
     testRecreateLease6();
 }
 
+// Checks that the IPv4 lease can be retrieved without copying and that
+// the retrieved lease is not affected by subsequent updates.
+TEST_F(MemfileLeaseMgrTest, getConstLease4) {
+    startBackend(V4);
+
+    std::vector<Lease4Ptr> leases = createLeases4();
+    ASSERT_TRUE(lmptr_->addLease(leases[1]));
+
+    // The storage holds a copy of the added lease, so modifying the
+    // added lease doesn't affect the stored one.
+    leases[1]->valid_lft_ = 12345;
+    ConstLease4Ptr lease = lmptr_->getConstLease4(leases[1]->addr_);
+    ASSERT_TRUE(lease);
+    EXPECT_NE(12345, lease->valid_lft_);
+
+    // Consecutive calls return the same instance.
+    EXPECT_TRUE(lease == lmptr_->getConstLease4(leases[1]->addr_));
+
+    // Update the lease. The previously returned lease remains intact.
+    const uint32_t old_valid_lft = lease->valid_lft_;
+    ASSERT_NO_THROW(lmptr_->updateLease4(leases[1]));
+    EXPECT_EQ(old_valid_lft, lease->valid_lft_);
+    ConstLease4Ptr updated = lmptr_->getConstLease4(leases[1]->addr_);
+    ASSERT_TRUE(updated);
+    EXPECT_EQ(12345, updated->valid_lft_);
+
+    // Non-existing lease.
+    EXPECT_FALSE(lmptr_->getConstLease4(leases[2]->addr_));
+}
+
+// Checks that the IPv6 lease can be retrieved without copying and that
+// the retrieved lease is not affected by subsequent updates.
+TEST_F(MemfileLeaseMgrTest, getConstLease6) {
+    startBackend(V6);
+
+    std::vector<Lease6Ptr> leases = createLeases6();
+    ASSERT_TRUE(lmptr_->addLease(leases[1]));
+
+    leases[1]->valid_lft_ = 12345;
+    ConstLease6Ptr lease = lmptr_->getConstLease6(leases[1]->type_,
+                                                  leases[1]->addr_);
+    ASSERT_TRUE(lease);
+    EXPECT_NE(12345, lease->valid_lft_);
+
+    // The lease type must match.
+    ASSERT_NE(Lease::TYPE_PD, leases[1]->type_);
+    EXPECT_FALSE(lmptr_->getConstLease6(Lease::TYPE_PD, leases[1]->addr_));
+
+    const uint32_t old_valid_lft = lease->valid_lft_;
+    ASSERT_NO_THROW(lmptr_->updateLease6(leases[1]));
+    EXPECT_EQ(old_valid_lft, lease->valid_lft_);
+    ConstLease6Ptr updated = lmptr_->getConstLease6(leases[1]->type_,
+                                                    leases[1]->addr_);
+    ASSERT_TRUE(updated);
+    EXPECT_EQ(12345, updated->valid_lft_);
+}
+
 // The following tests are not applicable for memfile. When adding
 // new tests to the list here, make sure to provide brief explanation
 // why they are not applicable:
@@ -1898,6 +2290,20 @@ TEST_F(MemfileLeaseMgrTest, recountLeaseStats6) {
     testRecountLeaseStats6();
 }
 
+// Verifies that IPv4 lease statistics can be recalculated for selected
+// subnets.
+TEST_F(MemfileLeaseMgrTest, recountSubnetLeaseStats4) {
+    startBackend(V4);
+    testRecountSubnetLeaseStats4();
+}
+
+// Verifies that IPv6 lease statistics can be recalculated for selected
+// subnets.
+TEST_F(MemfileLeaseMgrTest, recountSubnetLeaseStats6) {
+    startBackend(V6);
+    testRecountSubnetLeaseStats6();
+}
+
 // Tests that leases from specific subnet can be removed.
 TEST_F(MemfileLeaseMgrTest, wipeLeases4) {
     startBackend(V4);
@@ -1910,4 +2316,494 @@ TEST_F(MemfileLeaseMgrTest, wipeLeases6) {
     testWipeLeases6();
 }
 
+// Tests the asynchronous IPv4 lease operations.
+TEST_F(MemfileLeaseMgrTest, asyncLeases4) {
+    startBackend(V4);
+    testAsyncLeases4();
+}
+
+// Tests the reclamation of a batch of IPv4 leases.
+TEST_F(MemfileLeaseMgrTest, reclaimLeases4) {
+    startBackend(V4);
+    testReclaimLeases4();
+}
+
+// Tests adding and updating a batch of IPv4 leases.
+TEST_F(MemfileLeaseMgrTest, applyLeases4) {
+    startBackend(V4);
+    testApplyLeases4();
+}
+
+// Tests the asynchronous IPv6 lease operations.
+TEST_F(MemfileLeaseMgrTest, asyncLeases6) {
+    startBackend(V6);
+    testAsyncLeases6();
+}
+
+// Tests the reclamation of a batch of IPv6 leases.
+TEST_F(MemfileLeaseMgrTest, reclaimLeases6) {
+    startBackend(V6);
+    testReclaimLeases6();
+}
+
+// Tests adding and updating a batch of IPv6 leases.
+TEST_F(MemfileLeaseMgrTest, applyLeases6) {
+    startBackend(V6);
+    testApplyLeases6();
+}
+
+// Checks that the packed storage is used only when requested and that
+// invalid values of the "packed" parameter are rejected.
+TEST_F(MemfileLeaseMgrTest, packedParameter) {
+    DatabaseConnection::ParameterMap pmap;
+    pmap["universe"] = "4";
+    pmap["persist"] = "false";
+    boost::scoped_ptr<Memfile_LeaseMgr> lease_mgr;
+
+    ASSERT_NO_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)));
+    EXPECT_FALSE(lease_mgr->isPacked());
+
+    pmap["packed"] = "false";
+    ASSERT_NO_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)));
+    EXPECT_FALSE(lease_mgr->isPacked());
+
+    pmap["packed"] = "true";
+    ASSERT_NO_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)));
+    EXPECT_TRUE(lease_mgr->isPacked());
+
+    // The DHCPv6 leases are never packed.
+    pmap["universe"] = "6";
+    ASSERT_NO_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)));
+    EXPECT_FALSE(lease_mgr->isPacked());
+
+    pmap["packed"] = "yes";
+    EXPECT_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)), BadValue);
+}
+
+// The following tests run the generic DHCPv4 lease manager tests with
+// the leases held in the packed storage.
+
+TEST_F(MemfilePackedLeaseMgrTest, basicLease4) {
+    startBackend(V4);
+    ASSERT_TRUE(dynamic_cast<Memfile_LeaseMgr*>(lmptr_)->isPacked());
+    testBasicLease4();
+}
+
+TEST_F(MemfilePackedLeaseMgrTest, getLease4ClientId) {
+    startBackend(V4);
+    testGetLease4ClientId();
+}
+
+TEST_F(MemfilePackedLeaseMgrTest, getLease4NullClientId) {
+    startBackend(V4);
+    testGetLease4NullClientId();
+}
+
+TEST_F(MemfilePackedLeaseMgrTest, getLease4HWAddr1) {
+    startBackend(V4);
+    testGetLease4HWAddr1();
+}
+
+TEST_F(MemfilePackedLeaseMgrTest, getLease4HWAddr2) {
+    startBackend(V4);
+    testGetLease4HWAddr2();
+}
+
+TEST_F(MemfilePackedLeaseMgrTest, getLease4ClientIdHWAddrSubnetId) {
+    startBackend(V4);
+    testGetLease4ClientIdHWAddrSubnetId();
+}
+
+TEST_F(MemfilePackedLeaseMgrTest, lease4NullClientId) {
+    startBackend(V4);
+    testLease4NullClientId();
+}
+
+TEST_F(MemfilePackedLeaseMgrTest, getLease4ClientId2) {
+    startBackend(V4);
+    testGetLease4ClientId2();
+}
+
+TEST_F(MemfilePackedLeaseMgrTest, getLease4ClientIdSize) {
+    startBackend(V4);
+    testGetLease4ClientIdSize();
+}
+
+TEST_F(MemfilePackedLeaseMgrTest, getLease4ClientIdSubnetId) {
+    startBackend(V4);
+    testGetLease4ClientIdSubnetId();
+}
+
+TEST_F(MemfilePackedLeaseMgrTest, getLeases4SubnetId) {
+    startBackend(V4);
+    testGetLeases4SubnetId();
+}
+
+TEST_F(MemfilePackedLeaseMgrTest, getLeases4) {
+    startBackend(V4);
+    testGetLeases4();
+}
+
+TEST_F(MemfilePackedLeaseMgrTest, getLeases4Paged) {
+    startBackend(V4);
+    testGetLeases4Paged();
+}
+
+TEST_F(MemfilePackedLeaseMgrTest, applyLeases4) {
+    startBackend(V4);
+    testApplyLeases4();
+}
+
+TEST_F(MemfilePackedLeaseMgrTest, getExpiredLeases4) {
+    startBackend(V4);
+    testGetExpiredLeases4();
+}
+
+TEST_F(MemfilePackedLeaseMgrTest, deleteExpiredReclaimedLeases4) {
+    startBackend(V4);
+    testDeleteExpiredReclaimedLeases4();
+}
+
+TEST_F(MemfilePackedLeaseMgrTest, recountLeaseStats4) {
+    startBackend(V4);
+    testRecountLeaseStats4();
+}
+
+TEST_F(MemfilePackedLeaseMgrTest, recountSubnetLeaseStats4) {
+    startBackend(V4);
+    testRecountSubnetLeaseStats4();
+}
+
+TEST_F(MemfilePackedLeaseMgrTest, wipeLeases4) {
+    startBackend(V4);
+    testWipeLeases4();
+}
+
+// Checks that the packed leases are written to the lease file and read
+// back when the backend is restarted.
+TEST_F(MemfilePackedLeaseMgrTest, persistLeases4) {
+    startBackend(V4);
+
+    Lease4Ptr lease(new Lease4(IOAddress("192.0.2.3"),
+                               HWAddrPtr(new HWAddr(HWAddr::fromText("01:02:03:04:05:06"))),
+                               ClientIdPtr(new ClientId(std::vector<uint8_t>(8, 0x42))),
+                               200, 50, 100, time(NULL), 1, true, false,
+                               "host.example.org"));
+    ASSERT_TRUE(lmptr_->addLease(lease));
+
+    Lease4Ptr deleted(new Lease4(*lease));
+    deleted->addr_ = IOAddress("192.0.2.4");
+    ASSERT_TRUE(lmptr_->addLease(deleted));
+    ASSERT_TRUE(lmptr_->deleteLease(deleted->addr_));
+
+    lease->hostname_ = "other.example.org";
+    ASSERT_NO_THROW(lmptr_->updateLease4(lease));
+
+    reopen(V4);
+    ASSERT_TRUE(dynamic_cast<Memfile_LeaseMgr*>(lmptr_)->isPacked());
+
+    Lease4Ptr reloaded = lmptr_->getLease4(lease->addr_);
+    ASSERT_TRUE(reloaded);
+    detailCompareLease(lease, reloaded);
+    EXPECT_FALSE(lmptr_->getLease4(deleted->addr_));
+}
+
+/// @brief Adds IPv4 leases to the lease manager.
+///
+/// The leases are assigned addresses starting from 10.0.<first>.1 and
+/// a lease for 192.0.2.1 is added after every lease. Only one of the
+/// concurrently running threads may succeed adding the latter.
+///
+/// @param lease_mgr Lease manager instance.
+/// @param first Third octet of the assigned addresses.
+/// @param count Number of leases to be added.
+/// @param [out] added Number of leases added for 192.0.2.1.
+void addLeasesInThread(LeaseMgr* lease_mgr, const uint8_t first,
+                       const unsigned count, unsigned* added) {
+    std::vector<uint8_t> hwaddr_vec(6, first);
+    HWAddrPtr hwaddr(new HWAddr(hwaddr_vec, HTYPE_ETHER));
+    for (unsigned i = 0; i < count; ++i) {
+        std::ostringstream address;
+        address << "10.0." << static_cast<int>(first) << "." << (i + 1);
+        Lease4Ptr lease(new Lease4(IOAddress(address.str()), hwaddr, 0, 0,
+                                   100, 50, 60, 0, 1));
+        lease_mgr->addLease(lease);
+
+        Lease4Ptr shared_lease(new Lease4(IOAddress("192.0.2.1"), hwaddr,
+                                          0, 0, 100, 50, 60, 0, 1));
+        if (lease_mgr->addLease(shared_lease)) {
+            ++(*added);
+        }
+    }
+}
+
+// Checks that the leases can be added by multiple threads concurrently.
+TEST_F(MemfileLeaseMgrTest, concurrentAddLease4) {
+    startBackend(V4);
+
+    const unsigned threads_num = 4;
+    const unsigned leases_num = 200;
+    std::vector<unsigned> added(threads_num, 0);
+    std::vector<boost::shared_ptr<isc::util::thread::Thread> > threads;
+    for (unsigned i = 0; i < threads_num; ++i) {
+        threads.push_back(boost::shared_ptr<isc::util::thread::Thread>
+                          (new isc::util::thread::Thread(boost::bind(&addLeasesInThread,
+                                                                     lmptr_, i + 1,
+                                                                     leases_num,
+                                                                     &added[i]))));
+    }
+    for (unsigned i = 0; i < threads_num; ++i) {
+        threads[i]->wait();
+    }
+
+    // The lease for the shared address can only be added once.
+    unsigned total_added = 0;
+    for (unsigned i = 0; i < threads_num; ++i) {
+        total_added += added[i];
+    }
+    EXPECT_EQ(1, total_added);
+
+    // All other leases should be there.
+    for (unsigned i = 0; i < threads_num; ++i) {
+        std::ostringstream address;
+        address << "10.0." << (i + 1) << "." << leases_num;
+        EXPECT_TRUE(lmptr_->getLease4(IOAddress(address.str())))
+            << "lease for " << address.str() << " not found";
+    }
+}
+
+// Checks that the group commit writer is created only when requested and
+// that invalid values of the group commit parameters are rejected.
+TEST_F(MemfileLeaseMgrTest, groupCommitParameters) {
+    LeaseFileIO io4(getLeaseFilePath("leasefile4_1.csv"));
+
+    DatabaseConnection::ParameterMap pmap;
+    pmap["universe"] = "4";
+    pmap["lfc-interval"] = "0";
+    pmap["name"] = getLeaseFilePath("leasefile4_1.csv");
+    boost::scoped_ptr<Memfile_LeaseMgr> lease_mgr;
+
+    ASSERT_NO_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)));
+    EXPECT_FALSE(lease_mgr->getGroupCommitWriter());
+
+    pmap["group-commit"] = "true";
+    pmap["group-commit-max-batch"] = "16";
+    pmap["group-commit-max-latency"] = "2";
+    pmap["group-commit-sync"] = "true";
+    ASSERT_NO_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)));
+    GroupCommitWriterPtr writer = lease_mgr->getGroupCommitWriter();
+    ASSERT_TRUE(writer);
+    EXPECT_EQ(16, writer->getMaxBatch());
+    EXPECT_EQ(2, writer->getMaxLatency());
+    EXPECT_TRUE(writer->getSync());
+    writer.reset();
+
+    // There is nothing to write when the leases are not persisted.
+    pmap["persist"] = "false";
+    ASSERT_NO_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)));
+    EXPECT_FALSE(lease_mgr->getGroupCommitWriter());
+    pmap["persist"] = "true";
+
+    pmap["group-commit-max-batch"] = "0";
+    EXPECT_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)), BadValue);
+    pmap["group-commit-max-batch"] = "bogus";
+    EXPECT_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)), BadValue);
+    pmap["group-commit-max-batch"] = "16";
+
+    pmap["group-commit-max-latency"] = "-1";
+    EXPECT_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)), BadValue);
+    pmap["group-commit-max-latency"] = "2";
+
+    pmap["group-commit-sync"] = "yes";
+    EXPECT_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)), BadValue);
+    pmap["group-commit-sync"] = "false";
+
+    pmap["group-commit"] = "yes";
+    EXPECT_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)), BadValue);
+}
+
+// Checks that the leases added, updated and deleted with the group commit
+// enabled are written to the lease file.
+TEST_F(MemfileLeaseMgrTest, groupCommitPersistLeases) {
+    LeaseMgrFactory::create(getConfigString(V4) + " group-commit=true"
+                            " group-commit-max-latency=1");
+    lmptr_ = &(LeaseMgrFactory::instance());
+
+    Lease4Ptr lease(new Lease4(IOAddress("192.0.2.3"),
+                               HWAddrPtr(new HWAddr(HWAddr::fromText("01:02:03:04:05:06"))),
+                               ClientIdPtr(), 200, 50, 100, time(NULL), 1));
+    ASSERT_TRUE(lmptr_->addLease(lease));
+
+    Lease4Ptr deleted(new Lease4(*lease));
+    deleted->addr_ = IOAddress("192.0.2.4");
+    ASSERT_TRUE(lmptr_->addLease(deleted));
+    ASSERT_TRUE(lmptr_->deleteLease(deleted->addr_));
+
+    lease->hostname_ = "other.example.org";
+    ASSERT_NO_THROW(lmptr_->updateLease4(lease));
+
+    // The rows are written when the lease manager returns, so they can be
+    // read from the file before the backend is closed.
+    LeaseFileIO io(getLeaseFilePath("leasefile4_0.csv"), false);
+    std::string contents = io.readFile();
+    EXPECT_NE(std::string::npos, contents.find("192.0.2.4"));
+    EXPECT_NE(std::string::npos, contents.find("other.example.org"));
+
+    reopen(V4);
+    Lease4Ptr reloaded = lmptr_->getLease4(lease->addr_);
+    ASSERT_TRUE(reloaded);
+    detailCompareLease(lease, reloaded);
+    EXPECT_FALSE(lmptr_->getLease4(deleted->addr_));
+}
+
+// Checks that the leases added or updated with the group commit enabled
+// are not kept in memory when the group can't be written to the lease file.
+TEST_F(MemfileLeaseMgrTest, groupCommitWriteError) {
+    LeaseMgrFactory::create(getConfigString(V4) + " group-commit=true"
+                            " group-commit-max-latency=1");
+    lmptr_ = &(LeaseMgrFactory::instance());
+
+    Lease4Ptr lease(new Lease4(IOAddress("192.0.2.3"),
+                               HWAddrPtr(new HWAddr(HWAddr::fromText("01:02:03:04:05:06"))),
+                               ClientIdPtr(), 200, 50, 100, time(NULL), 1));
+    ASSERT_TRUE(lmptr_->addLease(lease));
+
+    // Limit the file size to the current size of the lease file, so as
+    // the next group fails to be written with EFBIG.
+    LeaseFileIO io(getLeaseFilePath("leasefile4_0.csv"), false);
+    struct rlimit saved_limit;
+    ASSERT_EQ(0, getrlimit(RLIMIT_FSIZE, &saved_limit));
+    struct rlimit limit = saved_limit;
+    limit.rlim_cur = io.readFile().size();
+    void (*saved_handler)(int) = signal(SIGXFSZ, SIG_IGN);
+    ASSERT_EQ(0, setrlimit(RLIMIT_FSIZE, &limit));
+
+    Lease4Ptr added(new Lease4(*lease));
+    added->addr_ = IOAddress("192.0.2.4");
+    EXPECT_THROW(lmptr_->addLease(added), CSVFileError);
+
+    setrlimit(RLIMIT_FSIZE, &saved_limit);
+    signal(SIGXFSZ, saved_handler);
+
+    EXPECT_FALSE(lmptr_->getLease4(added->addr_));
+    Lease4Ptr stored = lmptr_->getLease4(lease->addr_);
+    ASSERT_TRUE(stored);
+    detailCompareLease(lease, stored);
+
+    // Check the same for the update, with a new writer.
+    LeaseMgrFactory::destroy();
+    LeaseMgrFactory::create(getConfigString(V4) + " group-commit=true"
+                            " group-commit-max-latency=1");
+    lmptr_ = &(LeaseMgrFactory::instance());
+
+    limit.rlim_cur = io.readFile().size();
+    saved_handler = signal(SIGXFSZ, SIG_IGN);
+    ASSERT_EQ(0, setrlimit(RLIMIT_FSIZE, &limit));
+
+    Lease4Ptr updated(new Lease4(*lease));
+    updated->hostname_ = "other.example.org";
+    EXPECT_THROW(lmptr_->updateLease4(updated), CSVFileError);
+
+    setrlimit(RLIMIT_FSIZE, &saved_limit);
+    signal(SIGXFSZ, saved_handler);
+
+    stored = lmptr_->getLease4(lease->addr_);
+    ASSERT_TRUE(stored);
+    detailCompareLease(lease, stored);
+}
+
+// Checks that the leases added by multiple threads are written in groups.
+TEST_F(MemfileLeaseMgrTest, groupCommitConcurrentAddLease4) {
+    LeaseMgrFactory::create(getConfigString(V4) + " group-commit=true"
+                            " group-commit-max-latency=2");
+    lmptr_ = &(LeaseMgrFactory::instance());
+
+    const unsigned threads_num = 4;
+    const unsigned leases_num = 50;
+    std::vector<unsigned> added(threads_num, 0);
+    std::vector<boost::shared_ptr<isc::util::thread::Thread> > threads;
+    for (unsigned i = 0; i < threads_num; ++i) {
+        threads.push_back(boost::shared_ptr<isc::util::thread::Thread>
+                          (new isc::util::thread::Thread(boost::bind(&addLeasesInThread,
+                                                                     lmptr_, i + 1,
+                                                                     leases_num,
+                                                                     &added[i]))));
+    }
+    for (unsigned i = 0; i < threads_num; ++i) {
+        threads[i]->wait();
+    }
+
+    // Each thread adds two leases per iteration but only one lease for
+    // the shared address is added in total. The rows should have been
+    // written in fewer groups.
+    GroupCommitWriterPtr writer =
+        dynamic_cast<Memfile_LeaseMgr*>(lmptr_)->getGroupCommitWriter();
+    ASSERT_TRUE(writer);
+    EXPECT_EQ(threads_num * leases_num + 1, writer->getLastSequence());
+    EXPECT_LT(writer->getBatchCount(), writer->getLastSequence());
+    writer.reset();
+
+    reopen(V4);
+    for (unsigned i = 0; i < threads_num; ++i) {
+        for (unsigned j = 0; j < leases_num; ++j) {
+            std::ostringstream address;
+            address << "10.0." << (i + 1) << "." << (j + 1);
+            EXPECT_TRUE(lmptr_->getLease4(IOAddress(address.str())))
+                << "lease for " << address.str() << " not found";
+        }
+    }
+    EXPECT_TRUE(lmptr_->getLease4(IOAddress("192.0.2.1")));
+}
+
+// Checks that the leases loaded by multiple threads from the large lease
+// file are the same as the leases loaded by a single thread.
+TEST_F(MemfileLeaseMgrTest, loadThreads) {
+    // The files smaller than 1MB are loaded by a single thread, so the
+    // file must be large enough to be split into several chunks.
+    std::ostringstream contents;
+    contents << "address,hwaddr,client_id,valid_lifetime,expire,subnet_id,"
+        "fqdn_fwd,fqdn_rev,hostname,state\n";
+    const unsigned leases_num = 40000;
+    for (unsigned i = 0; i < leases_num; ++i) {
+        contents << "10." << (i >> 16) << "." << ((i >> 8) & 0xFF) << "."
+                 << (i & 0xFF) << ",01:02:03:04:05:06,,200,"
+                 << (200 + i) << ",8,1,1,host.example.org,0\n";
+    }
+    // Remove the lease from the beginning of the file and update the
+    // lease from the middle of the file.
+    contents << "10.0.0.1,01:02:03:04:05:06,,0,200,8,1,1,,0\n";
+    contents << "10.0.78.32,01:02:03:04:05:06,,200,100000,8,1,1,,0\n";
+    LeaseFileIO io(getLeaseFilePath("leasefile4_0.csv"));
+    io.writeFile(contents.str());
+
+    // The number of threads must be a non-negative number.
+    EXPECT_THROW(LeaseMgrFactory::create(getConfigString(V4) +
+                                         " load-threads=-1"),
+                 BadValue);
+    EXPECT_THROW(LeaseMgrFactory::create(getConfigString(V4) +
+                                         " load-threads=many"),
+                 BadValue);
+
+    LeaseMgrFactory::create(getConfigString(V4) + " load-threads=1");
+    lmptr_ = &(LeaseMgrFactory::instance());
+    Lease4Collection expected = lmptr_->getLeases4(SubnetID(8));
+    ASSERT_EQ(leases_num - 1, expected.size());
+
+    LeaseMgrFactory::create(getConfigString(V4) + " load-threads=4");
+    lmptr_ = &(LeaseMgrFactory::instance());
+    Lease4Collection leases = lmptr_->getLeases4(SubnetID(8));
+    ASSERT_EQ(expected.size(), leases.size());
+    for (Lease4Collection::const_iterator lease = expected.begin();
+         lease != expected.end(); ++lease) {
+        Lease4Ptr loaded = lmptr_->getLease4((*lease)->addr_);
+        ASSERT_TRUE(loaded);
+        EXPECT_TRUE(*loaded == **lease);
+    }
+
+    EXPECT_FALSE(lmptr_->getLease4(IOAddress("10.0.0.1")));
+    Lease4Ptr updated = lmptr_->getLease4(IOAddress("10.0.78.32"));
+    ASSERT_TRUE(updated);
+    EXPECT_EQ(100000 - 200, updated->cltt_);
+}
+
 }; // end of anonymous namespace
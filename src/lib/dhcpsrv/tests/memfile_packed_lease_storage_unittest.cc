@@ -0,0 +1,274 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <asiolink/io_address.h>
+#include <dhcp/duid.h>
+#include <dhcp/hwaddr.h>
+#include <dhcpsrv/memfile_packed_lease_storage.h>
+#include <dhcpsrv/tests/test_utils.h>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <ctime>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+using namespace isc::dhcp::test;
+
+namespace {
+
+/// @brief Creates the lease for the tests.
+///
+/// @param address Leased address.
+/// @param hwaddr HW address in the textual form or empty string.
+/// @param client_id Client identifier in the textual form or empty string.
+/// @param subnet_id Subnet identifier.
+Lease4Ptr
+createLease4(const std::string& address, const std::string& hwaddr,
+             const std::string& client_id, const SubnetID subnet_id) {
+    HWAddrPtr hw;
+    if (!hwaddr.empty()) {
+        hw.reset(new HWAddr(HWAddr::fromText(hwaddr)));
+        hw->source_ = HWAddr::HWADDR_SOURCE_RAW;
+    }
+    ClientIdPtr id;
+    if (!client_id.empty()) {
+        id = ClientId::fromText(client_id);
+    }
+    Lease4Ptr lease(new Lease4(IOAddress(address), hw, id, 3600, 900, 1800,
+                               time(NULL), subnet_id, true, false,
+                               "myhost.example.com."));
+    return (lease);
+}
+
+// Checks that the equal values are stored in the pool once and removed
+// when they are no longer referenced.
+TEST(LeaseBlobPoolTest, acquireRelease) {
+    LeaseBlobPool pool;
+    const uint8_t data1[] = { 1, 2, 3, 4 };
+    const uint8_t data2[] = { 1, 2, 3, 4, 5 };
+
+    // Empty values are not stored.
+    EXPECT_FALSE(pool.acquire(data1, 0));
+    EXPECT_FALSE(pool.find(data1, 0));
+    EXPECT_EQ(0, pool.size());
+
+    const LeaseBlob* blob1 = pool.acquire(data1, sizeof(data1));
+    ASSERT_TRUE(blob1);
+    EXPECT_EQ(sizeof(data1), blob1->getLength());
+    EXPECT_EQ(0, memcmp(data1, blob1->getData(), sizeof(data1)));
+
+    // The same value is returned for the equal data.
+    EXPECT_EQ(blob1, pool.acquire(data1, sizeof(data1)));
+    EXPECT_EQ(blob1, pool.find(data1, sizeof(data1)));
+    EXPECT_EQ(2, blob1->refs_);
+
+    const LeaseBlob* blob2 = pool.acquire(data2, sizeof(data2));
+    ASSERT_TRUE(blob2);
+    EXPECT_NE(blob1, blob2);
+    EXPECT_EQ(2, pool.size());
+
+    // The value remains in the pool until the last reference is released.
+    pool.release(blob1);
+    EXPECT_EQ(blob1, pool.find(data1, sizeof(data1)));
+    pool.release(blob1);
+    EXPECT_FALSE(pool.find(data1, sizeof(data1)));
+    EXPECT_EQ(1, pool.size());
+
+    // Releasing null pointer is a no-op.
+    EXPECT_NO_THROW(pool.release(0));
+
+    pool.clear();
+    EXPECT_EQ(0, pool.size());
+}
+
+// Checks that the lease is the same after packing and materialization.
+TEST(PackedLease4StorageTest, insertAndGet) {
+    PackedLease4Storage storage;
+
+    Lease4Ptr lease = createLease4("192.0.2.1", "01:02:03:04:05:06",
+                                   "01:02:03:04", 1);
+    lease->state_ = Lease::STATE_DECLINED;
+    ASSERT_TRUE(storage.insert(lease));
+    EXPECT_FALSE(storage.insert(lease));
+    EXPECT_EQ(1, storage.size());
+
+    Lease4Ptr returned = storage.get(lease->addr_);
+    ASSERT_TRUE(returned);
+    detailCompareLease(lease, returned);
+    ASSERT_TRUE(returned->hwaddr_);
+    EXPECT_EQ(HWAddr::HWADDR_SOURCE_RAW, returned->hwaddr_->source_);
+
+    // Leases without HW address, client identifier and hostname.
+    Lease4Ptr bare = createLease4("192.0.2.2", "", "", 1);
+    bare->hostname_.clear();
+    ASSERT_TRUE(storage.insert(bare));
+    returned = storage.get(bare->addr_);
+    ASSERT_TRUE(returned);
+    EXPECT_FALSE(returned->hwaddr_);
+    EXPECT_FALSE(returned->client_id_);
+    EXPECT_TRUE(returned->hostname_.empty());
+    EXPECT_EQ(bare->cltt_, returned->cltt_);
+
+    // Empty HW address is distinct from no HW address.
+    Lease4Ptr empty_hwaddr = createLease4("192.0.2.3", "", "", 1);
+    empty_hwaddr->hwaddr_.reset(new HWAddr());
+    ASSERT_TRUE(storage.insert(empty_hwaddr));
+    returned = storage.get(empty_hwaddr->addr_);
+    ASSERT_TRUE(returned);
+    ASSERT_TRUE(returned->hwaddr_);
+    EXPECT_TRUE(returned->hwaddr_->hwaddr_.empty());
+
+    EXPECT_FALSE(storage.get(IOAddress("192.0.2.100")));
+}
+
+// Checks that the values are shared between the leases and released
+// when the leases are removed or updated.
+TEST(PackedLease4StorageTest, sharedValues) {
+    PackedLease4Storage storage;
+
+    // Two leases of the same client in different subnets share the
+    // HW address, client identifier and hostname.
+    ASSERT_TRUE(storage.insert(createLease4("192.0.2.1", "01:02:03:04:05:06",
+                                            "01:02:03:04", 1)));
+    ASSERT_TRUE(storage.insert(createLease4("192.0.3.1", "01:02:03:04:05:06",
+                                            "01:02:03:04", 2)));
+    EXPECT_EQ(3, storage.getBlobCount());
+
+    // Replacing the lease with the one having a different HW address
+    // adds one value.
+    PackedLease4Storage::iterator it = storage.find(IOAddress("192.0.3.1"));
+    ASSERT_TRUE(it != storage.end());
+    ASSERT_TRUE(storage.replace(it, createLease4("192.0.3.1", "0a:0b:0c:0d:0e:0f",
+                                                 "01:02:03:04", 2)));
+    EXPECT_EQ(4, storage.getBlobCount());
+
+    // Removing the first lease releases the original HW address.
+    it = storage.find(IOAddress("192.0.2.1"));
+    ASSERT_TRUE(it != storage.end());
+    storage.erase(it);
+    EXPECT_EQ(3, storage.getBlobCount());
+    EXPECT_EQ(1, storage.size());
+
+    storage.clear();
+    EXPECT_EQ(0, storage.size());
+    EXPECT_EQ(0, storage.getBlobCount());
+}
+
+// Checks the lookups by HW address and client identifier.
+TEST(PackedLease4StorageTest, getByIdentifiers) {
+    PackedLease4Storage storage;
+    ASSERT_TRUE(storage.insert(createLease4("192.0.2.5", "01:02:03:04:05:06",
+                                            "01:02:03:04", 1)));
+    ASSERT_TRUE(storage.insert(createLease4("192.0.2.4", "01:02:03:04:05:06",
+                                            "", 1)));
+    ASSERT_TRUE(storage.insert(createLease4("192.0.3.1", "01:02:03:04:05:06",
+                                            "01:02:03:04", 2)));
+
+    HWAddr hwaddr = HWAddr::fromText("01:02:03:04:05:06");
+    HWAddr unknown_hwaddr = HWAddr::fromText("06:05:04:03:02:01");
+    ClientIdPtr client_id = ClientId::fromText("01:02:03:04");
+    ClientIdPtr unknown_client_id = ClientId::fromText("04:03:02:01");
+
+    EXPECT_EQ(3, storage.getByHWAddr(hwaddr).size());
+    EXPECT_TRUE(storage.getByHWAddr(unknown_hwaddr).empty());
+
+    // The lease with the lowest address is returned when the client has
+    // more leases in the subnet.
+    Lease4Ptr lease = storage.getByHWAddr(hwaddr, 1);
+    ASSERT_TRUE(lease);
+    EXPECT_EQ("192.0.2.4", lease->addr_.toText());
+    EXPECT_FALSE(storage.getByHWAddr(hwaddr, 3));
+
+    EXPECT_EQ(2, storage.getByClientId(*client_id).size());
+    EXPECT_TRUE(storage.getByClientId(*unknown_client_id).empty());
+
+    lease = storage.getByClientId(*client_id, 2);
+    ASSERT_TRUE(lease);
+    EXPECT_EQ("192.0.3.1", lease->addr_.toText());
+    EXPECT_FALSE(storage.getByClientId(*unknown_client_id, 2));
+
+    lease = storage.getByClientId(*client_id, hwaddr, 1);
+    ASSERT_TRUE(lease);
+    EXPECT_EQ("192.0.2.5", lease->addr_.toText());
+    EXPECT_FALSE(storage.getByClientId(*client_id, unknown_hwaddr, 1));
+
+    EXPECT_EQ(2, storage.getBySubnetId(1).size());
+    EXPECT_EQ(1, storage.getBySubnetId(2).size());
+    EXPECT_TRUE(storage.getBySubnetId(3).empty());
+}
+
+// Checks that expired leases are returned and the reclaimed leases are
+// removed.
+TEST(PackedLease4StorageTest, expiration) {
+    PackedLease4Storage storage;
+    const time_t now = time(NULL);
+
+    for (int i = 0; i < 6; ++i) {
+        std::ostringstream address;
+        address << "192.0.2." << (i + 1);
+        Lease4Ptr lease = createLease4(address.str(), "01:02:03:04:05:06",
+                                       "", 1);
+        // Odd leases are valid, even leases are expired.
+        lease->cltt_ = (i % 2 == 0) ? now - 4000 - i : now;
+        if (i == 4) {
+            lease->state_ = Lease::STATE_EXPIRED_RECLAIMED;
+        }
+        ASSERT_TRUE(storage.insert(lease));
+    }
+
+    // Leases 1 and 3 are expired. The most expired lease goes first.
+    Lease4Collection expired;
+    storage.getExpired(expired, 0);
+    ASSERT_EQ(2, expired.size());
+    EXPECT_EQ("192.0.2.3", expired[0]->addr_.toText());
+    EXPECT_EQ("192.0.2.1", expired[1]->addr_.toText());
+
+    expired.clear();
+    storage.getExpired(expired, 1);
+    ASSERT_EQ(1, expired.size());
+
+    // Only the reclaimed lease is removed.
+    Lease4Collection removed;
+    storage.eraseExpiredReclaimed(0, removed);
+    ASSERT_EQ(1, removed.size());
+    EXPECT_EQ("192.0.2.5", removed[0]->addr_.toText());
+    EXPECT_EQ(5, storage.size());
+}
+
+// Checks that the leases are counted per subnet and state.
+TEST(PackedLease4StorageTest, getLeaseStats) {
+    PackedLease4Storage storage;
+    EXPECT_TRUE(storage.getLeaseStats().empty());
+
+    ASSERT_TRUE(storage.insert(createLease4("192.0.2.1", "01:02:03:04:05:06",
+                                            "", 1)));
+    Lease4Ptr declined = createLease4("192.0.2.2", "", "", 1);
+    declined->state_ = Lease::STATE_DECLINED;
+    ASSERT_TRUE(storage.insert(declined));
+    ASSERT_TRUE(storage.insert(createLease4("192.0.3.1", "01:02:03:04:05:07",
+                                            "", 2)));
+
+    std::vector<LeaseStatsRow> rows = storage.getLeaseStats();
+    ASSERT_EQ(4, rows.size());
+    EXPECT_EQ(1, rows[0].subnet_id_);
+    EXPECT_EQ(Lease::STATE_DEFAULT, rows[0].lease_state_);
+    EXPECT_EQ(1, rows[0].state_count_);
+    EXPECT_EQ(Lease::STATE_DECLINED, rows[1].lease_state_);
+    EXPECT_EQ(1, rows[1].state_count_);
+    EXPECT_EQ(2, rows[2].subnet_id_);
+    EXPECT_EQ(1, rows[2].state_count_);
+    EXPECT_EQ(0, rows[3].state_count_);
+}
+
+} // end of anonymous namespace
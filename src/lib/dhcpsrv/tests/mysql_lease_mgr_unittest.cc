@@ -321,6 +321,21 @@ TEST_F(MySqlLeaseMgrTest, getLease4ClientIdSubnetId) {
     testGetLease4ClientIdSubnetId();
 }
 
+/// @brief Checks that all IPv4 leases for a subnet can be retrieved.
+TEST_F(MySqlLeaseMgrTest, getLeases4SubnetId) {
+    testGetLeases4SubnetId();
+}
+
+/// @brief Checks that all IPv4 leases can be retrieved.
+TEST_F(MySqlLeaseMgrTest, getLeases4) {
+    testGetLeases4();
+}
+
+/// @brief Checks that IPv4 leases can be retrieved in pages.
+TEST_F(MySqlLeaseMgrTest, getLeases4Paged) {
+    testGetLeases4Paged();
+}
+
 /// @brief Basic Lease4 Checks
 ///
 /// Checks that the addLease, getLease4(by address), getLease4(hwaddr,subnet_id),
@@ -377,6 +392,21 @@ TEST_F(MySqlLeaseMgrTest, getLeases6DuidIaid) {
     testGetLeases6DuidIaid();
 }
 
+/// @brief Checks that all IPv6 leases for a subnet can be retrieved.
+TEST_F(MySqlLeaseMgrTest, getLeases6SubnetId) {
+    testGetLeases6SubnetId();
+}
+
+/// @brief Checks that all IPv6 leases can be retrieved.
+TEST_F(MySqlLeaseMgrTest, getLeases6) {
+    testGetLeases6();
+}
+
+/// @brief Checks that IPv6 leases can be retrieved in pages.
+TEST_F(MySqlLeaseMgrTest, getLeases6Paged) {
+    testGetLeases6Paged();
+}
+
 // Check that the system can cope with a DUID of allowed size.
 TEST_F(MySqlLeaseMgrTest, getLeases6DuidSize) {
     testGetLeases6DuidSize();
@@ -487,6 +517,18 @@ TEST_F(MySqlLeaseMgrTest, recountLeaseStats6) {
     testRecountLeaseStats6();
 }
 
+// Verifies that IPv4 lease statistics can be recalculated for selected
+// subnets.
+TEST_F(MySqlLeaseMgrTest, recountSubnetLeaseStats4) {
+    testRecountSubnetLeaseStats4();
+}
+
+// Verifies that IPv6 lease statistics can be recalculated for selected
+// subnets.
+TEST_F(MySqlLeaseMgrTest, recountSubnetLeaseStats6) {
+    testRecountSubnetLeaseStats6();
+}
+
 // Tests that leases from specific subnet can be removed.
 TEST_F(MySqlLeaseMgrTest, DISABLED_wipeLeases4) {
     testWipeLeases4();
@@ -497,4 +539,34 @@ TEST_F(MySqlLeaseMgrTest, DISABLED_wipeLeases6) {
     testWipeLeases6();
 }
 
+// Tests the asynchronous IPv4 lease operations.
+TEST_F(MySqlLeaseMgrTest, asyncLeases4) {
+    testAsyncLeases4();
+}
+
+// Tests the reclamation of a batch of IPv4 leases.
+TEST_F(MySqlLeaseMgrTest, reclaimLeases4) {
+    testReclaimLeases4();
+}
+
+// Tests adding and updating a batch of IPv4 leases.
+TEST_F(MySqlLeaseMgrTest, applyLeases4) {
+    testApplyLeases4();
+}
+
+// Tests the asynchronous IPv6 lease operations.
+TEST_F(MySqlLeaseMgrTest, asyncLeases6) {
+    testAsyncLeases6();
+}
+
+// Tests the reclamation of a batch of IPv6 leases.
+TEST_F(MySqlLeaseMgrTest, reclaimLeases6) {
+    testReclaimLeases6();
+}
+
+// Tests adding and updating a batch of IPv6 leases.
+TEST_F(MySqlLeaseMgrTest, applyLeases6) {
+    testApplyLeases6();
+}
+
 }; // Of anonymous namespace
@@ -280,6 +280,21 @@ TEST_F(PgSqlLeaseMgrTest, getLease4ClientIdSubnetId) {
     testGetLease4ClientIdSubnetId();
 }
 
+/// @brief Checks that all IPv4 leases for a subnet can be retrieved.
+TEST_F(PgSqlLeaseMgrTest, getLeases4SubnetId) {
+    testGetLeases4SubnetId();
+}
+
+/// @brief Checks that all IPv4 leases can be retrieved.
+TEST_F(PgSqlLeaseMgrTest, getLeases4) {
+    testGetLeases4();
+}
+
+/// @brief Checks that IPv4 leases can be retrieved in pages.
+TEST_F(PgSqlLeaseMgrTest, getLeases4Paged) {
+    testGetLeases4Paged();
+}
+
 /// @brief Basic Lease4 Checks
 ///
 /// Checks that the addLease, getLease4(by address), getLease4(hwaddr,subnet_id),
@@ -352,6 +367,21 @@ TEST_F(PgSqlLeaseMgrTest, getLeases6DuidIaid) {
     testGetLeases6DuidIaid();
 }
 
+/// @brief Checks that all IPv6 leases for a subnet can be retrieved.
+TEST_F(PgSqlLeaseMgrTest, getLeases6SubnetId) {
+    testGetLeases6SubnetId();
+}
+
+/// @brief Checks that all IPv6 leases can be retrieved.
+TEST_F(PgSqlLeaseMgrTest, getLeases6) {
+    testGetLeases6();
+}
+
+/// @brief Checks that IPv6 leases can be retrieved in pages.
+TEST_F(PgSqlLeaseMgrTest, getLeases6Paged) {
+    testGetLeases6Paged();
+}
+
 // Check that the system can cope with a DUID of allowed size.
 TEST_F(PgSqlLeaseMgrTest, getLeases6DuidSize) {
     testGetLeases6DuidSize();
@@ -412,6 +442,18 @@ TEST_F(PgSqlLeaseMgrTest, recountLeaseStats6) {
     testRecountLeaseStats6();
 }
 
+// Verifies that IPv4 lease statistics can be recalculated for selected
+// subnets.
+TEST_F(PgSqlLeaseMgrTest, recountSubnetLeaseStats4) {
+    testRecountSubnetLeaseStats4();
+}
+
+// Verifies that IPv6 lease statistics can be recalculated for selected
+// subnets.
+TEST_F(PgSqlLeaseMgrTest, recountSubnetLeaseStats6) {
+    testRecountSubnetLeaseStats6();
+}
+
 // Tests that leases from specific subnet can be removed.
 TEST_F(PgSqlLeaseMgrTest, DISABLED_wipeLeases4) {
     testWipeLeases4();
@@ -422,4 +464,34 @@ TEST_F(PgSqlLeaseMgrTest, DISABLED_wipeLeases6) {
     testWipeLeases6();
 }
 
+// Tests the asynchronous IPv4 lease operations.
+TEST_F(PgSqlLeaseMgrTest, asyncLeases4) {
+    testAsyncLeases4();
+}
+
+// Tests the reclamation of a batch of IPv4 leases.
+TEST_F(PgSqlLeaseMgrTest, reclaimLeases4) {
+    testReclaimLeases4();
+}
+
+// Tests adding and updating a batch of IPv4 leases.
+TEST_F(PgSqlLeaseMgrTest, applyLeases4) {
+    testApplyLeases4();
+}
+
+// Tests the asynchronous IPv6 lease operations.
+TEST_F(PgSqlLeaseMgrTest, asyncLeases6) {
+    testAsyncLeases6();
+}
+
+// Tests the reclamation of a batch of IPv6 leases.
+TEST_F(PgSqlLeaseMgrTest, reclaimLeases6) {
+    testReclaimLeases6();
+}
+
+// Tests adding and updating a batch of IPv6 leases.
+TEST_F(PgSqlLeaseMgrTest, applyLeases6) {
+    testApplyLeases6();
+}
+
 }; // namespace
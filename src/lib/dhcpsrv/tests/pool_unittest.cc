@@ -93,6 +93,32 @@ TEST(Pool4Test, leasesCount) {
     EXPECT_EQ(16777216, pool4.getCapacity());
 }
 
+// Checks that the lease bitmap is created for the pool and that the
+// positions of the addresses in the pool are computed correctly.
+TEST(Pool4Test, leaseBitmap) {
+    Pool4 pool(IOAddress("192.0.2.10"), IOAddress("192.0.2.20"));
+    ASSERT_TRUE(pool.getLeaseBitmap());
+    EXPECT_EQ(11, pool.getLeaseBitmap()->getCapacity());
+
+    EXPECT_EQ(0, pool.getLeaseIndex(IOAddress("192.0.2.10")));
+    EXPECT_EQ(10, pool.getLeaseIndex(IOAddress("192.0.2.20")));
+    EXPECT_THROW(pool.getLeaseIndex(IOAddress("192.0.2.21")), BadValue);
+    EXPECT_EQ("192.0.2.15", pool.getLeaseAddress(5).toText());
+
+    pool.markLeaseUsed(IOAddress("192.0.2.15"));
+    EXPECT_TRUE(pool.getLeaseBitmap()->isUsed(5));
+    pool.markLeaseFree(IOAddress("192.0.2.15"));
+    EXPECT_FALSE(pool.getLeaseBitmap()->isUsed(5));
+
+    // Addresses out of the pool are ignored.
+    EXPECT_NO_THROW(pool.markLeaseUsed(IOAddress("192.0.2.21")));
+    EXPECT_EQ(11, pool.getLeaseBitmap()->getFreeCount());
+
+    // The bitmap is not created for very large pools.
+    Pool4 large_pool(IOAddress("10.0.0.0"), 7);
+    EXPECT_FALSE(large_pool.getLeaseBitmap());
+}
+
 // This test creates 100 pools and verifies that their IDs are unique.
 TEST(Pool4Test, unique_id) {
 
@@ -427,6 +453,33 @@ TEST(Pool6Test, leasesCount) {
     EXPECT_EQ(65536, pool2.getCapacity());
 }
 
+// Checks that the lease bitmap is created for the address and prefix
+// pools and that the positions of the leases are computed correctly.
+TEST(Pool6Test, leaseBitmap) {
+    Pool6 pool1(Lease::TYPE_NA, IOAddress("2001:db8::1"),
+                IOAddress("2001:db8::1:0"));
+    ASSERT_TRUE(pool1.getLeaseBitmap());
+    EXPECT_EQ(65536, pool1.getLeaseBitmap()->getCapacity());
+    EXPECT_EQ(0xfffe, pool1.getLeaseIndex(IOAddress("2001:db8::ffff")));
+    EXPECT_EQ("2001:db8::ffff", pool1.getLeaseAddress(0xfffe).toText());
+
+    // For the prefix pools the position is the number of the delegated
+    // prefix.
+    Pool6 pool2(Lease::TYPE_PD, IOAddress("2001:db8:1::"), 48, 64);
+    ASSERT_TRUE(pool2.getLeaseBitmap());
+    EXPECT_EQ(65536, pool2.getLeaseBitmap()->getCapacity());
+    EXPECT_EQ(0, pool2.getLeaseIndex(IOAddress("2001:db8:1::")));
+    EXPECT_EQ(0x1234, pool2.getLeaseIndex(IOAddress("2001:db8:1:1234::")));
+    EXPECT_EQ("2001:db8:1:1234::", pool2.getLeaseAddress(0x1234).toText());
+
+    pool2.markLeaseUsed(IOAddress("2001:db8:1:1234::"));
+    EXPECT_TRUE(pool2.getLeaseBitmap()->isUsed(0x1234));
+
+    // The bitmap is not created for very large pools.
+    Pool6 pool3(Lease::TYPE_NA, IOAddress("2001:db8:2::"), 64);
+    EXPECT_FALSE(pool3.getLeaseBitmap());
+}
+
 // This test checks that it is possible to specify pool specific options.
 TEST(Pool6Test, addOptions) {
     // Create a pool to add options to it.
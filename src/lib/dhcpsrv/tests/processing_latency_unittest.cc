@@ -0,0 +1,154 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/pkt4.h>
+#include <dhcpsrv/processing_latency.h>
+#include <stats/stats_mgr.h>
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+using namespace isc::data;
+using namespace isc::dhcp;
+using namespace isc::stats;
+
+namespace {
+
+/// @brief Test fixture class for @c ProcessingLatency.
+class ProcessingLatencyTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Adds the DHCPDISCOVER message type and creates a DHCPDISCOVER.
+    ProcessingLatencyTest()
+        : latency_("pkt4"), query_(new Pkt4(DHCPDISCOVER, 1234)) {
+        query_->updateTimestamp();
+        latency_.addMessageType(DHCPDISCOVER, "discover");
+        StatsMgr::instance().removeAll();
+    }
+
+    /// @brief Destructor.
+    ///
+    /// Removes the statistics.
+    ~ProcessingLatencyTest() {
+        StatsMgr::instance().removeAll();
+    }
+
+    /// @brief Histograms being tested.
+    ProcessingLatency latency_;
+
+    /// @brief Query being measured.
+    Pkt4Ptr query_;
+};
+
+// This test verifies that the time of the nested stages is not accounted
+// to the enclosing stage.
+TEST_F(ProcessingLatencyTest, nestedStages) {
+    EXPECT_FALSE(LatencyMeasurement::current());
+    {
+        LatencyMeasurement measurement(latency_, query_);
+        EXPECT_EQ(&measurement, LatencyMeasurement::current());
+
+        StageTimer allocation(ProcessingLatency::STAGE_ALLOCATION);
+        usleep(5000);
+        {
+            StageTimer write(ProcessingLatency::STAGE_LEASE_WRITE);
+            usleep(20000);
+        }
+        usleep(5000);
+    }
+    EXPECT_FALSE(LatencyMeasurement::current());
+
+    const LatencyHistogram& allocation =
+        latency_.getHistogram(DHCPDISCOVER, ProcessingLatency::STAGE_ALLOCATION);
+    const LatencyHistogram& write =
+        latency_.getHistogram(DHCPDISCOVER, ProcessingLatency::STAGE_LEASE_WRITE);
+    const LatencyHistogram& total =
+        latency_.getHistogram(DHCPDISCOVER, ProcessingLatency::STAGE_TOTAL);
+    ASSERT_EQ(1, allocation.getCount());
+    ASSERT_EQ(1, write.getCount());
+    ASSERT_EQ(1, total.getCount());
+    EXPECT_LE(10000, allocation.getMax());
+    EXPECT_GT(20000, allocation.getMax());
+    EXPECT_LE(20000, write.getMax());
+    EXPECT_LE(allocation.getMax() + write.getMax(), total.getMax());
+
+    // The stages which were not entered are not recorded.
+    EXPECT_EQ(0, latency_.getHistogram(DHCPDISCOVER,
+                                       ProcessingLatency::STAGE_PACK).getCount());
+    // The receive stage starts at the timestamp of the packet.
+    EXPECT_EQ(1, latency_.getHistogram(DHCPDISCOVER,
+                                       ProcessingLatency::STAGE_RECEIVE).getCount());
+
+    // The receive stage is not recorded for the packets without timestamp.
+    {
+        LatencyMeasurement measurement(latency_,
+                                       Pkt4Ptr(new Pkt4(DHCPDISCOVER, 1234)));
+    }
+    EXPECT_EQ(2, total.getCount());
+    EXPECT_EQ(1, latency_.getHistogram(DHCPDISCOVER,
+                                       ProcessingLatency::STAGE_RECEIVE).getCount());
+}
+
+// This test verifies that the stage timers are ignored when no measurement
+// is in progress.
+TEST_F(ProcessingLatencyTest, noMeasurement) {
+    {
+        StageTimer write(ProcessingLatency::STAGE_LEASE_WRITE);
+    }
+    EXPECT_EQ(0, latency_.getHistogram(DHCPDISCOVER,
+                                       ProcessingLatency::STAGE_LEASE_WRITE).getCount());
+}
+
+// This test verifies that the messages are recorded by type, and that the
+// histograms are returned and published as statistics.
+TEST_F(ProcessingLatencyTest, byType) {
+    {
+        LatencyMeasurement measurement(latency_, query_);
+        StageTimer pack(ProcessingLatency::STAGE_PACK);
+    }
+    {
+        // The type is read when the measurement is recorded.
+        Pkt4Ptr request(new Pkt4(DHCPDISCOVER, 1234));
+        LatencyMeasurement measurement(latency_, request);
+        request->setType(DHCPREQUEST);
+    }
+    EXPECT_EQ(1, latency_.getHistogram(DHCPDISCOVER,
+                                       ProcessingLatency::STAGE_TOTAL).getCount());
+    EXPECT_EQ(1, latency_.getHistogram(DHCPREQUEST,
+                                       ProcessingLatency::STAGE_TOTAL).getCount());
+    // The unknown types share the histograms.
+    EXPECT_EQ(&latency_.getHistogram(DHCPREQUEST, ProcessingLatency::STAGE_TOTAL),
+              &latency_.getHistogram(DHCPINFORM, ProcessingLatency::STAGE_TOTAL));
+
+    ElementPtr summary = latency_.toElement();
+    ASSERT_TRUE(summary);
+    ConstElementPtr discover = summary->get("discover");
+    ASSERT_TRUE(discover);
+    ASSERT_TRUE(discover->get("pack"));
+    EXPECT_EQ(1, discover->get("pack")->get("count")->intValue());
+    EXPECT_FALSE(discover->get("allocation"));
+    ConstElementPtr unknown = summary->get("unknown");
+    ASSERT_TRUE(unknown);
+    EXPECT_FALSE(unknown->get("pack"));
+    ASSERT_TRUE(unknown->get("total"));
+
+    latency_.updateStatistics();
+    EXPECT_TRUE(StatsMgr::instance().getObservation("pkt4-discover-latency-pack-p50"));
+    EXPECT_TRUE(StatsMgr::instance().getObservation("pkt4-discover-latency-pack-p99"));
+    EXPECT_TRUE(StatsMgr::instance().getObservation("pkt4-discover-latency-total-max"));
+    EXPECT_TRUE(StatsMgr::instance().getObservation("pkt4-unknown-latency-total-max"));
+    EXPECT_FALSE(StatsMgr::instance().getObservation("pkt4-unknown-latency-pack-max"));
+
+    latency_.reset();
+    EXPECT_TRUE(latency_.toElement()->mapValue().empty());
+}
+
+} // end of anonymous namespace
@@ -0,0 +1,80 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/pkt4.h>
+#include <dhcpsrv/response_batch.h>
+
+#include <gtest/gtest.h>
+
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief Type of the batch tested.
+typedef ResponseBatch<Pkt4Ptr> ResponseBatch4;
+
+// Test that the responses are handed over when the cycle is closed after
+// all the queries have been processed.
+TEST(ResponseBatchTest, closeAfterDone) {
+    ResponseBatch4 batch;
+    std::vector<Pkt4Ptr> ready;
+    Pkt4Ptr offer(new Pkt4(DHCPOFFER, 1));
+    Pkt4Ptr ack(new Pkt4(DHCPACK, 2));
+
+    batch.add();
+    batch.add();
+    batch.add();
+    EXPECT_FALSE(batch.done(offer, ready));
+    EXPECT_FALSE(batch.done(Pkt4Ptr(), ready));
+    EXPECT_FALSE(batch.done(ack, ready));
+    EXPECT_TRUE(ready.empty());
+
+    ASSERT_TRUE(batch.close(ready));
+    ASSERT_EQ(2, ready.size());
+    EXPECT_TRUE(ready[0] == offer);
+    EXPECT_TRUE(ready[1] == ack);
+
+    // The responses are handed over once.
+    ready.clear();
+    EXPECT_FALSE(batch.close(ready));
+    EXPECT_TRUE(ready.empty());
+}
+
+// Test that the responses are handed over to the caller processing the
+// last query of a closed cycle.
+TEST(ResponseBatchTest, doneAfterClose) {
+    ResponseBatch4 batch;
+    std::vector<Pkt4Ptr> ready;
+    Pkt4Ptr offer(new Pkt4(DHCPOFFER, 1));
+    Pkt4Ptr ack(new Pkt4(DHCPACK, 2));
+
+    batch.add();
+    batch.add();
+    EXPECT_FALSE(batch.done(offer, ready));
+    EXPECT_FALSE(batch.close(ready));
+    EXPECT_TRUE(ready.empty());
+
+    ASSERT_TRUE(batch.done(ack, ready));
+    ASSERT_EQ(2, ready.size());
+    EXPECT_TRUE(ready[0] == offer);
+    EXPECT_TRUE(ready[1] == ack);
+}
+
+// Test that nothing is handed over when there is no response.
+TEST(ResponseBatchTest, noResponse) {
+    ResponseBatch4 batch;
+    std::vector<Pkt4Ptr> ready;
+
+    EXPECT_FALSE(batch.close(ready));
+
+    batch.add();
+    EXPECT_FALSE(batch.done(Pkt4Ptr(), ready));
+    EXPECT_TRUE(ready.empty());
+}
+
+}
@@ -0,0 +1,105 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <asiolink/io_address.h>
+#include <dhcpsrv/subnet_selection_index.h>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief Accepts the subnets at positions other than the specified one.
+class ExcludedSubnet {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param excluded Position of the subnet which is not accepted.
+    explicit ExcludedSubnet(const size_t excluded)
+        : excluded_(excluded) {
+    }
+
+    /// @brief Checks if the subnet is accepted.
+    ///
+    /// @param position Position of the subnet.
+    bool operator()(const size_t position) const {
+        return (position != excluded_);
+    }
+
+private:
+
+    /// @brief Position of the subnet which is not accepted.
+    size_t excluded_;
+};
+
+// Checks that the subnets are found by key in the configuration order.
+TEST(KeySelectionIndexTest, find) {
+    KeySelectionIndex<std::string> index;
+    index.add("eth0", 0);
+    index.add("eth1", 1);
+    index.add("eth0", 2);
+
+    EXPECT_EQ(0, index.find("eth0", AnySubnet()));
+    EXPECT_EQ(1, index.find("eth1", AnySubnet()));
+    EXPECT_EQ(NO_SUBNET_POSITION, index.find("eth2", AnySubnet()));
+
+    // The next subnet with the key is returned if the first one is not
+    // accepted.
+    EXPECT_EQ(2, index.find("eth0", ExcludedSubnet(0)));
+    EXPECT_EQ(NO_SUBNET_POSITION, index.find("eth1", ExcludedSubnet(1)));
+
+    index.clear();
+    EXPECT_EQ(NO_SUBNET_POSITION, index.find("eth0", AnySubnet()));
+}
+
+// Checks that the subnets are found by IPv4 address.
+TEST(PrefixSelectionIndexTest, findV4) {
+    PrefixSelectionIndex index;
+    index.add(IOAddress("192.0.2.0"), 26, 0);
+    index.add(IOAddress("10.0.0.0"), 8, 1);
+    index.add(IOAddress("192.0.2.0"), 24, 2);
+    index.add(IOAddress("0.0.0.0"), 0, 3);
+    index.add(IOAddress("2001:db8::"), 32, 4);
+
+    EXPECT_EQ(0, index.find(IOAddress("192.0.2.1"), AnySubnet()));
+    EXPECT_EQ(1, index.find(IOAddress("10.1.2.3"), AnySubnet()));
+    EXPECT_EQ(2, index.find(IOAddress("192.0.2.100"), AnySubnet()));
+    EXPECT_EQ(3, index.find(IOAddress("172.16.1.1"), AnySubnet()));
+
+    // The subnet having the shorter prefix is returned if the subnet
+    // having the longer prefix is not accepted.
+    EXPECT_EQ(2, index.find(IOAddress("192.0.2.1"), ExcludedSubnet(0)));
+
+    index.clear();
+    EXPECT_EQ(NO_SUBNET_POSITION, index.find(IOAddress("192.0.2.1"),
+                                             AnySubnet()));
+}
+
+// Checks that the subnet configured first is returned for the address
+// belonging to overlapping prefixes.
+TEST(PrefixSelectionIndexTest, findV6Order) {
+    PrefixSelectionIndex index;
+    index.add(IOAddress("2001:db8::"), 32, 0);
+    index.add(IOAddress("2001:db8:1::"), 64, 1);
+    index.add(IOAddress("2001:db8:1::1"), 128, 2);
+    index.add(IOAddress("192.0.2.0"), 24, 3);
+
+    EXPECT_EQ(0, index.find(IOAddress("2001:db8:1::1"), AnySubnet()));
+    EXPECT_EQ(1, index.find(IOAddress("2001:db8:1::1"), ExcludedSubnet(0)));
+    EXPECT_EQ(NO_SUBNET_POSITION, index.find(IOAddress("2001:db9::1"),
+                                             AnySubnet()));
+
+    // The prefix is stored with the host bits cleared.
+    index.add(IOAddress("3000::1"), 16, 4);
+    EXPECT_EQ(4, index.find(IOAddress("3000:1::1"), AnySubnet()));
+}
+
+} // end of anonymous namespace
@@ -0,0 +1,503 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <eval/compiled_expression.h>
+#include <eval/eval_log.h>
+#include <eval/evaluate.h>
+#include <algorithm>
+#include <boost/shared_ptr.hpp>
+#include <sstream>
+#include <typeinfo>
+#include <stdint.h>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Compiles the expression
+///
+/// The expression in the reverse polish notation is converted to a tree
+/// first, so as the operands of each operator are known when its
+/// instructions are generated.
+class ExpressionCompiler {
+public:
+
+    /// @brief Constructor
+    ///
+    /// @param compiled the compiled expression receiving the instructions
+    ExpressionCompiler(CompiledExpression& compiled)
+        : compiled_(compiled) {
+    }
+
+    /// @brief Compiles the expression
+    ///
+    /// @return false if the expression can't be compiled
+    bool compile() {
+        NodePtr root = buildTree();
+        if (!root) {
+            return (false);
+        }
+        compiled_.bool_result_ = emit(*root);
+        setEqualityTest(*root);
+        return (true);
+    }
+
+private:
+
+    /// @brief Kinds of the nodes of the tree
+    enum Kind {
+        CONSTANT, ///< constant string
+        VALUE,    ///< token pushing a string, possibly popping its operands
+        EQUAL,    ///< equality
+        NOT,      ///< logical negation
+        AND,      ///< logical and
+        OR,       ///< logical or
+        IFELSE    ///< alternative
+    };
+
+    /// @brief Node of the tree
+    struct Node;
+
+    /// @brief Pointer to the node
+    typedef boost::shared_ptr<Node> NodePtr;
+
+    struct Node {
+        Kind kind_;                     ///< kind of the node
+        size_t index_;                  ///< index of the token
+        std::vector<NodePtr> operands_; ///< operands
+    };
+
+    /// @brief Classifies the token
+    ///
+    /// @param token the token
+    /// @param [out] kind kind of the node
+    /// @param [out] arity number of operands
+    /// @return false if the token is not known
+    static bool classify(const Token* token, Kind& kind, size_t& arity) {
+        arity = 0;
+        if (dynamic_cast<const TokenString*>(token) ||
+            dynamic_cast<const TokenHexString*>(token) ||
+            dynamic_cast<const TokenIpAddress*>(token)) {
+            kind = CONSTANT;
+        } else if (dynamic_cast<const TokenOption*>(token) ||
+                   dynamic_cast<const TokenPkt*>(token) ||
+                   dynamic_cast<const TokenPkt4*>(token) ||
+                   dynamic_cast<const TokenPkt6*>(token) ||
+                   dynamic_cast<const TokenRelay6Field*>(token)) {
+            kind = VALUE;
+        } else if (dynamic_cast<const TokenSubstring*>(token)) {
+            kind = VALUE;
+            arity = 3;
+        } else if (dynamic_cast<const TokenConcat*>(token)) {
+            kind = VALUE;
+            arity = 2;
+        } else if (dynamic_cast<const TokenEqual*>(token)) {
+            kind = EQUAL;
+            arity = 2;
+        } else if (dynamic_cast<const TokenNot*>(token)) {
+            kind = NOT;
+            arity = 1;
+        } else if (dynamic_cast<const TokenAnd*>(token)) {
+            kind = AND;
+            arity = 2;
+        } else if (dynamic_cast<const TokenOr*>(token)) {
+            kind = OR;
+            arity = 2;
+        } else if (dynamic_cast<const TokenIfElse*>(token)) {
+            kind = IFELSE;
+            arity = 3;
+        } else {
+            return (false);
+        }
+        return (true);
+    }
+
+    /// @brief Converts the expression to a tree
+    ///
+    /// @return the root of the tree or null if the expression is malformed
+    /// or holds an unknown token
+    NodePtr buildTree() const {
+        const Expression& expr = compiled_.expr_;
+        std::vector<NodePtr> stack;
+        for (size_t i = 0; i < expr.size(); ++i) {
+            NodePtr node(new Node());
+            node->index_ = i;
+            size_t arity = 0;
+            if (!expr[i] || !classify(expr[i].get(), node->kind_, arity) ||
+                (stack.size() < arity)) {
+                return (NodePtr());
+            }
+            node->operands_.assign(stack.end() - arity, stack.end());
+            stack.resize(stack.size() - arity);
+            stack.push_back(node);
+        }
+        if (stack.size() != 1) {
+            return (NodePtr());
+        }
+        return (stack.back());
+    }
+
+    /// @brief Returns the index of the first token of the sub-expression
+    ///
+    /// @param node the root of the sub-expression
+    static size_t firstIndex(const Node& node) {
+        const Node* first = &node;
+        while (!first->operands_.empty()) {
+            first = first->operands_[0].get();
+        }
+        return (first->index_);
+    }
+
+    /// @brief Records the key of the "key == constant" expression
+    ///
+    /// @param root the root of the tree
+    void setEqualityTest(const Node& root) {
+        if (root.kind_ != EQUAL) {
+            return;
+        }
+        // Same choice of the constant as for the instructions.
+        size_t key = 0;
+        size_t constant = 1;
+        if (root.operands_[constant]->kind_ != CONSTANT) {
+            std::swap(key, constant);
+            if (root.operands_[constant]->kind_ != CONSTANT) {
+                return;
+            }
+        }
+        const Node& key_node = *root.operands_[key];
+        const Expression& expr = compiled_.expr_;
+        compiled_.key_.assign(expr.begin() + firstIndex(key_node),
+                              expr.begin() + key_node.index_ + 1);
+        compiled_.key_constant_ = constantValue(*root.operands_[constant]);
+    }
+
+    /// @brief Returns the value of the constant token
+    ///
+    /// @param node the node of the constant token
+    const std::string& constantValue(const Node& node) const {
+        const Token* token = compiled_.expr_[node.index_].get();
+        const TokenString* str = dynamic_cast<const TokenString*>(token);
+        if (str) {
+            return (str->getValue());
+        }
+        const TokenHexString* hex = dynamic_cast<const TokenHexString*>(token);
+        if (hex) {
+            return (hex->getValue());
+        }
+        return (dynamic_cast<const TokenIpAddress*>(token)->getValue());
+    }
+
+    /// @brief Adds the constant
+    ///
+    /// @param node the node of the constant token
+    /// @return the index of the constant
+    size_t addConstant(const Node& node) {
+        compiled_.constants_.push_back(constantValue(node));
+        return (compiled_.constants_.size() - 1);
+    }
+
+    /// @brief Appends the instruction
+    ///
+    /// @param op the instruction code
+    /// @param arg the instruction argument
+    /// @return the position of the instruction
+    size_t add(const CompiledExpression::OpCode op, const size_t arg = 0) {
+        compiled_.code_.push_back(CompiledExpression::Instruction(op, arg));
+        return (compiled_.code_.size() - 1);
+    }
+
+    /// @brief Sets the target of the jump instruction to the next one
+    ///
+    /// @param position the position of the jump instruction
+    void setJumpTarget(const size_t position) {
+        compiled_.code_[position].arg_ = compiled_.code_.size();
+    }
+
+    /// @brief Generates the instructions leaving a string on the stack
+    ///
+    /// @param node the node
+    void emitString(const Node& node) {
+        if (emit(node)) {
+            add(CompiledExpression::OP_FROM_BOOL);
+        }
+    }
+
+    /// @brief Generates the instructions leaving the boolean in
+    /// the register
+    ///
+    /// @param node the node
+    void emitBool(const Node& node) {
+        if (!emit(node)) {
+            add(CompiledExpression::OP_TO_BOOL);
+        }
+    }
+
+    /// @brief Generates the instructions for the node
+    ///
+    /// @param node the node
+    /// @return true if the instructions leave the boolean in the register,
+    /// false if they leave a string on the stack
+    bool emit(const Node& node) {
+        switch (node.kind_) {
+        case CONSTANT:
+            add(CompiledExpression::OP_CONST, addConstant(node));
+            return (false);
+
+        case VALUE:
+            for (size_t i = 0; i < node.operands_.size(); ++i) {
+                emitString(*node.operands_[i]);
+            }
+            add(CompiledExpression::OP_TOKEN, node.index_);
+            return (false);
+
+        case EQUAL:
+            // The equality is symmetric, so the constant may be either
+            // operand.
+            if (node.operands_[1]->kind_ == CONSTANT) {
+                emitString(*node.operands_[0]);
+                add(CompiledExpression::OP_EQUAL_CONST,
+                    addConstant(*node.operands_[1]));
+            } else if (node.operands_[0]->kind_ == CONSTANT) {
+                emitString(*node.operands_[1]);
+                add(CompiledExpression::OP_EQUAL_CONST,
+                    addConstant(*node.operands_[0]));
+            } else {
+                emitString(*node.operands_[0]);
+                emitString(*node.operands_[1]);
+                add(CompiledExpression::OP_EQUAL);
+            }
+            return (true);
+
+        case NOT:
+            emitBool(*node.operands_[0]);
+            add(CompiledExpression::OP_NOT);
+            return (true);
+
+        case AND:
+        case OR: {
+            emitBool(*node.operands_[0]);
+            size_t jump = add(node.kind_ == AND ?
+                              CompiledExpression::OP_JUMP_IF_FALSE :
+                              CompiledExpression::OP_JUMP_IF_TRUE);
+            emitBool(*node.operands_[1]);
+            setJumpTarget(jump);
+            return (true);
+        }
+
+        case IFELSE: {
+            emitBool(*node.operands_[0]);
+            size_t branch = add(CompiledExpression::OP_JUMP_IF_FALSE);
+            emitString(*node.operands_[1]);
+            size_t jump = add(CompiledExpression::OP_JUMP);
+            setJumpTarget(branch);
+            emitString(*node.operands_[2]);
+            setJumpTarget(jump);
+            return (false);
+        }
+
+        default:
+            ;
+        }
+        return (false);
+    }
+
+    /// @brief The compiled expression receiving the instructions
+    CompiledExpression& compiled_;
+};
+
+CompiledExpression::CompiledExpression(const Expression& expr)
+    : expr_(expr), code_(), constants_(), bool_result_(false), key_(),
+      key_constant_() {
+    ExpressionCompiler compiler(*this);
+    if (!compiler.compile()) {
+        code_.clear();
+        constants_.clear();
+    }
+}
+
+bool
+CompiledExpression::getEqualityTest(Expression& key,
+                                    std::string& constant) const {
+    if (key_.empty()) {
+        return (false);
+    }
+    key = key_;
+    constant = key_constant_;
+    return (true);
+}
+
+bool
+CompiledExpression::getSignature(const Expression& expr,
+                                 std::string& signature) {
+    std::ostringstream s;
+    for (size_t i = 0; i < expr.size(); ++i) {
+        const Token* token = expr[i].get();
+        if (!token) {
+            return (false);
+        }
+        // The derived classes may have other parameters, so the exact
+        // type is checked.
+        const std::type_info& type = typeid(*token);
+        s << type.name() << "(";
+        if ((type == typeid(TokenString)) || (type == typeid(TokenInteger))) {
+            const std::string& value =
+                static_cast<const TokenString*>(token)->getValue();
+            s << value.size() << ":" << value;
+
+        } else if (type == typeid(TokenHexString)) {
+            const std::string& value =
+                static_cast<const TokenHexString*>(token)->getValue();
+            s << value.size() << ":" << value;
+
+        } else if (type == typeid(TokenIpAddress)) {
+            const std::string& value =
+                static_cast<const TokenIpAddress*>(token)->getValue();
+            s << value.size() << ":" << value;
+
+        } else if ((type == typeid(TokenOption)) ||
+                   (type == typeid(TokenRelay4Option))) {
+            const TokenOption* option = static_cast<const TokenOption*>(token);
+            s << option->getCode() << "," << option->getRepresentation();
+
+        } else if (type == typeid(TokenRelay6Option)) {
+            const TokenRelay6Option* option =
+                static_cast<const TokenRelay6Option*>(token);
+            s << static_cast<int>(option->getNest()) << ","
+              << option->getCode() << "," << option->getRepresentation();
+
+        } else if (type == typeid(TokenPkt)) {
+            s << static_cast<const TokenPkt*>(token)->getType();
+
+        } else if (type == typeid(TokenPkt4)) {
+            s << static_cast<const TokenPkt4*>(token)->getType();
+
+        } else if (type == typeid(TokenPkt6)) {
+            s << static_cast<const TokenPkt6*>(token)->getType();
+
+        } else if (type == typeid(TokenRelay6Field)) {
+            const TokenRelay6Field* field =
+                static_cast<const TokenRelay6Field*>(token);
+            s << static_cast<int>(field->getNest()) << ","
+              << field->getType();
+
+        } else if ((type != typeid(TokenSubstring)) &&
+                   (type != typeid(TokenConcat)) &&
+                   (type != typeid(TokenEqual)) &&
+                   (type != typeid(TokenNot)) &&
+                   (type != typeid(TokenAnd)) &&
+                   (type != typeid(TokenOr)) &&
+                   (type != typeid(TokenIfElse))) {
+            return (false);
+        }
+        s << ")";
+    }
+    signature = s.str();
+    return (true);
+}
+
+bool
+CompiledExpression::interpret() const {
+    return (code_.empty() || eval_logger.isDebugEnabled(EVAL_DBG_STACK));
+}
+
+bool
+CompiledExpression::evaluateBool(Pkt& pkt, ValueStack& values) const {
+    if (interpret()) {
+        return (isc::dhcp::evaluateBool(expr_, pkt));
+    }
+    bool result = run(pkt, values);
+    if (!bool_result_) {
+        result = Token::toBool(values.top());
+        values.pop();
+    }
+    return (result);
+}
+
+std::string
+CompiledExpression::evaluateString(Pkt& pkt, ValueStack& values) const {
+    if (interpret()) {
+        return (isc::dhcp::evaluateString(expr_, pkt));
+    }
+    bool result = run(pkt, values);
+    if (bool_result_) {
+        return (result ? "true" : "false");
+    }
+    std::string value;
+    value.swap(values.top());
+    values.pop();
+    return (value);
+}
+
+bool
+CompiledExpression::run(Pkt& pkt, ValueStack& values) const {
+    // The previous evaluation may have been interrupted by an exception.
+    while (!values.empty()) {
+        values.pop();
+    }
+
+    bool result = false;
+    std::string value;
+    size_t pc = 0;
+    while (pc < code_.size()) {
+        const Instruction& instruction = code_[pc++];
+        switch (instruction.op_) {
+        case OP_CONST:
+            values.push(constants_[instruction.arg_]);
+            break;
+
+        case OP_TOKEN:
+            expr_[instruction.arg_]->evaluate(pkt, values);
+            break;
+
+        case OP_EQUAL:
+            // Take the top string without copying it.
+            value.swap(values.top());
+            values.pop();
+            result = (value == values.top());
+            values.pop();
+            break;
+
+        case OP_EQUAL_CONST:
+            result = (values.top() == constants_[instruction.arg_]);
+            values.pop();
+            break;
+
+        case OP_NOT:
+            result = !result;
+            break;
+
+        case OP_JUMP_IF_FALSE:
+            if (!result) {
+                pc = instruction.arg_;
+            }
+            break;
+
+        case OP_JUMP_IF_TRUE:
+            if (result) {
+                pc = instruction.arg_;
+            }
+            break;
+
+        case OP_JUMP:
+            pc = instruction.arg_;
+            break;
+
+        case OP_TO_BOOL:
+            result = Token::toBool(values.top());
+            values.pop();
+            break;
+
+        case OP_FROM_BOOL:
+            values.push(result ? "true" : "false");
+            break;
+        }
+    }
+
+    return (result);
+}
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
@@ -0,0 +1,177 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef COMPILED_EXPRESSION_H
+#define COMPILED_EXPRESSION_H
+
+#include <eval/token.h>
+#include <boost/shared_ptr.hpp>
+#include <string>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Expression compiled to a sequence of instructions
+///
+/// The @ref evaluateBool function interprets the tokens of the expression
+/// and each token passes its result to the next ones as a string on the
+/// value stack, including the boolean results which are "true" or "false".
+/// The expression is compiled once, when the configuration is parsed, to
+/// a sequence of instructions which:
+/// - keep the boolean results in a register rather than in strings,
+/// - compare the values with the constants in place, without pushing
+///   the constants on the stack,
+/// - skip the second operand of "and" and "or" when the first operand
+///   determines the result, and the unused branch of "ifelse".
+///
+/// Each boolean result is consumed before the next one is computed, so
+/// a single register is enough.
+///
+/// The tokens extracting data from the packet and the string operators
+/// are evaluated as before. The caller supplies the value stack, so the
+/// same stack can be used to evaluate many expressions.
+///
+/// The expressions which can't be compiled, e.g. because they hold an
+/// unknown token, are interpreted. They are also interpreted when the
+/// debug logging of the evaluation steps is enabled, so as each step
+/// is logged.
+class CompiledExpression {
+public:
+
+    /// @brief Instruction codes
+    enum OpCode {
+        OP_CONST,         ///< push the constant string
+        OP_TOKEN,         ///< evaluate the token on the value stack
+        OP_EQUAL,         ///< compare the two top strings
+        OP_EQUAL_CONST,   ///< compare the top string with a constant
+        OP_NOT,           ///< negate the boolean
+        OP_JUMP_IF_FALSE, ///< jump if the boolean is false
+        OP_JUMP_IF_TRUE,  ///< jump if the boolean is true
+        OP_JUMP,          ///< jump
+        OP_TO_BOOL,       ///< convert the top string to the boolean
+        OP_FROM_BOOL      ///< push the boolean as a string
+    };
+
+    /// @brief Single instruction
+    struct Instruction {
+        /// @brief Constructor
+        ///
+        /// @param op instruction code
+        /// @param arg index of the constant or the token, or the position
+        /// of the jump target
+        Instruction(const OpCode op, const size_t arg = 0)
+            : op_(op), arg_(arg) {
+        }
+
+        OpCode op_;  ///< instruction code
+        size_t arg_; ///< instruction argument
+    };
+
+    /// @brief Constructor
+    ///
+    /// Compiles the expression. The expression which can't be compiled
+    /// is interpreted on evaluation.
+    ///
+    /// @param expr expression in the reverse polish notation
+    explicit CompiledExpression(const Expression& expr);
+
+    /// @brief Checks if the expression has been compiled
+    ///
+    /// @return false if the expression is interpreted
+    bool isCompiled() const {
+        return (!code_.empty());
+    }
+
+    /// @brief Returns the compiled instructions
+    const std::vector<Instruction>& getCode() const {
+        return (code_);
+    }
+
+    /// @brief Evaluates the expression to a boolean
+    ///
+    /// @param pkt packet being evaluated
+    /// @param values value stack used for the evaluation. It is emptied
+    /// before the evaluation.
+    /// @return the result of the evaluation
+    /// @throw EvalBadStack if the expression is malformed
+    /// @throw EvalTypeError if the result is not a boolean
+    bool evaluateBool(Pkt& pkt, ValueStack& values) const;
+
+    /// @brief Evaluates the expression to a string
+    ///
+    /// @param pkt packet being evaluated
+    /// @param values value stack used for the evaluation. It is emptied
+    /// before the evaluation.
+    /// @return the result of the evaluation
+    /// @throw EvalBadStack if the expression is malformed
+    std::string evaluateString(Pkt& pkt, ValueStack& values) const;
+
+    /// @brief Checks if the expression compares a value with a constant
+    ///
+    /// Many expressions are of the form "key == constant", e.g.
+    /// "option[60].hex == 'foo'". The expressions sharing the same key
+    /// can be evaluated together: the key is evaluated once and its value
+    /// selects the expressions which are true.
+    ///
+    /// @param [out] key the expression computing the value compared with
+    /// the constant
+    /// @param [out] constant the constant
+    /// @return true if the expression is of the form "key == constant",
+    /// false otherwise in which case the parameters are unchanged
+    bool getEqualityTest(Expression& key, std::string& constant) const;
+
+    /// @brief Returns the text identifying the expression
+    ///
+    /// Two expressions with the same signature compute the same value.
+    ///
+    /// @param expr the expression
+    /// @param [out] signature the signature of the expression
+    /// @return false if the expression holds a token for which the
+    /// signature can't be computed
+    static bool getSignature(const Expression& expr, std::string& signature);
+
+private:
+
+    /// @brief Checks if the expression must be interpreted
+    bool interpret() const;
+
+    /// @brief Runs the instructions
+    ///
+    /// @param pkt packet being evaluated
+    /// @param values value stack which holds the string result
+    /// @return the boolean result, if the result is a boolean
+    bool run(Pkt& pkt, ValueStack& values) const;
+
+    /// @brief The source expression
+    Expression expr_;
+
+    /// @brief The instructions
+    std::vector<Instruction> code_;
+
+    /// @brief The constant strings
+    std::vector<std::string> constants_;
+
+    /// @brief Indicates if the result is a boolean (or a string)
+    bool bool_result_;
+
+    /// @brief The key of the "key == constant" expression, empty if
+    /// the expression is not of this form
+    Expression key_;
+
+    /// @brief The constant of the "key == constant" expression
+    std::string key_constant_;
+
+    friend class ExpressionCompiler;
+};
+
+/// @brief Pointer to the compiled expression
+typedef boost::shared_ptr<CompiledExpression> CompiledExpressionPtr;
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
+
+#endif
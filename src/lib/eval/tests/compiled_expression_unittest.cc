@@ -0,0 +1,266 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <eval/compiled_expression.h>
+#include <eval/eval_context.h>
+#include <eval/token.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/option_string.h>
+#include <dhcp/pkt4.h>
+
+#include <gtest/gtest.h>
+
+#include <set>
+
+using namespace std;
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief Token of a type unknown to the compiler.
+class TokenUnknown : public Token {
+public:
+    /// @brief Pushes "true" on the stack
+    ///
+    /// @param pkt (unused)
+    /// @param values stack of values
+    void evaluate(Pkt&, ValueStack& values) {
+        values.push("true");
+    }
+};
+
+/// @brief Test fixture for testing compiled expressions.
+class CompiledExpressionTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor
+    ///
+    /// Creates the packet with the option 100 holding "hundred4".
+    CompiledExpressionTest()
+        : pkt4_(new Pkt4(DHCPDISCOVER, 12345)) {
+        pkt4_->addOption(OptionPtr(new OptionString(Option::V4, 100,
+                                                    "hundred4")));
+    }
+
+    /// @brief Parses the expression
+    ///
+    /// @param expr expression to be parsed
+    /// @param type type of the expression
+    Expression parse(const string& expr,
+                     EvalContext::ParserType type = EvalContext::PARSER_BOOL) {
+        EvalContext eval(Option::V4);
+        EXPECT_TRUE(eval.parseString(expr, type)) << expr;
+        return (eval.expression);
+    }
+
+    /// @brief Counts the instructions of the given kind
+    ///
+    /// @param compiled compiled expression
+    /// @param op instruction code
+    size_t count(const CompiledExpression& compiled,
+                 const CompiledExpression::OpCode op) {
+        size_t n = 0;
+        for (size_t i = 0; i < compiled.getCode().size(); ++i) {
+            if (compiled.getCode()[i].op_ == op) {
+                ++n;
+            }
+        }
+        return (n);
+    }
+
+    /// @brief Packet used in the tests
+    Pkt4Ptr pkt4_;
+
+    /// @brief Value stack used in the tests
+    ValueStack values_;
+};
+
+// This test verifies that the comparison with a constant doesn't push
+// the constant on the stack and that the booleans are not converted
+// to strings.
+TEST_F(CompiledExpressionTest, equalConst) {
+    CompiledExpression compiled(parse("option[100].text == 'hundred4'"));
+    ASSERT_TRUE(compiled.isCompiled());
+    ASSERT_EQ(2, compiled.getCode().size());
+    EXPECT_EQ(CompiledExpression::OP_TOKEN, compiled.getCode()[0].op_);
+    EXPECT_EQ(CompiledExpression::OP_EQUAL_CONST, compiled.getCode()[1].op_);
+    EXPECT_TRUE(compiled.evaluateBool(*pkt4_, values_));
+    EXPECT_TRUE(values_.empty());
+
+    // The constant can be the first operand too.
+    CompiledExpression reversed(parse("'hundred' == option[100].text"));
+    ASSERT_TRUE(reversed.isCompiled());
+    EXPECT_EQ(1, count(reversed, CompiledExpression::OP_EQUAL_CONST));
+    EXPECT_FALSE(reversed.evaluateBool(*pkt4_, values_));
+
+    // The result of the boolean expression can be returned as a string.
+    EXPECT_EQ("true", compiled.evaluateString(*pkt4_, values_));
+}
+
+// This test verifies that "and" and "or" don't evaluate the second
+// operand when the first one determines the result.
+TEST_F(CompiledExpressionTest, shortCircuit) {
+    CompiledExpression compiled(parse("option[100].exists and "
+                                      "(option[100].text == 'hundred4')"));
+    ASSERT_TRUE(compiled.isCompiled());
+    EXPECT_EQ(1, count(compiled, CompiledExpression::OP_JUMP_IF_FALSE));
+    // The "exists" value is a string converted to a boolean.
+    EXPECT_EQ(1, count(compiled, CompiledExpression::OP_TO_BOOL));
+    EXPECT_TRUE(compiled.evaluateBool(*pkt4_, values_));
+
+    // The first operand is false, so the jump skips the second one.
+    const CompiledExpression::Instruction& jump = compiled.getCode()[2];
+    ASSERT_EQ(CompiledExpression::OP_JUMP_IF_FALSE, jump.op_);
+    EXPECT_EQ(compiled.getCode().size(), jump.arg_);
+    pkt4_->delOption(100);
+    EXPECT_FALSE(compiled.evaluateBool(*pkt4_, values_));
+
+    CompiledExpression alternative(parse("not option[100].exists or "
+                                         "(option[100].text == 'foo')"));
+    ASSERT_TRUE(alternative.isCompiled());
+    EXPECT_EQ(1, count(alternative,
+                       CompiledExpression::OP_JUMP_IF_TRUE));
+    EXPECT_TRUE(alternative.evaluateBool(*pkt4_, values_));
+}
+
+// This test verifies that only the selected branch of "ifelse" is
+// evaluated.
+TEST_F(CompiledExpressionTest, ifElse) {
+    CompiledExpression compiled(parse("ifelse(option[100].exists, "
+                                      "option[100].text, 'none')",
+                                      EvalContext::PARSER_STRING));
+    ASSERT_TRUE(compiled.isCompiled());
+    EXPECT_EQ(1, count(compiled, CompiledExpression::OP_JUMP_IF_FALSE));
+    EXPECT_EQ(1, count(compiled, CompiledExpression::OP_JUMP));
+    EXPECT_EQ("hundred4", compiled.evaluateString(*pkt4_, values_));
+    pkt4_->delOption(100);
+    EXPECT_EQ("none", compiled.evaluateString(*pkt4_, values_));
+}
+
+// This test verifies that the expressions which can't be compiled are
+// interpreted.
+TEST_F(CompiledExpressionTest, interpreted) {
+    // Empty expression.
+    Expression expr;
+    CompiledExpression empty(expr);
+    EXPECT_FALSE(empty.isCompiled());
+    EXPECT_THROW(empty.evaluateBool(*pkt4_, values_), EvalBadStack);
+
+    // Too many values.
+    expr.push_back(TokenPtr(new TokenString("true")));
+    expr.push_back(TokenPtr(new TokenString("true")));
+    CompiledExpression two(expr);
+    EXPECT_FALSE(two.isCompiled());
+    EXPECT_THROW(two.evaluateBool(*pkt4_, values_), EvalBadStack);
+
+    // Unknown token.
+    expr.clear();
+    expr.push_back(TokenPtr(new TokenUnknown()));
+    expr.push_back(TokenPtr(new TokenNot()));
+    CompiledExpression unknown(expr);
+    EXPECT_FALSE(unknown.isCompiled());
+    EXPECT_FALSE(unknown.evaluateBool(*pkt4_, values_));
+}
+
+// This test verifies that the string values used as booleans are
+// checked and that the stack can be reused after an error.
+TEST_F(CompiledExpressionTest, badBool) {
+    Expression expr;
+    expr.push_back(TokenPtr(new TokenString("foo")));
+    expr.push_back(TokenPtr(new TokenNot()));
+    CompiledExpression compiled(expr);
+    ASSERT_TRUE(compiled.isCompiled());
+    EXPECT_THROW(compiled.evaluateBool(*pkt4_, values_), EvalTypeError);
+
+    // The string is not a boolean.
+    Expression str;
+    str.push_back(TokenPtr(new TokenString("foo")));
+    CompiledExpression compiled_str(str);
+    ASSERT_TRUE(compiled_str.isCompiled());
+    EXPECT_THROW(compiled_str.evaluateBool(*pkt4_, values_), EvalTypeError);
+    EXPECT_EQ("foo", compiled_str.evaluateString(*pkt4_, values_));
+
+    // The stack left after the error is emptied before the evaluation.
+    values_.push("garbage");
+    CompiledExpression valid(parse("option[100].text == 'hundred4'"));
+    EXPECT_TRUE(valid.evaluateBool(*pkt4_, values_));
+    EXPECT_TRUE(values_.empty());
+}
+
+// This test verifies that the key of the comparisons with a constant
+// is returned.
+TEST_F(CompiledExpressionTest, equalityTest) {
+    Expression key;
+    string constant;
+    CompiledExpression compiled(parse("substring(option[100].hex,0,3) == "
+                                      "'hun'"));
+    ASSERT_TRUE(compiled.getEqualityTest(key, constant));
+    EXPECT_EQ("hun", constant);
+    ASSERT_EQ(4, key.size());
+    CompiledExpression key_compiled(key);
+    EXPECT_EQ("hun", key_compiled.evaluateString(*pkt4_, values_));
+
+    // The constant can be the first operand too.
+    CompiledExpression reversed(parse("0x6869 == option[100].hex"));
+    ASSERT_TRUE(reversed.getEqualityTest(key, constant));
+    EXPECT_EQ("hi", constant);
+    ASSERT_EQ(1, key.size());
+
+    // Other expressions.
+    key.clear();
+    constant.clear();
+    CompiledExpression exists(parse("option[100].exists"));
+    EXPECT_FALSE(exists.getEqualityTest(key, constant));
+    CompiledExpression both(parse("option[100].hex == option[101].hex"));
+    EXPECT_FALSE(both.getEqualityTest(key, constant));
+    CompiledExpression negated(parse("not (option[100].hex == 'foo')"));
+    EXPECT_FALSE(negated.getEqualityTest(key, constant));
+    EXPECT_TRUE(key.empty());
+    EXPECT_TRUE(constant.empty());
+}
+
+// This test verifies that the expressions computing the same value have
+// the same signature.
+TEST_F(CompiledExpressionTest, signature) {
+    const EvalContext::ParserType type = EvalContext::PARSER_STRING;
+    string option_hex;
+    ASSERT_TRUE(CompiledExpression::getSignature(parse("option[100].hex",
+                                                       type),
+                                                 option_hex));
+    string other;
+    ASSERT_TRUE(CompiledExpression::getSignature(parse("option[100].hex",
+                                                       type),
+                                                 other));
+    EXPECT_EQ(option_hex, other);
+
+    // Different representation, option, substring or field.
+    const char* expressions[] = {
+        "option[100].text",
+        "option[101].hex",
+        "relay4[100].hex",
+        "substring(option[100].hex,0,3)",
+        "substring(option[100].hex,0,4)",
+        "pkt4.mac",
+        "pkt4.giaddr",
+        "pkt.iface"
+    };
+    set<string> signatures;
+    signatures.insert(option_hex);
+    for (size_t i = 0; i < sizeof(expressions) / sizeof(expressions[0]); ++i) {
+        ASSERT_TRUE(CompiledExpression::getSignature(parse(expressions[i],
+                                                           type),
+                                                     other)) << expressions[i];
+        EXPECT_TRUE(signatures.insert(other).second) << expressions[i];
+    }
+
+    // Unknown token.
+    Expression expr;
+    expr.push_back(TokenPtr(new TokenUnknown()));
+    EXPECT_FALSE(CompiledExpression::getSignature(expr, other));
+}
+
+} // end of anonymous namespace
@@ -5,6 +5,7 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <config.h>
+#include <eval/compiled_expression.h>
 #include <eval/evaluate.h>
 #include <eval/eval_context.h>
 #include <eval/token.h>
@@ -325,6 +326,24 @@ public:
         }
 
         EXPECT_EQ(exp_result, result) << " for expression " << expr;
+
+        // The compiled expression must give the same result.
+        CompiledExpression compiled(eval.expression);
+        EXPECT_TRUE(compiled.isCompiled()) << " for expression " << expr;
+        ValueStack values;
+        result = !exp_result;
+        switch (u) {
+        case Option::V4:
+            ASSERT_NO_THROW(result = compiled.evaluateBool(*pkt4_, values))
+                << " for compiled expression " << expr;
+            break;
+        case Option::V6:
+            ASSERT_NO_THROW(result = compiled.evaluateBool(*pkt6_, values))
+                << " for compiled expression " << expr;
+            break;
+        }
+
+        EXPECT_EQ(exp_result, result) << " for compiled expression " << expr;
     }
 
     /// @brief Checks if expression can be parsed and evaluated to string
@@ -358,6 +377,24 @@ public:
         }
 
         EXPECT_EQ(exp_result, result) << " for expression " << expr;
+
+        // The compiled expression must give the same result.
+        CompiledExpression compiled(eval.expression);
+        EXPECT_TRUE(compiled.isCompiled()) << " for expression " << expr;
+        ValueStack values;
+        result.clear();
+        switch (u) {
+        case Option::V4:
+            ASSERT_NO_THROW(result = compiled.evaluateString(*pkt4_, values))
+                << " for compiled expression " << expr;
+            break;
+        case Option::V6:
+            ASSERT_NO_THROW(result = compiled.evaluateString(*pkt6_, values))
+                << " for compiled expression " << expr;
+            break;
+        }
+
+        EXPECT_EQ(exp_result, result) << " for compiled expression " << expr;
     }
 
     /// @brief Checks that specified expression throws expected exception.
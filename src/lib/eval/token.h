@@ -126,6 +126,13 @@ public:
     /// @param values (represented string will be pushed here)
     void evaluate(Pkt& pkt, ValueStack& values);
 
+    /// @brief Returns the constant value
+    ///
+    /// @return the string pushed on the stack by this token
+    const std::string& getValue() const {
+        return (value_);
+    }
+
 protected:
     std::string value_; ///< Constant value
 };
@@ -151,6 +158,13 @@ public:
     /// @param values (represented string will be pushed here)
     void evaluate(Pkt& pkt, ValueStack& values);
 
+    /// @brief Returns the constant value
+    ///
+    /// @return the string pushed on the stack by this token
+    const std::string& getValue() const {
+        return (value_);
+    }
+
 protected:
     std::string value_; ///< Constant value
 };
@@ -202,6 +216,13 @@ public:
     /// @param values (represented IP address will be pushed here)
     void evaluate(Pkt& pkt, ValueStack& values);
 
+    /// @brief Returns the constant value
+    ///
+    /// @return the string pushed on the stack by this token
+    const std::string& getValue() const {
+        return (value_);
+    }
+
 protected:
     ///< Constant value (empty string if the IP address cannot be converted)
     std::string value_;
@@ -410,7 +431,7 @@ public:
     ///
     /// This method is used only in tests.
     /// @return type of the metadata.
-    MetadataType getType() {
+    MetadataType getType() const {
         return (type_);
     }
 
@@ -467,7 +488,7 @@ public:
     ///
     /// This method is used only in tests.
     /// @return type of the field.
-    FieldType getType() {
+    FieldType getType() const {
         return (type_);
     }
 
@@ -513,7 +534,7 @@ public:
     ///
     /// This method is used only in tests.
     /// @return type of the field.
-    FieldType getType() {
+    FieldType getType() const {
         return(type_);
     }
 
@@ -580,7 +601,7 @@ public:
     /// instantiated TokenRelay6Field with correct parameters.
     ///
     /// @return type of the field.
-    FieldType getType() {
+    FieldType getType() const {
         return (type_);
     }
 
@@ -20,10 +20,59 @@
 #include <utility>
 
 using namespace std;
+using namespace isc::util::thread;
 
 namespace isc {
 namespace hooks {
 
+namespace {
+
+/// @brief Hook and library indexes of the callout being executed.
+///
+/// Callouts may be called concurrently by several packet processing
+/// threads, so the indexes of the hook and library being called are held
+/// per thread rather than in the CalloutManager.
+struct CallingState {
+    /// Manager executing the callouts or NULL when none is executing.
+    const CalloutManager* manager_;
+
+    /// Index of the hook being called.
+    int hook_;
+
+    /// Index of the library which registered the callout being called.
+    int library_;
+};
+
+/// Calling state of the current thread.
+thread_local CallingState calling_state = { 0, -1, -1 };
+
+/// @brief Sets the calling state of the current thread and restores the
+/// previous one on destruction.
+class CallingStateGuard {
+public:
+    /// @brief Constructor.
+    ///
+    /// @param manager Manager executing the callouts.
+    /// @param hook_index Index of the hook being called.
+    CallingStateGuard(const CalloutManager* manager, int hook_index)
+        : saved_(calling_state) {
+        calling_state.manager_ = manager;
+        calling_state.hook_ = hook_index;
+        calling_state.library_ = -1;
+    }
+
+    /// @brief Destructor.
+    ~CallingStateGuard() {
+        calling_state = saved_;
+    }
+
+private:
+    /// Calling state in place before callCallouts was entered.
+    CallingState saved_;
+};
+
+} // end of anonymous namespace
+
 // Constructor
 CalloutManager::CalloutManager(int num_libraries)
     : server_hooks_(ServerHooks::getServerHooks()),
@@ -55,30 +104,66 @@ CalloutManager::checkLibraryIndex(int library_index) const {
               num_libraries_ << ")");
 }
 
+// Get the index of the hook being called by this thread.
+
+int
+CalloutManager::getHookIndex() const {
+    if (calling_state.manager_ == this) {
+        return (calling_state.hook_);
+    }
+    return (current_hook_);
+}
+
+// Get the index of the current library.
+
+int
+CalloutManager::getLibraryIndex() const {
+    if (calling_state.manager_ == this) {
+        return (calling_state.library_);
+    }
+    return (current_library_);
+}
+
+// Set the index of the current library.
+
+void
+CalloutManager::setLibraryIndex(int library_index) {
+    checkLibraryIndex(library_index);
+    if (calling_state.manager_ == this) {
+        calling_state.library_ = library_index;
+    } else {
+        current_library_ = library_index;
+    }
+}
+
 // Register a callout for the current library.
 
 void
 CalloutManager::registerCallout(const std::string& name, CalloutPtr callout) {
+    int library_index = getLibraryIndex();
+
     // Note the registration.
     LOG_DEBUG(callouts_logger, HOOKS_DBG_CALLS, HOOKS_CALLOUT_REGISTRATION)
-        .arg(current_library_).arg(name);
+        .arg(library_index).arg(name);
 
     // Sanity check that the current library index is set to a valid value.
-    checkLibraryIndex(current_library_);
+    checkLibraryIndex(library_index);
 
     // Get the index associated with this hook (validating the name in the
     // process).
     int hook_index = server_hooks_.getIndex(name);
 
+    Mutex::Locker lock(hook_vector_mutex_);
+
     // Iterate through the callout vector for the hook from start to end,
     // looking for the first entry where the library index is greater than
     // the present index.
     for (CalloutVector::iterator i = hook_vector_[hook_index].begin();
          i != hook_vector_[hook_index].end(); ++i) {
-        if (i->first > current_library_) {
+        if (i->first > library_index) {
             // Found an element whose library index number is greater than the
             // current index, so insert the new element ahead of this one.
-            hook_vector_[hook_index].insert(i, make_pair(current_library_,
+            hook_vector_[hook_index].insert(i, make_pair(library_index,
                                                          callout));
             return;
         }
@@ -87,13 +172,15 @@ CalloutManager::registerCallout(const std::string& name, CalloutPtr callout) {
     // Reached the end of the vector, so there is no element in the (possibly
     // empty) set of callouts with a library index greater than the current
     // library index.  Inset the callout at the end of the list.
-    hook_vector_[hook_index].push_back(make_pair(current_library_, callout));
+    hook_vector_[hook_index].push_back(make_pair(library_index, callout));
 }
 
 // Check if callouts are present for a given hook index.
 
 bool
 CalloutManager::calloutsPresent(int hook_index) const {
+    Mutex::Locker lock(hook_vector_mutex_);
+
     // Validate the hook index.
     if ((hook_index < 0) || (hook_index >= hook_vector_.size())) {
         isc_throw(NoSuchHook, "hook index " << hook_index <<
@@ -139,16 +226,25 @@ CalloutManager::callCallouts(int hook_index, CalloutHandle& callout_handle) {
     // also catches the case of an invalid index.
     if (calloutsPresent(hook_index)) {
 
-        // Set the current hook index.  This is used should a callout wish to
-        // determine to what hook it is attached.
-        current_hook_ = hook_index;
+        // Check if this call is nested in a callout called by this manager.
+        bool nested = (calling_state.manager_ == this);
+
+        // Set the current hook index for this thread.  This is used should a
+        // callout wish to determine to what hook it is attached.  The
+        // previous calling state is restored on exit, so callCallouts
+        // may be nested.
+        CallingStateGuard guard(this, hook_index);
 
         // Duplicate the callout vector for this hook and work through that.
         // This step is needed because we allow dynamic registration and
         // deregistration of callouts.  If a callout attached to a hook modified
         // the list of callouts on that hook, the underlying CalloutVector would
         // change and potentially affect the iteration through that vector.
-        CalloutVector callouts(hook_vector_[hook_index]);
+        CalloutVector callouts;
+        {
+            Mutex::Locker lock(hook_vector_mutex_);
+            callouts = hook_vector_[hook_index];
+        }
 
         // This object will be used to measure execution time of each callout
         // and the total time spent in callouts for this hook point.
@@ -156,7 +252,7 @@ CalloutManager::callCallouts(int hook_index, CalloutHandle& callout_handle) {
 
         // Mark that the callouts begin for the hook.
         LOG_DEBUG(callouts_logger, HOOKS_DBG_CALLS, HOOKS_CALLOUTS_BEGIN)
-            .arg(server_hooks_.getName(current_hook_));
+            .arg(server_hooks_.getName(hook_index));
 
         // Call all the callouts.
         for (CalloutVector::const_iterator i = callouts.begin();
@@ -164,7 +260,7 @@ CalloutManager::callCallouts(int hook_index, CalloutHandle& callout_handle) {
             // In case the callout tries to register or deregister a callout,
             // set the current library index to the index associated with the
             // library that registered the callout being called.
-            current_library_ = i->first;
+            calling_state.library_ = i->first;
 
             // Call the callout
             try {
@@ -173,14 +269,14 @@ CalloutManager::callCallouts(int hook_index, CalloutHandle& callout_handle) {
                 stopwatch.stop();
                 if (status == 0) {
                     LOG_DEBUG(callouts_logger, HOOKS_DBG_EXTENDED_CALLS,
-                              HOOKS_CALLOUT_CALLED).arg(current_library_)
-                        .arg(server_hooks_.getName(current_hook_))
+                              HOOKS_CALLOUT_CALLED).arg(i->first)
+                        .arg(server_hooks_.getName(hook_index))
                         .arg(PointerConverter(i->second).dlsymPtr())
                         .arg(stopwatch.logFormatLastDuration());
                 } else {
                     LOG_ERROR(callouts_logger, HOOKS_CALLOUT_ERROR)
-                        .arg(current_library_)
-                        .arg(server_hooks_.getName(current_hook_))
+                        .arg(i->first)
+                        .arg(server_hooks_.getName(hook_index))
                         .arg(PointerConverter(i->second).dlsymPtr())
                         .arg(stopwatch.logFormatLastDuration());
                 }
@@ -190,8 +286,8 @@ CalloutManager::callCallouts(int hook_index, CalloutHandle& callout_handle) {
                 stopwatch.stop();
                 // Any exception, not just ones based on isc::Exception
                 LOG_ERROR(callouts_logger, HOOKS_CALLOUT_EXCEPTION)
-                    .arg(current_library_)
-                    .arg(server_hooks_.getName(current_hook_))
+                    .arg(i->first)
+                    .arg(server_hooks_.getName(hook_index))
                     .arg(PointerConverter(i->second).dlsymPtr())
                     .arg(e.what())
                     .arg(stopwatch.logFormatLastDuration());
@@ -202,13 +298,14 @@ CalloutManager::callCallouts(int hook_index, CalloutHandle& callout_handle) {
         // Mark end of callout execution. Include the total execution
         // time for callouts.
         LOG_DEBUG(callouts_logger, HOOKS_DBG_CALLS, HOOKS_CALLOUTS_COMPLETE)
-            .arg(server_hooks_.getName(current_hook_))
+            .arg(server_hooks_.getName(hook_index))
             .arg(stopwatch.logFormatTotalDuration());
 
-        // Reset the current hook and library indexes to an invalid value to
-        // catch any programming errors.
-        current_hook_ = -1;
-        current_library_ = -1;
+        // Reset the library index to an invalid value to catch any
+        // programming errors.
+        if (!nested) {
+            current_library_ = -1;
+        }
     }
 }
 
@@ -230,8 +327,10 @@ CalloutManager::callCommandHandlers(const std::string& command_name,
 
 bool
 CalloutManager::deregisterCallout(const std::string& name, CalloutPtr callout) {
+    int library_index = getLibraryIndex();
+
     // Sanity check that the current library index is set to a valid value.
-    checkLibraryIndex(current_library_);
+    checkLibraryIndex(library_index);
 
     // Get the index associated with this hook (validating the name in the
     // process).
@@ -239,7 +338,9 @@ CalloutManager::deregisterCallout(const std::string& name, CalloutPtr callout) {
 
     /// Construct a CalloutEntry matching the current library and the callout
     /// we want to remove.
-    CalloutEntry target(current_library_, callout);
+    CalloutEntry target(library_index, callout);
+
+    Mutex::Locker lock(hook_vector_mutex_);
 
     /// To decide if any entries were removed, we'll record the initial size
     /// of the callout vector for the hook, and compare it with the size after
@@ -265,7 +366,7 @@ CalloutManager::deregisterCallout(const std::string& name, CalloutPtr callout) {
     bool removed = initial_size != hook_vector_[hook_index].size();
     if (removed) {
         LOG_DEBUG(callouts_logger, HOOKS_DBG_EXTENDED_CALLS,
-                  HOOKS_CALLOUT_DEREGISTERED).arg(current_library_).arg(name);
+                  HOOKS_CALLOUT_DEREGISTERED).arg(library_index).arg(name);
     }
 
     return (removed);
@@ -280,9 +381,13 @@ CalloutManager::deregisterAllCallouts(const std::string& name) {
     // process).
     int hook_index = server_hooks_.getIndex(name);
 
+    int library_index = getLibraryIndex();
+
     /// Construct a CalloutEntry matching the current library (the callout
     /// pointer is NULL as we are not checking that).
-    CalloutEntry target(current_library_, static_cast<CalloutPtr>(0));
+    CalloutEntry target(library_index, static_cast<CalloutPtr>(0));
+
+    Mutex::Locker lock(hook_vector_mutex_);
 
     /// To decide if any entries were removed, we'll record the initial size
     /// of the callout vector for the hook, and compare it with the size after
@@ -300,7 +405,7 @@ CalloutManager::deregisterAllCallouts(const std::string& name) {
     bool removed = initial_size != hook_vector_[hook_index].size();
     if (removed) {
         LOG_DEBUG(callouts_logger, HOOKS_DBG_EXTENDED_CALLS,
-                  HOOKS_ALL_CALLOUTS_DEREGISTERED).arg(current_library_)
+                  HOOKS_ALL_CALLOUTS_DEREGISTERED).arg(library_index)
                                                 .arg(name);
     }
 
@@ -319,6 +424,7 @@ CalloutManager::registerCommandHook(const std::string& command_name) {
         // add new element at the end of the hook_vector_. The index of this
         // element will match the index of the hook point in the ServerHooks
         // because ServerHooks allocates indexes incrementally.
+        Mutex::Locker lock(hook_vector_mutex_);
         hook_vector_.resize(server_hooks_.getCount());
     }
 }
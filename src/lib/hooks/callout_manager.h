@@ -10,6 +10,7 @@
 #include <exceptions/exceptions.h>
 #include <hooks/library_handle.h>
 #include <hooks/server_hooks.h>
+#include <util/threads/sync.h>
 
 #include <boost/shared_ptr.hpp>
 
@@ -269,10 +270,8 @@ public:
     /// @brief Get current hook index
     ///
     /// Made available during callCallouts, this is the index of the hook
-    /// on which callouts are being called.
-    int getHookIndex() const {
-        return (current_hook_);
-    }
+    /// on which callouts are being called by the calling thread.
+    int getHookIndex() const;
 
     /// @brief Get number of libraries
     ///
@@ -292,13 +291,15 @@ public:
     /// function in a user-library is called during the library load process),
     /// the index can be set by setLibraryIndex().
     ///
+    /// While callCallouts is executing the index is held per thread, so
+    /// callouts running concurrently in several threads each see the index
+    /// of their own library.
+    ///
     /// @note The value set by this method is lost after a call to
     ///       callCallouts.
     ///
     /// @return Current library index.
-    int getLibraryIndex() const {
-        return (current_library_);
-    }
+    int getLibraryIndex() const;
 
     /// @brief Set current library index
     ///
@@ -314,10 +315,7 @@ public:
     /// @param library_index New library index.
     ///
     /// @throw NoSuchLibrary if the index is not valid.
-    void setLibraryIndex(int library_index) {
-        checkLibraryIndex(library_index);
-        current_library_ = library_index;
-    }
+    void setLibraryIndex(int library_index);
 
     /// @defgroup calloutManagerLibraryHandles Callout manager library handles
     ///
@@ -406,14 +404,15 @@ private:
     /// a reference instead of accessing the singleton within the code.
     ServerHooks& server_hooks_;
 
-    /// Current hook.  When a call is made to callCallouts, this holds the
-    /// index of the current hook.  It is set to an invalid value (-1)
-    /// otherwise.
+    /// Current hook.  It is set to an invalid value (-1) outside of
+    /// callCallouts.  The index of the hook being called is held per
+    /// thread by callCallouts and is not stored here.
     int current_hook_;
 
     /// Current library index.  When a call is made to any of the callout
-    /// registration methods, this variable indicates the index of the user
-    /// library that should be associated with the call.
+    /// registration methods outside of callCallouts, this variable
+    /// indicates the index of the user library that should be associated
+    /// with the call.  Within callCallouts the index is held per thread.
     int current_library_;
 
     /// Vector of callout vectors.  There is one entry in this outer vector for
@@ -421,6 +420,10 @@ private:
     /// callout registered for that hook.
     std::vector<CalloutVector> hook_vector_;
 
+    /// Mutex protecting the hook_vector_ against concurrent calls of
+    /// callCallouts and (de)registration of callouts.
+    mutable isc::util::thread::Mutex hook_vector_mutex_;
+
     /// LibraryHandle object user by the callout to access the callout
     /// registration methods on this CalloutManager object.  The object is set
     /// such that the index of the library associated with any operation is
@@ -8,12 +8,15 @@
 #include <hooks/callout_manager.h>
 #include <hooks/library_handle.h>
 #include <hooks/server_hooks.h>
+#include <util/threads/thread.h>
 
+#include <boost/bind.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/scoped_ptr.hpp>
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <atomic>
 #include <string>
 
 /// @file
@@ -31,6 +34,9 @@
 ///
 /// - An active callout can only modify the registration of callouts registered
 ///   by its own library.
+///
+/// - Callouts called concurrently from several threads access the context
+///   of their own library.
 
 using namespace isc::hooks;
 using namespace std;
@@ -978,5 +984,69 @@ TEST_F(HandlesTest, HookName) {
     EXPECT_EQ(std::string("gamma"), HandlesTest::common_string_);
 }
 
-} // Anonymous namespace
+// Test that callouts called concurrently by several threads each access
+// the context of the library which registered them.
 
+// Number of callout context mismatches seen by the concurrent callouts.
+std::atomic<int> concurrent_errors(0);
+
+// Writes the library number in the context of the library and the hook
+// index in the handle, and checks that both are read back unchanged.
+int
+concurrentCallout(CalloutHandle& handle, int library_num) {
+    for (int i = 0; i < 50; ++i) {
+        handle.setContext("library", library_num);
+        int value = 0;
+        handle.getContext("library", value);
+        if ((value != library_num) || (handle.getHookName() != "alpha")) {
+            ++concurrent_errors;
+        }
+    }
+    return (0);
+}
+
+int
+concurrent1(CalloutHandle& handle) {
+    return (concurrentCallout(handle, 1));
+}
+
+int
+concurrent2(CalloutHandle& handle) {
+    return (concurrentCallout(handle, 2));
+}
+
+// Calls the alpha callouts a number of times using a handle of its own.
+void
+concurrentWorker(boost::shared_ptr<CalloutManager> manager, int hook_index) {
+    CalloutHandle handle(manager);
+    for (int i = 0; i < 2000; ++i) {
+        manager->callCallouts(hook_index, handle);
+    }
+}
+
+TEST_F(HandlesTest, ConcurrentContextAccess) {
+    getCalloutManager()->setLibraryIndex(1);
+    getCalloutManager()->registerCallout("alpha", concurrent1);
+    getCalloutManager()->setLibraryIndex(2);
+    getCalloutManager()->registerCallout("alpha", concurrent2);
+
+    concurrent_errors = 0;
+    {
+        isc::util::thread::Thread worker1(boost::bind(&concurrentWorker,
+                                                      getCalloutManager(),
+                                                      alpha_index_));
+        isc::util::thread::Thread worker2(boost::bind(&concurrentWorker,
+                                                      getCalloutManager(),
+                                                      alpha_index_));
+        worker1.wait();
+        worker2.wait();
+    }
+    EXPECT_EQ(0, concurrent_errors);
+
+    // Outside callCallouts the manager uses the index set by the caller.
+    getCalloutManager()->setLibraryIndex(1);
+    EXPECT_EQ(1, getCalloutManager()->getLibraryIndex());
+    EXPECT_EQ(-1, getCalloutManager()->getHookIndex());
+}
+
+} // Anonymous namespace
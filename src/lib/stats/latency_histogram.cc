@@ -0,0 +1,175 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <stats/latency_histogram.h>
+#include <cmath>
+#include <limits>
+
+using namespace isc::data;
+
+namespace {
+
+/// @brief Number of sub-buckets of a power of two
+const size_t HALF_SUB_BUCKETS = 1 << (isc::stats::LatencyHistogram::SUB_BUCKET_BITS - 1);
+
+/// @brief Number of values having their own bucket
+const uint64_t LINEAR_VALUES = 1 << isc::stats::LatencyHistogram::SUB_BUCKET_BITS;
+
+/// @brief Returns the position of the highest bit set
+///
+/// @param value the value (not 0)
+unsigned highestBit(uint64_t value) {
+    unsigned bit = 0;
+    while (value >>= 1) {
+        ++bit;
+    }
+    return (bit);
+}
+
+}
+
+namespace isc {
+namespace stats {
+
+const unsigned LatencyHistogram::SUB_BUCKET_BITS;
+const unsigned LatencyHistogram::VALUE_BITS;
+const size_t LatencyHistogram::NUM_BUCKETS;
+const uint64_t LatencyHistogram::MAX_VALUE;
+
+LatencyHistogram::LatencyHistogram()
+    : count_(0), sum_(0), min_(std::numeric_limits<uint64_t>::max()),
+      max_(0) {
+    for (size_t i = 0; i < NUM_BUCKETS; ++i) {
+        counts_[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+size_t
+LatencyHistogram::valueToIndex(const uint64_t value) {
+    if (value < LINEAR_VALUES) {
+        return (static_cast<size_t>(value));
+    }
+    const unsigned shift = highestBit(value) - (SUB_BUCKET_BITS - 1);
+    return (shift * HALF_SUB_BUCKETS + static_cast<size_t>(value >> shift));
+}
+
+uint64_t
+LatencyHistogram::indexToHighestValue(const size_t index) {
+    if (index < LINEAR_VALUES) {
+        return (index);
+    }
+    const unsigned shift = index / HALF_SUB_BUCKETS - 1;
+    const uint64_t sub_bucket = index % HALF_SUB_BUCKETS + HALF_SUB_BUCKETS;
+    return (((sub_bucket + 1) << shift) - 1);
+}
+
+void
+LatencyHistogram::record(uint64_t value) {
+    if (value > MAX_VALUE) {
+        value = MAX_VALUE;
+    }
+    counts_[valueToIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(value, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+
+    uint64_t current = min_.load(std::memory_order_relaxed);
+    while ((value < current) &&
+           !min_.compare_exchange_weak(current, value,
+                                       std::memory_order_relaxed)) {
+    }
+    current = max_.load(std::memory_order_relaxed);
+    while ((value > current) &&
+           !max_.compare_exchange_weak(current, value,
+                                       std::memory_order_relaxed)) {
+    }
+}
+
+uint64_t
+LatencyHistogram::getMin() const {
+    const uint64_t min = min_.load(std::memory_order_relaxed);
+    return (min == std::numeric_limits<uint64_t>::max() ? 0 : min);
+}
+
+double
+LatencyHistogram::getMean() const {
+    const uint64_t count = getCount();
+    if (count == 0) {
+        return (0.0);
+    }
+    return (static_cast<double>(sum_.load(std::memory_order_relaxed)) /
+            static_cast<double>(count));
+}
+
+uint64_t
+LatencyHistogram::getPercentile(const double percentile) const {
+    // Copy the counters so as the total is consistent with the buckets.
+    uint64_t counts[NUM_BUCKETS];
+    uint64_t total = 0;
+    for (size_t i = 0; i < NUM_BUCKETS; ++i) {
+        counts[i] = counts_[i].load(std::memory_order_relaxed);
+        total += counts[i];
+    }
+    if (total == 0) {
+        return (0);
+    }
+
+    // Rank of the value, from 1 to total.
+    uint64_t rank = static_cast<uint64_t>(std::ceil(percentile / 100.0 *
+                                                    static_cast<double>(total)));
+    if (rank < 1) {
+        rank = 1;
+    } else if (rank > total) {
+        rank = total;
+    }
+
+    uint64_t seen = 0;
+    size_t index = 0;
+    for (; index < NUM_BUCKETS - 1; ++index) {
+        seen += counts[index];
+        if (seen >= rank) {
+            break;
+        }
+    }
+
+    uint64_t value = indexToHighestValue(index);
+    const uint64_t max = getMax();
+    if (value > max) {
+        value = max;
+    }
+    const uint64_t min = getMin();
+    if (value < min) {
+        value = min;
+    }
+    return (value);
+}
+
+void
+LatencyHistogram::reset() {
+    for (size_t i = 0; i < NUM_BUCKETS; ++i) {
+        counts_[i].store(0, std::memory_order_relaxed);
+    }
+    count_.store(0, std::memory_order_relaxed);
+    sum_.store(0, std::memory_order_relaxed);
+    min_.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+}
+
+ElementPtr
+LatencyHistogram::toElement() const {
+    ElementPtr map = Element::createMap();
+    map->set("count", Element::create(static_cast<int64_t>(getCount())));
+    map->set("min", Element::create(static_cast<int64_t>(getMin())));
+    map->set("mean", Element::create(getMean()));
+    map->set("max", Element::create(static_cast<int64_t>(getMax())));
+    map->set("p50", Element::create(static_cast<int64_t>(getPercentile(50.0))));
+    map->set("p90", Element::create(static_cast<int64_t>(getPercentile(90.0))));
+    map->set("p99", Element::create(static_cast<int64_t>(getPercentile(99.0))));
+    map->set("p99.9", Element::create(static_cast<int64_t>(getPercentile(99.9))));
+    return (map);
+}
+
+};
+};
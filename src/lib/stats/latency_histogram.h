@@ -0,0 +1,129 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <cc/data.h>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <atomic>
+#include <stdint.h>
+
+namespace isc {
+namespace stats {
+
+/// @brief Histogram of latencies
+///
+/// The histogram counts the recorded values (typically durations in
+/// microseconds) in buckets whose width grows with the value, as in
+/// the HDR histograms: the values below 2 ^ @ref SUB_BUCKET_BITS have
+/// their own buckets, the other powers of two are divided in
+/// 2 ^ (@ref SUB_BUCKET_BITS - 1) buckets. The relative error of the
+/// percentiles is thus below 1 / 2 ^ (@ref SUB_BUCKET_BITS - 1), i.e.
+/// about 6%, for a fixed amount of memory.
+///
+/// The values are recorded by incrementing atomic counters, so multiple
+/// threads can record values without locking. The percentiles are
+/// computed from a copy of the counters, which may be slightly
+/// inconsistent when values are recorded concurrently.
+class LatencyHistogram : public boost::noncopyable {
+public:
+
+    /// @brief Number of bits of the values which select the sub-bucket
+    static const unsigned SUB_BUCKET_BITS = 5;
+
+    /// @brief Number of bits of the highest value
+    ///
+    /// Greater values are recorded as the highest value: 2 ^ 32
+    /// microseconds is more than an hour.
+    static const unsigned VALUE_BITS = 32;
+
+    /// @brief Number of buckets
+    static const size_t NUM_BUCKETS =
+        ((VALUE_BITS - SUB_BUCKET_BITS + 1) << (SUB_BUCKET_BITS - 1)) +
+        (1 << (SUB_BUCKET_BITS - 1));
+
+    /// @brief Highest value recorded
+    static const uint64_t MAX_VALUE = (static_cast<uint64_t>(1) << VALUE_BITS) - 1;
+
+    /// @brief Constructor
+    LatencyHistogram();
+
+    /// @brief Records a value
+    ///
+    /// @param value the value, values above @ref MAX_VALUE are recorded
+    /// as @ref MAX_VALUE
+    void record(uint64_t value);
+
+    /// @brief Returns the number of values recorded
+    uint64_t getCount() const {
+        return (count_.load(std::memory_order_relaxed));
+    }
+
+    /// @brief Returns the lowest value recorded (0 if none)
+    uint64_t getMin() const;
+
+    /// @brief Returns the highest value recorded (0 if none)
+    uint64_t getMax() const {
+        return (max_.load(std::memory_order_relaxed));
+    }
+
+    /// @brief Returns the mean of the values recorded (0 if none)
+    double getMean() const;
+
+    /// @brief Returns a percentile
+    ///
+    /// @param percentile the percentile (e.g. 99.9)
+    /// @return the highest value of the bucket holding the percentile,
+    /// bounded by the lowest and highest values recorded, 0 if no value
+    /// was recorded
+    uint64_t getPercentile(const double percentile) const;
+
+    /// @brief Discards the values recorded
+    void reset();
+
+    /// @brief Returns the summary of the histogram
+    ///
+    /// @return map holding "count", "min", "mean", "max", "p50",
+    /// "p90", "p99" and "p99.9"
+    isc::data::ElementPtr toElement() const;
+
+    /// @brief Returns the index of the bucket of a value
+    ///
+    /// @param value the value (at most @ref MAX_VALUE)
+    static size_t valueToIndex(const uint64_t value);
+
+    /// @brief Returns the highest value of a bucket
+    ///
+    /// @param index index of the bucket
+    static uint64_t indexToHighestValue(const size_t index);
+
+private:
+
+    /// @brief Counters of the buckets
+    std::atomic<uint64_t> counts_[NUM_BUCKETS];
+
+    /// @brief Number of values recorded
+    std::atomic<uint64_t> count_;
+
+    /// @brief Sum of the values recorded
+    std::atomic<uint64_t> sum_;
+
+    /// @brief Lowest value recorded
+    std::atomic<uint64_t> min_;
+
+    /// @brief Highest value recorded
+    std::atomic<uint64_t> max_;
+};
+
+/// @brief Pointer to a latency histogram
+typedef boost::shared_ptr<LatencyHistogram> LatencyHistogramPtr;
+
+};
+};
+
+#endif // LATENCY_HISTOGRAM_H
@@ -9,6 +9,7 @@
 #include <cc/data.h>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/date_time/gregorian/gregorian.hpp>
+#include <algorithm>
 #include <utility>
 
 using namespace std;
@@ -18,23 +19,29 @@ using namespace boost::posix_time;
 namespace isc {
 namespace stats {
 
+const uint32_t Observation::MAX_SAMPLE_COUNT;
+
 Observation::Observation(const std::string& name, const int64_t value)
-    :name_(name), type_(STAT_INTEGER) {
+    :name_(name), type_(STAT_INTEGER), max_sample_age_set_(false),
+     max_sample_age_(0, 0, 0, 0), max_sample_count_(1) {
     setValue(value);
 }
 
 Observation::Observation(const std::string& name, const double value)
-    :name_(name), type_(STAT_FLOAT) {
+    :name_(name), type_(STAT_FLOAT), max_sample_age_set_(false),
+     max_sample_age_(0, 0, 0, 0), max_sample_count_(1) {
     setValue(value);
 }
 
 Observation::Observation(const std::string& name, const StatsDuration& value)
-    :name_(name), type_(STAT_DURATION) {
+    :name_(name), type_(STAT_DURATION), max_sample_age_set_(false),
+     max_sample_age_(0, 0, 0, 0), max_sample_count_(1) {
     setValue(value);
 }
 
 Observation::Observation(const std::string& name, const std::string& value)
-    :name_(name), type_(STAT_STRING) {
+    :name_(name), type_(STAT_STRING), max_sample_age_set_(false),
+     max_sample_age_(0, 0, 0, 0), max_sample_count_(1) {
     setValue(value);
 }
 
@@ -83,13 +90,94 @@ void Observation::setValueInternal(SampleType value, StorageType& storage,
                   << typeToText(type_) );
     }
 
-    if (storage.empty()) {
-        storage.push_back(make_pair(value, microsec_clock::local_time()));
-    } else {
+    const ptime now = microsec_clock::local_time();
+    applyLimits(storage, now);
+    storage.push(make_pair(value, now));
+}
+
+template<typename StorageType>
+void Observation::applyLimits(StorageType& storage, const ptime& now) {
+    if (!max_sample_age_set_) {
+        if (storage.capacity() != max_sample_count_) {
+            storage.setCapacity(max_sample_count_);
+        }
+        return;
+    }
 
-        /// @todo: Update once more than one sample is supported
-        *storage.begin() = make_pair(value, microsec_clock::local_time());
+    // Discard the samples which are too old...
+    const ptime oldest = now - max_sample_age_;
+    while (!storage.empty() && (storage.at(storage.size() - 1).second < oldest)) {
+        storage.popOldest();
     }
+
+    // ... and make room for the new one unless the hard limit is reached.
+    if ((storage.size() == storage.capacity()) &&
+        (storage.capacity() < MAX_SAMPLE_COUNT)) {
+        storage.setCapacity(std::min(storage.capacity() * 2,
+                                     static_cast<size_t>(MAX_SAMPLE_COUNT)));
+    }
+}
+
+void Observation::applyLimits() {
+    const ptime now = microsec_clock::local_time();
+    switch (type_) {
+    case STAT_INTEGER:
+        applyLimits(integer_samples_, now);
+        break;
+    case STAT_FLOAT:
+        applyLimits(float_samples_, now);
+        break;
+    case STAT_DURATION:
+        applyLimits(duration_samples_, now);
+        break;
+    case STAT_STRING:
+        applyLimits(string_samples_, now);
+        break;
+    default:
+        isc_throw(InvalidStatType, "Unknown statistic type: "
+                  << typeToText(type_));
+    };
+}
+
+void Observation::setMaxSampleAge(const StatsDuration& duration) {
+    max_sample_age_set_ = true;
+    max_sample_age_ = duration;
+    applyLimits();
+}
+
+void Observation::setMaxSampleCount(const uint32_t max_samples) {
+    if ((max_samples == 0) || (max_samples > MAX_SAMPLE_COUNT)) {
+        isc_throw(BadValue, "invalid maximum number of samples "
+                  << max_samples << " for statistic " << name_
+                  << ", it must be between 1 and " << MAX_SAMPLE_COUNT);
+    }
+    max_sample_age_set_ = false;
+    max_sample_count_ = max_samples;
+    applyLimits();
+}
+
+std::pair<bool, StatsDuration> Observation::getMaxSampleAge() const {
+    return (make_pair(max_sample_age_set_, max_sample_age_));
+}
+
+std::pair<bool, uint32_t> Observation::getMaxSampleCount() const {
+    return (make_pair(!max_sample_age_set_, max_sample_count_));
+}
+
+size_t Observation::getSize() const {
+    switch (type_) {
+    case STAT_INTEGER:
+        return (integer_samples_.size());
+    case STAT_FLOAT:
+        return (float_samples_.size());
+    case STAT_DURATION:
+        return (duration_samples_.size());
+    case STAT_STRING:
+        return (string_samples_.size());
+    default:
+        isc_throw(InvalidStatType, "Unknown statistic type: "
+                  << typeToText(type_));
+    };
 }
 
 IntegerSample Observation::getInteger() const {
@@ -122,7 +210,74 @@ SampleType Observation::getValueInternal(Storage& storage, Type exp_type) const
         // still be there.
         isc_throw(Unexpected, "Observation storage container empty");
     }
-    return (*storage.begin());
+    return (storage.at(0));
+}
+
+std::list<IntegerSample> Observation::getIntegers() const {
+    return (getValuesInternal<IntegerSample>(integer_samples_, STAT_INTEGER));
+}
+
+std::list<FloatSample> Observation::getFloats() const {
+    return (getValuesInternal<FloatSample>(float_samples_, STAT_FLOAT));
+}
+
+std::list<DurationSample> Observation::getDurations() const {
+    return (getValuesInternal<DurationSample>(duration_samples_, STAT_DURATION));
+}
+
+std::list<StringSample> Observation::getStrings() const {
+    return (getValuesInternal<StringSample>(string_samples_, STAT_STRING));
+}
+
+template<typename SampleType, typename Storage>
+std::list<SampleType> Observation::getValuesInternal(Storage& storage,
+                                                     Type exp_type) const {
+    if (type_ != exp_type) {
+        isc_throw(InvalidStatType, "Invalid statistic type requested: "
+                  << typeToText(exp_type) << ", but the actual type is "
+                  << typeToText(type_) );
+    }
+
+    std::list<SampleType> samples;
+    for (size_t i = 0; i < storage.size(); ++i) {
+        samples.push_back(storage.at(i));
+    }
+    return (samples);
+}
+
+double Observation::getRate(const StatsDuration& window,
+                            const ptime& now) const {
+    if (type_ != STAT_INTEGER) {
+        isc_throw(InvalidStatType, "Invalid statistic type requested: "
+                  << typeToText(STAT_INTEGER) << ", but the actual type is "
+                  << typeToText(type_) );
+    }
+
+    if (integer_samples_.empty()) {
+        return (0.0);
+    }
+
+    // Find the value at the beginning of the window: the last sample
+    // recorded before. If the history doesn't go back that far use the
+    // oldest sample and shorten the window.
+    const ptime start = now - window;
+    const size_t oldest = integer_samples_.size() - 1;
+    size_t i = 0;
+    while ((i < oldest) && (integer_samples_.at(i).second > start)) {
+        ++i;
+    }
+    const IntegerSample& first = integer_samples_.at(i);
+    StatsDuration elapsed = window;
+    if (first.second > start) {
+        elapsed = now - first.second;
+    }
+    if (elapsed.total_microseconds() <= 0) {
+        return (0.0);
+    }
+
+    const int64_t change = integer_samples_.at(0).first - first.first;
+    return (static_cast<double>(change) * 1000000.0 /
+            static_cast<double>(elapsed.total_microseconds()));
 }
 
 std::string Observation::typeToText(Type type) {
@@ -151,53 +306,57 @@ std::string Observation::typeToText(Type type) {
 isc::data::ConstElementPtr
 Observation::getJSON() const {
 
-    ElementPtr entry = isc::data::Element::createList(); // a single observation
-    ElementPtr value;
-    ElementPtr timestamp;
-
-    /// @todo: Add support for retrieving more than one sample for a given
-    /// observation
-
-    switch (type_) {
-    case STAT_INTEGER: {
-        IntegerSample s = getInteger();
-        value = isc::data::Element::create(static_cast<int64_t>(s.first));
-        timestamp = isc::data::Element::create(isc::util::ptimeToText(s.second));
-        break;
-    }
-    case STAT_FLOAT: {
-        FloatSample s = getFloat();
-        value = isc::data::Element::create(s.first);
-        timestamp = isc::data::Element::create(isc::util::ptimeToText(s.second));
-        break;
+    ElementPtr list = isc::data::Element::createList(); // all samples
+
+    for (size_t i = 0; i < getSize(); ++i) {
+        ElementPtr entry = isc::data::Element::createList(); // a single sample
+        ElementPtr value;
+        ElementPtr timestamp;
+
+        switch (type_) {
+        case STAT_INTEGER: {
+            const IntegerSample& s = integer_samples_.at(i);
+            value = isc::data::Element::create(static_cast<int64_t>(s.first));
+            timestamp = isc::data::Element::create(isc::util::ptimeToText(s.second));
+            break;
+        }
+        case STAT_FLOAT: {
+            const FloatSample& s = float_samples_.at(i);
+            value = isc::data::Element::create(s.first);
+            timestamp = isc::data::Element::create(isc::util::ptimeToText(s.second));
+            break;
+        }
+        case STAT_DURATION: {
+            const DurationSample& s = duration_samples_.at(i);
+            value = isc::data::Element::create(isc::util::durationToText(s.first));
+            timestamp = isc::data::Element::create(isc::util::ptimeToText(s.second));
+            break;
+        }
+        case STAT_STRING: {
+            const StringSample& s = string_samples_.at(i);
+            value = isc::data::Element::create(s.first);
+            timestamp = isc::data::Element::create(isc::util::ptimeToText(s.second));
+            break;
+        }
+        default:
+            isc_throw(InvalidStatType, "Unknown statistic type: "
+                      << typeToText(type_));
+        };
+
+        entry->add(value);
+        entry->add(timestamp);
+        list->add(entry);
     }
-    case STAT_DURATION: {
-        DurationSample s = getDuration();
-        value = isc::data::Element::create(isc::util::durationToText(s.first));
-        timestamp = isc::data::Element::create(isc::util::ptimeToText(s.second));
-        break;
-    }
-    case STAT_STRING: {
-        StringSample s = getString();
-        value = isc::data::Element::create(s.first);
-        timestamp = isc::data::Element::create(isc::util::ptimeToText(s.second));
-        break;
-    }
-    default:
-        isc_throw(InvalidStatType, "Unknown statistic type: "
-                  << typeToText(type_));
-    };
-
-    entry->add(value);
-    entry->add(timestamp);
-
-    ElementPtr list = isc::data::Element::createList(); // a single observation
-    list->add(entry);
 
     return (list);
 }
 
 void Observation::reset() {
+    integer_samples_.clear();
+    float_samples_.clear();
+    duration_samples_.clear();
+    string_samples_.clear();
+
     switch(type_) {
     case STAT_INTEGER: {
         setValue(static_cast<int64_t>(0));
@@ -9,6 +9,7 @@
 
 #include <cc/data.h>
 #include <exceptions/exceptions.h>
+#include <stats/sample_ring.h>
 #include <boost/shared_ptr.hpp>
 #include <boost/date_time/time_duration.hpp>
 #include <boost/date_time/posix_time/posix_time_types.hpp>
@@ -66,8 +67,11 @@ typedef std::pair<std::string, boost::posix_time::ptime> StringSample;
 /// @ref getDuration, @ref getString (appropriate type must be used) or
 /// @ref getJSON, which is generic and can be used for all types.
 ///
-/// @todo: Eventually it will be possible to retain multiple samples for the same
-/// observation, but that is outside of scope for 0.9.2.
+/// By default only the most recent sample is retained. The observation can
+/// retain a bounded history of samples, limited either by the number of
+/// samples (@ref setMaxSampleCount) or by their age (@ref setMaxSampleAge).
+/// The samples are stored in a ring buffer. The history of an integer
+/// statistic is used to compute its rate of change (@ref getRate).
 class Observation {
  public:
 
@@ -110,6 +114,45 @@ class Observation {
     /// @param value string observed.
     Observation(const std::string& name, const std::string& value);
 
+    /// @brief Maximum number of samples retained by an observation
+    ///
+    /// This is the limit of the history when the samples are limited by
+    /// their age.
+    static const uint32_t MAX_SAMPLE_COUNT = 65536;
+
+    /// @brief Limits the history by the age of the samples
+    ///
+    /// The samples older than the duration are discarded when a new
+    /// sample is recorded. At most @ref MAX_SAMPLE_COUNT samples are
+    /// retained.
+    ///
+    /// @param duration maximum age of the samples
+    void setMaxSampleAge(const StatsDuration& duration);
+
+    /// @brief Limits the history by the number of samples
+    ///
+    /// The oldest samples are discarded when there are more samples.
+    ///
+    /// @param max_samples maximum number of samples (1 to
+    /// @ref MAX_SAMPLE_COUNT)
+    /// @throw BadValue if the number is out of range
+    void setMaxSampleCount(const uint32_t max_samples);
+
+    /// @brief Returns the maximum age of the samples
+    ///
+    /// @return a pair holding true and the maximum age if the history is
+    /// limited by the age, false otherwise
+    std::pair<bool, StatsDuration> getMaxSampleAge() const;
+
+    /// @brief Returns the maximum number of samples
+    ///
+    /// @return a pair holding true and the maximum number of samples if
+    /// the history is limited by the number, false otherwise
+    std::pair<bool, uint32_t> getMaxSampleCount() const;
+
+    /// @brief Returns the number of samples retained
+    size_t getSize() const;
+
     /// @brief Records absolute integer observation
     ///
     /// @param value integer value observed
@@ -160,7 +203,8 @@ class Observation {
 
     /// @brief Resets statistic.
     ///
-    /// Sets statistic to a neutral (0, 0.0 or "") value.
+    /// Discards the history and sets statistic to a neutral (0, 0.0 or "")
+    /// value.
     void reset();
 
     /// @brief Returns statistic type
@@ -189,7 +233,45 @@ class Observation {
     /// @throw InvalidStatType if statistic is not a string
     StringSample getString() const;
 
+    /// @brief Returns the integer samples, the newest first
+    /// @return retained samples
+    /// @throw InvalidStatType if statistic is not integer
+    std::list<IntegerSample> getIntegers() const;
+
+    /// @brief Returns the float samples, the newest first
+    /// @return retained samples
+    /// @throw InvalidStatType if statistic is not fp
+    std::list<FloatSample> getFloats() const;
+
+    /// @brief Returns the duration samples, the newest first
+    /// @return retained samples
+    /// @throw InvalidStatType if statistic is not time duration
+    std::list<DurationSample> getDurations() const;
+
+    /// @brief Returns the string samples, the newest first
+    /// @return retained samples
+    /// @throw InvalidStatType if statistic is not a string
+    std::list<StringSample> getStrings() const;
+
+    /// @brief Returns the rate of change of an integer statistic
+    ///
+    /// The rate is the difference between the current value and the
+    /// value at the beginning of the window, divided by the length of
+    /// the window. The value at a given time is the one of the last
+    /// sample recorded before, so the history must cover the window:
+    /// when it is shorter the rate is computed over the history.
+    ///
+    /// @param window length of the window ending now
+    /// @param now current time
+    /// @return change per second, 0 if it can't be computed
+    /// @throw InvalidStatType if statistic is not integer
+    double getRate(const StatsDuration& window,
+                   const boost::posix_time::ptime& now) const;
+
     /// @brief Returns as a JSON structure
+    ///
+    /// The samples are listed from the newest to the oldest.
+    ///
     /// @return JSON structures representing all observations
     isc::data::ConstElementPtr getJSON() const;
 
@@ -210,7 +292,7 @@ private:
     /// available storages.
     ///
     /// @tparam SampleType type of sample (e.g. IntegerSample)
-    /// @tparam StorageType type of storage (e.g. list<IntegerSample>)
+    /// @tparam StorageType type of storage (e.g. SampleRing<IntegerSample>)
     /// @param value observation to be recorded
     /// @param storage observation will be stored here
     /// @param exp_type expected observation type (used for sanity checking)
@@ -222,7 +304,7 @@ private:
     /// @brief Returns a sample (internal version)
     ///
     /// @tparam SampleType type of sample (e.g. IntegerSample)
-    /// @tparam StorageType type of storage (e.g. list<IntegerSample>)
+    /// @tparam StorageType type of storage (e.g. SampleRing<IntegerSample>)
     /// @param observation storage
     /// @param exp_type expected observation type (used for sanity checking)
     /// @throw InvalidStatType if observation type mismatches
@@ -230,12 +312,45 @@ private:
     template<typename SampleType, typename Storage>
     SampleType getValueInternal(Storage& storage, Type exp_type) const;
 
+    /// @brief Returns all samples (internal version)
+    ///
+    /// @tparam SampleType type of sample (e.g. IntegerSample)
+    /// @tparam StorageType type of storage (e.g. SampleRing<IntegerSample>)
+    /// @param observation storage
+    /// @param exp_type expected observation type (used for sanity checking)
+    /// @throw InvalidStatType if observation type mismatches
+    /// @return Observed samples, the newest first
+    template<typename SampleType, typename Storage>
+    std::list<SampleType> getValuesInternal(Storage& storage,
+                                            Type exp_type) const;
+
+    /// @brief Applies the limits to the storage (internal version)
+    ///
+    /// @tparam StorageType type of storage (e.g. SampleRing<IntegerSample>)
+    /// @param storage the storage
+    /// @param now time of the sample being recorded
+    template<typename StorageType>
+    void applyLimits(StorageType& storage,
+                     const boost::posix_time::ptime& now);
+
+    /// @brief Applies the limits to the storage of the statistic type
+    void applyLimits();
+
     /// @brief Observation (statistic) name
     std::string name_;
 
     /// @brief Observation (statistic) type)
     Type type_;
 
+    /// @brief Indicates if the history is limited by the age of samples
+    bool max_sample_age_set_;
+
+    /// @brief Maximum age of the samples
+    StatsDuration max_sample_age_;
+
+    /// @brief Maximum number of the samples
+    uint32_t max_sample_count_;
+
     /// @defgroup samples_storage Storage for supported observations
     ///
     /// @brief The following containers serve as a storage for all supported
@@ -244,16 +359,16 @@ private:
     /// @{
 
     /// @brief Storage for integer samples
-    std::list<IntegerSample> integer_samples_;
+    SampleRing<IntegerSample> integer_samples_;
 
     /// @brief Storage for floating point samples
-    std::list<FloatSample> float_samples_;
+    SampleRing<FloatSample> float_samples_;
 
     /// @brief Storage for time duration samples
-    std::list<DurationSample> duration_samples_;
+    SampleRing<DurationSample> duration_samples_;
 
     /// @brief Storage for string samples
-    std::list<StringSample> string_samples_;
+    SampleRing<StringSample> string_samples_;
     /// @}
 };
 
@@ -0,0 +1,122 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef SAMPLE_RING_H
+#define SAMPLE_RING_H
+
+#include <exceptions/exceptions.h>
+#include <vector>
+
+namespace isc {
+namespace stats {
+
+/// @brief Ring buffer holding the most recent samples of a statistic
+///
+/// The storage is allocated when the capacity is set, so recording a
+/// sample doesn't allocate memory: when the ring is full the oldest sample
+/// is overwritten.
+///
+/// @tparam SampleType type of the samples (e.g. IntegerSample)
+template<typename SampleType>
+class SampleRing {
+public:
+
+    /// @brief Constructor
+    ///
+    /// @param capacity maximum number of samples (at least 1)
+    explicit SampleRing(const size_t capacity = 1)
+        : samples_(capacity > 0 ? capacity : 1), newest_(0), size_(0) {
+    }
+
+    /// @brief Records a sample, overwriting the oldest one if full
+    ///
+    /// @param sample the sample
+    void push(const SampleType& sample) {
+        newest_ = (newest_ + 1) % samples_.size();
+        samples_[newest_] = sample;
+        if (size_ < samples_.size()) {
+            ++size_;
+        }
+    }
+
+    /// @brief Returns a sample
+    ///
+    /// @param index 0 for the newest sample, size() - 1 for the oldest
+    /// @return the sample
+    /// @throw OutOfRange if there is no such sample
+    const SampleType& at(const size_t index) const {
+        if (index >= size_) {
+            isc_throw(OutOfRange, "no sample at position " << index
+                      << ", the number of samples is " << size_);
+        }
+        return (samples_[(newest_ + samples_.size() - index) %
+                         samples_.size()]);
+    }
+
+    /// @brief Discards the oldest sample
+    void popOldest() {
+        if (size_ > 0) {
+            --size_;
+        }
+    }
+
+    /// @brief Discards all samples
+    void clear() {
+        size_ = 0;
+    }
+
+    /// @brief Changes the capacity keeping the newest samples
+    ///
+    /// @param capacity maximum number of samples (at least 1)
+    void setCapacity(size_t capacity) {
+        if (capacity == 0) {
+            capacity = 1;
+        }
+        if (capacity == samples_.size()) {
+            return;
+        }
+        std::vector<SampleType> samples(capacity);
+        const size_t size = (size_ < capacity ? size_ : capacity);
+        // Copy the newest samples, the oldest first.
+        for (size_t i = 0; i < size; ++i) {
+            samples[i] = at(size - 1 - i);
+        }
+        samples_.swap(samples);
+        size_ = size;
+        newest_ = (size > 0 ? size - 1 : capacity - 1);
+    }
+
+    /// @brief Returns the maximum number of samples
+    size_t capacity() const {
+        return (samples_.size());
+    }
+
+    /// @brief Returns the number of samples
+    size_t size() const {
+        return (size_);
+    }
+
+    /// @brief Checks if there is no sample
+    bool empty() const {
+        return (size_ == 0);
+    }
+
+private:
+
+    /// @brief The storage
+    std::vector<SampleType> samples_;
+
+    /// @brief Position of the newest sample
+    size_t newest_;
+
+    /// @brief Number of samples
+    size_t size_;
+};
+
+};
+};
+
+#endif // SAMPLE_RING_H
@@ -8,10 +8,13 @@
 #include <stats/stats_mgr.h>
 #include <cc/data.h>
 #include <cc/command_interpreter.h>
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <sstream>
 
 using namespace std;
 using namespace isc::data;
 using namespace isc::config;
+using namespace isc::util::thread;
 
 namespace isc {
 namespace stats {
@@ -22,15 +25,21 @@ StatsMgr& StatsMgr::instance() {
 }
 
 StatsMgr::StatsMgr()
-    :global_(new StatContext()) {
-
+    :global_(new StatContext()), handles_(), sample_limits_() {
+    for (size_t i = 0; i < MAX_COUNTER_CHUNKS; ++i) {
+        counters_[i] = 0;
+    }
 }
 
 void StatsMgr::setValue(const std::string& name, const int64_t value) {
+    Mutex::Locker lock(mutex_);
+    // The values added before are overwritten.
+    discardCounter(name);
     setValueInternal(name, value);
 }
 
 void StatsMgr::setValue(const std::string& name, const double value) {
+    Mutex::Locker lock(mutex_);
     setValueInternal(name, value);
 }
 
@@ -42,10 +51,12 @@ void StatsMgr::setValue(const std::string& name, const std::string& value) {
 }
 
 void StatsMgr::addValue(const std::string& name, const int64_t value) {
+    Mutex::Locker lock(mutex_);
     addValueInternal(name, value);
 }
 
 void StatsMgr::addValue(const std::string& name, const double value) {
+    Mutex::Locker lock(mutex_);
     addValueInternal(name, value);
 }
 
@@ -57,35 +68,197 @@ void StatsMgr::addValue(const std::string& name, const std::string& value) {
     addValueInternal(name, value);
 }
 
+StatHandle StatsMgr::getHandle(const std::string& name) {
+    Mutex::Locker lock(mutex_);
+    std::map<std::string, StatHandle>::const_iterator it = handles_.find(name);
+    if (it != handles_.end()) {
+        return (it->second);
+    }
+
+    const size_t handle = handles_.size();
+    if (handle >= COUNTERS_PER_CHUNK * MAX_COUNTER_CHUNKS) {
+        isc_throw(OutOfRange, "unable to create the handle of the statistic "
+                  << name << ": too many handles");
+    }
+    Counter*& chunk = counters_[handle / COUNTERS_PER_CHUNK];
+    if (!chunk) {
+        chunk = new Counter[COUNTERS_PER_CHUNK];
+    }
+    chunk[handle % COUNTERS_PER_CHUNK].name_ = name;
+    handles_[name] = static_cast<StatHandle>(handle);
+    return (static_cast<StatHandle>(handle));
+}
+
+void StatsMgr::syncCounter(Counter& counter) const {
+    if (!counter.updated_.exchange(false, std::memory_order_acquire)) {
+        return;
+    }
+    const int64_t value = counter.pending_.exchange(0,
+                                                    std::memory_order_relaxed);
+    ObservationPtr stat = global_->get(counter.name_);
+    if (!stat) {
+        stat.reset(new Observation(counter.name_, value));
+        applySampleLimit(stat);
+        global_->add(stat);
+        return;
+    }
+    try {
+        stat->addValue(value);
+    } catch (const InvalidStatType&) {
+        // The statistic was set to a value of another type, so the
+        // values added through the handle are dropped.
+    }
+}
+
+void StatsMgr::syncCounters() const {
+    for (size_t handle = 0; handle < handles_.size(); ++handle) {
+        syncCounter(counters_[handle / COUNTERS_PER_CHUNK]
+                    [handle % COUNTERS_PER_CHUNK]);
+    }
+}
+
+void StatsMgr::discardCounter(const std::string& name) {
+    Counter* counter = findCounter(name);
+    if (counter) {
+        counter->updated_.store(false, std::memory_order_relaxed);
+        counter->pending_.store(0, std::memory_order_relaxed);
+    }
+}
+
+StatsMgr::Counter* StatsMgr::findCounter(const std::string& name) const {
+    std::map<std::string, StatHandle>::const_iterator it = handles_.find(name);
+    if (it == handles_.end()) {
+        return (0);
+    }
+    return (&counters_[it->second / COUNTERS_PER_CHUNK]
+            [it->second % COUNTERS_PER_CHUNK]);
+}
+
 ObservationPtr StatsMgr::getObservation(const std::string& name) const {
+    Mutex::Locker lock(mutex_);
+    Counter* counter = findCounter(name);
+    if (counter) {
+        syncCounter(*counter);
+    }
     /// @todo: Implement contexts.
     // Currently we keep everything in a global context.
     return (global_->get(name));
 }
 
 void StatsMgr::addObservation(const ObservationPtr& stat) {
+    Mutex::Locker lock(mutex_);
     /// @todo: Implement contexts.
     // Currently we keep everything in a global context.
     return (global_->add(stat));
 }
 
 bool StatsMgr::deleteObservation(const std::string& name) {
+    Mutex::Locker lock(mutex_);
     /// @todo: Implement contexts.
     // Currently we keep everything in a global context.
     return (global_->del(name));
 }
 
-void StatsMgr::setMaxSampleAge(const std::string& ,
-                               const StatsDuration&) {
-    isc_throw(NotImplemented, "setMaxSampleAge not implemented");
+void StatsMgr::setMaxSampleAge(const std::string& name,
+                               const StatsDuration& duration) {
+    SampleLimit limit;
+    limit.by_age_ = true;
+    limit.max_age_ = duration;
+    limit.max_count_ = 0;
+    setSampleLimit(name, limit);
+}
+
+void StatsMgr::setMaxSampleCount(const std::string& name,
+                                 uint32_t max_samples) {
+    if ((max_samples == 0) || (max_samples > Observation::MAX_SAMPLE_COUNT)) {
+        isc_throw(BadValue, "invalid maximum number of samples "
+                  << max_samples << " for statistic " << name
+                  << ", it must be between 1 and "
+                  << Observation::MAX_SAMPLE_COUNT);
+    }
+    SampleLimit limit;
+    limit.by_age_ = false;
+    limit.max_age_ = StatsDuration(0, 0, 0, 0);
+    limit.max_count_ = max_samples;
+    setSampleLimit(name, limit);
+}
+
+void StatsMgr::setSampleLimit(const std::string& name,
+                              const SampleLimit& limit) {
+    Mutex::Locker lock(mutex_);
+    // The samples of the values added through the handles are recorded
+    // before the limit changes.
+    syncCounters();
+    sample_limits_[name] = limit;
+    for (std::map<std::string, ObservationPtr>::const_iterator it =
+             global_->stats_.begin(); it != global_->stats_.end(); ++it) {
+        applySampleLimit(it->second);
+    }
+}
+
+void StatsMgr::applySampleLimit(const ObservationPtr& stat) const {
+    if (sample_limits_.empty()) {
+        return;
+    }
+
+    // The exact name first, then the longest prefix.
+    const std::string& name = stat->getName();
+    std::map<std::string, SampleLimit>::const_iterator limit =
+        sample_limits_.find(name);
+    if (limit == sample_limits_.end()) {
+        size_t longest = 0;
+        for (std::map<std::string, SampleLimit>::const_iterator it =
+                 sample_limits_.begin(); it != sample_limits_.end(); ++it) {
+            const std::string& pattern = it->first;
+            if (pattern.empty() || (pattern[pattern.size() - 1] != '*')) {
+                continue;
+            }
+            const size_t length = pattern.size() - 1;
+            if ((length >= longest) &&
+                (name.compare(0, length, pattern, 0, length) == 0)) {
+                longest = length;
+                limit = it;
+            }
+        }
+        if (limit == sample_limits_.end()) {
+            return;
+        }
+    }
+
+    if (limit->second.by_age_) {
+        stat->setMaxSampleAge(limit->second.max_age_);
+    } else {
+        stat->setMaxSampleCount(limit->second.max_count_);
+    }
 }
 
-void StatsMgr::setMaxSampleCount(const std::string& , uint32_t){
-    isc_throw(NotImplemented, "setMaxSampleCount not implemented");
+isc::data::ConstElementPtr StatsMgr::getRates(const std::string& name) const {
+    Mutex::Locker lock(mutex_);
+    ElementPtr map = Element::createMap(); // a map
+    Counter* counter = findCounter(name);
+    if (counter) {
+        syncCounter(*counter);
+    }
+    ObservationPtr obs = global_->get(name);
+    if (obs) {
+        const boost::posix_time::ptime now =
+            boost::posix_time::microsec_clock::local_time();
+        ElementPtr rates = Element::createMap();
+        rates->set("1min", Element::create(obs->getRate(
+            StatsDuration(0, 1, 0, 0), now)));
+        rates->set("5min", Element::create(obs->getRate(
+            StatsDuration(0, 5, 0, 0), now)));
+        rates->set("15min", Element::create(obs->getRate(
+            StatsDuration(0, 15, 0, 0), now)));
+        map->set(name, rates);
+    }
+    return (map);
 }
 
 bool StatsMgr::reset(const std::string& name) {
-    ObservationPtr obs = getObservation(name);
+    Mutex::Locker lock(mutex_);
+    discardCounter(name);
+    ObservationPtr obs = global_->get(name);
     if (obs) {
         obs->reset();
         return (true);
@@ -95,16 +268,29 @@ bool StatsMgr::reset(const std::string& name) {
 }
 
 bool StatsMgr::del(const std::string& name) {
+    Mutex::Locker lock(mutex_);
+    discardCounter(name);
     return (global_->del(name));
 }
 
 void StatsMgr::removeAll() {
+    Mutex::Locker lock(mutex_);
+    for (std::map<std::string, StatHandle>::const_iterator it =
+             handles_.begin(); it != handles_.end(); ++it) {
+        discardCounter(it->first);
+    }
     global_->stats_.clear();
+    sample_limits_.clear();
 }
 
 isc::data::ConstElementPtr StatsMgr::get(const std::string& name) const {
     isc::data::ElementPtr response = isc::data::Element::createMap(); // a map
-    ObservationPtr obs = getObservation(name);
+    Mutex::Locker lock(mutex_);
+    Counter* counter = findCounter(name);
+    if (counter) {
+        syncCounter(*counter);
+    }
+    ObservationPtr obs = global_->get(name);
     if (obs) {
         response->set(name, obs->getJSON()); // that contains the observation
     }
@@ -113,6 +299,8 @@ isc::data::ConstElementPtr StatsMgr::get(const std::string& name) const {
 
 isc::data::ConstElementPtr StatsMgr::getAll() const {
     isc::data::ElementPtr map = isc::data::Element::createMap(); // a map
+    Mutex::Locker lock(mutex_);
+    syncCounters();
 
     // Let's iterate over all stored statistics...
     for (std::map<std::string, ObservationPtr>::iterator s = global_->stats_.begin();
@@ -125,6 +313,8 @@ isc::data::ConstElementPtr StatsMgr::getAll() const {
 }
 
 void StatsMgr::resetAll() {
+    Mutex::Locker lock(mutex_);
+    syncCounters();
     // Let's iterate over all stored statistics...
     for (std::map<std::string, ObservationPtr>::iterator s = global_->stats_.begin();
          s != global_->stats_.end(); ++s) {
@@ -135,6 +325,8 @@ void StatsMgr::resetAll() {
 }
 
 size_t StatsMgr::count() const {
+    Mutex::Locker lock(mutex_);
+    syncCounters();
     return (global_->stats_.size());
 }
 
@@ -206,6 +398,79 @@ StatsMgr::statisticResetAllHandler(const std::string& /*name*/,
                          "All statistics reset to neutral values."));
 }
 
+isc::data::ConstElementPtr
+StatsMgr::statisticSetMaxSampleAgeHandler(const std::string& /*name*/,
+                                          const isc::data::ConstElementPtr& params) {
+    std::string name, error;
+    int64_t duration;
+    if (!getStatName(params, name, error) ||
+        !getIntParam(params, "duration", duration, error)) {
+        return (createAnswer(CONTROL_RESULT_ERROR, error));
+    }
+    if (duration < 0) {
+        return (createAnswer(CONTROL_RESULT_ERROR,
+                             "'duration' parameter must not be negative."));
+    }
+    instance().setMaxSampleAge(name, StatsDuration(0, 0, duration, 0));
+    return (createAnswer(CONTROL_RESULT_SUCCESS,
+                         "Statistic '" + name + "' samples age limit set."));
+}
+
+isc::data::ConstElementPtr
+StatsMgr::statisticSetMaxSampleCountHandler(const std::string& /*name*/,
+                                            const isc::data::ConstElementPtr& params) {
+    std::string name, error;
+    int64_t max_samples;
+    if (!getStatName(params, name, error) ||
+        !getIntParam(params, "max-samples", max_samples, error)) {
+        return (createAnswer(CONTROL_RESULT_ERROR, error));
+    }
+    if ((max_samples <= 0) || (max_samples > Observation::MAX_SAMPLE_COUNT)) {
+        std::ostringstream msg;
+        msg << "'max-samples' parameter must be between 1 and "
+            << Observation::MAX_SAMPLE_COUNT << ".";
+        return (createAnswer(CONTROL_RESULT_ERROR, msg.str()));
+    }
+    instance().setMaxSampleCount(name, static_cast<uint32_t>(max_samples));
+    return (createAnswer(CONTROL_RESULT_SUCCESS,
+                         "Statistic '" + name + "' samples count limit set."));
+}
+
+isc::data::ConstElementPtr
+StatsMgr::statisticGetRatesHandler(const std::string& /*name*/,
+                                   const isc::data::ConstElementPtr& params) {
+    std::string name, error;
+    if (!getStatName(params, name, error)) {
+        return (createAnswer(CONTROL_RESULT_ERROR, error));
+    }
+    try {
+        return (createAnswer(CONTROL_RESULT_SUCCESS,
+                             instance().getRates(name)));
+    } catch (const InvalidStatType&) {
+        return (createAnswer(CONTROL_RESULT_ERROR,
+                             "Statistic '" + name + "' is not an integer."));
+    }
+}
+
+bool
+StatsMgr::getIntParam(const isc::data::ConstElementPtr& params,
+                      const std::string& param_name,
+                      int64_t& value,
+                      std::string& reason) {
+    ConstElementPtr param = params->get(param_name);
+    if (!param) {
+        reason = "Missing mandatory '" + param_name + "' parameter.";
+        return (false);
+    }
+    if (param->getType() != Element::integer) {
+        reason = "'" + param_name + "' parameter expected to be an integer.";
+        return (false);
+    }
+
+    value = param->intValue();
+    return (true);
+}
+
 bool
 StatsMgr::getStatName(const isc::data::ConstElementPtr& params,
                       std::string& name,
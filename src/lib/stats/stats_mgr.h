@@ -9,8 +9,10 @@
 
 #include <stats/observation.h>
 #include <stats/context.h>
+#include <util/threads/sync.h>
 #include <boost/noncopyable.hpp>
 
+#include <atomic>
 #include <map>
 #include <string>
 #include <vector>
@@ -19,6 +21,13 @@
 namespace isc {
 namespace stats {
 
+/// @brief Handle of an integer statistic.
+///
+/// The handle is returned by @ref StatsMgr::getHandle and identifies the
+/// statistic in @ref StatsMgr::addValue(StatHandle, int64_t) without
+/// looking its name up.
+typedef uint32_t StatHandle;
+
 /// @brief Statistics Manager class
 ///
 /// StatsMgr is a singleton class that represents a subsystem that manages
@@ -28,19 +37,20 @@ namespace stats {
 /// As of May 2015, Tomek ran performance benchmarks (see unit-tests in
 /// stats_mgr_unittest.cc with performance in their names) and it seems
 /// the code is able to register ~2.5-3 million observations per second, even
-/// with 1000 different statistics recorded. That seems sufficient for now,
-/// so there is no immediate need to develop any multi-threading solutions
-/// for now. However, should this decision be revised in the future, the
-/// best place for it would to be modify @ref addObservation method here.
-/// It's the common code point that all new observations must pass through.
-/// One possible way to enable multi-threading would be to run a separate
-/// thread handling collection. The main thread would call @ref addValue and
-/// @ref setValue methods that would end up calling @ref addObservation.
-/// That method would pass the data to separate thread to be collected and
-/// would immediately return. Further processing would be mostly as it
-/// is today, except happening in a separate thread. One unsolved issue in
-/// this approach is how to extract data, but that will remain unsolvable
-/// until we get the control socket implementation.
+/// with 1000 different statistics recorded.
+///
+/// The DHCP servers may process packets in multiple threads, so all public
+/// methods of this class are thread safe. They are serialized using a single
+/// mutex. The observations returned by @ref getObservation are not protected
+/// by this mutex, so they should only be used in tests.
+///
+/// The statistics updated for each packet should be updated through handles.
+/// The handle of an integer statistic is obtained once, e.g. when the server
+/// is configured, with @ref getHandle. The updates through the handle are
+/// accumulated in an atomic counter without taking the mutex, looking the
+/// name up or reading the clock. The accumulated values are added to the
+/// observations when the statistics are retrieved, so the timestamp of such
+/// a statistic is the time of the first retrieval following the updates.
 ///
 /// Statistics Manager does not use logging by design. The reasons are:
 /// - performance impact (logging every observation would degrade performance
@@ -126,6 +136,30 @@ class StatsMgr : public boost::noncopyable {
     /// @throw InvalidStatType if statistic is not a string
     void addValue(const std::string& name, const std::string& value);
 
+    /// @brief Returns the handle of an integer statistic.
+    ///
+    /// The handle remains valid when the statistic is removed: the next
+    /// update through the handle creates it again.
+    ///
+    /// @param name name of the statistic
+    /// @return handle of the statistic, the same for subsequent calls with
+    /// the same name
+    /// @throw OutOfRange if too many handles have been requested
+    StatHandle getHandle(const std::string& name);
+
+    /// @brief Records incremental integer observation using a handle.
+    ///
+    /// This method doesn't take the mutex and can be called concurrently.
+    ///
+    /// @param handle handle of the statistic returned by @ref getHandle
+    /// @param value integer value observed
+    void addValue(const StatHandle handle, const int64_t value) {
+        Counter& counter =
+            counters_[handle / COUNTERS_PER_CHUNK][handle % COUNTERS_PER_CHUNK];
+        counter.pending_.fetch_add(value, std::memory_order_relaxed);
+        counter.updated_.store(true, std::memory_order_release);
+    }
+
     /// @brief Determines maximum age of samples.
     ///
     /// Specifies that statistic name should be stored not as a single value,
@@ -134,12 +168,19 @@ class StatsMgr : public boost::noncopyable {
     /// approach. For sample count constrained approach, see @ref
     /// setMaxSampleCount() below.
     ///
-    /// @todo: Not implemented.
+    /// The name ending with '*' is a prefix: the limit applies to all
+    /// statistics whose names start with it, e.g. "subnet[1].*". The limit
+    /// applies to the existing statistics and to those created later. The
+    /// limit set for the exact name has precedence over the prefixes and
+    /// the longest prefix has precedence over the shorter ones.
     ///
     /// Example: to set a statistic to keep observations for the last 5 minutes,
     /// call setMaxSampleAge("incoming-packets", time_duration(0,5,0,0));
     /// to revert statistic to a single value, call:
-    /// setMaxSampleAge("incoming-packets" time_duration(0,0,0,0))
+    /// setMaxSampleCount("incoming-packets", 1)
+    ///
+    /// @param name name of the statistic or a prefix followed by '*'
+    /// @param duration maximum age of the samples
     void setMaxSampleAge(const std::string& name, const StatsDuration& duration);
 
     /// @brief Determines how many samples of a given statistic should be kept.
@@ -147,12 +188,16 @@ class StatsMgr : public boost::noncopyable {
     /// Specifies that statistic name should be stored not as single value, but
     /// rather as a set of values. In this form, at most max_samples will be kept.
     /// When adding max_samples+1 sample, the oldest sample will be discarded.
-    ///
-    /// @todo: Not implemented.
+    /// The name may be a prefix as for @ref setMaxSampleAge.
     ///
     /// Example:
     /// To set a statistic to keep the last 100 observations, call:
     /// setMaxSampleCount("incoming-packets", 100);
+    ///
+    /// @param name name of the statistic or a prefix followed by '*'
+    /// @param max_samples maximum number of samples
+    /// @throw BadValue if the number is 0 or greater than
+    /// @ref Observation::MAX_SAMPLE_COUNT
     void setMaxSampleCount(const std::string& name, uint32_t max_samples);
 
     /// @}
@@ -181,6 +226,9 @@ class StatsMgr : public boost::noncopyable {
     void resetAll();
 
     /// @brief Removes all collected statistics.
+    ///
+    /// The limits of the history set by @ref setMaxSampleAge and
+    /// @ref setMaxSampleCount are removed too.
     void removeAll();
 
     /// @brief Returns number of available statistics.
@@ -200,6 +248,19 @@ class StatsMgr : public boost::noncopyable {
 
     /// @}
 
+    /// @brief Returns the rates of change of an integer statistic.
+    ///
+    /// The rates are computed over the last 1, 5 and 15 minutes from the
+    /// samples retained by the statistic (see @ref Observation::getRate),
+    /// so its history should be limited by the age of at least 15 minutes.
+    ///
+    /// @param name name of the statistic
+    /// @return map holding a map with "1min", "5min" and "15min" rates
+    /// per second under the statistic name, empty if the statistic
+    /// doesn't exist
+    /// @throw InvalidStatType if the statistic is not integer
+    isc::data::ConstElementPtr getRates(const std::string& name) const;
+
     /// @brief Returns an observation.
     ///
     /// Used in testing only. Production code should use @ref get() method.
@@ -325,10 +386,106 @@ class StatsMgr : public boost::noncopyable {
     statisticRemoveAllHandler(const std::string& name,
                               const isc::data::ConstElementPtr& params);
 
+    /// @brief Handles statistic-sample-age-set command
+    ///
+    /// This method handles statistic-sample-age-set command, which limits
+    /// the history of a statistic by the age of the samples. It expects
+    /// two parameters stored in params map:
+    /// name: name-of-the-statistic or a prefix followed by '*'
+    /// duration: maximum age in seconds
+    ///
+    /// Example params structure:
+    /// {
+    ///     "name": "pkt4-received",
+    ///     "duration": 900
+    /// }
+    ///
+    /// @param name name of the command (ignored, should be
+    /// "statistic-sample-age-set")
+    /// @param params structure containing a map that contains "name" and
+    /// "duration"
+    /// @return answer confirming success of this operation
+    static isc::data::ConstElementPtr
+    statisticSetMaxSampleAgeHandler(const std::string& name,
+                                    const isc::data::ConstElementPtr& params);
+
+    /// @brief Handles statistic-sample-count-set command
+    ///
+    /// This method handles statistic-sample-count-set command, which limits
+    /// the history of a statistic by the number of samples. It expects
+    /// two parameters stored in params map:
+    /// name: name-of-the-statistic or a prefix followed by '*'
+    /// max-samples: maximum number of samples
+    ///
+    /// Example params structure:
+    /// {
+    ///     "name": "subnet[1].*",
+    ///     "max-samples": 100
+    /// }
+    ///
+    /// @param name name of the command (ignored, should be
+    /// "statistic-sample-count-set")
+    /// @param params structure containing a map that contains "name" and
+    /// "max-samples"
+    /// @return answer confirming success of this operation
+    static isc::data::ConstElementPtr
+    statisticSetMaxSampleCountHandler(const std::string& name,
+                                      const isc::data::ConstElementPtr& params);
+
+    /// @brief Handles statistic-rates-get command
+    ///
+    /// This method handles statistic-rates-get command, which returns the
+    /// rates of change of an integer statistic (see @ref getRates). It
+    /// expects one parameter stored in params map:
+    /// name: name-of-the-statistic
+    ///
+    /// @param name name of the command (ignored, should be
+    /// "statistic-rates-get")
+    /// @param params structure containing a map that contains "name"
+    /// @return answer containing the rates of the statistic
+    static isc::data::ConstElementPtr
+    statisticGetRatesHandler(const std::string& name,
+                             const isc::data::ConstElementPtr& params);
+
     /// @}
 
  private:
 
+    /// @brief Limit of the history of the statistics.
+    struct SampleLimit {
+        /// @brief Indicates if the samples are limited by their age.
+        bool by_age_;
+
+        /// @brief Maximum age of the samples.
+        StatsDuration max_age_;
+
+        /// @brief Maximum number of the samples.
+        uint32_t max_count_;
+    };
+
+    /// @brief Counter accumulating the updates made through a handle.
+    struct Counter {
+        /// @brief Constructor.
+        Counter() : name_(), pending_(0), updated_(false) {
+        }
+
+        /// @brief Name of the statistic.
+        std::string name_;
+
+        /// @brief Sum of the values added since the last retrieval.
+        std::atomic<int64_t> pending_;
+
+        /// @brief Indicates if the counter was updated since the last
+        /// retrieval.
+        std::atomic<bool> updated_;
+    };
+
+    /// @brief Number of counters allocated at once.
+    static const size_t COUNTERS_PER_CHUNK = 256;
+
+    /// @brief Maximum number of chunks of counters.
+    static const size_t MAX_COUNTER_CHUNKS = 1024;
+
     /// @brief Private constructor.
     /// StatsMgr is a singleton. It should be accessed using @ref instance
     /// method.
@@ -340,7 +497,7 @@ class StatsMgr : public boost::noncopyable {
     ///
     /// This template method sets statistic identified by name to a value
     /// specified by value. This internal method is used by public @ref setValue
-    /// methods.
+    /// methods. The caller must hold the @ref mutex_.
     ///
     /// @tparam DataType one of int64_t, double, StatsDuration or string
     /// @param name name of the statistic
@@ -350,12 +507,13 @@ class StatsMgr : public boost::noncopyable {
     void setValueInternal(const std::string& name, DataType value) {
 
         // If we want to log each observation, here would be the best place for it.
-        ObservationPtr stat = getObservation(name);
+        ObservationPtr stat = global_->get(name);
         if (stat) {
             stat->setValue(value);
         } else {
             stat.reset(new Observation(name, value));
-            addObservation(stat);
+            applySampleLimit(stat);
+            global_->add(stat);
         }
     }
 
@@ -365,7 +523,7 @@ class StatsMgr : public boost::noncopyable {
     ///
     /// This template method adds specified value to a given statistic (identified
     /// by name to a value). This internal method is used by public @ref setValue
-    /// methods.
+    /// methods. The caller must hold the @ref mutex_.
     ///
     /// @tparam DataType one of int64_t, double, StatsDuration or string
     /// @param name name of the statistic
@@ -375,12 +533,12 @@ class StatsMgr : public boost::noncopyable {
     void addValueInternal(const std::string& name, DataType value) {
 
         // If we want to log each observation, here would be the best place for it.
-        ObservationPtr existing = getObservation(name);
+        ObservationPtr existing = global_->get(name);
         if (!existing) {
             // We tried to add to a non-existing statistic. We can recover from
             // that. Simply add the new incremental value as a new statistic and
             // we're done.
-            setValue(name, value);
+            setValueInternal(name, value);
             return;
         } else {
             // Let's hope it is of correct type. If not, the underlying
@@ -422,8 +580,75 @@ class StatsMgr : public boost::noncopyable {
                             std::string& name,
                             std::string& reason);
 
+    /// @brief Utility method that extracts an integer parameter
+    ///
+    /// @param params parameters structure received in command
+    /// @param param_name name of the parameter
+    /// @param value [out] value of the parameter (if no error detected)
+    /// @param reason [out] failure reason (if error is detected)
+    /// @return true (if everything is ok), false otherwise
+    static bool getIntParam(const isc::data::ConstElementPtr& params,
+                            const std::string& param_name,
+                            int64_t& value,
+                            std::string& reason);
+
+    /// @brief Sets the limit of the history of the statistics.
+    ///
+    /// @param name name of the statistic or a prefix followed by '*'
+    /// @param limit the limit
+    void setSampleLimit(const std::string& name, const SampleLimit& limit);
+
+    /// @brief Applies the limit of the history to a new statistic.
+    ///
+    /// The caller must hold the @ref mutex_.
+    ///
+    /// @param stat the statistic
+    void applySampleLimit(const ObservationPtr& stat) const;
+
+    /// @brief Adds the values accumulated by the counter to the statistic.
+    ///
+    /// The caller must hold the @ref mutex_.
+    ///
+    /// @param counter the counter
+    void syncCounter(Counter& counter) const;
+
+    /// @brief Adds the values accumulated by all counters to the statistics.
+    ///
+    /// The caller must hold the @ref mutex_.
+    void syncCounters() const;
+
+    /// @brief Discards the values accumulated by the counter of a statistic.
+    ///
+    /// The caller must hold the @ref mutex_.
+    ///
+    /// @param name name of the statistic
+    void discardCounter(const std::string& name);
+
+    /// @brief Returns the counter of a statistic.
+    ///
+    /// The caller must hold the @ref mutex_.
+    ///
+    /// @param name name of the statistic
+    /// @return pointer to the counter or null if the statistic has no handle
+    Counter* findCounter(const std::string& name) const;
+
     // This is a global context. All statistics will initially be stored here.
     StatContextPtr global_;
+
+    /// @brief Chunks of counters updated through the handles.
+    ///
+    /// The chunks are never freed nor moved, so the counters can be updated
+    /// without the mutex.
+    Counter* counters_[MAX_COUNTER_CHUNKS];
+
+    /// @brief Handles by the statistic name.
+    std::map<std::string, StatHandle> handles_;
+
+    /// @brief Limits of the history by the statistic name or prefix.
+    std::map<std::string, SampleLimit> sample_limits_;
+
+    /// @brief Mutex protecting the statistics from concurrent access.
+    mutable isc::util::thread::Mutex mutex_;
 };
 
 };
@@ -0,0 +1,112 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <stats/latency_histogram.h>
+#include <util/threads/thread.h>
+#include <boost/bind.hpp>
+#include <gtest/gtest.h>
+
+using namespace isc;
+using namespace isc::data;
+using namespace isc::stats;
+
+namespace {
+
+// Checks whether the buckets cover the values without gaps and whether
+// their width is bounded relatively to the values.
+TEST(LatencyHistogramTest, buckets) {
+    uint64_t lowest = 0;
+    for (size_t index = 0; index < LatencyHistogram::NUM_BUCKETS; ++index) {
+        const uint64_t highest = LatencyHistogram::indexToHighestValue(index);
+        ASSERT_LE(lowest, highest) << index;
+        EXPECT_EQ(index, LatencyHistogram::valueToIndex(lowest)) << index;
+        EXPECT_EQ(index, LatencyHistogram::valueToIndex(highest)) << index;
+        // The width is at most 1/16 of the lowest value.
+        if (lowest >= 32) {
+            EXPECT_LE((highest - lowest + 1) * 16, lowest) << index;
+        }
+        lowest = highest + 1;
+    }
+    EXPECT_EQ(LatencyHistogram::MAX_VALUE,
+              LatencyHistogram::indexToHighestValue(LatencyHistogram::NUM_BUCKETS - 1));
+}
+
+// Checks whether the percentiles, min, max and mean are computed.
+TEST(LatencyHistogramTest, percentiles) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(0, histogram.getCount());
+    EXPECT_EQ(0, histogram.getMin());
+    EXPECT_EQ(0, histogram.getMax());
+    EXPECT_EQ(0, histogram.getPercentile(99.0));
+    EXPECT_EQ(0.0, histogram.getMean());
+
+    // 1 to 1000 microseconds.
+    for (uint64_t value = 1; value <= 1000; ++value) {
+        histogram.record(value);
+    }
+    EXPECT_EQ(1000, histogram.getCount());
+    EXPECT_EQ(1, histogram.getMin());
+    EXPECT_EQ(1000, histogram.getMax());
+    EXPECT_DOUBLE_EQ(500.5, histogram.getMean());
+    EXPECT_EQ(1, histogram.getPercentile(0.0));
+    EXPECT_EQ(1000, histogram.getPercentile(100.0));
+
+    // The percentiles are within the width of a bucket.
+    const uint64_t p50 = histogram.getPercentile(50.0);
+    EXPECT_LE(500, p50);
+    EXPECT_GE(500 + 500 / 16, p50);
+    const uint64_t p99 = histogram.getPercentile(99.0);
+    EXPECT_LE(990, p99);
+    EXPECT_GE(1000, p99);
+
+    // Values above the highest value are recorded as the highest value.
+    histogram.record(LatencyHistogram::MAX_VALUE + 1000);
+    EXPECT_EQ(LatencyHistogram::MAX_VALUE, histogram.getMax());
+    EXPECT_EQ(LatencyHistogram::MAX_VALUE, histogram.getPercentile(100.0));
+
+    ElementPtr summary = histogram.toElement();
+    ASSERT_TRUE(summary);
+    ASSERT_TRUE(summary->get("count"));
+    EXPECT_EQ(1001, summary->get("count")->intValue());
+    ASSERT_TRUE(summary->get("p99.9"));
+    EXPECT_EQ(static_cast<int64_t>(histogram.getPercentile(99.9)),
+              summary->get("p99.9")->intValue());
+
+    histogram.reset();
+    EXPECT_EQ(0, histogram.getCount());
+    EXPECT_EQ(0, histogram.getMax());
+    EXPECT_EQ(0, histogram.getPercentile(50.0));
+}
+
+/// @brief Records the values 0 to 9999 in the histogram.
+///
+/// @param histogram the histogram
+void recordValues(LatencyHistogram* histogram) {
+    for (uint64_t value = 0; value < 10000; ++value) {
+        histogram->record(value);
+    }
+}
+
+// Checks whether values can be recorded by multiple threads.
+TEST(LatencyHistogramTest, threads) {
+    LatencyHistogram histogram;
+    {
+        isc::util::thread::Thread thread1(boost::bind(&recordValues,
+                                                      &histogram));
+        isc::util::thread::Thread thread2(boost::bind(&recordValues,
+                                                      &histogram));
+        thread1.wait();
+        thread2.wait();
+    }
+    EXPECT_EQ(20000, histogram.getCount());
+    EXPECT_EQ(0, histogram.getMin());
+    EXPECT_EQ(9999, histogram.getMax());
+    EXPECT_DOUBLE_EQ(4999.5, histogram.getMean());
+}
+
+};
@@ -224,6 +224,131 @@ TEST_F(ObservationTest, reset) {
     EXPECT_EQ("", d.getString().first);
 }
 
+// Checks whether the number of samples can be limited.
+TEST_F(ObservationTest, maxSampleCount) {
+    // Only the last sample is kept by default.
+    EXPECT_TRUE(a.getMaxSampleCount().first);
+    EXPECT_EQ(1, a.getMaxSampleCount().second);
+    EXPECT_FALSE(a.getMaxSampleAge().first);
+    a.setValue(static_cast<int64_t>(1));
+    EXPECT_EQ(1, a.getSize());
+
+    EXPECT_THROW(a.setMaxSampleCount(0), BadValue);
+    EXPECT_THROW(a.setMaxSampleCount(Observation::MAX_SAMPLE_COUNT + 1),
+                 BadValue);
+
+    ASSERT_NO_THROW(a.setMaxSampleCount(3));
+    for (int64_t i = 2; i <= 5; ++i) {
+        a.setValue(i);
+    }
+    std::list<IntegerSample> samples = a.getIntegers();
+    ASSERT_EQ(3, samples.size());
+    EXPECT_EQ(5, samples.front().first);
+    EXPECT_EQ(3, samples.back().first);
+    EXPECT_EQ(5, a.getInteger().first);
+
+    // Decreasing the limit keeps the newest samples.
+    ASSERT_NO_THROW(a.setMaxSampleCount(2));
+    samples = a.getIntegers();
+    ASSERT_EQ(2, samples.size());
+    EXPECT_EQ(5, samples.front().first);
+    EXPECT_EQ(4, samples.back().first);
+
+    // The history of other types is kept too.
+    ASSERT_NO_THROW(d.setMaxSampleCount(2));
+    d.addValue("5");
+    std::list<StringSample> strings = d.getStrings();
+    ASSERT_EQ(2, strings.size());
+    EXPECT_EQ("12345", strings.front().first);
+    EXPECT_EQ("1234", strings.back().first);
+    EXPECT_THROW(d.getIntegers(), InvalidStatType);
+
+    // Reset discards the history.
+    d.reset();
+    EXPECT_EQ(1, d.getSize());
+    EXPECT_EQ("", d.getString().first);
+}
+
+// Checks whether the age of samples can be limited.
+TEST_F(ObservationTest, maxSampleAge) {
+    ASSERT_NO_THROW(b.setMaxSampleAge(millisec::time_duration(0,0,0,100000)));
+    EXPECT_TRUE(b.getMaxSampleAge().first);
+    EXPECT_EQ(millisec::time_duration(0,0,0,100000),
+              b.getMaxSampleAge().second);
+    EXPECT_FALSE(b.getMaxSampleCount().first);
+
+    // The history grows while the samples are recent.
+    for (int i = 0; i < 10; ++i) {
+        b.addValue(1.0);
+    }
+    EXPECT_EQ(11, b.getSize());
+    EXPECT_EQ(22.34, b.getFloat().first);
+
+    // The old samples are discarded when a new one is recorded.
+    usleep(150000);
+    b.addValue(1.0);
+    std::list<FloatSample> samples = b.getFloats();
+    ASSERT_EQ(1, samples.size());
+    EXPECT_EQ(23.34, samples.front().first);
+
+    // Switching back to the count limit.
+    b.addValue(1.0);
+    EXPECT_EQ(2, b.getSize());
+    ASSERT_NO_THROW(b.setMaxSampleCount(1));
+    EXPECT_EQ(1, b.getSize());
+    EXPECT_FALSE(b.getMaxSampleAge().first);
+}
+
+// Checks whether all samples are reported in JSON, the newest first.
+TEST_F(ObservationTest, historyToJSON) {
+    ASSERT_NO_THROW(a.setMaxSampleCount(2));
+    a.setValue(static_cast<int64_t>(5678));
+
+    std::list<IntegerSample> samples = a.getIntegers();
+    ASSERT_EQ(2, samples.size());
+    std::string exp = "[ [ 5678, \""
+        + isc::util::ptimeToText(samples.front().second) + "\" ], [ 1234, \""
+        + isc::util::ptimeToText(samples.back().second) + "\" ] ]";
+
+    EXPECT_EQ(exp, a.getJSON()->str());
+}
+
+// Checks whether the rate of change is computed from the history.
+TEST_F(ObservationTest, getRate) {
+    // A single sample: no change.
+    const ptime now = microsec_clock::local_time();
+    EXPECT_EQ(0.0, a.getRate(minutes(1), now));
+
+    ASSERT_NO_THROW(a.setMaxSampleAge(minutes(15)));
+    usleep(10000);
+    a.addValue(static_cast<int64_t>(100));
+    usleep(10000);
+    a.addValue(static_cast<int64_t>(100));
+
+    std::list<IntegerSample> samples = a.getIntegers();
+    ASSERT_EQ(3, samples.size());
+    const ptime first = samples.back().second;
+    const ptime second = (++samples.begin())->second;
+    const ptime last = samples.front().second;
+
+    // The window starts at the first sample.
+    double expected = 200.0 * 1000000.0 / (last - first).total_microseconds();
+    EXPECT_DOUBLE_EQ(expected, a.getRate(last - first, last));
+
+    // The history is shorter than the window.
+    expected = 200.0 * 1000000.0 / (last + seconds(1) - first).total_microseconds();
+    EXPECT_DOUBLE_EQ(expected, a.getRate(minutes(1), last + seconds(1)));
+
+    // The window starts between the samples: the value at the beginning
+    // is the one of the second sample.
+    const time_duration window = (last - second) - microseconds(1);
+    expected = 100.0 * 1000000.0 / window.total_microseconds();
+    EXPECT_DOUBLE_EQ(expected, a.getRate(window, last));
+
+    // The rate is computed only for integers.
+    EXPECT_THROW(b.getRate(minutes(1), now), InvalidStatType);
+}
+
 // Checks whether an observation can keep its name.
 TEST_F(ObservationTest, names) {
     EXPECT_EQ("alpha", a.getName());
@@ -0,0 +1,67 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <stats/sample_ring.h>
+#include <exceptions/exceptions.h>
+#include <gtest/gtest.h>
+
+using namespace isc;
+using namespace isc::stats;
+
+namespace {
+
+// Checks whether the ring overwrites the oldest samples when full.
+TEST(SampleRingTest, push) {
+    SampleRing<int> ring(3);
+    EXPECT_TRUE(ring.empty());
+    EXPECT_EQ(3, ring.capacity());
+    EXPECT_THROW(ring.at(0), OutOfRange);
+
+    for (int i = 1; i <= 5; ++i) {
+        ring.push(i);
+    }
+    ASSERT_EQ(3, ring.size());
+    EXPECT_EQ(5, ring.at(0));
+    EXPECT_EQ(4, ring.at(1));
+    EXPECT_EQ(3, ring.at(2));
+    EXPECT_THROW(ring.at(3), OutOfRange);
+
+    ring.popOldest();
+    ASSERT_EQ(2, ring.size());
+    EXPECT_EQ(4, ring.at(1));
+
+    ring.clear();
+    EXPECT_TRUE(ring.empty());
+}
+
+// Checks whether changing the capacity keeps the newest samples.
+TEST(SampleRingTest, setCapacity) {
+    SampleRing<int> ring;
+    EXPECT_EQ(1, ring.capacity());
+    ring.push(1);
+    ring.push(2);
+    ASSERT_EQ(1, ring.size());
+    EXPECT_EQ(2, ring.at(0));
+
+    ring.setCapacity(4);
+    ring.push(3);
+    ring.push(4);
+    ASSERT_EQ(3, ring.size());
+    EXPECT_EQ(4, ring.at(0));
+    EXPECT_EQ(2, ring.at(2));
+
+    ring.setCapacity(2);
+    ASSERT_EQ(2, ring.size());
+    EXPECT_EQ(4, ring.at(0));
+    EXPECT_EQ(3, ring.at(1));
+    ring.push(5);
+    EXPECT_EQ(5, ring.at(0));
+    EXPECT_EQ(4, ring.at(1));
+}
+
+};
@@ -11,13 +11,17 @@
 #include <cc/data.h>
 #include <cc/command_interpreter.h>
 #include <util/boost_time_utils.h>
+#include <util/threads/thread.h>
 #include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/bind.hpp>
 #include <boost/shared_ptr.hpp>
 #include <gtest/gtest.h>
 
 #include <iostream>
 #include <sstream>
 
+#include <unistd.h>
+
 using namespace isc;
 using namespace isc::data;
 using namespace isc::stats;
@@ -122,12 +126,86 @@ TEST_F(StatsMgrTest, stringStat) {
 // Setting limits is currently not implemented, so those methods should
 // throw.
 TEST_F(StatsMgrTest, setLimits) {
-    EXPECT_THROW(StatsMgr::instance().setMaxSampleAge("foo",
-                                                      time_duration(1,0,0,0)),
-                 NotImplemented);
+    StatsMgr::instance().setValue("foo", static_cast<int64_t>(1));
+    EXPECT_NO_THROW(StatsMgr::instance().setMaxSampleAge("foo",
+                                                         time_duration(1,0,0,0)));
+    ObservationPtr foo = StatsMgr::instance().getObservation("foo");
+    ASSERT_TRUE(foo);
+    EXPECT_TRUE(foo->getMaxSampleAge().first);
+    EXPECT_EQ(time_duration(1,0,0,0), foo->getMaxSampleAge().second);
+
+    EXPECT_NO_THROW(StatsMgr::instance().setMaxSampleCount("foo", 100));
+    EXPECT_TRUE(foo->getMaxSampleCount().first);
+    EXPECT_EQ(100, foo->getMaxSampleCount().second);
+
+    EXPECT_THROW(StatsMgr::instance().setMaxSampleCount("foo", 0), BadValue);
+}
+
+// This test checks whether the limits apply to the statistics created
+// later and whether the prefixes are matched.
+TEST_F(StatsMgrTest, setLimitsPrefix) {
+    StatsMgr::instance().setMaxSampleCount("subnet[1].*", 5);
+    StatsMgr::instance().setMaxSampleCount("subnet[1].assigned*", 10);
+    StatsMgr::instance().setMaxSampleCount("subnet[1].total", 20);
+
+    StatsMgr::instance().setValue("subnet[1].total", static_cast<int64_t>(1));
+    StatsMgr::instance().setValue("subnet[1].assigned", static_cast<int64_t>(1));
+    StatsMgr::instance().setValue("subnet[1].declined", static_cast<int64_t>(1));
+    StatsMgr::instance().setValue("subnet[2].total", static_cast<int64_t>(1));
+    StatHandle handle = StatsMgr::instance().getHandle("subnet[1].received");
+    StatsMgr::instance().addValue(handle, static_cast<int64_t>(1));
+
+    EXPECT_EQ(20, StatsMgr::instance().getObservation("subnet[1].total")
+              ->getMaxSampleCount().second);
+    EXPECT_EQ(10, StatsMgr::instance().getObservation("subnet[1].assigned")
+              ->getMaxSampleCount().second);
+    EXPECT_EQ(5, StatsMgr::instance().getObservation("subnet[1].declined")
+              ->getMaxSampleCount().second);
+    EXPECT_EQ(5, StatsMgr::instance().getObservation("subnet[1].received")
+              ->getMaxSampleCount().second);
+    EXPECT_EQ(1, StatsMgr::instance().getObservation("subnet[2].total")
+              ->getMaxSampleCount().second);
+
+    // The samples are kept.
+    for (int i = 0; i < 30; ++i) {
+        StatsMgr::instance().addValue("subnet[1].total",
+                                      static_cast<int64_t>(1));
+    }
+    EXPECT_EQ(20, StatsMgr::instance().getObservation("subnet[1].total")
+              ->getSize());
+    EXPECT_EQ(20, StatsMgr::instance().get("subnet[1].total")
+              ->get("subnet[1].total")->size());
+
+    // The limits are removed with the statistics.
+    StatsMgr::instance().removeAll();
+    StatsMgr::instance().setValue("subnet[1].total", static_cast<int64_t>(1));
+    EXPECT_EQ(1, StatsMgr::instance().getObservation("subnet[1].total")
+              ->getMaxSampleCount().second);
+}
 
-    EXPECT_THROW(StatsMgr::instance().setMaxSampleCount("foo", 100),
-                 NotImplemented);
+// This test checks whether the rates of an integer statistic are reported.
+TEST_F(StatsMgrTest, getRates) {
+    StatsMgr::instance().setMaxSampleAge("alpha", time_duration(0,15,0,0));
+    StatsMgr::instance().setValue("alpha", static_cast<int64_t>(0));
+    StatsMgr::instance().setValue("beta", 12.34);
+
+    ConstElementPtr rates = StatsMgr::instance().getRates("alpha");
+    ASSERT_TRUE(rates);
+    ConstElementPtr alpha = rates->get("alpha");
+    ASSERT_TRUE(alpha);
+    ASSERT_TRUE(alpha->get("1min"));
+    ASSERT_TRUE(alpha->get("5min"));
+    ASSERT_TRUE(alpha->get("15min"));
+    EXPECT_EQ(0.0, alpha->get("1min")->doubleValue());
+
+    usleep(10000);
+    StatsMgr::instance().addValue("alpha", static_cast<int64_t>(100));
+    rates = StatsMgr::instance().getRates("alpha");
+    EXPECT_LT(0.0, rates->get("alpha")->get("1min")->doubleValue());
+    EXPECT_LT(0.0, rates->get("alpha")->get("15min")->doubleValue());
+
+    EXPECT_EQ(0, StatsMgr::instance().getRates("gamma")->size());
+    EXPECT_THROW(StatsMgr::instance().getRates("beta"), InvalidStatType);
 }
 
 // This test checks whether a single (get("foo")) and all (getAll())
@@ -392,6 +470,113 @@ TEST_F(StatsMgrTest, DISABLED_performanceMultipleSet) {
               << " times took: " << isc::util::durationToText(dur) << std::endl;
 }
 
+// Test checks that the integer statistics can be updated using handles.
+TEST_F(StatsMgrTest, handle) {
+    StatHandle alpha = StatsMgr::instance().getHandle("alpha");
+    StatHandle beta = StatsMgr::instance().getHandle("beta");
+    EXPECT_NE(alpha, beta);
+    EXPECT_EQ(alpha, StatsMgr::instance().getHandle("alpha"));
+
+    // Getting the handle doesn't create the statistic.
+    EXPECT_EQ(0, StatsMgr::instance().count());
+
+    // The first update creates it.
+    StatsMgr::instance().addValue(alpha, static_cast<int64_t>(2));
+    StatsMgr::instance().addValue(alpha, static_cast<int64_t>(3));
+    ObservationPtr obs = StatsMgr::instance().getObservation("alpha");
+    ASSERT_TRUE(obs);
+    EXPECT_EQ(5, obs->getInteger().first);
+    EXPECT_EQ(1, StatsMgr::instance().count());
+
+    // The updates by name and by handle are added.
+    StatsMgr::instance().addValue("alpha", static_cast<int64_t>(10));
+    StatsMgr::instance().addValue(alpha, static_cast<int64_t>(1));
+    std::string exp = "{ \"alpha\": [ [ 16, \""
+        + isc::util::ptimeToText(StatsMgr::instance().getObservation("alpha")
+                                 ->getInteger().second) + "\" ] ] }";
+    EXPECT_EQ(exp, StatsMgr::instance().get("alpha")->str());
+
+    // The updates made before setting the value are discarded.
+    StatsMgr::instance().addValue(alpha, static_cast<int64_t>(7));
+    StatsMgr::instance().setValue("alpha", static_cast<int64_t>(100));
+    EXPECT_EQ(100, StatsMgr::instance().getObservation("alpha")
+              ->getInteger().first);
+
+    // Same for the reset.
+    StatsMgr::instance().addValue(alpha, static_cast<int64_t>(7));
+    EXPECT_TRUE(StatsMgr::instance().reset("alpha"));
+    EXPECT_EQ(0, StatsMgr::instance().getObservation("alpha")
+              ->getInteger().first);
+
+    // The removed statistic is created again by the next update.
+    StatsMgr::instance().addValue(beta, static_cast<int64_t>(7));
+    StatsMgr::instance().removeAll();
+    EXPECT_EQ(0, StatsMgr::instance().count());
+    StatsMgr::instance().addValue(beta, static_cast<int64_t>(1));
+    EXPECT_FALSE(StatsMgr::instance().getObservation("alpha"));
+    ASSERT_TRUE(StatsMgr::instance().getObservation("beta"));
+    EXPECT_EQ(1, StatsMgr::instance().getObservation("beta")
+              ->getInteger().first);
+
+    // The updates of a statistic of another type are dropped.
+    StatsMgr::instance().setValue("alpha", 1.5);
+    StatsMgr::instance().addValue(alpha, static_cast<int64_t>(1));
+    EXPECT_NO_THROW(StatsMgr::instance().getAll());
+    EXPECT_EQ(1.5, StatsMgr::instance().getObservation("alpha")
+              ->getFloat().first);
+}
+
+/// @brief Increments the statistic many times.
+///
+/// @param handle handle of the statistic
+void
+incrementStat(const StatHandle handle) {
+    for (int i = 0; i < 100000; ++i) {
+        StatsMgr::instance().addValue(handle, static_cast<int64_t>(1));
+    }
+}
+
+// Test checks that the statistics can be updated using handles from
+// several threads.
+TEST_F(StatsMgrTest, handleThreads) {
+    StatHandle handle = StatsMgr::instance().getHandle("gamma");
+    {
+        isc::util::thread::Thread first(boost::bind(&incrementStat, handle));
+        isc::util::thread::Thread second(boost::bind(&incrementStat, handle));
+        // Retrieving the statistic concurrently doesn't lose updates.
+        for (int i = 0; i < 100; ++i) {
+            StatsMgr::instance().getAll();
+        }
+        first.wait();
+        second.wait();
+    }
+    ObservationPtr obs = StatsMgr::instance().getObservation("gamma");
+    ASSERT_TRUE(obs);
+    EXPECT_EQ(200000, obs->getInteger().first);
+}
+
+// This is a performance benchmark that checks how long does it take
+// to increment a single statistic million times using a handle.
+TEST_F(StatsMgrTest, DISABLED_performanceHandleAdd) {
+    StatsMgr::instance().removeAll();
+
+    uint32_t cycles = 1000000;
+    StatHandle handle = StatsMgr::instance().getHandle("metric1");
+
+    ptime before = microsec_clock::local_time();
+    for (uint32_t i = 0; i < cycles; ++i) {
+        StatsMgr::instance().addValue(handle, static_cast<int64_t>(i));
+    }
+    StatsMgr::instance().getAll();
+    ptime after = microsec_clock::local_time();
+
+    time_duration dur = after - before;
+
+    std::cout << "Incrementing a single statistic " << cycles
+              << " times using a handle took: "
+              << isc::util::durationToText(dur) << std::endl;
+}
+
 // Test checks whether statistics name can be generated using various
 // indexes.
 TEST_F(StatsMgrTest, generateName) {
@@ -678,4 +863,78 @@ TEST_F(StatsMgrTest, commandRemoveAll) {
     EXPECT_FALSE(StatsMgr::instance().getObservation("delta"));
 }
 
+// This test checks whether statistic-sample-age-set and
+// statistic-sample-count-set commands set the limits and validate
+// their parameters.
+TEST_F(StatsMgrTest, commandSetLimits) {
+    StatsMgr::instance().setValue("alpha", static_cast<int64_t>(1234));
+
+    ElementPtr params = Element::createMap();
+    params->set("name", Element::create("alpha"));
+    params->set("duration", Element::create(60));
+    ConstElementPtr rsp = StatsMgr::instance().statisticSetMaxSampleAgeHandler(
+        "statistic-sample-age-set", params);
+    int status_code;
+    ASSERT_NO_THROW(parseAnswer(status_code, rsp));
+    EXPECT_EQ(CONTROL_RESULT_SUCCESS, status_code);
+    ObservationPtr alpha = StatsMgr::instance().getObservation("alpha");
+    ASSERT_TRUE(alpha);
+    EXPECT_TRUE(alpha->getMaxSampleAge().first);
+    EXPECT_EQ(time_duration(0,1,0,0), alpha->getMaxSampleAge().second);
+
+    params->set("max-samples", Element::create(10));
+    rsp = StatsMgr::instance().statisticSetMaxSampleCountHandler(
+        "statistic-sample-count-set", params);
+    ASSERT_NO_THROW(parseAnswer(status_code, rsp));
+    EXPECT_EQ(CONTROL_RESULT_SUCCESS, status_code);
+    EXPECT_TRUE(alpha->getMaxSampleCount().first);
+    EXPECT_EQ(10, alpha->getMaxSampleCount().second);
+
+    // Invalid parameters.
+    params->set("max-samples", Element::create(0));
+    rsp = StatsMgr::instance().statisticSetMaxSampleCountHandler(
+        "statistic-sample-count-set", params);
+    ASSERT_NO_THROW(parseAnswer(status_code, rsp));
+    EXPECT_EQ(CONTROL_RESULT_ERROR, status_code);
+
+    params->set("duration", Element::create("60"));
+    rsp = StatsMgr::instance().statisticSetMaxSampleAgeHandler(
+        "statistic-sample-age-set", params);
+    ASSERT_NO_THROW(parseAnswer(status_code, rsp));
+    EXPECT_EQ(CONTROL_RESULT_ERROR, status_code);
+
+    params = Element::createMap();
+    params->set("name", Element::create("alpha"));
+    rsp = StatsMgr::instance().statisticSetMaxSampleCountHandler(
+        "statistic-sample-count-set", params);
+    EXPECT_EQ("{ \"result\": 1, \"text\": \"Missing mandatory 'max-samples' "
+              "parameter.\" }", rsp->str());
+    EXPECT_EQ(10, alpha->getMaxSampleCount().second);
+}
+
+// This test checks whether statistic-rates-get command returns the rates.
+TEST_F(StatsMgrTest, commandGetRates) {
+    StatsMgr::instance().setValue("alpha", static_cast<int64_t>(1234));
+    StatsMgr::instance().setValue("beta", 12.34);
+
+    ElementPtr params = Element::createMap();
+    params->set("name", Element::create("alpha"));
+    ConstElementPtr rsp = StatsMgr::instance().statisticGetRatesHandler(
+        "statistic-rates-get", params);
+    int status_code;
+    ConstElementPtr rep;
+    ASSERT_NO_THROW(rep = parseAnswer(status_code, rsp));
+    EXPECT_EQ(CONTROL_RESULT_SUCCESS, status_code);
+    ASSERT_TRUE(rep);
+    ASSERT_TRUE(rep->get("alpha"));
+    EXPECT_EQ("{ \"15min\": 0, \"1min\": 0, \"5min\": 0 }",
+              rep->get("alpha")->str());
+
+    params->set("name", Element::create("beta"));
+    rsp = StatsMgr::instance().statisticGetRatesHandler(
+        "statistic-rates-get", params);
+    EXPECT_EQ("{ \"result\": 1, \"text\": \"Statistic 'beta' is not an "
+              "integer.\" }", rsp->str());
+}
+
 };
@@ -1,4 +1,4 @@
-// Copyright (C) 2009-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2009-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -8,6 +8,7 @@
 #define BUFFER_H 1
 
 #include <stdlib.h>
+#include <algorithm>
 #include <cstring>
 #include <vector>
 
@@ -385,6 +386,18 @@ public:
         return (*this);
     }
 
+    /// \brief Exchange the content of two buffers.
+    ///
+    /// The memory held by the buffers is exchanged, so neither buffer
+    /// is copied and nothing is allocated.
+    ///
+    /// \param other The buffer to exchange the content with.
+    void swap(OutputBuffer& other) {
+        std::swap(buffer_, other.buffer_);
+        std::swap(size_, other.size_);
+        std::swap(allocated_, other.allocated_);
+    }
+
     ///
     /// \name Getter Methods
     ///
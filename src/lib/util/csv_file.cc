@@ -5,9 +5,6 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <util/csv_file.h>
-#include <boost/algorithm/string/classification.hpp>
-#include <boost/algorithm/string/constants.hpp>
-#include <boost/algorithm/string/split.hpp>
 #include <algorithm>
 #include <fstream>
 #include <sstream>
@@ -27,10 +24,27 @@ CSVRow::CSVRow(const std::string& text, const char separator)
 
 void
 CSVRow::parse(const std::string& line) {
-    // Tokenize the string using a specified separator. Disable compression,
-    // so as the two consecutive separators mark an empty value.
-    boost::split(values_, line, boost::is_any_of(separator_),
-                 boost::algorithm::token_compress_off);
+    parse(line.data(), line.data() + line.size());
+}
+
+void
+CSVRow::parse(const char* begin, const char* end) {
+    // Tokenize the row using a specified separator. The two consecutive
+    // separators mark an empty value.
+    size_t count = 0;
+    for (const char* value = begin; ; ++count) {
+        const char* sep = std::find(value, end, separator_[0]);
+        if (count < values_.size()) {
+            values_[count].assign(value, sep);
+        } else {
+            values_.push_back(std::string(value, sep));
+        }
+        if (sep == end) {
+            break;
+        }
+        value = sep + 1;
+    }
+    values_.resize(count + 1);
 }
 
 std::string
@@ -79,7 +93,7 @@ CSVRow::checkIndex(const size_t at) const {
 }
 
 CSVFile::CSVFile(const std::string& filename)
-    : filename_(filename), fs_(), cols_(0), read_msg_() {
+    : filename_(filename), fs_(), cols_(0), read_msg_(), writer_() {
 }
 
 CSVFile::~CSVFile() {
@@ -91,6 +105,9 @@ CSVFile::close() {
     // It is allowed to close multiple times. If file has been already closed,
     // this is no-op.
     if (fs_) {
+        if (writer_) {
+            writer_->close();
+        }
         fs_->close();
         fs_.reset();
     }
@@ -153,6 +170,11 @@ CSVFile::append(const CSVRow& row) const {
     fs_->clear();
 
     std::string text = row.render();
+    if (writer_) {
+        writer_->write(text + "\n");
+        return;
+    }
+
     *fs_ << text << std::endl;
     if (!fs_->good()) {
         fs_->clear();
@@ -161,6 +183,26 @@ CSVFile::append(const CSVRow& row) const {
     }
 }
 
+void
+CSVFile::setWriter(const CSVFileWriterPtr& writer) {
+    if (writer_ && fs_) {
+        writer_->close();
+    }
+    writer_ = writer;
+    if (fs_) {
+        openWriter();
+    }
+}
+
+void
+CSVFile::openWriter() {
+    if (writer_) {
+        checkStreamStatusAndReset("open writer");
+        fs_->flush();
+        writer_->open(filename_);
+    }
+}
+
 void
 CSVFile::checkStreamStatusAndReset(const std::string& operation) const {
     if (!fs_) {
@@ -320,6 +362,8 @@ CSVFile::open(const bool seek_to_end) {
                 fs_->clear();
             }
 
+            openWriter();
+
         } catch (const std::exception&) {
             close();
             throw;
@@ -351,6 +395,8 @@ CSVFile::recreate() {
         }
         *fs_ << header << std::endl;
 
+        openWriter();
+
     } catch (const std::exception& ex) {
         close();
         isc_throw(CSVFileError, ex.what());
@@ -97,6 +97,21 @@ public:
     /// @param line String holding a row of comma separated values.
     void parse(const std::string& line);
 
+    /// @brief Parse the CSV file row held in a buffer.
+    ///
+    /// This variant parses the row directly from the buffer, e.g. the
+    /// contents of the file read into memory, without copying the row
+    /// to a string first. The strings already held in the row are reused,
+    /// so parsing multiple rows with the same object doesn't allocate
+    /// memory unless the values grow.
+    ///
+    /// This function is exception-free.
+    ///
+    /// @param begin Pointer to the first character of the row.
+    /// @param end Pointer past the last character of the row. It must not
+    /// include the end of line character.
+    void parse(const char* begin, const char* end);
+
     /// @brief Retrieves a value from the internal container.
     ///
     /// @param at Index of the value in the container. The values are indexed
@@ -265,6 +280,42 @@ private:
 /// @param row Object representing a CSV file row.
 std::ostream& operator<<(std::ostream& os, const CSVRow& row);
 
+/// @brief Interface of the writer of the rows appended to a CSV file.
+///
+/// By default, the @c CSVFile writes the appended rows into its file
+/// stream. The writer installed with @c CSVFile::setWriter takes over
+/// writing the appended rows, e.g. to buffer them and write them into
+/// the file in batches. The stream is still used to read the file and to
+/// write its header.
+///
+/// The writer is opened when the CSV file is opened, after the contents of
+/// the stream have been flushed, and closed when the CSV file is closed.
+class CSVFileWriter {
+public:
+
+    /// @brief Destructor.
+    virtual ~CSVFileWriter() { }
+
+    /// @brief Opens the writer for the specified file.
+    ///
+    /// @param filename Name of the CSV file.
+    virtual void open(const std::string& filename) = 0;
+
+    /// @brief Writes the rendered row.
+    ///
+    /// @param text Text of the row, including the end of line character.
+    virtual void write(const std::string& text) = 0;
+
+    /// @brief Closes the writer.
+    ///
+    /// The writer must write out all rows passed to it before returning.
+    /// This method must not throw.
+    virtual void close() = 0;
+};
+
+/// @brief Pointer to the @c CSVFileWriter.
+typedef boost::shared_ptr<CSVFileWriter> CSVFileWriterPtr;
+
 /// @brief Provides input/output access to CSV files.
 ///
 /// This class provides basic methods to access (parse) and create CSV files.
@@ -317,6 +368,21 @@ public:
     /// size of the row doesn't match the number of columns.
     void append(const CSVRow& row) const;
 
+    /// @brief Installs the writer of the appended rows.
+    ///
+    /// If the file is open, the writer is opened immediately. Otherwise,
+    /// it is opened when the file is opened. The writer previously
+    /// installed, if any, is closed.
+    ///
+    /// @param writer Pointer to the writer or null pointer to write the
+    /// rows into the file stream.
+    void setWriter(const CSVFileWriterPtr& writer);
+
+    /// @brief Returns the writer of the appended rows.
+    const CSVFileWriterPtr& getWriter() const {
+        return (writer_);
+    }
+
     /// @brief Closes the CSV file.
     void close();
 
@@ -485,6 +551,11 @@ private:
     /// @throw CSVFileError if stream is closed or pointer to it is NULL.
     void checkStreamStatusAndReset(const std::string& operation) const;
 
+    /// @brief Opens the writer, if installed, for the open file.
+    ///
+    /// The contents of the file stream are flushed first.
+    void openWriter();
+
     /// @brief Returns size of the CSV file.
     std::streampos size() const;
 
@@ -499,6 +570,9 @@ private:
 
     /// @brief Holds last error during row reading or validation.
     std::string read_msg_;
+
+    /// @brief Writer of the appended rows.
+    CSVFileWriterPtr writer_;
 };
 
 } // namespace isc::util
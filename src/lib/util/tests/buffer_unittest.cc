@@ -1,4 +1,4 @@
-// Copyright (C) 2009-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2009-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -284,6 +284,22 @@ TEST_F(BufferTest, outputBufferAssignSelf) {
     EXPECT_NO_THROW(obuffer = obuffer);
 }
 
+// Check that the buffers are exchanged without copying the data
+TEST_F(BufferTest, outputBufferSwap) {
+    obuffer.writeData(testdata, sizeof(testdata));
+    const void* data = obuffer.getData();
+    const size_t capacity = obuffer.getCapacity();
+
+    OutputBuffer other(0);
+    other.swap(obuffer);
+    EXPECT_EQ(data, other.getData());
+    EXPECT_EQ(sizeof(testdata), other.getLength());
+    EXPECT_EQ(capacity, other.getCapacity());
+    EXPECT_EQ(0, obuffer.getLength());
+    EXPECT_EQ(0, obuffer.getCapacity());
+    EXPECT_EQ(NULL, obuffer.getData());
+}
+
 TEST_F(BufferTest, outputBufferZeroSize) {
     // Some OSes might return NULL on malloc for 0 size, so check it works
     EXPECT_NO_THROW({
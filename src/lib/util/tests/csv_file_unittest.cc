@@ -431,6 +431,71 @@ TEST_F(CSVFileTest, recreate) {
               readFile());
 }
 
+/// @brief Writer collecting the rows appended to the CSV file.
+class TestCSVFileWriter : public CSVFileWriter {
+public:
+
+    /// @brief Remembers the name of the opened file.
+    virtual void open(const std::string& filename) {
+        opened_ = filename;
+    }
+
+    /// @brief Collects the row.
+    virtual void write(const std::string& text) {
+        rows_ += text;
+    }
+
+    /// @brief Clears the name of the opened file.
+    virtual void close() {
+        opened_.clear();
+    }
+
+    /// @brief Name of the opened file.
+    std::string opened_;
+
+    /// @brief Collected rows.
+    std::string rows_;
+};
+
+// This test checks that the writer installed for the CSV file takes over
+// writing the appended rows.
+TEST_F(CSVFileTest, writer) {
+    boost::scoped_ptr<CSVFile> csv(new CSVFile(testfile_));
+    csv->addColumn("animal");
+    csv->addColumn("age");
+
+    boost::shared_ptr<TestCSVFileWriter> writer(new TestCSVFileWriter());
+    csv->setWriter(writer);
+    EXPECT_TRUE(writer->opened_.empty());
+
+    // The writer is opened with the file.
+    ASSERT_NO_THROW(csv->recreate());
+    EXPECT_EQ(testfile_, writer->opened_);
+
+    CSVRow row(2);
+    row.writeAt(0, "dog");
+    row.writeAt(1, 3);
+    ASSERT_NO_THROW(csv->append(row));
+    EXPECT_EQ("dog,3\n", writer->rows_);
+
+    csv->close();
+    EXPECT_TRUE(writer->opened_.empty());
+
+    // The header is written to the file but the row is not.
+    EXPECT_EQ("animal,age\n", readFile());
+
+    // The writer is opened when the existing file is opened.
+    ASSERT_NO_THROW(csv->open(true));
+    EXPECT_EQ(testfile_, writer->opened_);
+
+    // Removing the writer restores writing the rows to the file.
+    csv->setWriter(CSVFileWriterPtr());
+    EXPECT_TRUE(writer->opened_.empty());
+    ASSERT_NO_THROW(csv->append(row));
+    csv->close();
+    EXPECT_EQ("animal,age\ndog,3\n", readFile());
+}
+
 // This test checks that the error is reported when the size of the row being
 // read doesn't match the number of columns of the CSV file.
 TEST_F(CSVFileTest, validate) {
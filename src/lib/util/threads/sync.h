@@ -12,6 +12,7 @@
 #include <boost/noncopyable.hpp>
 
 #include <cstdlib> // for NULL.
+#include <stdint.h>
 
 namespace isc {
 namespace util {
@@ -186,12 +187,8 @@ private:
 /// Note that \c mutex passed to the \c wait() method must be the same one
 /// used to construct the \c locker.
 ///
-/// Right now there is no equivalent to pthread_cond_broadcast() or
-/// pthread_cond_timedwait() in this class, because this class was meant
-/// for internal development of BIND 10 and we don't need these at the
-/// moment.  If and when we need these interfaces they can be added at that
-/// point. Also, Kea likely to not use threading model, so the usefulness
-/// of this class is uncertain.
+/// The \c timedWait() method is an equivalent of pthread_cond_timedwait()
+/// with the timeout specified relative to the current time.
 ///
 /// \note This class is defined as a friend class of \c Mutex and directly
 /// refers to and modifies private internals of the \c Mutex class.  It breaks
@@ -233,6 +230,22 @@ public:
     /// \param mutex A \c Mutex object to be released on wait().
     void wait(Mutex& mutex);
 
+    /// \brief Wait on the condition variable with a timeout.
+    ///
+    /// This method works like \c wait(), but it returns when the condition
+    /// variable hasn't been signalled within the specified time.  As with
+    /// \c wait(), spurious wakeups are possible, so the caller should check
+    /// the condition it is waiting for upon return.
+    ///
+    /// \throw isc::InvalidOperation mutex isn't locked
+    /// \throw isc::BadValue mutex is not a valid \c Mutex object
+    ///
+    /// \param mutex A \c Mutex object to be released on wait.
+    /// \param timeout_ms Timeout in milliseconds.
+    ///
+    /// \return false if the timeout has elapsed, true otherwise.
+    bool timedWait(Mutex& mutex, const uint32_t timeout_ms);
+
     /// \brief Unblock a thread waiting for the condition variable.
     ///
     /// This method wakes one of other threads (if any) waiting on this object
@@ -241,6 +254,15 @@ public:
     /// This method never throws; if some unexpected low level error happens
     /// it terminates the program.
     void signal();
+
+    /// \brief Unblock all threads waiting for the condition variable.
+    ///
+    /// This method works like \c pthread_cond_broadcast().  It wakes all
+    /// threads (if any) waiting on this object via the \c wait() call.
+    ///
+    /// This method never throws; if some unexpected low level error happens
+    /// it terminates the program.
+    void broadcast();
 private:
     class Impl;
     Impl* impl_;
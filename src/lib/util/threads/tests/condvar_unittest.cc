@@ -162,6 +162,23 @@ TEST_F(CondVarTest, badWait) {
 
 #endif // ENABLE_DEBUG
 
+// Checks that the timed wait returns on timeout and when signalled.
+TEST_F(CondVarTest, timedWait) {
+    Mutex::Locker locker(mutex_);
+    EXPECT_FALSE(condvar_.timedWait(mutex_, 10));
+
+    if (!isc::util::unittests::runningOnValgrind()) {
+        int shared_var = 0;
+        Thread t(boost::bind(&ringSignal, &condvar_, &mutex_, &shared_var));
+        // Guard against spurious wakeups.
+        while (shared_var == 0) {
+            EXPECT_TRUE(condvar_.timedWait(mutex_, 5000));
+        }
+        t.wait();
+        EXPECT_EQ(1, shared_var);
+    }
+}
+
 TEST_F(CondVarTest, emptySignal) {
     // It's okay to call signal when no one waits.
     EXPECT_NO_THROW(condvar_.signal());
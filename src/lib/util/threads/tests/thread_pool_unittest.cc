@@ -0,0 +1,205 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <exceptions/exceptions.h>
+#include <util/threads/sync.h>
+#include <util/threads/thread_pool.h>
+
+#include <boost/bind.hpp>
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+using namespace isc;
+using namespace isc::util::thread;
+
+namespace {
+
+/// @brief Test fixture for the @c ThreadPool class.
+class ThreadPoolTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ThreadPoolTest()
+        : count_(0), blocked_(false) {
+    }
+
+    /// @brief Work item incrementing the counter.
+    void increment() {
+        Mutex::Locker lock(mutex_);
+        ++count_;
+    }
+
+    /// @brief Work item blocking until @c release is called.
+    void block() {
+        Mutex::Locker lock(mutex_);
+        while (blocked_) {
+            cond_.wait(mutex_);
+        }
+        ++count_;
+    }
+
+    /// @brief Releases work items blocked in @c block.
+    void release() {
+        Mutex::Locker lock(mutex_);
+        blocked_ = false;
+        cond_.broadcast();
+    }
+
+    /// @brief Work item throwing an exception.
+    void throwing() {
+        isc_throw(Unexpected, "work item failed");
+    }
+
+    /// @brief Returns the counter value.
+    size_t getCount() {
+        Mutex::Locker lock(mutex_);
+        return (count_);
+    }
+
+    /// @brief Number of executed work items.
+    size_t count_;
+
+    /// @brief Indicates if @c block should block.
+    bool blocked_;
+
+    /// @brief Protects the members above.
+    Mutex mutex_;
+
+    /// @brief Signalled by @c release.
+    CondVar cond_;
+};
+
+// Checks that the pool can't be created with an empty queue and that
+// it can't be started without threads or twice.
+TEST_F(ThreadPoolTest, constructor) {
+    EXPECT_THROW(ThreadPool(0), BadValue);
+
+    ThreadPool pool(10);
+    EXPECT_FALSE(pool.isRunning());
+    EXPECT_EQ(0, pool.getThreadCount());
+    EXPECT_EQ(10, pool.getMaxQueueSize());
+
+    EXPECT_THROW(pool.start(0), BadValue);
+    ASSERT_NO_THROW(pool.start(4));
+    EXPECT_TRUE(pool.isRunning());
+    EXPECT_EQ(4, pool.getThreadCount());
+    EXPECT_THROW(pool.start(4), InvalidOperation);
+
+    pool.stop();
+    EXPECT_FALSE(pool.isRunning());
+    EXPECT_EQ(0, pool.getThreadCount());
+
+    // It should be possible to restart the pool.
+    EXPECT_NO_THROW(pool.start(2));
+    EXPECT_EQ(2, pool.getThreadCount());
+}
+
+// Checks that all work items are executed and that wait() returns when
+// the queue has been drained.
+TEST_F(ThreadPoolTest, addAndWait) {
+    ThreadPool pool(1000);
+
+    // Work items are not accepted until the pool is started.
+    EXPECT_FALSE(pool.add(boost::bind(&ThreadPoolTest::increment, this)));
+
+    ASSERT_NO_THROW(pool.start(4));
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_TRUE(pool.add(boost::bind(&ThreadPoolTest::increment, this)));
+    }
+    pool.wait();
+
+    EXPECT_EQ(1000, getCount());
+    EXPECT_EQ(0, pool.getQueueSize());
+    EXPECT_EQ(0, pool.getDroppedCount());
+}
+
+// Checks that work items are rejected when the queue is full.
+TEST_F(ThreadPoolTest, queueFull) {
+    ThreadPool pool(2);
+    ASSERT_NO_THROW(pool.start(1));
+
+    blocked_ = true;
+
+    // The first item occupies the only worker.
+    ASSERT_TRUE(pool.add(boost::bind(&ThreadPoolTest::block, this)));
+    while (pool.getQueueSize() > 0) {
+        usleep(1000);
+    }
+
+    // The next two are queued, the last one is rejected.
+    EXPECT_TRUE(pool.add(boost::bind(&ThreadPoolTest::block, this)));
+    EXPECT_TRUE(pool.add(boost::bind(&ThreadPoolTest::block, this)));
+    EXPECT_FALSE(pool.add(boost::bind(&ThreadPoolTest::block, this)));
+    EXPECT_EQ(2, pool.getQueueSize());
+    EXPECT_EQ(1, pool.getDroppedCount());
+
+    release();
+    pool.wait();
+    EXPECT_EQ(3, getCount());
+}
+
+// Checks that an exception thrown by a work item doesn't kill the worker.
+TEST_F(ThreadPoolTest, throwingWorkItem) {
+    ThreadPool pool(10);
+    ASSERT_NO_THROW(pool.start(1));
+
+    ASSERT_TRUE(pool.add(boost::bind(&ThreadPoolTest::throwing, this)));
+    ASSERT_TRUE(pool.add(boost::bind(&ThreadPoolTest::increment, this)));
+    pool.wait();
+
+    EXPECT_EQ(1, getCount());
+}
+
+// Checks that each worker thread invokes the functions given to start()
+// when it starts and when it terminates.
+TEST_F(ThreadPoolTest, threadInitAndEnd) {
+    ThreadPool pool(10);
+    ASSERT_NO_THROW(pool.start(4,
+                               boost::bind(&ThreadPoolTest::increment, this),
+                               boost::bind(&ThreadPoolTest::increment, this)));
+    pool.stop();
+    EXPECT_EQ(8, getCount());
+
+    // A throwing function doesn't prevent the thread from working.
+    ASSERT_NO_THROW(pool.start(1,
+                               boost::bind(&ThreadPoolTest::throwing, this)));
+    ASSERT_TRUE(pool.add(boost::bind(&ThreadPoolTest::increment, this)));
+    pool.wait();
+    EXPECT_EQ(9, getCount());
+}
+
+// Checks that stop() discards queued work items.
+TEST_F(ThreadPoolTest, stopDiscardsQueue) {
+    ThreadPool pool(10);
+    ASSERT_NO_THROW(pool.start(1));
+
+    blocked_ = true;
+    ASSERT_TRUE(pool.add(boost::bind(&ThreadPoolTest::block, this)));
+    while (pool.getQueueSize() > 0) {
+        usleep(1000);
+    }
+    ASSERT_TRUE(pool.add(boost::bind(&ThreadPoolTest::increment, this)));
+    ASSERT_TRUE(pool.add(boost::bind(&ThreadPoolTest::increment, this)));
+
+    // Stop the pool from another thread, because stop() waits for the
+    // blocked item. Release it when the queue has been discarded.
+    Thread stopper(boost::bind(&ThreadPool::stop, &pool));
+    while (pool.isRunning()) {
+        usleep(1000);
+    }
+    release();
+    stopper.wait();
+
+    // Only the item taken by the worker has been executed.
+    EXPECT_EQ(1, getCount());
+    EXPECT_EQ(0, pool.getQueueSize());
+}
+
+} // end of anonymous namespace
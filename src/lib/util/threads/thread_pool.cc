@@ -0,0 +1,178 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <exceptions/exceptions.h>
+#include <util/threads/thread_pool.h>
+
+#include <boost/bind.hpp>
+
+namespace isc {
+namespace util {
+namespace thread {
+
+ThreadPool::ThreadPool(const size_t max_queue_size)
+    : max_queue_size_(max_queue_size), thread_init_(), thread_end_(),
+      mutex_(), work_available_(), idle_(),
+      queue_(), working_(0), dropped_(0), running_(false), threads_() {
+    if (max_queue_size_ == 0) {
+        isc_throw(BadValue, "maximum size of the thread pool queue must"
+                  " be greater than 0");
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    stop();
+}
+
+void
+ThreadPool::start(const size_t thread_count, const WorkItem& thread_init,
+                  const WorkItem& thread_end) {
+    if (thread_count == 0) {
+        isc_throw(BadValue, "number of threads in the thread pool must"
+                  " be greater than 0");
+    }
+
+    {
+        Mutex::Locker lock(mutex_);
+        if (running_ || !threads_.empty()) {
+            isc_throw(InvalidOperation, "thread pool is already running");
+        }
+        running_ = true;
+    }
+
+    // The threads are not running, so the functions can be replaced.
+    thread_init_ = thread_init;
+    thread_end_ = thread_end;
+
+    try {
+        for (size_t i = 0; i < thread_count; ++i) {
+            threads_.push_back(boost::shared_ptr<Thread>
+                               (new Thread(boost::bind(&ThreadPool::run,
+                                                       this))));
+        }
+    } catch (...) {
+        // Don't leave partially started pool behind.
+        stop();
+        throw;
+    }
+}
+
+void
+ThreadPool::stop() {
+    {
+        Mutex::Locker lock(mutex_);
+        running_ = false;
+        queue_.clear();
+        work_available_.broadcast();
+    }
+
+    for (std::vector<boost::shared_ptr<Thread> >::const_iterator thread =
+             threads_.begin(); thread != threads_.end(); ++thread) {
+        (*thread)->wait();
+    }
+    threads_.clear();
+
+    // Release anyone who might be waiting for the queue to drain.
+    Mutex::Locker lock(mutex_);
+    working_ = 0;
+    idle_.broadcast();
+}
+
+bool
+ThreadPool::add(const WorkItem& item) {
+    Mutex::Locker lock(mutex_);
+    if (!running_) {
+        return (false);
+    }
+
+    if (queue_.size() >= max_queue_size_) {
+        ++dropped_;
+        return (false);
+    }
+
+    queue_.push_back(item);
+    work_available_.signal();
+    return (true);
+}
+
+void
+ThreadPool::wait() {
+    Mutex::Locker lock(mutex_);
+    while (running_ && (!queue_.empty() || (working_ > 0))) {
+        idle_.wait(mutex_);
+    }
+}
+
+bool
+ThreadPool::isRunning() const {
+    Mutex::Locker lock(mutex_);
+    return (running_);
+}
+
+size_t
+ThreadPool::getThreadCount() const {
+    return (threads_.size());
+}
+
+size_t
+ThreadPool::getQueueSize() const {
+    Mutex::Locker lock(mutex_);
+    return (queue_.size());
+}
+
+uint64_t
+ThreadPool::getDroppedCount() const {
+    Mutex::Locker lock(mutex_);
+    return (dropped_);
+}
+
+void
+ThreadPool::execute(const WorkItem& item) {
+    if (!item) {
+        return;
+    }
+    try {
+        item();
+    } catch (...) {
+        // Work items are expected to handle their own errors. There
+        // is nobody to report the error to, so carry on.
+    }
+}
+
+void
+ThreadPool::run() {
+    execute(thread_init_);
+    for (;;) {
+        WorkItem item;
+        {
+            Mutex::Locker lock(mutex_);
+            while (running_ && queue_.empty()) {
+                work_available_.wait(mutex_);
+            }
+            if (!running_) {
+                break;
+            }
+            item = queue_.front();
+            queue_.pop_front();
+            ++working_;
+        }
+
+        execute(item);
+
+        Mutex::Locker lock(mutex_);
+        --working_;
+        if (queue_.empty() && (working_ == 0)) {
+            idle_.broadcast();
+        }
+    }
+    execute(thread_end_);
+}
+
+} // namespace thread
+} // namespace util
+} // namespace isc
@@ -0,0 +1,170 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef KEA_THREAD_POOL_H
+#define KEA_THREAD_POOL_H
+
+#include <util/threads/sync.h>
+#include <util/threads/thread.h>
+
+#include <boost/function.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <list>
+#include <vector>
+
+#include <stdint.h>
+
+namespace isc {
+namespace util {
+namespace thread {
+
+/// \brief A fixed size pool of worker threads fed by a bounded queue.
+///
+/// The pool is used by the DHCP servers to process received packets
+/// concurrently. A single producer (the thread receiving packets) calls
+/// \c add() to enqueue work items and the workers pick them up in the
+/// order in which they were added. The queue is bounded: when it is full
+/// \c add() returns false and the caller is expected to drop the work item
+/// rather than block, so as a slow backend cannot cause unbounded memory
+/// growth.
+///
+/// The \c wait() method blocks until all queued work items have been
+/// processed. It is used by the producer before it modifies any state
+/// shared with the workers, e.g. prior to applying a new configuration.
+/// Note that \c wait() does not prevent other threads from adding new
+/// work items, so the caller must make sure that it is the only producer.
+///
+/// Work items must not throw. Exceptions escaping from a work item are
+/// caught and ignored by the worker thread.
+class ThreadPool : public boost::noncopyable {
+public:
+    /// \brief Type of the work item executed by the workers.
+    typedef boost::function<void()> WorkItem;
+
+    /// \brief Constructor.
+    ///
+    /// The worker threads are not started until \c start() is called.
+    ///
+    /// \param max_queue_size Maximum number of work items which can wait
+    /// in the queue. The value of 0 is not allowed.
+    ///
+    /// \throw isc::BadValue if the maximum queue size is 0.
+    explicit ThreadPool(const size_t max_queue_size);
+
+    /// \brief Destructor.
+    ///
+    /// Stops the worker threads. Queued work items are discarded.
+    ~ThreadPool();
+
+    /// \brief Starts worker threads.
+    ///
+    /// \param thread_count Number of worker threads to start.
+    /// \param thread_init Function invoked by each worker thread before it
+    /// executes the work items, e.g. to initialize a library for the thread.
+    /// \param thread_end Function invoked by each worker thread before it
+    /// terminates, e.g. to release what \c thread_init has initialized.
+    /// The functions must not throw: exceptions are ignored like those of
+    /// the work items.
+    ///
+    /// \throw isc::InvalidOperation if the pool is already running.
+    /// \throw isc::BadValue if the thread count is 0.
+    void start(const size_t thread_count,
+               const WorkItem& thread_init = WorkItem(),
+               const WorkItem& thread_end = WorkItem());
+
+    /// \brief Stops worker threads.
+    ///
+    /// Work items already taken by the workers are completed. Work items
+    /// remaining in the queue are discarded. This method returns when all
+    /// worker threads have terminated. It is no-op if the pool is not
+    /// running.
+    void stop();
+
+    /// \brief Adds a work item to the queue.
+    ///
+    /// \param item Work item to be executed by one of the workers.
+    ///
+    /// \return true if the work item has been queued, false if the pool
+    /// is not running or the queue is full.
+    bool add(const WorkItem& item);
+
+    /// \brief Waits until all queued work items have been processed.
+    ///
+    /// Returns immediately if the pool is not running.
+    void wait();
+
+    /// \brief Checks if the worker threads are running.
+    bool isRunning() const;
+
+    /// \brief Returns the number of running worker threads.
+    size_t getThreadCount() const;
+
+    /// \brief Returns the maximum number of queued work items.
+    size_t getMaxQueueSize() const {
+        return (max_queue_size_);
+    }
+
+    /// \brief Returns the number of work items waiting in the queue.
+    size_t getQueueSize() const;
+
+    /// \brief Returns the number of work items rejected because the queue
+    /// was full.
+    uint64_t getDroppedCount() const;
+
+private:
+    /// \brief Main loop of a worker thread.
+    void run();
+
+    /// \brief Executes a work item, ignoring its exceptions.
+    ///
+    /// \param item Work item to be executed, possibly empty.
+    static void execute(const WorkItem& item);
+
+    /// \brief Maximum number of queued work items.
+    size_t max_queue_size_;
+
+    /// \brief Function invoked by a worker thread when it starts.
+    WorkItem thread_init_;
+
+    /// \brief Function invoked by a worker thread when it terminates.
+    WorkItem thread_end_;
+
+    /// \brief Protects all members below.
+    mutable Mutex mutex_;
+
+    /// \brief Signalled when a work item is added or the pool is stopped.
+    CondVar work_available_;
+
+    /// \brief Signalled when the queue becomes empty and no work item is
+    /// in progress.
+    CondVar idle_;
+
+    /// \brief Queued work items.
+    std::list<WorkItem> queue_;
+
+    /// \brief Number of work items currently being executed.
+    size_t working_;
+
+    /// \brief Number of work items rejected because the queue was full.
+    uint64_t dropped_;
+
+    /// \brief Indicates if the workers should keep running.
+    bool running_;
+
+    /// \brief Worker threads.
+    std::vector<boost::shared_ptr<Thread> > threads_;
+};
+
+/// \brief Pointer to the thread pool.
+typedef boost::shared_ptr<ThreadPool> ThreadPoolPtr;
+
+} // namespace thread
+} // namespace util
+} // namespace isc
+
+#endif // KEA_THREAD_POOL_H
@@ -128,12 +128,23 @@ VersionedCSVFile::next(CSVRow& row) {
         return(true);
     }
 
+    std::string reason;
+    if (!adaptRow(row, reason)) {
+        columnCountError(row, reason);
+        return (false);
+    }
+
+    return (true);
+}
+
+bool
+VersionedCSVFile::adaptRow(CSVRow& row, std::string& reason) const {
     bool row_valid = true;
     switch(getInputSchemaState()) {
         case CURRENT:
             // All rows must match than the current schema
             if (row.getValuesCount() != getColumnCount()) {
-                columnCountError(row, "must match current schema");
+                reason = "must match current schema";
                 row_valid = false;
             }
             break;
@@ -144,10 +155,10 @@ VersionedCSVFile::next(CSVRow& row) {
             // Rows must not be shorter than the valid column count
             // and not longer than the current schema
             if (row.getValuesCount() < getValidColumnCount()) {
-                columnCountError(row, "too few columns to upgrade");
+                reason = "too few columns to upgrade";
                 row_valid = false;
             } else if (row.getValuesCount() > getColumnCount()) {
-                columnCountError(row, "too many columns to upgrade");
+                reason = "too many columns to upgrade";
                 row_valid = false;
             } else {
                 // Add any missing values
@@ -163,9 +174,11 @@ VersionedCSVFile::next(CSVRow& row) {
             // Rows may be as long as input header but not shorter than
             // the the current schema
             if (row.getValuesCount() < getColumnCount()) {
-                columnCountError(row, "too few columns to downgrade");
+                reason = "too few columns to downgrade";
+                row_valid = false;
             } else if (row.getValuesCount() > getInputHeaderCount()) {
-                columnCountError(row, "too many columns to downgrade");
+                reason = "too many columns to downgrade";
+                row_valid = false;
             } else {
                 // Toss any the extra columns
                 row.trim(row.getValuesCount() - getColumnCount());
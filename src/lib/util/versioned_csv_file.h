@@ -229,6 +229,25 @@ public:
     /// failed.
     bool next(CSVRow& row);
 
+    /// @brief Validates the data row and brings it to the current schema.
+    ///
+    /// This method performs the validation of the row read from the file
+    /// done by @c next, according to the input schema state determined
+    /// when the file was opened. The default values of the missing columns
+    /// are appended to the valid row when the file needs upgrade, and the
+    /// extra values are removed from the valid row when the file needs
+    /// downgrade. The invalid row is not modified.
+    ///
+    /// Unlike @c next, this method doesn't modify the state of the file,
+    /// so it can be called by multiple threads parsing the rows of the
+    /// open file read into memory.
+    ///
+    /// @param [in,out] row Row read from the file.
+    /// @param [out] reason Explanation why the row is invalid.
+    ///
+    /// @return true if the row is valid, false otherwise.
+    bool adaptRow(CSVRow& row, std::string& reason) const;
+
     /// @brief Returns the schema version of the physical file
     ///
     /// @return text version of the schema found or string "undefined" if the